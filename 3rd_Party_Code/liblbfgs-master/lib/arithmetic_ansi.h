@@ -26,6 +26,10 @@
  *that it uses mxMalloc and mxFree if MATLAB_MEX_FILE is defined, making
  *the integration of the library into Matlab simpler.
  *David F. Crouse 6 August 2015
+ *
+ *If LBFGS_STANDARD_ALLOC is also defined, then malloc and free are used
+ *even in mex files. The Matlab memory allocation functions are not thread
+ *safe, so this is necessary if multiple optimizations are run in parallel.
  */
 
 /* $Id$ */
@@ -33,7 +37,7 @@
 #include <stdlib.h>
 #include <memory.h>
 
-#ifdef MATLAB_MEX_FILE
+#if defined(MATLAB_MEX_FILE)&&!defined(LBFGS_STANDARD_ALLOC)
 #include "matrix.h"
 #endif
 
@@ -45,7 +49,7 @@
 
 inline static void* vecalloc(size_t size)
 {
-    #ifdef MATLAB_MEX_FILE
+    #if defined(MATLAB_MEX_FILE)&&!defined(LBFGS_STANDARD_ALLOC)
     void *memblock = mxMalloc(size);
     #else
     void *memblock = malloc(size);
@@ -59,7 +63,7 @@ inline static void* vecalloc(size_t size)
 
 inline static void vecfree(void *memblock)
 {
-    #ifdef MATLAB_MEX_FILE
+    #if defined(MATLAB_MEX_FILE)&&!defined(LBFGS_STANDARD_ALLOC)
     mxFree(memblock);
     #else
     free(memblock);
@@ -34,6 +34,11 @@ function lowerBound=assign3DLB(C,method)
 %                 is discussed in the comments to the code.
 %               1 Use the simple (first) method of summing the minimum
 %                 values across each first index of i as in [2]. 
+%               2 Solve the linear programming relaxation of the problem,
+%                 where rho_{i,j,k} can take any value from 0 to 1, using
+%                 the compiled function linProgRevisedSimplexSparse. The
+%                 bound is usually tighter than the others, but is slower
+%                 to compute for large problems.
 %
 %OUTPUTS: lowerBound A lower bound on the value of the axial 3D assignment
 %                    optimization problem.
@@ -58,7 +63,10 @@ function lowerBound=assign3DLB(C,method)
 %           44, 6, 20, 79];
 % lowerBound0=assign3DLB(C,0);
 % lowerBound1=assign3DLB(C,1);
+% lowerBound2=assign3DLB(C,2);
 %One will find lowerBound0=37, but lowerBound1=26, which is not as tight.
+%The linear programming relaxation gives lowerBound2=37, which is also the
+%optimal cost of the assignment.
 %
 %[1] B.-J. Kim, W. L. Hightower, P. M. Hahn, Y.-R. Zhu, and L. Sun, "Lower
 %    bounds for the axial three-index assignment problem," European Journal
@@ -198,6 +206,19 @@ switch(method)
         for i=1:n1
             lowerBound=lowerBound+min(reshape(C(i,:,:),[n2*n3,1]));
         end
+    case 2%The linear programming relaxation.
+        N=n1*n2*n3;
+        [i,j,k]=ndgrid(1:n1,1:n2,1:n3);
+        
+        %The equality constraints are over i and the inequality constraints
+        %over j and k. Each element of C is in one constraint of each type.
+        A=sparse(i(:),(1:N)',1,n1,N);
+        ALeq=sparse([j(:);n2+k(:)],[(1:N)';(1:N)'],1,n2+n3,N);
+        
+        [lowerBound,~,exitFlag]=linProgRevisedSimplexSparse(A,ones(n1,1),ALeq,ones(n2+n3,1),C(:));
+        if(exitFlag~=0)
+            error('The linear programming relaxation could not be solved.');
+        end
     otherwise
         error('Invalid method chosen');
 end
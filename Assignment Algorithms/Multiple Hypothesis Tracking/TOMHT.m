@@ -0,0 +1,172 @@
+classdef TOMHT < handle
+%%TOMHT A class that keeps the track trees and global hypotheses of a
+%       track-oriented multiple hypothesis tracker (MHT) with N-scan
+%       pruning. The global hypotheses are formed using Murty's k-best 2D
+%       assignment algorithm, as in kBest2DAssign. The class does not do
+%       any filtering: each scan, the user gives the log-likelihood ratios
+%       of updating the current leaves of the track trees with the
+%       measurements and the class decides which hypotheses to keep. The
+%       bookkeeping is done in C++ by the function TOMHTCPPInt, which
+%       must be compiled using CompileCLibraries before this class can be
+%       used.
+%
+%A track tree is started by every measurement that is not assigned to an
+%existing track in a hypothesis. The nodes of the trees are identified by
+%IDs, which are small positive integers that are reused after nodes are
+%pruned. Thus, the user can keep the state estimate of every node in an
+%array indexed by the node ID. The usual procedure for each scan is
+%1) Get the current leaves using [leafIDs,parentIDs,measIdx]=getLeaves().
+%2) Predict the state of each leaf to the time of the scan and gate the
+%   measurements with each leaf. For each gated pair, find the
+%   log-likelihood ratio log(PD*N(z;zPred,S)/lambda), where lambda is the
+%   clutter density, as in the dimensionless score function. The
+%   log-likelihood ratio of a missed detection is log(1-PD) and that of
+%   starting a new track with a measurement is log(lambdaNew/lambda),
+%   where lambdaNew is the density of new targets.
+%3) Call update.
+%4) Get the new leaves using getLeaves. The parent of each new leaf is one
+%   of the leaves from step 1 (or 0 for a new track) and measIdx is the
+%   measurement used to update it (or 0 for a missed detection), so the
+%   state estimate of each new leaf can be computed from that of its
+%   parent. The state estimates of the nodes that are no longer leaves can
+%   be discarded.
+%The best global hypothesis is given by getBestHyp.
+%
+%The track trees are split into clusters of tracks that share
+%measurements, and the hypotheses of each cluster are kept separately,
+%which allows thousands of targets to be tracked. See the comments in
+%TOMHTCPP.cpp for details of the algorithm.
+%
+%October 2026 agent, Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+    properties
+        CPPData%The pointer to the C++ class.
+    end
+
+    methods
+        function newMHT=TOMHT(N,K,delThresh)
+        %%TOMHT Create a new track-oriented MHT.
+        %
+        %INPUTS: N The number of scans back at which decisions are made in
+        %          N-scan pruning. All hypotheses that disagree with the best
+        %          hypothesis about which track, if any, each measurement
+        %          more than N scans ago belongs to are removed.
+        %        K The maximum number of global hypotheses to keep in each
+        %          cluster.
+        % delThresh Tracks whose score (the sum of the log-likelihood
+        %          ratios of the track) falls below this value are
+        %          terminated. If omitted or an empty matrix is passed, -Inf
+        %          is used, so tracks are only removed by pruning.
+        %
+        %October 2026 agent, Naval Research Laboratory, Washington D.C.
+
+            if(nargin<3||isempty(delThresh))
+                delThresh=-Inf;
+            end
+
+            if(~exist('TOMHTCPPInt','file'))
+                error('TOMHT requires TOMHTCPPInt, which can be compiled using CompileCLibraries.');
+            end
+
+            newMHT.CPPData=TOMHTCPPInt('TOMHTCPP',N,K,delThresh);
+        end
+
+        function update(theMHT,missedLogLR,leafIdx,measIdx,logLR,birthLogLR)
+        %%UPDATE Process a scan of measurements.
+        %
+        %INPUTS: missedLogLR A numLeavesX1 vector of the log-likelihood
+        %                ratios of the missed detection hypotheses of the
+        %                current leaves, in the order returned by getLeaves.
+        %        leafIdx A numPairsX1 vector of the positions in the list
+        %                returned by getLeaves (not the IDs) of the leaves
+        %                of the gated leaf-measurement pairs. Each pair
+        %                should only be given once.
+        %        measIdx A numPairsX1 vector of the indices of the
+        %                measurements of the gated pairs.
+        %          logLR A numPairsX1 vector of the log-likelihood ratios of
+        %                the gated pairs.
+        %     birthLogLR A numMeasX1 vector of the log-likelihood ratios of
+        %                starting a new track with each measurement. This
+        %                also sets the number of measurements in the scan.
+        %
+        %October 2026 agent, Naval Research Laboratory, Washington D.C.
+
+            TOMHTCPPInt('update',theMHT.CPPData,missedLogLR,leafIdx,measIdx,logLR,birthLogLR);
+        end
+
+        function [leafIDs,parentIDs,measIdx,treeIDs,scores,probs,clustIdx]=getLeaves(theMHT)
+        %%GETLEAVES Get the leaves of the track trees that are in at least
+        %           one global hypothesis.
+        %
+        %OUTPUTS: leafIDs The numLeavesX1 node IDs of the leaves.
+        %       parentIDs The IDs of the parents of the leaves, which are
+        %                 leaves from the previous scan, or 0 for leaves
+        %                 that start new tracks.
+        %         measIdx The index of the measurement of the current scan
+        %                 that updated each leaf, or 0 for a missed
+        %                 detection.
+        %         treeIDs The ID of the track tree of each leaf, which is a
+        %                 track number that does not change over time.
+        %          scores The score (cumulative log-likelihood ratio) of
+        %                 each track hypothesis.
+        %           probs The probability of each leaf, which is the sum of
+        %                 the probabilities of the global hypotheses of its
+        %                 cluster that contain it.
+        %        clustIdx The index of the cluster of each leaf.
+        %
+        %October 2026 agent, Naval Research Laboratory, Washington D.C.
+
+            [leafIDs,parentIDs,measIdx,treeIDs,scores,probs,clustIdx]=TOMHTCPPInt('getLeaves',theMHT.CPPData);
+        end
+
+        function leafIDs=getBestHyp(theMHT)
+        %%GETBESTHYP Get the IDs of the leaves in the best global hypothesis
+        %            of every cluster.
+
+            leafIDs=TOMHTCPPInt('getBestHyp',theMHT.CPPData);
+        end
+
+        function [scans,measIdx]=getHistory(theMHT,nodeID)
+        %%GETHISTORY Get the history of the track hypothesis ending at a
+        %            node. scans holds the indices of the scans from the
+        %            start of the track and measIdx the index of the
+        %            measurement used at each scan (0 for a missed
+        %            detection).
+
+            [scans,measIdx]=TOMHTCPPInt('getHistory',theMHT.CPPData,nodeID);
+        end
+
+        function [numNodesInUse,poolSize]=getNumNodes(theMHT)
+        %%GETNUMNODES Get the number of nodes in the track trees and the
+        %             size of the pool from which they are allocated. The
+        %             node IDs never exceed poolSize.
+
+            [numNodesInUse,poolSize]=TOMHTCPPInt('getNumNodes',theMHT.CPPData);
+        end
+
+        function delete(theMHT)
+            if(~isempty(theMHT.CPPData))
+                TOMHTCPPInt('~TOMHTCPP',theMHT.CPPData);
+            end
+        end
+    end
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
@@ -0,0 +1,243 @@
+/**TOMHTCPPINT An interface between the Matlab TOMHT class and the C++
+ *             TOMHTCPP class, which does the hypothesis bookkeeping of a
+ *             track-oriented multiple hypothesis tracker. This function is
+ *             meant to be called by the TOMHT class in Matlab; not
+ *             directly by the user. All indices passed to and returned by
+ *             this function are Matlab indices (starting from 1).
+ *
+ *The calling convention is
+ *CPPData=TOMHTCPPInt('TOMHTCPP',N,K,delThresh);
+ *or
+ *TOMHTCPPInt('update',CPPData,missedLogLR,leafIdx,measIdx,logLR,birthLogLR);
+ *or
+ *[leafIDs,parentIDs,measIdx,treeIDs,scores,probs,clustIdx]=TOMHTCPPInt('getLeaves',CPPData);
+ *or
+ *leafIDs=TOMHTCPPInt('getBestHyp',CPPData);
+ *or
+ *[scans,measIdx]=TOMHTCPPInt('getHistory',CPPData,leafID);
+ *or
+ *[numNodesInUse,poolSize]=TOMHTCPPInt('getNumNodes',CPPData);
+ *or
+ *TOMHTCPPInt('~TOMHTCPP',CPPData);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For strcmp
+#include <cstring>
+#include "MexValidation.h"
+#include "TOMHTCPP.hpp"
+#include "mex.h"
+
+void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
+    char cmd[64];
+    TOMHTCPP *theMHT;
+
+    if(nrhs<1) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>7) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    //Get the command string that is passed.
+    mxGetString(prhs[0], cmd, sizeof(cmd));
+
+    if(!strcmp("TOMHTCPP", cmd)) {
+        size_t N, K;
+        double delThresh;
+
+        if(nrhs!=4) {
+            mexErrMsgTxt("Wrong number of inputs.");
+        }
+
+        N=getSizeTFromMatlab(prhs[1]);
+        K=getSizeTFromMatlab(prhs[2]);
+        delThresh=getDoubleFromMatlab(prhs[3]);
+        if(N<1||K<1) {
+            mexErrMsgTxt("N and K must be positive.");
+        }
+
+        theMHT=new TOMHTCPP(N,K,delThresh);
+
+        //Lock this mex file so that it can not be cleared until the object
+        //has been deleted (This avoids a memory leak).
+        mexLock();
+        plhs[0]=ptr2Matlab<TOMHTCPP*>(theMHT);
+        return;
+    }
+
+    if(nrhs<2) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+    theMHT=Matlab2Ptr<TOMHTCPP*>(prhs[1]);
+
+    if(!strcmp("update", cmd)) {
+        const size_t numLeaves=theMHT->leaves.size();
+        size_t numPairs, numMeas, i;
+        size_t *leafIdx, *measIdx;
+        const double *missedLogLR, *logLR, *birthLogLR;
+
+        if(nrhs!=7) {
+            mexErrMsgTxt("Wrong number of inputs.");
+        }
+
+        if(mxGetNumberOfElements(prhs[2])!=numLeaves||(numLeaves>0&&(!mxIsDouble(prhs[2])||mxIsComplex(prhs[2])))) {
+            mexErrMsgTxt("missedLogLR must have one real double element per leaf.");
+        }
+        missedLogLR=(double*)mxGetData(prhs[2]);
+
+        numPairs=mxGetNumberOfElements(prhs[5]);
+        if(mxGetNumberOfElements(prhs[3])!=numPairs||mxGetNumberOfElements(prhs[4])!=numPairs) {
+            mexErrMsgTxt("leafIdx, measIdx and logLR must have the same number of elements.");
+        }
+
+        numMeas=mxGetNumberOfElements(prhs[6]);
+        if(numMeas>0) {
+            checkRealDoubleArray(prhs[6]);
+        }
+        birthLogLR=(double*)mxGetData(prhs[6]);
+
+        if(numPairs>0) {
+            checkRealDoubleArray(prhs[5]);
+            logLR=(double*)mxGetData(prhs[5]);
+            leafIdx=copySizeTArrayFromMatlab(prhs[3],&i);
+            measIdx=copySizeTArrayFromMatlab(prhs[4],&i);
+        } else {
+            logLR=NULL;
+            leafIdx=NULL;
+            measIdx=NULL;
+        }
+
+        //Convert to C indices and check the ranges.
+        for(i=0;i<numPairs;i++) {
+            if(leafIdx[i]<1||leafIdx[i]>numLeaves||measIdx[i]<1||measIdx[i]>numMeas) {
+                mxFree(measIdx);
+                mxFree(leafIdx);
+                mexErrMsgTxt("A leaf or measurement index is out of range.");
+            }
+            leafIdx[i]--;
+            measIdx[i]--;
+        }
+
+        theMHT->update(missedLogLR,numPairs,leafIdx,measIdx,logLR,numMeas,birthLogLR);
+
+        if(numPairs>0) {
+            mxFree(measIdx);
+            mxFree(leafIdx);
+        }
+    } else if(!strcmp("getLeaves", cmd)) {
+        const size_t numLeaves=theMHT->leaves.size();
+        mxArray *retMats[7];
+        double *retVals[7];
+        size_t i;
+
+        for(i=0;i<7;i++) {
+            retMats[i]=mxCreateDoubleMatrix(numLeaves,1,mxREAL);
+            retVals[i]=(double*)mxGetData(retMats[i]);
+        }
+
+        for(i=0;i<numLeaves;i++) {
+            const TOMHTNodeCPP &node=theMHT->nodes[theMHT->leaves[i]];
+
+            retVals[0][i]=(double)(theMHT->leaves[i]+1);
+            retVals[1][i]=(double)(node.parent+1);
+            retVals[2][i]=(double)(node.meas+1);
+            retVals[3][i]=(double)(node.treeID+1);
+            retVals[4][i]=node.score;
+            retVals[6][i]=(double)(theMHT->leafCluster[i]+1);
+        }
+        theMHT->getLeafProbs(retVals[5]);
+
+        for(i=0;i<7;i++) {
+            if(i<(size_t)nlhs||i==0) {
+                plhs[i]=retMats[i];
+            } else {
+                mxDestroyArray(retMats[i]);
+            }
+        }
+    } else if(!strcmp("getBestHyp", cmd)) {
+        size_t *bestLeaves=new size_t[theMHT->leaves.size()];
+        size_t numBest, i;
+        double *retVals;
+
+        numBest=theMHT->getBestHyp(bestLeaves);
+        plhs[0]=mxCreateDoubleMatrix(numBest,1,mxREAL);
+        retVals=(double*)mxGetData(plhs[0]);
+        for(i=0;i<numBest;i++) {
+            retVals[i]=(double)(bestLeaves[i]+1);
+        }
+        delete[] bestLeaves;
+    } else if(!strcmp("getHistory", cmd)) {
+        size_t leafID, pathLength, i;
+        ptrdiff_t node;
+        double *scans, *meas;
+
+        if(nrhs!=3) {
+            mexErrMsgTxt("Wrong number of inputs.");
+        }
+
+        leafID=getSizeTFromMatlab(prhs[2]);
+        if(leafID<1||leafID>theMHT->nodes.size()||theMHT->nodes[leafID-1].numRefs==0) {
+            mexErrMsgTxt("The node ID is not valid.");
+        }
+
+        pathLength=0;
+        for(node=(ptrdiff_t)leafID-1;node>=0;node=theMHT->nodes[node].parent) {
+            pathLength++;
+        }
+
+        plhs[0]=mxCreateDoubleMatrix(pathLength,1,mxREAL);
+        scans=(double*)mxGetData(plhs[0]);
+        //The second output is always created; it is destroyed if it is
+        //not requested.
+        plhs[1]=mxCreateDoubleMatrix(pathLength,1,mxREAL);
+        meas=(double*)mxGetData(plhs[1]);
+
+        //The history is returned from the root to the leaf.
+        i=pathLength;
+        for(node=(ptrdiff_t)leafID-1;node>=0;node=theMHT->nodes[node].parent) {
+            i--;
+            scans[i]=(double)(theMHT->nodes[node].scan+1);
+            meas[i]=(double)(theMHT->nodes[node].meas+1);
+        }
+
+        if(nlhs<2) {
+            mxDestroyArray(plhs[1]);
+        }
+    } else if(!strcmp("getNumNodes", cmd)) {
+        const size_t numInUse=theMHT->numNodesInUse();
+        const size_t poolSize=theMHT->nodes.size();
+
+        plhs[0]=unsignedSizeMat2Matlab(&numInUse,1,1);
+        if(nlhs>1) {
+            plhs[1]=unsignedSizeMat2Matlab(&poolSize,1,1);
+        }
+    } else if(!strcmp("~TOMHTCPP", cmd)) {
+        delete theMHT;
+        //Unlock the mex file allowing it to be cleared.
+        mexUnlock();
+    } else {
+        mexErrMsgTxt("Invalid string passed to TOMHTCPPInt.");
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,911 @@
+/*TOMHTCPP A C++ implementation of the hypothesis bookkeeping of a
+ *         track-oriented multiple hypothesis tracker (MHT) with N-scan
+ *         pruning, where the global hypotheses are formed using Murty's
+ *         k-best 2D assignment algorithm.
+ *
+ *Each track is represented by a tree whose root is the measurement that
+ *started the track and in which each path from the root to a leaf is one
+ *history of measurements (or missed detections) that could belong to the
+ *track. A global hypothesis is a set of leaves, at most one per tree, that
+ *do not share any measurement. The track trees are split into clusters
+ *that do not share measurements and the global hypotheses of each cluster
+ *are kept separately, so that the cost of an update grows with the size
+ *of the clusters rather than with the total number of targets.
+ *
+ *At each scan, the following steps are performed:
+ *1) Clusters whose leaves are gated with the same measurement are merged.
+ *   The hypotheses of the merged cluster are the K best combinations of
+ *   the hypotheses of the clusters merged. A measurement that is not
+ *   gated with any leaf forms a new cluster.
+ *2) Each of the hypotheses of each cluster is expanded using the k-best 2D
+ *   assignment algorithm kBest2D, as in the hypothesis-oriented MHT of
+ *   I. J. Cox and S. L. Hingorani, "An efficient implementation of Reid's
+ *   multiple hypothesis tracking algorithm and its evaluation for the
+ *   purpose of visual tracking," IEEE Transactions on Pattern Analysis
+ *   and Machine Intelligence, vol. 18, no. 2, pp. 138-150, Feb. 1996.
+ *   The rows of the assignment matrix are the measurements of the cluster
+ *   and the missed detection hypotheses of the leaves in the hypothesis
+ *   and the columns are the leaves. A measurement that is not assigned to
+ *   a leaf starts a new track tree. Thus, the gain of assigning a
+ *   measurement to a leaf is the log-likelihood ratio of the update minus
+ *   the log-likelihood ratio of starting a new track. The K best of all of
+ *   the children of all of the hypotheses in the cluster are kept. This
+ *   step is run in parallel over the clusters if OpenMP is available.
+ *3) The children of each leaf are created. Children that have the same
+ *   parent and measurement are shared by all hypotheses, so the nodes of
+ *   the trees are never duplicated.
+ *4) Leaves whose score is below the deletion threshold are removed from
+ *   the hypotheses and duplicate hypotheses are removed.
+ *5) N-scan pruning: In each cluster, the ancestor N scans back of every
+ *   leaf is found. All hypotheses whose set of ancestors differs from that
+ *   of the best hypothesis are removed, so that all remaining hypotheses
+ *   assign the measurements up to N scans back to the same tracks. This
+ *   includes hypotheses that give such a measurement to a track that is
+ *   not in the best hypothesis. The hypotheses that a leaf is in are kept
+ *   as a bitset, so the hypotheses to remove are found by OR-ing the
+ *   bitsets of the leaves that contradict the best hypothesis.
+ *6) Nodes that are no longer in any hypothesis are returned to the pool
+ *   and the pool is walked up from each pruned leaf so that the parts of
+ *   the trees that no longer have leaves are released too.
+ *7) Clusters are split into the connected components of the tracks that
+ *   share measurements in the last N scans. After step 5, older
+ *   measurements are used by the same track in every hypothesis, so they
+ *   cannot be shared by tracks in different components. The hypotheses of each
+ *   component are the distinct projections of the hypotheses of the
+ *   cluster. Since the score of a hypothesis is the sum of the scores of
+ *   its tracks, the score of a projection is the sum of the scores of its
+ *   tracks, and the best hypothesis of the original cluster projects onto
+ *   the best hypotheses of the components. However, this is an
+ *   approximation, as the hypotheses of the components are not
+ *   necessarily independent.
+ *
+ *The scores of the tracks are the dimensionless score function of
+ *Y. Bar-Shalom, S. S. Blackman, and R. J. Fitzgerald, "Dimensionless score
+ *function for multiple hypothesis tracking," IEEE Transactions on Aerospace
+ *and Electronic Systems, vol. 43, no. 1, pp. 392-400, Jan. 2007.
+ *Track-oriented MHT and N-scan pruning are discussed in
+ *S. S. Blackman, "Multiple hypothesis tracking for multiple target
+ *tracking," IEEE Aerospace and Electronic Systems Magazine, vol. 19, no. 1,
+ *pp. 5-18, Jan. 2004.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+**/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For sort, copy, fill_n, lower_bound, max and min
+#include <algorithm>
+//For exp
+#include <cmath>
+//For CHAR_BIT
+#include <climits>
+//For infinity
+#include <limits>
+//For back_inserter
+#include <iterator>
+//For priority_queue
+#include <queue>
+#include "TOMHTCPP.hpp"
+#include "ShortestPathCPP.hpp"
+
+using namespace std;
+
+static const size_t bitsPerWord=sizeof(size_t)*CHAR_BIT;
+static const size_t noIdx=(size_t)-1;
+
+/* The TOMHTChildrenCPP class holds the children of the hypotheses of a
+ * cluster found in step 2. assign[assignOffset[i]+t] is the local index of
+ * the measurement assigned to leaf t of the parent hypothesis of child i,
+ * or -1 for a missed detection.
+ */
+class TOMHTChildrenCPP {
+public:
+    std::vector<double> score;
+    std::vector<size_t> parentHyp;
+    std::vector<size_t> assignOffset;
+    std::vector<ptrdiff_t> assign;
+
+    TOMHTChildrenCPP() : assignOffset(1,0) {}
+};
+
+/* Compare hypotheses, given by their indices, by decreasing score.
+ */
+class TOMHTScoreCompare {
+public:
+    const double *scores;
+
+    TOMHTScoreCompare(const double *scoresDes) : scores(scoresDes) {}
+
+    bool operator()(const size_t a,const size_t b) const {
+        return scores[a]>scores[b]||(scores[a]==scores[b]&&a<b);
+    }
+};
+
+/* Compare hypotheses of a cluster, given by their indices, by their sorted
+ * lists of leaves.
+ */
+class TOMHTLeafCompare {
+public:
+    const TOMHTClusterCPP *clust;
+
+    TOMHTLeafCompare(const TOMHTClusterCPP *clustDes) : clust(clustDes) {}
+
+    bool operator()(const size_t a,const size_t b) const {
+        return lexicographical_compare(clust->hypLeaves.begin()+clust->hypOffsets[a],clust->hypLeaves.begin()+clust->hypOffsets[a+1],clust->hypLeaves.begin()+clust->hypOffsets[b],clust->hypLeaves.begin()+clust->hypOffsets[b+1]);
+    }
+
+    bool equal(const size_t a,const size_t b) const {
+        return clust->hypOffsets[a+1]-clust->hypOffsets[a]==clust->hypOffsets[b+1]-clust->hypOffsets[b]&&std::equal(clust->hypLeaves.begin()+clust->hypOffsets[a],clust->hypLeaves.begin()+clust->hypOffsets[a+1],clust->hypLeaves.begin()+clust->hypOffsets[b]);
+    }
+};
+
+static size_t findRoot(std::vector<size_t> &parent,size_t idx);
+static void reorderHyps(TOMHTClusterCPP &clust,const std::vector<size_t> &order,const size_t numKeep);
+static void sortAndDedupeHyps(TOMHTClusterCPP &clust,const size_t K);
+static void hypMembership(std::vector<size_t> &bits,std::vector<size_t> &uniqueLeaves,const TOMHTClusterCPP &clust,const size_t numWords);
+static void expandCluster(TOMHTChildrenCPP &children,const TOMHTClusterCPP &clust,const size_t *meas,const size_t nM,ptrdiff_t *measLocal,const std::vector<size_t> &leafPosOfNode,const std::vector<size_t> &gateOffset,const std::vector<size_t> &gateMeas,const std::vector<double> &gateLR,const double *missedLogLR,const double *birthLogLR,const size_t K);
+
+TOMHTCPP::TOMHTCPP(const size_t NDes,const size_t KDes,const double delThreshDes) : curScan(0), N(NDes), K(KDes), delThresh(delThreshDes), nextTreeID(0) {
+    numWords=(K+bitsPerWord-1)/bitsPerWord;
+}
+
+size_t TOMHTCPP::allocNode(const ptrdiff_t parent,const ptrdiff_t meas,const size_t treeID,const double score) {
+/*ALLOCNODE Get a node from the pool, enlarging the pool if no nodes are
+ *          free. The node has one reference, for being a leaf.
+ */
+    size_t idx;
+
+    if(freeNodes.empty()) {
+        idx=nodes.size();
+        nodes.push_back(TOMHTNodeCPP());
+    } else {
+        idx=freeNodes.back();
+        freeNodes.pop_back();
+    }
+
+    nodes[idx].parent=parent;
+    nodes[idx].scan=curScan;
+    nodes[idx].meas=meas;
+    nodes[idx].treeID=treeID;
+    nodes[idx].score=score;
+    nodes[idx].numRefs=1;
+    if(parent>=0) {
+        nodes[parent].numRefs++;
+    }
+    return idx;
+}
+
+void TOMHTCPP::releaseNode(size_t idx) {
+/*RELEASENODE Remove a reference to a node. If no references remain, the
+ *            node is returned to the pool and the reference it holds to
+ *            its parent is removed, and so on up the tree.
+ */
+    for(;;) {
+        const ptrdiff_t parent=nodes[idx].parent;
+
+        nodes[idx].numRefs--;
+        if(nodes[idx].numRefs>0) {
+            return;
+        }
+
+        freeNodes.push_back(idx);
+        if(parent<0) {
+            return;
+        }
+        idx=(size_t)parent;
+    }
+}
+
+void TOMHTCPP::update(const double *missedLogLR,const size_t numPairs,const size_t *pairLeaf,const size_t *pairMeas,const double *pairLogLR,const size_t numMeas,const double *birthLogLR) {
+    const size_t numLeaves=leaves.size();
+    const size_t numOldClust=clusters.size();
+    const size_t noNode=noIdx;
+    std::vector<size_t> gateOffset(numLeaves+1,0), gateMeas(numPairs), leafPosOfNode(nodes.size(),noNode);
+    std::vector<double> gateLR(numPairs);
+    std::vector<size_t> clustParent(numOldClust), measClust(numMeas,noIdx), groupOf(numOldClust), measGroup(numMeas);
+    std::vector<size_t> groupMeasOffset, groupMeas(numMeas);
+    std::vector<TOMHTClusterCPP> groups;
+    std::vector<TOMHTChildrenCPP> children;
+    std::vector<size_t> childNodes(numPairs,noNode), missedChild(numLeaves,noNode), birthNode(numMeas,noNode);
+    std::vector<size_t> newNodes;
+    std::vector<TOMHTClusterCPP> finalClusters;
+    size_t i, k, numGroups;
+
+    windowNumMeas.push_back(numMeas);
+    if(windowNumMeas.size()>N) {
+        windowNumMeas.erase(windowNumMeas.begin());
+    }
+
+    //The gated measurements of each leaf in compressed sparse row form.
+    for(k=0;k<numPairs;k++) {
+        gateOffset[pairLeaf[k]+1]++;
+    }
+    for(i=0;i<numLeaves;i++) {
+        gateOffset[i+1]+=gateOffset[i];
+        leafPosOfNode[leaves[i]]=i;
+    }
+    {
+        std::vector<size_t> fillPos(gateOffset.begin(),gateOffset.end()-1);
+
+        for(k=0;k<numPairs;k++) {
+            const size_t idx=fillPos[pairLeaf[k]]++;
+
+            gateMeas[idx]=pairMeas[k];
+            gateLR[idx]=pairLogLR[k];
+        }
+    }
+
+    //Step 1: Merge the clusters that share measurements.
+    for(i=0;i<numOldClust;i++) {
+        clustParent[i]=i;
+    }
+    for(k=0;k<numPairs;k++) {
+        const size_t c=findRoot(clustParent,leafCluster[pairLeaf[k]]);
+        const size_t m=pairMeas[k];
+
+        if(measClust[m]==noIdx) {
+            measClust[m]=c;
+        } else {
+            const size_t c2=findRoot(clustParent,measClust[m]);
+
+            if(c<c2) {
+                clustParent[c2]=c;
+            } else {
+                clustParent[c]=c2;
+            }
+        }
+    }
+
+    numGroups=0;
+    for(i=0;i<numOldClust;i++) {
+        const size_t root=findRoot(clustParent,i);
+
+        if(root==i) {
+            groupOf[i]=numGroups++;
+            groups.push_back(clusters[i]);
+        } else {
+            TOMHTClusterCPP merged;
+
+            groupOf[i]=groupOf[root];
+            mergeClusters(merged,groups[groupOf[i]],clusters[i]);
+            groups[groupOf[i]]=merged;
+        }
+    }
+
+    for(i=0;i<numMeas;i++) {
+        if(measClust[i]!=noIdx) {
+            measGroup[i]=groupOf[findRoot(clustParent,measClust[i])];
+        } else {
+            //A measurement not gated with any leaf can only start a new
+            //track, so it forms a new cluster with one empty hypothesis.
+            TOMHTClusterCPP newClust;
+
+            newClust.hypScores.push_back(0);
+            newClust.hypOffsets.push_back(0);
+            groups.push_back(newClust);
+            measGroup[i]=numGroups++;
+        }
+    }
+
+    groupMeasOffset.assign(numGroups+1,0);
+    for(i=0;i<numMeas;i++) {
+        groupMeasOffset[measGroup[i]+1]++;
+    }
+    for(i=0;i<numGroups;i++) {
+        groupMeasOffset[i+1]+=groupMeasOffset[i];
+    }
+    {
+        std::vector<size_t> fillPos(groupMeasOffset.begin(),groupMeasOffset.end()-1);
+
+        for(i=0;i<numMeas;i++) {
+            groupMeas[fillPos[measGroup[i]]++]=i;
+        }
+    }
+
+    //Step 2: Expand the hypotheses of each cluster.
+    children.resize(numGroups);
+    #pragma omp parallel
+    {
+        std::vector<ptrdiff_t> measLocal(numMeas,-1);
+        ptrdiff_t curGroup;
+
+        #pragma omp for schedule(dynamic)
+        for(curGroup=0;curGroup<(ptrdiff_t)numGroups;curGroup++) {
+            expandCluster(children[curGroup],groups[curGroup],numMeas>0?&groupMeas[0]+groupMeasOffset[curGroup]:NULL,groupMeasOffset[curGroup+1]-groupMeasOffset[curGroup],numMeas>0?&measLocal[0]:NULL,leafPosOfNode,gateOffset,gateMeas,gateLR,missedLogLR,birthLogLR,K);
+        }
+    }
+
+    //Step 3: Create the nodes of the children. This is not done in
+    //parallel, because all clusters share the node pool.
+    finalClusters.resize(numGroups);
+    for(i=0;i<numGroups;i++) {
+        const TOMHTChildrenCPP &curChildren=children[i];
+        const TOMHTClusterCPP &parentClust=groups[i];
+        const size_t *meas=numMeas>0?&groupMeas[0]+groupMeasOffset[i]:NULL;
+        const size_t nM=groupMeasOffset[i+1]-groupMeasOffset[i];
+        TOMHTClusterCPP &newClust=finalClusters[i];
+        std::vector<bool> measUsed(nM);
+        size_t curChild;
+
+        for(curChild=0;curChild<curChildren.score.size();curChild++) {
+            const size_t h=curChildren.parentHyp[curChild];
+            const size_t nT=parentClust.hypOffsets[h+1]-parentClust.hypOffsets[h];
+            const ptrdiff_t *assign=nT>0?&curChildren.assign[0]+curChildren.assignOffset[curChild]:NULL;
+            size_t t, j;
+
+            fill(measUsed.begin(),measUsed.end(),false);
+            for(t=0;t<nT;t++) {
+                const size_t parentNode=parentClust.hypLeaves[parentClust.hypOffsets[h]+t];
+                const size_t pos=leafPosOfNode[parentNode];
+                size_t node;
+
+                if(assign[t]<0) {
+                    if(missedChild[pos]==noNode) {
+                        missedChild[pos]=allocNode((ptrdiff_t)parentNode,-1,nodes[parentNode].treeID,nodes[parentNode].score+missedLogLR[pos]);
+                        newNodes.push_back(missedChild[pos]);
+                    }
+                    node=missedChild[pos];
+                } else {
+                    const size_t m=meas[assign[t]];
+
+                    measUsed[assign[t]]=true;
+                    for(k=gateOffset[pos];gateMeas[k]!=m;k++) {}
+                    if(childNodes[k]==noNode) {
+                        childNodes[k]=allocNode((ptrdiff_t)parentNode,(ptrdiff_t)m,nodes[parentNode].treeID,nodes[parentNode].score+gateLR[k]);
+                        newNodes.push_back(childNodes[k]);
+                    }
+                    node=childNodes[k];
+                }
+
+                if(nodes[node].score>=delThresh) {
+                    newClust.hypLeaves.push_back(node);
+                }
+            }
+
+            //The measurements not assigned to existing tracks start new
+            //tracks.
+            for(j=0;j<nM;j++) {
+                if(!measUsed[j]) {
+                    const size_t m=meas[j];
+
+                    if(birthNode[m]==noNode) {
+                        birthNode[m]=allocNode(-1,(ptrdiff_t)m,nextTreeID++,birthLogLR[m]);
+                        newNodes.push_back(birthNode[m]);
+                    }
+
+                    if(nodes[birthNode[m]].score>=delThresh) {
+                        newClust.hypLeaves.push_back(birthNode[m]);
+                    }
+                }
+            }
+
+            //Step 4: The leaves below the deletion threshold were left out
+            //above, so the score is recomputed from the remaining leaves.
+            {
+                const size_t startIdx=newClust.hypOffsets.back();
+                double score=0;
+
+                sort(newClust.hypLeaves.begin()+startIdx,newClust.hypLeaves.end());
+                for(j=startIdx;j<newClust.hypLeaves.size();j++) {
+                    score+=nodes[newClust.hypLeaves[j]].score;
+                }
+                newClust.hypScores.push_back(score);
+                newClust.hypOffsets.push_back(newClust.hypLeaves.size());
+            }
+        }
+
+        sortAndDedupeHyps(newClust,K);
+    }
+    groups.clear();
+    children.clear();
+
+    //Step 5: N-scan pruning. Nodes are created at scan curScan, which is
+    //incremented at the end.
+    for(i=0;i<numGroups;i++) {
+        nScanPrune(finalClusters[i]);
+    }
+
+    //Step 6: Release the new nodes that are not in any hypothesis, which
+    //are marked by setting their references to 0 plus the number of
+    //children, then release the old leaves, which are no longer leaves.
+    for(i=0;i<numGroups;i++) {
+        const TOMHTClusterCPP &clust=finalClusters[i];
+
+        for(k=0;k<clust.hypLeaves.size();k++) {
+            nodes[clust.hypLeaves[k]].scan=noIdx;
+        }
+    }
+    for(k=0;k<newNodes.size();k++) {
+        const size_t idx=newNodes[k];
+
+        if(nodes[idx].scan==noIdx) {
+            nodes[idx].scan=curScan;
+        } else {
+            releaseNode(idx);
+        }
+    }
+    for(i=0;i<numLeaves;i++) {
+        releaseNode(leaves[i]);
+    }
+
+    //Step 7: Split the clusters into independent parts.
+    {
+        std::vector<size_t> measOwner;
+        size_t numWindowMeas=0;
+
+        for(k=0;k<windowNumMeas.size();k++) {
+            numWindowMeas+=windowNumMeas[k];
+        }
+        measOwner.assign(numWindowMeas,noIdx);
+
+        clusters.clear();
+        for(i=0;i<numGroups;i++) {
+            splitCluster(clusters,finalClusters[i],measOwner);
+        }
+    }
+
+    //The new list of leaves and the bitsets of the hypotheses that each is
+    //in.
+    leaves.clear();
+    leafCluster.clear();
+    leafBits.clear();
+    for(i=0;i<clusters.size();i++) {
+        std::vector<size_t> bits, uniqueLeaves;
+
+        hypMembership(bits,uniqueLeaves,clusters[i],numWords);
+        leaves.insert(leaves.end(),uniqueLeaves.begin(),uniqueLeaves.end());
+        leafCluster.insert(leafCluster.end(),uniqueLeaves.size(),i);
+        leafBits.insert(leafBits.end(),bits.begin(),bits.end());
+    }
+
+    curScan++;
+}
+
+void TOMHTCPP::mergeClusters(TOMHTClusterCPP &merged,const TOMHTClusterCPP &A,const TOMHTClusterCPP &B) const {
+/*MERGECLUSTERS Put the K best combinations of the hypotheses of A and B
+ *              into merged. Since the hypotheses of A and B are sorted by
+ *              decreasing score, the combinations are visited in order of
+ *              decreasing score using a priority queue, as in the
+ *              standard algorithm for the k largest sums of two sorted
+ *              lists.
+ */
+    std::priority_queue<std::pair<double,std::pair<size_t,size_t> > > combQueue;
+
+    if(A.numHyp()==0||B.numHyp()==0) {
+        return;
+    }
+
+    combQueue.push(std::make_pair(A.hypScores[0]+B.hypScores[0],std::make_pair((size_t)0,(size_t)0)));
+    while(!combQueue.empty()&&merged.numHyp()<K) {
+        const size_t a=combQueue.top().second.first;
+        const size_t b=combQueue.top().second.second;
+
+        merged.hypScores.push_back(combQueue.top().first);
+        combQueue.pop();
+
+        merge(A.hypLeaves.begin()+A.hypOffsets[a],A.hypLeaves.begin()+A.hypOffsets[a+1],B.hypLeaves.begin()+B.hypOffsets[b],B.hypLeaves.begin()+B.hypOffsets[b+1],back_inserter(merged.hypLeaves));
+        merged.hypOffsets.push_back(merged.hypLeaves.size());
+
+        //Each combination is reached from exactly one predecessor.
+        if(b+1<B.numHyp()) {
+            combQueue.push(std::make_pair(A.hypScores[a]+B.hypScores[b+1],std::make_pair(a,b+1)));
+        }
+        if(b==0&&a+1<A.numHyp()) {
+            combQueue.push(std::make_pair(A.hypScores[a+1]+B.hypScores[0],std::make_pair(a+1,(size_t)0)));
+        }
+    }
+}
+
+void TOMHTCPP::nScanPrune(TOMHTClusterCPP &clust) const {
+/*NSCANPRUNE Remove the hypotheses whose assignments of the measurements
+ *           up to scan curScan-N differ from those of the best
+ *           hypothesis. Since the nodes of the trees are never
+ *           duplicated, those assignments are given by the set of the
+ *           ancestors at scan curScan-N of the leaves of a hypothesis, so
+ *           a hypothesis is kept only if its set of ancestors is that of
+ *           the best hypothesis. This also removes the hypotheses that
+ *           give an old measurement to a track that is not in the best
+ *           hypothesis.
+ */
+    std::vector<size_t> bits, uniqueLeaves, leafAncestor, bestAncestors, hasMask, delMask(numWords,0);
+    std::vector<size_t> keep;
+    size_t i, j, k;
+
+    if(curScan<N||clust.numHyp()<2) {
+        return;
+    }
+
+    //The ancestor of each leaf at scan curScan-N, which exists if the
+    //track is old enough.
+    hypMembership(bits,uniqueLeaves,clust,numWords);
+    leafAncestor.resize(uniqueLeaves.size());
+    for(i=0;i<uniqueLeaves.size();i++) {
+        ptrdiff_t node=(ptrdiff_t)uniqueLeaves[i];
+
+        while(node>=0&&nodes[node].scan>curScan-N) {
+            node=nodes[node].parent;
+        }
+        leafAncestor[i]=node>=0?(size_t)node:noIdx;
+
+        //Hypothesis 0 is the best one.
+        if(node>=0&&(bits[i*numWords]&1)) {
+            bestAncestors.push_back((size_t)node);
+        }
+    }
+    sort(bestAncestors.begin(),bestAncestors.end());
+
+    //A hypothesis is removed if one of its leaves has an ancestor that is
+    //not in the best hypothesis or if it lacks one of the ancestors of the
+    //best hypothesis.
+    hasMask.assign(bestAncestors.size()*numWords,0);
+    for(i=0;i<uniqueLeaves.size();i++) {
+        std::vector<size_t>::const_iterator it;
+        size_t *mask;
+
+        if(leafAncestor[i]==noIdx) {
+            continue;
+        }
+
+        it=lower_bound(bestAncestors.begin(),bestAncestors.end(),leafAncestor[i]);
+        if(it==bestAncestors.end()||*it!=leafAncestor[i]) {
+            mask=&delMask[0];
+        } else {
+            mask=&hasMask[(it-bestAncestors.begin())*numWords];
+        }
+
+        for(k=0;k<numWords;k++) {
+            mask[k]|=bits[i*numWords+k];
+        }
+    }
+    for(j=0;j<bestAncestors.size();j++) {
+        for(k=0;k<numWords;k++) {
+            delMask[k]|=~hasMask[j*numWords+k];
+        }
+    }
+
+    for(i=0;i<clust.numHyp();i++) {
+        if(!((delMask[i/bitsPerWord]>>(i%bitsPerWord))&1)) {
+            keep.push_back(i);
+        }
+    }
+    reorderHyps(clust,keep,keep.size());
+}
+
+void TOMHTCPP::splitCluster(std::vector<TOMHTClusterCPP> &newClusters,const TOMHTClusterCPP &clust,std::vector<size_t> &measOwner) const {
+/*SPLITCLUSTER Split a cluster into the connected components of the tracks
+ *             whose leaves share measurements in the last N scans and
+ *             append the components that have leaves to newClusters.
+ *             measOwner must have one entry set to noIdx for every
+ *             measurement in the window; the entries are reset before
+ *             returning.
+ */
+    const size_t firstWindowScan=curScan+1-windowNumMeas.size();
+    std::vector<size_t> uniqueLeaves, bits, treeIDs, treeParent, touched, compOf, windowOffset(windowNumMeas.size(),0);
+    size_t i, k, numComp;
+
+    hypMembership(bits,uniqueLeaves,clust,numWords);
+    if(uniqueLeaves.empty()) {
+        return;
+    }
+
+    for(k=1;k<windowNumMeas.size();k++) {
+        windowOffset[k]=windowOffset[k-1]+windowNumMeas[k-1];
+    }
+
+    for(i=0;i<uniqueLeaves.size();i++) {
+        treeIDs.push_back(nodes[uniqueLeaves[i]].treeID);
+    }
+    sort(treeIDs.begin(),treeIDs.end());
+    treeIDs.erase(unique(treeIDs.begin(),treeIDs.end()),treeIDs.end());
+    if(treeIDs.size()==1) {
+        newClusters.push_back(clust);
+        return;
+    }
+
+    treeParent.resize(treeIDs.size());
+    for(i=0;i<treeIDs.size();i++) {
+        treeParent[i]=i;
+    }
+
+    for(i=0;i<uniqueLeaves.size();i++) {
+        const size_t tree=lower_bound(treeIDs.begin(),treeIDs.end(),nodes[uniqueLeaves[i]].treeID)-treeIDs.begin();
+        ptrdiff_t node=(ptrdiff_t)uniqueLeaves[i];
+
+        while(node>=0&&nodes[node].scan>=firstWindowScan) {
+            if(nodes[node].meas>=0) {
+                const size_t idx=windowOffset[nodes[node].scan-firstWindowScan]+(size_t)nodes[node].meas;
+
+                if(measOwner[idx]==noIdx) {
+                    measOwner[idx]=tree;
+                    touched.push_back(idx);
+                } else {
+                    const size_t r1=findRoot(treeParent,tree);
+                    const size_t r2=findRoot(treeParent,measOwner[idx]);
+
+                    if(r1<r2) {
+                        treeParent[r2]=r1;
+                    } else {
+                        treeParent[r1]=r2;
+                    }
+                }
+            }
+            node=nodes[node].parent;
+        }
+    }
+
+    for(k=0;k<touched.size();k++) {
+        measOwner[touched[k]]=noIdx;
+    }
+
+    compOf.resize(treeIDs.size());
+    numComp=0;
+    for(i=0;i<treeIDs.size();i++) {
+        const size_t root=findRoot(treeParent,i);
+
+        compOf[i]=root==i?numComp++:compOf[root];
+    }
+
+    if(numComp==1) {
+        newClusters.push_back(clust);
+        return;
+    }
+
+    {
+        const size_t firstNew=newClusters.size();
+        size_t h;
+
+        newClusters.resize(firstNew+numComp);
+        for(h=0;h<clust.numHyp();h++) {
+            for(i=0;i<numComp;i++) {
+                newClusters[firstNew+i].hypScores.push_back(0);
+            }
+
+            for(k=clust.hypOffsets[h];k<clust.hypOffsets[h+1];k++) {
+                const size_t leaf=clust.hypLeaves[k];
+                const size_t tree=lower_bound(treeIDs.begin(),treeIDs.end(),nodes[leaf].treeID)-treeIDs.begin();
+                TOMHTClusterCPP &comp=newClusters[firstNew+compOf[tree]];
+
+                comp.hypLeaves.push_back(leaf);
+                comp.hypScores.back()+=nodes[leaf].score;
+            }
+
+            for(i=0;i<numComp;i++) {
+                TOMHTClusterCPP &comp=newClusters[firstNew+i];
+
+                comp.hypOffsets.push_back(comp.hypLeaves.size());
+            }
+        }
+
+        for(i=0;i<numComp;i++) {
+            sortAndDedupeHyps(newClusters[firstNew+i],K);
+        }
+    }
+}
+
+void TOMHTCPP::getLeafProbs(double *probs) const {
+    size_t i, j;
+
+    for(i=0;i<leaves.size();i++) {
+        const TOMHTClusterCPP &clust=clusters[leafCluster[i]];
+        const double maxScore=clust.hypScores[0];
+        double sumW=0, leafW=0;
+
+        for(j=0;j<clust.numHyp();j++) {
+            const double w=exp(clust.hypScores[j]-maxScore);
+
+            sumW+=w;
+            if((leafBits[i*numWords+j/bitsPerWord]>>(j%bitsPerWord))&1) {
+                leafW+=w;
+            }
+        }
+        probs[i]=leafW/sumW;
+    }
+}
+
+size_t TOMHTCPP::getBestHyp(size_t *bestLeaves) const {
+    size_t i, numBest=0;
+
+    for(i=0;i<clusters.size();i++) {
+        const TOMHTClusterCPP &clust=clusters[i];
+
+        copy(clust.hypLeaves.begin()+clust.hypOffsets[0],clust.hypLeaves.begin()+clust.hypOffsets[1],bestLeaves+numBest);
+        numBest+=clust.hypOffsets[1]-clust.hypOffsets[0];
+    }
+    return numBest;
+}
+
+static void expandCluster(TOMHTChildrenCPP &children,const TOMHTClusterCPP &clust,const size_t *meas,const size_t nM,ptrdiff_t *measLocal,const std::vector<size_t> &leafPosOfNode,const std::vector<size_t> &gateOffset,const std::vector<size_t> &gateMeas,const std::vector<double> &gateLR,const double *missedLogLR,const double *birthLogLR,const size_t K) {
+/*EXPANDCLUSTER Find the K best children of all of the hypotheses of a
+ *              cluster, whose measurements are meas, using kBest2D.
+ *              measLocal must have an entry of -1 for every measurement;
+ *              the entries are reset before returning.
+ */
+    const double inf=numeric_limits<double>::infinity();
+    TOMHTChildrenCPP allChildren;
+    std::vector<double> C, gain(K);
+    std::vector<ptrdiff_t> col4row, row4col;
+    std::vector<size_t> order;
+    double sumBirth=0;
+    size_t h, j, k, t;
+
+    for(j=0;j<nM;j++) {
+        measLocal[meas[j]]=(ptrdiff_t)j;
+        sumBirth+=birthLogLR[meas[j]];
+    }
+
+    for(h=0;h<clust.numHyp();h++) {
+        const size_t nT=clust.hypOffsets[h+1]-clust.hypOffsets[h];
+        const size_t *hypLeaves=nT>0?&clust.hypLeaves[0]+clust.hypOffsets[h]:NULL;
+        const size_t numRow=nM+nT;
+        size_t numFound;
+
+        if(nT==0) {
+            //All of the measurements start new tracks.
+            allChildren.score.push_back(clust.hypScores[h]+sumBirth);
+            allChildren.parentHyp.push_back(h);
+            allChildren.assignOffset.push_back(allChildren.assign.size());
+            continue;
+        }
+
+        //The rows are the measurements followed by the missed detection
+        //hypotheses and the columns are the leaves. The costs are
+        //negative log-likelihood ratios relative to starting new tracks.
+        C.assign(numRow*nT,inf);
+        for(t=0;t<nT;t++) {
+            const size_t pos=leafPosOfNode[hypLeaves[t]];
+            double *CCol=&C[0]+t*numRow;
+
+            for(k=gateOffset[pos];k<gateOffset[pos+1];k++) {
+                const size_t r=(size_t)measLocal[gateMeas[k]];
+
+                if(CCol[r]==inf) {
+                    CCol[r]=-(gateLR[k]-birthLogLR[gateMeas[k]]);
+                }
+            }
+            CCol[nM+t]=-missedLogLR[pos];
+        }
+
+        col4row.resize(numRow*K);
+        row4col.resize(nT*K);
+        {
+            ScratchSpace workMem(numRow,numRow);
+
+            numFound=kBest2D(K,numRow,nT,false,&C[0],workMem,&col4row[0],&row4col[0],&gain[0]);
+        }
+
+        for(k=0;k<numFound;k++) {
+            allChildren.score.push_back(clust.hypScores[h]-gain[k]+sumBirth);
+            allChildren.parentHyp.push_back(h);
+            for(t=0;t<nT;t++) {
+                const size_t r=(size_t)row4col[k*nT+t];
+
+                allChildren.assign.push_back(r<nM?(ptrdiff_t)r:-1);
+            }
+            allChildren.assignOffset.push_back(allChildren.assign.size());
+        }
+    }
+
+    for(j=0;j<nM;j++) {
+        measLocal[meas[j]]=-1;
+    }
+
+    //Keep the K best children.
+    order.resize(allChildren.score.size());
+    for(k=0;k<order.size();k++) {
+        order[k]=k;
+    }
+    if(!order.empty()) {
+        sort(order.begin(),order.end(),TOMHTScoreCompare(&allChildren.score[0]));
+    }
+    if(order.size()>K) {
+        order.resize(K);
+    }
+
+    for(k=0;k<order.size();k++) {
+        const size_t c=order[k];
+
+        children.score.push_back(allChildren.score[c]);
+        children.parentHyp.push_back(allChildren.parentHyp[c]);
+        children.assign.insert(children.assign.end(),allChildren.assign.begin()+allChildren.assignOffset[c],allChildren.assign.begin()+allChildren.assignOffset[c+1]);
+        children.assignOffset.push_back(children.assign.size());
+    }
+}
+
+static void hypMembership(std::vector<size_t> &bits,std::vector<size_t> &uniqueLeaves,const TOMHTClusterCPP &clust,const size_t numWords) {
+/*HYPMEMBERSHIP Put the sorted distinct leaves of the hypotheses of a
+ *              cluster in uniqueLeaves and the bitset of the hypotheses
+ *              that each is in in bits, numWords words per leaf.
+ */
+    size_t h, k;
+
+    uniqueLeaves.assign(clust.hypLeaves.begin(),clust.hypLeaves.end());
+    sort(uniqueLeaves.begin(),uniqueLeaves.end());
+    uniqueLeaves.erase(unique(uniqueLeaves.begin(),uniqueLeaves.end()),uniqueLeaves.end());
+
+    bits.assign(uniqueLeaves.size()*numWords,0);
+    for(h=0;h<clust.numHyp();h++) {
+        for(k=clust.hypOffsets[h];k<clust.hypOffsets[h+1];k++) {
+            const size_t i=lower_bound(uniqueLeaves.begin(),uniqueLeaves.end(),clust.hypLeaves[k])-uniqueLeaves.begin();
+
+            bits[i*numWords+h/bitsPerWord]|=(size_t)1<<(h%bitsPerWord);
+        }
+    }
+}
+
+static void reorderHyps(TOMHTClusterCPP &clust,const std::vector<size_t> &order,const size_t numKeep) {
+/*REORDERHYPS Keep the first numKeep hypotheses given by order, in that
+ *            order.
+ */
+    TOMHTClusterCPP newClust;
+    size_t k;
+
+    for(k=0;k<numKeep;k++) {
+        const size_t h=order[k];
+
+        newClust.hypScores.push_back(clust.hypScores[h]);
+        newClust.hypLeaves.insert(newClust.hypLeaves.end(),clust.hypLeaves.begin()+clust.hypOffsets[h],clust.hypLeaves.begin()+clust.hypOffsets[h+1]);
+        newClust.hypOffsets.push_back(newClust.hypLeaves.size());
+    }
+
+    clust.hypScores.swap(newClust.hypScores);
+    clust.hypOffsets.swap(newClust.hypOffsets);
+    clust.hypLeaves.swap(newClust.hypLeaves);
+}
+
+static void sortAndDedupeHyps(TOMHTClusterCPP &clust,const size_t K) {
+/*SORTANDDEDUPEHYPS Remove hypotheses with the same leaves, which can
+ *                  arise from deletions and cluster splits, sort the
+ *                  hypotheses by decreasing score and keep at most K.
+ */
+    const TOMHTLeafCompare leafComp(&clust);
+    std::vector<size_t> order(clust.numHyp()), uniqueHyps;
+    size_t k;
+
+    if(clust.numHyp()==0) {
+        return;
+    }
+
+    for(k=0;k<order.size();k++) {
+        order[k]=k;
+    }
+    sort(order.begin(),order.end(),leafComp);
+    for(k=0;k<order.size();k++) {
+        if(k==0||!leafComp.equal(order[k],order[k-1])) {
+            uniqueHyps.push_back(order[k]);
+        } else if(clust.hypScores[order[k]]>clust.hypScores[uniqueHyps.back()]) {
+            uniqueHyps.back()=order[k];
+        }
+    }
+
+    if(!uniqueHyps.empty()) {
+        sort(uniqueHyps.begin(),uniqueHyps.end(),TOMHTScoreCompare(&clust.hypScores[0]));
+    }
+    reorderHyps(clust,uniqueHyps,min(uniqueHyps.size(),K));
+}
+
+static size_t findRoot(std::vector<size_t> &parent,size_t idx) {
+//Find the root of the set containing idx in a union-find structure,
+//halving the path along the way.
+    while(parent[idx]!=idx) {
+        parent[idx]=parent[parent[idx]];
+        idx=parent[idx];
+    }
+    return idx;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
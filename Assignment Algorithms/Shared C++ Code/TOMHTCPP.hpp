@@ -0,0 +1,155 @@
+/**TOMHTCPP A header file for a C++ implementation of the hypothesis
+ *          bookkeeping of a track-oriented multiple hypothesis tracker
+ *          (MHT). The class keeps the track trees, the global hypotheses
+ *          and the clusters of the MHT, but does no filtering itself: the
+ *          caller supplies the log-likelihood ratios of updating the
+ *          leaves of the track trees with the measurements of each scan
+ *          and keeps the state estimates of the nodes. See the file
+ *          TOMHTCPP.cpp for details.
+ *
+ *This file needs to be compiled with the files TOMHTCPP.cpp and
+ *ShortestPathCPP.cpp.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef TOMHTCPPDEF
+#define TOMHTCPPDEF
+#include <stddef.h>
+#include <vector>
+
+/**The TOMHTNodeCPP class is a node in a track tree. Each node stores the
+ * index of its parent rather than copies of the history, so the histories
+ * of all of the hypotheses of a track are shared. meas is the index of the
+ * measurement at scan scan that updated the track, or -1 for a missed
+ * detection. score is the cumulative log-likelihood ratio of the track
+ * (the dimensionless score function). numRefs is the number of children
+ * of the node plus one if the node is a leaf that is in a global
+ * hypothesis. A node is returned to the pool when numRefs reaches zero.
+ **/
+class TOMHTNodeCPP {
+public:
+    ptrdiff_t parent;
+    size_t scan;
+    ptrdiff_t meas;
+    size_t treeID;
+    double score;
+    size_t numRefs;
+};
+
+/**The TOMHTClusterCPP class holds the global hypotheses of a cluster of
+ * track trees that share measurements. Hypothesis i consists of the leaves
+ * hypLeaves[hypOffsets[i]] to hypLeaves[hypOffsets[i+1]-1], which are
+ * sorted, and has the score hypScores[i], which is the sum of the scores
+ * of its leaves. The hypotheses are sorted by decreasing score.
+ **/
+class TOMHTClusterCPP {
+public:
+    std::vector<double> hypScores;
+    std::vector<size_t> hypOffsets;
+    std::vector<size_t> hypLeaves;
+
+    TOMHTClusterCPP() : hypOffsets(1,0) {}
+
+    size_t numHyp() const {
+        return hypScores.size();
+    }
+};
+
+/**The TOMHTCPP class manages the track trees and global hypotheses of a
+ * track-oriented MHT. N is the depth of the N-scan pruning, K is the
+ * maximum number of global hypotheses kept in each cluster and leaves
+ * whose scores fall below delThresh are removed from the hypotheses,
+ * which terminates the track in those hypotheses. The nodes are kept in a
+ * pool and the index of a node in the pool is its ID. IDs are reused
+ * after the nodes are pruned, so a caller that stores data indexed by
+ * node ID can use arrays whose length is the size of the pool.
+ **/
+class TOMHTCPP {
+public:
+    TOMHTCPP(const size_t NDes,const size_t KDes,const double delThreshDes);
+
+    void update(const double *missedLogLR,
+                const size_t numPairs,
+                const size_t *pairLeaf,
+                const size_t *pairMeas,
+                const double *pairLogLR,
+                const size_t numMeas,
+                const double *birthLogLR);
+    /*UPDATE Process a scan of numMeas measurements. missedLogLR holds the
+     *       log-likelihood ratio of the missed detection hypothesis of
+     *       each of the current leaves, in the order of the leaves
+     *       vector. The numPairs gated leaf-measurement pairs are given by
+     *       the positions of the leaves in the leaves vector in pairLeaf,
+     *       the measurement indices in pairMeas and the log-likelihood
+     *       ratios in pairLogLR. birthLogLR holds the log-likelihood ratio
+     *       of starting a new track with each measurement. After the
+     *       update, the leaves vector holds the new leaves.
+     */
+
+    void getLeafProbs(double *probs) const;
+    /*GETLEAFPROBS Put the probability of each leaf, which is the sum of
+     *             the normalized weights of the hypotheses of its cluster
+     *             that contain it, in probs.
+     */
+
+    size_t getBestHyp(size_t *bestLeaves) const;
+    /*GETBESTHYP Put the leaves of the best hypothesis of every cluster in
+     *           bestLeaves, which must have space for all of the leaves,
+     *           and return their number.
+     */
+
+    size_t numNodesInUse() const {
+        return nodes.size()-freeNodes.size();
+    }
+
+    //The nodes, indexed by their IDs.
+    std::vector<TOMHTNodeCPP> nodes;
+    //The IDs of the leaves of the current scan and the index of the
+    //cluster of each.
+    std::vector<size_t> leaves;
+    std::vector<size_t> leafCluster;
+    std::vector<TOMHTClusterCPP> clusters;
+    //The number of scans processed.
+    size_t curScan;
+private:
+    size_t N;
+    size_t K;
+    double delThresh;
+    size_t nextTreeID;
+    std::vector<size_t> freeNodes;
+    //The number of measurements in each of the last N scans, the most
+    //recent last.
+    std::vector<size_t> windowNumMeas;
+    //The bitsets of the hypotheses of its cluster that each leaf is in,
+    //numWords words per leaf.
+    size_t numWords;
+    std::vector<size_t> leafBits;
+
+    size_t allocNode(const ptrdiff_t parent,const ptrdiff_t meas,const size_t treeID,const double score);
+    void releaseNode(size_t idx);
+    void mergeClusters(TOMHTClusterCPP &merged,const TOMHTClusterCPP &A,const TOMHTClusterCPP &B) const;
+    void nScanPrune(TOMHTClusterCPP &clust) const;
+    void splitCluster(std::vector<TOMHTClusterCPP> &newClusters,const TOMHTClusterCPP &clust,std::vector<size_t> &measOwner) const;
+};
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,730 @@
+/*SINGLESCANUPDATECPP A C++ implementation of the measurement update step
+ *             of single-scan tracking algorithms that represent each
+ *             target with a Gaussian before and after the update. This
+ *             performs all of the steps that the Matlab function
+ *             singleScanUpdate requires to be done separately: the
+ *             (extended) Kalman filter update of each target with each
+ *             measurement, gating, the formation of the likelihood ratios,
+ *             the data association, and the collapse of the hypotheses of
+ *             each target into a single Gaussian.
+ *
+ *The steps of the algorithm are
+ *1) For each target, the predicted measurement, the innovation covariance
+ *   matrix S, the gain W and the updated covariance matrix, which are the
+ *   same for all measurements, are computed. For the nonlinear measurement
+ *   models, the Jacobian is evaluated at the predicted state as in the
+ *   extended Kalman filter.
+ *2) Each measurement z is gated with each target by the test
+ *   nu'*inv(S)*nu<=gateThresh, where nu=z-zPred is the innovation. The
+ *   log-likelihood ratio of a gated measurement is
+ *   log(PD*N(nu;0,S)/lambda) and that of the missed detection is
+ *   log(1-PD), as in the dimensionless score function.
+ *3) The targets are split into clusters such that no measurement is gated
+ *   with targets in two different clusters. The clusters are found using a
+ *   union-find structure over the targets.
+ *4) Each cluster is solved independently. The GNN assignment is found with
+ *   the shortest augmenting path algorithm assign2D and the JPDA
+ *   association probabilities are found with matrix permanents, as in the
+ *   function calc2DAssignmentProbs with diagAugment=true. The rows of the
+ *   likelihood ratio matrix are scaled by their maxima before computing
+ *   the permanents; this does not change the probabilities, but avoids
+ *   overflow and underflow.
+ *5) The hypotheses of each target are collapsed using mixtureMomentsCPP.
+ *
+ *The computational complexity of the JPDA is exponential in the number of
+ *targets and measurements in a cluster, so the JPDA should only be used
+ *when the gates keep the clusters small. The other algorithms have a
+ *polynomial complexity. The targets are updated in parallel in steps 1
+ *and 2 and the clusters are solved in parallel in steps 4 and 5 if OpenMP
+ *is available. Each thread allocates its scratch space once for the
+ *largest cluster. The result does not depend on the number of threads.
+ *
+ *The JPDA, GNN-JPDA and the parallel PDAs are described in the comments
+ *to singleScanUpdate.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+**/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy and fill_n
+#include <algorithm>
+//For log, exp and sqrt
+#include <cmath>
+//For infinity
+#include <limits>
+#include "singleScanUpdateCPP.hpp"
+#include "ShortestPathCPP.hpp"
+#include "permCPP.hpp"
+#include "matrixFuncs.hpp"
+#include "filterFuncs.hpp"
+#include "clusterFuncs.hpp"
+
+using namespace std;
+
+static size_t findRoot(size_t *parent,size_t idx);
+
+/**The SingleScanTrackInfo class holds the quantities of the Kalman filter
+ * update that are computed once for each target, as well as the gated
+ * measurements of each target and their log-likelihood ratios.
+ **/
+class SingleScanTrackInfo {
+public:
+    size_t xDim;
+    size_t zDim;
+    double *zPred;
+    double *W;
+    double *SChol;
+    double *PPost;
+    double *logNorm;
+    size_t *gateOffset;
+    size_t *gatedMeas;
+    double *gatedLogLR;
+
+    SingleScanTrackInfo(const size_t numTar,const size_t xDimDes,const size_t zDimDes) : xDim(xDimDes), zDim(zDimDes), gatedMeas(NULL), gatedLogLR(NULL) {
+        buffer=new double[numTar*(zDim+xDim*zDim+zDim*zDim+xDim*xDim+1)];
+        zPred=buffer;
+        W=zPred+numTar*zDim;
+        SChol=W+numTar*xDim*zDim;
+        PPost=SChol+numTar*zDim*zDim;
+        logNorm=PPost+numTar*xDim*xDim;
+        gateOffset=new size_t[numTar+1];
+    }
+
+    void allocGated(const size_t numGated) {
+        gatedMeas=new size_t[numGated];
+        gatedLogLR=new double[numGated];
+    }
+
+    bool gate(double *logLR,double *nu,const double *z,const size_t curTar,const int measType,const double gateThresh) const {
+    /*GATE Compute the innovation nu of the measurement z with respect to
+     *     target curTar. If it is in the gate, the log-likelihood ratio is
+     *     put in logLR and true is returned.
+     */
+        const double *zPredCur=zPred+curTar*zDim;
+        double d2=0;
+        size_t i;
+
+        for(i=0;i<zDim;i++) {
+            nu[i]=z[i]-zPredCur[i];
+        }
+        wrapMeasResidualCPP(nu,measType);
+
+        //The normalized distance uses a copy of nu so that nu can be used
+        //in the state update.
+        copy(nu,nu+zDim,nu+zDim);
+        forwardSubstCPP(nu+zDim,SChol+curTar*zDim*zDim,zDim,1);
+        for(i=0;i<zDim;i++) {
+            d2+=nu[zDim+i]*nu[zDim+i];
+        }
+
+        if(!(d2<=gateThresh)) {
+            return false;
+        }
+
+        *logLR=logNorm[curTar]-0.5*d2;
+        return true;
+    }
+
+    ~SingleScanTrackInfo() {
+        delete[] buffer;
+        delete[] gateOffset;
+        if(gatedMeas!=NULL) {
+            delete[] gatedMeas;
+            delete[] gatedLogLR;
+        }
+    }
+private:
+    double *buffer;
+
+    //Copying is not allowed, because the buffers would be freed twice.
+    SingleScanTrackInfo(const SingleScanTrackInfo &);
+    SingleScanTrackInfo &operator=(const SingleScanTrackInfo &);
+};
+
+/* The SingleScanScratch class holds the scratch space that a thread uses
+ * to solve clusters of up to maxTar targets and maxMeas measurements.
+ */
+class SingleScanScratch {
+public:
+    ptrdiff_t *measLocal;
+    double *logA;
+    double *A;
+    double *beta;
+    double *cost;
+    size_t *permBuffer;
+    double *hypMeans;
+    double *hypCovs;
+    double *hypW;
+    double *nu;
+    double *xHard;
+    double *mixScratch;
+    ScratchSpace workMem;
+    MurtyHyp problemSol;
+
+    SingleScanScratch(const size_t numMeas,const size_t maxTar,const size_t maxMeas,const size_t xDim,const size_t zDim) : workMem(maxMeas+maxTar,maxTar), problemSol(maxMeas+maxTar,maxTar) {
+        const size_t numCol=maxMeas+maxTar;
+        const size_t numDoubles=3*maxTar*numCol+maxTar*(maxMeas+1)+(maxMeas+1)*(xDim+xDim*xDim+1)+2*zDim+xDim*(xDim+3);
+        char *basePtr;
+
+        buffer=new char[numDoubles*sizeof(double)+numMeas*sizeof(ptrdiff_t)+(maxTar+2*numCol)*sizeof(size_t)];
+        basePtr=buffer;
+        logA=(double*)basePtr;
+        basePtr+=sizeof(double)*maxTar*numCol;
+        A=(double*)basePtr;
+        basePtr+=sizeof(double)*maxTar*numCol;
+        cost=(double*)basePtr;
+        basePtr+=sizeof(double)*maxTar*numCol;
+        beta=(double*)basePtr;
+        basePtr+=sizeof(double)*maxTar*(maxMeas+1);
+        hypMeans=(double*)basePtr;
+        basePtr+=sizeof(double)*(maxMeas+1)*xDim;
+        hypCovs=(double*)basePtr;
+        basePtr+=sizeof(double)*(maxMeas+1)*xDim*xDim;
+        hypW=(double*)basePtr;
+        basePtr+=sizeof(double)*(maxMeas+1);
+        nu=(double*)basePtr;
+        basePtr+=sizeof(double)*2*zDim;
+        xHard=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim;
+        mixScratch=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim*(xDim+2);
+        measLocal=(ptrdiff_t*)basePtr;
+        basePtr+=sizeof(ptrdiff_t)*numMeas;
+        permBuffer=(size_t*)basePtr;
+
+        fill_n(measLocal,numMeas,-1);
+    }
+
+    ~SingleScanScratch() {
+        delete[] buffer;
+    }
+private:
+    char *buffer;
+
+    //Copying is not allowed, because the buffer would be freed twice.
+    SingleScanScratch(const SingleScanScratch &);
+    SingleScanScratch &operator=(const SingleScanScratch &);
+};
+
+static void updateTarget(double *xUpd,double *PUpd,const size_t curTar,const double *w,const double wMiss,const ptrdiff_t hardIdx,const double *muHyp,const double *xPred,const double *PPred,const double *z,const SingleScanTrackInfo &info,const int measType,SingleScanScratch &scratch);
+
+bool singleScanUpdateCPP(double *xUpd,double *PUpd,double *logLikes,ptrdiff_t *tar2Meas,size_t *clustIdx,size_t *numClust,const double *xPred,const double *PPred,const double *PD,const bool PDIsScalar,const double *z,const size_t xDim,const size_t zDim,const size_t numTar,const size_t numMeas,const SingleScanParamCPP &param) {
+    const size_t xx=xDim*xDim;
+    const size_t zz=zDim*zDim;
+    const size_t xz=xDim*zDim;
+    const int algSel=param.algSel;
+    const int measType=param.measType;
+    SingleScanTrackInfo info(numTar,xDim,zDim);
+    bool *isValid=new bool[numTar];
+    size_t *parent, *measOwner, *clustTarOffset, *clustTars, *clustMeasOffset, *clustMeas;
+    size_t curTar, curMeas, curClust, maxTar, maxMeas;
+
+    //Step 1: The Kalman filter quantities of each target and the number
+    //of gated measurements.
+    #pragma omp parallel
+    {
+        double *H=new double[3*xz+zz+2*zDim];
+        double *PHT=H+xz;
+        double *WT=PHT+xz;
+        double *S=WT+xz;
+        double *nu=S+zz;
+        ptrdiff_t curTarP;
+
+        #pragma omp for schedule(dynamic)
+        for(curTarP=0;curTarP<(ptrdiff_t)numTar;curTarP++) {
+            const size_t t=(size_t)curTarP;
+            const double *xCur=xPred+t*xDim;
+            const double *PCur=PPred+t*xx;
+            double *zPredCur=info.zPred+t*zDim;
+            double *WCur=info.W+t*xz;
+            double *LCur=info.SChol+t*zz;
+            double *PPostCur=info.PPost+t*xx;
+            const double PDCur=PDIsScalar?PD[0]:PD[t];
+            double logDet=0;
+            size_t i, j, numGated=0;
+
+            measModelCPP(zPredCur,H,xCur,xDim,zDim,measType,param.measParam);
+
+            //PHT=P*H' and S=H*P*H'+R.
+            matMultABTransCPP(PHT,PCur,H,xDim,xDim,zDim);
+            matMultCPP(S,H,PHT,zDim,xDim,zDim);
+            for(i=0;i<zz;i++) {
+                S[i]+=param.R[i];
+            }
+            symmetrizeCPP(S,zDim);
+
+            isValid[t]=cholLowerCPP(LCur,S,zDim);
+            if(!isValid[t]) {
+                continue;
+            }
+
+            //W=PHT*inv(S), computed as the transpose of inv(S)*PHT'.
+            for(i=0;i<xDim;i++) {
+                for(j=0;j<zDim;j++) {
+                    WT[j+i*zDim]=PHT[i+j*xDim];
+                }
+            }
+            cholSolveCPP(WT,LCur,zDim,xDim);
+            for(i=0;i<xDim;i++) {
+                for(j=0;j<zDim;j++) {
+                    WCur[i+j*xDim]=WT[j+i*zDim];
+                }
+            }
+
+            //PPost=P-W*S*W'=P-W*PHT'.
+            matMultABTransCPP(PPostCur,WCur,PHT,xDim,zDim,xDim);
+            for(i=0;i<xx;i++) {
+                PPostCur[i]=PCur[i]-PPostCur[i];
+            }
+            symmetrizeCPP(PPostCur,xDim);
+
+            for(i=0;i<zDim;i++) {
+                logDet+=log(LCur[i+i*zDim]);
+            }
+            info.logNorm[t]=log(PDCur)-log(param.lambda)-logDet-0.5*(double)zDim*log(2*3.14159265358979323846);
+
+            for(i=0;i<numMeas;i++) {
+                double logLR;
+
+                if(info.gate(&logLR,nu,z+i*zDim,t,measType,param.gateThresh)) {
+                    numGated++;
+                }
+            }
+            info.gateOffset[t+1]=numGated;
+        }
+
+        delete[] H;
+    }
+
+    for(curTar=0;curTar<numTar;curTar++) {
+        if(!isValid[curTar]) {
+            delete[] isValid;
+            return false;
+        }
+    }
+    delete[] isValid;
+
+    info.gateOffset[0]=0;
+    for(curTar=0;curTar<numTar;curTar++) {
+        info.gateOffset[curTar+1]+=info.gateOffset[curTar];
+    }
+    info.allocGated(info.gateOffset[numTar]);
+
+    //Step 2: Record the gated measurements.
+    #pragma omp parallel
+    {
+        double *nu=new double[2*zDim];
+        ptrdiff_t curTarP;
+
+        #pragma omp for schedule(dynamic)
+        for(curTarP=0;curTarP<(ptrdiff_t)numTar;curTarP++) {
+            size_t i, idx=info.gateOffset[curTarP];
+
+            for(i=0;i<numMeas;i++) {
+                double logLR;
+
+                if(info.gate(&logLR,nu,z+i*zDim,(size_t)curTarP,measType,param.gateThresh)) {
+                    info.gatedMeas[idx]=i;
+                    info.gatedLogLR[idx]=logLR;
+                    idx++;
+                }
+            }
+        }
+
+        delete[] nu;
+    }
+
+    //Step 3: Cluster the targets. Targets are joined when they share a
+    //gated measurement. The root of each set is its lowest index.
+    parent=new size_t[numTar+numMeas];
+    measOwner=parent+numTar;
+    for(curTar=0;curTar<numTar;curTar++) {
+        parent[curTar]=curTar;
+    }
+    fill_n(measOwner,numMeas,numTar);
+
+    for(curTar=0;curTar<numTar;curTar++) {
+        size_t k;
+
+        for(k=info.gateOffset[curTar];k<info.gateOffset[curTar+1];k++) {
+            const size_t m=info.gatedMeas[k];
+
+            if(measOwner[m]==numTar) {
+                measOwner[m]=curTar;
+            } else {
+                const size_t r1=findRoot(parent,curTar);
+                const size_t r2=findRoot(parent,measOwner[m]);
+
+                if(r1<r2) {
+                    parent[r2]=r1;
+                } else {
+                    parent[r1]=r2;
+                }
+            }
+        }
+    }
+
+    //Number the clusters in the order of their lowest target index.
+    *numClust=0;
+    for(curTar=0;curTar<numTar;curTar++) {
+        const size_t root=findRoot(parent,curTar);
+
+        if(root==curTar) {
+            clustIdx[curTar]=(*numClust)++;
+        } else {
+            clustIdx[curTar]=clustIdx[root];
+        }
+    }
+
+    //List the targets and the measurements in each cluster.
+    clustTarOffset=new size_t[2*(*numClust+1)+numTar+numMeas];
+    clustMeasOffset=clustTarOffset+*numClust+1;
+    clustTars=clustMeasOffset+*numClust+1;
+    clustMeas=clustTars+numTar;
+    fill_n(clustTarOffset,2*(*numClust+1),0);
+    for(curTar=0;curTar<numTar;curTar++) {
+        clustTarOffset[clustIdx[curTar]+1]++;
+    }
+    for(curMeas=0;curMeas<numMeas;curMeas++) {
+        if(measOwner[curMeas]!=numTar) {
+            clustMeasOffset[clustIdx[measOwner[curMeas]]+1]++;
+        }
+    }
+
+    maxTar=0;
+    maxMeas=0;
+    for(curClust=0;curClust<*numClust;curClust++) {
+        maxTar=max(maxTar,clustTarOffset[curClust+1]);
+        maxMeas=max(maxMeas,clustMeasOffset[curClust+1]);
+        clustTarOffset[curClust+1]+=clustTarOffset[curClust];
+        clustMeasOffset[curClust+1]+=clustMeasOffset[curClust];
+    }
+
+    {
+        size_t *fillPos=parent;
+
+        copy(clustTarOffset,clustTarOffset+*numClust,fillPos);
+        for(curTar=0;curTar<numTar;curTar++) {
+            clustTars[fillPos[clustIdx[curTar]]++]=curTar;
+        }
+
+        copy(clustMeasOffset,clustMeasOffset+*numClust,fillPos);
+        for(curMeas=0;curMeas<numMeas;curMeas++) {
+            if(measOwner[curMeas]!=numTar) {
+                const size_t c=clustIdx[measOwner[curMeas]];
+
+                clustMeas[fillPos[c]++]=curMeas;
+            }
+        }
+    }
+    delete[] parent;
+
+    //The parallel PDAs and the naive nearest neighbor algorithm treat
+    //each target on its own.
+    if(algSel==3||algSel==4) {
+        maxTar=1;
+        maxMeas=0;
+        for(curTar=0;curTar<numTar;curTar++) {
+            maxMeas=max(maxMeas,info.gateOffset[curTar+1]-info.gateOffset[curTar]);
+        }
+    }
+
+    //Steps 4 and 5: Solve the clusters and update the targets.
+    #pragma omp parallel
+    {
+        SingleScanScratch scratch(numMeas,maxTar,maxMeas,xDim,zDim);
+        const ptrdiff_t numProb=(ptrdiff_t)((algSel==3||algSel==4)?numTar:*numClust);
+        ptrdiff_t curProb;
+
+        #pragma omp for schedule(dynamic)
+        for(curProb=0;curProb<numProb;curProb++) {
+            if(algSel==3||algSel==4) {
+                const size_t t=(size_t)curProb;
+                const size_t gStart=info.gateOffset[t];
+                const size_t numGated=info.gateOffset[t+1]-gStart;
+                const double logMiss=log(1-(PDIsScalar?PD[0]:PD[t]));
+                double maxLogLR=logMiss;
+                ptrdiff_t bestIdx=-1;
+                size_t k;
+
+                for(k=0;k<numGated;k++) {
+                    if(info.gatedLogLR[gStart+k]>maxLogLR) {
+                        maxLogLR=info.gatedLogLR[gStart+k];
+                        bestIdx=(ptrdiff_t)k;
+                    }
+                }
+
+                tar2Meas[t]=bestIdx<0?-1:(ptrdiff_t)info.gatedMeas[gStart+bestIdx];
+                if(algSel==4) {
+                    logLikes[t]=maxLogLR;
+                    updateTarget(xUpd+t*xDim,PUpd+t*xx,t,NULL,0,bestIdx,NULL,xPred,PPred,z,info,measType,scratch);
+                } else {
+                    double sumVal=exp(logMiss-maxLogLR);
+                    double wMiss, logLike;
+
+                    for(k=0;k<numGated;k++) {
+                        scratch.hypW[k]=exp(info.gatedLogLR[gStart+k]-maxLogLR);
+                        sumVal+=scratch.hypW[k];
+                    }
+
+                    wMiss=exp(logMiss-maxLogLR)/sumVal;
+                    logLike=wMiss*logMiss;
+                    for(k=0;k<numGated;k++) {
+                        scratch.hypW[k]/=sumVal;
+                        logLike+=scratch.hypW[k]*info.gatedLogLR[gStart+k];
+                    }
+                    logLikes[t]=logLike;
+
+                    updateTarget(xUpd+t*xDim,PUpd+t*xx,t,scratch.hypW,wMiss,-1,NULL,xPred,PPred,z,info,measType,scratch);
+                }
+                continue;
+            }
+
+            {
+                const size_t c=(size_t)curProb;
+                const size_t *tars=clustTars+clustTarOffset[c];
+                const size_t *meas=clustMeas+clustMeasOffset[c];
+                const size_t nT=clustTarOffset[c+1]-clustTarOffset[c];
+                const size_t nM=clustMeasOffset[c+1]-clustMeasOffset[c];
+                const size_t numCol=nM+nT;
+                const double negInf=-numeric_limits<double>::infinity();
+                const bool doGNN=algSel==0||algSel==2;
+                const bool doJPDA=algSel==0||algSel==1;
+                size_t i, j, k;
+
+                for(j=0;j<nM;j++) {
+                    scratch.measLocal[meas[j]]=(ptrdiff_t)j;
+                }
+
+                //The nTX(nM+nT) matrix of log-likelihood ratios with the
+                //missed detection hypotheses on the diagonal of the last
+                //nT columns.
+                fill_n(scratch.logA,nT*numCol,negInf);
+                for(i=0;i<nT;i++) {
+                    const size_t t=tars[i];
+
+                    for(k=info.gateOffset[t];k<info.gateOffset[t+1];k++) {
+                        scratch.logA[i+(size_t)scratch.measLocal[info.gatedMeas[k]]*nT]=info.gatedLogLR[k];
+                    }
+                    scratch.logA[i+(nM+i)*nT]=log(1-(PDIsScalar?PD[0]:PD[t]));
+                }
+
+                if(doGNN) {
+                    //The hypotheses are the rows and the targets the
+                    //columns, since assign2D needs at least as many rows as
+                    //columns.
+                    for(i=0;i<nT;i++) {
+                        for(j=0;j<numCol;j++) {
+                            scratch.cost[j+i*numCol]=-scratch.logA[i+j*nT];
+                        }
+                    }
+
+                    assign2D(numCol,nT,false,scratch.cost,scratch.workMem,&scratch.problemSol);
+                }
+
+                if(doJPDA) {
+                    size_t *rows2Keep=scratch.permBuffer;
+                    size_t *cols2Keep=rows2Keep+nT;
+                    size_t *permBuff=cols2Keep+numCol;
+
+                    for(i=0;i<nT;i++) {
+                        double maxVal=negInf;
+
+                        for(j=0;j<numCol;j++) {
+                            maxVal=max(maxVal,scratch.logA[i+j*nT]);
+                        }
+                        for(j=0;j<numCol;j++) {
+                            scratch.A[i+j*nT]=exp(scratch.logA[i+j*nT]-maxVal);
+                        }
+                    }
+
+                    for(i=0;i<nT;i++) {
+                        double sumVal=0;
+                        size_t r;
+
+                        for(r=0;r<nT-1;r++) {
+                            rows2Keep[r]=r<i?r:r+1;
+                        }
+
+                        for(j=0;j<=nM;j++) {
+                            //The column of the missed detection hypothesis of
+                            //target i.
+                            const size_t col=j<nM?j:nM+i;
+                            const double ati=scratch.A[i+col*nT];
+                            double val=0;
+
+                            if(ati>0) {
+                                for(r=0;r<numCol-1;r++) {
+                                    cols2Keep[r]=r<col?r:r+1;
+                                }
+                                val=ati*permCPPSkip(scratch.A,nT,rows2Keep,cols2Keep,nT-1,numCol-1,permBuff);
+                            }
+
+                            scratch.beta[i+j*nT]=val;
+                            sumVal+=val;
+                        }
+
+                        for(j=0;j<=nM;j++) {
+                            scratch.beta[i+j*nT]/=sumVal;
+                        }
+                    }
+                }
+
+                for(i=0;i<nT;i++) {
+                    const size_t t=tars[i];
+                    const size_t gStart=info.gateOffset[t];
+                    const size_t numGated=info.gateOffset[t+1]-gStart;
+                    const double logMiss=scratch.logA[i+(nM+i)*nT];
+                    ptrdiff_t hardIdx=-1;
+
+                    if(doGNN) {
+                        const size_t hyp=(size_t)scratch.problemSol.row4col[i];
+
+                        if(hyp<nM) {
+                            tar2Meas[t]=(ptrdiff_t)meas[hyp];
+                            logLikes[t]=scratch.logA[i+hyp*nT];
+                            for(k=0;k<numGated;k++) {
+                                if(info.gatedMeas[gStart+k]==meas[hyp]) {
+                                    hardIdx=(ptrdiff_t)k;
+                                    break;
+                                }
+                            }
+                        } else {
+                            tar2Meas[t]=-1;
+                            logLikes[t]=logMiss;
+                        }
+                    }
+
+                    if(!doJPDA) {
+                        updateTarget(xUpd+t*xDim,PUpd+t*xx,t,NULL,0,hardIdx,NULL,xPred,PPred,z,info,measType,scratch);
+                        continue;
+                    }
+
+                    {
+                        const double wMiss=scratch.beta[i+nM*nT];
+                        double logLike=wMiss>0?wMiss*logMiss:0;
+                        double maxBeta=wMiss;
+                        ptrdiff_t bestMeas=-1;
+
+                        for(k=0;k<numGated;k++) {
+                            const size_t m=info.gatedMeas[gStart+k];
+                            const double betaCur=scratch.beta[i+(size_t)scratch.measLocal[m]*nT];
+
+                            scratch.hypW[k]=betaCur;
+                            if(betaCur>0) {
+                                logLike+=betaCur*info.gatedLogLR[gStart+k];
+                            }
+
+                            if(betaCur>maxBeta) {
+                                maxBeta=betaCur;
+                                bestMeas=(ptrdiff_t)m;
+                            }
+                        }
+
+                        if(algSel==1) {
+                            tar2Meas[t]=bestMeas;
+                            logLikes[t]=logLike;
+                            updateTarget(xUpd+t*xDim,PUpd+t*xx,t,scratch.hypW,wMiss,-1,NULL,xPred,PPred,z,info,measType,scratch);
+                        } else {
+                            //The GNN-JPDA uses the GNN estimate with the
+                            //mean squared error matrix of the JPDA about
+                            //it.
+                            updateTarget(scratch.xHard,PUpd+t*xx,t,NULL,0,hardIdx,NULL,xPred,PPred,z,info,measType,scratch);
+                            updateTarget(xUpd+t*xDim,PUpd+t*xx,t,scratch.hypW,wMiss,-1,scratch.xHard,xPred,PPred,z,info,measType,scratch);
+                            copy(scratch.xHard,scratch.xHard+xDim,xUpd+t*xDim);
+                        }
+                    }
+                }
+
+                for(j=0;j<nM;j++) {
+                    scratch.measLocal[meas[j]]=-1;
+                }
+            }
+        }
+    }
+
+    delete[] clustTarOffset;
+    return true;
+}
+
+static void updateTarget(double *xUpd,double *PUpd,const size_t curTar,const double *w,const double wMiss,const ptrdiff_t hardIdx,const double *muHyp,const double *xPred,const double *PPred,const double *z,const SingleScanTrackInfo &info,const int measType,SingleScanScratch &scratch) {
+/*UPDATETARGET Update target curTar. If w is NULL, the target is updated
+ *             with the gated measurement hardIdx, or not at all if
+ *             hardIdx<0. Otherwise, the updated states with each gated
+ *             measurement and the missed detection hypothesis, which have
+ *             weights w and wMiss, are collapsed into one Gaussian. If
+ *             muHyp is not NULL, the covariance matrix is the mean squared
+ *             error matrix about muHyp.
+ */
+    const size_t xDim=info.xDim;
+    const size_t zDim=info.zDim;
+    const size_t xx=xDim*xDim;
+    const size_t gStart=info.gateOffset[curTar];
+    const size_t numGated=info.gateOffset[curTar+1]-gStart;
+    const double *xCur=xPred+curTar*xDim;
+    const double *PCur=PPred+curTar*xx;
+    const double *PPostCur=info.PPost+curTar*xx;
+    const double *WCur=info.W+curTar*xDim*zDim;
+    double logLR;
+    size_t k, i;
+
+    if(w==NULL) {
+        if(hardIdx<0) {
+            copy(xCur,xCur+xDim,xUpd);
+            copy(PCur,PCur+xx,PUpd);
+            return;
+        }
+
+        info.gate(&logLR,scratch.nu,z+info.gatedMeas[gStart+hardIdx]*zDim,curTar,measType,numeric_limits<double>::infinity());
+        matVecMultCPP(xUpd,WCur,scratch.nu,xDim,zDim);
+        for(i=0;i<xDim;i++) {
+            xUpd[i]+=xCur[i];
+        }
+        copy(PPostCur,PPostCur+xx,PUpd);
+        return;
+    }
+
+    for(k=0;k<numGated;k++) {
+        double *muK=scratch.hypMeans+k*xDim;
+
+        info.gate(&logLR,scratch.nu,z+info.gatedMeas[gStart+k]*zDim,curTar,measType,numeric_limits<double>::infinity());
+        matVecMultCPP(muK,WCur,scratch.nu,xDim,zDim);
+        for(i=0;i<xDim;i++) {
+            muK[i]+=xCur[i];
+        }
+        copy(PPostCur,PPostCur+xx,scratch.hypCovs+k*xx);
+    }
+    copy(xCur,xCur+xDim,scratch.hypMeans+numGated*xDim);
+    copy(PCur,PCur+xx,scratch.hypCovs+numGated*xx);
+    scratch.hypW[numGated]=wMiss;
+
+    mixtureMomentsCPP(xUpd,PUpd,scratch.hypW,scratch.hypMeans,scratch.hypCovs,muHyp,xDim,numGated+1,scratch.mixScratch);
+}
+
+static size_t findRoot(size_t *parent,size_t idx) {
+//Find the root of the set containing idx in a union-find structure,
+//halving the path along the way.
+    while(parent[idx]!=idx) {
+        parent[idx]=parent[parent[idx]];
+        idx=parent[idx];
+    }
+    return idx;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,93 @@
+/**SINGLESCANUPDATECPP A header file for the C++ implementation of the
+ *              measurement update of a single-scan tracking algorithm,
+ *              such as the global nearest neighbor (GNN) or the joint
+ *              probabilistic data association (JPDA) filter, for linear or
+ *              nonlinear measurement models with Gaussian noise. See the
+ *              file singleScanUpdateCPP.cpp for details.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef SINGLESCANUPDATECPP
+#define SINGLESCANUPDATECPP
+#include <stddef.h>
+//For infinity
+#include <limits>
+
+/**The SingleScanParamCPP class holds the parameters of the measurement
+ * update. The measurement model is given by measType and measParam as
+ * described in measModelCPP.cpp and R is the zDimXzDim measurement
+ * covariance matrix. lambda is the spatial density of clutter in the
+ * measurement space and gateThresh is the threshold on the normalized
+ * squared distance between a measurement and a track's predicted
+ * measurement above which the measurement is not considered for the track.
+ * algSel selects the algorithm with the same numbering as in the Matlab
+ * function singleScanUpdate: 0 GNN-JPDA, 1 JPDA, 2 GNN, 3 parallel
+ * single-target PDAs, and 4 naive nearest neighbor.
+ **/
+class SingleScanParamCPP {
+public:
+    int measType;
+    const double *measParam;
+    const double *R;
+    double lambda;
+    double gateThresh;
+    int algSel;
+
+    SingleScanParamCPP() : measType(0), measParam(NULL), R(NULL), lambda(1), gateThresh(std::numeric_limits<double>::infinity()), algSel(0) {}
+};
+
+bool singleScanUpdateCPP(double *xUpd,
+                         double *PUpd,
+                         double *logLikes,
+                         ptrdiff_t *tar2Meas,
+                         size_t *clustIdx,
+                         size_t *numClust,
+                         const double *xPred,
+                         const double *PPred,
+                         const double *PD,
+                         const bool PDIsScalar,
+                         const double *z,
+                         const size_t xDim,
+                         const size_t zDim,
+                         const size_t numTar,
+                         const size_t numMeas,
+                         const SingleScanParamCPP &param);
+/*SINGLESCANUPDATECPP Update the xDimXnumTar predicted states xPred and
+ *              xDimXxDimXnumTar covariance matrices PPred with the
+ *              zDimXnumMeas measurements in z, where the detection
+ *              probability of each target is PD (a scalar if PDIsScalar
+ *              is true, otherwise one per target, all between 0 and 1
+ *              exclusive). The updated states and covariance matrices are
+ *              put in xUpd and PUpd and the log-likelihood ratio of the
+ *              update of each target in logLikes. tar2Meas is set to the
+ *              index of the measurement assigned to each target (or with
+ *              the highest association probability), or -1 if the missed
+ *              detection hypothesis was chosen. clustIdx is set to the
+ *              index of the cluster of each target and numClust to the
+ *              number of clusters. The return value is false if an
+ *              innovation covariance matrix is not positive definite, in
+ *              which case the outputs are not valid. OpenMP is used
+ *              internally if it is available.
+ */
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -103,6 +103,13 @@ function [xEst,PEst,logLikes]=singleScanUpdate(xHyp,PHyp,A,algSel1,algSel2)
 %function for multiple hypothesis tracking," IEEE Transactions on Aerospace
 %and Electronic Systems, vol. 43, no. 1, pp. 392-400, Jan. 2007.
 %
+%When the targets have Gaussian measurement models of the types supported
+%by batchLSMultiTrackLM, the compiled function singleScanUpdateBatch
+%performs the Kalman filter updates, the gating, the formation of A and
+%the exact algorithms 0-4 for all targets at once, splitting the targets
+%into independent clusters. This avoids forming xHyp and PHyp for every
+%target-measurement pair.
+%
 %March 2015 David Crouse, generalizing the basic JPDAF code of David
 %Karnick, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
@@ -0,0 +1,286 @@
+/**SINGLESCANUPDATEBATCH Perform the complete measurement update step of a
+ *                   single-scan tracking algorithm, such as the global
+ *                   nearest neighbor (GNN) or the joint probabilistic data
+ *                   association (JPDA) filter, in compiled code. Unlike
+ *                   singleScanUpdate, which takes the states of the
+ *                   targets already updated with every measurement and the
+ *                   matrix of likelihood ratios, this function takes the
+ *                   predicted states and the measurements and does the
+ *                   Kalman filter updates, the gating, the clustering and
+ *                   the data association itself.
+ *
+ *INPUTS: xPred The xDimXnumTar predicted states of the targets.
+ *        PPred The xDimXxDimXnumTar predicted covariance matrices of the
+ *              targets.
+ *            z The zDimXnumMeas measurements. This can be an empty matrix
+ *              if there are no measurements.
+ *            R The zDimXzDim measurement covariance matrix, which is the
+ *              same for all measurements.
+ *     measType An integer specifying the measurement model. The possible
+ *              values are the same as in batchLSMultiTrackLM:
+ *              0 A linear measurement model, z=H*x.
+ *              1 A 2D polar measurement [range;azimuth] of the position
+ *                x(1:2) of the target.
+ *              2 A 3D spherical measurement [range;azimuth;elevation] of
+ *                the position x(1:3) of the target with the angles defined
+ *                as in Cart2Sphere with systemType=0.
+ *              3 The same as 2, except the angles are defined as in
+ *                Cart2Sphere with systemType=1.
+ *              For the nonlinear models, the update is that of the
+ *              extended Kalman filter and the azimuth of the innovation is
+ *              wrapped to [-pi,pi).
+ *    measParam For measType=0, this is the zDimXxDim measurement matrix
+ *              H. Otherwise, this is the 2X1 (measType=1) or 3X1 location
+ *              of the sensor.
+ *           PD The detection probability of the targets. This is either a
+ *              scalar or a numTarX1 vector. All values must be between 0
+ *              and 1 exclusive.
+ *       lambda The spatial density of the clutter (false alarms) in the
+ *              measurement space. This must be positive.
+ *   gateThresh The threshold on the normalized squared distance
+ *              nu'*inv(S)*nu of a measurement from the predicted
+ *              measurement of a target, where nu is the innovation and S
+ *              the innovation covariance matrix, above which the
+ *              measurement is not considered for the target. A value from
+ *              ChiSquareD.invCDF(PG,zDim) gives the gate probability PG.
+ *              If omitted or an empty matrix is passed, no gating is
+ *              performed.
+ *       algSel The algorithm to use. The numbering is the same as for
+ *              algSel1 in singleScanUpdate, but only the exact algorithms
+ *              are supported:
+ *              0) GNN-JPDA (the default if omitted or an empty matrix is
+ *                 passed)
+ *              1) JPDA
+ *              2) GNN
+ *              3) Parallel single-target PDAs
+ *              4) Naive nearest neighbor
+ *
+ *OUTPUTS: xUpd The xDimXnumTar updated states.
+ *         PUpd The xDimXxDimXnumTar updated covariance matrices.
+ *     logLikes The numTarX1 log-likelihood ratios of the updates as in
+ *              singleScanUpdate. The likelihood ratios are those of the
+ *              dimensionless score function, PD*N(z;zPred,S)/lambda for a
+ *              measurement and 1-PD for a missed detection.
+ *     tar2Meas A numTarX1 vector of the indices of the measurements
+ *              assigned to the targets, or of the measurements with the
+ *              highest association probabilities for the soft algorithms.
+ *              A 0 means that the missed detection hypothesis was chosen.
+ *     clustIdx A numTarX1 vector of the index of the cluster of each
+ *              target. Targets in different clusters do not share any
+ *              gated measurements, so their data association problems are
+ *              independent. The clusters are numbered in the order of
+ *              their first targets.
+ *
+ *The clusters are found with a union-find structure and the association
+ *probabilities of the JPDA are computed with matrix permanents as in
+ *calc2DAssignmentProbs, which takes a time that is exponential in the size
+ *of a cluster. Thus, the JPDA and GNN-JPDA should only be used with gates
+ *that keep the clusters small. See the comments in singleScanUpdateCPP.cpp
+ *for details. If the code is compiled with OpenMP support, then the loops
+ *over the targets and over the clusters are run in parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[xUpd,PUpd,logLikes,tar2Meas,clustIdx]=singleScanUpdateBatch(xPred,PPred,z,R,measType,measParam,PD,lambda,gateThresh,algSel);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "MexValidation.h"
+#include "singleScanUpdateCPP.hpp"
+#include "mex.h"
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t xDim, zDim, numTar, numMeas, numClust, i;
+    bool PDIsScalar;
+    const double *xPred, *PPred, *z, *PD;
+    double *xUpd, *PUpd, *logLikes, *tar2MeasOut, *clustIdxOut;
+    ptrdiff_t *tar2Meas;
+    size_t *clustIdx;
+    mxArray *xUpdMATLAB, *PUpdMATLAB, *logLikesMATLAB, *tar2MeasMATLAB, *clustIdxMATLAB;
+    SingleScanParamCPP param;
+    mwSize dims[3];
+
+    if(nrhs<8) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>10) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>5) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    checkRealDoubleArray(prhs[0]);
+    checkRealDoubleHypermatrix(prhs[1]);
+    xDim=mxGetM(prhs[0]);
+    numTar=mxGetN(prhs[0]);
+    {
+        const mwSize numDims=mxGetNumberOfDimensions(prhs[1]);
+        const mwSize *PDims=mxGetDimensions(prhs[1]);
+
+        if(numDims>3||PDims[0]!=xDim||PDims[1]!=xDim||(numDims==3?PDims[2]:1)!=numTar) {
+            mexErrMsgTxt("The dimensions of PPred are inconsistent with xPred.");
+        }
+    }
+    xPred=(double*)mxGetData(prhs[0]);
+    PPred=(double*)mxGetData(prhs[1]);
+
+    checkRealDoubleArray(prhs[3]);
+    zDim=mxGetM(prhs[3]);
+    if(mxGetN(prhs[3])!=zDim) {
+        mexErrMsgTxt("R must be a square matrix.");
+    }
+    param.R=(double*)mxGetData(prhs[3]);
+
+    if(!mxIsEmpty(prhs[2])) {
+        checkRealDoubleArray(prhs[2]);
+        if(mxGetM(prhs[2])!=zDim) {
+            mexErrMsgTxt("The dimensions of z are inconsistent with R.");
+        }
+        numMeas=mxGetN(prhs[2]);
+        z=(double*)mxGetData(prhs[2]);
+    } else {
+        numMeas=0;
+        z=NULL;
+    }
+
+    param.measType=getIntFromMatlab(prhs[4]);
+    checkRealDoubleArray(prhs[5]);
+    switch(param.measType) {
+        case 0:
+            if(mxGetM(prhs[5])!=zDim||mxGetN(prhs[5])!=xDim) {
+                mexErrMsgTxt("The measurement matrix has the wrong dimensionality.");
+            }
+            break;
+        case 1:
+        case 2:
+        case 3:
+        {
+            const size_t posDim=param.measType==1?2:3;
+
+            if(mxGetNumberOfElements(prhs[5])!=posDim) {
+                mexErrMsgTxt("The sensor location has the wrong dimensionality.");
+            }
+
+            if(zDim!=posDim||xDim<posDim) {
+                mexErrMsgTxt("The dimensions of the state or R are inconsistent with the measurement type.");
+            }
+            break;
+        }
+        default:
+            mexErrMsgTxt("Unknown measurement type specified.");
+    }
+    param.measParam=(double*)mxGetData(prhs[5]);
+
+    checkRealDoubleArray(prhs[6]);
+    PDIsScalar=mxGetNumberOfElements(prhs[6])==1;
+    if(!PDIsScalar&&mxGetNumberOfElements(prhs[6])!=numTar) {
+        mexErrMsgTxt("PD has the wrong dimensionality.");
+    }
+    PD=(double*)mxGetData(prhs[6]);
+    for(i=0;i<mxGetNumberOfElements(prhs[6]);i++) {
+        if(!(PD[i]>0&&PD[i]<1)) {
+            mexErrMsgTxt("PD must be between 0 and 1 exclusive.");
+        }
+    }
+
+    param.lambda=getDoubleFromMatlab(prhs[7]);
+    if(!(param.lambda>0)) {
+        mexErrMsgTxt("lambda must be positive.");
+    }
+
+    if(nrhs>8&&!mxIsEmpty(prhs[8])) {
+        param.gateThresh=getDoubleFromMatlab(prhs[8]);
+    }
+
+    if(nrhs>9&&!mxIsEmpty(prhs[9])) {
+        param.algSel=getIntFromMatlab(prhs[9]);
+        if(param.algSel<0||param.algSel>4) {
+            mexErrMsgTxt("Unsupported algorithm selected.");
+        }
+    }
+
+    xUpdMATLAB=mxCreateDoubleMatrix(xDim,numTar,mxREAL);
+    xUpd=(double*)mxGetData(xUpdMATLAB);
+    dims[0]=xDim;
+    dims[1]=xDim;
+    dims[2]=numTar;
+    PUpdMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+    PUpd=(double*)mxGetData(PUpdMATLAB);
+    logLikesMATLAB=mxCreateDoubleMatrix(numTar,1,mxREAL);
+    logLikes=(double*)mxGetData(logLikesMATLAB);
+
+    tar2Meas=new ptrdiff_t[numTar];
+    clustIdx=new size_t[numTar];
+    if(!singleScanUpdateCPP(xUpd,PUpd,logLikes,tar2Meas,clustIdx,&numClust,xPred,PPred,PD,PDIsScalar,z,xDim,zDim,numTar,numMeas,param)) {
+        delete[] clustIdx;
+        delete[] tar2Meas;
+        mxDestroyArray(logLikesMATLAB);
+        mxDestroyArray(PUpdMATLAB);
+        mxDestroyArray(xUpdMATLAB);
+        mexErrMsgTxt("An innovation covariance matrix is not positive definite.");
+    }
+
+    tar2MeasMATLAB=mxCreateDoubleMatrix(numTar,1,mxREAL);
+    tar2MeasOut=(double*)mxGetData(tar2MeasMATLAB);
+    clustIdxMATLAB=mxCreateDoubleMatrix(numTar,1,mxREAL);
+    clustIdxOut=(double*)mxGetData(clustIdxMATLAB);
+    //Convert to Matlab's indexation.
+    for(i=0;i<numTar;i++) {
+        tar2MeasOut[i]=(double)(tar2Meas[i]+1);
+        clustIdxOut[i]=(double)(clustIdx[i]+1);
+    }
+    delete[] clustIdx;
+    delete[] tar2Meas;
+
+    plhs[0]=xUpdMATLAB;
+    switch(nlhs) {
+        case 5:
+            plhs[4]=clustIdxMATLAB;
+        case 4:
+            plhs[3]=tar2MeasMATLAB;
+        case 3:
+            plhs[2]=logLikesMATLAB;
+        case 2:
+            plhs[1]=PUpdMATLAB;
+        default:
+            break;
+    }
+
+    if(nlhs<5) {
+        mxDestroyArray(clustIdxMATLAB);
+    }
+    if(nlhs<4) {
+        mxDestroyArray(tar2MeasMATLAB);
+    }
+    if(nlhs<3) {
+        mxDestroyArray(logLikesMATLAB);
+    }
+    if(nlhs<2) {
+        mxDestroyArray(PUpdMATLAB);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
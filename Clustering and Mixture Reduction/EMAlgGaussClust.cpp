@@ -0,0 +1,172 @@
+/**EMALGGAUSSCLUST Use the expectation maximization (EM) algorithm to
+ *                 refine estimates of the components of a Gaussian mixture
+ *                 with a known number of terms given a set of samples.
+ *                 This is a compiled version of the Matlab function
+ *                 EMAlgGaussClust that can also handle weighted samples.
+ *
+ *INPUTS: z A zDimXnumPoints set of samples of the Gaussian mixture.
+ *        w A KX1 set of initial weight estimates of the K Gaussians in the
+ *          mixture.
+ *       mu A zDimXK set of initial mean estimates of the component
+ *          Gaussians in the mixture.
+ *        P A zDimXzDimXK hypermatrix of initial covariance matrix
+ *          estimates of the components of the Gaussians in the mixture.
+ *  numIter The number of iterations of the EM algorithm to perform.
+ * pointWeights An optional numPointsX1 vector of nonnegative weights of
+ *          the samples. A sample with weight 2 is treated the same as two
+ *          samples at the same location. If omitted or an empty matrix is
+ *          passed, all samples have weight 1.
+ *
+ *OUTPUTS: w The refined weights.
+ *        mu The refined means.
+ *         P The refined covariance matrix estimates.
+ *   logLike The weighted log-likelihood of the samples under the mixture
+ *           that was used in the last iteration (before the refinement in
+ *           that iteration). This is zero if numIter=0.
+ *
+ *The iterations are the same as in the Matlab implementation. The
+ *posterior probabilities of the components are computed in the
+ *logarithmic domain and the covariance matrices are computed from the
+ *differences from the updated means, which avoids numerical problems. See
+ *the comments in EMGaussClustCPP.cpp for details. If the code is compiled
+ *with OpenMP support, then the loops over the samples are run in
+ *parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[w,mu,P,logLike]=EMAlgGaussClust(z,w,mu,P,numIter,pointWeights);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy
+#include <algorithm>
+#include "MexValidation.h"
+#include "clusterFuncs.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t zDim, numPoints, K, numIter, i;
+    const double *z, *pointWeights=NULL;
+    double *w, *mu, *P, logLike;
+    mxArray *wMATLAB, *muMATLAB, *PMATLAB;
+    mwSize dims[3];
+
+    if(nrhs<5) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>6) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>4) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    checkRealDoubleArray(prhs[0]);
+    checkRealDoubleArray(prhs[1]);
+    checkRealDoubleArray(prhs[2]);
+    checkRealDoubleHypermatrix(prhs[3]);
+    zDim=mxGetM(prhs[0]);
+    numPoints=mxGetN(prhs[0]);
+    K=mxGetNumberOfElements(prhs[1]);
+    z=(double*)mxGetData(prhs[0]);
+
+    if(zDim==0||numPoints==0||K==0) {
+        mexErrMsgTxt("The inputs cannot be empty.");
+    }
+
+    if(mxGetM(prhs[2])!=zDim||mxGetN(prhs[2])!=K) {
+        mexErrMsgTxt("mu has the wrong dimensionality.");
+    }
+
+    {
+        const mwSize numDims=mxGetNumberOfDimensions(prhs[3]);
+        const mwSize *PDims=mxGetDimensions(prhs[3]);
+
+        if(PDims[0]!=zDim||PDims[1]!=zDim||(numDims==3?PDims[2]:1)!=K) {
+            mexErrMsgTxt("P has the wrong dimensionality.");
+        }
+    }
+
+    numIter=getSizeTFromMatlab(prhs[4]);
+
+    if(nrhs>5&&!mxIsEmpty(prhs[5])) {
+        checkRealDoubleArray(prhs[5]);
+        if(mxGetNumberOfElements(prhs[5])!=numPoints) {
+            mexErrMsgTxt("pointWeights has the wrong dimensionality.");
+        }
+        pointWeights=(double*)mxGetData(prhs[5]);
+
+        for(i=0;i<numPoints;i++) {
+            if(!(pointWeights[i]>=0)) {
+                mexErrMsgTxt("The point weights must be nonnegative.");
+            }
+        }
+    }
+
+    //The outputs are initialized with the initial estimates and are
+    //updated in place.
+    wMATLAB=mxCreateDoubleMatrix(K,1,mxREAL);
+    w=(double*)mxGetData(wMATLAB);
+    copy((double*)mxGetData(prhs[1]),(double*)mxGetData(prhs[1])+K,w);
+    muMATLAB=mxCreateDoubleMatrix(zDim,K,mxREAL);
+    mu=(double*)mxGetData(muMATLAB);
+    copy((double*)mxGetData(prhs[2]),(double*)mxGetData(prhs[2])+zDim*K,mu);
+    dims[0]=zDim;
+    dims[1]=zDim;
+    dims[2]=K;
+    PMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+    P=(double*)mxGetData(PMATLAB);
+    copy((double*)mxGetData(prhs[3]),(double*)mxGetData(prhs[3])+zDim*zDim*K,P);
+
+    if(!EMGaussClustCPP(w,mu,P,&logLike,z,pointWeights,zDim,numPoints,K,numIter)) {
+        mxDestroyArray(PMATLAB);
+        mxDestroyArray(muMATLAB);
+        mxDestroyArray(wMATLAB);
+        mexErrMsgTxt("A covariance matrix stopped being positive definite or a component lost all of its weight.");
+    }
+
+    plhs[0]=wMATLAB;
+    switch(nlhs) {
+        case 4:
+            plhs[3]=mxCreateDoubleScalar(logLike);
+        case 3:
+            plhs[2]=PMATLAB;
+        case 2:
+            plhs[1]=muMATLAB;
+        default:
+            break;
+    }
+
+    if(nlhs<3) {
+        mxDestroyArray(PMATLAB);
+    }
+    if(nlhs<2) {
+        mxDestroyArray(muMATLAB);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
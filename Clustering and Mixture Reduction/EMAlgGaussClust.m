@@ -1,4 +1,4 @@
-function [w,mu,P]=EMAlgGaussClust(z,w,mu,P,numIter)
+function [w,mu,P,logLike]=EMAlgGaussClust(z,w,mu,P,numIter,pointWeights)
 %%EMALGGAUSSCLUST  Use the expectation maximization (EM) algorithm to
 %                  refine estimates of the components of a Gaussian mixture
 %                  with a known number of terms given a set of samples.
@@ -12,15 +12,29 @@ function [w,mu,P]=EMAlgGaussClust(z,w,mu,P,numIter)
 %               estimates of the components of the Gaussians in the
 %               mixture.
 %       numIter The number of iterations of the EM algorithm to perform.
+%  pointWeights An optional numPointsX1 vector of nonnegative weights of
+%               the samples. A sample with weight 2 is treated the same as
+%               two samples at the same location. If omitted, all samples
+%               have weight 1.
 %
 %OUTPUTS: w     The refined weights.
 %         mu    The refined means.
 %         P     The refined covariance matrix estimates.
+%       logLike The weighted log-likelihood of the samples under the
+%               mixture that was used in the last iteration (before the
+%               refinement in that iteration). This is zero if numIter=0.
 %
 %The EM algorithm for Gaussian mixtures is an implementation of the
 %algorithm described in Chapter 9.2.2 of
 %C. M. Bishop, Pattern Recognition and Machine Learning. Cambridge,
 %United Kingdom: Springer, 2007.
+%With weighted samples, the posterior weights of each sample are
+%multiplied by the weight of the sample.
+%
+%A compiled version of this function can be built using the
+%CompileCLibraries function. It processes the samples in parallel and
+%computes the posterior weights in the logarithmic domain, which avoids
+%problems with samples that are far from all of the components.
 %
 %October 2013 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
@@ -28,21 +42,32 @@ function [w,mu,P]=EMAlgGaussClust(z,w,mu,P,numIter)
     %zDim=size(z,1);
     numPoints=size(z,2);
     K=size(mu,2);
+    
+    if(nargin<6||isempty(pointWeights))
+        pointWeights=ones(numPoints,1);
+    end
+    pointWeights=pointWeights(:);
+    totalWeight=sum(pointWeights);
 
     gamma=zeros(numPoints,K);
+    logLike=0;
     for curIter=1:numIter
         %Calculate the posterior weights.
         for k=1:K
             gamma(:,k)=GaussianPDF(z,mu(:,k),P(:,:,k))*w(k);
         end
+        %The likelihood of each measurement under the current mixture.
+        pointLike=sum(gamma,2);
+        logLike=sum(pointWeights.*log(pointLike));
         %Normalize the weights for each measurement.
-        gamma=bsxfun(@rdivide,gamma,sum(gamma,2));
+        gamma=bsxfun(@rdivide,gamma,pointLike);
+        gamma=bsxfun(@times,gamma,pointWeights);
 
         %Update the means, covariances and weights using the posterior
         %weights.
         for k=1:K
             Nk=sum(gamma(:,k));
-            w(k)=Nk/numPoints;
+            w(k)=Nk/totalWeight;
             
             [mu(:,k), P(:,:,k)]=calcMixtureMoments(z,gamma(:,k)/Nk);
         end
@@ -22,6 +22,10 @@ function [w,mu,P]=RunnalsGaussMixRed(w,mu,P,K)
 %Note that a real efficient C/C++ implementation would be implemented using
 %various data structures to avoid the cost deletion and inseration of
 %matrix elements that is used in the reduction algorithm.
+%The compiled function RunnalsGaussMixRedBatch is such an implementation.
+%It keeps the cheapest merge for each component in an indexed heap, can
+%restrict the merges considered to nearest neighbors and can reduce many
+%mixtures in parallel.
 %
 %October 2013 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
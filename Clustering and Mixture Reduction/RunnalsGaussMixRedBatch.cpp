@@ -0,0 +1,252 @@
+/**RUNNALSGAUSSMIXREDBATCH Reduce many Gaussian mixtures using the greedy
+ *                   merging algorithm of Runnalls. This is a compiled
+ *                   alternative to calling RunnalsGaussMixRed in a loop,
+ *                   for example when reducing the mixtures of many
+ *                   Gaussian mixture filters after each scan.
+ *
+ *INPUTS: w A NTotalX1 vector of the weights of the components of all of
+ *          the mixtures, one mixture after another.
+ *       mu An xDimXNTotal matrix of the means of the components.
+ *        P An xDimXxDimXNTotal hypermatrix of the covariance matrices of
+ *          the components.
+ *  numComp A numMixX1 vector holding the number of components in each
+ *          mixture. The first numComp(1) components belong to the first
+ *          mixture, the next numComp(2) to the second, etc. The sum of
+ *          the elements must be NTotal. If omitted or an empty matrix is
+ *          passed, all components are taken to be in one mixture.
+ *        K The number of components desired in each mixture after
+ *          reduction. This is either a scalar, if the same number is
+ *          desired for all mixtures, or a numMixX1 vector.
+ * numNeighbors If this is zero, all pairs of components are considered
+ *          for merging, as in RunnalsGaussMixRed. If this is positive,
+ *          then only pairs of components whose means are among each
+ *          others' numNeighbors nearest neighbors, found using a kd-tree,
+ *          are considered; when two components are merged, the merged
+ *          component takes the neighbors of both. This speeds up the
+ *          reduction of large mixtures, but the result can differ from
+ *          that of the exhaustive algorithm and more than K components can
+ *          remain if no candidate pairs are left. The Euclidean distance
+ *          is used, so the state should be scaled so that all dimensions
+ *          are comparable. If omitted or an empty matrix is passed, the
+ *          default of 0 is used.
+ *
+ *OUTPUTS: w The NRedTotalX1 weights of all of the reduced mixtures, one
+ *           mixture after another.
+ *        mu The xDimXNRedTotal means of the reduced mixtures.
+ *         P The xDimXxDimXNRedTotal covariance matrices of the reduced
+ *           mixtures.
+ *   numCompRed A numMixX1 vector of the number of components in each
+ *           reduced mixture.
+ *
+ *Rather than recomputing the merge costs of all pairs of components after
+ *every merge, the cheapest partner of each component is kept in an indexed
+ *binary heap and only the costs involving the merged component are
+ *updated. See the comments in RunnalsGaussMixRedCPP.cpp for details. With
+ *numNeighbors=0, the same pairs are merged as in RunnalsGaussMixRed,
+ *barring ties in the costs, but the components of the reduced mixture are
+ *in a different order. Here, the surviving components stay in their
+ *original order and each merged component takes the place of the first of
+ *the two components merged. If the code is compiled with OpenMP support,
+ *then the loop over the mixtures is run in parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[w,mu,P,numCompRed]=RunnalsGaussMixRedBatch(w,mu,P,numComp,K,numNeighbors);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy
+#include <algorithm>
+#include "MexValidation.h"
+#include "clusterFuncs.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t xDim, NTotal, numMix, numK, numNeighbors=0;
+    size_t i, NRedTotal;
+    size_t *numComp, *K, *offsets, *numCompRed;
+    const double *w, *mu, *P;
+    double *wTemp, *muTemp, *PTemp;
+    double *wRed, *muRed, *PRed, *numCompRedOut;
+    mxArray *wMATLAB, *muMATLAB, *PMATLAB, *numCompRedMATLAB;
+    mwSize dims[3];
+
+    if(nrhs<5) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>6) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>4) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    checkRealDoubleArray(prhs[0]);
+    checkRealDoubleArray(prhs[1]);
+    checkRealDoubleHypermatrix(prhs[2]);
+    NTotal=mxGetNumberOfElements(prhs[0]);
+    xDim=mxGetM(prhs[1]);
+    if(NTotal==0||xDim==0) {
+        mexErrMsgTxt("The mixture cannot be empty.");
+    }
+
+    if(mxGetN(prhs[1])!=NTotal) {
+        mexErrMsgTxt("The dimensions of mu are inconsistent with w.");
+    }
+
+    {
+        const mwSize numDims=mxGetNumberOfDimensions(prhs[2]);
+        const mwSize *PDims=mxGetDimensions(prhs[2]);
+
+        if(PDims[0]!=xDim||PDims[1]!=xDim||(numDims==3?PDims[2]:1)!=NTotal) {
+            mexErrMsgTxt("The dimensions of P are inconsistent with mu.");
+        }
+    }
+
+    w=(double*)mxGetData(prhs[0]);
+    mu=(double*)mxGetData(prhs[1]);
+    P=(double*)mxGetData(prhs[2]);
+
+    if(!mxIsEmpty(prhs[3])) {
+        size_t sumComp=0;
+
+        numComp=copySizeTArrayFromMatlab(prhs[3],&numMix);
+        for(i=0;i<numMix;i++) {
+            sumComp+=numComp[i];
+        }
+
+        if(sumComp!=NTotal) {
+            mxFree(numComp);
+            mexErrMsgTxt("The number of components in the mixtures does not sum to the length of w.");
+        }
+    } else {
+        numMix=1;
+        numComp=(size_t*)mxMalloc(sizeof(size_t));
+        numComp[0]=NTotal;
+    }
+
+    K=copySizeTArrayFromMatlab(prhs[4],&numK);
+    if(numK!=1&&numK!=numMix) {
+        mxFree(K);
+        mxFree(numComp);
+        mexErrMsgTxt("K has the wrong dimensionality.");
+    }
+
+    if(nrhs>5&&!mxIsEmpty(prhs[5])) {
+        numNeighbors=getSizeTFromMatlab(prhs[5]);
+    }
+
+    offsets=new size_t[numMix];
+    numCompRed=new size_t[numMix];
+    offsets[0]=0;
+    for(i=1;i<numMix;i++) {
+        offsets[i]=offsets[i-1]+numComp[i-1];
+    }
+
+    //The reduced mixtures are first put into the space of the original
+    //mixtures, since the number of components that remain is not known
+    //in advance when neighbor lists are used.
+    wTemp=new double[NTotal];
+    muTemp=new double[xDim*NTotal];
+    PTemp=new double[xDim*xDim*NTotal];
+
+    //The mixtures are independent, so they are reduced in parallel if
+    //OpenMP is available.
+    {
+        ptrdiff_t curMix;
+
+        #pragma omp parallel for schedule(dynamic)
+        for(curMix=0;curMix<(ptrdiff_t)numMix;curMix++) {
+            const size_t offset=offsets[curMix];
+            const size_t KCur=numK==1?K[0]:K[curMix];
+
+            numCompRed[curMix]=RunnalsGaussMixRedCPP(wTemp+offset,muTemp+xDim*offset,PTemp+xDim*xDim*offset,w+offset,mu+xDim*offset,P+xDim*xDim*offset,xDim,numComp[curMix],KCur,numNeighbors);
+        }
+    }
+
+    NRedTotal=0;
+    for(i=0;i<numMix;i++) {
+        NRedTotal+=numCompRed[i];
+    }
+
+    wMATLAB=mxCreateDoubleMatrix(NRedTotal,1,mxREAL);
+    wRed=(double*)mxGetData(wMATLAB);
+    muMATLAB=mxCreateDoubleMatrix(xDim,NRedTotal,mxREAL);
+    muRed=(double*)mxGetData(muMATLAB);
+    dims[0]=xDim;
+    dims[1]=xDim;
+    dims[2]=NRedTotal;
+    PMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+    PRed=(double*)mxGetData(PMATLAB);
+    numCompRedMATLAB=mxCreateDoubleMatrix(numMix,1,mxREAL);
+    numCompRedOut=(double*)mxGetData(numCompRedMATLAB);
+
+    for(i=0;i<numMix;i++) {
+        const size_t offset=offsets[i];
+        const size_t numCur=numCompRed[i];
+
+        copy(wTemp+offset,wTemp+offset+numCur,wRed);
+        copy(muTemp+xDim*offset,muTemp+xDim*(offset+numCur),muRed);
+        copy(PTemp+xDim*xDim*offset,PTemp+xDim*xDim*(offset+numCur),PRed);
+        wRed+=numCur;
+        muRed+=xDim*numCur;
+        PRed+=xDim*xDim*numCur;
+        numCompRedOut[i]=(double)numCur;
+    }
+
+    delete[] PTemp;
+    delete[] muTemp;
+    delete[] wTemp;
+    delete[] numCompRed;
+    delete[] offsets;
+    mxFree(K);
+    mxFree(numComp);
+
+    plhs[0]=wMATLAB;
+    switch(nlhs) {
+        case 4:
+            plhs[3]=numCompRedMATLAB;
+        case 3:
+            plhs[2]=PMATLAB;
+        case 2:
+            plhs[1]=muMATLAB;
+        default:
+            break;
+    }
+
+    if(nlhs<4) {
+        mxDestroyArray(numCompRedMATLAB);
+    }
+    if(nlhs<3) {
+        mxDestroyArray(PMATLAB);
+    }
+    if(nlhs<2) {
+        mxDestroyArray(muMATLAB);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,250 @@
+/**EMGAUSSCLUSTCPP A C++ implementation of the expectation maximization
+ *            (EM) algorithm for fitting a Gaussian mixture with a known
+ *            number of components to weighted samples. This is used by
+ *            the compiled version of EMAlgGaussClust and performs the
+ *            same iterations, which are described in Chapter 9.2.2 of
+ *C. M. Bishop, Pattern Recognition and Machine Learning. Cambridge,
+ *United Kingdom: Springer, 2007.
+ *
+ *With weighted samples, the posterior probability that a sample came from
+ *each component is multiplied by the weight of the sample before the
+ *means, covariance matrices and weights are updated. The posterior
+ *probabilities are computed in the logarithmic domain using a Cholesky
+ *decomposition of each covariance matrix, so that samples that are far
+ *from all of the components do not produce a division of zero by zero,
+ *as can happen in EMAlgGaussClust. The covariance matrices are computed
+ *from the differences from the updated means in a second pass over the
+ *samples rather than from the second moments, which avoids a loss of
+ *precision.
+ *
+ *The loops over the samples in the expectation and maximization steps are
+ *parallelized using OpenMP if it is available. The sums are accumulated
+ *over fixed blocks of samples and then added in order, so that the
+ *results do not depend on the number of threads.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For log, exp
+#include <cmath>
+//For fill_n and copy
+#include <algorithm>
+#include <vector>
+#include <limits>
+#include "clusterFuncs.hpp"
+#include "matrixFuncs.hpp"
+
+using namespace std;
+
+//The number of samples in each block used for summation.
+static const size_t sampleBlockSize=1024;
+
+bool EMGaussClustCPP(double *w,double *mu,double *P,double *logLike,const double *z,const double *weights,const size_t zDim,const size_t numPoints,const size_t K,const size_t numIter) {
+    const double log2Pi=log(2*3.14159265358979323846);
+    const size_t numBlocks=(numPoints+sampleBlockSize-1)/sampleBlockSize;
+    //The posterior probabilities times the sample weights, stored by
+    //sample.
+    vector<double> gamma(numPoints*K);
+    //The lower-triangular Cholesky decompositions of the covariance
+    //matrices and the logarithms of the normalizing constants of the
+    //weighted component PDFs.
+    vector<double> L(K*zDim*zDim);
+    vector<double> logNormConst(K);
+    vector<double> Nk(K);
+    vector<double> blockSums(numBlocks*K*zDim*zDim);
+    vector<double> blockWeights(numBlocks*K);
+    vector<double> blockLogLike(numBlocks);
+    double totalWeight=0;
+    size_t curIter, i, k;
+
+    if(weights==NULL) {
+        totalWeight=(double)numPoints;
+    } else {
+        for(i=0;i<numPoints;i++) {
+            totalWeight+=weights[i];
+        }
+    }
+
+    *logLike=0;
+    for(curIter=0;curIter<numIter;curIter++) {
+        size_t l, m, curBlockIdx;
+
+        for(k=0;k<K;k++) {
+            double *LCur=&L[k*zDim*zDim];
+            double logDet=0;
+
+            if(!cholLowerCPP(LCur,P+k*zDim*zDim,zDim)) {
+                return false;
+            }
+
+            for(l=0;l<zDim;l++) {
+                logDet+=log(LCur[l+l*zDim]);
+            }
+            logNormConst[k]=log(w[k])-logDet-0.5*zDim*log2Pi;
+        }
+
+        //The expectation step. The means are summed in the first zDim
+        //elements of each block's sums.
+        #pragma omp parallel
+        {
+            vector<double> diff(zDim);
+            vector<double> logProb(K);
+            ptrdiff_t curBlock;
+
+            #pragma omp for
+            for(curBlock=0;curBlock<(ptrdiff_t)numBlocks;curBlock++) {
+                const size_t startIdx=curBlock*sampleBlockSize;
+                const size_t endIdx=min(numPoints,startIdx+sampleBlockSize);
+                double *curSums=&blockSums[curBlock*K*zDim*zDim];
+                double *curWeights=&blockWeights[curBlock*K];
+                double curLogLike=0;
+                size_t idx, c, d;
+
+                fill_n(curSums,K*zDim*zDim,0.0);
+                fill_n(curWeights,K,0.0);
+                for(idx=startIdx;idx<endIdx;idx++) {
+                    const double *point=z+idx*zDim;
+                    const double wCur=weights==NULL?1.0:weights[idx];
+                    double *gammaCur=&gamma[idx*K];
+                    double maxLogProb=-numeric_limits<double>::infinity();
+                    double sumProb=0;
+
+                    for(c=0;c<K;c++) {
+                        double distVal=0;
+
+                        for(d=0;d<zDim;d++) {
+                            diff[d]=point[d]-mu[d+c*zDim];
+                        }
+                        forwardSubstCPP(&diff[0],&L[c*zDim*zDim],zDim,1);
+                        for(d=0;d<zDim;d++) {
+                            distVal+=diff[d]*diff[d];
+                        }
+
+                        logProb[c]=logNormConst[c]-0.5*distVal;
+                        maxLogProb=max(maxLogProb,logProb[c]);
+                    }
+
+                    for(c=0;c<K;c++) {
+                        gammaCur[c]=exp(logProb[c]-maxLogProb);
+                        sumProb+=gammaCur[c];
+                    }
+                    curLogLike+=wCur*(maxLogProb+log(sumProb));
+
+                    for(c=0;c<K;c++) {
+                        gammaCur[c]*=wCur/sumProb;
+                        curWeights[c]+=gammaCur[c];
+                        for(d=0;d<zDim;d++) {
+                            curSums[d+c*zDim*zDim]+=gammaCur[c]*point[d];
+                        }
+                    }
+                }
+                blockLogLike[curBlock]=curLogLike;
+            }
+        }
+
+        *logLike=0;
+        for(curBlockIdx=0;curBlockIdx<numBlocks;curBlockIdx++) {
+            *logLike+=blockLogLike[curBlockIdx];
+        }
+
+        //The maximization step for the weights and the means.
+        for(k=0;k<K;k++) {
+            Nk[k]=0;
+            fill_n(mu+k*zDim,zDim,0.0);
+            for(curBlockIdx=0;curBlockIdx<numBlocks;curBlockIdx++) {
+                Nk[k]+=blockWeights[k+curBlockIdx*K];
+                for(l=0;l<zDim;l++) {
+                    mu[l+k*zDim]+=blockSums[l+k*zDim*zDim+curBlockIdx*K*zDim*zDim];
+                }
+            }
+
+            if(!(Nk[k]>0)) {
+                return false;
+            }
+
+            w[k]=Nk[k]/totalWeight;
+            for(l=0;l<zDim;l++) {
+                mu[l+k*zDim]/=Nk[k];
+            }
+        }
+
+        //The maximization step for the covariance matrices, which is done
+        //in a second pass using the new means.
+        #pragma omp parallel
+        {
+            vector<double> diff(zDim);
+            ptrdiff_t curBlock;
+
+            #pragma omp for
+            for(curBlock=0;curBlock<(ptrdiff_t)numBlocks;curBlock++) {
+                const size_t startIdx=curBlock*sampleBlockSize;
+                const size_t endIdx=min(numPoints,startIdx+sampleBlockSize);
+                double *curSums=&blockSums[curBlock*K*zDim*zDim];
+                size_t idx, c, d, e;
+
+                fill_n(curSums,K*zDim*zDim,0.0);
+                for(idx=startIdx;idx<endIdx;idx++) {
+                    const double *point=z+idx*zDim;
+
+                    for(c=0;c<K;c++) {
+                        const double gammaCur=gamma[c+idx*K];
+                        double *PSum=curSums+c*zDim*zDim;
+
+                        for(d=0;d<zDim;d++) {
+                            diff[d]=point[d]-mu[d+c*zDim];
+                        }
+
+                        //Only the lower triangular part is summed.
+                        for(e=0;e<zDim;e++) {
+                            for(d=e;d<zDim;d++) {
+                                PSum[d+e*zDim]+=gammaCur*diff[d]*diff[e];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        for(k=0;k<K;k++) {
+            double *PCur=P+k*zDim*zDim;
+            fill_n(PCur,zDim*zDim,0.0);
+            for(curBlockIdx=0;curBlockIdx<numBlocks;curBlockIdx++) {
+                const double *PSum=&blockSums[k*zDim*zDim+curBlockIdx*K*zDim*zDim];
+
+                for(m=0;m<zDim;m++) {
+                    for(l=m;l<zDim;l++) {
+                        PCur[l+m*zDim]+=PSum[l+m*zDim];
+                    }
+                }
+            }
+
+            for(m=0;m<zDim;m++) {
+                for(l=m;l<zDim;l++) {
+                    PCur[l+m*zDim]/=Nk[k];
+                    PCur[m+l*zDim]=PCur[l+m*zDim];
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
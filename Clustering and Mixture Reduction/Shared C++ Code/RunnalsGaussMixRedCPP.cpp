@@ -0,0 +1,422 @@
+/**RUNNALSGAUSSMIXREDCPP A C++ implementation of the greedy Gaussian
+ *              mixture reduction algorithm of Runnalls, which repeatedly
+ *              merges the pair of components that has the smallest upper
+ *              bound on the increase in the Kullback-Leibler divergence
+ *              caused by the merge. The cost of merging components i and
+ *              j is the same as in the Matlab function RunnalsGaussMixRed,
+ *B(i,j)=0.5*((w_i+w_j)*log(det(P_ij))-w_i*log(det(P_i))-w_j*log(det(P_j)))
+ *              where P_ij is the covariance matrix of the component
+ *              obtained by merging i and j using mergeGaussianComp.
+ *
+ *The Matlab implementation recomputes the cost matrix after every merge
+ *and searches the whole matrix for the minimum, making the reduction
+ *O(N^3) in the number of components N. Here, the cheapest partner of each
+ *component and the cost of merging with it are stored and the components
+ *are kept in an indexed binary heap keyed by that cost. After a merge, the
+ *merged component is stored in the slot of the lower of the two indices
+ *and only the costs involving it are computed. Only the components whose
+ *cheapest partner was one of the two merged components have to search
+ *all of their partners again, which is done using a stored triangular
+ *matrix of the pair costs, as in the Matlab implementation. Thus, each
+ *merge costs O(N) evaluations of B and O(N) comparisons per affected
+ *component rather than O(N^2) evaluations of B.
+ *
+ *When there are many components, the candidate pairs can optionally be
+ *restricted to components whose means are among each others'
+ *numNeighbors nearest neighbors, which are found once using a kd-tree.
+ *When two components are merged, the neighbors of the merged component
+ *are the union of the neighbors of the two. This avoids the initial
+ *O(N^2) cost computation. As the Euclidean distance is used, the state
+ *should be scaled so that the components are comparable in all
+ *dimensions. Since merges are then only considered among neighbors, the
+ *result can differ from that of the exhaustive algorithm and the
+ *reduction can stop with more than K components if no candidate pairs
+ *remain.
+ *
+ *The algorithm is from
+ *A. R. Runnalls, "Kullback-Leibler approach to Gaussian mixture
+ *reduction," IEEE Trans. Aerosp. Electron. Syst., vol. 43, no. 3, pp.
+ *989-999, Jul. 2007.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For log
+#include <cmath>
+//For copy, sort and unique
+#include <algorithm>
+#include <vector>
+#include <limits>
+#include "clusterFuncs.hpp"
+#include "matrixFuncs.hpp"
+#include "BinaryHeapOfIndicesCPP.hpp"
+#include "kdTreeCPP.hpp"
+
+using namespace std;
+
+/* The RunnalsMixture class holds the current state of a mixture that is
+ * being reduced. Components that have been merged into others are marked
+ * as not alive. If neighbor lists are used, nbrs[i] holds the sorted
+ * indices of the alive components that can be merged with component i.
+ * Otherwise, all alive components are candidates and the costs of all
+ * pairs are stored in costCache.
+ */
+class RunnalsMixture {
+public:
+    size_t xDim;
+    size_t N;
+    bool useNbrs;
+    vector<double> w;
+    vector<double> mu;
+    vector<double> P;
+    vector<double> logDetP;
+    vector<char> isAlive;
+    vector<vector<size_t> > nbrs;
+    vector<double> costCache;
+    vector<double> bestCost;
+    vector<ptrdiff_t> bestPartner;
+    vector<double> scratch;
+    BinaryHeapOfIndicesCPP costHeap;
+
+    RunnalsMixture(const double *wInit,const double *muInit,const double *PInit,const size_t xDimDes,const size_t NDes);
+    double mergeCost(const size_t i,const size_t j);
+    double &cachedCost(const size_t i,const size_t j) {
+        return i<j?costCache[j*(j-1)/2+i]:costCache[i*(i-1)/2+j];
+    }
+    void findBestPartner(const size_t i);
+    void mergePair(const size_t i,const size_t j);
+    void updateAfterMerge(const size_t i,const size_t j);
+private:
+    double logDet(double *A);
+    void candidates(vector<size_t> &cand,const size_t i) const;
+};
+
+RunnalsMixture::RunnalsMixture(const double *wInit,const double *muInit,const double *PInit,const size_t xDimDes,const size_t NDes) : xDim(xDimDes), N(NDes), useNbrs(false), w(wInit,wInit+NDes), mu(muInit,muInit+xDimDes*NDes), P(PInit,PInit+xDimDes*xDimDes*NDes), logDetP(NDes), isAlive(NDes,1), bestCost(NDes), bestPartner(NDes,-1), scratch(xDimDes*xDimDes+xDimDes), costHeap(NDes) {
+    size_t i;
+
+    for(i=0;i<N;i++) {
+        copy(P.begin()+i*xDim*xDim,P.begin()+(i+1)*xDim*xDim,scratch.begin());
+        logDetP[i]=logDet(&scratch[0]);
+    }
+}
+
+double RunnalsMixture::logDet(double *A) {
+/*LOGDET Compute the natural logarithm of the determinant of the symmetric
+ *       positive definite matrix A, which is overwritten. If A is not
+ *       positive definite, -Inf is returned.
+ */
+    double val=0;
+    size_t i;
+
+    if(!cholLowerCPP(A,A,xDim)) {
+        return -numeric_limits<double>::infinity();
+    }
+
+    for(i=0;i<xDim;i++) {
+        val+=log(A[i+i*xDim]);
+    }
+    return 2*val;
+}
+
+double RunnalsMixture::mergeCost(const size_t i,const size_t j) {
+    const double wSum=w[i]+w[j];
+    const double w1=w[i]/wSum;
+    const double w2=w[j]/wSum;
+    const double *mu1=&mu[i*xDim];
+    const double *mu2=&mu[j*xDim];
+    const double *P1=&P[i*xDim*xDim];
+    const double *P2=&P[j*xDim*xDim];
+    double *P12=&scratch[0];
+    double *diff=P12+xDim*xDim;
+    double val;
+    size_t k,l;
+
+    for(k=0;k<xDim;k++) {
+        diff[k]=mu1[k]-mu2[k];
+    }
+
+    //Only the lower triangular part is needed for the Cholesky
+    //decomposition.
+    for(l=0;l<xDim;l++) {
+        for(k=l;k<xDim;k++) {
+            P12[k+l*xDim]=w1*P1[k+l*xDim]+w2*P2[k+l*xDim]+w1*w2*diff[k]*diff[l];
+        }
+    }
+
+    val=0.5*(wSum*logDet(P12)-w[i]*logDetP[i]-w[j]*logDetP[j]);
+
+    //Deal with the case where the weights are both essentially zero, as in
+    //the Matlab implementation.
+    if(!((val-val)==0)) {
+        val=0;
+    }
+    return val;
+}
+
+void RunnalsMixture::candidates(vector<size_t> &cand,const size_t i) const {
+    cand.clear();
+    if(useNbrs) {
+        cand=nbrs[i];
+    } else {
+        size_t j;
+
+        for(j=0;j<N;j++) {
+            if(isAlive[j]&&j!=i) {
+                cand.push_back(j);
+            }
+        }
+    }
+}
+
+void RunnalsMixture::findBestPartner(const size_t i) {
+/*FINDBESTPARTNER Search all candidates for the cheapest partner of
+ *                component i and update the heap.
+ */
+    vector<size_t> cand;
+    size_t k;
+
+    candidates(cand,i);
+    bestPartner[i]=-1;
+    bestCost[i]=numeric_limits<double>::infinity();
+    for(k=0;k<cand.size();k++) {
+        const double cost=useNbrs?mergeCost(i,cand[k]):cachedCost(i,cand[k]);
+
+        if(cost<bestCost[i]||bestPartner[i]<0) {
+            bestCost[i]=cost;
+            bestPartner[i]=(ptrdiff_t)cand[k];
+        }
+    }
+
+    if(bestPartner[i]<0) {
+        costHeap.deleteIndex(i);
+    } else {
+        costHeap.changeIndexedKey(bestCost[i],i);
+    }
+}
+
+void RunnalsMixture::mergePair(const size_t i,const size_t j) {
+/*MERGEPAIR Replace component i with the result of merging components i
+ *          and j as in the Matlab function mergeGaussianComp and remove
+ *          component j.
+ */
+    const double wMerged=w[i]+w[j];
+    double w1=w[i]/wMerged;
+    double w2=w[j]/wMerged;
+    double *mu1=&mu[i*xDim];
+    const double *mu2=&mu[j*xDim];
+    double *P1=&P[i*xDim*xDim];
+    const double *P2=&P[j*xDim*xDim];
+    double *diff1=&scratch[0];
+    double *diff2=diff1+xDim;
+    size_t k,l;
+
+    //Deal with numerical problems.
+    if(!((w1-w1)==0&&(w2-w2)==0)) {
+        w1=0.5;
+        w2=0.5;
+    }
+
+    for(k=0;k<xDim;k++) {
+        const double muMerged=w1*mu1[k]+w2*mu2[k];
+
+        diff1[k]=mu1[k]-muMerged;
+        diff2[k]=mu2[k]-muMerged;
+        mu1[k]=muMerged;
+    }
+
+    //The quadratic form of the Matlab implementation is used, because it
+    //is more likely to remain positive definite.
+    for(l=0;l<xDim;l++) {
+        for(k=0;k<xDim;k++) {
+            P1[k+l*xDim]=w1*(P1[k+l*xDim]+diff1[k]*diff1[l])+w2*(P2[k+l*xDim]+diff2[k]*diff2[l]);
+        }
+    }
+
+    w[i]=wMerged;
+    copy(P1,P1+xDim*xDim,scratch.begin());
+    logDetP[i]=logDet(&scratch[0]);
+
+    isAlive[j]=0;
+    costHeap.deleteIndex(j);
+}
+
+void RunnalsMixture::updateAfterMerge(const size_t i,const size_t j) {
+/*UPDATEAFTERMERGE After component j has been merged into component i,
+ *                 update the neighbor lists and the cheapest partners.
+ */
+    vector<size_t> cand;
+    size_t k;
+
+    if(useNbrs) {
+        vector<size_t> &nbrI=nbrs[i];
+        vector<size_t> &nbrJ=nbrs[j];
+
+        //The neighbors of j become neighbors of i.
+        for(k=0;k<nbrJ.size();k++) {
+            vector<size_t> &nbrK=nbrs[nbrJ[k]];
+
+            if(nbrJ[k]==i) {
+                continue;
+            }
+
+            nbrK.erase(lower_bound(nbrK.begin(),nbrK.end(),j));
+            if(!binary_search(nbrK.begin(),nbrK.end(),i)) {
+                nbrK.insert(lower_bound(nbrK.begin(),nbrK.end(),i),i);
+            }
+            nbrI.push_back(nbrJ[k]);
+        }
+        nbrJ.clear();
+        sort(nbrI.begin(),nbrI.end());
+        nbrI.erase(unique(nbrI.begin(),nbrI.end()),nbrI.end());
+        nbrI.erase(lower_bound(nbrI.begin(),nbrI.end(),j));
+    }
+
+    candidates(cand,i);
+    bestPartner[i]=-1;
+    bestCost[i]=numeric_limits<double>::infinity();
+    for(k=0;k<cand.size();k++) {
+        const size_t idx=cand[k];
+        const double cost=mergeCost(i,idx);
+
+        if(!useNbrs) {
+            cachedCost(i,idx)=cost;
+        }
+
+        if(cost<bestCost[i]||bestPartner[i]<0) {
+            bestCost[i]=cost;
+            bestPartner[i]=(ptrdiff_t)idx;
+        }
+
+        if(bestPartner[idx]==(ptrdiff_t)i||bestPartner[idx]==(ptrdiff_t)j) {
+            //The previous cheapest partner no longer exists, so all
+            //partners must be searched.
+            findBestPartner(idx);
+        } else if(cost<bestCost[idx]) {
+            bestCost[idx]=cost;
+            bestPartner[idx]=(ptrdiff_t)i;
+            costHeap.changeIndexedKey(cost,idx);
+        }
+    }
+
+    if(bestPartner[i]<0) {
+        costHeap.deleteIndex(i);
+    } else {
+        costHeap.changeIndexedKey(bestCost[i],i);
+    }
+}
+
+size_t RunnalsGaussMixRedCPP(double *wRed,double *muRed,double *PRed,const double *w,const double *mu,const double *P,const size_t xDim,const size_t N,const size_t K,const size_t numNeighbors) {
+    size_t numAlive=N;
+    size_t i, j, numRed;
+
+    if(N<=K) {
+        copy(w,w+N,wRed);
+        copy(mu,mu+xDim*N,muRed);
+        copy(P,P+xDim*xDim*N,PRed);
+        return N;
+    }
+
+    RunnalsMixture mix(w,mu,P,xDim,N);
+
+    if(numNeighbors>0&&numNeighbors+1<N) {
+        //The nearest neighbor of each point is itself.
+        const size_t m=numNeighbors+1;
+        vector<size_t> idxNN(m*N);
+        vector<double> distSquared(m*N);
+        kdTreeCPP tree(xDim,N);
+
+        tree.buildTreeFromBatch(mu);
+        tree.findmBestNN(&idxNN[0],&distSquared[0],mu,N,m);
+
+        mix.useNbrs=true;
+        mix.nbrs.resize(N);
+        for(i=0;i<N;i++) {
+            for(j=0;j<m;j++) {
+                const size_t idx=idxNN[j+i*m];
+
+                if(idx!=i) {
+                    mix.nbrs[i].push_back(idx);
+                    mix.nbrs[idx].push_back(i);
+                }
+            }
+        }
+
+        for(i=0;i<N;i++) {
+            sort(mix.nbrs[i].begin(),mix.nbrs[i].end());
+            mix.nbrs[i].erase(unique(mix.nbrs[i].begin(),mix.nbrs[i].end()),mix.nbrs[i].end());
+        }
+
+        for(i=0;i<N;i++) {
+            mix.findBestPartner(i);
+        }
+    } else {
+        //Each pair cost is only computed once.
+        mix.costCache.resize(N*(N-1)/2);
+        for(i=0;i<N;i++) {
+            mix.bestPartner[i]=-1;
+        }
+
+        for(i=0;i<N;i++) {
+            for(j=i+1;j<N;j++) {
+                const double cost=mix.mergeCost(i,j);
+
+                mix.cachedCost(i,j)=cost;
+
+                if(mix.bestPartner[i]<0||cost<mix.bestCost[i]) {
+                    mix.bestCost[i]=cost;
+                    mix.bestPartner[i]=(ptrdiff_t)j;
+                }
+
+                if(mix.bestPartner[j]<0||cost<mix.bestCost[j]) {
+                    mix.bestCost[j]=cost;
+                    mix.bestPartner[j]=(ptrdiff_t)i;
+                }
+            }
+            mix.costHeap.insert(mix.bestCost[i],i);
+        }
+    }
+
+    while(numAlive>K&&!mix.costHeap.isEmpty()) {
+        const size_t idx1=mix.costHeap.getTopIdx();
+        const size_t idx2=(size_t)mix.bestPartner[idx1];
+        const size_t iKeep=min(idx1,idx2);
+        const size_t iRemove=max(idx1,idx2);
+
+        mix.mergePair(iKeep,iRemove);
+        mix.updateAfterMerge(iKeep,iRemove);
+        numAlive--;
+    }
+
+    //With neighbor lists, more than K components can remain, so the
+    //output buffers are sized for N components in that case.
+    numRed=0;
+    for(i=0;i<N;i++) {
+        if(mix.isAlive[i]) {
+            wRed[numRed]=mix.w[i];
+            copy(mix.mu.begin()+i*xDim,mix.mu.begin()+(i+1)*xDim,muRed+numRed*xDim);
+            copy(mix.P.begin()+i*xDim*xDim,mix.P.begin()+(i+1)*xDim*xDim,PRed+numRed*xDim*xDim);
+            numRed++;
+        }
+    }
+
+    return numRed;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
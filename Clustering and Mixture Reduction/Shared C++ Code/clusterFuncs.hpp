@@ -0,0 +1,152 @@
+/**CLUSTERFUNCS A header file for C++ implementations of Gaussian mixture
+ *             reduction and clustering algorithms. See the files
+ *             implementing each function for more details on their
+ *             usage.
+ *
+ *All matrices are stored by column, as in Matlab. The functions only use
+ *memory that they allocate themselves or that is passed to them, so
+ *different mixtures can be processed in parallel. The clustering
+ *functions, which process one large set of points, use OpenMP internally
+ *if it is available.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef CLUSTERFUNCSCPP
+#define CLUSTERFUNCSCPP
+#include <stddef.h>
+
+size_t RunnalsGaussMixRedCPP(double *wRed,
+                             double *muRed,
+                             double *PRed,
+                             const double *w,
+                             const double *mu,
+                             const double *P,
+                             const size_t xDim,
+                             const size_t N,
+                             const size_t K,
+                             const size_t numNeighbors);
+/*RUNNALSGAUSSMIXREDCPP Reduce an N-component Gaussian mixture with
+ *              weights w, xDimXN means mu and xDimXxDimXN covariance
+ *              matrices P to at most K components using the greedy
+ *              algorithm of Runnalls. If numNeighbors>0, only merges
+ *              between components that are among each others'
+ *              numNeighbors nearest neighbors (by the Euclidean distance
+ *              between the means) are considered. The reduced mixture is
+ *              placed in wRed, muRed and PRed and the number of
+ *              components in it is returned. If numNeighbors>0, the
+ *              reduction can stop with more than K components, so wRed,
+ *              muRed and PRed must have space for N components. Otherwise,
+ *              space for min(N,K) components suffices.
+ */
+
+size_t sampleWeightedIdxCPP(const double *weights,
+                            const double *scale,
+                            const double u,
+                            const size_t numPoints);
+/*SAMPLEWEIGHTEDIDXCPP Given a uniform random number u between 0 and 1,
+ *              draw the index of one of numPoints points with a
+ *              probability proportional to weights[i]*scale[i]. Either
+ *              weights or scale can be NULL, in which case its elements
+ *              are taken to be one.
+ */
+
+void kMeansppInitCPP(double *mu,
+                     double *nearestDist,
+                     const double *z,
+                     const double *weights,
+                     const size_t firstIdx,
+                     const double *randVals,
+                     const size_t zDim,
+                     const size_t numPoints,
+                     const size_t K);
+/*KMEANSPPINITCPP Choose K initial cluster centers from the zDimXnumPoints
+ *              points z using the k-means++ method, where each point has
+ *              the weight given in weights (NULL means all weights are
+ *              one). The first center is the point with index firstIdx.
+ *              randVals holds K-1 uniform random numbers between 0 and 1
+ *              that are used in order to choose the other centers and
+ *              nearestDist is scratch space for numPoints doubles.
+ */
+
+size_t kMeansCPP(double *mu,
+                 size_t *selClust,
+                 double *minCost,
+                 const double *z,
+                 const double *weights,
+                 const size_t zDim,
+                 const size_t numPoints,
+                 const size_t K,
+                 const size_t maxIter);
+/*KMEANSCPP Refine the zDimXK cluster centers in mu using the k-means
+ *          algorithm with Hamerly's distance bounds, which give the same
+ *          result as the standard algorithm with fewer distance
+ *          evaluations. On return, selClust holds the index of the
+ *          cluster (starting from 0) to which each point is assigned and
+ *          minCost the squared distance of each point to its cluster's
+ *          center. The return value is the number of iterations
+ *          performed.
+ */
+
+bool EMGaussClustCPP(double *w,
+                     double *mu,
+                     double *P,
+                     double *logLike,
+                     const double *z,
+                     const double *weights,
+                     const size_t zDim,
+                     const size_t numPoints,
+                     const size_t K,
+                     const size_t numIter);
+/*EMGAUSSCLUSTCPP Refine the K weights w, zDimXK means mu and
+ *          zDimXzDimXK covariance matrices P of a Gaussian mixture by
+ *          performing numIter iterations of the expectation maximization
+ *          algorithm on the zDimXnumPoints samples z, where each sample
+ *          has the weight given in weights (NULL means all weights are
+ *          one). The log-likelihood of the samples under the mixture
+ *          before the last iteration is put in logLike. The return value
+ *          is false if a covariance matrix stopped being positive
+ *          definite or a component lost all of its weight.
+ */
+
+double mixtureMomentsCPP(double *muMerged,
+                         double *PMerged,
+                         const double *w,
+                         const double *mu,
+                         const double *P,
+                         const double *muHyp,
+                         const size_t xDim,
+                         const size_t N,
+                         double *scratch);
+/*MIXTUREMOMENTSCPP Compute the mean muMerged and the covariance matrix
+ *              PMerged of an N-component mixture with weights w, xDimXN
+ *              means mu and xDimXxDimXN covariance matrices P, as in the
+ *              Matlab function mergeGaussianComp. The weights are
+ *              normalized by their sum, which is returned. P can be NULL,
+ *              in which case the components are points, as in the Matlab
+ *              function calcMixtureMoments. If muHyp is not NULL, then
+ *              PMerged is the mean squared error matrix about muHyp rather
+ *              than the covariance matrix. Compensated summation is used.
+ *              scratch must have space for xDim*(xDim+2) doubles.
+ */
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,293 @@
+/**KMEANSCPP C++ implementations of the k-means++ initialization and the
+ *           k-means clustering algorithm for weighted points. These are
+ *           used by the compiled version of kMeanspp.
+ *
+ *The k-means++ initialization is from
+ *D. Arthur and S. Vassilvitskii, "k-means++: The advantages of careful
+ *seeding," in Proceedings of the Eighteenth Annual ACM-SIAM Symposium on
+ *Discrete Algorithms, New Orleans, LA, Jan. 2007, pp. 1027-1035.
+ *The first center is given and each subsequent center is chosen with a
+ *probability proportional to the weight of a point times its squared
+ *distance to the nearest center chosen thus far.
+ *
+ *The refinement step performs the same iterations as the standard
+ *(Lloyd's) k-means algorithm in kMeanspp, but it avoids most of the
+ *point-center distance computations using the bounds of
+ *G. Hamerly, "Making k-means even faster," in Proceedings of the 2010
+ *SIAM International Conference on Data Mining, Columbus, OH, Apr.-May
+ *2010, pp. 130-140.
+ *For each point, an upper bound on the distance to its assigned center
+ *and a lower bound on the distance to every other center are kept. When
+ *the centers move, the bounds are loosened by the distances moved. A
+ *point only has to be compared to all of the centers if its upper bound
+ *exceeds both its lower bound and half the distance from its center to
+ *the nearest other center. After the first few iterations, this is rarely
+ *the case. Since the bounds are only used to skip computations that could
+ *not change the assignment, the result is the same as that of the
+ *standard algorithm, barring floating point ties.
+ *
+ *The loops over the points are parallelized using OpenMP if it is
+ *available. The sums for the new centers are accumulated over fixed blocks
+ *of points and then added in order, so that the results do not depend on
+ *the number of threads.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For sqrt
+#include <cmath>
+//For fill_n and copy
+#include <algorithm>
+#include <vector>
+#include <limits>
+#include "clusterFuncs.hpp"
+
+using namespace std;
+
+//The number of points in each block used for summation.
+static const size_t pointBlockSize=1024;
+
+static double distSquared(const double *a,const double *b,const size_t numDim);
+static void fullSearch(size_t &bestIdx,double &bestDist,double &secondDist,const double *point,const double *mu,const size_t zDim,const size_t K);
+
+size_t sampleWeightedIdxCPP(const double *weights,const double *scale,const double u,const size_t numPoints) {
+    double totalWeight=0, target, cumSum;
+    size_t idx;
+
+    for(idx=0;idx<numPoints;idx++) {
+        const double wCur=weights==NULL?1.0:weights[idx];
+
+        totalWeight+=scale==NULL?wCur:wCur*scale[idx];
+    }
+
+    //Find the first point where the cumulative distribution exceeds the
+    //random draw. The last point is chosen if finite precision keeps the
+    //cumulative sum below the draw.
+    target=u*totalWeight;
+    cumSum=0;
+    for(idx=0;idx<numPoints-1;idx++) {
+        const double wCur=weights==NULL?1.0:weights[idx];
+
+        cumSum+=scale==NULL?wCur:wCur*scale[idx];
+        if(!(cumSum<target)) {
+            break;
+        }
+    }
+
+    return idx;
+}
+
+void kMeansppInitCPP(double *mu,double *nearestDist,const double *z,const double *weights,const size_t firstIdx,const double *randVals,const size_t zDim,const size_t numPoints,const size_t K) {
+    size_t k;
+
+    for(k=0;k<K;k++) {
+        const size_t idx=k==0?firstIdx:sampleWeightedIdxCPP(weights,nearestDist,randVals[k-1],numPoints);
+        ptrdiff_t i;
+
+        copy(z+idx*zDim,z+(idx+1)*zDim,mu+k*zDim);
+
+        //Update the squared distances to the nearest center.
+        #pragma omp parallel for
+        for(i=0;i<(ptrdiff_t)numPoints;i++) {
+            const double dist=distSquared(z+i*zDim,mu+k*zDim,zDim);
+
+            if(k==0||dist<nearestDist[i]) {
+                nearestDist[i]=dist;
+            }
+        }
+    }
+}
+
+size_t kMeansCPP(double *mu,size_t *selClust,double *minCost,const double *z,const double *weights,const size_t zDim,const size_t numPoints,const size_t K,const size_t maxIter) {
+    const double infVal=numeric_limits<double>::infinity();
+    const size_t numBlocks=(numPoints+pointBlockSize-1)/pointBlockSize;
+    //Upper bounds on the distances to the assigned centers and lower
+    //bounds on the distances to all other centers.
+    vector<double> upperBound(numPoints);
+    vector<double> lowerBound(numPoints);
+    //Half the distance from each center to the nearest other center.
+    vector<double> s(K);
+    //The distance that each center moved in the last iteration.
+    vector<double> p(K);
+    vector<double> blockSums(numBlocks*K*zDim);
+    vector<double> blockWeights(numBlocks*K);
+    vector<double> clustSum(zDim);
+    size_t numIter=0;
+    ptrdiff_t i;
+
+    //The initial assignment compares every point to every center.
+    #pragma omp parallel for
+    for(i=0;i<(ptrdiff_t)numPoints;i++) {
+        fullSearch(selClust[i],upperBound[i],lowerBound[i],z+i*zDim,mu,zDim,K);
+    }
+
+    while(numIter<maxIter) {
+        double maxMove=0, secondMaxMove=0;
+        size_t maxMoveIdx=0;
+        bool muChanged=false;
+        ptrdiff_t curBlock;
+        size_t j, k;
+
+        if(numIter>0) {
+            for(j=0;j<K;j++) {
+                s[j]=infVal;
+                for(k=0;k<K;k++) {
+                    if(k!=j) {
+                        s[j]=min(s[j],0.5*sqrt(distSquared(mu+j*zDim,mu+k*zDim,zDim)));
+                    }
+                }
+            }
+
+            #pragma omp parallel for schedule(dynamic,pointBlockSize)
+            for(i=0;i<(ptrdiff_t)numPoints;i++) {
+                const double *point=z+i*zDim;
+                const size_t a=selClust[i];
+                const double bound=max(s[a],lowerBound[i]);
+
+                if(upperBound[i]>bound) {
+                    //Tighten the upper bound and test again.
+                    upperBound[i]=sqrt(distSquared(point,mu+a*zDim,zDim));
+                    if(upperBound[i]>bound) {
+                        fullSearch(selClust[i],upperBound[i],lowerBound[i],point,mu,zDim,K);
+                    }
+                }
+            }
+        }
+
+        //Compute the new centers, summing within fixed blocks of points.
+        #pragma omp parallel for
+        for(curBlock=0;curBlock<(ptrdiff_t)numBlocks;curBlock++) {
+            const size_t startIdx=curBlock*pointBlockSize;
+            const size_t endIdx=min(numPoints,startIdx+pointBlockSize);
+            double *curSums=&blockSums[curBlock*K*zDim];
+            double *curWeights=&blockWeights[curBlock*K];
+            size_t idx, l;
+
+            fill_n(curSums,K*zDim,0.0);
+            fill_n(curWeights,K,0.0);
+            for(idx=startIdx;idx<endIdx;idx++) {
+                const size_t a=selClust[idx];
+                const double wCur=weights==NULL?1.0:weights[idx];
+
+                curWeights[a]+=wCur;
+                for(l=0;l<zDim;l++) {
+                    curSums[l+a*zDim]+=wCur*z[l+idx*zDim];
+                }
+            }
+        }
+
+        for(k=0;k<K;k++) {
+            double clustWeight=0, moveDist;
+            size_t l, curBlockIdx;
+
+            fill_n(clustSum.begin(),zDim,0.0);
+            for(curBlockIdx=0;curBlockIdx<numBlocks;curBlockIdx++) {
+                clustWeight+=blockWeights[k+curBlockIdx*K];
+                for(l=0;l<zDim;l++) {
+                    clustSum[l]+=blockSums[l+k*zDim+curBlockIdx*K*zDim];
+                }
+            }
+
+            //A center without any points keeps its previous location.
+            moveDist=0;
+            if(clustWeight>0) {
+                for(l=0;l<zDim;l++) {
+                    const double newVal=clustSum[l]/clustWeight;
+                    const double diff=newVal-mu[l+k*zDim];
+
+                    if(newVal!=mu[l+k*zDim]) {
+                        muChanged=true;
+                    }
+                    moveDist+=diff*diff;
+                    mu[l+k*zDim]=newVal;
+                }
+            }
+            p[k]=sqrt(moveDist);
+
+            if(p[k]>maxMove) {
+                secondMaxMove=maxMove;
+                maxMove=p[k];
+                maxMoveIdx=k;
+            } else if(p[k]>secondMaxMove) {
+                secondMaxMove=p[k];
+            }
+        }
+        numIter++;
+
+        if(!muChanged) {
+            break;
+        }
+
+        //Loosen the bounds by the distances that the centers moved.
+        #pragma omp parallel for
+        for(i=0;i<(ptrdiff_t)numPoints;i++) {
+            const size_t a=selClust[i];
+
+            upperBound[i]+=p[a];
+            lowerBound[i]-=a==maxMoveIdx?secondMaxMove:maxMove;
+        }
+    }
+
+    #pragma omp parallel for
+    for(i=0;i<(ptrdiff_t)numPoints;i++) {
+        minCost[i]=distSquared(z+i*zDim,mu+selClust[i]*zDim,zDim);
+    }
+
+    return numIter;
+}
+
+static double distSquared(const double *a,const double *b,const size_t numDim) {
+    double dist=0;
+    size_t i;
+
+    for(i=0;i<numDim;i++) {
+        const double diff=a[i]-b[i];
+        dist+=diff*diff;
+    }
+    return dist;
+}
+
+static void fullSearch(size_t &bestIdx,double &bestDist,double &secondDist,const double *point,const double *mu,const size_t zDim,const size_t K) {
+/*FULLSEARCH Find the nearest center to a point as well as the distances
+ *           to the nearest and second nearest centers. Ties go to the
+ *           lowest index, as in kMeanspp.
+ */
+    const double infVal=numeric_limits<double>::infinity();
+    double best=infVal, second=infVal;
+    size_t k;
+
+    bestIdx=0;
+    for(k=0;k<K;k++) {
+        const double dist=distSquared(point,mu+k*zDim,zDim);
+
+        if(dist<best) {
+            second=best;
+            best=dist;
+            bestIdx=k;
+        } else if(dist<second) {
+            second=dist;
+        }
+    }
+
+    bestDist=sqrt(best);
+    secondDist=sqrt(second);
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
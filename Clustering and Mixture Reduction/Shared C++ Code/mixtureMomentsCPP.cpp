@@ -0,0 +1,144 @@
+/*MIXTUREMOMENTSCPP A C++ function for computing the first two moments of
+ *                  a mixture distribution, which is used to collapse the
+ *                  Gaussian mixtures that arise in probabilistic data
+ *                  association and in interacting multiple model filters
+ *                  into a single Gaussian.
+ *
+ *The mean and the covariance matrix of a mixture with normalized weights
+ *w_i, means mu_i and covariance matrices P_i are
+ *muMerged=sum_i w_i*mu_i
+ *PMerged=sum_i w_i*(P_i+(mu_i-muMerged)*(mu_i-muMerged)')
+ *as derived in Chapter 1.4.16 of
+ *Y. Bar-Shalom, X. R. Li, and T. Kirubarajan, Estimation with Applications
+ *to Tracking and Navigation. New York: John Wiley and Sons, Inc, 2001.
+ *As in the Matlab function mergeGaussianComp, the quadratic form above is
+ *used rather than the simplified form sum_i w_i*(P_i+mu_i*mu_i')-mu*mu',
+ *which can lose positive definiteness due to cancellation. Additionally,
+ *all of the sums are computed using the compensated summation algorithm
+ *of
+ *A. Neumaier, "Rundungsfehleranalyse einiger Verfahren zur Summation
+ *endlicher Summen," Zeitschrift fur Angewandte Mathematik und Mechanik,
+ *vol. 54, no. 1, pp. 39-51, 1974.
+ *so that the result is accurate for mixtures with many components whose
+ *weights differ by many orders of magnitude. Only the upper triangle of
+ *PMerged is accumulated, so the result is exactly symmetric.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+**/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For fill_n
+#include <algorithm>
+//For fabs
+#include <cmath>
+#include "clusterFuncs.hpp"
+
+using namespace std;
+
+static inline void addCompensated(double &sum,double &comp,const double val);
+
+double mixtureMomentsCPP(double *muMerged,double *PMerged,const double *w,const double *mu,const double *P,const double *muHyp,const size_t xDim,const size_t N,double *scratch) {
+    double *muComp=scratch;
+    double *PComp=scratch+xDim;
+    double *diff=PComp+xDim*xDim;
+    const double *mean2Use;
+    double wSum=0, wSumComp=0, wScale;
+    bool uniformWeights=false;
+    size_t i, j, k;
+
+    for(k=0;k<N;k++) {
+        addCompensated(wSum,wSumComp,w[k]);
+    }
+    wSum+=wSumComp;
+
+    //Deal with numerical problems in the same manner as in
+    //mergeGaussianComp.
+    wScale=1.0/wSum;
+    if(!(wSum>0)||(wScale-wScale)!=0) {
+        uniformWeights=true;
+        wScale=1.0/(double)N;
+    }
+
+    fill_n(muMerged,xDim,0.0);
+    fill_n(muComp,xDim,0.0);
+    for(k=0;k<N;k++) {
+        const double wCur=uniformWeights?wScale:w[k]*wScale;
+        const double *muCur=mu+k*xDim;
+
+        for(i=0;i<xDim;i++) {
+            addCompensated(muMerged[i],muComp[i],wCur*muCur[i]);
+        }
+    }
+
+    for(i=0;i<xDim;i++) {
+        muMerged[i]+=muComp[i];
+    }
+
+    if(PMerged==NULL) {
+        return wSum;
+    }
+
+    mean2Use=muHyp==NULL?muMerged:muHyp;
+
+    fill_n(PMerged,xDim*xDim,0.0);
+    fill_n(PComp,xDim*xDim,0.0);
+    for(k=0;k<N;k++) {
+        const double wCur=uniformWeights?wScale:w[k]*wScale;
+        const double *muCur=mu+k*xDim;
+
+        for(i=0;i<xDim;i++) {
+            diff[i]=muCur[i]-mean2Use[i];
+        }
+
+        for(j=0;j<xDim;j++) {
+            for(i=0;i<=j;i++) {
+                double val=diff[i]*diff[j];
+
+                if(P!=NULL) {
+                    val+=P[i+j*xDim+k*xDim*xDim];
+                }
+
+                addCompensated(PMerged[i+j*xDim],PComp[i+j*xDim],wCur*val);
+            }
+        }
+    }
+
+    for(j=0;j<xDim;j++) {
+        for(i=0;i<=j;i++) {
+            PMerged[i+j*xDim]+=PComp[i+j*xDim];
+            PMerged[j+i*xDim]=PMerged[i+j*xDim];
+        }
+    }
+
+    return wSum;
+}
+
+static inline void addCompensated(double &sum,double &comp,const double val) {
+//Add val to sum, accumulating the rounding error in comp.
+    const double t=sum+val;
+
+    if(fabs(sum)>=fabs(val)) {
+        comp+=(sum-t)+val;
+    } else {
+        comp+=(val-t)+sum;
+    }
+    sum=t;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
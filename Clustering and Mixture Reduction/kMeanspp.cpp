@@ -0,0 +1,248 @@
+/**KMEANSPP Run the k-means++ algorithm for clustering a set of more than
+ *          K data points into K clusters. This is a compiled version of
+ *          the Matlab function kMeanspp that can also handle weighted
+ *          points.
+ *
+ *INPUTS: z A zDimXnumPoints set of vectors that are to be clustered.
+ *        K The number of clusters to form. K<=numPoints.
+ *  maxIter The maximum number of iterations to perform for clustering. If
+ *          omitted or an empty matrix is passed, maxIter=1000.
+ * pointWeights An optional numPointsX1 vector of nonnegative weights of
+ *          the points. A point with weight 2 is treated the same as two
+ *          points at the same location. If omitted or an empty matrix is
+ *          passed, all points have weight 1.
+ *
+ *OUTPUTS: mu A zDimXK set of the cluster means.
+ *          P A zDimXzDimXK set of sample covariance matrices for each of
+ *            the K clusters, where mu(:,n) is the mean of the nth cluster.
+ *          w A KX1 vector of weights such that w(n) is the fraction of the
+ *            total weight of the original points assigned to the nth
+ *            cluster.
+ *       cost The cost of the k-means assignment. This is the weighted
+ *            average of the squared distances between the points and the
+ *            means of the clusters to which they are assigned.
+ *   clustIdx A 1XnumPoints vector of the index of the cluster to which
+ *            each point is assigned.
+ *
+ *The initialization and the iterations are the same as in the Matlab
+ *implementation, which is described in the comments of kMeanspp.m. The
+ *random numbers for the initialization are obtained from Matlab's randi
+ *and rand functions in the same order as in kMeanspp.m, so the two
+ *implementations choose the same initial centers given the same state of
+ *the random number generator. As in kMeanspp.m, a cluster to which no
+ *points are assigned keeps its previous mean.
+ *
+ *The iterations skip most point-center distance computations using the
+ *distance bounds of Hamerly, which does not change the result. See the
+ *comments in kMeansCPP.cpp for details. If the code is compiled with
+ *OpenMP support, then the loops over the points are run in parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[mu,P,w,cost,clustIdx]=kMeanspp(z,K,maxIter,pointWeights);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For fill_n
+#include <algorithm>
+#include "MexValidation.h"
+#include "clusterFuncs.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t zDim, numPoints, K, maxIter=1000, firstIdx;
+    size_t i, j, k, l;
+    const double *z, *pointWeights=NULL, *randVals;
+    double *mu, *minCost, *nearestDist;
+    size_t *selClust;
+    mxArray *muMATLAB, *randMATLAB, *randArgs[2];
+
+    if(nrhs<2) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>4) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>5) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    checkRealDoubleArray(prhs[0]);
+    zDim=mxGetM(prhs[0]);
+    numPoints=mxGetN(prhs[0]);
+    z=(double*)mxGetData(prhs[0]);
+    K=getSizeTFromMatlab(prhs[1]);
+
+    if(zDim==0||numPoints==0) {
+        mexErrMsgTxt("z cannot be empty.");
+    }
+
+    if(K<1||K>numPoints) {
+        mexErrMsgTxt("K must be between 1 and the number of points.");
+    }
+
+    if(nrhs>2&&!mxIsEmpty(prhs[2])) {
+        maxIter=getSizeTFromMatlab(prhs[2]);
+    }
+
+    if(nrhs>3&&!mxIsEmpty(prhs[3])) {
+        checkRealDoubleArray(prhs[3]);
+        if(mxGetNumberOfElements(prhs[3])!=numPoints) {
+            mexErrMsgTxt("pointWeights has the wrong dimensionality.");
+        }
+        pointWeights=(double*)mxGetData(prhs[3]);
+
+        for(i=0;i<numPoints;i++) {
+            if(!(pointWeights[i]>=0)) {
+                mexErrMsgTxt("The point weights must be nonnegative.");
+            }
+        }
+    }
+
+    //The points are unweighted if all of the weights are equal.
+    if(pointWeights!=NULL) {
+        bool isUniform=true;
+
+        for(i=1;i<numPoints;i++) {
+            if(pointWeights[i]!=pointWeights[0]) {
+                isUniform=false;
+                break;
+            }
+        }
+
+        if(isUniform) {
+            pointWeights=NULL;
+        }
+    }
+
+    //Get the random numbers for the initialization from Matlab in the same
+    //order as kMeanspp.m so that the random number generator state is
+    //respected. Unweighted points use randi for the first center.
+    if(pointWeights==NULL) {
+        mxArray *idxMATLAB;
+
+        randArgs[0]=mxCreateDoubleScalar((double)numPoints);
+        mexCallMATLAB(1,&idxMATLAB,1,randArgs,"randi");
+        mxDestroyArray(randArgs[0]);
+        firstIdx=getSizeTFromMatlab(idxMATLAB)-1;
+        mxDestroyArray(idxMATLAB);
+
+        randArgs[0]=mxCreateDoubleScalar((double)(K-1));
+        randArgs[1]=mxCreateDoubleScalar(1.0);
+        mexCallMATLAB(1,&randMATLAB,2,randArgs,"rand");
+        mxDestroyArray(randArgs[1]);
+        mxDestroyArray(randArgs[0]);
+        randVals=(double*)mxGetData(randMATLAB);
+    } else {
+        randArgs[0]=mxCreateDoubleScalar((double)K);
+        randArgs[1]=mxCreateDoubleScalar(1.0);
+        mexCallMATLAB(1,&randMATLAB,2,randArgs,"rand");
+        mxDestroyArray(randArgs[1]);
+        mxDestroyArray(randArgs[0]);
+        randVals=(double*)mxGetData(randMATLAB);
+
+        firstIdx=sampleWeightedIdxCPP(pointWeights,NULL,randVals[0],numPoints);
+        randVals++;
+    }
+
+    muMATLAB=mxCreateDoubleMatrix(zDim,K,mxREAL);
+    mu=(double*)mxGetData(muMATLAB);
+    minCost=new double[numPoints];
+    nearestDist=new double[numPoints];
+    selClust=new size_t[numPoints];
+
+    kMeansppInitCPP(mu,nearestDist,z,pointWeights,firstIdx,randVals,zDim,numPoints,K);
+    mxDestroyArray(randMATLAB);
+    kMeansCPP(mu,selClust,minCost,z,pointWeights,zDim,numPoints,K,maxIter);
+
+    plhs[0]=muMATLAB;
+    if(nlhs>1) {
+        mxArray *PMATLAB, *wMATLAB;
+        double *P, *w, totalWeight=0, cost=0;
+        mwSize dims[3];
+
+        dims[0]=zDim;
+        dims[1]=zDim;
+        dims[2]=K;
+        PMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+        P=(double*)mxGetData(PMATLAB);
+        wMATLAB=mxCreateDoubleMatrix(K,1,mxREAL);
+        w=(double*)mxGetData(wMATLAB);
+
+        //The weights and the sample covariance matrices of the clusters.
+        for(i=0;i<numPoints;i++) {
+            const double wCur=pointWeights==NULL?1.0:pointWeights[i];
+            const size_t a=selClust[i];
+            const double *point=z+i*zDim;
+            const double *muCur=mu+a*zDim;
+            double *PCur=P+a*zDim*zDim;
+
+            w[a]+=wCur;
+            totalWeight+=wCur;
+            cost+=wCur*minCost[i];
+            for(l=0;l<zDim;l++) {
+                for(j=0;j<zDim;j++) {
+                    PCur[j+l*zDim]+=wCur*(point[j]-muCur[j])*(point[l]-muCur[l]);
+                }
+            }
+        }
+
+        for(k=0;k<K;k++) {
+            for(j=0;j<zDim*zDim;j++) {
+                P[j+k*zDim*zDim]/=w[k];
+            }
+            w[k]/=totalWeight;
+        }
+
+        plhs[1]=PMATLAB;
+        if(nlhs>2) {
+            plhs[2]=wMATLAB;
+        } else {
+            mxDestroyArray(wMATLAB);
+        }
+
+        if(nlhs>3) {
+            plhs[3]=mxCreateDoubleScalar(cost/totalWeight);
+        }
+
+        if(nlhs>4) {
+            double *clustIdx;
+
+            plhs[4]=mxCreateDoubleMatrix(1,numPoints,mxREAL);
+            clustIdx=(double*)mxGetData(plhs[4]);
+            for(i=0;i<numPoints;i++) {
+                clustIdx[i]=(double)(selClust[i]+1);
+            }
+        }
+    }
+
+    delete[] selClust;
+    delete[] nearestDist;
+    delete[] minCost;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
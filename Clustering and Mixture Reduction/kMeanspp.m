@@ -1,4 +1,4 @@
-function [mu,P,w,cost]=kMeanspp(z,K,maxIter)
+function [mu,P,w,cost,clustIdx]=kMeanspp(z,K,maxIter,pointWeights)
 %%KMEANSPP  Run the k-means++ algorithm for clustering a set of more than K
 %           data points into k clusters. The k-means++ algorithm is the
 %           same as the general k-means algorithm, except a different
@@ -10,17 +10,23 @@ function [mu,P,w,cost]=kMeanspp(z,K,maxIter)
 %         maxIter  The maximum number of iterations to perform for
 %                  clustering. If omitted,
 %                  maxIter=1000;
+%    pointWeights  An optional numPointsX1 vector of nonnegative weights
+%                  of the points. A point with weight 2 is treated the
+%                  same as two points at the same location. If omitted,
+%                  all points have weight 1.
 %
 %OUTPUTS: mu       A zDim X K set of the cluster means. 
 %         P        A zDim X zDim X K set of sample covariance matrices for
 %                  each of the k clusters, where mu(:,n) is the mean of the
 %                  nth cluster.
 %         w        A KX1 vector of weights such that w(n) is the fraction
-%                  of the total original points assigned to the nth
-%                  cluster.
-%         cost     The cost of the k-means assignment. This is the sum of
-%                  the squared distances between the points assigned to a
-%                  cluster and the cluster mean.
+%                  of the total weight of the original points assigned to
+%                  the nth cluster.
+%         cost     The cost of the k-means assignment. This is the
+%                  weighted average of the squared distances between the
+%                  points assigned to a cluster and the cluster mean.
+%        clustIdx  A 1XnumPoints vector of the index of the cluster to
+%                  which each point is assigned.
 %
 %The k-means algorithm is a suboptimal algorithm that tries to find a set
 %of k-means such that the sum of the squared distances from the points to
@@ -34,12 +40,18 @@ function [mu,P,w,cost]=kMeanspp(z,K,maxIter)
 %
 %Note that the k-means algorithm used a randomized initialization, so one
 %will not always get the same results when the function is run twice on the
-%same data. 
+%same data. A cluster to which no points are assigned keeps its previous
+%mean.
+%
+%A compiled version of this function that gives the same results for the
+%same state of the random number generator can be built using the
+%CompileCLibraries function. It avoids most of the point-center distance
+%computations and processes the points in parallel.
 %
 %October 2013 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
-if(nargin<3)
+if(nargin<3||isempty(maxIter))
    maxIter=1000; 
 end
 
@@ -48,22 +60,36 @@ end
 zDim=size(z,1);
 numPoints=size(z,2);
 
+if(nargin<4||isempty(pointWeights))
+    pointWeights=ones(1,numPoints);
+end
+pointWeights=pointWeights(:)';
+
 mu=zeros(zDim,K);
 %Use k-mean++ initialization.
-%The first center is chosen randomly.
-mu(:,1)=z(:,randi([1;numPoints]));
+if(all(pointWeights==pointWeights(1)))
+    %The first center is chosen randomly.
+    mu(:,1)=z(:,randi([1;numPoints]));
+else
+    %The first center is chosen randomly with a probability proportional
+    %to the weights of the points.
+    CMF=cumsum(pointWeights/sum(pointWeights));
+    idx=min(sum(CMF<rand(1))+1,numPoints);
+    mu(:,1)=z(:,idx);
+end
 diff=mu(:,1)*ones(1,numPoints)-z;
 nearestMuDist=sum(diff.*diff,1);%the squared distances from this point.
 
 for k=2:K
     %The points are chosen with a probability equal to the ratio of the
-    %squared distance to the sum of all distances.
-    PMF=nearestMuDist/sum(nearestMuDist);%The PMF from which we will draw.
+    %weighted squared distance to the sum of all weighted distances.
+    PMF=pointWeights.*nearestMuDist;
+    PMF=PMF/sum(PMF);%The PMF from which we will draw.
     CMF=cumsum(PMF);
     
     %We have to find the first element in the CMF that is greater than a
     %random draw; that will be the next center.
-    idx=sum(CMF<rand(1))+1;
+    idx=min(sum(CMF<rand(1))+1,numPoints);
     %idx=randi([1;numPoints]);%For the regular k-means.
     %Set the center and update the nesrest center distances.
     mu(:,k)=z(:,idx);
@@ -93,7 +119,11 @@ while(sum(sum(muPrev~=mu))~=0&&numIter<maxIter)
     muPrev=mu;
     
     for k=1:K
-        mu(:,k)=mean(z(:,selClust==k),2);
+        sel=selClust==k;
+        wSel=sum(pointWeights(sel));
+        if(wSel>0)
+            mu(:,k)=sum(bsxfun(@times,z(:,sel),pointWeights(sel)),2)/wSel;
+        end
     end
     numIter=numIter+1;
 end
@@ -106,16 +136,24 @@ if(nargout>1)
     P=zeros(zDim,zDim,K);
     for k=1:K
         sel=selClust==k;
-        w(k)=sum(sel);
+        w(k)=sum(pointWeights(sel));
 
         zSel=z(:,sel);
 
-        diff=bsxfun(@minus,zSel,mu(:,k));    
+        diff=bsxfun(@times,bsxfun(@minus,zSel,mu(:,k)),sqrt(pointWeights(sel)));
         P(:,:,k)=diff*diff'/w(k);
     end
     w=w/sum(w);
 
-    cost=sum(minCosts)/numPoints;
+    %The costs with respect to the final means.
+    minCosts=zeros(1,numPoints);
+    for k=1:K
+        sel=selClust==k;
+        diff=bsxfun(@minus,z(:,sel),mu(:,k));
+        minCosts(sel)=sum(diff.*diff,1);
+    end
+    cost=sum(pointWeights.*minCosts)/sum(pointWeights);
+    clustIdx=selClust;
 end
 end
 
@@ -35,6 +35,9 @@ function [w,mu,P]=mergeGaussianComp(w,mu,P,clust)
 %merger. The weight of the merged component in the new mixture is the sum
 %of the weights of the components being merged.
 %
+%To merge all of the components of many mixtures at once, the compiled
+%function calcMixtureMomentsBatch can be used.
+%
 %October 2013 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
@@ -31,11 +31,28 @@ ScriptFolder = fileparts(ScriptPath);
 curDir=pwd;
 cd(ScriptFolder)
 
+%Options so that the C++ functions that process batches of independent
+%problems can do so in parallel using OpenMP. The default compiler under
+%Mac OS X does not support OpenMP, so the functions are compiled to run
+%serially there. The code compiles and runs correctly (though serially) if
+%these options are removed.
+if(ismac())
+    OpenMPFlags={};
+elseif(ispc())
+    OpenMPFlags={'COMPFLAGS=$COMPFLAGS /openmp'};
+else
+    OpenMPFlags={'CXXFLAGS=$CXXFLAGS -fopenmp','LDFLAGS=$LDFLAGS -fopenmp'};
+end
+
 %Compile optimization code
 %Compile lineSearch
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./3rd_Party_Code/liblbfgs-master/include','-I./3rd_Party_Code/liblbfgs-master/lib','./Mathematical Functions/Continuous Optimization/lineSearch.c','./3rd_Party_Code/liblbfgs-master/lib/lbfgs.c');
 %Compile quasiNewtonLBFGS
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./3rd_Party_Code/liblbfgs-master/include','-I./3rd_Party_Code/liblbfgs-master/lib','./Mathematical Functions/Continuous Optimization/quasiNewtonLBFGS.c','./3rd_Party_Code/liblbfgs-master/lib/lbfgs.c');
+%Compile quasiNewtonLBFGSNative
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-DLBFGS_STANDARD_ALLOC','-I./','-I./3rd_Party_Code/liblbfgs-master/include','-I./3rd_Party_Code/liblbfgs-master/lib','-I./Mathematical Functions/Shared C++ Code/','-I./Mathematical Functions/Continuous Optimization/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Continuous Optimization/quasiNewtonLBFGSNative.cpp','./Mathematical Functions/Continuous Optimization/Shared C++ Code/LBFGSNativeCPP.cpp','./Mathematical Functions/Continuous Optimization/Shared C++ Code/LBFGSObjectivesCPP.cpp','./Mathematical Functions/Shared C++ Code/matrixFuncsCPP.cpp','./3rd_Party_Code/liblbfgs-master/lib/lbfgs.c');
+%Compile quasiNewtonLBFGSMultiStart
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-DLBFGS_STANDARD_ALLOC','-I./','-I./3rd_Party_Code/liblbfgs-master/include','-I./3rd_Party_Code/liblbfgs-master/lib','-I./Mathematical Functions/Shared C++ Code/','-I./Mathematical Functions/Continuous Optimization/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Continuous Optimization/quasiNewtonLBFGSMultiStart.cpp','./Mathematical Functions/Continuous Optimization/Shared C++ Code/LBFGSMultiStartCPP.cpp','./Mathematical Functions/Continuous Optimization/Shared C++ Code/LBFGSNativeCPP.cpp','./Mathematical Functions/Continuous Optimization/Shared C++ Code/LBFGSObjectivesCPP.cpp','./Mathematical Functions/Shared C++ Code/matrixFuncsCPP.cpp','./3rd_Party_Code/liblbfgs-master/lib/lbfgs.c');
 
 %Compile navigation code
 %Compile indirectGeodeticProb
@@ -64,6 +81,24 @@ mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','./Mathematical Functions/spherHarmonicEvalCPPInt.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicEvalCPP.cpp','./Mathematical Functions/Shared C++ Code/NALegendreCosRatCPP.cpp','./Mathematical Functions/Shared C++ Code/normHelmholtzCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherJacobCPP.cpp');
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','./Mathematical Functions/spherHarmonicCovCPPInt.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicCovCPP.cpp','./Mathematical Functions/Shared C++ Code/normHelmholtzCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp');
 
+%Compile the tracking filters and smoothers.
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Shared C++ Code/','-I./Track Filtering/Shared C++ Code/',OpenMPFlags{:},'./Track Filtering/Batch and Smoothing/KalmanFixedLagSmootherCPPInt.cpp','./Track Filtering/Shared C++ Code/FixedLagSmootherCPP.cpp','./Track Filtering/Shared C++ Code/KalmanFuncsCPP.cpp','./Mathematical Functions/Shared C++ Code/matrixFuncsCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','-I./Track Filtering/Shared C++ Code/',OpenMPFlags{:},'./Track Filtering/Batch and Smoothing/batchLSMultiTrackLM.cpp','./Track Filtering/Shared C++ Code/batchLSLMCPP.cpp','./Track Filtering/Shared C++ Code/measModelCPP.cpp','./Mathematical Functions/Shared C++ Code/matrixFuncsCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Shared C++ Code/','-I./Mathematical Functions/Continuous Optimization/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','-I./Track Filtering/Shared C++ Code/',OpenMPFlags{:},'./Track Filtering/Batch and Smoothing/sensorRegistrationLM.cpp','./Track Filtering/Shared C++ Code/sensorRegistrationCPP.cpp','./Mathematical Functions/Continuous Optimization/Shared C++ Code/sparseLMCPP.cpp','./Track Filtering/Shared C++ Code/measModelCPP.cpp','./Mathematical Functions/Shared C++ Code/matrixFuncsCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','-I./Track Filtering/Shared C++ Code/',OpenMPFlags{:},'./Track Filtering/Performance Prediction/PCRLBBatch.cpp','./Track Filtering/Shared C++ Code/PCRLBCPP.cpp','./Track Filtering/Shared C++ Code/measModelCPP.cpp','./Mathematical Functions/Shared C++ Code/matrixFuncsCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Shared C++ Code/','-I./Dynamic Models/Shared C++ Code/','-I./Track Filtering/Shared C++ Code/',OpenMPFlags{:},'./Track Filtering/State Propagation/CDEKFPredBatch.cpp','./Track Filtering/Shared C++ Code/CDEKFPredCPP.cpp','./Dynamic Models/Shared C++ Code/contTimeDynModelsCPP.cpp','./Mathematical Functions/Shared C++ Code/ODEIntegratorCPP.cpp','./Mathematical Functions/Shared C++ Code/matrixFuncsCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/','-I./Dynamic Models/Shared C++ Code/','-I./Track Filtering/Shared C++ Code/',OpenMPFlags{:},'./Track Filtering/Batch and Smoothing/batchLSMultiTrackNonlinDynLM.cpp','./Track Filtering/Shared C++ Code/batchLSLMCPP.cpp','./Track Filtering/Shared C++ Code/discretizeDynCPP.cpp','./Track Filtering/Shared C++ Code/measModelCPP.cpp','./Dynamic Models/Shared C++ Code/contTimeDynModelsCPP.cpp','./Mathematical Functions/Shared C++ Code/ODEIntegratorCPP.cpp','./Mathematical Functions/Shared C++ Code/orbitDynamicsCPP.cpp','./Mathematical Functions/Shared C++ Code/matrixFuncsCPP.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicEvalCPP.cpp','./Mathematical Functions/Shared C++ Code/NALegendreCosRatCPP.cpp','./Mathematical Functions/Shared C++ Code/normHelmholtzCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp');
+
+%Compile the clustering and mixture reduction code
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Clustering and Mixture Reduction/Shared C++ Code/','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/',OpenMPFlags{:},'./Clustering and Mixture Reduction/RunnalsGaussMixRedBatch.cpp','./Clustering and Mixture Reduction/Shared C++ Code/RunnalsGaussMixRedCPP.cpp','./Container Classes/Shared C++ Code/BinaryHeapOfIndicesCPP.cpp','./Container Classes/Shared C++ Code/kdTreeCPP.cpp','./Mathematical Functions/Shared C++ Code/findFirstMaxCPP.cpp','./Mathematical Functions/Shared C++ Code/matrixFuncsCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Clustering and Mixture Reduction/Shared C++ Code/',OpenMPFlags{:},'./Clustering and Mixture Reduction/kMeanspp.cpp','./Clustering and Mixture Reduction/Shared C++ Code/kMeansCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Clustering and Mixture Reduction/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/',OpenMPFlags{:},'./Clustering and Mixture Reduction/EMAlgGaussClust.cpp','./Clustering and Mixture Reduction/Shared C++ Code/EMGaussClustCPP.cpp','./Mathematical Functions/Shared C++ Code/matrixFuncsCPP.cpp');
+
+%Compile the performance evaluation code
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Performance Evaluation/Shared C++ Code/','-I./Assignment Algorithms/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/',OpenMPFlags{:},'./Performance Evaluation/calcOSPABatch.cpp','./Performance Evaluation/Shared C++ Code/metricFuncsCPP.cpp','./Assignment Algorithms/Shared C++ Code/ShortestPathCPP.cpp','./Mathematical Functions/Shared C++ Code/matrixFuncsCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Performance Evaluation/Shared C++ Code/','-I./Assignment Algorithms/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/',OpenMPFlags{:},'./Performance Evaluation/calcMOSPAErrorBatch.cpp','./Performance Evaluation/Shared C++ Code/metricFuncsCPP.cpp','./Assignment Algorithms/Shared C++ Code/ShortestPathCPP.cpp','./Mathematical Functions/Shared C++ Code/matrixFuncsCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Performance Evaluation/Shared C++ Code/','-I./Assignment Algorithms/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/',OpenMPFlags{:},'./Performance Evaluation/calcNEESBatch.cpp','./Performance Evaluation/Shared C++ Code/metricFuncsCPP.cpp','./Assignment Algorithms/Shared C++ Code/ShortestPathCPP.cpp','./Mathematical Functions/Shared C++ Code/matrixFuncsCPP.cpp');
+
 %Compile the 2D assignment algorithms
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','./Assignment Algorithms/2D Assignment/assign2DByCol.c');
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Combinatorics/Shared C++ Code/','./Assignment Algorithms/Association Probabilities/calc2DAssignmentProbs.cpp','./Mathematical Functions/Combinatorics/Shared C++ Code/getNextComboCPP.cpp','./Mathematical Functions/Combinatorics/Shared C++ Code/permCPP.cpp');
@@ -73,25 +108,57 @@ mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-
 %Compile the k-best 2D assignment algorithm
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Assignment Algorithms/Shared C++ Code/','./Assignment Algorithms/k-Best 2D Assignment/kBest2DAssign.cpp','./Assignment Algorithms/Shared C++ Code/ShortestPathCPP.cpp');
 
+%Compile the track-oriented multiple hypothesis tracker
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Assignment Algorithms/Shared C++ Code/',OpenMPFlags{:},'./Assignment Algorithms/Multiple Hypothesis Tracking/TOMHTCPPInt.cpp','./Assignment Algorithms/Shared C++ Code/TOMHTCPP.cpp','./Assignment Algorithms/Shared C++ Code/ShortestPathCPP.cpp');
+
+%Compile the single-scan measurement update
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Assignment Algorithms/Shared C++ Code/','-I./Mathematical Functions/Combinatorics/Shared C++ Code/','-I./Clustering and Mixture Reduction/Shared C++ Code/','-I./Track Filtering/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/',OpenMPFlags{:},'./Assignment Algorithms/singleScanUpdateBatch.cpp','./Assignment Algorithms/Shared C++ Code/singleScanUpdateCPP.cpp','./Assignment Algorithms/Shared C++ Code/ShortestPathCPP.cpp','./Mathematical Functions/Combinatorics/Shared C++ Code/getNextComboCPP.cpp','./Mathematical Functions/Combinatorics/Shared C++ Code/permCPP.cpp','./Clustering and Mixture Reduction/Shared C++ Code/mixtureMomentsCPP.cpp','./Track Filtering/Shared C++ Code/measModelCPP.cpp','./Mathematical Functions/Shared C++ Code/matrixFuncsCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp');
+
+%Compile the track table, which uses the single-scan measurement update.
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Assignment Algorithms/Shared C++ Code/','-I./Mathematical Functions/Combinatorics/Shared C++ Code/','-I./Clustering and Mixture Reduction/Shared C++ Code/','-I./Track Filtering/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/',OpenMPFlags{:},'./Track Filtering/Track Management/TrackTableCPPInt.cpp','./Track Filtering/Shared C++ Code/TrackTableCPP.cpp','./Track Filtering/Shared C++ Code/KalmanFuncsCPP.cpp','./Assignment Algorithms/Shared C++ Code/singleScanUpdateCPP.cpp','./Assignment Algorithms/Shared C++ Code/ShortestPathCPP.cpp','./Mathematical Functions/Combinatorics/Shared C++ Code/getNextComboCPP.cpp','./Mathematical Functions/Combinatorics/Shared C++ Code/permCPP.cpp','./Clustering and Mixture Reduction/Shared C++ Code/mixtureMomentsCPP.cpp','./Track Filtering/Shared C++ Code/measModelCPP.cpp','./Mathematical Functions/Shared C++ Code/matrixFuncsCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherJacobCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp');
+
 %Compile the containers
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','./Container Classes/metricTreeCPPInt.cpp','./Container Classes/Shared C++ Code/metricTreeCPP.cpp','./Mathematical Functions/Shared C++ Code/findFirstMaxCPP.cpp');
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','./Container Classes/kdTreeCPPInt.cpp','./Container Classes/Shared C++ Code/kdTreeCPP.cpp','./Mathematical Functions/Shared C++ Code/findFirstMaxCPP.cpp');
 
 %Compile the mathematical functions
-mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Shared C++ Code/','./Mathematical Functions/Geometry/turnOrientation.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Geometry/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Geometry/turnOrientation.cpp','./Mathematical Functions/Geometry/Shared C++ Code/geometricPredicatesCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Geometry/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Geometry/orientation3D.cpp','./Mathematical Functions/Geometry/Shared C++ Code/geometricPredicatesCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Geometry/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Geometry/inCircumcircle.cpp','./Mathematical Functions/Geometry/Shared C++ Code/geometricPredicatesCPP.cpp');
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Shared C++ Code/','./Mathematical Functions/exactSignOfSum.cpp');
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Geometry/Shared C++ Code/','./Mathematical Functions/Geometry/pointIsInPolygon.cpp','./Mathematical Functions/Geometry/Shared C++ Code/pointIsInPolygonCPP.cpp');
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Geometry/Shared C++ Code/','./Mathematical Functions/Geometry/twoLineIntersectionPoint2D.cpp','./Mathematical Functions/Geometry/Shared C++ Code/twoLineIntersectionPoint2DCPP.cpp');
-mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Geometry/Shared C++ Code/','./Mathematical Functions/Geometry/signedPolygonArea.cpp','./Mathematical Functions/Geometry/Shared C++ Code/signedPolygonAreaCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Geometry/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Geometry/signedPolygonArea.cpp','./Mathematical Functions/Geometry/Shared C++ Code/signedPolygonAreaCPP.cpp');
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Shared C++ Code/','-I./Mathematical Functions/Geometry/Shared C++ Code/','./Mathematical Functions/Geometry/clipPolygonSH2D.cpp','./Mathematical Functions/Geometry/Shared C++ Code/twoLineIntersectionPoint2DCPP.cpp','./Mathematical Functions/Geometry/Shared C++ Code/signedPolygonAreaCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Geometry/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Geometry/PolygonIndexCPPInt.cpp','./Mathematical Functions/Geometry/Shared C++ Code/PolygonIndexCPP.cpp','./Mathematical Functions/Geometry/Shared C++ Code/pointIsInPolygonCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Geometry/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Geometry/polygonBooleanBatch.cpp','./Mathematical Functions/Geometry/Shared C++ Code/polygonBooleanCPP.cpp','./Mathematical Functions/Geometry/Shared C++ Code/geometricPredicatesCPP.cpp','./Mathematical Functions/Geometry/Shared C++ Code/pointIsInPolygonCPP.cpp','./Mathematical Functions/Geometry/Shared C++ Code/signedPolygonAreaCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Geometry/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Geometry/convexHull2DBatch.cpp','./Mathematical Functions/Geometry/Shared C++ Code/convexHull2DCPP.cpp','./Mathematical Functions/Geometry/Shared C++ Code/geometricPredicatesCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Geometry/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Geometry/polygonIsConvexBatch.cpp','./Mathematical Functions/Geometry/Shared C++ Code/convexHull2DCPP.cpp','./Mathematical Functions/Geometry/Shared C++ Code/geometricPredicatesCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Geometry/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Geometry/segmentIntersections2D.cpp','./Mathematical Functions/Geometry/Shared C++ Code/segmentIntersectionsCPP.cpp','./Mathematical Functions/Geometry/Shared C++ Code/geometricPredicatesCPP.cpp');
 
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Combinatorics/Shared C++ Code/','./Mathematical Functions/Combinatorics/perm.cpp','./Mathematical Functions/Combinatorics/Shared C++ Code/getNextComboCPP.cpp','./Mathematical Functions/Combinatorics/Shared C++ Code/permCPP.cpp');
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Combinatorics/Shared C++ Code/','./Mathematical Functions/Combinatorics/getNextCombo.cpp','./Mathematical Functions/Combinatorics/Shared C++ Code/getNextComboCPP.cpp');
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Combinatorics/Shared C++ Code/','./Mathematical Functions/Combinatorics/getNextGrayCode.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Combinatorics/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Combinatorics/getCombinationBlock.cpp','./Mathematical Functions/Combinatorics/Shared C++ Code/combinatorialRankCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Combinatorics/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Combinatorics/getPermutationBlock.cpp','./Mathematical Functions/Combinatorics/Shared C++ Code/combinatorialRankCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./',OpenMPFlags{:},'./Mathematical Functions/Combinatorics/getGrayCodeBlock.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Combinatorics/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Combinatorics/getSetPartitionBlock.cpp','./Mathematical Functions/Combinatorics/Shared C++ Code/combinatorialRankCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Combinatorics/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Combinatorics/rankCombination.cpp','./Mathematical Functions/Combinatorics/Shared C++ Code/combinatorialRankCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Combinatorics/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Combinatorics/unrankCombination.cpp','./Mathematical Functions/Combinatorics/Shared C++ Code/combinatorialRankCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Combinatorics/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Combinatorics/unrankPermutation.cpp','./Mathematical Functions/Combinatorics/Shared C++ Code/combinatorialRankCPP.cpp');
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Shared C++ Code/','-I./Container Classes/Shared C++ Code/','./Mathematical Functions/findFirstMax.cpp','./Mathematical Functions/Shared C++ Code/findFirstMaxCPP.cpp')
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Shared C Code/','./Mathematical Functions/binSearch.c','./Mathematical Functions/Shared C Code/binSearchC.c')
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Assignment Algorithms/Shared C++ Code/','-I./Mathematical Functions/MMOSPAApprox/Shared C++ Code/','./Mathematical Functions/MMOSPAApprox/MMOSPAApprox.cpp','./Mathematical Functions/MMOSPAApprox/Shared C++ Code/MMOSPAApproxCPP.cpp','./Assignment Algorithms/Shared C++ Code/ShortestPathCPP.cpp');
 mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','./Mathematical Functions/wrapRange.cpp','./Mathematical Functions/Shared C++ Code/wrapRangeCPP.cpp')
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/','-I./Coordinate Systems/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Differential Equations/ODEAdaptiveBatchAtTimes.cpp','./Mathematical Functions/Shared C++ Code/ODEIntegratorCPP.cpp','./Mathematical Functions/Shared C++ Code/orbitDynamicsCPP.cpp','./Mathematical Functions/Shared C++ Code/matrixFuncsCPP.cpp','./Mathematical Functions/Shared C++ Code/spherHarmonicEvalCPP.cpp','./Mathematical Functions/Shared C++ Code/NALegendreCosRatCPP.cpp','./Mathematical Functions/Shared C++ Code/normHelmholtzCPP.cpp','./Coordinate Systems/Shared C++ Code/spher2CartCPP.cpp','./Coordinate Systems/Shared C++ Code/calcSpherJacobCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/RiccatiSolveBatch.cpp','./Mathematical Functions/Shared C++ Code/RiccatiSolveCPP.cpp','./Mathematical Functions/Shared C++ Code/matrixFuncsCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Clustering and Mixture Reduction/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/calcMixtureMomentsBatch.cpp','./Clustering and Mixture Reduction/Shared C++ Code/mixtureMomentsCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Graph Algorithms/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Graph Algorithms/ViterbiGrid.cpp','./Mathematical Functions/Graph Algorithms/Shared C++ Code/ViterbiGridCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Graph Algorithms/Shared C++ Code/','-I./Container Classes/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Graph Algorithms/DijkstraAlgSparse.cpp','./Mathematical Functions/Graph Algorithms/Shared C++ Code/CSRGraphCPP.cpp','./Container Classes/Shared C++ Code/BinaryHeapOfIndicesCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Graph Algorithms/Shared C++ Code/','-I./Container Classes/Shared C++ Code/','./Mathematical Functions/Graph Algorithms/BellmanFordAlgSparse.cpp','./Mathematical Functions/Graph Algorithms/Shared C++ Code/CSRGraphCPP.cpp','./Container Classes/Shared C++ Code/BinaryHeapOfIndicesCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Graph Algorithms/Shared C++ Code/','-I./Container Classes/Shared C++ Code/','./Mathematical Functions/Graph Algorithms/findStronglyConnectedSubgraphsSparse.cpp','./Mathematical Functions/Graph Algorithms/Shared C++ Code/CSRGraphCPP.cpp','./Container Classes/Shared C++ Code/BinaryHeapOfIndicesCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Graph Algorithms/Shared C++ Code/','-I./Container Classes/Shared C++ Code/','-I./Mathematical Functions/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Graph Algorithms/minSpanningTreeEuclid.cpp','./Mathematical Functions/Graph Algorithms/Shared C++ Code/EuclideanMSTCPP.cpp','./Mathematical Functions/Graph Algorithms/Shared C++ Code/CSRGraphCPP.cpp','./Container Classes/Shared C++ Code/BinaryHeapOfIndicesCPP.cpp','./Container Classes/Shared C++ Code/kdTreeCPP.cpp','./Mathematical Functions/Shared C++ Code/findFirstMaxCPP.cpp');
+mex('-v','-largeArrayDims','-U__STDC_UTF_16__','-outdir','./0_Compiled_Code/','-I./','-I./Mathematical Functions/Graph Algorithms/Shared C++ Code/',OpenMPFlags{:},'./Mathematical Functions/Graph Algorithms/linProgRevisedSimplexSparse.cpp','./Mathematical Functions/Graph Algorithms/Shared C++ Code/sparseSimplexCPP.cpp');
 
 %If compiling under Windows, the compile environment must be set up so
 %that external libraries can be compiled and linked. The settings that
@@ -0,0 +1,183 @@
+/**BINARYHEAPOFINDICESCPP The implementation of a C++ binary min-heap of
+ *                indices where the key of an index in the heap can be
+ *                changed. See the comments in BinaryHeapOfIndicesCPP.hpp
+ *                for more information.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "BinaryHeapOfIndicesCPP.hpp"
+
+BinaryHeapOfIndicesCPP::BinaryHeapOfIndicesCPP() {
+    buffer=NULL;
+    maxIdx=0;
+    numInHeap=0;
+}
+
+BinaryHeapOfIndicesCPP::BinaryHeapOfIndicesCPP(const size_t maxIdxDes) {
+    buffer=NULL;
+    this->init(maxIdxDes);
+}
+
+void BinaryHeapOfIndicesCPP::init(const size_t maxIdxDes) {
+    char *basePtr;
+
+    if(buffer!=NULL) {
+        delete[] buffer;
+    }
+
+    maxIdx=maxIdxDes;
+    buffer=new char[(sizeof(double)+sizeof(size_t)+sizeof(ptrdiff_t))*maxIdx];
+    basePtr=buffer;
+    keys=(double*)basePtr;
+    basePtr+=sizeof(double)*maxIdx;
+    heapArray=(size_t*)basePtr;
+    basePtr+=sizeof(size_t)*maxIdx;
+    position=(ptrdiff_t*)basePtr;
+
+    numInHeap=0;
+    this->clear();
+}
+
+void BinaryHeapOfIndicesCPP::clear() {
+    size_t i;
+
+    for(i=0;i<maxIdx;i++) {
+        position[i]=-1;
+    }
+    numInHeap=0;
+}
+
+void BinaryHeapOfIndicesCPP::insert(const double key,const size_t idx) {
+/*INSERT Insert an index that is not in the heap with the given key.
+ */
+    keys[idx]=key;
+    heapArray[numInHeap]=idx;
+    position[idx]=(ptrdiff_t)numInHeap;
+    numInHeap++;
+    this->percolateUp(numInHeap-1);
+}
+
+void BinaryHeapOfIndicesCPP::changeIndexedKey(const double newKey,const size_t idx) {
+    const double oldKey=keys[idx];
+
+    if(position[idx]<0) {
+        this->insert(newKey,idx);
+        return;
+    }
+
+    keys[idx]=newKey;
+    if(newKey<oldKey) {
+        this->percolateUp((size_t)position[idx]);
+    } else {
+        this->percolateDown((size_t)position[idx]);
+    }
+}
+
+void BinaryHeapOfIndicesCPP::deleteIndex(const size_t idx) {
+/*DELETEINDEX Remove the given index from the heap if it is in the heap.
+ *            The last element of the heap is moved into the hole, from
+ *            where it might have to move either up or down.
+ */
+    const ptrdiff_t hole=position[idx];
+    size_t lastIdx;
+
+    if(hole<0) {
+        return;
+    }
+
+    position[idx]=-1;
+    numInHeap--;
+    if((size_t)hole==numInHeap) {
+        return;
+    }
+
+    lastIdx=heapArray[numInHeap];
+    heapArray[hole]=lastIdx;
+    position[lastIdx]=hole;
+    this->percolateUp((size_t)hole);
+    this->percolateDown((size_t)position[lastIdx]);
+}
+
+size_t BinaryHeapOfIndicesCPP::deleteTop() {
+    const size_t topIdx=heapArray[0];
+
+    this->deleteIndex(topIdx);
+    return topIdx;
+}
+
+bool BinaryHeapOfIndicesCPP::isLess(const size_t idx1,const size_t idx2) const {
+    return keys[idx1]<keys[idx2]||(keys[idx1]==keys[idx2]&&idx1<idx2);
+}
+
+void BinaryHeapOfIndicesCPP::percolateUp(size_t hole) {
+    const size_t idx=heapArray[hole];
+
+    while(hole>0) {
+        const size_t parent=(hole-1)/2;
+
+        if(!this->isLess(idx,heapArray[parent])) {
+            break;
+        }
+
+        heapArray[hole]=heapArray[parent];
+        position[heapArray[hole]]=(ptrdiff_t)hole;
+        hole=parent;
+    }
+
+    heapArray[hole]=idx;
+    position[idx]=(ptrdiff_t)hole;
+}
+
+void BinaryHeapOfIndicesCPP::percolateDown(size_t hole) {
+    const size_t idx=heapArray[hole];
+
+    for(;;) {
+        size_t child=2*hole+1;
+
+        if(child>=numInHeap) {
+            break;
+        }
+
+        //Choose the smaller of the two children.
+        if(child+1<numInHeap&&this->isLess(heapArray[child+1],heapArray[child])) {
+            child++;
+        }
+
+        if(!this->isLess(heapArray[child],idx)) {
+            break;
+        }
+
+        heapArray[hole]=heapArray[child];
+        position[heapArray[hole]]=(ptrdiff_t)hole;
+        hole=child;
+    }
+
+    heapArray[hole]=idx;
+    position[idx]=(ptrdiff_t)hole;
+}
+
+BinaryHeapOfIndicesCPP::~BinaryHeapOfIndicesCPP() {
+    if(buffer!=NULL) {
+        delete[] buffer;
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,78 @@
+/**BINARYHEAPOFINDICESCPP A C++ binary min-heap whose values are the
+ *                indices 0 to maxIdx-1, each of which can be in the heap at
+ *                most once. As in the Matlab class BinaryHeapOfIndices,
+ *                the position of each index in the heap is stored, so that
+ *                the key associated with a given index can be changed or
+ *                the index removed from the heap in O(log(n)) time. This
+ *                is useful for greedy algorithms that repeatedly take the
+ *                best item and then update the keys of a few others, such
+ *                as Dijkstra's algorithm or greedy mixture reduction. Ties
+ *                in the keys are broken in favor of the lower index so
+ *                that results do not depend on the order of insertion.
+ *
+ *The methods are based on the implementation described in Chapter 6.4 of
+ *M.A.Weiss, Data Structures and Algorithm Analysis in C++, 2nd ed.
+ *Reading, MA: Addison-Wesley, 1999.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef BINARYHEAPOFINDICESCPP
+#define BINARYHEAPOFINDICESCPP
+#include <stddef.h>
+
+class BinaryHeapOfIndicesCPP {
+public:
+    size_t maxIdx;//The number of possible index values.
+    size_t numInHeap;
+
+    BinaryHeapOfIndicesCPP();
+    BinaryHeapOfIndicesCPP(const size_t maxIdxDes);
+    void init(const size_t maxIdxDes);
+    void clear();
+    bool isEmpty() const {return numInHeap==0;}
+    bool indexIsInHeap(const size_t idx) const {return position[idx]>=0;}
+    double getKey(const size_t idx) const {return keys[idx];}
+    //The index and the key of the top of the heap. The heap must not be
+    //empty.
+    size_t getTopIdx() const {return heapArray[0];}
+    double getTopKey() const {return keys[heapArray[0]];}
+    void insert(const double key,const size_t idx);
+    //If idx is not in the heap, it is inserted.
+    void changeIndexedKey(const double newKey,const size_t idx);
+    void deleteIndex(const size_t idx);
+    size_t deleteTop();
+    ~BinaryHeapOfIndicesCPP();
+private:
+    char *buffer;
+    double *keys;//The key associated with each index.
+    size_t *heapArray;//The indices in heap order.
+    ptrdiff_t *position;//The position of each index in heapArray or -1.
+
+    bool isLess(const size_t idx1,const size_t idx2) const;
+    void percolateUp(size_t hole);
+    void percolateDown(size_t hole);
+    //Copying is not allowed, because the buffer would be freed twice.
+    BinaryHeapOfIndicesCPP(const BinaryHeapOfIndicesCPP &);
+    BinaryHeapOfIndicesCPP &operator=(const BinaryHeapOfIndicesCPP &);
+};
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
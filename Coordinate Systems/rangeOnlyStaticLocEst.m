@@ -42,6 +42,11 @@ function [xEst,PTaylor,PCRLB]=rangeOnlyStaticLocEst(rBi,zLoc1,zLoc2,RCov)
 %also derived. The PCRLB covariance estimate is standard assuming additive
 %Gaussian noise. 
 %
+%The least-squares cost function of the localization problem can have
+%multiple local minima. The estimate can be refined by searching for its
+%global minimum using quasiNewtonLBFGSMultiStart with the 'bistaticRange'
+%objective function.
+%
 %October 2013 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
@@ -0,0 +1,206 @@
+/*CONTTIMEDYNMODELSCPP C++ implementations of the drift functions of
+ *                     continuous-time dynamic models along with their
+ *                     analytic Jacobians. The models are the same as in
+ *                     the Matlab functions aGaussMarkov, aPoly,
+ *                     aCoordTurn2D and aPolarCoordTurn2D, where the
+ *                     references and the meanings of the parameters are
+ *                     given. None of the models depends on time, so the
+ *                     time derivatives of the drift functions are zero.
+ *
+ *As in the Matlab functions, when the speed is zero in the coordinated
+ *turn models, the turn rate implied by a transversal acceleration and the
+ *linear acceleration vector in the Cartesian model are set to zero. The
+ *corresponding elements of the Jacobian are also zero.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+**/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For fill_n
+#include <algorithm>
+//For sqrt, sin and cos
+#include <math.h>
+#include "dynModelFuncs.hpp"
+
+using namespace std;
+
+void GaussMarkovDynamicsCPP::f(double *dxdt,const double *x,const double t) const {
+    const size_t numLower=xDim-numDim;
+    size_t i;
+
+    //All but the highest-order moment are just integrated.
+    for(i=0;i<numLower;i++) {
+        dxdt[i]=x[i+numDim];
+    }
+
+    //The highest-order moment decays with the time constant.
+    for(i=numLower;i<xDim;i++) {
+        dxdt[i]=-x[i]/tau;
+    }
+}
+
+void GaussMarkovDynamicsCPP::jacobian(double *J,double *dfdt,const double *x,const double t,double *scratch) const {
+    const size_t numLower=xDim-numDim;
+    size_t i;
+
+    fill_n(J,xDim*xDim,0.0);
+    fill_n(dfdt,xDim,0.0);
+
+    for(i=0;i<numLower;i++) {
+        J[i+(i+numDim)*xDim]=1;
+    }
+
+    for(i=numLower;i<xDim;i++) {
+        J[i+i*xDim]=-1/tau;
+    }
+}
+
+void CoordTurn2DDynamicsCPP::f(double *dxdt,const double *x,const double t) const {
+    const double xDot=x[2];
+    const double yDot=x[3];
+    const double v=sqrt(xDot*xDot+yDot*yDot);
+    double omega;
+
+    if(isTransAccel) {
+        omega=v>0?x[4]/v:0;
+    } else {
+        omega=x[4];
+    }
+
+    dxdt[0]=xDot;
+    dxdt[1]=yDot;
+    dxdt[2]=-omega*yDot;
+    dxdt[3]=omega*xDot;
+    dxdt[4]=-x[4]/tauTurn;
+
+    if(xDim==6) {
+        const double al=x[5];
+
+        if(v>0) {
+            dxdt[2]+=xDot/v*al;
+            dxdt[3]+=yDot/v*al;
+        }
+        dxdt[5]=-al/tauLinAccel;
+    }
+}
+
+void CoordTurn2DDynamicsCPP::jacobian(double *J,double *dfdt,const double *x,const double t,double *scratch) const {
+    const double xDot=x[2];
+    const double yDot=x[3];
+    const double v=sqrt(xDot*xDot+yDot*yDot);
+    const double v3=v*v*v;
+
+    fill_n(J,xDim*xDim,0.0);
+    fill_n(dfdt,xDim,0.0);
+
+    //The derivatives of the position components with respect to the
+    //velocity.
+    J[0+2*xDim]=1;
+    J[1+3*xDim]=1;
+
+    if(isTransAccel) {
+        if(v>0) {
+            const double at=x[4];
+
+            //The velocity derivatives are -at*yDot/v and at*xDot/v.
+            J[2+2*xDim]=at*xDot*yDot/v3;
+            J[2+3*xDim]=-at*xDot*xDot/v3;
+            J[2+4*xDim]=-yDot/v;
+            J[3+2*xDim]=at*yDot*yDot/v3;
+            J[3+3*xDim]=-at*xDot*yDot/v3;
+            J[3+4*xDim]=xDot/v;
+        }
+    } else {
+        const double omega=x[4];
+
+        J[2+3*xDim]=-omega;
+        J[2+4*xDim]=-yDot;
+        J[3+2*xDim]=omega;
+        J[3+4*xDim]=xDot;
+    }
+    J[4+4*xDim]=-1/tauTurn;
+
+    if(xDim==6) {
+        if(v>0) {
+            const double al=x[5];
+
+            //The linear acceleration terms are al*xDot/v and al*yDot/v.
+            J[2+2*xDim]+=al*yDot*yDot/v3;
+            J[2+3*xDim]-=al*xDot*yDot/v3;
+            J[2+5*xDim]=xDot/v;
+            J[3+2*xDim]-=al*xDot*yDot/v3;
+            J[3+3*xDim]+=al*xDot*xDot/v3;
+            J[3+5*xDim]=yDot/v;
+        }
+        J[5+5*xDim]=-1/tauLinAccel;
+    }
+}
+
+void PolarCoordTurn2DDynamicsCPP::f(double *dxdt,const double *x,const double t) const {
+    const double theta=x[2];
+    const double v=x[3];
+
+    dxdt[0]=v*cos(theta);
+    dxdt[1]=v*sin(theta);
+    if(isTransAccel) {
+        dxdt[2]=v!=0?x[4]/v:0;
+    } else {
+        dxdt[2]=x[4];
+    }
+    dxdt[4]=-x[4]/tauTurn;
+
+    if(xDim==6) {
+        dxdt[3]=x[5];
+        dxdt[5]=-x[5]/tauLinAccel;
+    } else {
+        dxdt[3]=0;
+    }
+}
+
+void PolarCoordTurn2DDynamicsCPP::jacobian(double *J,double *dfdt,const double *x,const double t,double *scratch) const {
+    const double theta=x[2];
+    const double v=x[3];
+    const double cosTheta=cos(theta);
+    const double sinTheta=sin(theta);
+
+    fill_n(J,xDim*xDim,0.0);
+    fill_n(dfdt,xDim,0.0);
+
+    J[0+2*xDim]=-v*sinTheta;
+    J[0+3*xDim]=cosTheta;
+    J[1+2*xDim]=v*cosTheta;
+    J[1+3*xDim]=sinTheta;
+
+    if(isTransAccel) {
+        if(v!=0) {
+            J[2+3*xDim]=-x[4]/(v*v);
+            J[2+4*xDim]=1/v;
+        }
+    } else {
+        J[2+4*xDim]=1;
+    }
+    J[4+4*xDim]=-1/tauTurn;
+
+    if(xDim==6) {
+        J[3+5*xDim]=1;
+        J[5+5*xDim]=-1/tauLinAccel;
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
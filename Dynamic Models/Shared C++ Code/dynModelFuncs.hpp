@@ -0,0 +1,85 @@
+/**DYNMODELFUNCS A header file for C++ implementations of continuous-time
+ *              dynamic models. The drift functions of the models are
+ *              implemented as classes derived from ODEDynamicsCPP with
+ *              analytic Jacobians so that they can be integrated with the
+ *              functions in ODEFuncs.hpp and used for covariance
+ *              propagation. See the file contTimeDynModelsCPP.cpp for more
+ *              details on the models, which correspond to Matlab functions
+ *              in the Continuous Time folder.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef DYNMODELFUNCS
+#define DYNMODELFUNCS
+#include <stddef.h>
+#include "ODEFuncs.hpp"
+
+/**The GaussMarkovDynamicsCPP class implements the drift function of the
+ * Matlab function aGaussMarkov for a Gauss-Markov process of the given
+ * order in numDim dimensions with time constant tau. If tau is infinite,
+ * then this is the drift function aPoly of the linear motion model.
+ **/
+class GaussMarkovDynamicsCPP : public ODEDynamicsCPP {
+public:
+    size_t numDim;
+    double tau;
+
+    GaussMarkovDynamicsCPP(const size_t xDimDes,const size_t numDimDes,const double tauDes) : ODEDynamicsCPP(xDimDes), numDim(numDimDes), tau(tauDes) {}
+    void f(double *dxdt,const double *x,const double t) const;
+    void jacobian(double *J,double *dfdt,const double *x,const double t,double *scratch) const;
+};
+
+/**The CoordTurn2DDynamicsCPP class implements the drift function of the
+ * Matlab function aCoordTurn2D with a 5D state (no linear acceleration) or
+ * a 6D state (with a linear acceleration). If isTransAccel is true, then
+ * the turn is specified in terms of a transversal acceleration rather than
+ * a turn rate.
+ **/
+class CoordTurn2DDynamicsCPP : public ODEDynamicsCPP {
+public:
+    bool isTransAccel;
+    double tauTurn;
+    double tauLinAccel;
+
+    CoordTurn2DDynamicsCPP(const size_t xDimDes,const bool isTransAccelDes,const double tauTurnDes,const double tauLinAccelDes) : ODEDynamicsCPP(xDimDes), isTransAccel(isTransAccelDes), tauTurn(tauTurnDes), tauLinAccel(tauLinAccelDes) {}
+    void f(double *dxdt,const double *x,const double t) const;
+    void jacobian(double *J,double *dfdt,const double *x,const double t,double *scratch) const;
+};
+
+/**The PolarCoordTurn2DDynamicsCPP class implements the drift function of
+ * the Matlab function aPolarCoordTurn2D, where the velocity is expressed
+ * as a heading and a speed. The state is 5D or 6D as in
+ * CoordTurn2DDynamicsCPP.
+ **/
+class PolarCoordTurn2DDynamicsCPP : public ODEDynamicsCPP {
+public:
+    bool isTransAccel;
+    double tauTurn;
+    double tauLinAccel;
+
+    PolarCoordTurn2DDynamicsCPP(const size_t xDimDes,const bool isTransAccelDes,const double tauTurnDes,const double tauLinAccelDes) : ODEDynamicsCPP(xDimDes), isTransAccel(isTransAccelDes), tauTurn(tauTurnDes), tauLinAccel(tauLinAccelDes) {}
+    void f(double *dxdt,const double *x,const double t) const;
+    void jacobian(double *J,double *dfdt,const double *x,const double t,double *scratch) const;
+};
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
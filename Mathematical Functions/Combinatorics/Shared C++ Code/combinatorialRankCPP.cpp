@@ -0,0 +1,340 @@
+/**COMBINATORIALRANKCPP C++ functions for ranking, unranking and stepping
+ *                through combinations, permutations and set partitions.
+ *                Unranking the first element of each range of a long
+ *                sequence and then stepping through the range makes it
+ *                possible to enumerate the ranges independently, for
+ *                example in parallel.
+ *
+ *All counts are size_t values. Counts that are too large to be represented
+ *saturate at the largest size_t value, so ranks must be less than that.
+ *
+ *The functions in the file are:
+ *void binomialTableCPP(size_t *binomTable,const size_t n,const size_t m)
+ *-To fill the (n+1)X(m+1) array binomTable, stored by column, with the
+ *binomial coefficients, so binomTable[a+(n+1)*b] is binomial(a,b) for
+ *0<=a<=n and 0<=b<=m. The table is made from Pascal's triangle, so the
+ *values are exact unless they saturate.
+ *
+ *size_t binomialCPP(const size_t n,const size_t k)
+ *-To get the binomial coefficient binomial(n,k) without a table using
+ *O(min(k,n-k)) operations. Common factors are divided out before each
+ *multiplication, so the value is exact unless it saturates.
+ *
+ *size_t rankCombinationCPP(const size_t *combo,const size_t m)
+ *-To get the rank of the combination of m elements in combo, which must be
+ *in increasing order. The binomial coefficients are found using
+ *binomialCPP, so no table that grows with the largest element is needed.
+ *The ranking is the same as in the Matlab function rankCombination, which
+ *is the combinatorial number system of Chapter 7.2.1.3 of [1].
+ *
+ *void unrankCombinationCPP(size_t *combo,size_t rank,const size_t n,
+ *                          const size_t m,const size_t *binomTable)
+ *-To put the combination of m of n elements of the given rank in combo in
+ *increasing order, as in the Matlab function unrankCombination. The rank
+ *must be less than binomial(n,m).
+ *
+ *bool getNextColexComboCPP(size_t *combo,const size_t n,const size_t m)
+ *-To change combo into the combination with the next rank, returning true
+ *if combo was the last combination, in which case it is not changed. This
+ *is the colexicographic order of Chapter 7.2.1.3 of [1], which is not the
+ *order used by getNextComboCPP.
+ *
+ *void factorialTableCPP(size_t *factTable,const size_t n)
+ *-To fill the length n+1 array factTable with the factorials of 0 to n.
+ *
+ *void unrankPermutationCPP(size_t *perm,size_t rank,const size_t n,
+ *                          const size_t *factTable,size_t *buffer)
+ *-To put the permutation of the values 0 to n-1 of the given rank in
+ *lexicographic order in perm, as in the Matlab function unrankPermutation
+ *except that the values start from 0. factTable comes from
+ *factorialTableCPP and buffer must have space for n elements. The next
+ *permutation in the sequence can be found using std::next_permutation.
+ *
+ *void setPartitionTableCPP(size_t *numCompletions,const size_t n)
+ *-To fill the nX(n+2) array numCompletions, stored by column, so that
+ *numCompletions[r+n*k] is the number of ways that the last r elements of
+ *a set partition can be assigned if the first n-r elements use k classes.
+ *numCompletions[n-1+n*1] is the total number of set partitions, the Bell
+ *number of n. n must be positive.
+ *
+ *void unrankSetPartitionCPP(size_t *q,size_t *p,size_t &nc,size_t rank,
+ *                           const size_t n,const size_t *numCompletions)
+ *-To put the set partition of the given rank into the length n arrays q
+ *and p and into nc, which are the same as in the Matlab function
+ *getNextSetPartition, except that p is always of length n and the unused
+ *elements are zero. The classes in q start from 1. The set partitions are
+ *ranked in the order that getNextSetPartition produces them, which is the
+ *lexicographic order of q. numCompletions comes from setPartitionTableCPP.
+ *
+ *bool getNextSetPartitionCPP(size_t *q,size_t *p,size_t &nc,const size_t n)
+ *-To change q, p and nc into the next set partition, returning true if
+ *the last set partition was passed, in which case they are not changed.
+ *This is algorithm NEXEQU in Chapter 11 of [2], as in
+ *getNextSetPartition.
+ *
+ *REFERENCES:
+ *[1] D. E. Knuth, The Art of Computer Programming. Vol. 4, Fascicle 3:
+ *    Generating all Combinations and Partitions, Upper Saddle River, NJ:
+ *    Addison-Wesley, 2009.
+ *[2] A. Nijenhuis and H. S. Wilf, Combinatorial Algorithms for Computers
+ *    and Calculators, 2nd ed. New York: Academic press, 1978.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For numeric_limits
+#include <limits>
+#include "combinatorialRankCPP.hpp"
+
+using namespace std;
+
+//Prototypes for the helper functions.
+size_t saturatingAdd(const size_t a,const size_t b);
+size_t saturatingMult(const size_t a,const size_t b);
+size_t greatestCommonDivisor(size_t a,size_t b);
+
+void binomialTableCPP(size_t *binomTable,const size_t n,const size_t m) {
+    const size_t numRow=n+1;
+    size_t a, b;
+
+    for(a=0;a<=n;a++) {
+        binomTable[a]=1;
+        for(b=1;b<=m;b++) {
+            if(a==0) {
+                binomTable[a+numRow*b]=0;
+            } else {
+                binomTable[a+numRow*b]=saturatingAdd(binomTable[a-1+numRow*(b-1)],binomTable[a-1+numRow*b]);
+            }
+        }
+    }
+}
+
+size_t binomialCPP(const size_t n,const size_t k) {
+    const size_t maxVal=numeric_limits<size_t>::max();
+    size_t kMin, val, i;
+
+    if(k>n) {
+        return 0;
+    }
+    kMin=k<n-k?k:n-k;
+
+    //binomial(n-kMin+i,i) is built up for i=1 to kMin. Each value is
+    //an integer and they are increasing, so once a value saturates, so
+    //does the result. Since val*(n-kMin+i) is divisible by i, the part of
+    //i that does not divide val divides n-kMin+i.
+    val=1;
+    for(i=1;i<=kMin;i++) {
+        const size_t g=greatestCommonDivisor(val,i);
+
+        val=saturatingMult(val/g,(n-kMin+i)/(i/g));
+        if(val==maxVal) {
+            return maxVal;
+        }
+    }
+
+    return val;
+}
+
+size_t rankCombinationCPP(const size_t *combo,const size_t m) {
+    size_t rank=0;
+    size_t i;
+
+    for(i=0;i<m;i++) {
+        rank=saturatingAdd(rank,binomialCPP(combo[i],i+1));
+    }
+
+    return rank;
+}
+
+void unrankCombinationCPP(size_t *combo,size_t rank,const size_t n,const size_t m,const size_t *binomTable) {
+    size_t cap=n;
+    size_t i;
+
+    //Going from the most significant element down, the largest value
+    //whose binomial coefficient does not exceed what remains of the rank is
+    //chosen. binomial(i-1,i) is zero, so this always stops by i-1.
+    for(i=m;i>0;i--) {
+        do {
+            cap--;
+        } while(binomTable[cap+(n+1)*i]>rank);
+
+        combo[i-1]=cap;
+        rank-=binomTable[cap+(n+1)*i];
+    }
+}
+
+bool getNextColexComboCPP(size_t *combo,const size_t n,const size_t m) {
+    size_t j, i;
+
+    //The lowest element that can be incremented without reaching the
+    //element after it is incremented and the elements below it are reset.
+    for(j=0;j<m;j++) {
+        const size_t limit=j+1<m?combo[j+1]:n;
+
+        if(combo[j]+1<limit) {
+            combo[j]++;
+            for(i=0;i<j;i++) {
+                combo[i]=i;
+            }
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void factorialTableCPP(size_t *factTable,const size_t n) {
+    size_t i;
+
+    factTable[0]=1;
+    for(i=1;i<=n;i++) {
+        factTable[i]=saturatingMult(factTable[i-1],i);
+    }
+}
+
+void unrankPermutationCPP(size_t *perm,size_t rank,const size_t n,const size_t *factTable,size_t *buffer) {
+    size_t i, j;
+
+    //buffer holds the values that have not been used in increasing order.
+    for(i=0;i<n;i++) {
+        buffer[i]=i;
+    }
+
+    for(i=0;i<n;i++) {
+        const size_t f=factTable[n-i-1];
+        const size_t k=rank/f;
+
+        rank-=k*f;
+        perm[i]=buffer[k];
+        for(j=k;j+1<n-i;j++) {
+            buffer[j]=buffer[j+1];
+        }
+    }
+}
+
+void setPartitionTableCPP(size_t *numCompletions,const size_t n) {
+    size_t r, k;
+
+    for(k=0;k<n+2;k++) {
+        numCompletions[n*k]=1;
+    }
+
+    //An element can be put in any of the k existing classes or start a new
+    //one.
+    for(r=1;r<n;r++) {
+        numCompletions[r]=0;
+        numCompletions[r+n*(n+1)]=0;
+        for(k=1;k<=n;k++) {
+            numCompletions[r+n*k]=saturatingAdd(saturatingMult(k,numCompletions[r-1+n*k]),numCompletions[r-1+n*(k+1)]);
+        }
+    }
+}
+
+void unrankSetPartitionCPP(size_t *q,size_t *p,size_t &nc,size_t rank,const size_t n,const size_t *numCompletions) {
+    size_t i, c;
+
+    for(i=0;i<n;i++) {
+        p[i]=0;
+    }
+
+    q[0]=1;
+    p[0]=1;
+    nc=1;
+    for(i=1;i<n;i++) {
+        const size_t r=n-1-i;
+        const size_t numPerClass=numCompletions[r+n*nc];
+
+        //Each existing class leads to the same number of set partitions.
+        //Otherwise, a new class is started.
+        c=rank/numPerClass;
+        if(c<nc) {
+            rank-=c*numPerClass;
+        } else {
+            rank-=nc*numPerClass;
+            c=nc;
+            nc++;
+        }
+
+        q[i]=c+1;
+        p[c]++;
+    }
+}
+
+bool getNextSetPartitionCPP(size_t *q,size_t *p,size_t &nc,const size_t n) {
+    size_t m, L;
+
+    if(nc==n) {
+        return true;
+    }
+
+    //Step B.
+    m=n;
+
+    //Step C.
+    while(true) {
+        L=q[m-1];
+        if(p[L-1]!=1) {
+            break;
+        }
+        q[m-1]=1;
+        m--;
+    }
+
+    //Step D.
+    nc=nc+m-n;
+    p[0]+=n-m;
+    if(L==nc) {
+        nc++;
+        p[nc-1]=0;
+    }
+
+    //Step E.
+    q[m-1]=L+1;
+    p[L-1]--;
+    p[L]++;
+
+    return false;
+}
+
+size_t saturatingAdd(const size_t a,const size_t b) {
+    const size_t maxVal=numeric_limits<size_t>::max();
+
+    return a>maxVal-b?maxVal:a+b;
+}
+
+size_t saturatingMult(const size_t a,const size_t b) {
+    const size_t maxVal=numeric_limits<size_t>::max();
+
+    return (b!=0&&a>maxVal/b)?maxVal:a*b;
+}
+
+size_t greatestCommonDivisor(size_t a,size_t b) {
+//Euclid's algorithm.
+    while(b!=0) {
+        const size_t r=a%b;
+
+        a=b;
+        b=r;
+    }
+
+    return a;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
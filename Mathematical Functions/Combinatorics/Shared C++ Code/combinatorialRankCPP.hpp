@@ -0,0 +1,46 @@
+/**COMBINATORIALRANKCPP A header file for C++ functions that rank, unrank
+ *                and step through combinations, permutations and set
+ *                partitions so that long sequences of them can be split
+ *                into independent ranges. See the file
+ *                combinatorialRankCPP.cpp for more details.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef COMBINATORIALRANKCPP
+#define COMBINATORIALRANKCPP
+
+//Defines the size_t type
+#include <stddef.h>
+
+void binomialTableCPP(size_t *binomTable,const size_t n,const size_t m);
+size_t binomialCPP(const size_t n,const size_t k);
+size_t rankCombinationCPP(const size_t *combo,const size_t m);
+void unrankCombinationCPP(size_t *combo,size_t rank,const size_t n,const size_t m,const size_t *binomTable);
+bool getNextColexComboCPP(size_t *combo,const size_t n,const size_t m);
+void factorialTableCPP(size_t *factTable,const size_t n);
+void unrankPermutationCPP(size_t *perm,size_t rank,const size_t n,const size_t *factTable,size_t *buffer);
+void setPartitionTableCPP(size_t *numCompletions,const size_t n);
+void unrankSetPartitionCPP(size_t *q,size_t *p,size_t &nc,size_t rank,const size_t n,const size_t *numCompletions);
+bool getNextSetPartitionCPP(size_t *q,size_t *p,size_t &nc,const size_t n);
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,151 @@
+/**GETCOMBINATIONBLOCK Get a block of consecutive combinations of m items
+ *                   chosen from a set of n items in the order of their
+ *                   ranks, as given by the function rankCombination. This
+ *                   avoids calling a function once per combination when
+ *                   enumerating large numbers of them, and makes it
+ *                   possible to split the enumeration into independent
+ *                   ranges of ranks.
+ *
+ *INPUTS: n The number of items from which m items are chosen.
+ *        m The number of items chosen.
+ * startRank The rank of the first combination desired, counting from zero.
+ *          If omitted or an empty matrix is passed, the default of 0 is
+ *          used.
+ * numCombos The number of combinations desired. If fewer than numCombos
+ *          combinations have ranks of startRank or higher, then only those
+ *          are returned. If omitted or an empty matrix is passed, all of
+ *          the combinations from startRank on are returned.
+ *
+ *OUTPUTS: combos An mXnumReturned matrix whose columns are the
+ *                combinations of ranks startRank, startRank+1, etc. The
+ *                elements of each combination are in increasing order and
+ *                the lowest item is indexed zero, as in unrankCombination.
+ *                If startRank is at least binomial(n,m), then an mX0
+ *                matrix is returned.
+ *
+ *The ranking is the combinatorial number system of Chapter 7.2.1.3 of
+ *D. E. Knuth, The Art of Computer Programming. Vol. 4, Fascicle 3:
+ *Generating all Combinations and Partitions, Upper Saddle River, NJ:
+ *Addison-Wesley, 2009.
+ *in which the last element of a combination is the most significant. This
+ *is not the order in which getNextCombo produces combinations. Ranks must
+ *be less than 2^53 to be exactly represented as doubles in Matlab. The
+ *block is split into ranges of 1024 combinations. The first combination of
+ *each range is unranked and the rest are found by incrementing it, as
+ *described in combinatorialRankCPP.cpp. If the code is compiled with
+ *OpenMP support, then the ranges are filled in parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *combos=getCombinationBlock(n,m,startRank,numCombos);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For min
+#include <algorithm>
+//For numeric_limits
+#include <limits>
+#include <vector>
+#include "MexValidation.h"
+#include "combinatorialRankCPP.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    const size_t chunkSize=1024;
+    size_t n, m, startRank=0, numTotal, numCombos, numChunks;
+    size_t *binomTable;
+    double *combos;
+
+    if(nrhs<2) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>4) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>1) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    n=getSizeTFromMatlab(prhs[0]);
+    m=getSizeTFromMatlab(prhs[1]);
+
+    if(nrhs>2&&!mxIsEmpty(prhs[2])) {
+        startRank=getSizeTFromMatlab(prhs[2]);
+    }
+
+    binomTable=new size_t[(n+1)*(m+1)];
+    binomialTableCPP(binomTable,n,m);
+    numTotal=binomTable[n+(n+1)*m];
+
+    if(startRank>=numTotal) {
+        delete[] binomTable;
+        plhs[0]=mxCreateDoubleMatrix(m,0,mxREAL);
+        return;
+    }
+
+    if(nrhs>3&&!mxIsEmpty(prhs[3])) {
+        numCombos=min(getSizeTFromMatlab(prhs[3]),numTotal-startRank);
+    } else {
+        if(numTotal==numeric_limits<size_t>::max()) {
+            delete[] binomTable;
+            mexErrMsgTxt("There are too many combinations to return them all.");
+        }
+        numCombos=numTotal-startRank;
+    }
+
+    plhs[0]=mxCreateDoubleMatrix(m,numCombos,mxREAL);
+    combos=mxGetPr(plhs[0]);
+
+    numChunks=(numCombos+chunkSize-1)/chunkSize;
+    {
+        ptrdiff_t curChunk;
+
+        #pragma omp parallel for schedule(dynamic)
+        for(curChunk=0;curChunk<(ptrdiff_t)numChunks;curChunk++) {
+            const size_t firstCol=chunkSize*curChunk;
+            const size_t endCol=min(firstCol+chunkSize,numCombos);
+            //The extra element keeps the array valid when m=0.
+            vector<size_t> combo(m+1);
+            size_t curCol, i;
+
+            unrankCombinationCPP(&combo[0],startRank+firstCol,n,m,binomTable);
+            for(curCol=firstCol;curCol<endCol;curCol++) {
+                if(curCol>firstCol) {
+                    getNextColexComboCPP(&combo[0],n,m);
+                }
+
+                for(i=0;i<m;i++) {
+                    combos[i+m*curCol]=(double)combo[i];
+                }
+            }
+        }
+    }
+
+    delete[] binomTable;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,136 @@
+/**GETGRAYCODEBLOCK Get a block of consecutive gray codes of length n in
+ *                 the sequence produced by the function getNextGrayCode.
+ *                 This avoids calling getNextGrayCode once per code when
+ *                 enumerating large numbers of subsets of an n-set, and
+ *                 makes it possible to split the enumeration into
+ *                 independent ranges.
+ *
+ *INPUTS: n The length of the codes.
+ * startRank The position of the first code desired in the sequence,
+ *          counting from zero, where the code of rank zero is all zeros.
+ *          If omitted or an empty matrix is passed, the default of 0 is
+ *          used.
+ *  numCodes The number of codes desired. If fewer than numCodes codes have
+ *          ranks of startRank or higher, then only those are returned. If
+ *          omitted or an empty matrix is passed, all of the codes from
+ *          startRank on are returned.
+ *
+ *OUTPUTS: codes An nXnumReturned logical matrix whose columns are the
+ *               codes of ranks startRank, startRank+1, etc. Column k+1 is
+ *               the code obtained after calling getNextGrayCode k times,
+ *               starting from the code of rank startRank. If startRank is
+ *               at least 2^n, then an nX0 matrix is returned.
+ *
+ *The sequence produced by algorithm NEXSUB in getNextGrayCode is the
+ *binary reflected gray code, where the first element of the code is the
+ *least significant bit. The code of rank r is thus the binary
+ *representation of bitxor(r,bitshift(r,-1)), as described in Chapter
+ *7.2.1.1 of
+ *D. E. Knuth, The Art of Computer Programming. Vol. 4, Fascicle 2:
+ *Generating all Tuples and Permutations, Upper Saddle River, NJ:
+ *Addison-Wesley, 2009.
+ *so each code can be computed directly from its rank. Ranks must be less
+ *than 2^53 to be exactly represented as doubles in Matlab. If the code is
+ *compiled with OpenMP support, then the codes are computed in parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *codes=getGrayCodeBlock(n,startRank,numCodes);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For min
+#include <algorithm>
+//For numeric_limits
+#include <limits>
+#include "MexValidation.h"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    const size_t numBits=numeric_limits<size_t>::digits;
+    size_t n, startRank=0, numTotal, numCodes;
+    mxLogical *codes;
+
+    if(nrhs<1) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>3) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>1) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    n=getSizeTFromMatlab(prhs[0]);
+
+    if(nrhs>1&&!mxIsEmpty(prhs[1])) {
+        startRank=getSizeTFromMatlab(prhs[1]);
+    }
+
+    //The number of codes saturates if it cannot be represented.
+    if(n>=numBits) {
+        numTotal=numeric_limits<size_t>::max();
+    } else {
+        numTotal=((size_t)1)<<n;
+    }
+
+    if(startRank>=numTotal) {
+        plhs[0]=mxCreateLogicalMatrix(n,0);
+        return;
+    }
+
+    if(nrhs>2&&!mxIsEmpty(prhs[2])) {
+        numCodes=min(getSizeTFromMatlab(prhs[2]),numTotal-startRank);
+    } else {
+        if(numTotal==numeric_limits<size_t>::max()) {
+            mexErrMsgTxt("There are too many codes to return them all.");
+        }
+        numCodes=numTotal-startRank;
+    }
+
+    //The elements are initialized to false.
+    plhs[0]=mxCreateLogicalMatrix(n,numCodes);
+    codes=mxGetLogicals(plhs[0]);
+
+    {
+        const size_t numNonzeroBits=min(n,numBits);
+        ptrdiff_t curCol;
+
+        #pragma omp parallel for
+        for(curCol=0;curCol<(ptrdiff_t)numCodes;curCol++) {
+            const size_t rank=startRank+curCol;
+            const size_t grayVal=rank^(rank>>1);
+            size_t i;
+
+            for(i=0;i<numNonzeroBits;i++) {
+                codes[i+n*curCol]=(mxLogical)((grayVal>>i)&1);
+            }
+        }
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -23,6 +23,10 @@ function I=getNextCombo(I,n)
 %Communications of the ACM, vol. 6, no. 3 pp. 103, Mar. 1963.
 %modified to start from zero instead of one.
 %
+%To enumerate many combinations without a function call for each one, the
+%compiled function getCombinationBlock returns blocks of them, though in
+%the order of rankCombination rather than the order used here.
+%
 %September 2013 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
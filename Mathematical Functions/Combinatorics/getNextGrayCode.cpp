@@ -61,6 +61,19 @@
 //For the max command.
 #include <algorithm>
 
+template <typename T>
+size_t countOnes(const size_t n,const T *code) {
+/*COUNTONES Count the nonzero elements of the length n code.*/
+    size_t i, numOnes=0;
+
+    for(i=0;i<n;i++) {
+        if(code[i]!=0) {
+            numOnes++;
+        }
+    }
+    return numOnes;
+}
+
 void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
     size_t n,j;
     size_t nCard;
@@ -134,14 +147,11 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         }
     }
 
+    //If nCard is not provided, then the ones in the code are counted once
+    //the type of the code is known.
+    nCard=0;
     if(nrhs>1) {
         nCard=getSizeTFromMatlab(prhs[1]);
-    } else {
-        mxArray *lhs[1];
-        //Sum up the ones in codeArray to get nCard if it is not provided.
-        mexCallMATLAB(1,lhs,1, &codeArray, "sum");
-        nCard=getSizeTFromMatlab(lhs[0]);
-        mxDestroyArray(lhs[0]);
     }
     
     //The type of the data in the code array is whatever the user passed to
@@ -152,6 +162,9 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         case mxCHAR_CLASS:
         {
             mxChar *code=(mxChar*)mxGetData(codeArray);
+            if(nrhs<2) {
+                nCard=countOnes(n,code);
+            }
             
             if(nCard==(size_t)code[n-1]&&nCard!=0) {
                 lastPassed=true;
@@ -163,6 +176,9 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         case mxLOGICAL_CLASS:
         {
             mxLogical* code=(mxLogical*)mxGetData(codeArray); 
+            if(nrhs<2) {
+                nCard=countOnes(n,code);
+            }
             
             if(nCard==(size_t)code[n-1]&&nCard!=0) {
                 lastPassed=true;
@@ -174,6 +190,9 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         case mxDOUBLE_CLASS:
         {
             double* code=(double*)mxGetData(codeArray);
+            if(nrhs<2) {
+                nCard=countOnes(n,code);
+            }
             
             if(nCard==(size_t)code[n-1]&&nCard!=0) {
                 lastPassed=true;
@@ -185,6 +204,9 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         case mxSINGLE_CLASS:
         {
             float* code=(float*)mxGetData(codeArray);
+            if(nrhs<2) {
+                nCard=countOnes(n,code);
+            }
             
             if(nCard==(size_t)code[n-1]&&nCard!=0) {
                 lastPassed=true;
@@ -196,6 +218,9 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         case mxINT8_CLASS:
         {
             int8_T* code=(int8_T*)mxGetData(codeArray);
+            if(nrhs<2) {
+                nCard=countOnes(n,code);
+            }
             
             if(nCard==(size_t)code[n-1]&&nCard!=0) {
                 lastPassed=true;
@@ -207,6 +232,9 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         case mxUINT8_CLASS:
         {
             uint8_T* code=(uint8_T*)mxGetData(codeArray);
+            if(nrhs<2) {
+                nCard=countOnes(n,code);
+            }
             
             if(nCard==(size_t)code[n-1]&&nCard!=0) {
                 lastPassed=true;
@@ -218,6 +246,9 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         case mxINT16_CLASS:
         {
             int16_T* code=(int16_T*)mxGetData(codeArray);
+            if(nrhs<2) {
+                nCard=countOnes(n,code);
+            }
             
             if(nCard==(size_t)code[n-1]&&nCard!=0) {
                 lastPassed=true;
@@ -229,6 +260,9 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         case mxUINT16_CLASS:
         {
             uint16_T* code=(uint16_T*)mxGetData(codeArray);
+            if(nrhs<2) {
+                nCard=countOnes(n,code);
+            }
             
             if(nCard==(size_t)code[n-1]&&nCard!=0) {
                 lastPassed=true;
@@ -240,6 +274,9 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         case mxINT32_CLASS:
         {
             int32_T* code=(int32_T*)mxGetData(codeArray);
+            if(nrhs<2) {
+                nCard=countOnes(n,code);
+            }
             
             if(nCard==(size_t)code[n-1]&&nCard!=0) {
                 lastPassed=true;
@@ -251,6 +288,9 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         case mxUINT32_CLASS:
         {
             uint32_T* code=(uint32_T*)mxGetData(codeArray);
+            if(nrhs<2) {
+                nCard=countOnes(n,code);
+            }
             
             if(nCard==(size_t)code[n-1]&&nCard!=0) {
                 lastPassed=true;
@@ -262,6 +302,9 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         case mxINT64_CLASS:
         {
             int64_T* code=(int64_T*)mxGetData(codeArray);
+            if(nrhs<2) {
+                nCard=countOnes(n,code);
+            }
             
             if(nCard==(size_t)code[n-1]&&nCard!=0) {
                 lastPassed=true;
@@ -273,6 +316,9 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
         case mxUINT64_CLASS:
         {
             uint64_T* code=(uint64_T*)mxGetData(codeArray);   
+            if(nrhs<2) {
+                nCard=countOnes(n,code);
+            }
             
             if(nCard==(size_t)code[n-1]&&nCard!=0) {
                 lastPassed=true;
@@ -39,6 +39,10 @@ function [code,nCard,isLast,j]=getNextGrayCode(code,nCard)
 %Generating all Tuples and Permutations, Upper Saddle River, NJ:
 %Addison-Wesley, 2009.
 %
+%To enumerate many codes without a function call for each one, the
+%compiled function getGrayCodeBlock returns blocks of consecutive codes in
+%the same sequence.
+%
 %October 2014 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
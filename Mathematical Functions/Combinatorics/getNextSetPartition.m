@@ -47,6 +47,10 @@ function [q,p,nc]=getNextSetPartition(n,q,p,nc)
 %[q,p,nc]=getNextSetPartition(n,q,p,nc);
 %to get subsequent set partitions.
 %
+%To enumerate many set partitions without a function call for each one,
+%the compiled function getSetPartitionBlock returns blocks of consecutive
+%set partitions in the same sequence.
+%
 %October 2014 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
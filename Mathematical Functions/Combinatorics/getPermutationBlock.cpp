@@ -0,0 +1,142 @@
+/**GETPERMUTATIONBLOCK Get a block of consecutive permutations of the
+ *                   numbers 1 to n in lexicographic order, as given by the
+ *                   function rankPermutation. This avoids calling a
+ *                   function once per permutation when enumerating large
+ *                   numbers of them, and makes it possible to split the
+ *                   enumeration into independent ranges of ranks.
+ *
+ *INPUTS: n The number of elements in each permutation.
+ * startRank The rank of the first permutation desired, counting from zero.
+ *          If omitted or an empty matrix is passed, the default of 0 is
+ *          used.
+ *  numPerms The number of permutations desired. If fewer than numPerms
+ *          permutations have ranks of startRank or higher, then only those
+ *          are returned. If omitted or an empty matrix is passed, all of
+ *          the permutations from startRank on are returned.
+ *
+ *OUTPUTS: perms An nXnumReturned matrix whose columns are the
+ *               permutations of ranks startRank, startRank+1, etc., which
+ *               are the same as the outputs of unrankPermutation. If
+ *               startRank is at least factorial(n), then an nX0 matrix is
+ *               returned.
+ *
+ *Ranks must be less than 2^53 to be exactly represented as doubles in
+ *Matlab. The block is split into ranges of 1024 permutations. The first
+ *permutation of each range is unranked, as described in
+ *combinatorialRankCPP.cpp, and the rest are found using the
+ *std::next_permutation function. If the code is compiled with OpenMP
+ *support, then the ranges are filled in parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *perms=getPermutationBlock(n,startRank,numPerms);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For min and next_permutation
+#include <algorithm>
+//For numeric_limits
+#include <limits>
+#include <vector>
+#include "MexValidation.h"
+#include "combinatorialRankCPP.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    const size_t chunkSize=1024;
+    size_t n, startRank=0, numTotal, numPerms, numChunks;
+    size_t *factTable;
+    double *perms;
+
+    if(nrhs<1) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>3) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>1) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    n=getSizeTFromMatlab(prhs[0]);
+
+    if(nrhs>1&&!mxIsEmpty(prhs[1])) {
+        startRank=getSizeTFromMatlab(prhs[1]);
+    }
+
+    factTable=new size_t[n+1];
+    factorialTableCPP(factTable,n);
+    numTotal=factTable[n];
+
+    if(startRank>=numTotal) {
+        delete[] factTable;
+        plhs[0]=mxCreateDoubleMatrix(n,0,mxREAL);
+        return;
+    }
+
+    if(nrhs>2&&!mxIsEmpty(prhs[2])) {
+        numPerms=min(getSizeTFromMatlab(prhs[2]),numTotal-startRank);
+    } else {
+        if(numTotal==numeric_limits<size_t>::max()) {
+            delete[] factTable;
+            mexErrMsgTxt("There are too many permutations to return them all.");
+        }
+        numPerms=numTotal-startRank;
+    }
+
+    plhs[0]=mxCreateDoubleMatrix(n,numPerms,mxREAL);
+    perms=mxGetPr(plhs[0]);
+
+    numChunks=(numPerms+chunkSize-1)/chunkSize;
+    {
+        ptrdiff_t curChunk;
+
+        #pragma omp parallel for schedule(dynamic)
+        for(curChunk=0;curChunk<(ptrdiff_t)numChunks;curChunk++) {
+            const size_t firstCol=chunkSize*curChunk;
+            const size_t endCol=min(firstCol+chunkSize,numPerms);
+            //The extra elements keep the arrays valid when n=0.
+            vector<size_t> perm(n+1), buffer(n+1);
+            size_t curCol, i;
+
+            unrankPermutationCPP(&perm[0],startRank+firstCol,n,factTable,&buffer[0]);
+            for(curCol=firstCol;curCol<endCol;curCol++) {
+                if(curCol>firstCol) {
+                    next_permutation(perm.begin(),perm.begin()+n);
+                }
+
+                for(i=0;i<n;i++) {
+                    perms[i+n*curCol]=(double)(perm[i]+1);
+                }
+            }
+        }
+    }
+
+    delete[] factTable;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
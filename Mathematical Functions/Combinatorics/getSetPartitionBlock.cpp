@@ -0,0 +1,149 @@
+/**GETSETPARTITIONBLOCK Get a block of consecutive ways of partitioning a
+ *                   set of n unique items in the sequence produced by the
+ *                   function getNextSetPartition. This avoids calling
+ *                   getNextSetPartition once per partition when
+ *                   enumerating large numbers of them, and makes it
+ *                   possible to split the enumeration into independent
+ *                   ranges.
+ *
+ *INPUTS: n The number of items in the set to be partitioned; n>0.
+ * startRank The position of the first set partition desired in the
+ *          sequence, counting from zero. If omitted or an empty matrix is
+ *          passed, the default of 0 is used.
+ *  numParts The number of set partitions desired. If fewer than numParts
+ *          set partitions have ranks of startRank or higher, then only
+ *          those are returned. If omitted or an empty matrix is passed, all
+ *          of the set partitions from startRank on are returned.
+ *
+ *OUTPUTS: Q An nXnumReturned matrix whose columns are the set partitions
+ *           of ranks startRank, startRank+1, etc. in the same format as
+ *           the vector q of getNextSetPartition, which specifies the class
+ *           of each item. If startRank is at least the number of set
+ *           partitions (the Bell number of n), then an nX0 matrix is
+ *           returned.
+ *
+ *getNextSetPartition produces the vectors q in lexicographic order, so the
+ *number of set partitions that begin with a given set of elements can be
+ *counted, which makes it possible to find the set partition of any rank.
+ *The block is split into ranges of 1024 set partitions. The first set
+ *partition of each range is unranked and the rest are found using the same
+ *algorithm as getNextSetPartition, as described in
+ *combinatorialRankCPP.cpp. Ranks must be less than 2^53 to be exactly
+ *represented as doubles in Matlab. If the code is compiled with OpenMP
+ *support, then the ranges are filled in parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *Q=getSetPartitionBlock(n,startRank,numParts);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For min
+#include <algorithm>
+//For numeric_limits
+#include <limits>
+#include <vector>
+#include "MexValidation.h"
+#include "combinatorialRankCPP.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    const size_t chunkSize=1024;
+    size_t n, startRank=0, numTotal, numParts, numChunks;
+    size_t *numCompletions;
+    double *Q;
+
+    if(nrhs<1) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>3) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>1) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    n=getSizeTFromMatlab(prhs[0]);
+    if(n==0) {
+        mexErrMsgTxt("The number of items must be positive.");
+    }
+
+    if(nrhs>1&&!mxIsEmpty(prhs[1])) {
+        startRank=getSizeTFromMatlab(prhs[1]);
+    }
+
+    numCompletions=new size_t[n*(n+2)];
+    setPartitionTableCPP(numCompletions,n);
+    numTotal=numCompletions[n-1+n];
+
+    if(startRank>=numTotal) {
+        delete[] numCompletions;
+        plhs[0]=mxCreateDoubleMatrix(n,0,mxREAL);
+        return;
+    }
+
+    if(nrhs>2&&!mxIsEmpty(prhs[2])) {
+        numParts=min(getSizeTFromMatlab(prhs[2]),numTotal-startRank);
+    } else {
+        if(numTotal==numeric_limits<size_t>::max()) {
+            delete[] numCompletions;
+            mexErrMsgTxt("There are too many set partitions to return them all.");
+        }
+        numParts=numTotal-startRank;
+    }
+
+    plhs[0]=mxCreateDoubleMatrix(n,numParts,mxREAL);
+    Q=mxGetPr(plhs[0]);
+
+    numChunks=(numParts+chunkSize-1)/chunkSize;
+    {
+        ptrdiff_t curChunk;
+
+        #pragma omp parallel for schedule(dynamic)
+        for(curChunk=0;curChunk<(ptrdiff_t)numChunks;curChunk++) {
+            const size_t firstCol=chunkSize*curChunk;
+            const size_t endCol=min(firstCol+chunkSize,numParts);
+            vector<size_t> q(n), p(n);
+            size_t nc, curCol, i;
+
+            unrankSetPartitionCPP(&q[0],&p[0],nc,startRank+firstCol,n,numCompletions);
+            for(curCol=firstCol;curCol<endCol;curCol++) {
+                if(curCol>firstCol) {
+                    getNextSetPartitionCPP(&q[0],&p[0],nc,n);
+                }
+
+                for(i=0;i<n;i++) {
+                    Q[i+n*curCol]=(double)q[i];
+                }
+            }
+        }
+    }
+
+    delete[] numCompletions;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
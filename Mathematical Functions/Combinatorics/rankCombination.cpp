@@ -0,0 +1,121 @@
+/**RANKCOMBINATION Obtain the lexicographic order (the rank) of one or more
+ *                 combinations starting from 0, where the last element of
+ *                 each combination in increasing order is the most
+ *                 significant. This is a compiled version of the Matlab
+ *                 function rankCombination that can rank many combinations
+ *                 at once.
+ *
+ *INPUTS: combo A vector holding the elements of a combination or an
+ *              mXnumCombos matrix whose columns are combinations. The
+ *              elements are integers starting from zero. Unlike in the
+ *              Matlab function, the elements of a combination can be in
+ *              any order, but they must be unique.
+ *
+ *OUTPUTS: rank A 1XnumCombos vector of the ranks of the combinations in
+ *              the same ordering as the Matlab function rankCombination,
+ *              counting from zero.
+ *
+ *The rank is computed using the combinatorial number system, as described
+ *in the Matlab function rankCombination. The binomial coefficients are
+ *computed exactly in integer arithmetic, so the ranks are exact integers,
+ *though ranks of 2^53 or more cannot be represented exactly as doubles in
+ *Matlab. No table of binomial coefficients is used, so the memory used
+ *does not depend on the values of the elements. If the code is
+ *compiled with OpenMP support, then the combinations are ranked in
+ *parallel. The function unrankCombination performs the inverse operation
+ *and getCombinationBlock returns combinations in the order of their ranks.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *rank=rankCombination(combo);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For sort, copy and adjacent_find
+#include <algorithm>
+#include <vector>
+#include "MexValidation.h"
+#include "combinatorialRankCPP.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t m, numCombos;
+    size_t *combos;
+    mxArray *comboMat;
+    double *ranks;
+    bool isValid=true;
+
+    if(nrhs!=1) {
+        mexErrMsgTxt("Wrong number of inputs.");
+    }
+
+    if(nlhs>1) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    //The empty combination has rank 0.
+    if(mxIsEmpty(prhs[0])) {
+        plhs[0]=mxCreateDoubleScalar(0.0);
+        return;
+    }
+
+    comboMat=convert2DReal2UnsignedSizeMat(prhs[0]);
+    combos=(size_t*)mxGetData(comboMat);
+    if(mxGetM(prhs[0])==1) {
+        m=mxGetN(prhs[0]);
+        numCombos=1;
+    } else {
+        m=mxGetM(prhs[0]);
+        numCombos=mxGetN(prhs[0]);
+    }
+
+    plhs[0]=mxCreateDoubleMatrix(1,numCombos,mxREAL);
+    ranks=mxGetPr(plhs[0]);
+
+    {
+        ptrdiff_t curCombo;
+
+        #pragma omp parallel for
+        for(curCombo=0;curCombo<(ptrdiff_t)numCombos;curCombo++) {
+            vector<size_t> combo(combos+m*curCombo,combos+m*(curCombo+1));
+
+            sort(combo.begin(),combo.end());
+            if(adjacent_find(combo.begin(),combo.end())!=combo.end()) {
+                isValid=false;
+            } else {
+                ranks[curCombo]=(double)rankCombinationCPP(&combo[0],m);
+            }
+        }
+    }
+
+    mxDestroyArray(comboMat);
+
+    if(!isValid) {
+        mxDestroyArray(plhs[0]);
+        mexErrMsgTxt("The elements of a combination must be unique.");
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,115 @@
+/**UNRANKCOMBINATION Return the combinations of the given ranks in the
+ *                   lexicographic ordering of combinations consisting of
+ *                   m elements chosen from a total set of n elements,
+ *                   where the last element of each combination in
+ *                   increasing order is the most significant. This is a
+ *                   compiled version of the Matlab function
+ *                   unrankCombination that can unrank many combinations at
+ *                   once.
+ *
+ *INPUTS:    rank A scalar or a vector of numRanks ranks of the desired
+ *                combinations. Note that 0<=rank<binomial(n,m).
+ *              n The number of items from which m items are chosen for
+ *                the ranked combinations.
+ *              m The number of items chosen.
+ *
+ *OUTPUTS:  combo An mXnumRanks matrix whose columns are the combinations
+ *                of the given ranks with values in INCREASING order. The
+ *                lowest item is indexed zero. If any rank is equal to or
+ *                greater than the total number of unique combinations,
+ *                then an empty matrix is returned.
+ *
+ *The algorithm is the same as in the Matlab function unrankCombination,
+ *except that the binomial coefficients are taken from a table, so they are
+ *exact integers. Ranks must be less than 2^53 to be exactly represented as
+ *doubles in Matlab. If the code is compiled with OpenMP support, then the
+ *combinations are unranked in parallel. To get a block of combinations
+ *with consecutive ranks, getCombinationBlock is faster.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *combo=unrankCombination(rank,n,m);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include <vector>
+#include "MexValidation.h"
+#include "combinatorialRankCPP.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t n, m, numRanks, numTotal, i;
+    size_t *ranks, *binomTable;
+    double *combos;
+
+    if(nrhs!=3) {
+        mexErrMsgTxt("Wrong number of inputs.");
+    }
+
+    if(nlhs>1) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    n=getSizeTFromMatlab(prhs[1]);
+    m=getSizeTFromMatlab(prhs[2]);
+    ranks=copySizeTArrayFromMatlab(prhs[0],&numRanks);
+
+    binomTable=new size_t[(n+1)*(m+1)];
+    binomialTableCPP(binomTable,n,m);
+    numTotal=binomTable[n+(n+1)*m];
+
+    for(i=0;i<numRanks;i++) {
+        if(ranks[i]>=numTotal) {
+            delete[] binomTable;
+            mxFree(ranks);
+            plhs[0]=mxCreateDoubleMatrix(0,0,mxREAL);
+            return;
+        }
+    }
+
+    plhs[0]=mxCreateDoubleMatrix(m,numRanks,mxREAL);
+    combos=mxGetPr(plhs[0]);
+
+    {
+        ptrdiff_t curRank;
+
+        #pragma omp parallel for
+        for(curRank=0;curRank<(ptrdiff_t)numRanks;curRank++) {
+            //The extra element keeps the array valid when m=0.
+            vector<size_t> combo(m+1);
+            size_t j;
+
+            unrankCombinationCPP(&combo[0],ranks[curRank],n,m,binomTable);
+            for(j=0;j<m;j++) {
+                combos[j+m*curRank]=(double)combo[j];
+            }
+        }
+    }
+
+    delete[] binomTable;
+    mxFree(ranks);
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,112 @@
+/**UNRANKPERMUTATION Return the permutations of the given ranks in the
+ *                   lexicographic ordering of permutations consisting of
+ *                   n elements, where the first element of each
+ *                   permutation is the most significant. This is a
+ *                   compiled version of the Matlab function
+ *                   unrankPermutation that can unrank many permutations at
+ *                   once.
+ *
+ *INPUTS:    rank A scalar or a vector of numRanks ranks of the desired
+ *                permutations of [1;2;3;...;n] in lexicographic order.
+ *                Note that 0<=rank<=(n!-1).
+ *              n The number of elements in the desired permutations.
+ *
+ *OUTPUTS:   perm An nXnumRanks matrix whose columns are the permutations
+ *                having the given lexicographic ranks (having values 1 to
+ *                n). If any rank is equal to or greater than the total
+ *                number of unique permutations, then an empty matrix is
+ *                returned.
+ *
+ *The algorithm is the same as in the Matlab function unrankPermutation,
+ *except that the factorials are computed as integers, so they are exact
+ *for n up to 20 on 64-bit systems. Ranks must be less than 2^53 to be
+ *exactly represented as doubles in Matlab. If the code is compiled with
+ *OpenMP support, then the permutations are unranked in parallel. To get a
+ *block of permutations with consecutive ranks, getPermutationBlock is
+ *faster.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *perm=unrankPermutation(rank,n);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include <vector>
+#include "MexValidation.h"
+#include "combinatorialRankCPP.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t n, numRanks, i;
+    size_t *ranks, *factTable;
+    double *perms;
+
+    if(nrhs!=2) {
+        mexErrMsgTxt("Wrong number of inputs.");
+    }
+
+    if(nlhs>1) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    n=getSizeTFromMatlab(prhs[1]);
+    ranks=copySizeTArrayFromMatlab(prhs[0],&numRanks);
+
+    factTable=new size_t[n+1];
+    factorialTableCPP(factTable,n);
+
+    for(i=0;i<numRanks;i++) {
+        if(ranks[i]>=factTable[n]) {
+            delete[] factTable;
+            mxFree(ranks);
+            plhs[0]=mxCreateDoubleMatrix(0,0,mxREAL);
+            return;
+        }
+    }
+
+    plhs[0]=mxCreateDoubleMatrix(n,numRanks,mxREAL);
+    perms=mxGetPr(plhs[0]);
+
+    {
+        ptrdiff_t curRank;
+
+        #pragma omp parallel for
+        for(curRank=0;curRank<(ptrdiff_t)numRanks;curRank++) {
+            //The extra elements keep the arrays valid when n=0.
+            vector<size_t> perm(n+1), buffer(n+1);
+            size_t j;
+
+            unrankPermutationCPP(&perm[0],ranks[curRank],n,factTable,&buffer[0]);
+            for(j=0;j<n;j++) {
+                perms[j+n*curRank]=(double)(perm[j]+1);
+            }
+        }
+    }
+
+    delete[] factTable;
+    mxFree(ranks);
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
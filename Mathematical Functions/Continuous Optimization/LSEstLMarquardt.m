@@ -71,6 +71,13 @@ function [x,exitCode]=LSEstLMarquardt(fun,x0,hasJacobian,TolG,TolX,delta,deltaAb
 %Algorithm 3.31. In the comments to the code, all equation numbers refer to
 %those in [2].
 %
+%This function forms dense Jacobian matrices. For large problems with
+%sparse Jacobians, the same algorithm is implemented in C++ in
+%sparseLMCPP.cpp, which solves the normal equations using a sparse
+%Cholesky decomposition or by eliminating independent blocks of parameters
+%with the Schur complement. It is used by the compiled function
+%sensorRegistrationLM.
+%
 %The algorithm can be demonstrated using the following scenario:
 % %The true parameters that are to be estimated.
 % xTrue=[20;10;1;50];
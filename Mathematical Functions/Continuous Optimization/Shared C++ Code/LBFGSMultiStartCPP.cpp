@@ -0,0 +1,243 @@
+/**LBFGSMULTISTARTCPP A C++ class for global optimization of functions with
+ *               multiple local minima by running the L-BFGS algorithm of
+ *               LBFGSNativeCPP from many starting points. See
+ *               optimizationFuncs.hpp for a description of the inputs.
+ *
+ *If compiled with OpenMP, the starts are run in parallel. The minima found
+ *so far are shared among the threads, so that a start can be cancelled as
+ *soon as it is clearly converging to a minimum that another start already
+ *found. As a result, when run in parallel, the basin counts and the
+ *assignment of cancelled starts to minima can depend on the order in which
+ *the threads finish, though the minima themselves do not. Only starts for
+ *which liblbfgs reports convergence (a nonnegative exit code) add minima.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "optimizationFuncs.hpp"
+//For copy and sort
+#include <algorithm>
+//For sqrt
+#include <cmath>
+//For pair
+#include <utility>
+
+using namespace std;
+
+//The data passed to the progress function of each start.
+class MultiStartProgressData {
+public:
+    LBFGSMultiStartCPP *multiStart;
+    //The minimum to which the start is going if it was cancelled.
+    size_t cancelMin;
+};
+
+void LBFGSMultiStartCPP::run(const double *starts,const size_t numStarts) {
+    const size_t xDim=objective.xDim;
+    vector<pair<double,size_t> > order;
+    vector<size_t> newIdx;
+    vector<double> xSorted;
+    size_t i;
+
+    xMin.clear();
+    fMin.clear();
+    basinCount.clear();
+    startMinIdx.assign(numStarts,0);
+    exitCodes.assign(numStarts,0);
+
+    {
+        ptrdiff_t curStart;
+
+        #pragma omp parallel for schedule(dynamic)
+        for(curStart=0;curStart<(ptrdiff_t)numStarts;curStart++) {
+            vector<double> x(starts+xDim*curStart,starts+xDim*(curStart+1));
+            lbfgs_parameter_t curParam=param;
+            MultiStartProgressData progressData;
+            double f;
+            size_t idx=(size_t)-1;
+            int exitCode;
+
+            progressData.multiStart=this;
+            progressData.cancelMin=(size_t)-1;
+            exitCode=LBFGSNativeCPP(&x[0],&f,objective,&curParam,cancelTol>0?&cancelIfKnownBasin:NULL,&progressData);
+
+            #pragma omp critical(LBFGSMultiStartMinima)
+            {
+                if(exitCode==LBFGSERR_CANCELED&&progressData.cancelMin!=(size_t)-1) {
+                    idx=progressData.cancelMin;
+                    basinCount[idx]++;
+                } else if(exitCode>=0) {
+                    idx=addMinimum(&x[0],f);
+                }
+            }
+
+            exitCodes[curStart]=exitCode;
+            startMinIdx[curStart]=idx;
+        }
+    }
+
+    //Sort the minima by increasing cost.
+    order.resize(numMinima());
+    for(i=0;i<numMinima();i++) {
+        order[i]=make_pair(fMin[i],i);
+    }
+    sort(order.begin(),order.end());
+
+    newIdx.resize(numMinima());
+    xSorted.resize(xMin.size());
+    {
+        vector<size_t> countSorted(numMinima());
+
+        for(i=0;i<numMinima();i++) {
+            const size_t oldIdx=order[i].second;
+
+            newIdx[oldIdx]=i;
+            copy(xMin.begin()+xDim*oldIdx,xMin.begin()+xDim*(oldIdx+1),xSorted.begin()+xDim*i);
+            fMin[i]=order[i].first;
+            countSorted[i]=basinCount[oldIdx];
+        }
+        basinCount.swap(countSorted);
+    }
+    xMin.swap(xSorted);
+
+    for(i=0;i<numStarts;i++) {
+        startMinIdx[i]=startMinIdx[i]==(size_t)-1?numMinima():newIdx[startMinIdx[i]];
+    }
+}
+
+size_t LBFGSMultiStartCPP::findMinimum(const double *x,const double tol) const {
+/*FINDMINIMUM Return the index of the first minimum xm found for which
+ *            norm(x-xm)<=tol*max(1,norm(xm)) or numMinima() if there is
+ *            none.
+ */
+    const size_t xDim=objective.xDim;
+    size_t i, j;
+
+    for(i=0;i<numMinima();i++) {
+        const double *xm=&xMin[xDim*i];
+        double distSq=0, normSq=0, scale;
+
+        for(j=0;j<xDim;j++) {
+            distSq+=(x[j]-xm[j])*(x[j]-xm[j]);
+            normSq+=xm[j]*xm[j];
+        }
+
+        scale=tol*(normSq>1?sqrt(normSq):1);
+        if(distSq<=scale*scale) {
+            return i;
+        }
+    }
+    return numMinima();
+}
+
+size_t LBFGSMultiStartCPP::addMinimum(const double *x,const double f) {
+/*ADDMINIMUM Add a converged solution to the minima, merging it with an
+ *           existing minimum if it is within dedupTol of one, in which
+ *           case the lower cost solution is kept. The index of the minimum
+ *           is returned. This must only be called inside the
+ *           LBFGSMultiStartMinima critical section.
+ */
+    const size_t xDim=objective.xDim;
+    const size_t idx=findMinimum(x,dedupTol);
+
+    if(idx<numMinima()) {
+        basinCount[idx]++;
+        if(f<fMin[idx]) {
+            copy(x,x+xDim,xMin.begin()+xDim*idx);
+            fMin[idx]=f;
+        }
+        return idx;
+    }
+
+    xMin.insert(xMin.end(),x,x+xDim);
+    fMin.push_back(f);
+    basinCount.push_back(1);
+    return idx;
+}
+
+int LBFGSMultiStartCPP::cancelIfKnownBasin(void *progressData,const double *x,const double fx,const double gnorm,const int k) {
+/*CANCELIFKNOWNBASIN The progress function of each start. A start is
+ *            cancelled if its iterate is within cancelTol of a known
+ *            minimum whose cost is not higher than the current cost,
+ *            since it would then most likely only reproduce that minimum.
+ */
+    MultiStartProgressData *curData=(MultiStartProgressData*)progressData;
+    LBFGSMultiStartCPP *multiStart=curData->multiStart;
+    int retVal=0;
+
+    if(k<multiStart->minCancelIter) {
+        return 0;
+    }
+
+    #pragma omp critical(LBFGSMultiStartMinima)
+    {
+        const size_t idx=multiStart->findMinimum(x,multiStart->cancelTol);
+
+        if(idx<multiStart->numMinima()&&fx>=multiStart->fMin[idx]) {
+            curData->cancelMin=idx;
+            retVal=LBFGSERR_CANCELED;
+        }
+    }
+    return retVal;
+}
+
+void HaltonPointsCPP(double *points,const double *lowerBound,const double *upperBound,const size_t xDim,const size_t numPoints) {
+/*HALTONPOINTSCPP The Halton sequence uses the radical inverse of the point
+ *            index in the base of the ith prime number for the ith
+ *            dimension. The point with index 0, which is at the lower
+ *            bound, is skipped.
+ */
+    vector<size_t> primes;
+    size_t candidate=2, i, curDim;
+
+    //Find the first xDim prime numbers by trial division.
+    while(primes.size()<xDim) {
+        bool isPrime=true;
+
+        for(i=0;i<primes.size()&&primes[i]*primes[i]<=candidate;i++) {
+            if(candidate%primes[i]==0) {
+                isPrime=false;
+                break;
+            }
+        }
+        if(isPrime) {
+            primes.push_back(candidate);
+        }
+        candidate++;
+    }
+
+    for(i=0;i<numPoints;i++) {
+        for(curDim=0;curDim<xDim;curDim++) {
+            const double base=(double)primes[curDim];
+            size_t idx=i+1;
+            double digitScale=1/base, val=0;
+
+            while(idx>0) {
+                val+=digitScale*(double)(idx%primes[curDim]);
+                idx/=primes[curDim];
+                digitScale/=base;
+            }
+
+            points[curDim+xDim*i]=lowerBound[curDim]+(upperBound[curDim]-lowerBound[curDim])*val;
+        }
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
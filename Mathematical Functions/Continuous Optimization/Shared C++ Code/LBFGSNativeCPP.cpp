@@ -0,0 +1,95 @@
+/**LBFGSNATIVECPP A C++ function for minimizing an objective function
+ *               derived from LBFGSObjectiveCPP using the limited-memory
+ *               Broyden-Fletcher-Goldfarb-Shanno (L-BFGS) algorithm of
+ *               liblbfgs. See the comments to the Matlab function
+ *               quasiNewtonLBFGS for a description of the algorithm and
+ *               its parameters. Since the objective function is compiled,
+ *               no Matlab functions are called, so multiple optimizations
+ *               can run in parallel. This requires that liblbfgs be
+ *               compiled with LBFGS_STANDARD_ALLOC defined, so that it
+ *               does not use Matlab's memory allocation functions.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "optimizationFuncs.hpp"
+
+using namespace std;
+
+//The objective function, its scratch space and the optional progress
+//function, which are passed to the callback functions of liblbfgs.
+class LBFGSNativeInstance {
+public:
+    const LBFGSObjectiveCPP *objective;
+    double *scratch;
+    LBFGSNativeProgressCPP progress;
+    void *progressData;
+};
+
+static lbfgsfloatval_t evaluateNativeObjective(void *instance,const lbfgsfloatval_t *x,lbfgsfloatval_t *g,const int n,const lbfgsfloatval_t step) {
+    const LBFGSNativeInstance *curInstance=(const LBFGSNativeInstance*)instance;
+
+    return curInstance->objective->evaluate(g,x,curInstance->scratch);
+}
+
+static int nativeProgress(void *instance,const lbfgsfloatval_t *x,const lbfgsfloatval_t *g,const lbfgsfloatval_t fx,const lbfgsfloatval_t xnorm,const lbfgsfloatval_t gnorm,const lbfgsfloatval_t step,int n,int k,int ls) {
+    const LBFGSNativeInstance *curInstance=(const LBFGSNativeInstance*)instance;
+
+    return curInstance->progress(curInstance->progressData,x,fx,gnorm,k);
+}
+
+void LBFGSDefaultParamsCPP(lbfgs_parameter_t *param,const size_t xDim) {
+    lbfgs_parameter_init(param);
+    param->max_iterations=1000;
+    param->past=0;
+    param->delta=0;
+    param->epsilon=1e-6;
+    param->m=6;
+    //Default parameters for the line search
+    param->linesearch=LBFGS_LINESEARCH_MORETHUENTE;
+    param->orthantwise_c=0;
+    param->ftol=1e-6;
+    param->wolfe=0.9;
+    param->gtol=param->wolfe;
+    param->xtol=1e-16;
+    param->min_step=1e-20;
+    param->max_step=1e20;
+    param->max_linesearch=20;
+    param->orthantwise_start=0;
+    param->orthantwise_end=(int)xDim-1;
+}
+
+int LBFGSNativeCPP(double *x,double *fMin,const LBFGSObjectiveCPP &objective,lbfgs_parameter_t *param) {
+    return LBFGSNativeCPP(x,fMin,objective,param,NULL,NULL);
+}
+
+int LBFGSNativeCPP(double *x,double *fMin,const LBFGSObjectiveCPP &objective,lbfgs_parameter_t *param,LBFGSNativeProgressCPP progress,void *progressData) {
+    vector<double> scratch(objective.numScratch()+1);
+    LBFGSNativeInstance instance;
+
+    instance.objective=&objective;
+    instance.scratch=&scratch[0];
+    instance.progress=progress;
+    instance.progressData=progressData;
+
+    return lbfgs((int)objective.xDim,x,fMin,&evaluateNativeObjective,progress==NULL?NULL:&nativeProgress,(void*)&instance,param);
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
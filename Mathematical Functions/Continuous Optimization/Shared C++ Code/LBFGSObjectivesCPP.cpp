@@ -0,0 +1,372 @@
+/**LBFGSOBJECTIVESCPP Implementations of the built-in compiled objective
+ *                 functions for LBFGSNativeCPP, as well as of the
+ *                 registry through which objective functions are found by
+ *                 name. See optimizationFuncs.hpp for descriptions of the
+ *                 objective functions and of how new objective functions
+ *                 can be added.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "optimizationFuncs.hpp"
+#include "matrixFuncs.hpp"
+//For copy and fill
+#include <algorithm>
+//For log, exp and sqrt
+#include <cmath>
+#include <string>
+//For pair
+#include <utility>
+
+using namespace std;
+
+static const double log2Pi=1.837877066409345483560659472811;
+
+size_t LBFGSObjectiveCPP::numScratch() const {
+    return 0;
+}
+
+LeastSquaresObjectiveCPP::LeastSquaresObjectiveCPP(const double *ADes,const double *bDes,const size_t mDes,const size_t xDimDes) : LBFGSObjectiveCPP(xDimDes), m(mDes), A(ADes,ADes+mDes*xDimDes), b(bDes,bDes+mDes) {}
+
+double LeastSquaresObjectiveCPP::evaluate(double *grad,const double *x,double *scratch) const {
+    double *r=scratch;
+    double f=0;
+    size_t i;
+
+    //The residual r=A*x-b.
+    matVecMultCPP(r,&A[0],x,m,xDim);
+    for(i=0;i<m;i++) {
+        r[i]-=b[i];
+        f+=r[i]*r[i];
+    }
+
+    //The gradient 2*A'*r.
+    matTransVecMultCPP(grad,&A[0],r,xDim,m);
+    for(i=0;i<xDim;i++) {
+        grad[i]*=2;
+    }
+    return f;
+}
+
+size_t LeastSquaresObjectiveCPP::numScratch() const {
+    return m;
+}
+
+MahalanobisObjectiveCPP::MahalanobisObjectiveCPP(const double *ADes,const double *bDes,const double *RDes,const size_t mDes,const size_t xDimDes) : LeastSquaresObjectiveCPP(mDes,xDimDes) {
+    vector<double> LR(mDes*mDes);
+
+    isValid=cholLowerCPP(&LR[0],RDes,mDes);
+    if(!isValid) {
+        return;
+    }
+
+    //Whiten A and b by replacing them with L\A and L\b.
+    if(ADes==NULL) {
+        size_t i;
+
+        fill(A.begin(),A.end(),0.0);
+        for(i=0;i<mDes;i++) {
+            A[i+i*mDes]=1;
+        }
+    } else {
+        copy(ADes,ADes+mDes*xDimDes,A.begin());
+    }
+    copy(bDes,bDes+mDes,b.begin());
+    forwardSubstCPP(&A[0],&LR[0],mDes,xDimDes);
+    forwardSubstCPP(&b[0],&LR[0],mDes,1);
+}
+
+GaussMixNegLogLikeObjectiveCPP::GaussMixNegLogLikeObjectiveCPP(const double *w,const double *muDes,const double *P,const size_t xDimDes,const size_t numCompDes) : LBFGSObjectiveCPP(xDimDes), numComp(numCompDes), logCoeffs(numCompDes), mu(muDes,muDes+xDimDes*numCompDes), L(xDimDes*xDimDes*numCompDes) {
+    const size_t n=xDimDes;
+    size_t k;
+
+    isValid=true;
+    for(k=0;k<numComp;k++) {
+        double *LCur=&L[n*n*k];
+        double logDet=0;
+        size_t i;
+
+        if(w[k]<0||!cholLowerCPP(LCur,P+n*n*k,n)) {
+            isValid=false;
+            return;
+        }
+
+        for(i=0;i<n;i++) {
+            logDet+=2*log(LCur[i+i*n]);
+        }
+        //Components with zero weight get a log-coefficient of -Inf and
+        //contribute nothing.
+        logCoeffs[k]=log(w[k])-0.5*(logDet+n*log2Pi);
+    }
+}
+
+double GaussMixNegLogLikeObjectiveCPP::evaluate(double *grad,const double *x,double *scratch) const {
+/*The gradient is sum_k r(k)*inv(P(:,:,k))*(x-mu(:,k)), where the r(k) are
+ *the posterior probabilities of the components at x. The log-sum-exp of
+ *the component log-likelihoods is accumulated in a single pass, rescaling
+ *the sums whenever a new maximum is found, so that the result is accurate
+ *far from the means of the components.
+ */
+    const size_t n=xDim;
+    double *z=scratch;
+    double *u=scratch+n;
+    double maxVal=0, sumVal=0;
+    bool haveMax=false;
+    size_t i, k;
+
+    fill(grad,grad+n,0.0);
+    for(k=0;k<numComp;k++) {
+        const double *LCur=&L[n*n*k];
+        const double *muCur=&mu[n*k];
+        double logLike, quadVal=0, scale;
+
+        if(logCoeffs[k]==-HUGE_VAL) {
+            continue;
+        }
+
+        for(i=0;i<n;i++) {
+            z[i]=x[i]-muCur[i];
+            u[i]=z[i];
+        }
+        forwardSubstCPP(z,LCur,n,1);
+        for(i=0;i<n;i++) {
+            quadVal+=z[i]*z[i];
+        }
+        //u=inv(P)*(x-mu).
+        cholSolveCPP(u,LCur,n,1);
+
+        logLike=logCoeffs[k]-0.5*quadVal;
+        if(!haveMax||logLike>maxVal) {
+            //Rescale the previous sums to the new maximum.
+            const double rescale=haveMax?exp(maxVal-logLike):0;
+
+            sumVal*=rescale;
+            for(i=0;i<n;i++) {
+                grad[i]*=rescale;
+            }
+            maxVal=logLike;
+            haveMax=true;
+        }
+
+        scale=exp(logLike-maxVal);
+        sumVal+=scale;
+        for(i=0;i<n;i++) {
+            grad[i]+=scale*u[i];
+        }
+    }
+
+    if(!haveMax) {
+        //All of the weights are zero.
+        return HUGE_VAL;
+    }
+
+    for(i=0;i<n;i++) {
+        grad[i]/=sumVal;
+    }
+    return -(maxVal+log(sumVal));
+}
+
+size_t GaussMixNegLogLikeObjectiveCPP::numScratch() const {
+    return 2*xDim;
+}
+
+BistaticRangeObjectiveCPP::BistaticRangeObjectiveCPP(const double *rDes,const double *zTxDes,const double *zRxDes,const size_t numMeasDes,const size_t numRx,const size_t xDimDes) : LBFGSObjectiveCPP(xDimDes), numMeas(numMeasDes), r(rDes,rDes+numMeasDes), zTx(zTxDes,zTxDes+xDimDes*numMeasDes), zRx(xDimDes*numMeasDes) {
+    size_t i;
+
+    //A single receiver location is replicated for all of the
+    //measurements.
+    for(i=0;i<numMeas;i++) {
+        copy(zRxDes+(numRx==1?0:xDimDes*i),zRxDes+(numRx==1?0:xDimDes*i)+xDimDes,zRx.begin()+xDimDes*i);
+    }
+}
+
+double BistaticRangeObjectiveCPP::evaluate(double *grad,const double *x,double *scratch) const {
+    const size_t n=xDim;
+    double f=0;
+    size_t i, j;
+
+    fill(grad,grad+n,0.0);
+    for(i=0;i<numMeas;i++) {
+        const double *tx=&zTx[n*i];
+        const double *rx=&zRx[n*i];
+        double dTx=0, dRx=0, err;
+
+        for(j=0;j<n;j++) {
+            dTx+=(x[j]-tx[j])*(x[j]-tx[j]);
+            dRx+=(x[j]-rx[j])*(x[j]-rx[j]);
+        }
+        dTx=sqrt(dTx);
+        dRx=sqrt(dRx);
+
+        err=dTx+dRx-r[i];
+        f+=err*err;
+
+        //The gradient of a distance is the unit vector away from the
+        //point. At the point itself, the subgradient 0 is used.
+        for(j=0;j<n;j++) {
+            double dirSum=0;
+
+            if(dTx>0) {
+                dirSum+=(x[j]-tx[j])/dTx;
+            }
+            if(dRx>0) {
+                dirSum+=(x[j]-rx[j])/dRx;
+            }
+            grad[j]+=2*err*dirSum;
+        }
+    }
+    return f;
+}
+
+/*The factory functions for the built-in objective functions.*/
+
+static LBFGSObjectiveCPP *leastSquaresFactory(const ObjectiveParamCPP *params,const size_t numParams,const size_t xDim,const char **errMsg) {
+//The parameters are {A,b}.
+    size_t m;
+
+    if(numParams!=2) {
+        *errMsg="The leastSquares objective requires the parameters {A,b}.";
+        return NULL;
+    }
+
+    m=params[0].dims[0];
+    if(m==0||params[0].numel()!=m*xDim||params[1].numel()!=m) {
+        *errMsg="The dimensions of the leastSquares parameters are inconsistent.";
+        return NULL;
+    }
+
+    return new LeastSquaresObjectiveCPP(params[0].data,params[1].data,m,xDim);
+}
+
+static LBFGSObjectiveCPP *mahalanobisFactory(const ObjectiveParamCPP *params,const size_t numParams,const size_t xDim,const char **errMsg) {
+//The parameters are {A,b,R}, where A can be empty.
+    MahalanobisObjectiveCPP *objective;
+    size_t m;
+
+    if(numParams!=3) {
+        *errMsg="The mahalanobis objective requires the parameters {A,b,R}.";
+        return NULL;
+    }
+
+    m=params[1].numel();
+    if(m==0||(params[0].data==NULL?m!=xDim:params[0].numel()!=m*xDim||params[0].dims[0]!=m)||params[2].numel()!=m*m) {
+        *errMsg="The dimensions of the mahalanobis parameters are inconsistent.";
+        return NULL;
+    }
+
+    objective=new MahalanobisObjectiveCPP(params[0].data,params[1].data,params[2].data,m,xDim);
+    if(!objective->isValid) {
+        delete objective;
+        *errMsg="The covariance matrix of the mahalanobis objective is not positive definite.";
+        return NULL;
+    }
+    return objective;
+}
+
+static LBFGSObjectiveCPP *gaussMixNegLogLikeFactory(const ObjectiveParamCPP *params,const size_t numParams,const size_t xDim,const char **errMsg) {
+//The parameters are {w,mu,P}.
+    GaussMixNegLogLikeObjectiveCPP *objective;
+    size_t numComp;
+
+    if(numParams!=3) {
+        *errMsg="The gaussMixNegLogLike objective requires the parameters {w,mu,P}.";
+        return NULL;
+    }
+
+    numComp=params[0].numel();
+    if(numComp==0||params[1].dims[0]!=xDim||params[1].numel()!=xDim*numComp||params[2].dims[0]!=xDim||params[2].numel()!=xDim*xDim*numComp) {
+        *errMsg="The dimensions of the gaussMixNegLogLike parameters are inconsistent.";
+        return NULL;
+    }
+
+    objective=new GaussMixNegLogLikeObjectiveCPP(params[0].data,params[1].data,params[2].data,xDim,numComp);
+    if(!objective->isValid) {
+        delete objective;
+        *errMsg="The gaussMixNegLogLike objective requires nonnegative weights and positive definite covariance matrices.";
+        return NULL;
+    }
+    return objective;
+}
+
+static LBFGSObjectiveCPP *bistaticRangeFactory(const ObjectiveParamCPP *params,const size_t numParams,const size_t xDim,const char **errMsg) {
+//The parameters are {r,zTx,zRx}.
+    size_t numMeas, numRx;
+
+    if(numParams!=3) {
+        *errMsg="The bistaticRange objective requires the parameters {r,zTx,zRx}.";
+        return NULL;
+    }
+
+    numMeas=params[0].numel();
+    numRx=params[2].numel()/xDim;
+    if(numMeas==0||params[1].dims[0]!=xDim||params[1].numel()!=xDim*numMeas||params[2].dims[0]!=xDim||params[2].numel()!=xDim*numRx||(numRx!=1&&numRx!=numMeas)) {
+        *errMsg="The dimensions of the bistaticRange parameters are inconsistent.";
+        return NULL;
+    }
+
+    return new BistaticRangeObjectiveCPP(params[0].data,params[1].data,params[2].data,numMeas,numRx,xDim);
+}
+
+/*The registry. The list is created the first time that it is used, so it
+ *exists when objective functions are registered from the constructors of
+ *static objects in other files.
+ */
+static vector<pair<string,LBFGSObjectiveFactoryCPP> > &objectiveRegistry() {
+    static vector<pair<string,LBFGSObjectiveFactoryCPP> > registry;
+
+    if(registry.empty()) {
+        registry.push_back(make_pair(string("leastSquares"),&leastSquaresFactory));
+        registry.push_back(make_pair(string("mahalanobis"),&mahalanobisFactory));
+        registry.push_back(make_pair(string("gaussMixNegLogLike"),&gaussMixNegLogLikeFactory));
+        registry.push_back(make_pair(string("bistaticRange"),&bistaticRangeFactory));
+    }
+    return registry;
+}
+
+bool registerLBFGSObjectiveCPP(const char *name,LBFGSObjectiveFactoryCPP factory) {
+/*REGISTERLBFGSOBJECTIVECPP Add an objective function to the registry. The
+ *                  return value is false if the name is already taken, in
+ *                  which case nothing is changed.
+ */
+    vector<pair<string,LBFGSObjectiveFactoryCPP> > &registry=objectiveRegistry();
+
+    if(findLBFGSObjectiveCPP(name)!=NULL) {
+        return false;
+    }
+    registry.push_back(make_pair(string(name),factory));
+    return true;
+}
+
+LBFGSObjectiveFactoryCPP findLBFGSObjectiveCPP(const char *name) {
+/*FINDLBFGSOBJECTIVECPP Get the factory function of the objective function
+ *                  with the given name, or NULL if there is none.
+ */
+    const vector<pair<string,LBFGSObjectiveFactoryCPP> > &registry=objectiveRegistry();
+    size_t i;
+
+    for(i=0;i<registry.size();i++) {
+        if(registry[i].first==name) {
+            return registry[i].second;
+        }
+    }
+    return NULL;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,235 @@
+/**LBFGSPARAMSFROMMATLAB Functions for mex files that read the optional
+ *              parameters of the L-BFGS algorithm in the same format as
+ *              the quasiNewtonLBFGS function and the parameters of
+ *              objective functions for LBFGSNativeCPP. These are shared by
+ *              the mex files that call LBFGSNativeCPP so that all of them
+ *              accept their inputs in the same manner.
+ *
+ *The function LBFGSParamsFromMatlab sets param to the defaults of
+ *LBFGSDefaultParamsCPP and then reads the parameters numCorr, epsilon,
+ *deltaTestDist, delta, lineSearchParams, and maxIterations from
+ *prhs[firstIdx], prhs[firstIdx+1], ... if they are present and not empty.
+ *An error is raised using mexErrMsgTxt if a parameter is invalid.
+ *
+ *The function LBFGSObjectiveParamsFromMatlab points the elements of params
+ *to the real matrices in a cell array. Dimensions past the third are
+ *folded into the third. Empty matrices have a NULL data pointer.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef LBFGSPARAMSFROMMATLAB
+#define LBFGSPARAMSFROMMATLAB
+//For floor
+#include <cmath>
+#include <vector>
+#include "optimizationFuncs.hpp"
+#include "MexValidation.h"
+#include "mex.h"
+
+void LBFGSParamsFromMatlab(lbfgs_parameter_t *param,const int nrhs,const mxArray *prhs[],const int firstIdx,const size_t xDim) {
+    const mxArray **p=prhs+firstIdx;
+    const int numParams=nrhs-firstIdx;
+
+    LBFGSDefaultParamsCPP(param,xDim);
+
+    if(numParams>0&&!mxIsEmpty(p[0])) {
+        param->m=getSizeTFromMatlab(p[0]);
+    }
+
+    if(numParams>1&&!mxIsEmpty(p[1])) {
+        param->epsilon=getDoubleFromMatlab(p[1]);
+    }
+
+    if(numParams>2&&!mxIsEmpty(p[2])) {
+        param->past=getSizeTFromMatlab(p[2]);
+    }
+
+    if(numParams>3&&!mxIsEmpty(p[3])) {
+        param->delta=getDoubleFromMatlab(p[3]);
+    }
+
+    if(numParams>4&&!mxIsEmpty(p[4])) {
+        mxArray *theField;
+
+        if(!mxIsStruct(p[4])) {
+            mexErrMsgTxt("The line search parameters must be given in a structure.");
+        }
+
+        theField=mxGetField(p[4],0,"algorithm");
+        if(theField!=NULL&&!mxIsEmpty(theField)) {
+            switch(getIntFromMatlab(theField)) {
+                case 0:
+                    param->linesearch=LBFGS_LINESEARCH_MORETHUENTE;
+                    break;
+                case 1:
+                    param->linesearch=LBFGS_LINESEARCH_BACKTRACKING_ARMIJO;
+                    break;
+                case 2:
+                    param->linesearch=LBFGS_LINESEARCH_BACKTRACKING_WOLFE;
+                    break;
+                case 3:
+                    param->linesearch=LBFGS_LINESEARCH_BACKTRACKING_STRONG_WOLFE;
+                    break;
+                default:
+                    mexErrMsgTxt("Unknown line search algorithm specified.");
+            }
+        }
+
+        theField=mxGetField(p[4],0,"C");
+        if(theField!=NULL&&!mxIsEmpty(theField)) {
+            param->orthantwise_c=getDoubleFromMatlab(theField);
+        }
+
+        theField=mxGetField(p[4],0,"fTol");
+        if(theField!=NULL&&!mxIsEmpty(theField)) {
+            param->ftol=getDoubleFromMatlab(theField);
+        }
+
+        theField=mxGetField(p[4],0,"wolfeTol");
+        if(theField!=NULL&&!mxIsEmpty(theField)) {
+            param->wolfe=getDoubleFromMatlab(theField);
+            param->gtol=param->wolfe;
+        }
+
+        theField=mxGetField(p[4],0,"xTol");
+        if(theField!=NULL&&!mxIsEmpty(theField)) {
+            param->xtol=getDoubleFromMatlab(theField);
+        }
+
+        theField=mxGetField(p[4],0,"minStep");
+        if(theField!=NULL&&!mxIsEmpty(theField)) {
+            param->min_step=getDoubleFromMatlab(theField);
+        }
+
+        theField=mxGetField(p[4],0,"maxStep");
+        if(theField!=NULL&&!mxIsEmpty(theField)) {
+            param->max_step=getDoubleFromMatlab(theField);
+        }
+
+        theField=mxGetField(p[4],0,"maxIter");
+        if(theField!=NULL&&!mxIsEmpty(theField)) {
+            param->max_linesearch=getIntFromMatlab(theField);
+        }
+
+        theField=mxGetField(p[4],0,"l1NormRange");
+        if(theField!=NULL&&!mxIsEmpty(theField)) {
+            const double *indices;
+            double indexMin, indexMax;
+
+            checkRealDoubleArray(theField);
+            if(mxGetNumberOfElements(theField)!=2) {
+                mexErrMsgTxt("The size of l1NormRange is incorrect.");
+            }
+
+            indices=(const double*)mxGetData(theField);
+            if(indices[0]!=floor(indices[0])||indices[1]!=floor(indices[1])) {
+                mexErrMsgTxt("The indices in l1NormRange must be integers.");
+            }
+
+            if(indices[0]<indices[1]) {
+                indexMin=indices[0];
+                indexMax=indices[1];
+            } else {
+                indexMin=indices[1];
+                indexMax=indices[0];
+            }
+
+            if(indexMin<1||indexMax>xDim) {
+                mexErrMsgTxt("Invalid range given in l1NormRange.");
+            }
+
+            param->orthantwise_start=(int)indexMin-1;
+            param->orthantwise_end=(int)indexMax-1;
+        }
+    }
+
+    if(numParams>5&&!mxIsEmpty(p[5])) {
+        param->max_iterations=(int)getSizeTFromMatlab(p[5]);
+    }
+
+    //Check the inputs for validity.
+    if(param->epsilon<0) {
+        mexErrMsgTxt("The epsilon parameter must be nonnegative.");
+    }
+
+    if(param->delta<0) {
+        mexErrMsgTxt("The delta parameter must be nonnegative.");
+    }
+
+    if(param->ftol<0||((param->linesearch!=LBFGS_LINESEARCH_BACKTRACKING_ARMIJO)&&(param->wolfe<=param->ftol||1<=param->wolfe||param->wolfe<0))) {
+        mexErrMsgTxt("Invalid Wolfe parameter given.");
+    }
+
+    if(param->xtol<0) {
+        mexErrMsgTxt("Invalid XTol specified");
+    }
+
+    if(param->max_linesearch<=0) {
+        mexErrMsgTxt("Invalid maxIter specified");
+    }
+
+    if(param->orthantwise_c<0) {
+        mexErrMsgTxt("Invalid C value specified");
+    }
+
+    if(param->min_step<0) {
+        mexErrMsgTxt("Invalid minimum step size specified");
+    }
+
+    if(param->max_step<param->min_step) {
+        mexErrMsgTxt("The maximum step size is less than the minimum step size.");
+    }
+
+    if(param->orthantwise_c!=0&&param->linesearch==LBFGS_LINESEARCH_MORETHUENTE) {
+        mexErrMsgTxt("The More and Thuente algorithm cannot be used with C~=0.");
+    }
+}
+
+void LBFGSObjectiveParamsFromMatlab(std::vector<ObjectiveParamCPP> &params,const mxArray *paramCell) {
+    const size_t numParams=mxGetNumberOfElements(paramCell);
+    size_t i;
+
+    params.assign(numParams,ObjectiveParamCPP());
+    for(i=0;i<numParams;i++) {
+        const mxArray *curParam=mxGetCell(paramCell,i);
+        const mwSize *dims;
+        mwSize numDims, curDim;
+
+        if(curParam==NULL||mxIsEmpty(curParam)) {
+            continue;
+        }
+
+        checkRealDoubleHypermatrix(curParam);
+        numDims=mxGetNumberOfDimensions(curParam);
+        dims=mxGetDimensions(curParam);
+        params[i].data=(const double*)mxGetData(curParam);
+        params[i].dims[0]=dims[0];
+        params[i].dims[1]=dims[1];
+        params[i].dims[2]=1;
+        for(curDim=2;curDim<numDims;curDim++) {
+            params[i].dims[2]*=dims[curDim];
+        }
+    }
+}
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
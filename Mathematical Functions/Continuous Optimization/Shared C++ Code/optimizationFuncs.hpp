@@ -0,0 +1,241 @@
+/**OPTIMIZATIONFUNCS A header file for C++ implementations of optimization
+ *          algorithms whose objective functions are evaluated in compiled
+ *          code and for the interface that such objective functions must
+ *          implement. See the files implementing each function for more
+ *          details.
+ *
+ *The L-BFGS routines here use the same liblbfgs library as the Matlab
+ *function quasiNewtonLBFGS, except that rather than calling a Matlab
+ *function handle for the objective function and its gradient, they call a
+ *C++ class derived from LBFGSObjectiveCPP. Since no Matlab functions are
+ *called, many independent problems can be optimized in parallel. Objective
+ *functions are looked up by name in a registry, so that new objective
+ *functions can be added without modifying the Matlab interface.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef OPTIMIZATIONFUNCSCPP
+#define OPTIMIZATIONFUNCSCPP
+#include <stddef.h>
+#include <vector>
+
+/*The header for the L-BFGS library with the definition making sure that
+ *double precision floating point values are used.*/
+#define LBFGS_FLOAT 64
+#include "lbfgs.h"
+
+/**The LBFGSObjectiveCPP class is the interface for an objective function
+ * f(x) to be minimized, where x is an xDim-dimensional vector. evaluate
+ * must return f(x) and put the gradient of f at x into grad. scratch
+ * points to numScratch() doubles of temporary space that the function can
+ * use. evaluate must be safe to call from multiple threads at once with
+ * different scratch space.
+ **/
+class LBFGSObjectiveCPP {
+public:
+    size_t xDim;
+
+    LBFGSObjectiveCPP(const size_t xDimDes) : xDim(xDimDes) {}
+    virtual double evaluate(double *grad,const double *x,double *scratch) const=0;
+    virtual size_t numScratch() const;
+    virtual ~LBFGSObjectiveCPP() {}
+};
+
+/**The LeastSquaresObjectiveCPP class implements f(x)=norm(A*x-b)^2, where
+ * A is mXxDim, stored by column, and b is mX1. A and b are copied.
+ **/
+class LeastSquaresObjectiveCPP : public LBFGSObjectiveCPP {
+public:
+    LeastSquaresObjectiveCPP(const double *ADes,const double *bDes,const size_t mDes,const size_t xDimDes);
+    double evaluate(double *grad,const double *x,double *scratch) const;
+    size_t numScratch() const;
+protected:
+    size_t m;
+    std::vector<double> A;
+    std::vector<double> b;
+
+    LeastSquaresObjectiveCPP(const size_t mDes,const size_t xDimDes) : LBFGSObjectiveCPP(xDimDes), m(mDes), A(mDes*xDimDes), b(mDes) {}
+};
+
+/**The MahalanobisObjectiveCPP class implements
+ * f(x)=(A*x-b)'*inv(R)*(A*x-b), where A is mXxDim, b is mX1 and R is an
+ * mXm positive definite covariance matrix. If A is NULL, then it is taken
+ * to be the identity matrix (m=xDim). With R=L*L', this is the same as
+ * norm(L\(A*x-b))^2, so the whitened A and b are stored when the object is
+ * constructed. isValid is false if R is not positive definite.
+ **/
+class MahalanobisObjectiveCPP : public LeastSquaresObjectiveCPP {
+public:
+    bool isValid;
+
+    MahalanobisObjectiveCPP(const double *ADes,const double *bDes,const double *RDes,const size_t mDes,const size_t xDimDes);
+};
+
+/**The GaussMixNegLogLikeObjectiveCPP class implements the negative
+ * logarithm of a Gaussian mixture probability density function,
+ * f(x)=-log(sum_k w(k)*N(x;mu(:,k),P(:,:,k))), whose minimum is the
+ * highest mode of the mixture. w is numCompX1, mu is xDimXnumComp and P is
+ * xDimXxDimXnumComp. The weights need not sum to one. The Cholesky
+ * decompositions of the covariance matrices are computed and stored when
+ * the object is constructed. isValid is false if a covariance matrix is
+ * not positive definite or a weight is negative.
+ **/
+class GaussMixNegLogLikeObjectiveCPP : public LBFGSObjectiveCPP {
+public:
+    bool isValid;
+
+    GaussMixNegLogLikeObjectiveCPP(const double *w,const double *mu,const double *P,const size_t xDimDes,const size_t numCompDes);
+    double evaluate(double *grad,const double *x,double *scratch) const;
+    size_t numScratch() const;
+private:
+    size_t numComp;
+    //The logarithms of the weights times the normalizing constants.
+    std::vector<double> logCoeffs;
+    std::vector<double> mu;
+    std::vector<double> L;
+};
+
+/**The BistaticRangeObjectiveCPP class implements the least-squares cost
+ * function for localizing a stationary target from bistatic range
+ * measurements, f(x)=sum_i (norm(x-zTx(:,i))+norm(x-zRx(:,i))-r(i))^2,
+ * where zTx and zRx are xDimXnumMeas matrices of the transmitter and
+ * receiver locations. If only one receiver location is given (numRx=1),
+ * it is used for all of the measurements. The same cost function is used
+ * in rangeOnlyStaticLocEst. It generally has more than one local minimum,
+ * which makes it a candidate for LBFGSMultiStartCPP.
+ **/
+class BistaticRangeObjectiveCPP : public LBFGSObjectiveCPP {
+public:
+    BistaticRangeObjectiveCPP(const double *rDes,const double *zTxDes,const double *zRxDes,const size_t numMeasDes,const size_t numRx,const size_t xDimDes);
+    double evaluate(double *grad,const double *x,double *scratch) const;
+private:
+    size_t numMeas;
+    std::vector<double> r;
+    std::vector<double> zTx;
+    std::vector<double> zRx;
+};
+
+/**The ObjectiveParamCPP class holds a real numeric parameter passed to a
+ * factory function that creates an objective function. The data are
+ * stored by column with dimensions dims[0]Xdims[1]Xdims[2] and are not
+ * copied. data is NULL if the parameter is empty.
+ **/
+class ObjectiveParamCPP {
+public:
+    const double *data;
+    size_t dims[3];
+
+    ObjectiveParamCPP() : data(NULL) {
+        dims[0]=0;
+        dims[1]=0;
+        dims[2]=0;
+    }
+
+    size_t numel() const {
+        return dims[0]*dims[1]*dims[2];
+    }
+};
+
+/*A factory function creates an objective function with the given
+ *parameters for an xDim-dimensional state. It returns NULL and sets
+ *errMsg if the parameters are invalid. The returned object is freed with
+ *delete.
+ */
+typedef LBFGSObjectiveCPP *(*LBFGSObjectiveFactoryCPP)(const ObjectiveParamCPP *params,const size_t numParams,const size_t xDim,const char **errMsg);
+
+//The registry of objective functions by name. The built-in objective
+//functions are 'leastSquares', 'mahalanobis', 'gaussMixNegLogLike' and
+//'bistaticRange'.
+bool registerLBFGSObjectiveCPP(const char *name,LBFGSObjectiveFactoryCPP factory);
+LBFGSObjectiveFactoryCPP findLBFGSObjectiveCPP(const char *name);
+
+/**An LBFGSObjectiveRegistrarCPP object declared at file scope in a source
+ * file registers an objective function when the program is loaded. This
+ * is the plugin interface: to add a new objective function, derive a class
+ * from LBFGSObjectiveCPP, write a factory function for it and put
+ * static LBFGSObjectiveRegistrarCPP registrar("myObjective",&myFactory);
+ * in the same file. The file is then compiled with the Matlab interface
+ * quasiNewtonLBFGSNative and the objective function can be used by name.
+ **/
+class LBFGSObjectiveRegistrarCPP {
+public:
+    LBFGSObjectiveRegistrarCPP(const char *name,LBFGSObjectiveFactoryCPP factory) {
+        registerLBFGSObjectiveCPP(name,factory);
+    }
+};
+
+//Default parameters for the L-BFGS algorithm, which are the same as in
+//quasiNewtonLBFGS.
+void LBFGSDefaultParamsCPP(lbfgs_parameter_t *param,const size_t xDim);
+//Minimize an objective function starting from x, which is replaced by
+//the solution. The return value is the exit code of liblbfgs.
+int LBFGSNativeCPP(double *x,double *fMin,const LBFGSObjectiveCPP &objective,lbfgs_parameter_t *param);
+//The same, except that progress(progressData,x,fx,gnorm,k) is called after
+//each iteration k, as with the progress callback of quasiNewtonLBFGS. The
+//optimization is cancelled if progress returns a nonzero value, which is
+//then returned as the exit code.
+typedef int (*LBFGSNativeProgressCPP)(void *progressData,const double *x,const double fx,const double gnorm,const int k);
+int LBFGSNativeCPP(double *x,double *fMin,const LBFGSObjectiveCPP &objective,lbfgs_parameter_t *param,LBFGSNativeProgressCPP progress,void *progressData);
+
+/**The LBFGSMultiStartCPP class runs LBFGSNativeCPP from many starting
+ * points in parallel and collects the distinct local minima that are
+ * found. Two solutions are taken to be the same minimum if
+ * norm(x1-x2)<=dedupTol*max(1,norm(x2)). If cancelTol>0, then a start
+ * whose iterate comes within cancelTol*max(1,norm(xMin)) of an already
+ * found minimum xMin with a cost that is not lower is cancelled after
+ * minCancelIter iterations and counted as having gone to that minimum.
+ * After run, the minima are sorted by increasing cost, basinCount holds
+ * the number of starts that went to each minimum, and for each start,
+ * startMinIdx holds the index of the minimum that it went to, or
+ * numMinima() if it failed.
+ **/
+class LBFGSMultiStartCPP {
+public:
+    std::vector<double> xMin;
+    std::vector<double> fMin;
+    std::vector<size_t> basinCount;
+    std::vector<size_t> startMinIdx;
+    std::vector<int> exitCodes;
+
+    LBFGSMultiStartCPP(const LBFGSObjectiveCPP &objectiveDes,const lbfgs_parameter_t &paramDes,const double dedupTolDes,const double cancelTolDes,const int minCancelIterDes) : objective(objectiveDes), param(paramDes), dedupTol(dedupTolDes), cancelTol(cancelTolDes), minCancelIter(minCancelIterDes) {}
+    void run(const double *starts,const size_t numStarts);
+    size_t numMinima() const {
+        return fMin.size();
+    }
+    size_t findMinimum(const double *x,const double tol) const;
+private:
+    const LBFGSObjectiveCPP &objective;
+    lbfgs_parameter_t param;
+    double dedupTol;
+    double cancelTol;
+    int minCancelIter;
+
+    size_t addMinimum(const double *x,const double f);
+    static int cancelIfKnownBasin(void *progressData,const double *x,const double fx,const double gnorm,const int k);
+};
+
+//Fill the xDimXnumPoints matrix points with the Halton quasi-random
+//sequence scaled to the box with the given lower and upper bounds.
+void HaltonPointsCPP(double *points,const double *lowerBound,const double *upperBound,const size_t xDim,const size_t numPoints);
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,835 @@
+/**SPARSELMCPP A C++ implementation of the Levenberg-Marquardt algorithm for
+ *          nonlinear least squares problems with sparse Jacobian matrices,
+ *          such as the registration of many sensors using measurements of
+ *          many targets.
+ *
+ *The iterations are the same as in the Matlab function LSEstLMarquardt,
+ *which implements Algorithm 3.16 of
+ *K. Madsen, H. B. Nielsen, and O. Tingleff, "Methods for non-linear
+ *least squares problems," Informatics and Mathematical Modelling,
+ *Technical University of Denmark, Tech. Rep., Apr. 2004.
+ *with an analytic Jacobian. However, rather than forming J'*J as a dense
+ *matrix, the sparsity of the Jacobian J is used in one of two ways:
+ *1) The upper triangle of J'*J is formed as a sparse matrix and the damped
+ *   normal equations are solved with an up-looking sparse Cholesky
+ *   decomposition, which is described in Chapter 4 of
+ *   T. A. Davis, Direct Methods for Sparse Linear Systems. Philadelphia:
+ *   SIAM, 2006.
+ *   The elimination tree and the pattern of the factor are found once, so
+ *   each iteration only performs the numeric factorization. The
+ *   parameters are not reordered, so they should be ordered such that
+ *   there is little fill-in; for example, parameters that interact with
+ *   many others should come last.
+ *2) If the parameters consist of a small number of reduced parameters
+ *   (for example, sensor biases) followed by many independent blocks (for
+ *   example, target states), where each residual involves at most one
+ *   block, then J'*J=[U,W;W',V] where V is block diagonal. The blocks are
+ *   eliminated using the Schur complement
+ *   S=U+mu*I-W*inv(V+mu*I)*W'
+ *   as in bundle adjustment (see Section 6 of B. Triggs, P. F. McLauchlan,
+ *   R. I. Hartley, and A. W. Fitzgibbon, "Bundle adjustment - a modern
+ *   synthesis," in Vision Algorithms: Theory and Practice, 2000,
+ *   pp. 298-372), S is solved with a dense Cholesky decomposition and the
+ *   steps of the blocks are found by back substitution. The blocks are
+ *   independent, so their contributions are computed in parallel if
+ *   OpenMP is available.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy, fill and lower_bound
+#include <algorithm>
+//For sqrt and fabs
+#include <math.h>
+//For DBL_EPSILON
+#include <float.h>
+#include "matrixFuncs.hpp"
+#include "sparseLMCPP.hpp"
+
+using namespace std;
+
+static const size_t noIdx=(size_t)-1;
+
+static bool isFiniteVal(const double val) {
+    return val-val==0;
+}
+
+SparseLMSolverCPP::SparseLMSolverCPP(const SparseLSProblemCPP &problemDes,const size_t numReducedDes,const size_t blockDimDes) : isValid(true), problem(problemDes), numReduced(numReducedDes), blockDim(blockDimDes), numBlocks(0), maxDiag(0) {
+    const size_t n=problem.numParams;
+    const size_t m=problem.numResid;
+    const size_t nnz=problem.rowStart[m];
+    size_t r, p, j;
+
+    f.resize(m);
+    JVals.resize(nnz);
+    g.resize(n);
+    work.resize(n);
+    mark.resize(n);
+
+    //Transpose the pattern of J.
+    JColStart.assign(n+1,0);
+    JColRow.resize(nnz);
+    JColPos.resize(nnz);
+    for(p=0;p<nnz;p++) {
+        JColStart[problem.colIdx[p]+1]++;
+    }
+    for(j=0;j<n;j++) {
+        JColStart[j+1]+=JColStart[j];
+    }
+    {
+        vector<size_t> nextPos(JColStart.begin(),JColStart.end()-1);
+
+        for(r=0;r<m;r++) {
+            for(p=problem.rowStart[r];p<problem.rowStart[r+1];p++) {
+                const size_t q=nextPos[problem.colIdx[p]]++;
+
+                JColRow[q]=r;
+                JColPos[q]=p;
+            }
+        }
+    }
+
+    if(blockDim>0) {
+        isValid=setupSchur();
+    } else {
+        symbolicCholesky();
+    }
+}
+
+void SparseLMSolverCPP::symbolicCholesky() {
+/*SYMBOLICCHOLESKY Find the pattern of the upper triangle of A=J'*J, the
+ *              elimination tree of A and the pattern of the columns of
+ *              the Cholesky factor L.
+ */
+    const size_t n=problem.numParams;
+    vector<size_t> ancestor(n);
+    vector<size_t> colCount(n,1);
+    size_t j, k, p, q;
+
+    //The pattern of the upper triangle of A. Column j holds the rows i<=j
+    //such that some row of J has nonzero elements in columns i and j. The
+    //diagonal is always included.
+    Ap.assign(n+1,0);
+    Ai.clear();
+    fill(mark.begin(),mark.end(),noIdx);
+    for(j=0;j<n;j++) {
+        mark[j]=j;
+        Ai.push_back(j);
+        for(q=JColStart[j];q<JColStart[j+1];q++) {
+            const size_t r=JColRow[q];
+
+            for(p=problem.rowStart[r];p<problem.rowStart[r+1];p++) {
+                const size_t i=problem.colIdx[p];
+
+                if(i<j&&mark[i]!=j) {
+                    mark[i]=j;
+                    Ai.push_back(i);
+                }
+            }
+        }
+        Ap[j+1]=Ai.size();
+    }
+    Ax.resize(Ai.size());
+
+    //The elimination tree, as in cs_etree of Davis.
+    parent.assign(n,noIdx);
+    ancestor.assign(n,noIdx);
+    for(k=0;k<n;k++) {
+        for(p=Ap[k];p<Ap[k+1];p++) {
+            size_t i=Ai[p];
+
+            while(i!=noIdx&&i<k) {
+                const size_t iNext=ancestor[i];
+
+                ancestor[i]=k;
+                if(iNext==noIdx) {
+                    parent[i]=k;
+                }
+                i=iNext;
+            }
+        }
+    }
+
+    //The number of nonzero elements in each column of L is found from the
+    //patterns of the rows of L.
+    stack.resize(n);
+    fill(mark.begin(),mark.end(),noIdx);
+    for(k=0;k<n;k++) {
+        const size_t top=ereach(k);
+
+        for(p=top;p<n;p++) {
+            colCount[stack[p]]++;
+        }
+    }
+
+    Lp.assign(n+1,0);
+    for(j=0;j<n;j++) {
+        Lp[j+1]=Lp[j]+colCount[j];
+    }
+    Li.resize(Lp[n]);
+    Lx.resize(Lp[n]);
+}
+
+size_t SparseLMSolverCPP::ereach(const size_t k) {
+/*EREACH Find the pattern of the off-diagonal part of row k of L, which is
+ *       the set of nodes reachable in the elimination tree from the
+ *       nonzero elements of column k of the upper triangle of A. The
+ *       pattern is put in stack[top],...,stack[n-1], where top is
+ *       returned, in topological order, as in cs_ereach of Davis. mark
+ *       must not contain k on entry.
+ */
+    const size_t n=problem.numParams;
+    size_t top=n;
+    size_t p;
+
+    mark[k]=k;
+    for(p=Ap[k];p<Ap[k+1];p++) {
+        size_t i=Ai[p];
+        size_t len=0;
+
+        if(i>k) {
+            continue;
+        }
+
+        //Climb the tree until a marked node is found.
+        while(mark[i]!=k) {
+            stack[len++]=i;
+            mark[i]=k;
+            i=parent[i];
+        }
+
+        //Push the path onto the stack.
+        while(len>0) {
+            stack[--top]=stack[--len];
+        }
+    }
+    return top;
+}
+
+bool SparseLMSolverCPP::setupSchur() {
+/*SETUPSCHUR Find the rows of J involving each block and the reduced
+ *           parameters that each block interacts with. The return value is
+ *           false if a row involves more than one block or the number of
+ *           non-reduced parameters is not a multiple of blockDim.
+ */
+    const size_t n=problem.numParams;
+    const size_t m=problem.numResid;
+    vector<size_t> rowBlock(m,noIdx);
+    size_t r, p, b;
+
+    if(numReduced>n||(n-numReduced)%blockDim!=0) {
+        return false;
+    }
+    numBlocks=(n-numReduced)/blockDim;
+
+    blockRowStart.assign(numBlocks+1,0);
+    for(r=0;r<m;r++) {
+        for(p=problem.rowStart[r];p<problem.rowStart[r+1];p++) {
+            const size_t c=problem.colIdx[p];
+
+            if(c>=numReduced) {
+                b=(c-numReduced)/blockDim;
+                if(rowBlock[r]!=noIdx&&rowBlock[r]!=b) {
+                    return false;
+                }
+                rowBlock[r]=b;
+            }
+        }
+        if(rowBlock[r]!=noIdx) {
+            blockRowStart[rowBlock[r]+1]++;
+        }
+    }
+    for(b=0;b<numBlocks;b++) {
+        blockRowStart[b+1]+=blockRowStart[b];
+    }
+    blockRows.resize(blockRowStart[numBlocks]);
+    {
+        vector<size_t> nextPos(blockRowStart.begin(),blockRowStart.end()-1);
+
+        for(r=0;r<m;r++) {
+            if(rowBlock[r]!=noIdx) {
+                blockRows[nextPos[rowBlock[r]]++]=r;
+            }
+        }
+    }
+
+    //The sorted reduced parameters that appear in the rows of each block.
+    blockColStart.assign(numBlocks+1,0);
+    blockCols.clear();
+    fill(mark.begin(),mark.end(),noIdx);
+    for(b=0;b<numBlocks;b++) {
+        size_t q;
+
+        for(q=blockRowStart[b];q<blockRowStart[b+1];q++) {
+            r=blockRows[q];
+            for(p=problem.rowStart[r];p<problem.rowStart[r+1];p++) {
+                const size_t c=problem.colIdx[p];
+
+                if(c<numReduced&&mark[c]!=b) {
+                    mark[c]=b;
+                    blockCols.push_back(c);
+                }
+            }
+        }
+        blockColStart[b+1]=blockCols.size();
+        sort(blockCols.begin()+blockColStart[b],blockCols.end());
+    }
+
+    U.resize(numReduced*numReduced);
+    S.resize(numReduced*numReduced);
+    V.resize(numBlocks*blockDim*blockDim);
+    LV.resize(numBlocks*blockDim*blockDim);
+    W.resize(blockCols.size()*blockDim);
+    Yt.resize(blockCols.size()*blockDim);
+    zB.resize(numBlocks*blockDim);
+    return true;
+}
+
+bool SparseLMSolverCPP::evalNormalEq(const double *x,double *cost) {
+/*EVALNORMALEQ Evaluate f and J at x, the cost (1/2)*f'*f, the gradient
+ *             g=J'*f and the parts of J'*J that are needed to solve for
+ *             the step. The return value is false if a nonfinite value
+ *             arises.
+ */
+    const size_t n=problem.numParams;
+    const size_t m=problem.numResid;
+    size_t r, p, q, j;
+
+    if(!problem.evaluate(&f[0],JVals.empty()?NULL:&JVals[0],x)) {
+        return false;
+    }
+
+    *cost=0;
+    for(r=0;r<m;r++) {
+        *cost+=f[r]*f[r];
+    }
+    *cost/=2;
+    if(!isFiniteVal(*cost)) {
+        return false;
+    }
+
+    //The gradient and the largest diagonal element of J'*J.
+    maxDiag=0;
+    for(j=0;j<n;j++) {
+        double gVal=0, diagVal=0;
+
+        for(q=JColStart[j];q<JColStart[j+1];q++) {
+            const double JVal=JVals[JColPos[q]];
+
+            gVal+=JVal*f[JColRow[q]];
+            diagVal+=JVal*JVal;
+        }
+        g[j]=gVal;
+        maxDiag=max(maxDiag,diagVal);
+        if(!isFiniteVal(gVal)||!isFiniteVal(diagVal)) {
+            return false;
+        }
+    }
+
+    if(blockDim==0) {
+        //The upper triangle of A=J'*J, column by column, using work to
+        //accumulate the column densely.
+        for(j=0;j<n;j++) {
+            for(q=JColStart[j];q<JColStart[j+1];q++) {
+                const size_t row=JColRow[q];
+                const double JVal=JVals[JColPos[q]];
+
+                for(p=problem.rowStart[row];p<problem.rowStart[row+1];p++) {
+                    const size_t i=problem.colIdx[p];
+
+                    if(i<=j) {
+                        work[i]+=JVals[p]*JVal;
+                    }
+                }
+            }
+
+            for(p=Ap[j];p<Ap[j+1];p++) {
+                Ax[p]=work[Ai[p]];
+                work[Ai[p]]=0;
+            }
+        }
+        return true;
+    }
+
+    //The dense part for the reduced parameters, to which all rows
+    //contribute.
+    fill(U.begin(),U.end(),0.0);
+    for(r=0;r<m;r++) {
+        for(p=problem.rowStart[r];p<problem.rowStart[r+1];p++) {
+            const size_t c1=problem.colIdx[p];
+
+            if(c1>=numReduced) {
+                continue;
+            }
+            for(q=problem.rowStart[r];q<problem.rowStart[r+1];q++) {
+                const size_t c2=problem.colIdx[q];
+
+                if(c2<numReduced) {
+                    U[c1+c2*numReduced]+=JVals[p]*JVals[q];
+                }
+            }
+        }
+    }
+
+    //The diagonal and off-diagonal blocks for each block of parameters.
+    {
+        ptrdiff_t b;
+
+        #pragma omp parallel for schedule(dynamic)
+        for(b=0;b<(ptrdiff_t)numBlocks;b++) {
+            const size_t firstCol=numReduced+b*blockDim;
+            const size_t *colsBegin=&blockCols[0]+blockColStart[b];
+            const size_t *colsEnd=&blockCols[0]+blockColStart[b+1];
+            const size_t numCols=blockColStart[b+1]-blockColStart[b];
+            double *VCur=&V[b*blockDim*blockDim];
+            double *WCur=numCols>0?&W[blockColStart[b]*blockDim]:NULL;
+            size_t curRow, p1, p2;
+
+            fill(VCur,VCur+blockDim*blockDim,0.0);
+            if(numCols>0) {
+                fill(WCur,WCur+numCols*blockDim,0.0);
+            }
+
+            for(curRow=blockRowStart[b];curRow<blockRowStart[b+1];curRow++) {
+                const size_t row=blockRows[curRow];
+
+                for(p1=problem.rowStart[row];p1<problem.rowStart[row+1];p1++) {
+                    const size_t c1=problem.colIdx[p1];
+
+                    if(c1<numReduced) {
+                        continue;
+                    }
+
+                    for(p2=problem.rowStart[row];p2<problem.rowStart[row+1];p2++) {
+                        const size_t c2=problem.colIdx[p2];
+                        const double prod=JVals[p1]*JVals[p2];
+
+                        if(c2>=numReduced) {
+                            VCur[(c2-firstCol)+(c1-firstCol)*blockDim]+=prod;
+                        } else {
+                            const size_t localCol=lower_bound(colsBegin,colsEnd,c2)-colsBegin;
+
+                            WCur[localCol+(c1-firstCol)*numCols]+=prod;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+bool SparseLMSolverCPP::solveForStep(double *h,const double mu) {
+/*SOLVEFORSTEP Solve (J'*J+mu*I)*h=-g. The return value is false if the
+ *             damped matrix is not numerically positive definite.
+ */
+    if(blockDim==0) {
+        return sparseCholSolve(h,mu);
+    }
+    return schurSolve(h,mu);
+}
+
+bool SparseLMSolverCPP::sparseCholSolve(double *h,const double mu) {
+/*SPARSECHOLSOLVE Solve for the step using the up-looking sparse Cholesky
+ *              decomposition of cs_chol of Davis, in which row k of L is
+ *              found by a sparse triangular solve with the pattern given
+ *              by ereach.
+ */
+    const size_t n=problem.numParams;
+    vector<size_t> nextPos(Lp.begin(),Lp.end()-1);
+    double minLDiag=0, maxLDiag=0;
+    size_t k, p;
+
+    fill(mark.begin(),mark.end(),noIdx);
+    for(k=0;k<n;k++) {
+        size_t top=ereach(k);
+        double d;
+
+        //Scatter column k of the upper triangle of A+mu*I into work.
+        for(p=Ap[k];p<Ap[k+1];p++) {
+            work[Ai[p]]=Ax[p];
+        }
+        d=work[k]+mu;
+        work[k]=0;
+
+        for(;top<n;top++) {
+            const size_t i=stack[top];
+            //L(k,i)
+            const double lki=work[i]/Lx[Lp[i]];
+
+            work[i]=0;
+            for(p=Lp[i]+1;p<nextPos[i];p++) {
+                work[Li[p]]-=Lx[p]*lki;
+            }
+            d-=lki*lki;
+
+            p=nextPos[i]++;
+            Li[p]=k;
+            Lx[p]=lki;
+        }
+
+        if(!(d>0)||!isFiniteVal(d)) {
+            //Clear the scratch space for the next attempt.
+            fill(work.begin(),work.end(),0.0);
+            return false;
+        }
+        d=sqrt(d);
+
+        p=nextPos[k]++;
+        Li[p]=k;
+        Lx[p]=d;
+
+        if(k==0) {
+            minLDiag=d;
+            maxLDiag=d;
+        } else {
+            minLDiag=min(minLDiag,d);
+            maxLDiag=max(maxLDiag,d);
+        }
+    }
+
+    //Reject nearly singular systems in the same manner as the rcond test
+    //in LSEstLMarquardt.
+    if(!(minLDiag*minLDiag>DBL_EPSILON*maxLDiag*maxLDiag)) {
+        return false;
+    }
+
+    //Solve L*y=-g and then L'*h=y.
+    for(k=0;k<n;k++) {
+        h[k]=-g[k];
+    }
+    for(k=0;k<n;k++) {
+        h[k]/=Lx[Lp[k]];
+        for(p=Lp[k]+1;p<Lp[k+1];p++) {
+            h[Li[p]]-=Lx[p]*h[k];
+        }
+    }
+    for(k=n;k-->0;) {
+        for(p=Lp[k]+1;p<Lp[k+1];p++) {
+            h[k]-=Lx[p]*h[Li[p]];
+        }
+        h[k]/=Lx[Lp[k]];
+        if(!isFiniteVal(h[k])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool SparseLMSolverCPP::schurSolve(double *h,const double mu) {
+/*SCHURSOLVE Solve for the step by eliminating the blocks. With
+ *           Yt_b=inv(V_b+mu*I)*W_b' and zB_b=inv(V_b+mu*I)*g_b, the
+ *           reduced system is S*hR=-gR+sum_b W_b*zB_b, where
+ *           S=U+mu*I-sum_b W_b*Yt_b, and then hB_b=-zB_b-Yt_b*hR.
+ */
+    const size_t bb=blockDim*blockDim;
+    vector<double> blockMinDiag(numBlocks), blockMaxDiag(numBlocks);
+    vector<char> blockIsPosDef(numBlocks);
+    double minLDiag=0, maxLDiag=0;
+    bool haveDiag=false;
+    size_t i, j, b;
+
+    {
+        ptrdiff_t curBlock;
+
+        #pragma omp parallel for schedule(dynamic)
+        for(curBlock=0;curBlock<(ptrdiff_t)numBlocks;curBlock++) {
+            const size_t numCols=blockColStart[curBlock+1]-blockColStart[curBlock];
+            double *VDamped=&LV[curBlock*bb];
+            double *zCur=&zB[curBlock*blockDim];
+            size_t k, l;
+
+            copy(V.begin()+curBlock*bb,V.begin()+(curBlock+1)*bb,VDamped);
+            for(k=0;k<blockDim;k++) {
+                VDamped[k+k*blockDim]+=mu;
+            }
+
+            blockIsPosDef[curBlock]=cholLowerCPP(VDamped,VDamped,blockDim);
+            if(!blockIsPosDef[curBlock]) {
+                continue;
+            }
+
+            blockMinDiag[curBlock]=VDamped[0];
+            blockMaxDiag[curBlock]=VDamped[0];
+            for(k=1;k<blockDim;k++) {
+                blockMinDiag[curBlock]=min(blockMinDiag[curBlock],VDamped[k+k*blockDim]);
+                blockMaxDiag[curBlock]=max(blockMaxDiag[curBlock],VDamped[k+k*blockDim]);
+            }
+
+            copy(g.begin()+numReduced+curBlock*blockDim,g.begin()+numReduced+(curBlock+1)*blockDim,zCur);
+            cholSolveCPP(zCur,VDamped,blockDim,1);
+
+            if(numCols>0) {
+                const double *WCur=&W[blockColStart[curBlock]*blockDim];
+                double *YtCur=&Yt[blockColStart[curBlock]*blockDim];
+
+                //Yt=W', which is blockDimXnumCols.
+                for(k=0;k<numCols;k++) {
+                    for(l=0;l<blockDim;l++) {
+                        YtCur[l+k*blockDim]=WCur[k+l*numCols];
+                    }
+                }
+                cholSolveCPP(YtCur,VDamped,blockDim,numCols);
+            }
+        }
+    }
+
+    for(b=0;b<numBlocks;b++) {
+        if(!blockIsPosDef[b]) {
+            return false;
+        }
+        if(!haveDiag) {
+            minLDiag=blockMinDiag[b];
+            maxLDiag=blockMaxDiag[b];
+            haveDiag=true;
+        } else {
+            minLDiag=min(minLDiag,blockMinDiag[b]);
+            maxLDiag=max(maxLDiag,blockMaxDiag[b]);
+        }
+    }
+
+    if(numReduced>0) {
+        double *hR=h;
+
+        //Form the Schur complement and the reduced right-hand side.
+        copy(U.begin(),U.end(),S.begin());
+        for(i=0;i<numReduced;i++) {
+            S[i+i*numReduced]+=mu;
+            hR[i]=-g[i];
+        }
+
+        for(b=0;b<numBlocks;b++) {
+            const size_t numCols=blockColStart[b+1]-blockColStart[b];
+            const size_t *cols=&blockCols[0]+blockColStart[b];
+            const double *WCur, *YtCur, *zCur=&zB[b*blockDim];
+            size_t k;
+
+            if(numCols==0) {
+                continue;
+            }
+            WCur=&W[blockColStart[b]*blockDim];
+            YtCur=&Yt[blockColStart[b]*blockDim];
+
+            for(j=0;j<numCols;j++) {
+                double sum=0;
+
+                for(k=0;k<blockDim;k++) {
+                    sum+=WCur[j+k*numCols]*zCur[k];
+                }
+                hR[cols[j]]+=sum;
+
+                for(i=0;i<numCols;i++) {
+                    sum=0;
+                    for(k=0;k<blockDim;k++) {
+                        sum+=WCur[i+k*numCols]*YtCur[k+j*blockDim];
+                    }
+                    S[cols[i]+cols[j]*numReduced]-=sum;
+                }
+            }
+        }
+        symmetrizeCPP(&S[0],numReduced);
+
+        if(!cholLowerCPP(&S[0],&S[0],numReduced)) {
+            return false;
+        }
+        for(i=0;i<numReduced;i++) {
+            const double diagVal=S[i+i*numReduced];
+
+            if(!haveDiag) {
+                minLDiag=diagVal;
+                maxLDiag=diagVal;
+                haveDiag=true;
+            } else {
+                minLDiag=min(minLDiag,diagVal);
+                maxLDiag=max(maxLDiag,diagVal);
+            }
+        }
+        cholSolveCPP(hR,&S[0],numReduced,1);
+    }
+
+    //Reject nearly singular systems in the same manner as the rcond test
+    //in LSEstLMarquardt.
+    if(!(minLDiag*minLDiag>DBL_EPSILON*maxLDiag*maxLDiag)) {
+        return false;
+    }
+
+    //Back substitution for the blocks.
+    {
+        ptrdiff_t curBlock;
+
+        #pragma omp parallel for schedule(dynamic)
+        for(curBlock=0;curBlock<(ptrdiff_t)numBlocks;curBlock++) {
+            const size_t numCols=blockColStart[curBlock+1]-blockColStart[curBlock];
+            const size_t *cols=numCols>0?&blockCols[0]+blockColStart[curBlock]:NULL;
+            const double *YtCur=numCols>0?&Yt[blockColStart[curBlock]*blockDim]:NULL;
+            const double *zCur=&zB[curBlock*blockDim];
+            double *hB=h+numReduced+curBlock*blockDim;
+            size_t k, l;
+
+            for(k=0;k<blockDim;k++) {
+                double sum=-zCur[k];
+
+                for(l=0;l<numCols;l++) {
+                    sum-=YtCur[k+l*blockDim]*h[cols[l]];
+                }
+                hB[k]=sum;
+            }
+        }
+    }
+
+    for(i=0;i<problem.numParams;i++) {
+        if(!isFiniteVal(h[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int SparseLMSolverCPP::solve(double *x,size_t *numIter,const double TolG,const double TolX,const size_t maxIter,const size_t maxTries) {
+    const size_t n=problem.numParams;
+    //Default value of tau as suggested on page 25 of Madsen et al. for a
+    //mediocre initial estimate.
+    const double tau=1e-3;
+    vector<double> h(n), xNew(n), fNew(problem.numResid);
+    double cost, mu, nu, maxG;
+    size_t i, curIter;
+    int exitCode=0;
+
+    *numIter=0;
+    if(!isValid) {
+        return -1;
+    }
+
+    if(!evalNormalEq(x,&cost)) {
+        return -2;
+    }
+
+    mu=tau*maxDiag;
+    nu=2;
+
+    maxG=0;
+    for(i=0;i<n;i++) {
+        maxG=max(maxG,fabs(g[i]));
+    }
+
+    if(maxG<=TolG) {
+        exitCode=1;
+    }
+
+    for(curIter=0;curIter<maxIter&&exitCode==0;curIter++) {
+        double normH, normX, costNew, deltaF, deltaL;
+        size_t curTry;
+        bool foundMu=false;
+
+        *numIter=curIter+1;
+
+        //Solve (A+mu*I)*h=-g, increasing mu if the damped matrix is not
+        //positive definite.
+        for(curTry=0;curTry<maxTries;curTry++) {
+            if(mu>0&&solveForStep(&h[0],mu)) {
+                foundMu=true;
+                break;
+            }
+            mu=max(10*mu,DBL_EPSILON*maxDiag);
+            if(mu==0) {
+                mu=DBL_EPSILON;
+            }
+        }
+
+        if(!foundMu) {
+            return -1;
+        }
+
+        normH=0;
+        normX=0;
+        for(i=0;i<n;i++) {
+            normH+=h[i]*h[i];
+            normX+=x[i]*x[i];
+        }
+        normH=sqrt(normH);
+        normX=sqrt(normX);
+
+        if(normH<=TolX*(normX+TolX)) {
+            exitCode=2;
+            break;
+        }
+
+        for(i=0;i<n;i++) {
+            xNew[i]=x[i]+h[i];
+        }
+
+        //Only the residuals are needed to decide whether to take the step.
+        if(!problem.evaluate(&fNew[0],NULL,&xNew[0])) {
+            return -2;
+        }
+        costNew=0;
+        for(i=0;i<problem.numResid;i++) {
+            costNew+=fNew[i]*fNew[i];
+        }
+        costNew/=2;
+        if(!isFiniteVal(costNew)) {
+            return -2;
+        }
+
+        deltaF=cost-costNew;
+        deltaL=0;
+        for(i=0;i<n;i++) {
+            deltaL+=h[i]*(mu*h[i]-g[i]);
+        }
+        deltaL/=2;
+
+        if(deltaF>0&&deltaL>0) {
+            const double rho=deltaF/deltaL;
+            const double temp=2*rho-1;
+
+            copy(xNew.begin(),xNew.end(),x);
+            if(!evalNormalEq(x,&cost)) {
+                return -2;
+            }
+
+            maxG=0;
+            for(i=0;i<n;i++) {
+                maxG=max(maxG,fabs(g[i]));
+            }
+
+            if(maxG<=TolG) {
+                exitCode=1;
+                break;
+            }
+
+            //The 1/9 is an arbitrary factor to shrink the mu parameter.
+            mu=mu*max(1.0/9.0,1-temp*temp*temp);
+            nu=2;
+        } else {
+            mu=mu*nu;
+            nu=2*nu;
+        }
+
+        if(!isFiniteVal(mu)||!isFiniteVal(nu)) {
+            return -2;
+        }
+    }
+
+    return exitCode;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
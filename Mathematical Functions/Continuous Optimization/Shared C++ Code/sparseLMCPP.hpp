@@ -0,0 +1,143 @@
+/**SPARSELMCPP A header file for a C++ implementation of the
+ *          Levenberg-Marquardt algorithm for nonlinear least squares
+ *          problems whose Jacobian matrices are sparse. See the file
+ *          sparseLMCPP.cpp for more details.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef SPARSELMCPP
+#define SPARSELMCPP
+#include <stddef.h>
+#include <vector>
+
+/**The SparseLSProblemCPP class is the interface for a nonlinear least
+ * squares problem with the cost function (1/2)*f(x)'*f(x), as in the Matlab
+ * function LSEstLMarquardt, where f is a numResidX1 vector function of the
+ * numParamsX1 vector x. The sparsity pattern of the Jacobian matrix J of f
+ * is fixed and is given in compressed sparse row (CSR) form: the column
+ * indices of the nonzero elements in row r are
+ * colIdx[rowStart[r]],...,colIdx[rowStart[r+1]-1]. A column index must not
+ * appear twice in a row. evaluate puts f(x) into f and, if JVals is not
+ * NULL, the values of the nonzero elements of J in the same order as
+ * colIdx into JVals. The return value is false if f cannot be evaluated.
+ **/
+class SparseLSProblemCPP {
+public:
+    size_t numParams;
+    size_t numResid;
+    std::vector<size_t> rowStart;
+    std::vector<size_t> colIdx;
+
+    SparseLSProblemCPP() : numParams(0), numResid(0) {}
+    virtual bool evaluate(double *f,double *JVals,const double *x) const=0;
+    virtual ~SparseLSProblemCPP() {}
+};
+
+/**The SparseLMSolverCPP class minimizes the cost function of a
+ * SparseLSProblemCPP using the Levenberg-Marquardt algorithm. The symbolic
+ * analysis of the sparsity pattern is done once when the solver is
+ * constructed. If blockDim=0, the damped normal equations are solved using
+ * a sparse Cholesky decomposition. If blockDim>0, then the parameters past
+ * the first numReduced are taken to form independent blocks of blockDim
+ * parameters, such as the states of different targets, where every row of
+ * J involves at most one block. The blocks are then eliminated using the
+ * Schur complement, leaving a dense system in the first numReduced
+ * parameters, as is done in bundle adjustment. isValid is false if the
+ * problem does not have the required block structure. The problem must
+ * outlive the solver.
+ **/
+class SparseLMSolverCPP {
+public:
+    bool isValid;
+
+    SparseLMSolverCPP(const SparseLSProblemCPP &problemDes,const size_t numReducedDes,const size_t blockDimDes);
+    int solve(double *x,size_t *numIter,const double TolG,const double TolX,const size_t maxIter,const size_t maxTries);
+    /*SOLVE Refine the estimate x of the parameters. The number of
+     *      iterations is put in numIter. The parameters of the algorithm
+     *      and the exit code are the same as in the Matlab function
+     *      LSEstLMarquardt.
+     */
+private:
+    const SparseLSProblemCPP &problem;
+    size_t numReduced;
+    size_t blockDim;
+    size_t numBlocks;
+    std::vector<double> f;
+    std::vector<double> JVals;
+    std::vector<double> g;
+    //The largest diagonal element of J'*J.
+    double maxDiag;
+
+    //The pattern of J in compressed sparse column form, holding the rows
+    //and the offsets into JVals of the nonzero elements of each column.
+    std::vector<size_t> JColStart;
+    std::vector<size_t> JColRow;
+    std::vector<size_t> JColPos;
+
+    //For the sparse Cholesky decomposition, the upper triangle of J'*J in
+    //compressed sparse column form, the elimination tree and the lower
+    //triangular factor L in compressed sparse column form.
+    std::vector<size_t> Ap;
+    std::vector<size_t> Ai;
+    std::vector<double> Ax;
+    std::vector<size_t> parent;
+    std::vector<size_t> Lp;
+    std::vector<size_t> Li;
+    std::vector<double> Lx;
+
+    //For the Schur complement, the rows of J in each block, the sorted
+    //reduced parameters that each block interacts with, the dense
+    //numReducedXnumReduced part U of J'*J, and the blockDimXblockDim
+    //diagonal blocks V and the numColsXblockDim off-diagonal blocks W of
+    //J'*J for each block.
+    std::vector<size_t> blockRowStart;
+    std::vector<size_t> blockRows;
+    std::vector<size_t> blockColStart;
+    std::vector<size_t> blockCols;
+    std::vector<double> U;
+    std::vector<double> V;
+    std::vector<double> W;
+    std::vector<double> LV;
+    std::vector<double> Yt;
+    std::vector<double> zB;
+    std::vector<double> S;
+
+    //Scratch space.
+    std::vector<size_t> stack;
+    std::vector<size_t> mark;
+    std::vector<double> work;
+
+    //Copying is not allowed, since problem is a reference.
+    SparseLMSolverCPP(const SparseLMSolverCPP &);
+    SparseLMSolverCPP &operator=(const SparseLMSolverCPP &);
+
+    void symbolicCholesky();
+    bool setupSchur();
+    size_t ereach(const size_t k);
+    bool evalNormalEq(const double *x,double *cost);
+    bool solveForStep(double *h,const double mu);
+    bool sparseCholSolve(double *h,const double mu);
+    bool schurSolve(double *h,const double mu);
+};
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
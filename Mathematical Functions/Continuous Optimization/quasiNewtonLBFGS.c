@@ -128,6 +128,11 @@
  *library has been slightly modified to use Matlab's memory allocation and
  *deallocation routines.
  *
+ *When many problems have to be solved or the objective function is one of
+ *the common types implemented in C++, such as least squares, the function
+ *quasiNewtonLBFGSNative avoids calling Matlab for every function
+ *evaluation and solves the problems in parallel.
+ *
  *The algorithm can be compiled for use in Matlab  using the 
  *CompileCLibraries function.
  *
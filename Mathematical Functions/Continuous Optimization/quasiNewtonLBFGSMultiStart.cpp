@@ -0,0 +1,239 @@
+/**QUASINEWTONLBFGSMULTISTART Search for the global minimum of a function
+ *                  with multiple local minima by running the
+ *                  limited-memory Broyden-Fletcher-Goldfarb-Shanno
+ *                  (L-BFGS) algorithm from many starting points. The
+ *                  objective function is implemented in C++, as in
+ *                  quasiNewtonLBFGSNative, so the starts are run in
+ *                  parallel. Duplicate minima are merged and starts that
+ *                  are clearly converging to an already found minimum are
+ *                  stopped early.
+ *
+ *INPUTS: objName A character string naming the objective function. The
+ *                possible objective functions are described in
+ *                quasiNewtonLBFGSNative. The 'bistaticRange' objective
+ *                function is the least-squares
+ *                cost function for localizing a stationary target from
+ *                bistatic range measurements, as in rangeOnlyStaticLocEst,
+ *                which generally has multiple local minima. Its parameters
+ *                are {r,zTx,zRx}, where r is the numMeasX1 vector of
+ *                bistatic ranges, zTx is the xDimXnumMeas matrix of
+ *                transmitter locations and zRx is either an xDimX1
+ *                receiver location used for all of the measurements or an
+ *                xDimXnumMeas matrix of receiver locations.
+ *      objParams A cell array of the real matrices that are the parameters
+ *                of the objective function.
+ *         starts Either an xDimXnumStarts matrix of starting points or a
+ *                cell array {lowerBound,upperBound,numStarts}, in which
+ *                case numStarts points of the Halton quasi-random sequence
+ *                in the box with the xDimX1 lower and upper bounds are
+ *                used. Cubature points make good starting points when a
+ *                Gaussian prior on the solution is available. For example,
+ *                with prior mean mu and covariance matrix P, one can use
+ *                starts=transformCubPoints(fifthOrderCubPoints(xDim),mu,chol(P,'lower'));
+ *       dedupTol Two solutions x1 and x2 are taken to be the same minimum if
+ *                norm(x1-x2)<=dedupTol*max(1,norm(x2)). The default if
+ *                omitted or an empty matrix is passed is 1e-4.
+ *      cancelTol A start is stopped if, after at least 2 iterations, its
+ *                iterate x is within norm(x-xMin)<=cancelTol*max(1,norm(xMin))
+ *                of an already found minimum xMin whose cost is not higher
+ *                than that at x. The start is then counted as having
+ *                converged to xMin. If this is zero, then no starts are
+ *                stopped early. The default if omitted or an empty matrix
+ *                is passed is 1e-2.
+ * numCorr, epsilon, deltaTestDist, delta, lineSearchParams, maxIterations
+ *                These optional parameters are the same as in
+ *                quasiNewtonLBFGS and are used for all of the starts.
+ *
+ *OUTPUTS: xMin The xDimXnumMin matrix of the distinct minima found, sorted
+ *              by increasing cost, so that xMin(:,1) is the estimate of the
+ *              global minimum.
+ *         fMin The numMinX1 vector of the costs of the minima.
+ *   basinCount The numMinX1 vector of the number of starts that went to
+ *              each minimum, including those that were stopped early.
+ *  startMinIdx A numStartsX1 vector of the index of the minimum in xMin to
+ *              which each start went, or 0 if the optimization failed.
+ *     exitCode A numStartsX1 vector of the exit codes of the optimizations,
+ *              which are the same as in quasiNewtonLBFGS. Starts that were
+ *              stopped early have the exit code -1021. Only starts with
+ *              nonnegative exit codes add new minima.
+ *
+ *If the code is compiled with OpenMP support, then the starts are run in
+ *parallel. Which starts are stopped early, and thus the basin counts, can
+ *then vary from run to run depending on which starts finish first, though
+ *the minima themselves do not.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[xMin,fMin,basinCount,startMinIdx,exitCode]=quasiNewtonLBFGSMultiStart(objName,objParams,starts);
+ *or if more options are used
+ *[xMin,fMin,basinCount,startMinIdx,exitCode]=quasiNewtonLBFGSMultiStart(objName,objParams,starts,dedupTol,cancelTol,numCorr,epsilon,deltaTestDist,delta,lineSearchParams,maxIterations);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy
+#include <algorithm>
+#include <vector>
+#include "optimizationFuncs.hpp"
+#include "LBFGSParamsFromMatlab.h"
+#include "MexValidation.h"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    char objName[64];
+    LBFGSObjectiveFactoryCPP factory;
+    LBFGSObjectiveCPP *objective;
+    vector<ObjectiveParamCPP> params;
+    vector<double> starts;
+    lbfgs_parameter_t param;
+    const char *errMsg="Invalid objective function parameters.";
+    double dedupTol=1e-4;
+    double cancelTol=1e-2;
+    size_t xDim, numStarts, numMin, i;
+    mxArray *xMATLAB, *fMATLAB;
+
+    if(nrhs<3||nrhs>11) {
+        mexErrMsgTxt("Wrong number of inputs");
+    }
+
+    if(nlhs>5) {
+        mexErrMsgTxt("Wrong number of outputs.");
+    }
+
+    if(!mxIsChar(prhs[0])||mxGetString(prhs[0],objName,sizeof(objName))!=0) {
+        mexErrMsgTxt("The objective function name must be a character string.");
+    }
+
+    factory=findLBFGSObjectiveCPP(objName);
+    if(factory==NULL) {
+        mexErrMsgTxt("Unknown objective function specified.");
+    }
+
+    if(!mxIsCell(prhs[1])) {
+        mexErrMsgTxt("The objective function parameters must be given in a cell array.");
+    }
+
+    if(mxIsCell(prhs[2])) {
+        const mxArray *lowerBound, *upperBound;
+
+        if(mxGetNumberOfElements(prhs[2])!=3) {
+            mexErrMsgTxt("A quasi-random design must be given as {lowerBound,upperBound,numStarts}.");
+        }
+
+        lowerBound=mxGetCell(prhs[2],0);
+        upperBound=mxGetCell(prhs[2],1);
+        if(lowerBound==NULL||upperBound==NULL||mxGetCell(prhs[2],2)==NULL) {
+            mexErrMsgTxt("A quasi-random design must be given as {lowerBound,upperBound,numStarts}.");
+        }
+        checkRealDoubleArray(lowerBound);
+        checkRealDoubleArray(upperBound);
+        xDim=mxGetNumberOfElements(lowerBound);
+        if(mxGetNumberOfElements(upperBound)!=xDim) {
+            mexErrMsgTxt("The bounds of the quasi-random design have different dimensionalities.");
+        }
+        numStarts=getSizeTFromMatlab(mxGetCell(prhs[2],2));
+
+        starts.resize(xDim*numStarts);
+        if(xDim>0&&numStarts>0) {
+            HaltonPointsCPP(&starts[0],(const double*)mxGetData(lowerBound),(const double*)mxGetData(upperBound),xDim,numStarts);
+        }
+    } else {
+        checkRealDoubleArray(prhs[2]);
+        xDim=mxGetM(prhs[2]);
+        numStarts=mxGetN(prhs[2]);
+        starts.resize(xDim*numStarts);
+        copy((double*)mxGetData(prhs[2]),(double*)mxGetData(prhs[2])+xDim*numStarts,starts.begin());
+    }
+
+    if(xDim<1) {
+        mexErrMsgTxt("The starting points have the wrong dimensionality.");
+    }
+
+    if(nrhs>3&&!mxIsEmpty(prhs[3])) {
+        dedupTol=getDoubleFromMatlab(prhs[3]);
+        if(dedupTol<0) {
+            mexErrMsgTxt("dedupTol must be nonnegative.");
+        }
+    }
+
+    if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+        cancelTol=getDoubleFromMatlab(prhs[4]);
+        if(cancelTol<0) {
+            mexErrMsgTxt("cancelTol must be nonnegative.");
+        }
+    }
+
+    LBFGSParamsFromMatlab(&param,nrhs,prhs,5,xDim);
+
+    LBFGSObjectiveParamsFromMatlab(params,prhs[1]);
+    objective=factory(params.empty()?NULL:&params[0],params.size(),xDim,&errMsg);
+    if(objective==NULL) {
+        mexErrMsgTxt(errMsg);
+    }
+
+    {
+        LBFGSMultiStartCPP multiStart(*objective,param,dedupTol,cancelTol,2);
+
+        multiStart.run(starts.empty()?NULL:&starts[0],numStarts);
+        delete objective;
+
+        numMin=multiStart.numMinima();
+        xMATLAB=mxCreateDoubleMatrix(xDim,numMin,mxREAL);
+        copy(multiStart.xMin.begin(),multiStart.xMin.end(),(double*)mxGetData(xMATLAB));
+        plhs[0]=xMATLAB;
+
+        if(nlhs>1) {
+            fMATLAB=mxCreateDoubleMatrix(numMin,1,mxREAL);
+            copy(multiStart.fMin.begin(),multiStart.fMin.end(),(double*)mxGetData(fMATLAB));
+            plhs[1]=fMATLAB;
+
+            if(nlhs>2) {
+                double *basinCount;
+
+                plhs[2]=mxCreateDoubleMatrix(numMin,1,mxREAL);
+                basinCount=(double*)mxGetData(plhs[2]);
+                for(i=0;i<numMin;i++) {
+                    basinCount[i]=(double)multiStart.basinCount[i];
+                }
+
+                if(nlhs>3) {
+                    double *startMinIdx;
+
+                    //Convert to Matlab indices with 0 for failed starts.
+                    plhs[3]=mxCreateDoubleMatrix(numStarts,1,mxREAL);
+                    startMinIdx=(double*)mxGetData(plhs[3]);
+                    for(i=0;i<numStarts;i++) {
+                        startMinIdx[i]=multiStart.startMinIdx[i]==numMin?0:(double)(multiStart.startMinIdx[i]+1);
+                    }
+
+                    if(nlhs>4) {
+                        plhs[4]=intMat2MatlabDoubles(multiStart.exitCodes.empty()?NULL:&multiStart.exitCodes[0],numStarts,1);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,236 @@
+/**QUASINEWTONLBFGSNATIVE Perform unconstrained nonlinear optimization of
+ *                  many independent problems using the limited-memory
+ *                  Broyden-Fletcher-Goldfarb-Shanno (L-BFGS) algorithm,
+ *                  where the objective function is implemented in C++
+ *                  rather than being a Matlab function handle. This is the
+ *                  same algorithm as in quasiNewtonLBFGS, but since Matlab
+ *                  is never called during the optimization, the overhead
+ *                  of calling Matlab for every function evaluation is
+ *                  avoided and the problems can be solved in parallel.
+ *
+ *INPUTS: objName A character string naming the objective function. The
+ *                built-in objective functions are
+ *                'leastSquares' f(x)=norm(A*x-b)^2. The parameters are
+ *                               {A,b}, where A is an mXxDim matrix and b is
+ *                               an mX1 vector.
+ *                'mahalanobis'  f(x)=(A*x-b)'*inv(R)*(A*x-b). The
+ *                               parameters are {A,b,R}, where R is an mXm
+ *                               positive definite matrix. If A is an empty
+ *                               matrix, then the identity matrix is used,
+ *                               which requires m=xDim.
+ *                'gaussMixNegLogLike' The negative logarithm of the PDF
+ *                               of a Gaussian mixture, so that the
+ *                               minimization finds a mode of the mixture.
+ *                               The parameters are {w,mu,P}, where w is
+ *                               the numCompX1 vector of nonnegative
+ *                               weights, mu is the xDimXnumComp matrix of
+ *                               means and P is the xDimXxDimXnumComp
+ *                               hypermatrix of covariance matrices.
+ *                'bistaticRange' The least-squares cost function for
+ *                               localizing a stationary target from
+ *                               bistatic range measurements, which is
+ *                               described in quasiNewtonLBFGSMultiStart.
+ *                Additional objective functions can be added in C++ by
+ *                registering them with an LBFGSObjectiveRegistrarCPP
+ *                object, as described in optimizationFuncs.hpp.
+ *      objParams The parameters of the objective function. This is either
+ *                a cell array of real matrices, as described above, that
+ *                is used for all of the problems, or a numProbX1 cell
+ *                array, each element of which is a cell array holding the
+ *                parameters of one problem.
+ *             x0 An xDimXnumProb matrix of the initial estimates of the
+ *                problems.
+ * numCorr, epsilon, deltaTestDist, delta, lineSearchParams, maxIterations
+ *                These optional parameters are the same as in
+ *                quasiNewtonLBFGS and are used for all of the problems.
+ *                Omitted parameters and parameters for which an empty
+ *                matrix is passed take the same default values as in
+ *                quasiNewtonLBFGS.
+ *
+ *OUTPUTS: xMin The xDimXnumProb matrix of the values of x at the minimum
+ *              points found.
+ *         fMin The numProbX1 vector of the cost function values at the
+ *              minimum points found.
+ *     exitCode The numProbX1 vector of the values indicating the
+ *              termination conditions of the optimizations. The values
+ *              are the same as in quasiNewtonLBFGS.
+ *
+ *The objective functions are all created before the optimization starts,
+ *so invalid parameters cause an error before any work is done. If the
+ *code is compiled with OpenMP support, then the problems are solved in
+ *parallel. For that, liblbfgs is compiled with LBFGS_STANDARD_ALLOC
+ *defined, so that it uses malloc and free rather than the Matlab memory
+ *allocation routines, which are not thread safe.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[xMin,fMin,exitCode]=quasiNewtonLBFGSNative(objName,objParams,x0);
+ *or if more options are used
+ *[xMin,fMin,exitCode]=quasiNewtonLBFGSNative(objName,objParams,x0,numCorr,epsilon,deltaTestDist,delta,lineSearchParams,maxIterations);
+ *
+ *EXAMPLE:
+ *Many linear least squares problems with a common matrix are solved.
+ * A=randn(20,5);
+ * b=randn(20,100);
+ * objParams=cell(100,1);
+ * for k=1:100
+ *     objParams{k}={A,b(:,k)};
+ * end
+ * xMin=quasiNewtonLBFGSNative('leastSquares',objParams,zeros(5,100));
+ *The results agree with A\b to within the convergence tolerance.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy
+#include <algorithm>
+#include <vector>
+#include "optimizationFuncs.hpp"
+#include "LBFGSParamsFromMatlab.h"
+#include "MexValidation.h"
+#include "mex.h"
+
+using namespace std;
+
+static void freeObjectives(vector<LBFGSObjectiveCPP*> &objectives);
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    char objName[64];
+    LBFGSObjectiveFactoryCPP factory;
+    vector<LBFGSObjectiveCPP*> objectives;
+    vector<ObjectiveParamCPP> params;
+    lbfgs_parameter_t param;
+    size_t xDim, numProb, numCells, i;
+    bool paramsPerProblem;
+    double *xMin, *fMin;
+    int *exitCodes;
+    mxArray *xMATLAB, *fMATLAB;
+
+    if(nrhs<3||nrhs>9) {
+        mexErrMsgTxt("Wrong number of inputs");
+    }
+
+    if(nlhs>3) {
+        mexErrMsgTxt("Wrong number of outputs.");
+    }
+
+    if(!mxIsChar(prhs[0])||mxGetString(prhs[0],objName,sizeof(objName))!=0) {
+        mexErrMsgTxt("The objective function name must be a character string.");
+    }
+
+    factory=findLBFGSObjectiveCPP(objName);
+    if(factory==NULL) {
+        mexErrMsgTxt("Unknown objective function specified.");
+    }
+
+    if(!mxIsCell(prhs[1])) {
+        mexErrMsgTxt("The objective function parameters must be given in a cell array.");
+    }
+
+    checkRealDoubleArray(prhs[2]);
+    xDim=mxGetM(prhs[2]);
+    numProb=mxGetN(prhs[2]);
+    if(xDim<1) {
+        mexErrMsgTxt("The point x0 has the wrong dimensionality.");
+    }
+
+    //The parameters are given per problem if objParams is a nonempty cell
+    //array of cell arrays.
+    numCells=mxGetNumberOfElements(prhs[1]);
+    paramsPerProblem=numCells>0;
+    for(i=0;i<numCells;i++) {
+        const mxArray *curCell=mxGetCell(prhs[1],i);
+
+        if(curCell==NULL||!mxIsCell(curCell)) {
+            paramsPerProblem=false;
+            break;
+        }
+    }
+
+    if(paramsPerProblem&&numCells!=numProb) {
+        mexErrMsgTxt("The number of sets of objective function parameters does not match the number of columns of x0.");
+    }
+
+    LBFGSParamsFromMatlab(&param,nrhs,prhs,3,xDim);
+
+    //Create all of the objective functions before starting. If the
+    //parameters are shared, then a single objective function is used for
+    //all of the problems.
+    objectives.resize(paramsPerProblem?numProb:1,NULL);
+    for(i=0;i<objectives.size();i++) {
+        const char *errMsg="Invalid objective function parameters.";
+
+        LBFGSObjectiveParamsFromMatlab(params,paramsPerProblem?mxGetCell(prhs[1],i):prhs[1]);
+        objectives[i]=factory(params.empty()?NULL:&params[0],params.size(),xDim,&errMsg);
+        if(objectives[i]==NULL) {
+            freeObjectives(objectives);
+            mexErrMsgTxt(errMsg);
+        }
+    }
+
+    xMATLAB=mxCreateDoubleMatrix(xDim,numProb,mxREAL);
+    xMin=(double*)mxGetData(xMATLAB);
+    copy((double*)mxGetData(prhs[2]),(double*)mxGetData(prhs[2])+xDim*numProb,xMin);
+    fMATLAB=mxCreateDoubleMatrix(numProb,1,mxREAL);
+    fMin=(double*)mxGetData(fMATLAB);
+    exitCodes=new int[numProb];
+
+    //The problems are independent, so they are solved in parallel if
+    //OpenMP is available.
+    {
+        ptrdiff_t curProb;
+
+        #pragma omp parallel for schedule(dynamic)
+        for(curProb=0;curProb<(ptrdiff_t)numProb;curProb++) {
+            const LBFGSObjectiveCPP *objective=objectives[paramsPerProblem?curProb:0];
+            lbfgs_parameter_t curParam=param;
+
+            exitCodes[curProb]=LBFGSNativeCPP(xMin+xDim*curProb,fMin+curProb,*objective,&curParam);
+        }
+    }
+
+    freeObjectives(objectives);
+
+    plhs[0]=xMATLAB;
+    if(nlhs>1) {
+        plhs[1]=fMATLAB;
+
+        if(nlhs>2) {
+            plhs[2]=intMat2MatlabDoubles(exitCodes,numProb,1);
+        }
+    } else {
+        mxDestroyArray(fMATLAB);
+    }
+
+    delete[] exitCodes;
+}
+
+static void freeObjectives(vector<LBFGSObjectiveCPP*> &objectives) {
+    size_t i;
+
+    for(i=0;i<objectives.size();i++) {
+        delete objectives[i];
+    }
+    objectives.clear();
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
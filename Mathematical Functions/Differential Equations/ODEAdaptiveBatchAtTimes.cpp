@@ -0,0 +1,375 @@
+/**ODEADAPTIVEBATCHATTIMES Integrate many trajectories of a compiled
+ *                  dynamic model using adaptive Runge-Kutta, Runge-Kutta-
+ *                  Nystroem or Rosenbrock methods, obtaining the states at
+ *                  arbitrary times from the dense output of the methods.
+ *                  This is a compiled alternative to calling
+ *                  RKAdaptiveAtTimes in a loop when the dynamic model is
+ *                  one of the built-in models.
+ *
+ *INPUTS: xStart The xDimXnumTraj initial states of the trajectories.
+ *        tStart The time of the initial states. This is either a scalar,
+ *               if all trajectories start at the same time, or a
+ *               numTrajX1 vector.
+ *          tOut A numOutX1 vector of the times at which the states are
+ *               desired. The times must be sorted in the direction of
+ *               integration and must not be before tStart (in the
+ *               direction of integration) for any trajectory. Times equal
+ *               to tStart just return xStart.
+ *       dynType An integer specifying the dynamic model dx/dt=f(x,t).
+ *               Possible values are
+ *               0 A linear model, dx/dt=A*x, where dynParam is the
+ *                 xDimXxDim matrix A.
+ *               1 An Earth orbit model in an Earth-centered inertial
+ *                 coordinate system where the Earth rotates about the z
+ *                 axis. The state is [r;v], where r is the 3X1 position
+ *                 and v the 3X1 velocity. dynParam is a vector
+ *                 [GM;a;omega;theta0;BC;rho0;r0;H], of which only GM is
+ *                 required; omitted trailing elements are set to 0 except
+ *                 BC and H, which are set to 1. GM is the universal
+ *                 gravitational constant times the mass of the Earth, a
+ *                 is the reference radius of the spherical harmonic
+ *                 coefficients (if given), omega is the rotation rate of
+ *                 the Earth and theta0 the rotation angle of the Earth at
+ *                 time 0, BC is the ballistic coefficient (mass divided by
+ *                 the drag coefficient times the area) and
+ *                 rho0*exp(-(norm(r)-r0)/H) is the atmospheric density.
+ *                 If rho0=0, then drag is omitted. If CCoeffs and SCoeffs
+ *                 are not given, then the gravity is that of a point
+ *                 mass.
+ *      dynParam The parameter of the dynamic model, as described above.
+ *        method An optional integer specifying the integration method.
+ *               Possible values are
+ *               0 The Bogacki-Shampine 3(2) Runge-Kutta pair.
+ *               1 (The default if omitted or an empty matrix is passed)
+ *                 The Dormand-Prince 5(4) Runge-Kutta pair.
+ *               2 The RKN5(4)5F Runge-Kutta-Nystroem pair, which is also
+ *                 in RungeKNystroemSStep. This can only be used with the
+ *                 orbit model without drag, where it only has to
+ *                 evaluate the gravitational acceleration.
+ *               3 The Rosenbrock 2(3) method that is order 2 in
+ *                 RosenbrockStep. This is for stiff problems.
+ *               4 The Rosenbrock 3(4) method that is order 3 in
+ *                 RosenbrockStep. This is for stiff problems.
+ * RelTol, AbsTol, maxSteps Optional parameters of the adaptive step size
+ *               algorithm that have the same meaning as in
+ *               RKAdaptiveOverRange. If omitted or empty matrices are
+ *               passed, the defaults of 1e-3, 1e-6 and 1024 are used. AbsTol
+ *               must be a scalar.
+ *  initStepSize An optional initial step size. If omitted or an empty
+ *               matrix is passed, the initial step size is chosen using
+ *               the algorithm in Chapter II.4 of [1].
+ * CCoeffs, SCoeffs, offsetArray, clusterSizes Optional spherical harmonic
+ *               gravity coefficients for the orbit model. These are the
+ *               members of ClusterSet classes holding fully normalized
+ *               coefficients, such as those obtained from the function
+ *               getEGMGravCoeffs, as would be passed to
+ *               spherHarmonicEvalCPPInt, except that offsetArray and
+ *               clusterSizes can be doubles. The coefficients are
+ *               evaluated in the rotating coordinate system.
+ *
+ *OUTPUTS: xOut The xDimXnumOutXnumTraj states of the trajectories at the
+ *              times in tOut. Values that could not be computed, because
+ *              the integration failed, are NaN.
+ *     exitCode A numTrajX1 vector of the exit codes of the integration for
+ *              each trajectory. These have the same meaning as in
+ *              RKAdaptiveOverRange.
+ *     numSteps A numTrajX1 vector of the number of steps taken for each
+ *              trajectory.
+ *
+ *The integrators are described in the file ODEIntegratorCPP.cpp. Unlike
+ *RKAdaptiveAtTimes, which restarts the integration at each output time,
+ *the integration here runs continuously to the last output time and the
+ *intermediate states are obtained by interpolation. Thus, the output times
+ *do not limit the step size. Since the dynamic models are compiled, no
+ *Matlab function handles are called and if the code is compiled with
+ *OpenMP support, then the loop over the trajectories is run in parallel.
+ *
+ *REFERENCES:
+ *[1] E. Hairer, S. P. Norsett, and G. Wanner, Solving Ordinary
+ *    Differential Equations I: Nonstiff Problems, 2nd ed. Berlin:
+ *    Springer-Verlag, 1993.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[xOut,exitCode,numSteps]=ODEAdaptiveBatchAtTimes(xStart,tStart,tOut,dynType,dynParam,method,RelTol,AbsTol,maxSteps,initStepSize,CCoeffs,SCoeffs,offsetArray,clusterSizes);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For fill_n
+#include <algorithm>
+#include "MexValidation.h"
+#include "ODEFuncs.hpp"
+#include "ClusterSetCPP.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t xDim, numTraj, numOut, curOut, curTraj;
+    const double *xStart, *tStart, *tOut;
+    bool tStartIsShared;
+    double tDiff;
+    int dynType, method;
+    ODEIntParamCPP param;
+    LinearDynamicsCPP linDyn(0,NULL);
+    OrbitDynamicsCPP orbitDyn;
+    const ODEDynamicsCPP *dyn;
+    ClusterSetCPP<double> C, S;
+    size_t *offsetArray=NULL;
+    mxArray *xOutMATLAB, *exitCodeMATLAB, *numStepsMATLAB;
+    double *xOut, *exitCode, *numStepsOut;
+    mwSize dims[3];
+    const double NaNVal=mxGetNaN();
+
+    if(nrhs<5) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>14) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>3) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    checkRealDoubleArray(prhs[0]);
+    checkRealDoubleArray(prhs[1]);
+    checkRealDoubleArray(prhs[2]);
+    xDim=mxGetM(prhs[0]);
+    numTraj=mxGetN(prhs[0]);
+    numOut=mxGetNumberOfElements(prhs[2]);
+
+    if(xDim==0||numTraj==0) {
+        mexErrMsgTxt("xStart cannot be empty.");
+    }
+
+    if(numOut==0) {
+        mexErrMsgTxt("tOut cannot be empty.");
+    }
+
+    tStartIsShared=mxGetNumberOfElements(prhs[1])==1;
+    if(!tStartIsShared&&mxGetNumberOfElements(prhs[1])!=numTraj) {
+        mexErrMsgTxt("tStart has the wrong dimensionality.");
+    }
+
+    xStart=(double*)mxGetData(prhs[0]);
+    tStart=(double*)mxGetData(prhs[1]);
+    tOut=(double*)mxGetData(prhs[2]);
+
+    //Check that the output times are sorted and on the correct side of the
+    //starting times.
+    tDiff=tOut[numOut-1]-tOut[0];
+    for(curOut=1;curOut<numOut;curOut++) {
+        if((tOut[curOut]-tOut[curOut-1])*tDiff<0) {
+            mexErrMsgTxt("The output times must be sorted.");
+        }
+    }
+    for(curTraj=0;curTraj<numTraj;curTraj++) {
+        const double tStartCur=tStartIsShared?tStart[0]:tStart[curTraj];
+
+        if((tOut[0]-tStartCur)*(tOut[numOut-1]-tStartCur)<0||(tOut[numOut-1]-tStartCur)*tDiff<0) {
+            mexErrMsgTxt("The output times cannot be before the starting time in the direction of integration.");
+        }
+    }
+
+    if(nrhs>5&&!mxIsEmpty(prhs[5])) {
+        method=getIntFromMatlab(prhs[5]);
+        if(method<0||method>4) {
+            mexErrMsgTxt("Unknown integration method specified.");
+        }
+        param.method=(ODEMethodCPP)method;
+    }
+
+    if(nrhs>6&&!mxIsEmpty(prhs[6])) {
+        param.RelTol=getDoubleFromMatlab(prhs[6]);
+    }
+
+    if(nrhs>7&&!mxIsEmpty(prhs[7])) {
+        param.AbsTol=getDoubleFromMatlab(prhs[7]);
+    }
+
+    if(!(param.RelTol>0)||!(param.AbsTol>0)) {
+        mexErrMsgTxt("RelTol and AbsTol must be positive.");
+    }
+
+    if(nrhs>8&&!mxIsEmpty(prhs[8])) {
+        param.maxSteps=getSizeTFromMatlab(prhs[8]);
+    }
+
+    if(nrhs>9&&!mxIsEmpty(prhs[9])) {
+        param.initStepSize=getDoubleFromMatlab(prhs[9]);
+    }
+
+    dynType=getIntFromMatlab(prhs[3]);
+    switch(dynType) {
+        case 0:
+            checkRealDoubleArray(prhs[4]);
+            if(mxGetM(prhs[4])!=xDim||mxGetN(prhs[4])!=xDim) {
+                mexErrMsgTxt("The matrix A has the wrong dimensionality.");
+            }
+            if(param.method==ODE_RKN54) {
+                mexErrMsgTxt("The Runge-Kutta-Nystroem method cannot be used with the linear model.");
+            }
+            linDyn.xDim=xDim;
+            linDyn.A=(double*)mxGetData(prhs[4]);
+            dyn=&linDyn;
+            break;
+        case 1:
+        {
+            const size_t numParam=mxGetNumberOfElements(prhs[4]);
+            const double *dynParam;
+
+            if(xDim!=6) {
+                mexErrMsgTxt("The orbit model requires a 6D state.");
+            }
+
+            checkRealDoubleArray(prhs[4]);
+            if(numParam<1||numParam>8) {
+                mexErrMsgTxt("dynParam has the wrong dimensionality.");
+            }
+            dynParam=(double*)mxGetData(prhs[4]);
+            switch(numParam) {
+                case 8:
+                    orbitDyn.H=dynParam[7];
+                case 7:
+                    orbitDyn.r0=dynParam[6];
+                case 6:
+                    orbitDyn.rho0=dynParam[5];
+                case 5:
+                    orbitDyn.BC=dynParam[4];
+                case 4:
+                    orbitDyn.theta0=dynParam[3];
+                case 3:
+                    orbitDyn.omega=dynParam[2];
+                case 2:
+                    orbitDyn.a=dynParam[1];
+                default:
+                    orbitDyn.GM=dynParam[0];
+            }
+
+            if(param.method==ODE_RKN54&&!orbitDyn.hasSpecialSecondOrderForm()) {
+                mexErrMsgTxt("The Runge-Kutta-Nystroem method cannot be used with drag.");
+            }
+
+            if(nrhs>10&&!mxIsEmpty(prhs[10])) {
+                size_t M, i;
+
+                if(nrhs<14) {
+                    mexErrMsgTxt("All four inputs for the spherical harmonic coefficients must be given.");
+                }
+
+                checkRealDoubleArray(prhs[10]);
+                checkRealDoubleArray(prhs[11]);
+                checkRealDoubleArray(prhs[12]);
+                checkRealDoubleArray(prhs[13]);
+
+                C.numClust=mxGetNumberOfElements(prhs[12]);
+                M=C.numClust-1;
+                C.totalNumEl=(M+1)*(M+2)/2;
+                if(C.numClust<4||mxGetNumberOfElements(prhs[13])!=C.numClust||mxGetNumberOfElements(prhs[10])!=C.totalNumEl||mxGetNumberOfElements(prhs[11])!=C.totalNumEl) {
+                    mexErrMsgTxt("The spherical harmonic coefficients must be given to at least degree 3 and must be consistent.");
+                }
+
+                //offsetArray and clusterSizes are converted into size_t
+                //values in a single buffer.
+                offsetArray=new size_t[2*C.numClust];
+                for(i=0;i<C.numClust;i++) {
+                    offsetArray[i]=(size_t)((double*)mxGetData(prhs[12]))[i];
+                    offsetArray[i+C.numClust]=(size_t)((double*)mxGetData(prhs[13]))[i];
+                }
+
+                C.clusterEls=(double*)mxGetData(prhs[10]);
+                C.offsetArray=offsetArray;
+                C.clusterSizes=offsetArray+C.numClust;
+                S.clusterEls=(double*)mxGetData(prhs[11]);
+                S.offsetArray=C.offsetArray;
+                S.clusterSizes=C.clusterSizes;
+                S.numClust=C.numClust;
+                S.totalNumEl=C.totalNumEl;
+
+                orbitDyn.C=&C;
+                orbitDyn.S=&S;
+            }
+            dyn=&orbitDyn;
+            break;
+        }
+        default:
+            mexErrMsgTxt("Unknown dynamic model specified.");
+            return;
+    }
+
+    dims[0]=xDim;
+    dims[1]=numOut;
+    dims[2]=numTraj;
+    xOutMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+    xOut=(double*)mxGetData(xOutMATLAB);
+    exitCodeMATLAB=mxCreateDoubleMatrix(numTraj,1,mxREAL);
+    exitCode=(double*)mxGetData(exitCodeMATLAB);
+    numStepsMATLAB=mxCreateDoubleMatrix(numTraj,1,mxREAL);
+    numStepsOut=(double*)mxGetData(numStepsMATLAB);
+
+    //The trajectories are independent, so they are integrated in parallel
+    //if OpenMP is available. Each thread has its own scratch space.
+    #pragma omp parallel
+    {
+        ODEScratchCPP workMem(xDim);
+        ptrdiff_t curTrajPar;
+
+        #pragma omp for schedule(dynamic)
+        for(curTrajPar=0;curTrajPar<(ptrdiff_t)numTraj;curTrajPar++) {
+            double *xOutCur=xOut+curTrajPar*xDim*numOut;
+            const double tStartCur=tStartIsShared?tStart[0]:tStart[curTrajPar];
+            size_t numSteps;
+            int curExitCode;
+
+            //Any outputs that are not reached remain NaN.
+            fill_n(xOutCur,xDim*numOut,NaNVal);
+            curExitCode=ODEAdaptiveAtTimesCPP(xOutCur,&numSteps,*dyn,xStart+curTrajPar*xDim,tStartCur,tOut,numOut,param,workMem);
+
+            exitCode[curTrajPar]=curExitCode;
+            numStepsOut[curTrajPar]=(double)numSteps;
+        }
+    }
+
+    delete[] offsetArray;
+
+    plhs[0]=xOutMATLAB;
+    switch(nlhs) {
+        case 3:
+            plhs[2]=numStepsMATLAB;
+        case 2:
+            plhs[1]=exitCodeMATLAB;
+        default:
+            break;
+    }
+
+    if(nlhs<3) {
+        mxDestroyArray(numStepsMATLAB);
+    }
+    if(nlhs<2) {
+        mxDestroyArray(exitCodeMATLAB);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
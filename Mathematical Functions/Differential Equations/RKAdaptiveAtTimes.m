@@ -43,6 +43,11 @@ function xList=RKAdaptiveAtTimes(xInit,theTimes,f,initStepSize,order,solutionCho
 %A detailed description of the adaptive step size algorithm can be found in
 %the comments of RKAdaptiveOverRange.
 %
+%When many trajectories of a linear model or of an Earth orbit model are to
+%be propagated, the compiled function ODEAdaptiveBatchAtTimes can be used
+%instead. It integrates the trajectories in parallel and obtains the states
+%at the desired times by interpolation.
+%
 %May 2015 David Karnick, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
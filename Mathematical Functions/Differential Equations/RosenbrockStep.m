@@ -173,7 +173,7 @@ function [xPredMain,xPredSubsid,k,orders]=RosenbrockStep(xCur,tCur,f,deltaT,fCur
                 k4=W\(F2+(29/250)*deltaT*dfdt-(56/125)*k1-(27/125)*k2-(1/5)*k3);
 
                 %The third order estimate
-                xPredMain=xCur+deltaT*((98/108)*k1+(11/72)*k2+(25/216)*k3);
+                xPredMain=xCur+deltaT*((97/108)*k1+(11/72)*k2+(25/216)*k3);
                 %Thr fourth-order corrector.
                 xPredSubsid=xCur+deltaT*((19/18)*k1+(1/4)*k2+(25/216)*k3+(125/216)*k4);
                 k=zeros(xDim,3);
@@ -0,0 +1,181 @@
+classdef PolygonIndex < handle
+%%POLYGONINDEX An index over a fixed set of polygons for determining which
+%       of the polygons contain each of a large number of points, for
+%       example when checking the positions of many ships against many
+%       harbor and restricted-area polygons, some of which might have a
+%       very large number of vertices. This class requires that the C++
+%       function PolygonIndexCPPInt be compiled using CompileCLibraries.
+%
+%The same winding number algorithm as in pointIsInPolygon is used, so
+%polygons can be self-intersecting (the even-odd rule is used) and the
+%winding numbers omega are the same as in pointIsInPolygon. However,
+%rather than visiting every edge of a polygon, the y extent of each
+%polygon is split into horizontal bands and only the edges overlapping the
+%band of the point are visited. The bounding boxes of the polygons are
+%kept in an R-tree, so polygons whose bounding boxes do not contain a
+%point are skipped without being visited individually. Queries of many
+%points are run in parallel if the C++ code is compiled with OpenMP
+%support. Building the index takes time, so it is worthwhile when many
+%points are tested against the same polygons.
+%
+%An example of use is
+% polygons={[0,1,1,0;0,0,1,1],[0.5,2,2;0.5,0.5,2]};
+% theIndex=PolygonIndex(polygons);
+% points=[0.25,0.75,1.5,3;0.25,0.6,1,3];
+% polySet=theIndex.query(points);
+% %polySet(2,:) is [1;2], the polygons containing the second point.
+%
+%October 2026 agent, Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+properties(Access=private)
+    CPPData%The pointer to the C++ class instance.
+end
+
+methods
+    function newIndex=PolygonIndex(polygons)
+    %%POLYGONINDEX Create a new polygon index.
+    %
+    %INPUTS: polygons A cell array of the polygons to put in the index.
+    %                 Each element is a 2XN matrix of the N vertices of a
+    %                 polygon in order, with at least 3 vertices. Edges are
+    %                 between neighboring vertices and an edge is assumed
+    %                 to exist between the last and first vertices. A
+    %                 single polygon can also be passed as a matrix rather
+    %                 than in a cell array.
+    %
+    %OUTPUTS: newIndex The new PolygonIndex object.
+
+        if(~exist('PolygonIndexCPPInt','file'))
+            error('The C++ function PolygonIndexCPPInt must be compiled to use this class.')
+        end
+
+        if(~iscell(polygons))
+            polygons={polygons};
+        end
+
+        if(isempty(polygons))
+            error('At least one polygon must be given.')
+        end
+
+        numVertices=cellfun(@(P)size(P,2),polygons(:));
+        vertices=[polygons{:}];
+
+        newIndex.CPPData=PolygonIndexCPPInt('PolygonIndexCPP',vertices,numVertices);
+    end
+
+    function [polySet,omegas]=query(theIndex,points,boundaryIsImportant)
+    %%QUERY Find which of the polygons in the index contain each of a set
+    %       of points.
+    %
+    %INPUTS: theIndex The implicitly passed PolygonIndex object.
+    %          points A 2XnumPoints set of points.
+    % boundaryIsImportant An optional boolean variable indicating whether
+    %                 the boundaries of the polygons are important. If
+    %                 true, points on the boundary of a polygon are always
+    %                 considered in the polygon. If false, the results for
+    %                 points on the boundaries can be inconsistent, though
+    %                 the algorithm is slightly faster. The default if
+    %                 omitted or an empty matrix is passed is true.
+    %
+    %OUTPUTS: polySet An instance of the ClusterSet class with numPoints
+    %                 clusters. Cluster i holds the indices of the polygons
+    %                 containing point i in increasing order, so
+    %                 polySet(i,:) is the list of polygons containing point
+    %                 i.
+    %          omegas A vector of the winding numbers of the points with
+    %                 respect to the polygons listed in polySet, in the
+    %                 same order as polySet(:). The values are not
+    %                 meaningful for points on the boundaries of polygons.
+
+        if(nargin<3)
+            boundaryIsImportant=[];
+        end
+
+        if(isempty(points))
+            polySet=ClusterSet([],zeros(0,1),zeros(0,1));
+            omegas=zeros(0,1);
+            return
+        end
+
+        [polySet,omegas]=PolygonIndexCPPInt('query',theIndex.CPPData,points,boundaryIsImportant);
+        %The +1 converts C indices to Matlab indices.
+        polySet.clusterEls=polySet.clusterEls+1;
+    end
+
+    function [isInPolygon,omegas]=pointIsInPolygon(theIndex,polyIdx,points,boundaryIsImportant)
+    %%POINTISINPOLYGON Determine whether each of a set of points is in a
+    %                  single polygon of the index. The inputs and outputs
+    %                  are the same as those of the function
+    %                  pointIsInPolygon, except that the polygon is given
+    %                  by its index.
+    %
+    %INPUTS: theIndex The implicitly passed PolygonIndex object.
+    %         polyIdx The index of the polygon.
+    %          points A 2XnumPoints set of points.
+    % boundaryIsImportant An optional boolean variable indicating whether
+    %                 the boundary of the polygon is important, as in
+    %                 pointIsInPolygon. The default if omitted or an empty
+    %                 matrix is passed is true.
+    %
+    %OUTPUTS: isInPolygon A numPointsX1 boolean vector indicating which
+    %                 points are in the polygon.
+    %          omegas A numPointsX1 vector of the winding numbers of the
+    %                 points.
+
+        if(nargin<4)
+            boundaryIsImportant=[];
+        end
+
+        if(isempty(points))
+            isInPolygon=false(0,1);
+            omegas=zeros(0,1);
+            return
+        end
+
+        [isInPolygon,omegas]=PolygonIndexCPPInt('pointIsInPolygon',theIndex.CPPData,polyIdx-1,points,boundaryIsImportant);
+    end
+
+    function vertices=getPolygon(theIndex,polyIdx)
+    %%GETPOLYGON Get the vertices of a polygon in the index.
+    %
+    %INPUTS: theIndex The implicitly passed PolygonIndex object.
+    %         polyIdx The index of the polygon.
+    %
+    %OUTPUTS: vertices The 2XN vertices of the polygon.
+
+        vertices=PolygonIndexCPPInt('getPolygon',theIndex.CPPData,polyIdx-1);
+    end
+
+    function val=numPolygons(theIndex)
+    %%NUMPOLYGONS The number of polygons in the index.
+
+        val=PolygonIndexCPPInt('getDims',theIndex.CPPData);
+    end
+
+    function delete(theIndex)
+
+        if(~isempty(theIndex.CPPData))
+            PolygonIndexCPPInt('~PolygonIndexCPP',theIndex.CPPData);
+        end
+    end
+end
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
@@ -0,0 +1,236 @@
+/**POLYGONINDEXCPPINT An interface between the Matlab PolygonIndex class
+ *              and the C++ PolygonIndexCPP class. This function is meant
+ *              to be called by the PolygonIndex class in Matlab; not
+ *              directly by the user. Indices passed to and from this
+ *              function start from 0 and are converted by the Matlab
+ *              class.
+ *
+ *The function is called as
+ *CPPData=PolygonIndexCPPInt('PolygonIndexCPP',vertices,numVertices);
+ *or
+ *[polySet,omegas]=PolygonIndexCPPInt('query',CPPData,points,boundaryIsImportant);
+ *or
+ *[isInPolygon,omegas]=PolygonIndexCPPInt('pointIsInPolygon',CPPData,polyIdx,points,boundaryIsImportant);
+ *or
+ *vertices=PolygonIndexCPPInt('getPolygon',CPPData,polyIdx);
+ *or
+ *[numPolygons,totalNumVertices]=PolygonIndexCPPInt('getDims',CPPData);
+ *or
+ *PolygonIndexCPPInt('~PolygonIndexCPP',CPPData);
+ *
+ *See the PolygonIndex class for a description of the inputs and outputs.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For strcmp
+#include <cstring>
+#include <vector>
+#include "MexValidation.h"
+#include "mathGeometricFuncs.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    char cmd[64];
+    PolygonIndexCPP *theIndex;
+
+    if(nrhs<2) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>5) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    //Get the command string that is passed.
+    mxGetString(prhs[0], cmd, sizeof(cmd));
+
+    if(!strcmp("PolygonIndexCPP", cmd)){
+        size_t *numVertices, numPolygons, sumVertices, i;
+        const double *vertices;
+
+        if(nrhs!=3) {
+            mexErrMsgTxt("Incorrect number of inputs.");
+        }
+
+        checkRealDoubleArray(prhs[1]);
+        if(mxGetM(prhs[1])!=2) {
+            mexErrMsgTxt("The vertices must be two-dimensional.");
+        }
+        vertices=(double*)mxGetData(prhs[1]);
+
+        numVertices=copySizeTArrayFromMatlab(prhs[2],&numPolygons);
+        sumVertices=0;
+        for(i=0;i<numPolygons;i++) {
+            if(numVertices[i]<3) {
+                mxFree(numVertices);
+                mexErrMsgTxt("There must be at least 3 vertices in each polygon.");
+            }
+            sumVertices+=numVertices[i];
+        }
+
+        if(numPolygons==0||sumVertices!=mxGetN(prhs[1])) {
+            mxFree(numVertices);
+            mexErrMsgTxt("The number of vertices in the polygons does not match the number of vertices given.");
+        }
+
+        theIndex=new PolygonIndexCPP(vertices,numVertices,numPolygons);
+        mxFree(numVertices);
+
+        //Lock this mex file so that it can not be cleared until the object
+        //has been deleted (This avoids a memory leak).
+        mexLock();
+        //Return the pointer to the index
+        plhs[0]=ptr2Matlab<PolygonIndexCPP*>(theIndex);
+    } else if(!strcmp("query",cmd)) {
+        size_t numPoints;
+        bool boundaryIsImportant=true;
+        const double *points;
+        size_t *numFound, *offsets, i;
+        vector<size_t> polyIdx;
+        vector<ptrdiff_t> omegas;
+        mxArray *clustParams[3];
+
+        if(nrhs<3) {
+            mexErrMsgTxt("Not enough inputs.");
+        }
+
+        theIndex=Matlab2Ptr<PolygonIndexCPP*>(prhs[1]);
+
+        checkRealDoubleArray(prhs[2]);
+        if(mxGetM(prhs[2])!=2) {
+            mexErrMsgTxt("The points must be two-dimensional.");
+        }
+        numPoints=mxGetN(prhs[2]);
+        points=(double*)mxGetData(prhs[2]);
+
+        if(nrhs>3&&!mxIsEmpty(prhs[3])) {
+            boundaryIsImportant=getBoolFromMatlab(prhs[3]);
+        }
+
+        numFound=new size_t[numPoints];
+        offsets=new size_t[numPoints];
+        theIndex->query(polyIdx,omegas,numFound,points,numPoints,boundaryIsImportant);
+
+        offsets[0]=0;
+        for(i=1;i<numPoints;i++) {
+            offsets[i]=offsets[i-1]+numFound[i-1];
+        }
+
+        //Put the results into an instance of the ClusterSet container
+        //class in Matlab.
+        clustParams[0]=unsignedSizeMat2Matlab(polyIdx.empty()?NULL:&polyIdx[0],polyIdx.size(),1);
+        clustParams[1]=unsignedSizeMat2Matlab(numFound,numPoints,1);
+        clustParams[2]=unsignedSizeMat2Matlab(offsets,numPoints,1);
+        delete[] offsets;
+        delete[] numFound;
+
+        mexCallMATLAB(1,plhs,3,clustParams,"ClusterSet");
+        mxDestroyArray(clustParams[0]);
+        mxDestroyArray(clustParams[1]);
+        mxDestroyArray(clustParams[2]);
+
+        if(nlhs>1) {
+            plhs[1]=signedSizeMat2Matlab(omegas.empty()?NULL:&omegas[0],omegas.size(),1);
+        }
+    } else if(!strcmp("pointIsInPolygon",cmd)) {
+        size_t polyIdx, numPoints;
+        bool boundaryIsImportant=true;
+        const double *points;
+        mxArray *isInPolygonMatlab, *omegasMatlab;
+        mxLogical *isInPolygon;
+        ptrdiff_t *omegas;
+
+        if(nrhs<4) {
+            mexErrMsgTxt("Not enough inputs.");
+        }
+
+        theIndex=Matlab2Ptr<PolygonIndexCPP*>(prhs[1]);
+        polyIdx=getSizeTFromMatlab(prhs[2]);
+        if(polyIdx>=theIndex->numPolygons) {
+            mexErrMsgTxt("The polygon index is out of range.");
+        }
+
+        checkRealDoubleArray(prhs[3]);
+        if(mxGetM(prhs[3])!=2) {
+            mexErrMsgTxt("The points must be two-dimensional.");
+        }
+        numPoints=mxGetN(prhs[3]);
+        points=(double*)mxGetData(prhs[3]);
+
+        if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+            boundaryIsImportant=getBoolFromMatlab(prhs[4]);
+        }
+
+        omegasMatlab=allocSignedSizeMatInMatlab(numPoints,1);
+        isInPolygonMatlab=mxCreateLogicalMatrix(numPoints,1);
+        isInPolygon=mxGetLogicals(isInPolygonMatlab);
+        omegas=(ptrdiff_t*)mxGetData(omegasMatlab);
+
+        {
+            ptrdiff_t curPoint;
+
+            #pragma omp parallel for schedule(static)
+            for(curPoint=0;curPoint<(ptrdiff_t)numPoints;curPoint++) {
+                isInPolygon[curPoint]=(mxLogical)theIndex->pointIsInPolygon(polyIdx,points+2*curPoint,boundaryIsImportant,omegas+curPoint);
+            }
+        }
+
+        plhs[0]=isInPolygonMatlab;
+        if(nlhs>1) {
+            plhs[1]=omegasMatlab;
+        } else {
+            mxDestroyArray(omegasMatlab);
+        }
+    } else if(!strcmp("getPolygon",cmd)) {
+        size_t polyIdx;
+
+        if(nrhs!=3) {
+            mexErrMsgTxt("Incorrect number of inputs.");
+        }
+
+        theIndex=Matlab2Ptr<PolygonIndexCPP*>(prhs[1]);
+        polyIdx=getSizeTFromMatlab(prhs[2]);
+        if(polyIdx>=theIndex->numPolygons) {
+            mexErrMsgTxt("The polygon index is out of range.");
+        }
+
+        plhs[0]=doubleMat2Matlab(theIndex->getVertices(polyIdx),2,theIndex->getNumVertices(polyIdx));
+    } else if(!strcmp("getDims",cmd)) {
+        theIndex=Matlab2Ptr<PolygonIndexCPP*>(prhs[1]);
+
+        plhs[0]=mxCreateDoubleScalar((double)theIndex->numPolygons);
+        if(nlhs>1) {
+            plhs[1]=mxCreateDoubleScalar((double)theIndex->totalNumVertices);
+        }
+    } else if(!strcmp("~PolygonIndexCPP", cmd)){
+        theIndex=Matlab2Ptr<PolygonIndexCPP*>(prhs[1]);
+
+        delete theIndex;
+        //Unlock the mex file allowing it to be cleared.
+        mexUnlock();
+    } else {
+        mexErrMsgTxt("Invalid string passed to PolygonIndexCPPInt.");
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
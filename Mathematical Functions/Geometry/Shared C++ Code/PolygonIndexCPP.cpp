@@ -0,0 +1,408 @@
+/**POLYGONINDEXCPP An index over a fixed set of polygons that makes it
+ *                 fast to determine which of the polygons contain each of
+ *                 a large number of points, for example when checking the
+ *                 positions of many targets against many regions of
+ *                 interest, some of which might have a large number of
+ *                 vertices.
+ *
+ *Two levels of indexation are used. First, for each polygon, the y extent
+ *of its bounding box is split into a number of equal-height horizontal
+ *bands and a list of the edges whose y extent overlaps each band is made.
+ *Determining whether a point is in a polygon using the winding number
+ *algorithm of pointIsInPolygonCPP only requires the edges whose y extent
+ *contains the y coordinate of the point, since no other edges can cross a
+ *horizontal ray from the point or contain the point. Thus, only the edges
+ *in the band holding the point are visited. The number of bands is chosen
+ *as large as possible (up to the number of edges) without the total number
+ *of edges in the band lists exceeding four times the number of edges, so
+ *that long edges do not make the lists excessively large. The results,
+ *including the winding number omega and the handling of points on the
+ *boundary, are the same as those of pointIsInPolygonCPP, except that the
+ *value of omega for points on the boundary (which is not meaningful) can
+ *differ.
+ *
+ *Second, the bounding boxes of the polygons are stored in an R-tree that
+ *is built once using the sort-tile-recursive (STR) packing algorithm of
+ *[1]. A query descends through all of the nodes whose bounding boxes
+ *contain the point, so the polygons whose bounding boxes do not contain
+ *the point are skipped in a time that is roughly logarithmic in the number
+ *of polygons.
+ *
+ *In query, the points are processed in blocks. If the code is compiled
+ *with OpenMP support, the blocks are processed in parallel.
+ *
+ *REFERENCES:
+ *[1] S. T. Leutenegger, M. A. Lopez, and J. Edgington, "STR: A simple and
+ *    efficient algorithm for R-tree packing," in Proceedings of the 13th
+ *    International Conference on Data Engineering, Birmingham, UK, 7-11
+ *    Apr. 1997, pp. 497-506.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "mathGeometricFuncs.hpp"
+//For sort, copy, min and max
+#include <algorithm>
+//For sqrt and ceil
+#include <cmath>
+//For pair
+#include <utility>
+
+using namespace std;
+
+//The maximum number of children of a node in the R-tree.
+static const size_t rTreeNodeCapacity=8;
+//The number of points processed together in a query.
+static const size_t queryBlockSize=1024;
+
+//Orders items by the center of their bounding boxes in one dimension.
+class BoxCenterLess {
+public:
+    const double *boxes;
+    size_t dim;
+
+    BoxCenterLess(const double *boxesIn,const size_t dimIn) {
+        boxes=boxesIn;
+        dim=dimIn;
+    }
+
+    bool operator()(const size_t a,const size_t b) const {
+        return boxes[4*a+dim]+boxes[4*a+dim+2]<boxes[4*b+dim]+boxes[4*b+dim+2];
+    }
+};
+
+static inline bool boxContainsPoint(const double *box,const double *point) {
+    return point[0]>=box[0]&&point[0]<=box[2]&&point[1]>=box[1]&&point[1]<=box[3];
+}
+
+PolygonIndexCPP::PolygonIndexCPP(const double *verticesIn,const size_t *numVerticesIn,const size_t numPolygonsIn) {
+/*POLYGONINDEXCPP Build the index. verticesIn holds the 2D vertices of all
+ *                of the polygons one after another, where polygon i has
+ *                numVerticesIn[i] vertices. Each polygon must have at
+ *                least 3 vertices and there must be at least one polygon.
+ */
+    size_t i;
+
+    numPolygons=numPolygonsIn;
+    vertexOffsets.resize(numPolygons+1);
+    vertexOffsets[0]=0;
+    for(i=0;i<numPolygons;i++) {
+        vertexOffsets[i+1]=vertexOffsets[i]+numVerticesIn[i];
+    }
+    totalNumVertices=vertexOffsets[numPolygons];
+    vertices.assign(verticesIn,verticesIn+2*totalNumVertices);
+
+    polyBoxes.resize(4*numPolygons);
+    for(i=0;i<numPolygons;i++) {
+        const double *P=&vertices[2*vertexOffsets[i]];
+        const size_t numVertices=numVerticesIn[i];
+        double *box=&polyBoxes[4*i];
+        size_t j;
+
+        box[0]=box[2]=P[0];
+        box[1]=box[3]=P[1];
+        for(j=1;j<numVertices;j++) {
+            box[0]=min(box[0],P[2*j]);
+            box[1]=min(box[1],P[2*j+1]);
+            box[2]=max(box[2],P[2*j]);
+            box[3]=max(box[3],P[2*j+1]);
+        }
+    }
+
+    bandHeight.resize(numPolygons);
+    numBands.resize(numPolygons);
+    bandOffsets.resize(numPolygons);
+    for(i=0;i<numPolygons;i++) {
+        buildEdgeGrid(i);
+    }
+
+    buildRTree();
+}
+
+size_t PolygonIndexCPP::getNumVertices(const size_t polyIdx) const {
+    return vertexOffsets[polyIdx+1]-vertexOffsets[polyIdx];
+}
+
+const double *PolygonIndexCPP::getVertices(const size_t polyIdx) const {
+    return &vertices[2*vertexOffsets[polyIdx]];
+}
+
+size_t PolygonIndexCPP::findBand(const size_t polyIdx,const double y) const {
+/*FINDBAND Get the index of the band of polygon polyIdx containing the y
+ *         coordinate y. Values outside of the bounding box are put in the
+ *         first or last band. As floating point rounding is monotonic,
+ *         the band index is a nondecreasing function of y, so an edge that
+ *         is listed in the bands of the y values of its endpoints and all
+ *         bands between them is in the band of any y value between them.
+ */
+    const double b=(y-polyBoxes[4*polyIdx+1])/bandHeight[polyIdx];
+
+    if(!(b>0)) {
+        return 0;
+    }
+    if(b>=(double)numBands[polyIdx]) {
+        return numBands[polyIdx]-1;
+    }
+    return (size_t)b;
+}
+
+void PolygonIndexCPP::buildEdgeGrid(const size_t polyIdx) {
+    const double *P=getVertices(polyIdx);
+    const size_t numVertices=getNumVertices(polyIdx);
+    const double yMin=polyBoxes[4*polyIdx+1];
+    const double yMax=polyBoxes[4*polyIdx+3];
+    size_t curBands=numVertices;
+    size_t i, offset;
+
+    //Reduce the number of bands until the band lists are not too long.
+    while(true) {
+        size_t totalListed=0;
+
+        bandHeight[polyIdx]=(yMax-yMin)/(double)curBands;
+        if(!(bandHeight[polyIdx]>0)) {
+            //A polygon that is a horizontal line.
+            curBands=1;
+            bandHeight[polyIdx]=1;
+        }
+        numBands[polyIdx]=curBands;
+
+        if(curBands==1) {
+            break;
+        }
+
+        for(i=0;i<numVertices;i++) {
+            const size_t iNext=(i+1<numVertices)?i+1:0;
+            const size_t bandLow=findBand(polyIdx,min(P[2*i+1],P[2*iNext+1]));
+            const size_t bandHigh=findBand(polyIdx,max(P[2*i+1],P[2*iNext+1]));
+
+            totalListed+=bandHigh-bandLow+1;
+        }
+
+        if(totalListed<=4*numVertices) {
+            break;
+        }
+        curBands/=2;
+    }
+
+    //Count the edges in each band and then fill in the lists. bandStart
+    //is first used to hold the counts and then the end of the filled part
+    //of each band, which after filling is the start of the next band.
+    offset=bandStart.size();
+    bandOffsets[polyIdx]=offset;
+    bandStart.resize(offset+curBands+1,0);
+    for(i=0;i<numVertices;i++) {
+        const size_t iNext=(i+1<numVertices)?i+1:0;
+        const size_t bandLow=findBand(polyIdx,min(P[2*i+1],P[2*iNext+1]));
+        const size_t bandHigh=findBand(polyIdx,max(P[2*i+1],P[2*iNext+1]));
+        size_t b;
+
+        for(b=bandLow;b<=bandHigh;b++) {
+            bandStart[offset+b+1]++;
+        }
+    }
+    bandStart[offset]=edges.size();
+    for(i=0;i<curBands;i++) {
+        bandStart[offset+i+1]+=bandStart[offset+i];
+    }
+    edges.resize(bandStart[offset+curBands]);
+
+    //Shift the starts so that bandStart[offset+b+1] is the next free
+    //location in band b.
+    for(i=curBands;i>0;i--) {
+        bandStart[offset+i]=bandStart[offset+i-1];
+    }
+    for(i=0;i<numVertices;i++) {
+        const size_t iNext=(i+1<numVertices)?i+1:0;
+        const size_t bandLow=findBand(polyIdx,min(P[2*i+1],P[2*iNext+1]));
+        const size_t bandHigh=findBand(polyIdx,max(P[2*i+1],P[2*iNext+1]));
+        size_t b;
+
+        for(b=bandLow;b<=bandHigh;b++) {
+            edges[bandStart[offset+b+1]++]=i;
+        }
+    }
+}
+
+void PolygonIndexCPP::buildRTree() {
+/*BUILDRTREE Build the R-tree over the bounding boxes of the polygons a
+ *           level at a time using STR packing. At each level, the items
+ *           are sorted by the x coordinates of the centers of their boxes
+ *           and split into vertical slices, each of which is sorted by
+ *           the y coordinates of the centers and cut into nodes of
+ *           rTreeNodeCapacity items.
+ */
+    vector<size_t> curItems(numPolygons), nextItems;
+    bool isLeafLevel=true;
+    size_t i;
+
+    for(i=0;i<numPolygons;i++) {
+        curItems[i]=i;
+    }
+
+    do {
+        const size_t numItems=curItems.size();
+        const size_t numNodes=(numItems+rTreeNodeCapacity-1)/rTreeNodeCapacity;
+        const size_t numSlices=(size_t)ceil(sqrt((double)numNodes));
+        const size_t sliceSize=numSlices*rTreeNodeCapacity;
+        const double *boxes=isLeafLevel?&polyBoxes[0]:&nodeBoxes[0];
+
+        sort(curItems.begin(),curItems.end(),BoxCenterLess(boxes,0));
+        for(i=0;i<numItems;i+=sliceSize) {
+            sort(curItems.begin()+i,curItems.begin()+min(i+sliceSize,numItems),BoxCenterLess(boxes,1));
+        }
+
+        nextItems.clear();
+        for(i=0;i<numItems;i+=rTreeNodeCapacity) {
+            const size_t iEnd=min(i+rTreeNodeCapacity,numItems);
+            double box[4];
+            size_t j;
+
+            //The nodeBoxes vector is not accessed through the boxes
+            //pointer here, since adding nodes can reallocate it.
+            for(j=i;j<iEnd;j++) {
+                const double *childBox=isLeafLevel?&polyBoxes[4*curItems[j]]:&nodeBoxes[4*curItems[j]];
+
+                if(j==i) {
+                    copy(childBox,childBox+4,box);
+                } else {
+                    box[0]=min(box[0],childBox[0]);
+                    box[1]=min(box[1],childBox[1]);
+                    box[2]=max(box[2],childBox[2]);
+                    box[3]=max(box[3],childBox[3]);
+                }
+            }
+
+            nextItems.push_back(nodeIsLeaf.size());
+            nodeIsLeaf.push_back(isLeafLevel);
+            childStart.push_back(children.size());
+            children.insert(children.end(),curItems.begin()+i,curItems.begin()+iEnd);
+            nodeBoxes.insert(nodeBoxes.end(),box,box+4);
+        }
+
+        curItems.swap(nextItems);
+        isLeafLevel=false;
+    } while(curItems.size()>1);
+
+    childStart.push_back(children.size());
+}
+
+bool PolygonIndexCPP::pointIsInPolygon(const size_t polyIdx,const double *point,const bool boundaryIsImportant,ptrdiff_t *omega) const {
+/*POINTISINPOLYGON Determine whether the point is in polygon polyIdx,
+ *                 using the edge grid. This has the same inputs and
+ *                 outputs as pointIsInPolygonCPP.
+ */
+    const double *P=getVertices(polyIdx);
+    const size_t numVertices=getNumVertices(polyIdx);
+    size_t band, i, iEnd;
+
+    *omega=0;
+    //The winding number is zero outside of the bounding box.
+    if(!boxContainsPoint(&polyBoxes[4*polyIdx],point)) {
+        return false;
+    }
+
+    if(boundaryIsImportant&&(P[0]==point[0])&&(P[1]==point[1])) {
+        return true;
+    }
+
+    band=bandOffsets[polyIdx]+findBand(polyIdx,point[1]);
+    iEnd=bandStart[band+1];
+    for(i=bandStart[band];i<iEnd;i++) {
+        const size_t edgeIdx=edges[i];
+        const size_t idxIPlus1=(edgeIdx+1<numVertices)?2*(edgeIdx+1):0;
+        bool isOnBoundary;
+
+        *omega+=polygonEdgeOmegaIncCPP(P,point,2*edgeIdx,idxIPlus1,boundaryIsImportant,&isOnBoundary);
+        if(isOnBoundary) {
+            return true;
+        }
+    }
+    return *omega%2!=0;
+}
+
+void PolygonIndexCPP::query(vector<size_t> &polyIdx,vector<ptrdiff_t> &omegas,size_t *numFound,const double *points,const size_t numPoints,const bool boundaryIsImportant) const {
+/*QUERY Find the polygons containing each of the numPoints 2D points in
+ *      points. The indices of the polygons containing each point are
+ *      placed in polyIdx in increasing order, one point after another,
+ *      and the corresponding winding numbers are placed in omegas. The
+ *      number of polygons containing point i is placed in numFound[i].
+ */
+    const size_t numBlocks=(numPoints+queryBlockSize-1)/queryBlockSize;
+    vector<vector<pair<size_t,ptrdiff_t> > > blockResults(numBlocks);
+    size_t i;
+
+    #pragma omp parallel
+    {
+        vector<size_t> nodeStack;
+        vector<pair<size_t,ptrdiff_t> > curFound;
+        ptrdiff_t curBlock;
+
+        #pragma omp for schedule(dynamic)
+        for(curBlock=0;curBlock<(ptrdiff_t)numBlocks;curBlock++) {
+            const size_t pointEnd=min((curBlock+1)*queryBlockSize,numPoints);
+            size_t curPoint;
+
+            for(curPoint=curBlock*queryBlockSize;curPoint<pointEnd;curPoint++) {
+                const double *point=points+2*curPoint;
+
+                curFound.clear();
+                nodeStack.push_back(nodeIsLeaf.size()-1);
+                while(!nodeStack.empty()) {
+                    const size_t curNode=nodeStack.back();
+                    size_t j;
+
+                    nodeStack.pop_back();
+                    if(!boxContainsPoint(&nodeBoxes[4*curNode],point)) {
+                        continue;
+                    }
+
+                    for(j=childStart[curNode];j<childStart[curNode+1];j++) {
+                        if(nodeIsLeaf[curNode]) {
+                            ptrdiff_t omega;
+
+                            if(pointIsInPolygon(children[j],point,boundaryIsImportant,&omega)) {
+                                curFound.push_back(make_pair(children[j],omega));
+                            }
+                        } else {
+                            nodeStack.push_back(children[j]);
+                        }
+                    }
+                }
+
+                sort(curFound.begin(),curFound.end());
+                numFound[curPoint]=curFound.size();
+                blockResults[curBlock].insert(blockResults[curBlock].end(),curFound.begin(),curFound.end());
+            }
+        }
+    }
+
+    polyIdx.clear();
+    omegas.clear();
+    for(i=0;i<numBlocks;i++) {
+        size_t j;
+
+        for(j=0;j<blockResults[i].size();j++) {
+            polyIdx.push_back(blockResults[i][j].first);
+            omegas.push_back(blockResults[i][j].second);
+        }
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,220 @@
+/**CONVEXHULL2DCPP C++ implementations of functions for finding the convex
+ *                 hull of a set of 2D points and for determining whether
+ *                 a polygon is convex. All of the orientation tests are
+ *                 done using the exact predicate orient2DCPP, so the
+ *                 results are not affected by finite precision errors,
+ *                 barring overflow or underflow.
+ *
+ *The convex hull is found using Andrew's monotone chain algorithm from [1],
+ *which sorts the points by their x coordinates (and their y coordinates in
+ *the case of ties) and then builds the lower and upper parts of the hull
+ *by scanning the points from left to right and from right to left. Unlike
+ *Graham's algorithm, which is used in findConvexHull2D, the sorting only
+ *requires comparing coordinates and not angles. The complexity is
+ *O(N log(N)) due to the sorting; the scans are O(N).
+ *
+ *REFERENCES:
+ *[1] A. M. Andrew, "Another efficient algorithm for convex hulls in two
+ *    dimensions," Information Processing Letters, vol. 9, no. 5, pp.
+ *    216-219, Dec. 1979.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "mathGeometricFuncs.hpp"
+//For sort
+#include <algorithm>
+
+using namespace std;
+
+//Orders the indices of points by their x coordinates, breaking ties using
+//the y coordinates.
+class PointLexLess {
+public:
+    const double *points;
+
+    PointLexLess(const double *pointsIn) {
+        points=pointsIn;
+    }
+
+    bool operator()(const size_t a,const size_t b) const {
+        const double *pa=points+2*a;
+        const double *pb=points+2*b;
+
+        return pa[0]<pb[0]||(pa[0]==pb[0]&&pa[1]<pb[1]);
+    }
+};
+
+static bool pointsAreEqual(const double *a,const double *b) {
+    return a[0]==b[0]&&a[1]==b[1];
+}
+
+size_t convexHull2DCPP(size_t *hullIdx,const double *points,const size_t numPoints) {
+/*CONVEXHULL2DCPP Find the convex hull of a set of numPoints 2D points,
+ *                given as [x;y] pairs. The indices of the points that are
+ *                vertices of the hull are placed in hullIdx, which must
+ *                have space for numPoints+1 elements (the extra element is
+ *                used as scratch space), in counterclockwise
+ *                order starting with the point having the smallest x
+ *                coordinate (and the smallest y coordinate in the case of
+ *                ties). Points on the edges of the hull are not included
+ *                and, of repeated points, only the one with the lowest
+ *                index can be a vertex. The number of vertices of the hull
+ *                is returned. If all of the points are the same, one
+ *                vertex is returned and if all of the points are
+ *                collinear, the two endpoints are returned.
+ */
+    vector<size_t> order(numPoints);
+    size_t i, numUnique, numHull;
+
+    if(numPoints==0) {
+        return 0;
+    }
+
+    for(i=0;i<numPoints;i++) {
+        order[i]=i;
+    }
+    //A stable sort keeps repeated points in the order of their indices.
+    //Repeated points are then adjacent and all but the first are removed.
+    stable_sort(order.begin(),order.end(),PointLexLess(points));
+    numUnique=1;
+    for(i=1;i<numPoints;i++) {
+        if(!pointsAreEqual(points+2*order[numUnique-1],points+2*order[i])) {
+            order[numUnique++]=order[i];
+        }
+    }
+
+    if(numUnique==1) {
+        hullIdx[0]=order[0];
+        return 1;
+    }
+
+    //The lower hull, going from left to right. A point is removed from the
+    //end of the hull if it does not make a left turn.
+    numHull=0;
+    for(i=0;i<numUnique;i++) {
+        const double *curPoint=points+2*order[i];
+
+        while(numHull>=2&&orient2DCPP(points+2*hullIdx[numHull-2],points+2*hullIdx[numHull-1],curPoint)<=0) {
+            numHull--;
+        }
+        hullIdx[numHull++]=order[i];
+    }
+
+    //The upper hull, going from right to left. The rightmost point is
+    //already on the end of the hull.
+    {
+        const size_t numLower=numHull;
+        ptrdiff_t j;
+
+        for(j=(ptrdiff_t)numUnique-2;j>=0;j--) {
+            const double *curPoint=points+2*order[j];
+
+            while(numHull>numLower&&orient2DCPP(points+2*hullIdx[numHull-2],points+2*hullIdx[numHull-1],curPoint)<=0) {
+                numHull--;
+            }
+            hullIdx[numHull++]=order[j];
+        }
+    }
+
+    //The last point added is the first point of the lower hull again.
+    numHull--;
+    return numHull;
+}
+
+bool polygonIsConvexCPP(const double *vertices,const size_t numVertices) {
+/*POLYGONISCONVEXCPP Determine whether a polygon, given by numVertices
+ *                   2D vertices in either order, is convex. Repeated
+ *                   consecutive vertices (including the first vertex
+ *                   repeated at the end) are ignored, as are vertices at
+ *                   which the polygon goes straight. The polygon is convex
+ *                   if all of its other vertices turn in the same
+ *                   direction and if it goes around only once. The latter
+ *                   condition rules out polygons such as pentagrams, which
+ *                   always turn in the same direction. It is tested by
+ *                   counting how many times the direction of the edges
+ *                   changes between going right and going left, which can
+ *                   only happen twice in a convex polygon. Polygons with
+ *                   fewer than three distinct vertices, with all vertices
+ *                   collinear, or which double back on themselves are not
+ *                   convex.
+ */
+    vector<size_t> idx;
+    size_t i, numDistinct, numXChanges=0;
+    int turnSign=0, prevXSign=0, firstXSign=0;
+
+    //Get the indices of the vertices, skipping repeated vertices.
+    idx.reserve(numVertices);
+    for(i=0;i<numVertices;i++) {
+        const double *curVertex=vertices+2*i;
+
+        if(idx.empty()||curVertex[0]!=vertices[2*idx.back()]||curVertex[1]!=vertices[2*idx.back()+1]) {
+            idx.push_back(i);
+        }
+    }
+    while(idx.size()>1&&vertices[2*idx[0]]==vertices[2*idx.back()]&&vertices[2*idx[0]+1]==vertices[2*idx.back()+1]) {
+        idx.pop_back();
+    }
+
+    numDistinct=idx.size();
+    if(numDistinct<3) {
+        return false;
+    }
+
+    for(i=0;i<numDistinct;i++) {
+        const double *v1=vertices+2*idx[i];
+        const double *v2=vertices+2*idx[(i+1)%numDistinct];
+        const double *v3=vertices+2*idx[(i+2)%numDistinct];
+        const int curTurn=orient2DCPP(v1,v2,v3);
+        const int curXSign=(v2[0]>v1[0])-(v2[0]<v1[0]);
+
+        if(curTurn==0) {
+            //The polygon doubles back on itself if the edges go in
+            //opposite directions.
+            if((v2[0]-v1[0])*(v3[0]-v2[0])<0||(v2[1]-v1[1])*(v3[1]-v2[1])<0) {
+                return false;
+            }
+        } else if(turnSign==0) {
+            turnSign=curTurn;
+        } else if(curTurn!=turnSign) {
+            return false;
+        }
+
+        //Count the changes in the horizontal direction of the edges,
+        //ignoring vertical edges.
+        if(curXSign!=0) {
+            if(prevXSign==0) {
+                firstXSign=curXSign;
+            } else if(curXSign!=prevXSign) {
+                numXChanges++;
+            }
+            prevXSign=curXSign;
+        }
+    }
+
+    //The change going from the last edge to the first.
+    if(prevXSign!=firstXSign) {
+        numXChanges++;
+    }
+
+    return turnSign!=0&&numXChanges<=2;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
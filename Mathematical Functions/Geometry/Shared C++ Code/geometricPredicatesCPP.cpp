@@ -0,0 +1,859 @@
+/**GEOMETRICPREDICATESCPP Robust C++ implementations of the 2D orientation,
+ *                  3D orientation and incircle predicates. The predicates
+ *                  return the sign of a determinant, which is the basis of
+ *                  convex hulls, polygon clipping, Delaunay triangulations
+ *                  and many other geometric algorithms. The determinants
+ *                  are first evaluated in normal double precision
+ *                  arithmetic and the result is only used if its magnitude
+ *                  exceeds a bound on the finite precision error. The
+ *                  bounds are those of Shewchuk in [1]. Otherwise, which
+ *                  only happens for nearly degenerate inputs, the
+ *                  determinant is evaluated exactly using the floating
+ *                  point expansion arithmetic of [1]. The sign that is
+ *                  returned is thus always correct, barring overflow and
+ *                  underflow in the computations.
+ *
+ *The functions crossingComparePointCPP and crossingCompareCPP order the
+ *point at which two lines cross, which generally cannot be represented
+ *exactly, against a given point or against another such crossing, as is
+ *needed for the event queue of sweep-line algorithms. The coordinates of
+ *a crossing are ratios of polynomials in the inputs, so the comparisons
+ *are the signs of polynomials of degree 3 and 5. The filters for these
+ *bound the error of the double precision evaluation with a running error
+ *analysis rather than with a fixed bound as in [1].
+ *
+ *The adaptive intermediate stages of [1], which reuse the error terms of
+ *the approximate result, are not implemented. Rather, when the filter
+ *fails, the determinant is evaluated exactly from the coordinates. As the
+ *filter almost never fails for inputs that are not nearly degenerate, this
+ *has little effect on the average speed.
+ *
+ *The batch functions evaluate the filter for all points in a first loop
+ *that has no branches depending on the data, which the compiler can
+ *vectorize, marking the points for which the filter is inconclusive. Only
+ *the marked points are then evaluated exactly in a second loop. If
+ *compiled with OpenMP support, both loops are run in parallel.
+ *
+ *The expansion arithmetic depends on each floating point operation being
+ *correctly rounded to double precision. Thus, the functions must not be
+ *compiled with options that allow the compiler to reorder floating point
+ *operations (such as -ffast-math), to fuse multiplications and additions,
+ *or to keep intermediate results with extended precision (x87
+ *arithmetic). The default options on 64-bit systems meet these
+ *requirements.
+ *
+ *REFERENCES:
+ *[1] J. R. Shewchuk, "Adaptive precision floating-point arithmetic and
+ *    fast robust geometric predicates," Discrete & Computational Geometry,
+ *    vol. 18, no. 3, pp. 305-363, Oct. 1997.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "mathGeometricFuncs.hpp"
+//For fabs
+#include <cmath>
+
+using namespace std;
+
+//Half of the unit in the last place of 1, 2^(-53), and the value
+//2^27+1, which is used to split doubles into two halves having 26 bits
+//each.
+static const double epsilon=1.1102230246251565404e-16;
+static const double splitter=134217729.0;
+
+//The error bounds of [1] on the results of the double precision
+//evaluations of the determinants.
+static const double ccwErrBoundA=(3.0+16.0*epsilon)*epsilon;
+static const double o3dErrBoundA=(7.0+56.0*epsilon)*epsilon;
+static const double iccErrBoundA=(10.0+96.0*epsilon)*epsilon;
+
+//The value placed in the output of the filter in the batch functions to
+//indicate that the exact determinant is needed.
+static const double notDetermined=2.0;
+
+//The factor by which the running error bounds of the crossing filters are
+//enlarged to cover the rounding errors made when computing the bounds
+//themselves.
+static const double runningErrSafety=1.0+128.0*epsilon;
+
+//A double precision value and a bound on the magnitude of its error with
+//respect to the exact value, for the filters of the crossing comparisons.
+class ErrBoundedVal {
+public:
+    double val;
+    double err;
+
+    ErrBoundedVal() {
+        val=0;
+        err=0;
+    }
+
+    ErrBoundedVal(const double valIn,const double errIn) {
+        val=valIn;
+        err=errIn;
+    }
+};
+
+//Prototypes for the expansion arithmetic.
+static inline void twoSum(const double a,const double b,double &x,double &y);
+static inline void twoDiff(const double a,const double b,double &x,double &y);
+static inline void splitDouble(const double a,double &aHi,double &aLo);
+static inline void twoProduct(const double a,const double b,double &x,double &y);
+static size_t diffExpansion(const double a,const double b,double *h);
+static size_t expansionSum(const size_t eLen,const double *e,const size_t fLen,const double *f,double *h);
+static size_t scaleExpansion(const size_t eLen,const double *e,const double b,double *h);
+static size_t expansionProduct(const size_t eLen,const double *e,const size_t fLen,const double *f,double *h);
+static void negateExpansion(const size_t eLen,double *e);
+static inline int expansionSign(const size_t eLen,const double *e);
+static size_t expansionProductLong(const size_t eLen,const double *e,const size_t fLen,const double *f,vector<double> &h);
+
+//Prototypes for the filters and the exact evaluations.
+static inline double orient2DFilter(const double *pa,const double *pb,const double *pc);
+static inline double orient3DFilter(const double *pa,const double *pb,const double *pc,const double *pd);
+static inline double inCircleFilter(const double *pa,const double *pb,const double *pc,const double *pd);
+static int orient2DExact(const double *pa,const double *pb,const double *pc);
+static int orient3DExact(const double *pa,const double *pb,const double *pc,const double *pd);
+static int inCircleExact(const double *pa,const double *pb,const double *pc,const double *pd);
+static size_t orient2DExpansion(const double *pa,const double *pb,const double *pc,double *det);
+
+//Prototypes for the crossing comparisons.
+static inline ErrBoundedVal errDiff(const ErrBoundedVal &a,const ErrBoundedVal &b);
+static inline ErrBoundedVal errProduct(const ErrBoundedVal &a,const ErrBoundedVal &b);
+static inline double errSign(const ErrBoundedVal &a);
+static ErrBoundedVal orient2DErrBounded(const double *pa,const double *pb,const double *pc);
+static void crossingFilter(ErrBoundedVal *num,ErrBoundedVal &den,const double *p1,const double *p2,const double *q1,const double *q2);
+static void crossingExpansions(double num[2][64],size_t *numLen,double *den,size_t &denLen,const double *p1,const double *p2,const double *q1,const double *q2);
+static int crossingComparePointExact(const double *p1,const double *p2,const double *q1,const double *q2,const double *point);
+static int crossingCompareExact(const double *p1,const double *p2,const double *q1,const double *q2,const double *r1,const double *r2,const double *s1,const double *s2);
+
+int orient2DCPP(const double *pa,const double *pb,const double *pc) {
+/*ORIENT2DCPP Return 1 if the 2D points pa, pb and pc are in
+ *             counterclockwise order, -1 if they are in clockwise order
+ *             and 0 if they are collinear. This is the sign of
+ *             det([pa,pb,pc;1,1,1]).
+ */
+    const double filterVal=orient2DFilter(pa,pb,pc);
+
+    if(filterVal!=notDetermined) {
+        return (int)filterVal;
+    }
+    return orient2DExact(pa,pb,pc);
+}
+
+int orient3DCPP(const double *pa,const double *pb,const double *pc,const double *pd) {
+/*ORIENT3DCPP Return the sign of det([pa,pb,pc,pd;1,1,1,1]) for the 3D
+ *             points pa, pb, pc and pd. This is 1 if pd lies below the
+ *             plane through pa, pb and pc, where below is such that pa, pb
+ *             and pc appear in counterclockwise order when viewed from
+ *             above the plane, -1 if pd is above the plane and 0 if the
+ *             points are coplanar.
+ */
+    const double filterVal=orient3DFilter(pa,pb,pc,pd);
+
+    if(filterVal!=notDetermined) {
+        return (int)filterVal;
+    }
+    return orient3DExact(pa,pb,pc,pd);
+}
+
+int inCircleCPP(const double *pa,const double *pb,const double *pc,const double *pd) {
+/*INCIRCLECPP Given 2D points pa, pb and pc in counterclockwise order,
+ *             return 1 if pd is inside of the circle passing through the
+ *             three points, -1 if it is outside and 0 if the four points
+ *             are cocircular. If pa, pb and pc are in clockwise order, the
+ *             sign of the result is reversed. This is the sign of
+ *             det([pa,pb,pc,pd;sum([pa,pb,pc,pd].^2,1);1,1,1,1]).
+ */
+    const double filterVal=inCircleFilter(pa,pb,pc,pd);
+
+    if(filterVal!=notDetermined) {
+        return (int)filterVal;
+    }
+    return inCircleExact(pa,pb,pc,pd);
+}
+
+int crossingComparePointCPP(const double *p1,const double *p2,const double *q1,const double *q2,const double *point) {
+/*CROSSINGCOMPAREPOINTCPP Compare the point at which the line through p1
+ *             and p2 crosses the line through q1 and q2 with the point
+ *             point, ordering points by their x coordinates and then by
+ *             their y coordinates. The return value is -1 if the crossing
+ *             comes first, 1 if it comes after point and 0 if they are the
+ *             same point. The lines must not be parallel.
+ */
+    ErrBoundedVal num[2], den;
+    double denSign;
+    size_t k;
+
+    //Coordinate k of the crossing is num[k]/den.
+    crossingFilter(num,den,p1,p2,q1,q2);
+    denSign=errSign(den);
+    if(denSign==notDetermined) {
+        return crossingComparePointExact(p1,p2,q1,q2,point);
+    }
+
+    for(k=0;k<2;k++) {
+        const double diffSign=errSign(errDiff(num[k],errProduct(den,ErrBoundedVal(point[k],0))));
+
+        if(diffSign==notDetermined) {
+            return crossingComparePointExact(p1,p2,q1,q2,point);
+        }
+        if(diffSign!=0) {
+            return (int)(diffSign*denSign);
+        }
+    }
+    return 0;
+}
+
+int crossingCompareCPP(const double *p1,const double *p2,const double *q1,const double *q2,const double *r1,const double *r2,const double *s1,const double *s2) {
+/*CROSSINGCOMPARECPP Compare the point at which the line through p1 and p2
+ *             crosses the line through q1 and q2 with the point at which
+ *             the line through r1 and r2 crosses the line through s1 and
+ *             s2, ordering points by their x coordinates and then by their
+ *             y coordinates. The return value is -1 if the first crossing
+ *             comes first, 1 if it comes second and 0 if they are the same
+ *             point. Neither pair of lines can be parallel.
+ */
+    ErrBoundedVal num1[2], den1, num2[2], den2;
+    double den1Sign, den2Sign;
+    size_t k;
+
+    crossingFilter(num1,den1,p1,p2,q1,q2);
+    crossingFilter(num2,den2,r1,r2,s1,s2);
+    den1Sign=errSign(den1);
+    den2Sign=errSign(den2);
+    if(den1Sign==notDetermined||den2Sign==notDetermined) {
+        return crossingCompareExact(p1,p2,q1,q2,r1,r2,s1,s2);
+    }
+
+    for(k=0;k<2;k++) {
+        //The sign of num1[k]/den1-num2[k]/den2 times den1*den2.
+        const double diffSign=errSign(errDiff(errProduct(num1[k],den2),errProduct(num2[k],den1)));
+
+        if(diffSign==notDetermined) {
+            return crossingCompareExact(p1,p2,q1,q2,r1,r2,s1,s2);
+        }
+        if(diffSign!=0) {
+            return (int)(diffSign*den1Sign*den2Sign);
+        }
+    }
+    return 0;
+}
+
+void orient2DBatchCPP(double *signs,const double *pa,const double *pb,const double *pc,const size_t N) {
+/*ORIENT2DBATCHCPP Evaluate orient2DCPP for N sets of points. pa, pb and
+ *             pc are 2XN matrices stored by column and the results are
+ *             placed in the length-N array signs.
+ */
+    #pragma omp parallel
+    {
+        ptrdiff_t i;
+
+        #pragma omp for schedule(static)
+        for(i=0;i<(ptrdiff_t)N;i++) {
+            signs[i]=orient2DFilter(pa+2*i,pb+2*i,pc+2*i);
+        }
+
+        #pragma omp for schedule(dynamic,64)
+        for(i=0;i<(ptrdiff_t)N;i++) {
+            if(signs[i]==notDetermined) {
+                signs[i]=(double)orient2DExact(pa+2*i,pb+2*i,pc+2*i);
+            }
+        }
+    }
+}
+
+void orient3DBatchCPP(double *signs,const double *pa,const double *pb,const double *pc,const double *pd,const size_t N) {
+/*ORIENT3DBATCHCPP Evaluate orient3DCPP for N sets of points. pa, pb, pc
+ *             and pd are 3XN matrices stored by column and the results
+ *             are placed in the length-N array signs.
+ */
+    #pragma omp parallel
+    {
+        ptrdiff_t i;
+
+        #pragma omp for schedule(static)
+        for(i=0;i<(ptrdiff_t)N;i++) {
+            signs[i]=orient3DFilter(pa+3*i,pb+3*i,pc+3*i,pd+3*i);
+        }
+
+        #pragma omp for schedule(dynamic,64)
+        for(i=0;i<(ptrdiff_t)N;i++) {
+            if(signs[i]==notDetermined) {
+                signs[i]=(double)orient3DExact(pa+3*i,pb+3*i,pc+3*i,pd+3*i);
+            }
+        }
+    }
+}
+
+void inCircleBatchCPP(double *signs,const double *pa,const double *pb,const double *pc,const double *pd,const size_t N) {
+/*INCIRCLEBATCHCPP Evaluate inCircleCPP for N sets of points. pa, pb, pc
+ *             and pd are 2XN matrices stored by column and the results
+ *             are placed in the length-N array signs.
+ */
+    #pragma omp parallel
+    {
+        ptrdiff_t i;
+
+        #pragma omp for schedule(static)
+        for(i=0;i<(ptrdiff_t)N;i++) {
+            signs[i]=inCircleFilter(pa+2*i,pb+2*i,pc+2*i,pd+2*i);
+        }
+
+        #pragma omp for schedule(dynamic,64)
+        for(i=0;i<(ptrdiff_t)N;i++) {
+            if(signs[i]==notDetermined) {
+                signs[i]=(double)inCircleExact(pa+2*i,pb+2*i,pc+2*i,pd+2*i);
+            }
+        }
+    }
+}
+
+static inline double orient2DFilter(const double *pa,const double *pb,const double *pc) {
+/*ORIENT2DFILTER Return the sign of the 2D orientation determinant as a
+ *                double if the double precision result is certain and
+ *                notDetermined otherwise.
+ */
+    const double detLeft=(pa[0]-pc[0])*(pb[1]-pc[1]);
+    const double detRight=(pa[1]-pc[1])*(pb[0]-pc[0]);
+    const double det=detLeft-detRight;
+    const double errBound=ccwErrBoundA*(fabs(detLeft)+fabs(detRight));
+
+    return det>errBound?1.0:(-det>errBound?-1.0:notDetermined);
+}
+
+static inline double orient3DFilter(const double *pa,const double *pb,const double *pc,const double *pd) {
+/*ORIENT3DFILTER Return the sign of the 3D orientation determinant as a
+ *                double if the double precision result is certain and
+ *                notDetermined otherwise.
+ */
+    const double adx=pa[0]-pd[0];
+    const double ady=pa[1]-pd[1];
+    const double adz=pa[2]-pd[2];
+    const double bdx=pb[0]-pd[0];
+    const double bdy=pb[1]-pd[1];
+    const double bdz=pb[2]-pd[2];
+    const double cdx=pc[0]-pd[0];
+    const double cdy=pc[1]-pd[1];
+    const double cdz=pc[2]-pd[2];
+    const double bdxcdy=bdx*cdy;
+    const double cdxbdy=cdx*bdy;
+    const double cdxady=cdx*ady;
+    const double adxcdy=adx*cdy;
+    const double adxbdy=adx*bdy;
+    const double bdxady=bdx*ady;
+    const double det=adz*(bdxcdy-cdxbdy)+bdz*(cdxady-adxcdy)+cdz*(adxbdy-bdxady);
+    const double permanent=(fabs(bdxcdy)+fabs(cdxbdy))*fabs(adz)+(fabs(cdxady)+fabs(adxcdy))*fabs(bdz)+(fabs(adxbdy)+fabs(bdxady))*fabs(cdz);
+    const double errBound=o3dErrBoundA*permanent;
+
+    return det>errBound?1.0:(-det>errBound?-1.0:notDetermined);
+}
+
+static inline double inCircleFilter(const double *pa,const double *pb,const double *pc,const double *pd) {
+/*INCIRCLEFILTER Return the sign of the incircle determinant as a double
+ *                if the double precision result is certain and
+ *                notDetermined otherwise.
+ */
+    const double adx=pa[0]-pd[0];
+    const double ady=pa[1]-pd[1];
+    const double bdx=pb[0]-pd[0];
+    const double bdy=pb[1]-pd[1];
+    const double cdx=pc[0]-pd[0];
+    const double cdy=pc[1]-pd[1];
+    const double bdxcdy=bdx*cdy;
+    const double cdxbdy=cdx*bdy;
+    const double cdxady=cdx*ady;
+    const double adxcdy=adx*cdy;
+    const double adxbdy=adx*bdy;
+    const double bdxady=bdx*ady;
+    const double aLift=adx*adx+ady*ady;
+    const double bLift=bdx*bdx+bdy*bdy;
+    const double cLift=cdx*cdx+cdy*cdy;
+    const double det=aLift*(bdxcdy-cdxbdy)+bLift*(cdxady-adxcdy)+cLift*(adxbdy-bdxady);
+    const double permanent=(fabs(bdxcdy)+fabs(cdxbdy))*aLift+(fabs(cdxady)+fabs(adxcdy))*bLift+(fabs(adxbdy)+fabs(bdxady))*cLift;
+    const double errBound=iccErrBoundA*permanent;
+
+    return det>errBound?1.0:(-det>errBound?-1.0:notDetermined);
+}
+
+static int orient2DExact(const double *pa,const double *pb,const double *pc) {
+/*ORIENT2DEXACT Evaluate the sign of the 2D orientation determinant
+ *               exactly.
+ */
+    double det[16];
+    const size_t detLen=orient2DExpansion(pa,pb,pc,det);
+
+    return expansionSign(detLen,det);
+}
+
+static size_t orient2DExpansion(const double *pa,const double *pb,const double *pc,double *det) {
+/*ORIENT2DEXPANSION Evaluate the 2D orientation determinant
+ *               (pa[0]-pc[0])*(pb[1]-pc[1])-(pa[1]-pc[1])*(pb[0]-pc[0])
+ *               exactly as an expansion, placing it in det and returning
+ *               its length. The differences are exact as expansions of
+ *               length 2, so the products have at most 8 components and
+ *               the determinant at most 16.
+ */
+    double acx[2], acy[2], bcx[2], bcy[2];
+    double prod1[8], prod2[8];
+    size_t acxLen, acyLen, bcxLen, bcyLen, len1, len2;
+
+    acxLen=diffExpansion(pa[0],pc[0],acx);
+    acyLen=diffExpansion(pa[1],pc[1],acy);
+    bcxLen=diffExpansion(pb[0],pc[0],bcx);
+    bcyLen=diffExpansion(pb[1],pc[1],bcy);
+
+    len1=expansionProduct(acxLen,acx,bcyLen,bcy,prod1);
+    len2=expansionProduct(acyLen,acy,bcxLen,bcx,prod2);
+    negateExpansion(len2,prod2);
+    return expansionSum(len1,prod1,len2,prod2,det);
+}
+
+static int orient3DExact(const double *pa,const double *pb,const double *pc,const double *pd) {
+/*ORIENT3DEXACT Evaluate the sign of the 3D orientation determinant
+ *               exactly. Each 2X2 minor has at most 16 components, each
+ *               product with a z difference at most 64 and the
+ *               determinant at most 192.
+ */
+    double d[3][3][2];
+    size_t dLen[3][3];
+    double prod1[8], prod2[8];
+    double minor[16], term[3][64], partSum[128], det[192];
+    size_t len1, len2, minorLen, termLen[3], partLen, detLen;
+    const double *p[3];
+    size_t i, j;
+
+    p[0]=pa;
+    p[1]=pb;
+    p[2]=pc;
+    for(i=0;i<3;i++) {
+        for(j=0;j<3;j++) {
+            dLen[i][j]=diffExpansion(p[i][j],pd[j],d[i][j]);
+        }
+    }
+
+    for(i=0;i<3;i++) {
+        //The other two points in cyclic order, which gives the sign of the
+        //cofactor.
+        const size_t p1=(i+1)%3;
+        const size_t p2=(i+2)%3;
+
+        //p1x*p2y-p2x*p1y
+        len1=expansionProduct(dLen[p1][0],d[p1][0],dLen[p2][1],d[p2][1],prod1);
+        len2=expansionProduct(dLen[p2][0],d[p2][0],dLen[p1][1],d[p1][1],prod2);
+        negateExpansion(len2,prod2);
+        minorLen=expansionSum(len1,prod1,len2,prod2,minor);
+
+        termLen[i]=expansionProduct(minorLen,minor,dLen[i][2],d[i][2],term[i]);
+    }
+
+    partLen=expansionSum(termLen[0],term[0],termLen[1],term[1],partSum);
+    detLen=expansionSum(partLen,partSum,termLen[2],term[2],det);
+
+    return expansionSign(detLen,det);
+}
+
+static int inCircleExact(const double *pa,const double *pb,const double *pc,const double *pd) {
+/*INCIRCLEEXACT Evaluate the sign of the incircle determinant exactly.
+ *               The lifted coordinates and the 2X2 minors each have at
+ *               most 16 components, so each product has at most 512 and
+ *               the determinant at most 1536.
+ */
+    double d[3][2][2];
+    size_t dLen[3][2];
+    double prod1[8], prod2[8];
+    double lift[16], minor[16], term[3][512], partSum[1024], det[1536];
+    size_t len1, len2, liftLen, minorLen, termLen[3], partLen, detLen;
+    const double *p[3];
+    size_t i;
+
+    p[0]=pa;
+    p[1]=pb;
+    p[2]=pc;
+    for(i=0;i<3;i++) {
+        dLen[i][0]=diffExpansion(p[i][0],pd[0],d[i][0]);
+        dLen[i][1]=diffExpansion(p[i][1],pd[1],d[i][1]);
+    }
+
+    for(i=0;i<3;i++) {
+        //The other two points in cyclic order, which gives the sign of the
+        //cofactor.
+        const size_t p1=(i+1)%3;
+        const size_t p2=(i+2)%3;
+
+        //The lifted coordinate x^2+y^2.
+        len1=expansionProduct(dLen[i][0],d[i][0],dLen[i][0],d[i][0],prod1);
+        len2=expansionProduct(dLen[i][1],d[i][1],dLen[i][1],d[i][1],prod2);
+        liftLen=expansionSum(len1,prod1,len2,prod2,lift);
+
+        //p1x*p2y-p2x*p1y
+        len1=expansionProduct(dLen[p1][0],d[p1][0],dLen[p2][1],d[p2][1],prod1);
+        len2=expansionProduct(dLen[p2][0],d[p2][0],dLen[p1][1],d[p1][1],prod2);
+        negateExpansion(len2,prod2);
+        minorLen=expansionSum(len1,prod1,len2,prod2,minor);
+
+        termLen[i]=expansionProduct(liftLen,lift,minorLen,minor,term[i]);
+    }
+
+    partLen=expansionSum(termLen[0],term[0],termLen[1],term[1],partSum);
+    detLen=expansionSum(partLen,partSum,termLen[2],term[2],det);
+
+    return expansionSign(detLen,det);
+}
+
+static inline ErrBoundedVal errDiff(const ErrBoundedVal &a,const ErrBoundedVal &b) {
+/*ERRDIFF The difference a-b with a bound on its error. The rounding error
+ *        is at most epsilon times the magnitude of the exact difference
+ *        of a.val and b.val, which is bounded by 2*epsilon times the
+ *        magnitude of the rounded difference.
+ */
+    const double val=a.val-b.val;
+
+    return ErrBoundedVal(val,a.err+b.err+2.0*epsilon*fabs(val));
+}
+
+static inline ErrBoundedVal errProduct(const ErrBoundedVal &a,const ErrBoundedVal &b) {
+//ERRPRODUCT The product a*b with a bound on its error.
+    const double val=a.val*b.val;
+
+    return ErrBoundedVal(val,fabs(a.val)*b.err+fabs(b.val)*a.err+a.err*b.err+2.0*epsilon*fabs(val));
+}
+
+static inline double errSign(const ErrBoundedVal &a) {
+/*ERRSIGN The sign of a value with a bounded error as a double, or
+ *        notDetermined if the error bound does not exclude zero. A zero
+ *        with no error is exactly zero.
+ */
+    const double errBound=runningErrSafety*a.err;
+
+    if(a.val>errBound) {
+        return 1.0;
+    } else if(-a.val>errBound) {
+        return -1.0;
+    } else if(a.err==0) {
+        return 0.0;
+    }
+    return notDetermined;
+}
+
+static ErrBoundedVal orient2DErrBounded(const double *pa,const double *pb,const double *pc) {
+//ORIENT2DERRBOUNDED The 2D orientation determinant with an error bound.
+    const ErrBoundedVal acx=errDiff(ErrBoundedVal(pa[0],0),ErrBoundedVal(pc[0],0));
+    const ErrBoundedVal acy=errDiff(ErrBoundedVal(pa[1],0),ErrBoundedVal(pc[1],0));
+    const ErrBoundedVal bcx=errDiff(ErrBoundedVal(pb[0],0),ErrBoundedVal(pc[0],0));
+    const ErrBoundedVal bcy=errDiff(ErrBoundedVal(pb[1],0),ErrBoundedVal(pc[1],0));
+
+    return errDiff(errProduct(acx,bcy),errProduct(acy,bcx));
+}
+
+static void crossingFilter(ErrBoundedVal *num,ErrBoundedVal &den,const double *p1,const double *p2,const double *q1,const double *q2) {
+/*CROSSINGFILTER Find the numerators num[0] and num[1] and the common
+ *              denominator den of the coordinates of the point at which
+ *              the line through p1 and p2 crosses the line through q1 and
+ *              q2, with error bounds. With d1 and d2 the orientations of
+ *              p1 and p2 with respect to the line through q1 and q2, the
+ *              crossing is p1+d1/(d1-d2)*(p2-p1), so num[k] is
+ *              d1*p2[k]-d2*p1[k] and den is d1-d2.
+ */
+    const ErrBoundedVal d1=orient2DErrBounded(q1,q2,p1);
+    const ErrBoundedVal d2=orient2DErrBounded(q1,q2,p2);
+    size_t k;
+
+    den=errDiff(d1,d2);
+    for(k=0;k<2;k++) {
+        num[k]=errDiff(errProduct(d1,ErrBoundedVal(p2[k],0)),errProduct(d2,ErrBoundedVal(p1[k],0)));
+    }
+}
+
+static void crossingExpansions(double num[2][64],size_t *numLen,double *den,size_t &denLen,const double *p1,const double *p2,const double *q1,const double *q2) {
+/*CROSSINGEXPANSIONS Evaluate the numerators and the denominator of
+ *              crossingFilter exactly as expansions. The orientations have
+ *              at most 16 components, so den has at most 32 and each
+ *              numerator at most 64.
+ */
+    double d1[16], d2[16], scaled1[32], scaled2[32];
+    size_t d1Len, d2Len, len1, len2, k;
+
+    d1Len=orient2DExpansion(q1,q2,p1,d1);
+    d2Len=orient2DExpansion(q1,q2,p2,d2);
+
+    for(k=0;k<2;k++) {
+        len1=scaleExpansion(d1Len,d1,p2[k],scaled1);
+        len2=scaleExpansion(d2Len,d2,-p1[k],scaled2);
+        numLen[k]=expansionSum(len1,scaled1,len2,scaled2,num[k]);
+    }
+
+    negateExpansion(d2Len,d2);
+    denLen=expansionSum(d1Len,d1,d2Len,d2,den);
+}
+
+static int crossingComparePointExact(const double *p1,const double *p2,const double *q1,const double *q2,const double *point) {
+/*CROSSINGCOMPAREPOINTEXACT Evaluate crossingComparePointCPP exactly. The
+ *              difference num[k]-point[k]*den has at most 128 components.
+ */
+    double num[2][64], den[32], scaled[64], diff[128];
+    size_t numLen[2], denLen, scaledLen, diffLen, k;
+    int denSign;
+
+    crossingExpansions(num,numLen,den,denLen,p1,p2,q1,q2);
+    denSign=expansionSign(denLen,den);
+
+    for(k=0;k<2;k++) {
+        int diffSign;
+
+        scaledLen=scaleExpansion(denLen,den,-point[k],scaled);
+        diffLen=expansionSum(numLen[k],num[k],scaledLen,scaled,diff);
+        diffSign=expansionSign(diffLen,diff);
+        if(diffSign!=0) {
+            return diffSign*denSign;
+        }
+    }
+    return 0;
+}
+
+static int crossingCompareExact(const double *p1,const double *p2,const double *q1,const double *q2,const double *r1,const double *r2,const double *s1,const double *s2) {
+/*CROSSINGCOMPAREEXACT Evaluate crossingCompareCPP exactly. The products
+ *              of a numerator and a denominator have up to 4096
+ *              components, so they are not kept on the stack.
+ */
+    double num1[2][64], den1[32], num2[2][64], den2[32];
+    size_t numLen1[2], denLen1, numLen2[2], denLen2, k;
+    vector<double> prod1, prod2, diff;
+    int denSign;
+
+    crossingExpansions(num1,numLen1,den1,denLen1,p1,p2,q1,q2);
+    crossingExpansions(num2,numLen2,den2,denLen2,r1,r2,s1,s2);
+    denSign=expansionSign(denLen1,den1)*expansionSign(denLen2,den2);
+
+    for(k=0;k<2;k++) {
+        size_t len1, len2, diffLen;
+        int diffSign;
+
+        len1=expansionProductLong(numLen1[k],num1[k],denLen2,den2,prod1);
+        len2=expansionProductLong(numLen2[k],num2[k],denLen1,den1,prod2);
+        negateExpansion(len2,&prod2[0]);
+        diff.resize(len1+len2);
+        diffLen=expansionSum(len1,&prod1[0],len2,&prod2[0],&diff[0]);
+        diffSign=expansionSign(diffLen,&diff[0]);
+        if(diffSign!=0) {
+            return diffSign*denSign;
+        }
+    }
+    return 0;
+}
+
+/*The expansion arithmetic below follows [1]. An expansion is an array of
+ *doubles whose exact sum is the value represented. The components are
+ *nonoverlapping and sorted in order of increasing magnitude. Zero
+ *components are eliminated, except that a zero expansion is stored as a
+ *single zero, so every expansion has at least one component and its sign
+ *is the sign of its last component.*/
+
+static inline void twoSum(const double a,const double b,double &x,double &y) {
+//x+y=a+b exactly, with x=fl(a+b).
+    const double bVirt=(x=a+b)-a;
+    const double aVirt=x-bVirt;
+    const double bRound=b-bVirt;
+    const double aRound=a-aVirt;
+
+    y=aRound+bRound;
+}
+
+static inline void twoDiff(const double a,const double b,double &x,double &y) {
+//x+y=a-b exactly, with x=fl(a-b).
+    const double bVirt=a-(x=a-b);
+    const double aVirt=x+bVirt;
+    const double bRound=bVirt-b;
+    const double aRound=a-aVirt;
+
+    y=aRound+bRound;
+}
+
+static inline void splitDouble(const double a,double &aHi,double &aLo) {
+//aHi+aLo=a, where aHi and aLo each have at most 26 significant bits.
+    const double c=splitter*a;
+    const double aBig=c-a;
+
+    aHi=c-aBig;
+    aLo=a-aHi;
+}
+
+static inline void twoProduct(const double a,const double b,double &x,double &y) {
+//x+y=a*b exactly, with x=fl(a*b).
+    double aHi, aLo, bHi, bLo;
+    double err1, err2, err3;
+
+    x=a*b;
+    splitDouble(a,aHi,aLo);
+    splitDouble(b,bHi,bLo);
+    err1=x-aHi*bHi;
+    err2=err1-aLo*bHi;
+    err3=err2-aHi*bLo;
+    y=aLo*bLo-err3;
+}
+
+static size_t diffExpansion(const double a,const double b,double *h) {
+//The expansion of a-b, which has at most 2 components.
+    double x, y;
+
+    twoDiff(a,b,x,y);
+    if(y==0.0) {
+        h[0]=x;
+        return 1;
+    }
+    h[0]=y;
+    h[1]=x;
+    return 2;
+}
+
+static size_t expansionSum(const size_t eLen,const double *e,const size_t fLen,const double *f,double *h) {
+/*EXPANSIONSUM Sum two expansions, placing the result, which has at most
+ *              eLen+fLen components, in h. This is the
+ *              FAST-EXPANSION-SUM algorithm of [1] with zero elimination;
+ *              the components are merged in order of increasing magnitude
+ *              and accumulated.
+ */
+    size_t eIdx=0, fIdx=0, hIdx=0;
+    double Q, QNew, hh;
+
+    //Merge the components by magnitude.
+    if((f[0]>e[0])==(f[0]>-e[0])) {
+        Q=e[eIdx++];
+    } else {
+        Q=f[fIdx++];
+    }
+    while(eIdx<eLen&&fIdx<fLen) {
+        if((f[fIdx]>e[eIdx])==(f[fIdx]>-e[eIdx])) {
+            twoSum(Q,e[eIdx++],QNew,hh);
+        } else {
+            twoSum(Q,f[fIdx++],QNew,hh);
+        }
+        Q=QNew;
+        if(hh!=0.0) {
+            h[hIdx++]=hh;
+        }
+    }
+    while(eIdx<eLen) {
+        twoSum(Q,e[eIdx++],QNew,hh);
+        Q=QNew;
+        if(hh!=0.0) {
+            h[hIdx++]=hh;
+        }
+    }
+    while(fIdx<fLen) {
+        twoSum(Q,f[fIdx++],QNew,hh);
+        Q=QNew;
+        if(hh!=0.0) {
+            h[hIdx++]=hh;
+        }
+    }
+
+    if(Q!=0.0||hIdx==0) {
+        h[hIdx++]=Q;
+    }
+    return hIdx;
+}
+
+static size_t scaleExpansion(const size_t eLen,const double *e,const double b,double *h) {
+/*SCALEEXPANSION Multiply an expansion by a double, placing the result,
+ *              which has at most 2*eLen components, in h. This is the
+ *              SCALE-EXPANSION algorithm of [1] with zero elimination.
+ */
+    size_t eIdx, hIdx=0;
+    double Q, hh, sum, prod1, prod0;
+
+    twoProduct(e[0],b,Q,hh);
+    if(hh!=0.0) {
+        h[hIdx++]=hh;
+    }
+    for(eIdx=1;eIdx<eLen;eIdx++) {
+        twoProduct(e[eIdx],b,prod1,prod0);
+        twoSum(Q,prod0,sum,hh);
+        if(hh!=0.0) {
+            h[hIdx++]=hh;
+        }
+        twoSum(prod1,sum,Q,hh);
+        if(hh!=0.0) {
+            h[hIdx++]=hh;
+        }
+    }
+
+    if(Q!=0.0||hIdx==0) {
+        h[hIdx++]=Q;
+    }
+    return hIdx;
+}
+
+static size_t expansionProduct(const size_t eLen,const double *e,const size_t fLen,const double *f,double *h) {
+/*EXPANSIONPRODUCT Multiply two expansions, placing the result, which has
+ *              at most 2*eLen*fLen components, in h. The expansion e is
+ *              scaled by each component of f and the results are summed.
+ *              The buffers limit eLen to 16 and 2*eLen*fLen to 512, which
+ *              suffices for the predicates here.
+ */
+    double scaled[32], sumBuff[512];
+    size_t fIdx, hLen, scaledLen;
+
+    hLen=scaleExpansion(eLen,e,f[0],h);
+    for(fIdx=1;fIdx<fLen;fIdx++) {
+        size_t i;
+
+        scaledLen=scaleExpansion(eLen,e,f[fIdx],scaled);
+        hLen=expansionSum(hLen,h,scaledLen,scaled,sumBuff);
+        for(i=0;i<hLen;i++) {
+            h[i]=sumBuff[i];
+        }
+    }
+    return hLen;
+}
+
+static size_t expansionProductLong(const size_t eLen,const double *e,const size_t fLen,const double *f,vector<double> &h) {
+/*EXPANSIONPRODUCTLONG The same as expansionProduct, but without limits on
+ *              the lengths of the expansions. h is resized to hold the
+ *              product and the length of the product is returned.
+ */
+    vector<double> scaled(2*eLen), sumBuff(2*eLen*fLen);
+    size_t fIdx, hLen, scaledLen;
+
+    h.resize(2*eLen*fLen);
+    hLen=scaleExpansion(eLen,e,f[0],&h[0]);
+    for(fIdx=1;fIdx<fLen;fIdx++) {
+        scaledLen=scaleExpansion(eLen,e,f[fIdx],&scaled[0]);
+        hLen=expansionSum(hLen,&h[0],scaledLen,&scaled[0],&sumBuff[0]);
+        h.swap(sumBuff);
+    }
+    return hLen;
+}
+
+static void negateExpansion(const size_t eLen,double *e) {
+    size_t i;
+
+    for(i=0;i<eLen;i++) {
+        e[i]=-e[i];
+    }
+}
+
+static inline int expansionSign(const size_t eLen,const double *e) {
+    const double lastVal=e[eLen-1];
+
+    return (lastVal>0)-(lastVal<0);
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
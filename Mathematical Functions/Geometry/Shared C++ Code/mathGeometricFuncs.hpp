@@ -10,10 +10,81 @@
 #ifndef MATHGEOMETRICFUNCSCPP
 #define MATHGEOMETRICFUNCSCPP
 #include <stddef.h>
+#include <vector>
  
 bool pointIsInPolygonCPP(const double *P, const size_t numVertices, const double *R, const bool boundaryIsImportant,ptrdiff_t *omega);
+ptrdiff_t polygonEdgeOmegaIncCPP(const double *P,const double *R,const size_t idxI,const size_t idxIPlus1,const bool boundaryIsImportant,bool *isOnBoundary);
 void twoLineIntersectionPoint2DCPP(const double *line1, const double *line2,double *point);
 double signedPolygonAreaCPP(const double *vertices,const size_t numVertices);
+
+//Robust geometric predicates
+int orient2DCPP(const double *pa,const double *pb,const double *pc);
+int orient3DCPP(const double *pa,const double *pb,const double *pc,const double *pd);
+int inCircleCPP(const double *pa,const double *pb,const double *pc,const double *pd);
+int crossingComparePointCPP(const double *p1,const double *p2,const double *q1,const double *q2,const double *point);
+int crossingCompareCPP(const double *p1,const double *p2,const double *q1,const double *q2,const double *r1,const double *r2,const double *s1,const double *s2);
+void orient2DBatchCPP(double *signs,const double *pa,const double *pb,const double *pc,const size_t N);
+void orient3DBatchCPP(double *signs,const double *pa,const double *pb,const double *pc,const double *pd,const size_t N);
+void inCircleBatchCPP(double *signs,const double *pa,const double *pb,const double *pc,const double *pd,const size_t N);
+
+//Convex hulls, convexity and segment intersections
+size_t convexHull2DCPP(size_t *hullIdx,const double *points,const size_t numPoints);
+bool polygonIsConvexCPP(const double *vertices,const size_t numVertices);
+void segmentIntersectionsCPP(std::vector<size_t> &pairs,std::vector<double> &points,const double *segments,const size_t numSegments);
+
+//Boolean operations on simple polygons
+enum PolygonBooleanOpCPP {
+    POLYGON_INTERSECTION,
+    POLYGON_UNION,
+    POLYGON_DIFFERENCE
+};
+void polygonBooleanCPP(std::vector<std::vector<double> > &rings,std::vector<bool> &isHole,std::vector<size_t> &parentIdx,const double *polyA,const size_t numVerticesA,const double *polyB,const size_t numVerticesB,const PolygonBooleanOpCPP op);
+
+//An index over a fixed set of polygons for determining which polygons
+//contain given points. Each polygon has a grid of horizontal bands
+//listing the edges that overlap each band and the bounding boxes of the
+//polygons are kept in a static R-tree. See PolygonIndexCPP.cpp for
+//details.
+class PolygonIndexCPP {
+public:
+    size_t numPolygons;
+    size_t totalNumVertices;
+
+    PolygonIndexCPP(const double *verticesIn,const size_t *numVerticesIn,const size_t numPolygonsIn);
+    bool pointIsInPolygon(const size_t polyIdx,const double *point,const bool boundaryIsImportant,ptrdiff_t *omega) const;
+    void query(std::vector<size_t> &polyIdx,std::vector<ptrdiff_t> &omegas,size_t *numFound,const double *points,const size_t numPoints,const bool boundaryIsImportant) const;
+    size_t getNumVertices(const size_t polyIdx) const;
+    const double *getVertices(const size_t polyIdx) const;
+private:
+    //The vertices of all of the polygons, one polygon after another, and
+    //the offset of the first vertex of each polygon.
+    std::vector<double> vertices;
+    std::vector<size_t> vertexOffsets;
+    //The bounding box [xMin;yMin;xMax;yMax] of each polygon.
+    std::vector<double> polyBoxes;
+    //The edge grid of each polygon. Band b of polygon p covers
+    //y values from polyBoxes[4*p+1]+b*bandHeight[p] to
+    //polyBoxes[4*p+1]+(b+1)*bandHeight[p]. The edges overlapping the band
+    //are edges[bandStart[bandOffsets[p]+b]] to
+    //edges[bandStart[bandOffsets[p]+b+1]-1], where bandStart has
+    //numBands[p]+1 entries for each polygon.
+    std::vector<double> bandHeight;
+    std::vector<size_t> numBands;
+    std::vector<size_t> bandOffsets;
+    std::vector<size_t> bandStart;
+    std::vector<size_t> edges;
+    //The nodes of the R-tree, with the root last. The children of node n
+    //are children[childStart[n]] to children[childStart[n+1]-1], which are
+    //polygon indices if nodeIsLeaf[n] and node indices otherwise.
+    std::vector<double> nodeBoxes;
+    std::vector<size_t> childStart;
+    std::vector<size_t> children;
+    std::vector<bool> nodeIsLeaf;
+
+    void buildEdgeGrid(const size_t polyIdx);
+    void buildRTree();
+    size_t findBand(const size_t polyIdx,const double y) const;
+};
 #endif
 
 /*LICENSE:
@@ -12,8 +12,8 @@
 #include "mathGeometricFuncs.hpp"
 
 //Prototypes for subroutines used here.
-bool pointsAreEqual(const double *P,const size_t idx1,const size_t idx2);
-ptrdiff_t omegaInc4Edge(const double *P,const double *R, const size_t idxI, const size_t idxIPlus1, double *detVal);
+static bool pointsAreEqual(const double *P,const size_t idx1,const size_t idx2);
+static ptrdiff_t omegaInc4Edge(const double *P,const double *R, const size_t idxI, const size_t idxIPlus1, double *detVal);
 
 bool pointIsInPolygonCPP(const double *P, const size_t numVertices, const double *R, const bool boundaryIsImportant,ptrdiff_t *omega) {
 //The direct C++ implementation that solves the problem for a single point.
@@ -23,84 +23,79 @@ bool pointIsInPolygonCPP(const double *P, const size_t numVertices, const double
     
 //P=the vertices of the polygon
 //R=the point
+    size_t i;
+
     *omega=0;
-    if(boundaryIsImportant==false) {
-        double unused;
-    //This is Algorithm 6, which is faster, but which does not return
-    //consistent results for points that are on the boundary.
-        size_t i;
-        for(i=0;i<numVertices-1;i++) {
-            size_t idxI=i*2;
-            size_t idxIPlus1=(i+1)*2;
-            
-            *omega+=omegaInc4Edge(P,R,idxI, idxIPlus1,&unused);
-        }
-        
-        //Increment omega for the edge that goes from the end back to the
-        //beginning.
-        *omega+=omegaInc4Edge(P,R,2*(numVertices-1),0,&unused);
-    } else {
-        //This is algorithm 7 which is slower, but which correctly identifies
-        //points on the boundary as being inside the polygon.
-        if((P[0]==R[0])&&(P[1]==R[1])) {
-            //If it is on the first vertex (and thus in the polygon)
+    //If boundaryIsImportant is false, this is Algorithm 6, which is
+    //faster, but which does not return consistent results for points that
+    //are on the boundary. Otherwise, this is algorithm 7 which is slower,
+    //but which correctly identifies points on the boundary as being inside
+    //the polygon.
+    if(boundaryIsImportant&&(P[0]==R[0])&&(P[1]==R[1])) {
+        //If it is on the first vertex (and thus in the polygon)
+        return true;
+    }
+
+    for(i=0;i<numVertices;i++) {
+        const size_t idxI=i*2;
+        //The last edge goes from the end back to the beginning.
+        const size_t idxIPlus1=(i+1<numVertices)?(i+1)*2:0;
+        bool isOnBoundary;
+
+        *omega+=polygonEdgeOmegaIncCPP(P,R,idxI,idxIPlus1,boundaryIsImportant,&isOnBoundary);
+        if(isOnBoundary) {
             return true;
-        } else {
-            size_t i;
-            double detVal;
-            for(i=0;i<numVertices-1;i++) {
-                size_t idxI=i*2;
-                size_t idxIPlus1=(i+1)*2;
-                
-                //The first check for whether the point is on the edge.
-                if(P[1+idxIPlus1]==R[1]) {
-                    if(P[0+idxIPlus1]==R[0]) {
-                        //If it is on a vertex
-                        return true;
-                    } else {
-                        if((P[1+idxI]==R[1])&&((P[0+idxIPlus1]>R[0])==(P[0+idxI]<R[0]))) {
-                            //If it is on an edge
-                            return true;
-                        }
-                    }
-                }
+        }
+    }
+    return  *omega%2!=0;
+}
 
-                *omega+=omegaInc4Edge(P,R,idxI, idxIPlus1,&detVal);
-                //The second check for whether the point is on the edge.
-                if(detVal==0&&!pointsAreEqual(P,idxI,idxIPlus1)) {
-                    return true;//The point is on the edge.
-                }
-            }
-            //Deal with the edge going from the last vertex to the first
-            //vertex.
-            //The first check for whether the point is on the edge.
-            if(P[1+0]==R[1]) {
-                if(P[0+0]==R[0]) {
-                    //If it is on a vertex
-                    return true;
-                } else {
-                    if((P[1+numVertices-1]==R[1])&&((P[0+0]>R[0])==(P[0+numVertices-1]<R[0]))) {
-                        //If it is on an edge
-                        return true;
-                    }
+ptrdiff_t polygonEdgeOmegaIncCPP(const double *P,const double *R,const size_t idxI,const size_t idxIPlus1,const bool boundaryIsImportant,bool *isOnBoundary) {
+/*POLYGONEDGEOMEGAINCCPP Get the increment to the winding number omega of
+ *              the point R for the edge of the polygon P going from the
+ *              vertex starting at index idxI to the vertex starting at
+ *              index idxIPlus1 (indices into P, so twice the vertex
+ *              number). If boundaryIsImportant is true, then isOnBoundary
+ *              is set to true if R is on the edge, in which case the
+ *              returned increment should not be used. This is the loop
+ *              body of Algorithms 6 and 7 of Hormann and Agathos and is
+ *              also used by the PolygonIndexCPP class.
+ */
+    ptrdiff_t omegaInc;
+    double detVal;
+
+    *isOnBoundary=false;
+    if(boundaryIsImportant) {
+        //The first check for whether the point is on the edge.
+        if(P[1+idxIPlus1]==R[1]) {
+            if(P[0+idxIPlus1]==R[0]) {
+                //If it is on a vertex
+                *isOnBoundary=true;
+                return 0;
+            } else {
+                if((P[1+idxI]==R[1])&&((P[0+idxIPlus1]>R[0])==(P[0+idxI]<R[0]))) {
+                    //If it is on an edge
+                    *isOnBoundary=true;
+                    return 0;
                 }
             }
-            *omega+=omegaInc4Edge(P,R,2*(numVertices-1), 0,&detVal);
-            //The second check for whether the point is on the edge.
-            if(detVal==0&&!pointsAreEqual(P,numVertices-1,0)) {
-                return true;//The point is on the edge.
-            }
         }
     }
-    return  *omega%2!=0;
+
+    omegaInc=omegaInc4Edge(P,R,idxI,idxIPlus1,&detVal);
+    //The second check for whether the point is on the edge.
+    if(boundaryIsImportant&&detVal==0&&!pointsAreEqual(P,idxI,idxIPlus1)) {
+        *isOnBoundary=true;
+    }
+    return omegaInc;
 }
 
-bool pointsAreEqual(const double *P,const size_t idx1,const size_t idx2) {
+static bool pointsAreEqual(const double *P,const size_t idx1,const size_t idx2) {
 //True is the two 2D points are equal, false otherwise.
     return (P[idx1]==P[idx2])&&P[idx1+1]==P[idx2+1];
 }
 
-ptrdiff_t omegaInc4Edge(const double *P,const double *R, const size_t idxI, const size_t idxIPlus1,double *detVal) {
+static ptrdiff_t omegaInc4Edge(const double *P,const double *R, const size_t idxI, const size_t idxIPlus1,double *detVal) {
 //Get the increment to omega for a single edge pair when the boundary does
 //not matter. By breaking it out into a subroutine, we can handle the last
 //edge going between the first and last vertices by just calling the
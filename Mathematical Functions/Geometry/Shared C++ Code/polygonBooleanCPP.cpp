@@ -0,0 +1,714 @@
+/**POLYGONBOOLEANCPP A C++ implementation of an algorithm for computing
+ *                 the intersection, union or difference of two simple
+ *                 (non-self-intersecting) polygons. Unlike the
+ *                 Sutherland-Hodgman algorithm in clipPolygonSH2D, neither
+ *                 polygon has to be convex and the result can consist of
+ *                 multiple separate polygons, some of which can have
+ *                 holes.
+ *
+ *The algorithm is an overlay in the spirit of that of Greiner and Hormann
+ *in [1]. The edges of both polygons are split at all points where they
+ *intersect or touch the edges of the other polygon. Each piece of an edge
+ *then either lies on an edge of the other polygon or lies entirely inside
+ *or outside of the other polygon, which is determined by testing its
+ *midpoint. Once both polygons have been made counterclockwise, the pieces
+ *making up the boundary of the result are
+ *intersection: Pieces of each polygon inside of the other and shared
+ *              pieces that go in the same direction in both polygons.
+ *union:        Pieces of each polygon outside of the other and shared
+ *              pieces that go in the same direction in both polygons.
+ *difference:   Pieces of the first polygon outside of the second, pieces
+ *              of the second polygon inside of the first with their
+ *              direction reversed, and shared pieces that go in opposite
+ *              directions in the two polygons.
+ *The selected pieces are then linked into rings. Where multiple pieces
+ *leave a vertex, the one turning the farthest to the left is taken, so
+ *polygons that only touch at a vertex are returned as separate rings.
+ *Counterclockwise rings are outer boundaries and clockwise rings are
+ *holes. Each hole is assigned to the smallest outer ring containing it.
+ *Collinear vertices are removed from the results.
+ *
+ *All decisions about whether edges intersect, touch or overlap are made
+ *using the exact orientation predicate orient2DCPP, so the topology of the
+ *intersections is determined exactly from the input coordinates. The
+ *coordinates of points where edges properly cross are rounded to doubles.
+ *Unlike the original algorithm of [1], no perturbation of degenerate
+ *vertices is needed, since vertices lying on edges and overlapping edges
+ *are found exactly and handled explicitly.
+ *
+ *REFERENCES:
+ *[1] G. Greiner and K. Hormann, "Efficient clipping of arbitrary
+ *    polygons," ACM Transactions on Graphics, vol. 17, no. 2, pp. 71-83,
+ *    Apr. 1998.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "mathGeometricFuncs.hpp"
+//For sort, reverse, min and max
+#include <algorithm>
+//For atan2
+#include <cmath>
+#include <map>
+//For pair
+#include <utility>
+
+using namespace std;
+
+static const double twoPi=6.283185307179586476925286766559;
+
+//A point at which an edge is split. t increases along the edge.
+class EdgeSplitPoint {
+public:
+    double t;
+    double x;
+    double y;
+
+    EdgeSplitPoint(const double tIn,const double xIn,const double yIn) {
+        t=tIn;
+        x=xIn;
+        y=yIn;
+    }
+
+    bool operator<(const EdgeSplitPoint &other) const {
+        return t<other.t;
+    }
+};
+
+//Orders edges by the minimum x values of their bounding boxes.
+class EdgeXMinLess {
+public:
+    const double *boxes;
+
+    EdgeXMinLess(const double *boxesIn) {
+        boxes=boxesIn;
+    }
+
+    bool operator()(const size_t a,const size_t b) const {
+        return boxes[4*a]<boxes[4*b];
+    }
+};
+
+//The vertices of the split edges. Vertices with exactly the same
+//coordinates are given the same index.
+class SplitVertexSet {
+public:
+    vector<double> coords;
+    map<pair<double,double>,size_t> vertexMap;
+
+    size_t getIdx(const double x,const double y) {
+        const pair<double,double> key(x,y);
+        map<pair<double,double>,size_t>::iterator it=vertexMap.find(key);
+
+        if(it!=vertexMap.end()) {
+            return it->second;
+        }
+        coords.push_back(x);
+        coords.push_back(y);
+        vertexMap[key]=coords.size()/2-1;
+        return coords.size()/2-1;
+    }
+};
+
+//Prototypes for the subroutines used here.
+static size_t cleanPolygon(vector<double> &P,const double *vertices,const size_t numVertices);
+static void findSplitPoints(vector<vector<EdgeSplitPoint> > &splitsA,vector<vector<EdgeSplitPoint> > &splitsB,const vector<double> &PA,const size_t numA,const vector<double> &PB,const size_t numB);
+static void getEdgeBoxes(vector<double> &boxes,vector<size_t> &order,const vector<double> &P,const size_t numVertices);
+static void splitEdgePair(vector<EdgeSplitPoint> &splitsA,vector<EdgeSplitPoint> &splitsB,const double *p1,const double *p2,const double *q1,const double *q2);
+static void addSplitIfInterior(vector<EdgeSplitPoint> &splits,const double *p1,const double *p2,const double *q);
+static void addSplit(vector<EdgeSplitPoint> &splits,const double *p1,const double *p2,const double x,const double y);
+static void buildSubEdges(vector<pair<size_t,size_t> > &subEdges,SplitVertexSet &vertexSet,const vector<double> &P,const size_t numVertices,vector<vector<EdgeSplitPoint> > &splits);
+static bool subEdgeIsInside(const pair<size_t,size_t> &subEdge,const SplitVertexSet &vertexSet,const vector<double> &P,const size_t numVertices);
+static void linkRings(vector<vector<double> > &rings,const vector<pair<size_t,size_t> > &selEdges,const SplitVertexSet &vertexSet);
+static void splitRingAtRepeats(vector<vector<double> > &rings,const vector<size_t> &ring,const SplitVertexSet &vertexSet);
+static void removeCollinearVertices(vector<double> &ring);
+
+void polygonBooleanCPP(vector<vector<double> > &rings,vector<bool> &isHole,vector<size_t> &parentIdx,const double *polyA,const size_t numVerticesA,const double *polyB,const size_t numVerticesB,const PolygonBooleanOpCPP op) {
+/*POLYGONBOOLEANCPP Compute the intersection, union or difference (A minus
+ *                  B) of the simple polygons A and B, which are given by
+ *                  their 2D vertices in either order. The resulting rings
+ *                  are placed in rings, each holding the 2D vertices of a
+ *                  ring without the first vertex repeated. Outer rings are
+ *                  counterclockwise and are each followed by their holes,
+ *                  which are clockwise. isHole indicates which rings are
+ *                  holes and, for holes, parentIdx holds the index of the
+ *                  outer ring containing the hole. For outer rings,
+ *                  parentIdx holds the index of the ring itself. A polygon
+ *                  with fewer than 3 distinct vertices or with no area is
+ *                  treated as empty.
+ */
+    vector<double> PA, PB;
+    size_t numA, numB, i;
+    vector<vector<EdgeSplitPoint> > splitsA, splitsB;
+    SplitVertexSet vertexSet;
+    vector<pair<size_t,size_t> > subEdgesA, subEdgesB, selEdges;
+    map<pair<size_t,size_t>,size_t> subEdgeMapA;
+    vector<bool> isSharedA;
+    vector<vector<double> > allRings;
+    vector<double> areas;
+
+    rings.clear();
+    isHole.clear();
+    parentIdx.clear();
+
+    numA=cleanPolygon(PA,polyA,numVerticesA);
+    numB=cleanPolygon(PB,polyB,numVerticesB);
+
+    findSplitPoints(splitsA,splitsB,PA,numA,PB,numB);
+    buildSubEdges(subEdgesA,vertexSet,PA,numA,splitsA);
+    buildSubEdges(subEdgesB,vertexSet,PB,numB,splitsB);
+
+    //Find the pieces of edges that are shared by both polygons. Two
+    //straight pieces with the same endpoints are the same.
+    for(i=0;i<subEdgesA.size();i++) {
+        const size_t v1=subEdgesA[i].first;
+        const size_t v2=subEdgesA[i].second;
+
+        subEdgeMapA[make_pair(min(v1,v2),max(v1,v2))]=i;
+    }
+    isSharedA.assign(subEdgesA.size(),false);
+
+    for(i=0;i<subEdgesB.size();i++) {
+        const pair<size_t,size_t> &curEdge=subEdgesB[i];
+        map<pair<size_t,size_t>,size_t>::iterator it=subEdgeMapA.find(make_pair(min(curEdge.first,curEdge.second),max(curEdge.first,curEdge.second)));
+
+        if(it!=subEdgeMapA.end()) {
+            const bool sameDirection=subEdgesA[it->second].first==curEdge.first;
+
+            isSharedA[it->second]=true;
+            if(sameDirection) {
+                //Shared pieces going in the same direction bound the
+                //intersection and the union.
+                if(op!=POLYGON_DIFFERENCE) {
+                    selEdges.push_back(curEdge);
+                }
+            } else if(op==POLYGON_DIFFERENCE) {
+                //Shared pieces going in opposite directions bound the
+                //difference with the direction of polygon A.
+                selEdges.push_back(subEdgesA[it->second]);
+            }
+        } else {
+            const bool isInside=subEdgeIsInside(curEdge,vertexSet,PA,numA);
+
+            if(op==POLYGON_INTERSECTION&&isInside) {
+                selEdges.push_back(curEdge);
+            } else if(op==POLYGON_UNION&&!isInside) {
+                selEdges.push_back(curEdge);
+            } else if(op==POLYGON_DIFFERENCE&&isInside) {
+                selEdges.push_back(make_pair(curEdge.second,curEdge.first));
+            }
+        }
+    }
+
+    for(i=0;i<subEdgesA.size();i++) {
+        if(!isSharedA[i]) {
+            const bool isInside=subEdgeIsInside(subEdgesA[i],vertexSet,PB,numB);
+
+            if((op==POLYGON_INTERSECTION)==isInside) {
+                selEdges.push_back(subEdgesA[i]);
+            }
+        }
+    }
+
+    linkRings(allRings,selEdges,vertexSet);
+
+    //Clean up the rings and find their orientations.
+    {
+        vector<vector<double> > cleanRings;
+
+        for(i=0;i<allRings.size();i++) {
+            removeCollinearVertices(allRings[i]);
+            if(allRings[i].size()>=6) {
+                const double area=signedPolygonAreaCPP(&allRings[i][0],allRings[i].size()/2);
+
+                if(area!=0) {
+                    cleanRings.push_back(vector<double>());
+                    cleanRings.back().swap(allRings[i]);
+                    areas.push_back(area);
+                }
+            }
+        }
+        allRings.swap(cleanRings);
+    }
+
+    //Assign each hole to the smallest outer ring containing the midpoint
+    //of its first edge and put the rings in order.
+    {
+        const size_t numRings=allRings.size();
+        const size_t noParent=numRings;
+        vector<size_t> holeParent(numRings,noParent);
+
+        for(i=0;i<numRings;i++) {
+            if(areas[i]<0) {
+                const double *ring=&allRings[i][0];
+                const double testPoint[2]={(ring[0]+ring[2])/2,(ring[1]+ring[3])/2};
+                double bestArea=0;
+                size_t j;
+
+                for(j=0;j<numRings;j++) {
+                    ptrdiff_t omega;
+
+                    if(areas[j]>0&&(holeParent[i]==noParent||areas[j]<bestArea)&&pointIsInPolygonCPP(&allRings[j][0],allRings[j].size()/2,testPoint,false,&omega)) {
+                        holeParent[i]=j;
+                        bestArea=areas[j];
+                    }
+                }
+            }
+        }
+
+        for(i=0;i<numRings;i++) {
+            if(areas[i]>0) {
+                const size_t outerIdx=rings.size();
+                size_t j;
+
+                rings.push_back(allRings[i]);
+                isHole.push_back(false);
+                parentIdx.push_back(outerIdx);
+
+                for(j=0;j<numRings;j++) {
+                    if(areas[j]<0&&holeParent[j]==i) {
+                        rings.push_back(allRings[j]);
+                        isHole.push_back(true);
+                        parentIdx.push_back(outerIdx);
+                    }
+                }
+            }
+        }
+
+        //Holes that are not in any outer ring can only arise from finite
+        //precision problems. They are kept as their own parents.
+        for(i=0;i<numRings;i++) {
+            if(areas[i]<0&&holeParent[i]==noParent) {
+                parentIdx.push_back(rings.size());
+                rings.push_back(allRings[i]);
+                isHole.push_back(true);
+            }
+        }
+    }
+}
+
+static size_t cleanPolygon(vector<double> &P,const double *vertices,const size_t numVertices) {
+/*CLEANPOLYGON Copy the polygon into P, removing repeated consecutive
+ *             vertices (including the first vertex repeated at the end)
+ *             and making it counterclockwise. The number of vertices is
+ *             returned, which is zero if the polygon is degenerate.
+ */
+    size_t i, num;
+
+    P.clear();
+    for(i=0;i<numVertices;i++) {
+        const double *curVertex=vertices+2*i;
+
+        if(P.empty()||curVertex[0]!=P[P.size()-2]||curVertex[1]!=P[P.size()-1]) {
+            P.push_back(curVertex[0]);
+            P.push_back(curVertex[1]);
+        }
+    }
+    while(P.size()>2&&P[0]==P[P.size()-2]&&P[1]==P[P.size()-1]) {
+        P.resize(P.size()-2);
+    }
+
+    num=P.size()/2;
+    if(num<3) {
+        P.clear();
+        return 0;
+    }
+
+    {
+        const double area=signedPolygonAreaCPP(&P[0],num);
+
+        if(area==0) {
+            P.clear();
+            return 0;
+        }
+
+        if(area<0) {
+            //Reverse the order of the vertices.
+            for(i=0;i<num/2;i++) {
+                swap(P[2*i],P[2*(num-1-i)]);
+                swap(P[2*i+1],P[2*(num-1-i)+1]);
+            }
+        }
+    }
+    return num;
+}
+
+static void getEdgeBoxes(vector<double> &boxes,vector<size_t> &order,const vector<double> &P,const size_t numVertices) {
+/*GETEDGEBOXES Get the bounding boxes [xMin;yMin;xMax;yMax] of the edges of
+ *             a polygon and the order of the edges by xMin.
+ */
+    size_t i;
+
+    boxes.resize(4*numVertices);
+    order.resize(numVertices);
+    for(i=0;i<numVertices;i++) {
+        const size_t iNext=(i+1<numVertices)?i+1:0;
+
+        boxes[4*i]=min(P[2*i],P[2*iNext]);
+        boxes[4*i+1]=min(P[2*i+1],P[2*iNext+1]);
+        boxes[4*i+2]=max(P[2*i],P[2*iNext]);
+        boxes[4*i+3]=max(P[2*i+1],P[2*iNext+1]);
+        order[i]=i;
+    }
+
+    if(numVertices>0) {
+        sort(order.begin(),order.end(),EdgeXMinLess(&boxes[0]));
+    }
+}
+
+static void findSplitPoints(vector<vector<EdgeSplitPoint> > &splitsA,vector<vector<EdgeSplitPoint> > &splitsB,const vector<double> &PA,const size_t numA,const vector<double> &PB,const size_t numB) {
+/*FINDSPLITPOINTS Find the points at which the edges of polygons A and B
+ *                must be split. The pairs of edges whose bounding boxes
+ *                overlap are found by sweeping across x with the edges
+ *                sorted by the minimum x values of their bounding boxes,
+ *                keeping a list of the edges of each polygon whose
+ *                bounding boxes extend to the current x value.
+ */
+    vector<double> boxesA, boxesB;
+    vector<size_t> orderA, orderB, activeA, activeB;
+    size_t idxA=0, idxB=0;
+
+    splitsA.assign(numA,vector<EdgeSplitPoint>());
+    splitsB.assign(numB,vector<EdgeSplitPoint>());
+
+    getEdgeBoxes(boxesA,orderA,PA,numA);
+    getEdgeBoxes(boxesB,orderB,PB,numB);
+
+    while(idxA<numA||idxB<numB) {
+        const bool takeA=idxB>=numB||(idxA<numA&&boxesA[4*orderA[idxA]]<=boxesB[4*orderB[idxB]]);
+        const size_t curEdge=takeA?orderA[idxA++]:orderB[idxB++];
+        const double *curBox=takeA?&boxesA[4*curEdge]:&boxesB[4*curEdge];
+        vector<size_t> &otherActive=takeA?activeB:activeA;
+        const vector<double> &otherBoxes=takeA?boxesB:boxesA;
+        size_t i, numKept=0;
+
+        //Remove the edges of the other polygon that end before the current
+        //edge starts and test the rest.
+        for(i=0;i<otherActive.size();i++) {
+            const size_t otherEdge=otherActive[i];
+            const double *otherBox=&otherBoxes[4*otherEdge];
+
+            if(otherBox[2]<curBox[0]) {
+                continue;
+            }
+            otherActive[numKept++]=otherEdge;
+
+            if(otherBox[1]<=curBox[3]&&curBox[1]<=otherBox[3]) {
+                const size_t edgeA=takeA?curEdge:otherEdge;
+                const size_t edgeB=takeA?otherEdge:curEdge;
+                const size_t edgeANext=(edgeA+1<numA)?edgeA+1:0;
+                const size_t edgeBNext=(edgeB+1<numB)?edgeB+1:0;
+
+                splitEdgePair(splitsA[edgeA],splitsB[edgeB],&PA[2*edgeA],&PA[2*edgeANext],&PB[2*edgeB],&PB[2*edgeBNext]);
+            }
+        }
+        otherActive.resize(numKept);
+
+        if(takeA) {
+            activeA.push_back(curEdge);
+        } else {
+            activeB.push_back(curEdge);
+        }
+    }
+}
+
+static void splitEdgePair(vector<EdgeSplitPoint> &splitsA,vector<EdgeSplitPoint> &splitsB,const double *p1,const double *p2,const double *q1,const double *q2) {
+/*SPLITEDGEPAIR Add the split points for the edge p1-p2 of polygon A and
+ *              the edge q1-q2 of polygon B, if they intersect. Endpoints
+ *              that lie on the other edge are found exactly and are used
+ *              as split points as is. Only for proper crossings is a new
+ *              point computed.
+ */
+    const int o1=orient2DCPP(p1,p2,q1);
+    const int o2=orient2DCPP(p1,p2,q2);
+    int o3, o4;
+
+    if(o1*o2>0) {
+        return;
+    }
+
+    o3=orient2DCPP(q1,q2,p1);
+    o4=orient2DCPP(q1,q2,p2);
+    if(o3*o4>0) {
+        return;
+    }
+
+    if(o1==0||o2==0||o3==0||o4==0) {
+        //The edges touch or are collinear and overlap. Each endpoint that
+        //lies on the other edge is a split point of the other edge.
+        if(o1==0) {
+            addSplitIfInterior(splitsA,p1,p2,q1);
+        }
+        if(o2==0) {
+            addSplitIfInterior(splitsA,p1,p2,q2);
+        }
+        if(o3==0) {
+            addSplitIfInterior(splitsB,q1,q2,p1);
+        }
+        if(o4==0) {
+            addSplitIfInterior(splitsB,q1,q2,p2);
+        }
+        return;
+    }
+
+    //The edges properly cross.
+    {
+        const double qx=q2[0]-q1[0];
+        const double qy=q2[1]-q1[1];
+        const double d1=qx*(p1[1]-q1[1])-qy*(p1[0]-q1[0]);
+        const double d2=qx*(p2[1]-q1[1])-qy*(p2[0]-q1[0]);
+        const double t=d1/(d1-d2);
+        double x=p1[0]+t*(p2[0]-p1[0]);
+        double y=p1[1]+t*(p2[1]-p1[1]);
+
+        //Keep the point in the bounding boxes of both edges despite
+        //finite precision errors.
+        x=min(max(x,max(min(p1[0],p2[0]),min(q1[0],q2[0]))),min(max(p1[0],p2[0]),max(q1[0],q2[0])));
+        y=min(max(y,max(min(p1[1],p2[1]),min(q1[1],q2[1]))),min(max(p1[1],p2[1]),max(q1[1],q2[1])));
+
+        addSplit(splitsA,p1,p2,x,y);
+        addSplit(splitsB,q1,q2,x,y);
+    }
+}
+
+static void addSplitIfInterior(vector<EdgeSplitPoint> &splits,const double *p1,const double *p2,const double *q) {
+/*ADDSPLITIFINTERIOR Given a point q that is collinear with the edge p1-p2,
+ *                   add it as a split point if it is strictly between p1
+ *                   and p2.
+ */
+    const size_t dim=(p1[0]!=p2[0])?0:1;
+
+    if(min(p1[dim],p2[dim])<q[dim]&&q[dim]<max(p1[dim],p2[dim])) {
+        addSplit(splits,p1,p2,q[0],q[1]);
+    }
+}
+
+static void addSplit(vector<EdgeSplitPoint> &splits,const double *p1,const double *p2,const double x,const double y) {
+    const double t=(x-p1[0])*(p2[0]-p1[0])+(y-p1[1])*(p2[1]-p1[1]);
+
+    splits.push_back(EdgeSplitPoint(t,x,y));
+}
+
+static void buildSubEdges(vector<pair<size_t,size_t> > &subEdges,SplitVertexSet &vertexSet,const vector<double> &P,const size_t numVertices,vector<vector<EdgeSplitPoint> > &splits) {
+/*BUILDSUBEDGES Split the edges of a polygon at the split points, giving
+ *              the pieces as pairs of vertex indices.
+ */
+    size_t i;
+
+    subEdges.clear();
+    for(i=0;i<numVertices;i++) {
+        const size_t iNext=(i+1<numVertices)?i+1:0;
+        size_t prevIdx, endIdx, j;
+
+        sort(splits[i].begin(),splits[i].end());
+
+        prevIdx=vertexSet.getIdx(P[2*i],P[2*i+1]);
+        for(j=0;j<splits[i].size();j++) {
+            const size_t curIdx=vertexSet.getIdx(splits[i][j].x,splits[i][j].y);
+
+            if(curIdx!=prevIdx) {
+                subEdges.push_back(make_pair(prevIdx,curIdx));
+                prevIdx=curIdx;
+            }
+        }
+
+        endIdx=vertexSet.getIdx(P[2*iNext],P[2*iNext+1]);
+        if(endIdx!=prevIdx) {
+            subEdges.push_back(make_pair(prevIdx,endIdx));
+        }
+    }
+}
+
+static bool subEdgeIsInside(const pair<size_t,size_t> &subEdge,const SplitVertexSet &vertexSet,const vector<double> &P,const size_t numVertices) {
+/*SUBEDGEISINSIDE Determine whether a piece of an edge that is not shared
+ *                with the other polygon P is inside of P by testing its
+ *                midpoint.
+ */
+    const double *v1=&vertexSet.coords[2*subEdge.first];
+    const double *v2=&vertexSet.coords[2*subEdge.second];
+    const double midPoint[2]={(v1[0]+v2[0])/2,(v1[1]+v2[1])/2};
+    ptrdiff_t omega;
+
+    if(numVertices==0) {
+        return false;
+    }
+    return pointIsInPolygonCPP(&P[0],numVertices,midPoint,false,&omega);
+}
+
+static void linkRings(vector<vector<double> > &rings,const vector<pair<size_t,size_t> > &selEdges,const SplitVertexSet &vertexSet) {
+/*LINKRINGS Link the selected directed pieces of edges into closed rings.
+ *          At a vertex with multiple unused outgoing pieces, the one that
+ *          is first when rotating clockwise from the direction back along
+ *          the incoming piece is taken, which keeps the region of the
+ *          result to the left of the ring and splits rings that touch
+ *          themselves at a vertex. Chains that cannot be closed,
+ *          which can only arise from finite precision problems, are
+ *          discarded.
+ */
+    const size_t numEdges=selEdges.size();
+    const size_t numVertices=vertexSet.coords.size()/2;
+    vector<vector<size_t> > outEdges(numVertices);
+    vector<bool> isUsed(numEdges,false);
+    size_t i;
+
+    rings.clear();
+    for(i=0;i<numEdges;i++) {
+        outEdges[selEdges[i].first].push_back(i);
+    }
+
+    for(i=0;i<numEdges;i++) {
+        const size_t startVertex=selEdges[i].first;
+        vector<size_t> ring;
+        size_t curEdge=i;
+        bool isClosed=false;
+
+        if(isUsed[i]) {
+            continue;
+        }
+
+        isUsed[i]=true;
+        ring.push_back(startVertex);
+        while(true) {
+            const size_t prevVertex=selEdges[curEdge].first;
+            const size_t curVertex=selEdges[curEdge].second;
+            const double *prevCoords=&vertexSet.coords[2*prevVertex];
+            const double *curCoords=&vertexSet.coords[2*curVertex];
+            const double backAngle=atan2(prevCoords[1]-curCoords[1],prevCoords[0]-curCoords[0]);
+            double bestAngle=0;
+            size_t j, nextEdge=numEdges;
+
+            for(j=0;j<outEdges[curVertex].size();j++) {
+                const size_t candEdge=outEdges[curVertex][j];
+                const double *nextCoords=&vertexSet.coords[2*selEdges[candEdge].second];
+                double cwAngle;
+
+                //The first piece of the ring is a candidate so that the
+                //ring is closed if the path through the starting vertex
+                //would turn to it.
+                if(isUsed[candEdge]&&candEdge!=i) {
+                    continue;
+                }
+
+                cwAngle=backAngle-atan2(nextCoords[1]-curCoords[1],nextCoords[0]-curCoords[0]);
+                while(cwAngle<=0) {
+                    cwAngle+=twoPi;
+                }
+                while(cwAngle>twoPi) {
+                    cwAngle-=twoPi;
+                }
+
+                if(nextEdge==numEdges||cwAngle<bestAngle) {
+                    nextEdge=candEdge;
+                    bestAngle=cwAngle;
+                }
+            }
+
+            if(nextEdge==numEdges) {
+                break;
+            }
+            if(nextEdge==i) {
+                isClosed=true;
+                break;
+            }
+            ring.push_back(curVertex);
+            isUsed[nextEdge]=true;
+            curEdge=nextEdge;
+        }
+
+        if(isClosed) {
+            splitRingAtRepeats(rings,ring,vertexSet);
+        }
+    }
+}
+
+static void splitRingAtRepeats(vector<vector<double> > &rings,const vector<size_t> &ring,const SplitVertexSet &vertexSet) {
+/*SPLITRINGATREPEATS Split a ring, given by vertex indices, into loops that
+ *                   do not pass through any vertex twice and add the
+ *                   coordinates of the loops to rings. Linking the pieces
+ *                   of edges keeps separate parts of the result that touch
+ *                   at a vertex in separate rings, but a hole touching the
+ *                   outer boundary at a vertex ends up in the same ring as
+ *                   the boundary. Splitting it off gives a clockwise loop,
+ *                   which is then treated as a hole.
+ */
+    const size_t numInRing=ring.size();
+    vector<size_t> loopStack;
+    map<size_t,size_t> stackPos;
+    size_t i;
+
+    for(i=0;i<=numInRing;i++) {
+        const size_t curVertex=ring[i%numInRing];
+        map<size_t,size_t>::iterator it=stackPos.find(curVertex);
+
+        if(it!=stackPos.end()) {
+            //The vertices since the last visit to this vertex form a loop.
+            const size_t loopStart=it->second;
+            vector<double> loop;
+            size_t j;
+
+            for(j=loopStart;j<loopStack.size();j++) {
+                loop.push_back(vertexSet.coords[2*loopStack[j]]);
+                loop.push_back(vertexSet.coords[2*loopStack[j]+1]);
+                if(j>loopStart) {
+                    stackPos.erase(loopStack[j]);
+                }
+            }
+            loopStack.resize(loopStart+1);
+
+            rings.push_back(vector<double>());
+            rings.back().swap(loop);
+        } else {
+            stackPos[curVertex]=loopStack.size();
+            loopStack.push_back(curVertex);
+        }
+    }
+}
+
+static void removeCollinearVertices(vector<double> &ring) {
+/*REMOVECOLLINEARVERTICES Remove vertices of a ring at which the ring goes
+ *                straight or doubles back on itself, as determined by the
+ *                exact orientation predicate.
+ */
+    bool removedVertex=true;
+
+    while(removedVertex&&ring.size()>=6) {
+        const size_t numVertices=ring.size()/2;
+        vector<double> newRing;
+        size_t i;
+
+        removedVertex=false;
+        newRing.reserve(ring.size());
+        for(i=0;i<numVertices;i++) {
+            const double *prevVertex=newRing.empty()?&ring[2*(numVertices-1)]:&newRing[newRing.size()-2];
+            const double *curVertex=&ring[2*i];
+            const double *nextVertex=&ring[2*((i+1)%numVertices)];
+
+            if(orient2DCPP(prevVertex,curVertex,nextVertex)==0) {
+                removedVertex=true;
+            } else {
+                newRing.push_back(curVertex[0]);
+                newRing.push_back(curVertex[1]);
+            }
+        }
+        ring.swap(newRing);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
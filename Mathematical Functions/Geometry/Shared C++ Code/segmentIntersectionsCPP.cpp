@@ -0,0 +1,503 @@
+/**SEGMENTINTERSECTIONSCPP A C++ implementation of the Bentley-Ottmann
+ *              sweep-line algorithm for finding all pairs of intersecting
+ *              line segments in a set of 2D line segments.
+ *
+ *The algorithm of [1] sweeps a vertical line across the plane from left to
+ *right. The segments crossed by the sweep line are kept in a status list
+ *sorted from bottom to top. Two segments can only intersect if they are
+ *adjacent in the status list just before the leftmost point at which they
+ *intersect, so only adjacent pairs are tested for intersections. The
+ *events of the sweep are the endpoints of the segments and the points at
+ *which adjacent segments cross, so N segments with K intersecting pairs
+ *take O((N+K)log(N)) comparisons. Here, the status list is a vector, so
+ *inserting and removing segments also requires moving O(N) entries in
+ *memory, which is fast in practice since the lists are generally short.
+ *
+ *Degenerate cases are handled as in Chapter 2.1 of [2]. Points are ordered
+ *by their x coordinates and then by their y coordinates, so the sweep line
+ *is effectively tilted slightly and vertical segments are handled like any
+ *other segment. At each endpoint, all segments that start at, end at, or
+ *pass through the point are found and every pair of them is reported as
+ *intersecting. The segments passing through the point are then reinserted
+ *in the order that they have just after the point. This handles segments
+ *that touch, that share endpoints, that overlap, as well as more than two
+ *segments crossing at an endpoint.
+ *
+ *Whether segments cross, touch or overlap, as well as the order of
+ *segments about the endpoints is determined using the exact predicate
+ *orient2DCPP. The point at which two segments properly cross (where
+ *neither has an endpoint on the other) generally cannot be represented as
+ *a double, so crossing events are ordered against the endpoints and
+ *against each other using the exact predicates crossingComparePointCPP
+ *and crossingCompareCPP. Thus, all crossings that come before an
+ *endpoint have been handled when the endpoint is handled, so the status
+ *list is correctly ordered for the search for the segments containing
+ *the endpoint. Two adjacent segments are only swapped at a crossing event
+ *if they are still adjacent and in their order before the crossing. The
+ *point of a crossing that is reported is rounded to a double and clamped
+ *to the bounding boxes of both segments; it is not used by the sweep.
+ *
+ *REFERENCES:
+ *[1] J. L. Bentley and T. A. Ottmann, "Algorithms for reporting and
+ *    counting geometric intersections," IEEE Transactions on Computers,
+ *    vol. C-28, no. 9, pp. 643-647, Sep. 1979.
+ *[2] M. de Berg, O. Cheong, M. van Kreveld, and M. Overmars, Computational
+ *    Geometry: Algorithms and Applications, 3rd ed. Berlin: Springer,
+ *    2008.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "mathGeometricFuncs.hpp"
+//For sort, min, max
+#include <algorithm>
+//For priority_queue
+#include <queue>
+//For pair
+#include <utility>
+
+using namespace std;
+
+//An endpoint of a segment.
+class SweepEndpoint {
+public:
+    double x;
+    double y;
+    size_t segIdx;
+    bool isStart;
+
+    SweepEndpoint(const double xIn,const double yIn,const size_t segIdxIn,const bool isStartIn) {
+        x=xIn;
+        y=yIn;
+        segIdx=segIdxIn;
+        isStart=isStartIn;
+    }
+
+    bool operator<(const SweepEndpoint &other) const {
+        return x<other.x||(x==other.x&&y<other.y);
+    }
+};
+
+//A point at which two segments cross. lowerSeg is below upperSeg just
+//before the crossing. x and y are the rounded point that is reported.
+class SweepCrossing {
+public:
+    double x;
+    double y;
+    size_t lowerSeg;
+    size_t upperSeg;
+
+    SweepCrossing(const double xIn,const double yIn,const size_t lowerSegIn,const size_t upperSegIn) {
+        x=xIn;
+        y=yIn;
+        lowerSeg=lowerSegIn;
+        upperSeg=upperSegIn;
+    }
+};
+
+//Orders crossings by their exact positions for a min-heap, which is the
+//order of the sweep.
+class SweepCrossingGreater {
+public:
+    const vector<double> *segs;
+
+    SweepCrossingGreater(const vector<double> *segsIn) {
+        segs=segsIn;
+    }
+
+    bool operator()(const SweepCrossing &a,const SweepCrossing &b) const {
+        const double *s=&(*segs)[0];
+
+        return crossingCompareCPP(s+4*a.lowerSeg,s+4*a.lowerSeg+2,s+4*a.upperSeg,s+4*a.upperSeg+2,s+4*b.lowerSeg,s+4*b.lowerSeg+2,s+4*b.upperSeg,s+4*b.upperSeg+2)>0;
+    }
+};
+
+//The state of the sweep.
+class SegmentSweep {
+public:
+    SegmentSweep(const double *segmentsIn,const size_t numSegmentsIn);
+    void run(vector<size_t> &pairs,vector<double> &points);
+private:
+    size_t numSegments;
+    //The segments with the endpoints ordered so that the start (the first
+    //two elements) comes before the end in the sweep.
+    vector<double> segs;
+    //The segments crossing the sweep line from bottom to top and the
+    //position of each segment in the list.
+    vector<size_t> status;
+    vector<size_t> statusPos;
+    vector<bool> isActive;
+    priority_queue<SweepCrossing,vector<SweepCrossing>,SweepCrossingGreater> crossings;
+    //The pairs found and the point at which each was found.
+    vector<size_t> *pairsFound;
+    vector<double> *pointsFound;
+
+    const double *startPoint(const size_t segIdx) const {
+        return &segs[4*segIdx];
+    }
+    const double *endPoint(const size_t segIdx) const {
+        return &segs[4*segIdx+2];
+    }
+    bool crossingIsBefore(const SweepCrossing &crossing,const SweepEndpoint &endpoint) const {
+        const double point[2]={endpoint.x,endpoint.y};
+
+        return crossingComparePointCPP(startPoint(crossing.lowerSeg),endPoint(crossing.lowerSeg),startPoint(crossing.upperSeg),endPoint(crossing.upperSeg),point)<0;
+    }
+    int orientToSeg(const size_t segIdx,const double *point) const {
+        return orient2DCPP(startPoint(segIdx),endPoint(segIdx),point);
+    }
+    bool segsAreCollinear(const size_t seg1,const size_t seg2) const {
+        return orientToSeg(seg1,startPoint(seg2))==0&&orientToSeg(seg1,endPoint(seg2))==0;
+    }
+    void addPair(const size_t seg1,const size_t seg2,const double x,const double y);
+    void handleEndpoints(const vector<SweepEndpoint> &endpoints,const size_t firstIdx,const size_t lastIdx);
+    void handleCrossing(const SweepCrossing &crossing);
+    void checkForCrossing(const size_t lowerSeg,const size_t upperSeg);
+    void updatePositions(const size_t firstIdx);
+};
+
+//Orders segments passing through or starting at a point by their
+//directions, from bottom to top, just after the point.
+class SweepDirectionLess {
+public:
+    const double *point;
+    const vector<double> *segs;
+
+    SweepDirectionLess(const double *pointIn,const vector<double> *segsIn) {
+        point=pointIn;
+        segs=segsIn;
+    }
+
+    bool operator()(const size_t a,const size_t b) const {
+        const int orient=orient2DCPP(point,&(*segs)[4*a+2],&(*segs)[4*b+2]);
+
+        if(orient!=0) {
+            return orient>0;
+        }
+        //Overlapping segments are ordered by index.
+        return a<b;
+    }
+};
+
+SegmentSweep::SegmentSweep(const double *segmentsIn,const size_t numSegmentsIn) : crossings(SweepCrossingGreater(&segs)) {
+    size_t i;
+
+    numSegments=numSegmentsIn;
+    segs.resize(4*numSegments);
+    for(i=0;i<numSegments;i++) {
+        const double *curSeg=segmentsIn+4*i;
+        const bool isReversed=curSeg[2]<curSeg[0]||(curSeg[2]==curSeg[0]&&curSeg[3]<curSeg[1]);
+
+        segs[4*i]=isReversed?curSeg[2]:curSeg[0];
+        segs[4*i+1]=isReversed?curSeg[3]:curSeg[1];
+        segs[4*i+2]=isReversed?curSeg[0]:curSeg[2];
+        segs[4*i+3]=isReversed?curSeg[1]:curSeg[3];
+    }
+    statusPos.assign(numSegments,0);
+    isActive.assign(numSegments,false);
+}
+
+void SegmentSweep::run(vector<size_t> &pairs,vector<double> &points) {
+    vector<SweepEndpoint> endpoints;
+    size_t i, curEndpoint=0;
+
+    pairsFound=&pairs;
+    pointsFound=&points;
+
+    endpoints.reserve(2*numSegments);
+    for(i=0;i<numSegments;i++) {
+        endpoints.push_back(SweepEndpoint(segs[4*i],segs[4*i+1],i,true));
+        endpoints.push_back(SweepEndpoint(segs[4*i+2],segs[4*i+3],i,false));
+    }
+    sort(endpoints.begin(),endpoints.end());
+
+    while(curEndpoint<endpoints.size()||!crossings.empty()) {
+        //Crossings are handled first if they come strictly before the
+        //next endpoint. A crossing at an endpoint is handled with the
+        //endpoint.
+        if(!crossings.empty()&&(curEndpoint==endpoints.size()||crossingIsBefore(crossings.top(),endpoints[curEndpoint]))) {
+            const SweepCrossing curCrossing=crossings.top();
+
+            crossings.pop();
+            handleCrossing(curCrossing);
+        } else {
+            size_t lastIdx=curEndpoint+1;
+
+            //All endpoints at the same point are handled together.
+            while(lastIdx<endpoints.size()&&endpoints[lastIdx].x==endpoints[curEndpoint].x&&endpoints[lastIdx].y==endpoints[curEndpoint].y) {
+                lastIdx++;
+            }
+            handleEndpoints(endpoints,curEndpoint,lastIdx);
+            curEndpoint=lastIdx;
+        }
+    }
+}
+
+void SegmentSweep::addPair(const size_t seg1,const size_t seg2,const double x,const double y) {
+    pairsFound->push_back(min(seg1,seg2));
+    pairsFound->push_back(max(seg1,seg2));
+    pointsFound->push_back(x);
+    pointsFound->push_back(y);
+}
+
+void SegmentSweep::handleEndpoints(const vector<SweepEndpoint> &endpoints,const size_t firstIdx,const size_t lastIdx) {
+/*HANDLEENDPOINTS Handle all of the endpoints endpoints[firstIdx] to
+ *                endpoints[lastIdx-1], which are at the same point.
+ */
+    const double point[2]={endpoints[firstIdx].x,endpoints[firstIdx].y};
+    vector<size_t> startSegs, pointSegs, newSegs;
+    size_t lo, hi, i, j;
+
+    for(i=firstIdx;i<lastIdx;i++) {
+        const size_t curSeg=endpoints[i].segIdx;
+
+        if(endpoints[i].isStart) {
+            //Segments with no length are only points, which are never
+            //inserted into the status list.
+            if(segs[4*curSeg]==segs[4*curSeg+2]&&segs[4*curSeg+1]==segs[4*curSeg+3]) {
+                pointSegs.push_back(curSeg);
+            } else {
+                startSegs.push_back(curSeg);
+            }
+        }
+    }
+
+    //Find the segments in the status list that contain the point. These
+    //are contiguous, as the segments below the point come first and the
+    //segments above it come last.
+    {
+        size_t upper=status.size();
+
+        lo=0;
+        while(lo<upper) {
+            const size_t mid=(lo+upper)/2;
+
+            if(orientToSeg(status[mid],point)>0) {
+                lo=mid+1;
+            } else {
+                upper=mid;
+            }
+        }
+
+        hi=lo;
+        upper=status.size();
+        while(hi<upper) {
+            const size_t mid=(hi+upper)/2;
+
+            if(orientToSeg(status[mid],point)>=0) {
+                hi=mid+1;
+            } else {
+                upper=mid;
+            }
+        }
+    }
+
+    //Report all pairs of segments at the point. Collinear segments that
+    //both already contained the point were reported where they first
+    //met.
+    {
+        vector<size_t> allSegs(startSegs);
+
+        allSegs.insert(allSegs.end(),pointSegs.begin(),pointSegs.end());
+        allSegs.insert(allSegs.end(),status.begin()+lo,status.begin()+hi);
+        for(i=0;i<allSegs.size();i++) {
+            for(j=i+1;j<allSegs.size();j++) {
+                const bool bothInStatus=i>=startSegs.size()+pointSegs.size();
+
+                if(bothInStatus&&segsAreCollinear(allSegs[i],allSegs[j])) {
+                    continue;
+                }
+                addPair(allSegs[i],allSegs[j],point[0],point[1]);
+            }
+        }
+    }
+
+    //The segments that continue past the point and those starting at it
+    //are put in the status list in their order just after the point.
+    newSegs=startSegs;
+    for(i=lo;i<hi;i++) {
+        const size_t curSeg=status[i];
+
+        if(segs[4*curSeg+2]==point[0]&&segs[4*curSeg+3]==point[1]) {
+            isActive[curSeg]=false;
+        } else {
+            newSegs.push_back(curSeg);
+        }
+    }
+    sort(newSegs.begin(),newSegs.end(),SweepDirectionLess(point,&segs));
+
+    status.erase(status.begin()+lo,status.begin()+hi);
+    status.insert(status.begin()+lo,newSegs.begin(),newSegs.end());
+    for(i=0;i<newSegs.size();i++) {
+        isActive[newSegs[i]]=true;
+    }
+    updatePositions(lo);
+
+    //Check the newly adjacent segments for crossings.
+    if(newSegs.empty()) {
+        if(lo>0&&lo<status.size()) {
+            checkForCrossing(status[lo-1],status[lo]);
+        }
+    } else {
+        const size_t numNew=newSegs.size();
+
+        if(lo>0) {
+            checkForCrossing(status[lo-1],status[lo]);
+        }
+        if(lo+numNew<status.size()) {
+            checkForCrossing(status[lo+numNew-1],status[lo+numNew]);
+        }
+    }
+}
+
+void SegmentSweep::handleCrossing(const SweepCrossing &crossing) {
+/*HANDLECROSSING Swap two segments that cross if they are still adjacent
+ *               and have not already been swapped. Otherwise, the event is
+ *               stale and is ignored; if the segments become adjacent
+ *               again before crossing, the crossing is found again.
+ */
+    const size_t lowerSeg=crossing.lowerSeg;
+    const size_t upperSeg=crossing.upperSeg;
+    size_t pos;
+
+    if(!isActive[lowerSeg]||!isActive[upperSeg]||statusPos[upperSeg]!=statusPos[lowerSeg]+1) {
+        return;
+    }
+    //After the crossing, the lower segment ends above the upper one.
+    if(orientToSeg(upperSeg,endPoint(lowerSeg))<=0) {
+        return;
+    }
+
+    pos=statusPos[lowerSeg];
+    status[pos]=upperSeg;
+    status[pos+1]=lowerSeg;
+    statusPos[upperSeg]=pos;
+    statusPos[lowerSeg]=pos+1;
+
+    addPair(lowerSeg,upperSeg,crossing.x,crossing.y);
+
+    if(pos>0) {
+        checkForCrossing(status[pos-1],upperSeg);
+    }
+    if(pos+2<status.size()) {
+        checkForCrossing(lowerSeg,status[pos+2]);
+    }
+}
+
+void SegmentSweep::checkForCrossing(const size_t lowerSeg,const size_t upperSeg) {
+/*CHECKFORCROSSING If two segments that are adjacent in the status list
+ *                 properly cross and the crossing is still ahead, add the
+ *                 crossing as an event. Crossings at endpoints are found
+ *                 when handling the endpoints.
+ */
+    const double *p1=startPoint(lowerSeg);
+    const double *p2=endPoint(lowerSeg);
+    const double *q1=startPoint(upperSeg);
+    const double *q2=endPoint(upperSeg);
+    const int o1=orient2DCPP(q1,q2,p1);
+    const int o2=orient2DCPP(q1,q2,p2);
+
+    //The crossing is still ahead if the lower segment ends above the
+    //upper one.
+    if(o1>=0||o2<=0) {
+        return;
+    }
+    if(orient2DCPP(p1,p2,q1)*orient2DCPP(p1,p2,q2)>=0) {
+        return;
+    }
+
+    {
+        const double qx=q2[0]-q1[0];
+        const double qy=q2[1]-q1[1];
+        const double d1=qx*(p1[1]-q1[1])-qy*(p1[0]-q1[0]);
+        const double d2=qx*(p2[1]-q1[1])-qy*(p2[0]-q1[0]);
+        const double t=d1/(d1-d2);
+        double x=p1[0]+t*(p2[0]-p1[0]);
+        double y=p1[1]+t*(p2[1]-p1[1]);
+
+        //Keep the point in the bounding boxes of both segments despite
+        //finite precision errors.
+        x=min(max(x,max(min(p1[0],p2[0]),min(q1[0],q2[0]))),min(max(p1[0],p2[0]),max(q1[0],q2[0])));
+        y=min(max(y,max(min(p1[1],p2[1]),min(q1[1],q2[1]))),min(max(p1[1],p2[1]),max(q1[1],q2[1])));
+
+        crossings.push(SweepCrossing(x,y,lowerSeg,upperSeg));
+    }
+}
+
+void SegmentSweep::updatePositions(const size_t firstIdx) {
+    size_t i;
+
+    for(i=firstIdx;i<status.size();i++) {
+        statusPos[status[i]]=i;
+    }
+}
+
+void segmentIntersectionsCPP(vector<size_t> &pairs,vector<double> &points,const double *segments,const size_t numSegments) {
+/*SEGMENTINTERSECTIONSCPP Find all pairs of intersecting segments among
+ *              numSegments 2D line segments, each given by four values
+ *              [x1;y1;x2;y2] for its two endpoints. The indices of the
+ *              segments in each pair, with the smaller index first, are
+ *              placed in pairs, two values per pair, and a point where
+ *              they intersect is placed in points. The pairs are sorted
+ *              in increasing order. Segments that only touch, share an
+ *              endpoint or overlap are considered to intersect. For
+ *              overlapping segments, the point is the leftmost point of
+ *              the overlap (the lowest for vertical segments).
+ */
+    pairs.clear();
+    points.clear();
+    if(numSegments<2) {
+        return;
+    }
+
+    {
+        SegmentSweep sweep(segments,numSegments);
+        vector<size_t> pairsTemp;
+        vector<double> pointsTemp;
+        vector<pair<pair<size_t,size_t>,size_t> > order;
+        size_t i, numPairs;
+
+        sweep.run(pairsTemp,pointsTemp);
+
+        //Sort the pairs and remove pairs found more than once, which
+        //can happen when segments cross exactly at an endpoint of another
+        //segment. The first point found is kept for each pair.
+        numPairs=pairsTemp.size()/2;
+        order.resize(numPairs);
+        for(i=0;i<numPairs;i++) {
+            order[i]=make_pair(make_pair(pairsTemp[2*i],pairsTemp[2*i+1]),i);
+        }
+        sort(order.begin(),order.end());
+
+        for(i=0;i<numPairs;i++) {
+            const size_t idx=order[i].second;
+
+            if(i>0&&order[i].first==order[i-1].first) {
+                continue;
+            }
+            pairs.push_back(pairsTemp[2*idx]);
+            pairs.push_back(pairsTemp[2*idx+1]);
+            points.push_back(pointsTemp[2*idx]);
+            points.push_back(pointsTemp[2*idx+1]);
+        }
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -23,6 +23,10 @@ function clippedPolygon=clipPolygonSH2D(polygon2Clip,convexClipPolygon)
 %                        If the clipping region is engulfed by the polygon,
 %                        then the polygon will be the clipping region.
 %
+%To split concave polygons into separate parts, to clip against
+%non-convex polygons, or to compute unions and differences, use
+%polygonBooleanBatch.
+%
 %The Sutherland-Hodgman algorithm is originally from
 %I. E. Sutherland and G. W. Hodgman, "Reentrant polygon clipping,"
 %Communications of the ACM, vol. 17, no. 1, pp. 32-42, Jan. 1974.
@@ -0,0 +1,153 @@
+/**CONVEXHULL2DBATCH Find the convex hulls of one or more sets of 2D points
+ *                using Andrew's monotone chain algorithm. This is a
+ *                compiled alternative to findConvexHull2D that can
+ *                process many independent sets of points at once.
+ *
+ *INPUTS: points A 2XN matrix of N points of the form [x;y], or a
+ *               numSetsX1 or 1XnumSets cell array of such matrices (which
+ *               can have different numbers of points), if the hulls of
+ *               multiple sets are desired. Repeated points are allowed.
+ *
+ *OUTPUTS: vertices A 2XnumVert matrix of the vertices of the convex hull
+ *                  in counterclockwise order, starting with the point
+ *                  having the smallest x coordinate (and the smallest y
+ *                  coordinate in the case of ties). The first vertex is
+ *                  not repeated at the end. Points on the edges of the
+ *                  hull are not included. If all of the points are
+ *                  collinear, the two extreme points are returned and if
+ *                  all of the points are the same, one point is returned.
+ *                  If points is a cell array, then vertices is a
+ *                  numSetsX1 cell array of the vertices of each hull.
+ *          hullIdx A numVertX1 vector of the indices of the vertices in
+ *                  points, so vertices=points(:,hullIdx). Of repeated
+ *                  points, the one with the lowest index is used. If
+ *                  points is a cell array, then this is a numSetsX1 cell
+ *                  array.
+ *
+ *All of the orientation tests are done using an exact predicate. See the
+ *comments in convexHull2DCPP.cpp for details. Unlike findConvexHull2D, the
+ *points are sorted by their coordinates rather than by angle, so the hull
+ *is found in O(N log(N)) time with a compiled sort. If the code is
+ *compiled with OpenMP support, then multiple sets of points are processed
+ *in parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[vertices,hullIdx]=convexHull2DBatch(points);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include <vector>
+#include "MexValidation.h"
+#include "mathGeometricFuncs.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    const bool isCellArray=nrhs==1&&mxIsCell(prhs[0]);
+    size_t numSets, i;
+    vector<const double*> pointSets;
+    vector<size_t> numPoints;
+    vector<vector<size_t> > hullIdx;
+    mxArray *verticesMATLAB, *hullIdxMATLAB;
+
+    if(nrhs!=1) {
+        mexErrMsgTxt("Incorrect number of inputs.");
+    }
+
+    if(nlhs>2) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    numSets=isCellArray?mxGetNumberOfElements(prhs[0]):1;
+    pointSets.resize(numSets);
+    numPoints.resize(numSets);
+    for(i=0;i<numSets;i++) {
+        const mxArray *curSet=isCellArray?mxGetCell(prhs[0],i):prhs[0];
+
+        if(curSet==NULL||mxIsEmpty(curSet)) {
+            pointSets[i]=NULL;
+            numPoints[i]=0;
+            continue;
+        }
+
+        checkRealDoubleArray(curSet);
+        if(mxGetM(curSet)!=2) {
+            mexErrMsgTxt("The points have the wrong dimensionality.");
+        }
+        pointSets[i]=(double*)mxGetData(curSet);
+        numPoints[i]=mxGetN(curSet);
+    }
+
+    hullIdx.resize(numSets);
+
+    //The sets are independent, so they are processed in parallel if
+    //OpenMP is available.
+    {
+        ptrdiff_t curSet;
+
+        #pragma omp parallel for schedule(dynamic)
+        for(curSet=0;curSet<(ptrdiff_t)numSets;curSet++) {
+            vector<size_t> &curIdx=hullIdx[curSet];
+
+            curIdx.resize(numPoints[curSet]+1);
+            curIdx.resize(convexHull2DCPP(&curIdx[0],pointSets[curSet],numPoints[curSet]));
+        }
+    }
+
+    verticesMATLAB=isCellArray?mxCreateCellMatrix(numSets,1):NULL;
+    hullIdxMATLAB=isCellArray?mxCreateCellMatrix(numSets,1):NULL;
+    for(i=0;i<numSets;i++) {
+        const size_t numVert=hullIdx[i].size();
+        mxArray *curVertices=mxCreateDoubleMatrix(2,numVert,mxREAL);
+        mxArray *curIdx=mxCreateDoubleMatrix(numVert,1,mxREAL);
+        double *vertexData=(double*)mxGetData(curVertices);
+        double *idxData=(double*)mxGetData(curIdx);
+        size_t j;
+
+        for(j=0;j<numVert;j++) {
+            vertexData[2*j]=pointSets[i][2*hullIdx[i][j]];
+            vertexData[2*j+1]=pointSets[i][2*hullIdx[i][j]+1];
+            //Convert to Matlab indexation.
+            idxData[j]=(double)(hullIdx[i][j]+1);
+        }
+
+        if(isCellArray) {
+            mxSetCell(verticesMATLAB,i,curVertices);
+            mxSetCell(hullIdxMATLAB,i,curIdx);
+        } else {
+            verticesMATLAB=curVertices;
+            hullIdxMATLAB=curIdx;
+        }
+    }
+
+    plhs[0]=verticesMATLAB;
+    if(nlhs>1) {
+        plhs[1]=hullIdxMATLAB;
+    } else {
+        mxDestroyArray(hullIdxMATLAB);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
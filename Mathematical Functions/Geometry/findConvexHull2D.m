@@ -24,15 +24,12 @@ function vertices=findConvexHull2D(points)
 %Kingdom: Cambridge University Press, 1998.
 %However, the author suggests that one only use integers to avoid horrible
 %finite precision problems. Here, the method of determining whether points
-%are oriented  left uses the function turnOrientation, which makes use of
-%the error-free function exactSignOfSum. Thus, as long as no precision is
-%lost in any intermediate step, then the results are exact. This means that
-%if points are floating point doubles that have been truncated to single
-%precision (points cannot be singles or integer types for this function),
-%then the results will be exact. Given doubles, steps were taken in the
-%turnOrientation function to reduce the likelihood of finite precision
-%errors. However, such errors cannot be completely eliminated without using
-%quadruple precision arithmetic in an intermediate step.
+%are oriented  left uses the function turnOrientation, which evaluates the
+%orientation using an adaptive-precision predicate. The determinant is
+%computed in double precision and, when the result is not certain given a
+%bound on the finite precision error, it is evaluated exactly using
+%floating point expansion arithmetic. Thus, the orientation tests are
+%exact, barring overflow or underflow.
 %
 %The implementation discussed in Cormen's book is simpler than Graham's
 %original implementation, which is given in
@@ -42,6 +39,9 @@ function vertices=findConvexHull2D(points)
 %as it does not use complex numbers. The implementation here does not use
 %complex numbers and none of the points can be complex.
 %
+%The compiled function convexHull2DBatch uses Andrew's monotone chain
+%algorithm instead and can find the hulls of many sets of points at once.
+%
 %December 2014 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
@@ -112,10 +112,8 @@ function vertices=findConvexHull2D(points)
             %The first two things in the stack should never be removed.
             %In the unlikely event that finite precision errors cause it to
             %want to remove one of them, throw an error. This should never
-            %happen if the points all are truncated to single precision but
-            %extended to doubles), because the turnOrientation function
-            %should be exact and that is the deciding factor in this
-            %algorithm.
+            %happen, because the turnOrientation function is exact and that
+            %is the deciding factor in this algorithm.
             if(curStackIdx<2)
                error('Finite precision errors prevent the computation of the convex hull')
             end
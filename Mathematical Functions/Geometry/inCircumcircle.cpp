@@ -0,0 +1,104 @@
+/**INCIRCUMCIRCLE Given 4 two-dimensional points, determine whether the
+ *               fourth point lies inside of the circle passing through the
+ *               first three points. This is the basis of the Delaunay
+ *               triangulation of a set of points.
+ *
+ *INPUTS: v1, v2, v3, v4 A set of 4 2XN matrices of N sets of points in the
+ *                   order [x;y].
+ *
+ *OUTPUTS: inCircleDir An NX1 vector. If v1, v2 and v3 are in
+ *                   counterclockwise order, the ith element is 1 if the ith
+ *                   v4 lies inside of the circle passing through v1, v2 and
+ *                   v3, -1 if it lies outside of the circle and 0 if the
+ *                   four points are on the same circle. If v1, v2 and v3
+ *                   are in clockwise order, the signs are reversed. This is
+ *                   the sign of det([v1,v2,v3,v4;sum([v1,v2,v3,v4].^2,1);1,1,1,1])
+ *                   for each set of points.
+ *
+ *The sign of the determinant is found using the function inCircleBatchCPP
+ *in geometricPredicatesCPP.cpp. The determinant is evaluated in double
+ *precision arithmetic and the result is accepted if it exceeds a bound on
+ *the finite precision error. Otherwise, which only happens when the points
+ *are nearly cocircular, the determinant is evaluated exactly using
+ *floating point expansion arithmetic. Thus, the result is always correct,
+ *barring overflow or underflow. If the code is compiled with OpenMP
+ *support, then the point sets are processed in parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *inCircleDir=inCircumcircle(v1,v2,v3,v4);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "mex.h"
+/* This header validates inputs and includes a header needed to handle
+ * Matlab matrices.*/
+#include "MexValidation.h"
+#include "mathGeometricFuncs.hpp"
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t i, numElements;
+    const double *P1,*P2,*P3,*P4;
+    mxArray *retMat;
+    double *retVals;
+    
+    if(nrhs!=4) {
+        mexErrMsgTxt("Incorrect number of inputs.");
+        return;
+    }
+    
+    if(nlhs>1) {
+        mexErrMsgTxt("Wrong number of outputs.");
+        return;
+    }
+
+    checkRealDoubleArray(prhs[0]);
+    checkRealDoubleArray(prhs[1]);
+    checkRealDoubleArray(prhs[2]);
+    checkRealDoubleArray(prhs[3]);
+    
+    numElements=mxGetN(prhs[0]);
+    for(i=0;i<4;i++) {
+        if(mxGetM(prhs[i])!=2) {
+            mexErrMsgTxt("The vertices must be two-dimensional.");
+        }
+        if(mxGetN(prhs[i])!=numElements) {
+            mexErrMsgTxt("All of the inputs must have the same dimensionality.");
+        }
+    }
+    
+    P1=(double*)mxGetData(prhs[0]);
+    P2=(double*)mxGetData(prhs[1]);
+    P3=(double*)mxGetData(prhs[2]);
+    P4=(double*)mxGetData(prhs[3]);
+    
+    //Allocate space for the return values
+    retMat=mxCreateDoubleMatrix(numElements,1,mxREAL);
+    retVals=(double*)mxGetData(retMat);
+    
+    inCircleBatchCPP(retVals,P1,P2,P3,P4,numElements);
+    //Set the return value.
+    plhs[0]=retMat;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
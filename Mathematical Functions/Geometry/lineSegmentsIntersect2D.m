@@ -15,6 +15,10 @@ function boolVal=lineSegmentsIntersect2D(line1,line2)
 %is used. It does not compute slopes and thus avoid issues with infinite
 %sloped when lines are vertical.
 %
+%To find all intersecting pairs in a large set of segments, use
+%segmentIntersections2D, which implements the Bentley-Ottmann sweep-line
+%algorithm.
+%
 %December 2014 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
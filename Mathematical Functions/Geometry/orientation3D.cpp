@@ -0,0 +1,104 @@
+/**ORIENTATION3D Given 4 three-dimensional points, determine on which side
+ *              of the plane passing through the first three points the
+ *              fourth point lies. This is the three-dimensional analogue
+ *              of turnOrientation and plays a role in finding convex
+ *              hulls and Delaunay tetrahedralizations.
+ *
+ *INPUTS: v1, v2, v3, v4 A set of 4 3XN matrices of N sets of points in the
+ *                   order [x;y;z].
+ *
+ *OUTPUTS: orientDir An NX1 vector where the ith element is 1 if the ith
+ *                   v4 lies below the plane through v1, v2 and v3, -1 if
+ *                   it lies above the plane and 0 if the points are
+ *                   coplanar. Below is defined such that v1, v2 and v3
+ *                   appear in counterclockwise order when viewed from above
+ *                   the plane. This is the sign of det([v1,v2,v3,v4;1,1,1,1])
+ *                   for each set of points.
+ *
+ *The sign of the determinant is found using the function orient3DBatchCPP
+ *in geometricPredicatesCPP.cpp. The determinant is evaluated in double
+ *precision arithmetic and the result is accepted if it exceeds a bound on
+ *the finite precision error. Otherwise, which only happens when the points
+ *are nearly coplanar, the determinant is evaluated exactly using floating
+ *point expansion arithmetic. Thus, the result is always correct, barring
+ *overflow or underflow. If the code is compiled with OpenMP support, then
+ *the point sets are processed in parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *orientDir=orientation3D(v1,v2,v3,v4);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "mex.h"
+/* This header validates inputs and includes a header needed to handle
+ * Matlab matrices.*/
+#include "MexValidation.h"
+#include "mathGeometricFuncs.hpp"
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t i, numElements;
+    const double *P1,*P2,*P3,*P4;
+    mxArray *retMat;
+    double *retVals;
+    
+    if(nrhs!=4) {
+        mexErrMsgTxt("Incorrect number of inputs.");
+        return;
+    }
+    
+    if(nlhs>1) {
+        mexErrMsgTxt("Wrong number of outputs.");
+        return;
+    }
+
+    checkRealDoubleArray(prhs[0]);
+    checkRealDoubleArray(prhs[1]);
+    checkRealDoubleArray(prhs[2]);
+    checkRealDoubleArray(prhs[3]);
+    
+    numElements=mxGetN(prhs[0]);
+    for(i=0;i<4;i++) {
+        if(mxGetM(prhs[i])!=3) {
+            mexErrMsgTxt("The vertices must be three-dimensional.");
+        }
+        if(mxGetN(prhs[i])!=numElements) {
+            mexErrMsgTxt("All of the inputs must have the same dimensionality.");
+        }
+    }
+    
+    P1=(double*)mxGetData(prhs[0]);
+    P2=(double*)mxGetData(prhs[1]);
+    P3=(double*)mxGetData(prhs[2]);
+    P4=(double*)mxGetData(prhs[3]);
+    
+    //Allocate space for the return values
+    retMat=mxCreateDoubleMatrix(numElements,1,mxREAL);
+    retVals=(double*)mxGetData(retMat);
+    
+    orient3DBatchCPP(retVals,P1,P2,P3,P4,numElements);
+    //Set the return value.
+    plhs[0]=retMat;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -35,6 +35,10 @@ function [isInPolygon,omegas]=pointIsInPolygon(vertices,point,boundaryIsImportan
 %K. Hormann and A. Agathos, "The point in polygon problem for arbitrary
 %polygons," Computational Geometry, vol. 20, no. 3, pp. 131-144, Nov. 2001.
 %
+%When many points are to be tested against the same polygons, or against
+%polygons with many vertices, the PolygonIndex class is much faster, since
+%it only visits the edges near each point.
+%
 %December 2014 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
@@ -0,0 +1,252 @@
+/**POLYGONBOOLEANBATCH Compute the intersections, unions or differences of
+ *                 many pairs of simple (non-self-intersecting) 2D
+ *                 polygons. Unlike clipPolygonSH2D, neither polygon has to
+ *                 be convex and the result of each operation can consist
+ *                 of multiple separate polygons with holes. This is
+ *                 useful, for example, for merging the footprints of many
+ *                 sensors or for determining how much of many regions is
+ *                 covered.
+ *
+ *INPUTS: polygonsA A numPairsX1 or 1XnumPairs cell array of the first
+ *                  polygons of the pairs. Each polygon is a 2XN matrix of
+ *                  N vertices of the form [x;y]. The vertices can be in
+ *                  clockwise or counterclockwise order and it does not
+ *                  matter whether the first vertex is repeated on the
+ *                  end. Alternatively, if a single 2XN matrix or a cell
+ *                  array with one element is passed, then the same
+ *                  polygon is used with all of the polygons in polygonsB.
+ *                  A polygon with fewer than 3 distinct vertices or zero
+ *                  area is treated as empty.
+ *        polygonsB The second polygons of the pairs, given in the same
+ *                  manner as polygonsA. If polygonsA has more than one
+ *                  element and polygonsB has more than one element, then
+ *                  they must have the same number of elements.
+ *        operation A string specifying the operation to perform on each
+ *                  pair. Possible values are
+ *                  'intersection' The regions in both polygons.
+ *                  'union'        The regions in either polygon.
+ *                  'difference'   The regions in polygonsA that are not
+ *                                 in polygonsB.
+ *                  If omitted or an empty matrix is passed, the default
+ *                  of 'intersection' is used.
+ *
+ *OUTPUTS: rings A numPairsX1 cell array where rings{i} is a numRingsX1
+ *               cell array of the boundaries of the result for the ith
+ *               pair. Each boundary is a 2XnumVert matrix of vertices
+ *               without the first vertex repeated. Outer boundaries are in
+ *               counterclockwise order and are each followed by the holes
+ *               that they contain, which are in clockwise order. If the
+ *               result is empty, rings{i} is an empty cell array.
+ *        isHole A numPairsX1 cell array where isHole{i} is a numRingsX1
+ *               logical vector indicating which of the rings in rings{i}
+ *               are holes.
+ *     parentIdx A numPairsX1 cell array where parentIdx{i} is a
+ *               numRingsX1 vector holding, for each hole in rings{i}, the
+ *               index of the outer boundary containing it. The entries for
+ *               outer boundaries are zero.
+ *
+ *The edges of each pair of polygons are split where they intersect, the
+ *pieces of edges are classified as inside, outside, or on the boundary of
+ *the other polygon and the pieces bounding the result are linked into
+ *rings. Whether edges intersect, touch or overlap is determined using
+ *exact orientation tests, so degenerate cases such as shared edges and
+ *vertices lying on edges are handled without perturbing the polygons. See
+ *the comments in polygonBooleanCPP.cpp for details. If the code is
+ *compiled with OpenMP support, then the pairs are processed in parallel.
+ *
+ *EXAMPLE:
+ *Two overlapping squares and an L-shaped polygon. The union is a single
+ *polygon and the difference of the L-shape and the square it wraps around
+ *is two polygons.
+ * square1=[0,2,2,0;0,0,2,2];
+ * square2=[1,3,3,1;1,1,3,3];
+ * LShape=[0,3,3,2,2,0;0,0,3,3,1,1];
+ * rings=polygonBooleanBatch({square1},{square2},'union');
+ * rings{1}{1}
+ * rings=polygonBooleanBatch(LShape,{[1.5,2.5,2.5,1.5;-1,-1,2,2]},'difference');
+ * rings{1}
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[rings,isHole,parentIdx]=polygonBooleanBatch(polygonsA,polygonsB,operation);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy
+#include <algorithm>
+//For strcmp
+#include <cstring>
+#include <vector>
+#include "MexValidation.h"
+#include "mathGeometricFuncs.hpp"
+#include "mex.h"
+
+using namespace std;
+
+static void getPolygons(const mxArray *polyMATLAB,vector<const double*> &polys,vector<size_t> &numVertices);
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    vector<const double*> polysA, polysB;
+    vector<size_t> numVerticesA, numVerticesB;
+    size_t numPairs, i;
+    PolygonBooleanOpCPP op=POLYGON_INTERSECTION;
+    vector<vector<vector<double> > > rings;
+    vector<vector<bool> > isHole;
+    vector<vector<size_t> > parentIdx;
+    mxArray *ringsMATLAB, *isHoleMATLAB, *parentIdxMATLAB;
+
+    if(nrhs<2) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>3) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>3) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    if(nrhs>2&&!mxIsEmpty(prhs[2])) {
+        char opString[16];
+
+        if(!mxIsChar(prhs[2])||mxGetString(prhs[2],opString,sizeof(opString))) {
+            mexErrMsgTxt("The operation must be a string.");
+        }
+
+        if(!strcmp(opString,"intersection")) {
+            op=POLYGON_INTERSECTION;
+        } else if(!strcmp(opString,"union")) {
+            op=POLYGON_UNION;
+        } else if(!strcmp(opString,"difference")) {
+            op=POLYGON_DIFFERENCE;
+        } else {
+            mexErrMsgTxt("Unknown operation specified.");
+        }
+    }
+
+    getPolygons(prhs[0],polysA,numVerticesA);
+    getPolygons(prhs[1],polysB,numVerticesB);
+
+    if(polysA.size()!=1&&polysB.size()!=1&&polysA.size()!=polysB.size()) {
+        mexErrMsgTxt("The numbers of polygons in polygonsA and polygonsB are inconsistent.");
+    }
+    numPairs=max(polysA.size(),polysB.size());
+    if(polysA.size()==0||polysB.size()==0) {
+        numPairs=0;
+    }
+
+    rings.resize(numPairs);
+    isHole.resize(numPairs);
+    parentIdx.resize(numPairs);
+
+    //The pairs are independent, so they are processed in parallel if
+    //OpenMP is available.
+    {
+        ptrdiff_t curPair;
+
+        #pragma omp parallel for schedule(dynamic)
+        for(curPair=0;curPair<(ptrdiff_t)numPairs;curPair++) {
+            const size_t idxA=polysA.size()==1?0:curPair;
+            const size_t idxB=polysB.size()==1?0:curPair;
+
+            polygonBooleanCPP(rings[curPair],isHole[curPair],parentIdx[curPair],polysA[idxA],numVerticesA[idxA],polysB[idxB],numVerticesB[idxB],op);
+        }
+    }
+
+    ringsMATLAB=mxCreateCellMatrix(numPairs,1);
+    isHoleMATLAB=mxCreateCellMatrix(numPairs,1);
+    parentIdxMATLAB=mxCreateCellMatrix(numPairs,1);
+    for(i=0;i<numPairs;i++) {
+        const size_t numRings=rings[i].size();
+        mxArray *curRings=mxCreateCellMatrix(numRings,1);
+        mxArray *curIsHole=mxCreateLogicalMatrix(numRings,1);
+        mxArray *curParent=mxCreateDoubleMatrix(numRings,1,mxREAL);
+        mxLogical *isHoleData=mxGetLogicals(curIsHole);
+        double *parentData=(double*)mxGetData(curParent);
+        size_t j;
+
+        for(j=0;j<numRings;j++) {
+            const size_t numVert=rings[i][j].size()/2;
+            mxArray *curRing=mxCreateDoubleMatrix(2,numVert,mxREAL);
+
+            copy(rings[i][j].begin(),rings[i][j].end(),(double*)mxGetData(curRing));
+            mxSetCell(curRings,j,curRing);
+
+            isHoleData[j]=isHole[i][j];
+            //Convert to Matlab indexation.
+            parentData[j]=isHole[i][j]?(double)(parentIdx[i][j]+1):0;
+        }
+
+        mxSetCell(ringsMATLAB,i,curRings);
+        mxSetCell(isHoleMATLAB,i,curIsHole);
+        mxSetCell(parentIdxMATLAB,i,curParent);
+    }
+
+    plhs[0]=ringsMATLAB;
+    switch(nlhs) {
+        case 3:
+            plhs[2]=parentIdxMATLAB;
+        case 2:
+            plhs[1]=isHoleMATLAB;
+        default:
+            break;
+    }
+
+    if(nlhs<3) {
+        mxDestroyArray(parentIdxMATLAB);
+    }
+    if(nlhs<2) {
+        mxDestroyArray(isHoleMATLAB);
+    }
+}
+
+static void getPolygons(const mxArray *polyMATLAB,vector<const double*> &polys,vector<size_t> &numVertices) {
+/*GETPOLYGONS Get pointers to the vertices of the polygons in a cell array
+ *            or of a single polygon given as a matrix.
+ */
+    const bool isCellArray=mxIsCell(polyMATLAB);
+    const size_t numPolys=isCellArray?mxGetNumberOfElements(polyMATLAB):1;
+    size_t i;
+
+    polys.resize(numPolys);
+    numVertices.resize(numPolys);
+    for(i=0;i<numPolys;i++) {
+        const mxArray *curPoly=isCellArray?mxGetCell(polyMATLAB,i):polyMATLAB;
+
+        if(curPoly==NULL||mxIsEmpty(curPoly)) {
+            polys[i]=NULL;
+            numVertices[i]=0;
+            continue;
+        }
+
+        checkRealDoubleArray(curPoly);
+        if(mxGetM(curPoly)!=2) {
+            mexErrMsgTxt("The polygons must be two-dimensional.");
+        }
+        polys[i]=(double*)mxGetData(curPoly);
+        numVertices[i]=mxGetN(curPoly);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -20,6 +20,10 @@ function isConvex=polygonIsConvex(vertices)
 %Weisstein, Eric W. "Convex Polygon." From MathWorld--A Wolfram Web
 %Resource. http://mathworld.wolfram.com/ConvexPolygon.html
 %
+%The compiled function polygonIsConvexBatch tests many polygons at once
+%and also rejects polygons that wind around more than once, such as
+%pentagrams.
+%
 %December 2014 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
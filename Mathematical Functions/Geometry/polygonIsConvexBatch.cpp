@@ -0,0 +1,111 @@
+/**POLYGONISCONVEXBATCH Determine whether one or more polygons are convex.
+ *                   This is a compiled alternative to polygonIsConvex
+ *                   that can test many polygons at once.
+ *
+ *INPUTS: polygons A 2XN matrix of the N vertices of a polygon of the form
+ *                 [x;y] in order around the polygon, or a numPolyX1 or
+ *                 1XnumPoly cell array of such matrices. The vertices
+ *                 can be in clockwise or counterclockwise order and the
+ *                 first vertex can be repeated at the end.
+ *
+ *OUTPUTS: isConvex A numPolyX1 logical vector (a scalar if a single
+ *                  polygon is passed as a matrix) indicating which of the
+ *                  polygons are convex.
+ *
+ *Repeated consecutive vertices and vertices at which a polygon goes
+ *straight are ignored. A polygon is convex if all of its other vertices
+ *turn in the same direction and it goes around only once, so that, unlike
+ *in polygonIsConvex, a pentagram is not convex. Polygons with fewer than
+ *three distinct vertices, with all vertices collinear, or that double back
+ *on themselves are not convex. The turn directions are determined using an
+ *exact predicate. See the comments in convexHull2DCPP.cpp for details. If
+ *the code is compiled with OpenMP support, then the polygons are tested in
+ *parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *isConvex=polygonIsConvexBatch(polygons);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include <vector>
+#include "MexValidation.h"
+#include "mathGeometricFuncs.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    const bool isCellArray=nrhs==1&&mxIsCell(prhs[0]);
+    size_t numPoly, i;
+    vector<const double*> polygons;
+    vector<size_t> numVertices;
+    mxArray *isConvexMATLAB;
+    mxLogical *isConvex;
+
+    if(nrhs!=1) {
+        mexErrMsgTxt("Incorrect number of inputs.");
+    }
+
+    if(nlhs>1) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    numPoly=isCellArray?mxGetNumberOfElements(prhs[0]):1;
+    polygons.resize(numPoly);
+    numVertices.resize(numPoly);
+    for(i=0;i<numPoly;i++) {
+        const mxArray *curPoly=isCellArray?mxGetCell(prhs[0],i):prhs[0];
+
+        if(curPoly==NULL||mxIsEmpty(curPoly)) {
+            polygons[i]=NULL;
+            numVertices[i]=0;
+            continue;
+        }
+
+        checkRealDoubleArray(curPoly);
+        if(mxGetM(curPoly)!=2) {
+            mexErrMsgTxt("The polygons must be two-dimensional.");
+        }
+        polygons[i]=(double*)mxGetData(curPoly);
+        numVertices[i]=mxGetN(curPoly);
+    }
+
+    isConvexMATLAB=mxCreateLogicalMatrix(numPoly,1);
+    isConvex=mxGetLogicals(isConvexMATLAB);
+
+    //The polygons are independent, so they are tested in parallel if
+    //OpenMP is available.
+    {
+        ptrdiff_t curPoly;
+
+        #pragma omp parallel for schedule(dynamic)
+        for(curPoly=0;curPoly<(ptrdiff_t)numPoly;curPoly++) {
+            isConvex[curPoly]=polygonIsConvexCPP(polygons[curPoly],numVertices[curPoly]);
+        }
+    }
+
+    plhs[0]=isConvexMATLAB;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,156 @@
+/**SEGMENTINTERSECTIONS2D Find all pairs of intersecting line segments in
+ *                   one or more sets of 2D line segments using the
+ *                   Bentley-Ottmann sweep-line algorithm. For N segments
+ *                   with K intersecting pairs, this takes
+ *                   O((N+K)log(N)) comparisons rather than the O(N^2)
+ *                   required to test all pairs with
+ *                   lineSegmentsIntersect2D.
+ *
+ *INPUTS: segments A 4XN matrix of N line segments, each of the form
+ *                 [x1;y1;x2;y2], where [x1;y1] and [x2;y2] are the
+ *                 endpoints, or a numSetsX1 or 1XnumSets cell array of
+ *                 such matrices if the intersections within multiple
+ *                 independent sets of segments are desired. A 2X2XN
+ *                 array, where segments(:,:,i) has the same form as the
+ *                 inputs to lineSegmentsIntersect2D, can also be used.
+ *
+ *OUTPUTS: pairs A 2XnumPairs matrix of the indices of the intersecting
+ *               pairs of segments, with the smaller index first in each
+ *               column and the columns sorted in increasing order.
+ *               Segments that touch, share an endpoint or overlap are
+ *               considered to intersect. If segments is a cell array, then
+ *               this is a numSetsX1 cell array of the pairs in each set.
+ *        points A 2XnumPairs matrix of points where the pairs of segments
+ *               intersect. For overlapping segments, this is the leftmost
+ *               point of the overlap (the lowest point for vertical
+ *               segments). If segments is a cell array, then this is a
+ *               numSetsX1 cell array.
+ *
+ *Whether segments intersect is determined exactly using an adaptive
+ *precision orientation predicate; only the points where segments properly
+ *cross are subject to rounding. See the comments in
+ *segmentIntersectionsCPP.cpp for details. If the code is compiled with
+ *OpenMP support, then multiple sets of segments are processed in
+ *parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[pairs,points]=segmentIntersections2D(segments);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy
+#include <algorithm>
+#include <vector>
+#include "MexValidation.h"
+#include "mathGeometricFuncs.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    const bool isCellArray=nrhs==1&&mxIsCell(prhs[0]);
+    size_t numSets, i;
+    vector<const double*> segmentSets;
+    vector<size_t> numSegments;
+    vector<vector<size_t> > pairs;
+    vector<vector<double> > points;
+    mxArray *pairsMATLAB, *pointsMATLAB;
+
+    if(nrhs!=1) {
+        mexErrMsgTxt("Incorrect number of inputs.");
+    }
+
+    if(nlhs>2) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    numSets=isCellArray?mxGetNumberOfElements(prhs[0]):1;
+    segmentSets.resize(numSets);
+    numSegments.resize(numSets);
+    for(i=0;i<numSets;i++) {
+        const mxArray *curSet=isCellArray?mxGetCell(prhs[0],i):prhs[0];
+        size_t numEls;
+
+        if(curSet==NULL||mxIsEmpty(curSet)) {
+            segmentSets[i]=NULL;
+            numSegments[i]=0;
+            continue;
+        }
+
+        checkRealDoubleHypermatrix(curSet);
+        numEls=mxGetNumberOfElements(curSet);
+        if(mxGetNumberOfDimensions(curSet)==2?mxGetM(curSet)!=4:(mxGetDimensions(curSet)[0]!=2||mxGetDimensions(curSet)[1]!=2)) {
+            mexErrMsgTxt("The segments have the wrong dimensionality.");
+        }
+        segmentSets[i]=(double*)mxGetData(curSet);
+        numSegments[i]=numEls/4;
+    }
+
+    pairs.resize(numSets);
+    points.resize(numSets);
+
+    //The sets are independent, so they are processed in parallel if
+    //OpenMP is available.
+    {
+        ptrdiff_t curSet;
+
+        #pragma omp parallel for schedule(dynamic)
+        for(curSet=0;curSet<(ptrdiff_t)numSets;curSet++) {
+            segmentIntersectionsCPP(pairs[curSet],points[curSet],segmentSets[curSet],numSegments[curSet]);
+        }
+    }
+
+    pairsMATLAB=isCellArray?mxCreateCellMatrix(numSets,1):NULL;
+    pointsMATLAB=isCellArray?mxCreateCellMatrix(numSets,1):NULL;
+    for(i=0;i<numSets;i++) {
+        const size_t numPairs=pairs[i].size()/2;
+        mxArray *curPairs=mxCreateDoubleMatrix(2,numPairs,mxREAL);
+        mxArray *curPoints=mxCreateDoubleMatrix(2,numPairs,mxREAL);
+        double *pairData=(double*)mxGetData(curPairs);
+        size_t j;
+
+        for(j=0;j<2*numPairs;j++) {
+            //Convert to Matlab indexation.
+            pairData[j]=(double)(pairs[i][j]+1);
+        }
+        copy(points[i].begin(),points[i].end(),(double*)mxGetData(curPoints));
+
+        if(isCellArray) {
+            mxSetCell(pairsMATLAB,i,curPairs);
+            mxSetCell(pointsMATLAB,i,curPoints);
+        } else {
+            pairsMATLAB=curPairs;
+            pointsMATLAB=curPoints;
+        }
+    }
+
+    plhs[0]=pairsMATLAB;
+    if(nlhs>1) {
+        plhs[1]=pointsMATLAB;
+    } else {
+        mxDestroyArray(pointsMATLAB);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
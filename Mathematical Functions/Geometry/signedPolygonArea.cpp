@@ -9,15 +9,21 @@
  *INPUTS: vertices A 2XN list of the N vertices of the polygon in order
  *                 around the polygon. Duplicate vertices are allowed. It
  *                 does not matter whether or not the first vertex is
- *                 repeated at the end.
+ *                 repeated at the end. Alternatively, this can be a
+ *                 numPolyX1 or 1XnumPoly cell array of such matrices, in
+ *                 which case the areas of all of the polygons are found.
  *
- *OUTPUTS:       A The signed area of the polygon.
+ *OUTPUTS:       A The signed area of the polygon, or a numPolyX1 vector
+ *                 of the signed areas if vertices is a cell array.
  *
  *The formula for computing the signed area of a non-self-intersecting is
  *taken from
  *Weisstein, Eric W. "Polygon Area." From MathWorld--A Wolfram Web 
  *Resource. http://mathworld.wolfram.com/PolygonArea.html
  *
+ *If the code is compiled with OpenMP support, then the areas of multiple
+ *polygons are computed in parallel.
+ *
  *The algorithm can be compiled for use in Matlab  using the 
  *CompileCLibraries function.
  *
@@ -49,6 +55,52 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]) {
         return;
     }
 
+    if(mxIsCell(prhs[0])) {
+        const size_t numPoly=mxGetNumberOfElements(prhs[0]);
+        mxArray *AMATLAB=mxCreateDoubleMatrix(numPoly,1,mxREAL);
+        double *areas=(double*)mxGetData(AMATLAB);
+        const double **polygons=new const double*[numPoly];
+        size_t *numPolyVertices=new size_t[numPoly];
+        size_t curPoly;
+
+        for(curPoly=0;curPoly<numPoly;curPoly++) {
+            const mxArray *polyMATLAB=mxGetCell(prhs[0],curPoly);
+
+            if(polyMATLAB==NULL||mxIsEmpty(polyMATLAB)) {
+                polygons[curPoly]=NULL;
+                numPolyVertices[curPoly]=0;
+                continue;
+            }
+
+            checkRealDoubleArray(polyMATLAB);
+            if(mxGetM(polyMATLAB)!=2) {
+                delete[] numPolyVertices;
+                delete[] polygons;
+                mxDestroyArray(AMATLAB);
+                mexErrMsgTxt("The points have the wrong dimensionality.");
+                return;
+            }
+            polygons[curPoly]=(double*)mxGetData(polyMATLAB);
+            numPolyVertices[curPoly]=mxGetN(polyMATLAB);
+        }
+
+        //The polygons are independent, so their areas are computed in
+        //parallel if OpenMP is available.
+        {
+            ptrdiff_t i;
+
+            #pragma omp parallel for
+            for(i=0;i<(ptrdiff_t)numPoly;i++) {
+                areas[i]=numPolyVertices[i]==0?0:signedPolygonAreaCPP(polygons[i],numPolyVertices[i]);
+            }
+        }
+
+        delete[] numPolyVertices;
+        delete[] polygons;
+        plhs[0]=AMATLAB;
+        return;
+    }
+
     checkRealDoubleArray(prhs[0]);
     
     //If an empty matrix is passed, return zero area.
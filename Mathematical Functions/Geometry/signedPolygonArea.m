@@ -10,9 +10,12 @@ function A=signedPolygonArea(vertices)
 %INPUTS: vertices A 2XN list of the N vertices of the polygon in order
 %                 around the polygon. Duplicate vertices are allowed. It
 %                 does not matter whether or not the first vertex is
-%                 repeated at the end.
+%                 repeated at the end. Alternatively, this can be a
+%                 numPolyX1 or 1XnumPoly cell array of such matrices, in
+%                 which case the areas of all of the polygons are found.
 %
-%OUTPUTS:       A The signed area of the polygon.
+%OUTPUTS:       A The signed area of the polygon, or a numPolyX1 vector
+%                 of the signed areas if vertices is a cell array.
 %
 %The formula for computing the signed area of a non-self-intersecting is
 %taken from
@@ -22,6 +25,15 @@ function A=signedPolygonArea(vertices)
 %December 2014 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
+if(iscell(vertices))
+    numPoly=numel(vertices);
+    A=zeros(numPoly,1);
+    for curPoly=1:numPoly
+        A(curPoly)=signedPolygonArea(vertices{curPoly});
+    end
+    return;
+end
+
 numVertices=size(vertices,2);
 
 A=0;
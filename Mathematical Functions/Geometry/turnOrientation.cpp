@@ -15,20 +15,6 @@
  *                  they are going clockwise and 0 if they are collinear or
  *                  if two of them coincide.
  * 
- *The implementation uses the long double datatype to provide a result with
- *lower finite precision errors in intermediate results then if everything
- *were done using doubles, since most compiler implement the long double as
- *an IEEE-754 double extended precision datatype. Additionally, the
- *function exactSignOfSumCPP is used to provide the sign of an error-free
- *sum. Unfortunately, since the IEEE-754 double extended precision datatype
- *only provides a 64-bit mantissa, which is not much of an extension over
- *the 54-bit mantissa of a standard double precision floating point number,
- *and is not enough to assure no finite precision rounding in the products
- *that go into the sum, cannot guarantee zero finite precision errors in
- *this function. On the other hand, if the inputs are single-precision
- *(promoted to doubles, since the function does not take singles) floating
- *point numbers, the result is exact.
- *
  *The cross product rule for 3D vectors a and b says that
  *norm(cross(a,b))=norm(a)*norm(b)*sin(theta)
  *where theta is the positive angle between the vectors. However, If the
@@ -36,9 +22,18 @@
  *only have one nonzero component in the z-direction and that component is
  *equal to det([a,b]) (for 2D a and b). The interesting thing now, is that
  *the sign of the determinant will tell you whether the subsequent vectors
- *are going counterclockwise or clockwise. This function returns -1 if the
- *vectors are going counterclockwise, 0 if they are exactly collinear and 1
- *if they are clockwise.
+ *are going counterclockwise or clockwise. This function returns 1 if the
+ *vectors are going counterclockwise, 0 if they are exactly collinear and
+ *-1 if they are clockwise.
+ *
+ *The sign of the determinant is found using the function orient2DBatchCPP
+ *in geometricPredicatesCPP.cpp. The determinant is evaluated in double
+ *precision arithmetic and the result is accepted if it exceeds a bound on
+ *the finite precision error. Otherwise, which only happens when the points
+ *are nearly collinear, the determinant is evaluated exactly using floating
+ *point expansion arithmetic. Thus, the result is always correct, barring
+ *overflow or underflow. If the code is compiled with OpenMP support, then
+ *the vertex sets are processed in parallel.
  *
  *The algorithm can be compiled for use in Matlab  using the 
  *CompileCLibraries function.
@@ -54,10 +49,7 @@
 /* This header validates inputs and includes a header needed to handle
  * Matlab matrices.*/
 #include "MexValidation.h"
-#include "exactSignOfSumCPP.hpp"
-
-//Prototype
-int turnOrientationCPP(const double *P1, const double *P2, const double *P3);
+#include "mathGeometricFuncs.hpp"
 
 void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
     size_t i, M, numElements;
@@ -104,26 +96,11 @@ void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray
     retMat=mxCreateDoubleMatrix(numElements,1,mxREAL);
     retVals=(double*)mxGetData(retMat);
     
-    for(i=0;i<numElements;i++) {
-        retVals[i]=(double)turnOrientationCPP(P1+2*i,P2+2*i,P3+2*i);
-    }
+    orient2DBatchCPP(retVals,P1,P2,P3,numElements);
     //Set the return value.
     plhs[0]=retMat;
 }
 
-int turnOrientationCPP(const double *P1, const double *P2, const double *P3) {
-    long double S[6];
-
-    S[0]= (long double)P3[0]*(long double)P1[1];
-    S[1]= (long double)P1[0]*(long double)P2[1];
-    S[2]= (long double)P2[0]*(long double)P3[1];
-    S[3]= -(long double)P3[0]*(long double)P2[1];
-    S[4]= -(long double)P1[0]*(long double)P3[1];
-    S[5]= -(long double)P2[0]*(long double)P1[1];
-    //The sum of the S components is the determinant.
-    return exactSignOfSumCPP(S,6);    
-}
-
 /*LICENSE:
 %
 %The source code is in the public domain and not licensed or under
@@ -51,6 +51,10 @@ function [retPath,retDist,cycleNodes]=BellmanFordAlg(adjMat,sourceIdx,destIdx)
 %where the extraction of a negative cost cycle accessible from the source
 %is added when a negative cost cycle is detected.
 %
+%For large sparse graphs, the compiled function BellmanFordAlgSparse takes
+%the same inputs, including Matlab sparse adjacency matrices, and only
+%relaxes the edges that are present.
+%
 %Ad an example, consider the adjacency matric with two negative cost
 %cycles:
 % adjMat=[Inf,    -20,    Inf;
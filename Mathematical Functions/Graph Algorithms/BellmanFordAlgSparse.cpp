@@ -0,0 +1,156 @@
+/**BELLMANFORDALGSPARSE Find the shortest paths from a source vertex
+ *                   through a large sparse graph whose edge costs can be
+ *                   negative. If a negative cycle is reachable from the
+ *                   source, then that cycle is returned. This is a
+ *                   compiled alternative to BellmanFordAlg that only
+ *                   visits the edges that are present in the graph.
+ *
+ *INPUTS: adjMat An numVerticesXnumVertices adjacency matrix of costs for
+ *               the graph. adjMat(i,j) is the cost of going from vertex i
+ *               to vertex j. This can be a full matrix, where Inf means
+ *               that there is no edge, as in BellmanFordAlg, or a Matlab
+ *               sparse matrix, where only the stored elements are edges.
+ *               Matlab does not store zeros in sparse matrices, so edges
+ *               of zero cost can only be given in a full matrix.
+ *     sourceIdx The index of the vertex from which the shortest paths are
+ *               desired.
+ *       destIdx The index of the destination vertex. If this parameter is
+ *               provided and is not the empty matrix, then the path of
+ *               vertices from the source to the destination is returned
+ *               along with the path length. Otherwise, information
+ *               allowing one to reconstruct all of the paths is returned.
+ *
+ *OUTPUTS: retPath If destIdx is given, this is the minimum cost sequence
+ *                 of vertices to get from sourceIdx to destIdx, including
+ *                 the end vertices; if there is no path, an empty matrix
+ *                 is returned. Otherwise, this is prevNodes, where
+ *                 prevNodes(idx) is the vertex before vertex idx on the
+ *                 shortest path, or 0 if there is no path to the vertex.
+ *                 If a negative cycle is reachable from the source, then
+ *                 an empty matrix is returned.
+ *         retDist If destIdx is given, this is the shortest distance from
+ *                 the source to the destination. Otherwise, this is a
+ *                 numVerticesX1 vector of the shortest distances to all
+ *                 of the vertices. If a negative cycle is reachable from
+ *                 the source, then an empty matrix is returned.
+ *      cycleNodes If no negative cycle is reachable from the source, this
+ *                 is an empty matrix. Otherwise, this holds the vertices
+ *                 of the first negative cycle found in the order that they
+ *                 are traversed. The last vertex is connected back to the
+ *                 first.
+ *
+ *BellmanFordAlg relaxes every element of the adjacency matrix numVertices
+ *times. Here, the graph is converted to compressed sparse row form and the
+ *queue-based form of the algorithm is used, where only the edges leaving
+ *vertices whose distances have changed are relaxed, as described in
+ *CSRGraphCPP.cpp. When several paths have the same cost, the path found
+ *can differ from that of BellmanFordAlg, as can the negative cycle found
+ *if there are several.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[retPath,retDist,cycleNodes]=BellmanFordAlgSparse(adjMat,sourceIdx,destIdx);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include <vector>
+#include "MexValidation.h"
+#include "graphFuncs.hpp"
+#include "CSRGraphMatlab.h"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    CSRGraphCPP graph;
+    size_t numVertices, sourceIdx, i;
+    vector<double> dist;
+    vector<size_t> prevNodes, cycleNodes;
+    mxArray *cycleMATLAB;
+
+    if(nrhs<2) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>3) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>3) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    CSRGraphFromMatlab(graph,prhs[0]);
+    numVertices=graph.numVertices;
+    sourceIdx=getVertexIdxFromMatlab(prhs[1],numVertices);
+
+    dist.resize(numVertices);
+    prevNodes.resize(numVertices);
+
+    if(!shortestPathSPFACPP(&dist[0],&prevNodes[0],cycleNodes,graph,sourceIdx)) {
+        plhs[0]=mxCreateDoubleMatrix(0,0,mxREAL);
+        if(nlhs>1) {
+            plhs[1]=mxCreateDoubleMatrix(0,0,mxREAL);
+
+            if(nlhs>2) {
+                double *cycleData;
+
+                cycleMATLAB=mxCreateDoubleMatrix(cycleNodes.size(),1,mxREAL);
+                cycleData=mxGetPr(cycleMATLAB);
+                for(i=0;i<cycleNodes.size();i++) {
+                    cycleData[i]=(double)(cycleNodes[i]+1);
+                }
+                plhs[2]=cycleMATLAB;
+            }
+        }
+        return;
+    }
+
+    if(nrhs>2&&!mxIsEmpty(prhs[2])) {
+        const size_t destIdx=getVertexIdxFromMatlab(prhs[2],numVertices);
+
+        if(prevNodes[destIdx]==numVertices&&destIdx!=sourceIdx) {
+            //There is no path to the destination.
+            plhs[0]=mxCreateDoubleMatrix(0,0,mxREAL);
+        } else {
+            plhs[0]=pathFromPrevNodes(&prevNodes[0],sourceIdx,destIdx);
+        }
+
+        if(nlhs>1) {
+            plhs[1]=mxCreateDoubleScalar(dist[destIdx]);
+        }
+    } else {
+        plhs[0]=mxCreateDoubleMatrix(numVertices,1,mxREAL);
+        prevNodesToMatlab(mxGetPr(plhs[0]),&prevNodes[0],numVertices,numVertices);
+
+        if(nlhs>1) {
+            plhs[1]=doubleMat2Matlab(&dist[0],numVertices,1);
+        }
+    }
+
+    if(nlhs>2) {
+        plhs[2]=mxCreateDoubleMatrix(0,0,mxREAL);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -59,6 +59,10 @@ function [retPath,retDist]=DijkstraAlg(adjMat,sourceIdx,destIdx,allowNegCosts)
 %from the source, one wishes to find the vertices in the cycle, then the
 %function BellmanFordAlg should be used instead of this one.
 %
+%For large sparse graphs, the compiled function DijkstraAlgSparse takes
+%the same inputs, including Matlab sparse adjacency matrices, and only
+%visits the edges that are present.
+%
 %The algorithm can be demonstrated on the same problem given in Figure 8 of
 %G. D. Forney Jr., "The Viterbi algorithm," Proceedings of the IEEE,
 %vol. 61, no. 3, pp. 268-278, Mar. 1973.
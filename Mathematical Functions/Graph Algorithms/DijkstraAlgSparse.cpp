@@ -0,0 +1,196 @@
+/**DIJKSTRAALGSPARSE Find the shortest paths from one or more source
+ *                   vertices through a large sparse graph. This is a
+ *                   compiled alternative to DijkstraAlg that only visits
+ *                   the edges that are present in the graph.
+ *
+ *INPUTS: adjMat An numVerticesXnumVertices adjacency matrix of costs for
+ *               the graph. adjMat(i,j) is the cost of going from vertex i
+ *               to vertex j. This can be a full matrix, where Inf means
+ *               that there is no edge, as in DijkstraAlg, or a Matlab
+ *               sparse matrix, where only the stored elements are edges.
+ *               Matlab does not store zeros in sparse matrices, so edges
+ *               of zero cost can only be given in a full matrix.
+ *     sourceIdx The index of the vertex from which the shortest paths are
+ *               desired. If destIdx is omitted or empty, this can be a
+ *               vector of numSources source vertices.
+ *       destIdx The index of the destination vertex. If this parameter is
+ *               provided and is not the empty matrix, then the path of
+ *               vertices from the source to the destination is returned
+ *               along with the path length. Otherwise, information
+ *               allowing one to reconstruct all of the paths is returned.
+ * allowNegCosts A boolean variable indicating whether negative edge costs
+ *               are allowed. If true, the queue-based Bellman-Ford
+ *               algorithm is used, which detects negative cycles. If
+ *               false, Dijkstra's algorithm with a binary heap is used,
+ *               which is faster, but returns incorrect results if
+ *               negative costs are present. As in DijkstraAlg, if this
+ *               parameter is omitted or an empty matrix is passed, the
+ *               default of true is used.
+ *
+ *OUTPUTS: retPath If destIdx is given, this is the minimum cost sequence
+ *                 of vertices to get from sourceIdx to destIdx, including
+ *                 the end vertices; if there is no path, an empty matrix
+ *                 is returned. Otherwise, this is the
+ *                 numVerticesXnumSources matrix prevNodes, where
+ *                 prevNodes(idx,k) is the vertex before vertex idx on the
+ *                 shortest path from sourceIdx(k), or 0 if there is no
+ *                 path to the vertex. If a negative cycle is reachable
+ *                 from a source, then an empty matrix is returned.
+ *         retDist If destIdx is given, this is the shortest distance from
+ *                 the source to the destination. If destIdx is not given,
+ *                 then this is the numVerticesXnumSources matrix of the
+ *                 shortest distances from each source to every vertex. If
+ *                 a negative cycle is reachable from a source, then an
+ *                 empty matrix is returned.
+ *
+ *DijkstraAlg scans a full row of the adjacency matrix for every vertex
+ *visited, so its complexity is at least quadratic in the number of
+ *vertices. Here, the graph is converted to compressed sparse row form and
+ *only the edges that are present are scanned, as described in
+ *CSRGraphCPP.cpp. When multiple sources are given, the shortest paths from
+ *all of them, which for all vertices as sources is the all-pairs problem
+ *of findAllPairsShortestPath, are found in parallel if the code is
+ *compiled with OpenMP support. To find the vertices of a negative cycle,
+ *use BellmanFordAlgSparse.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[retPath,retDist]=DijkstraAlgSparse(adjMat,sourceIdx,destIdx,allowNegCosts);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include <vector>
+#include "MexValidation.h"
+#include "graphFuncs.hpp"
+#include "CSRGraphMatlab.h"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    CSRGraphCPP graph;
+    size_t numVertices, numSources, i;
+    size_t *sourceIdx;
+    bool allowNegCosts=true;
+    bool hasDest=false;
+    bool hasNegCycle=false;
+    size_t destIdx=0;
+    vector<double> dist;
+    vector<size_t> prevNodes;
+
+    if(nrhs<2) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>4) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>2) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    CSRGraphFromMatlab(graph,prhs[0]);
+    numVertices=graph.numVertices;
+
+    if(nrhs>2&&!mxIsEmpty(prhs[2])) {
+        hasDest=true;
+        destIdx=getVertexIdxFromMatlab(prhs[2],numVertices);
+    }
+
+    if(nrhs>3&&!mxIsEmpty(prhs[3])) {
+        allowNegCosts=getBoolFromMatlab(prhs[3]);
+    }
+
+    sourceIdx=copySizeTArrayFromMatlab(prhs[1],&numSources);
+    if(numSources==0||(hasDest&&numSources!=1)) {
+        mxFree(sourceIdx);
+        mexErrMsgTxt("A single source vertex must be given if destIdx is given.");
+    }
+    for(i=0;i<numSources;i++) {
+        if(sourceIdx[i]<1||sourceIdx[i]>numVertices) {
+            mxFree(sourceIdx);
+            mexErrMsgTxt("A vertex index is out of range.");
+        }
+        sourceIdx[i]--;
+    }
+
+    dist.resize(numVertices*numSources);
+    prevNodes.resize(numVertices*numSources);
+
+    //The sources are independent, so they are processed in parallel if
+    //OpenMP is available.
+    {
+        ptrdiff_t curSource;
+
+        #pragma omp parallel for schedule(dynamic)
+        for(curSource=0;curSource<(ptrdiff_t)numSources;curSource++) {
+            double *curDist=&dist[curSource*numVertices];
+            size_t *curPrev=&prevNodes[curSource*numVertices];
+
+            if(allowNegCosts) {
+                vector<size_t> cycleNodes;
+
+                if(!shortestPathSPFACPP(curDist,curPrev,cycleNodes,graph,sourceIdx[curSource])) {
+                    #pragma omp critical(DijkstraAlgSparseNegCycle)
+                    hasNegCycle=true;
+                }
+            } else {
+                DijkstraCSRCPP(curDist,curPrev,graph,sourceIdx[curSource]);
+            }
+        }
+    }
+
+    if(hasNegCycle) {
+        mxFree(sourceIdx);
+        plhs[0]=mxCreateDoubleMatrix(0,0,mxREAL);
+        if(nlhs>1) {
+            plhs[1]=mxCreateDoubleMatrix(0,0,mxREAL);
+        }
+        return;
+    }
+
+    if(hasDest) {
+        if(prevNodes[destIdx]==numVertices&&destIdx!=sourceIdx[0]) {
+            //There is no path to the destination.
+            plhs[0]=mxCreateDoubleMatrix(0,0,mxREAL);
+        } else {
+            plhs[0]=pathFromPrevNodes(&prevNodes[0],sourceIdx[0],destIdx);
+        }
+
+        if(nlhs>1) {
+            plhs[1]=mxCreateDoubleScalar(dist[destIdx]);
+        }
+    } else {
+        plhs[0]=mxCreateDoubleMatrix(numVertices,numSources,mxREAL);
+        prevNodesToMatlab(mxGetPr(plhs[0]),&prevNodes[0],numVertices*numSources,numVertices);
+
+        if(nlhs>1) {
+            plhs[1]=doubleMat2Matlab(&dist[0],numVertices,numSources);
+        }
+    }
+
+    mxFree(sourceIdx);
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,321 @@
+/**CSRGRAPHCPP C++ implementations of shortest path and strongly connected
+ *             component algorithms for large sparse graphs that are
+ *             stored in compressed sparse row (CSR) form.
+ *
+ *The Matlab functions DijkstraAlg, BellmanFordAlg and
+ *findStronglyConnectedSubgraphs scan a full row of the adjacency matrix
+ *for every vertex visited, so their complexity is at least quadratic in
+ *the number of vertices even when each vertex only has a few edges. Here,
+ *only the edges that are present are visited.
+ *
+ *DijkstraCSRCPP is Dijkstra's algorithm as described in Chapter 9.3.2 of
+ *M.A.Weiss, Data Structures and Algorithm Analysis in C++, 2nd ed.
+ *Reading, MA: Addison-Wesley, 1999.
+ *using the indexed binary heap of BinaryHeapOfIndicesCPP, so its
+ *complexity is O((numVertices+numEdges)*log(numVertices)).
+ *
+ *shortestPathSPFACPP is the queue-based version of the Bellman-Ford
+ *algorithm, also known as the shortest path faster algorithm (SPFA),
+ *which is described in Chapter 9.3.3 of Weiss. Only vertices whose
+ *distance changed are put back in the queue, so it is usually much faster
+ *than the O(numVertices*numEdges) worst case. The number of edges on the
+ *path to each vertex is tracked. A path with at least numVertices edges
+ *must repeat a vertex, which can only happen if a negative cycle is
+ *reachable. Whenever the path length reaches a multiple of numVertices,
+ *the chain of previous vertices is checked for a cycle; any cycle in that
+ *chain has a negative cost, as shown in Lemma 24.17 of
+ *T. H. Cormen, C. E. Leiserson, R. L. Rivest, and C. Stein, Introduction
+ *to Algorithms, 2nd ed. Cambridge, MA: The MIT Press, 2001.
+ *
+ *stronglyConnectedCSRCPP is the path-based algorithm of
+ *J. Cheriyan and K. Mehlhorn, "Algorithms for dense graphs and
+ *networks on the random access computer," Algorithmica, vol. 15, no. 6,
+ *pp. 521-549, Jun. 1996.
+ *which is what findStronglyConnectedSubgraphs implements. The recursion
+ *of the depth-first search is replaced with an explicit stack, since a
+ *graph with 10^6 vertices can produce a recursion that is too deep for
+ *the call stack. The vertices and the edges are visited in the same order
+ *as in findStronglyConnectedSubgraphs, so the results are identical.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For fill
+#include <algorithm>
+//For infinity
+#include <limits>
+#include <queue>
+#include "graphFuncs.hpp"
+#include "BinaryHeapOfIndicesCPP.hpp"
+
+using namespace std;
+
+//Prototypes for the helper functions.
+bool findPrevNodeCycle(vector<size_t> &cycleNodes,vector<size_t> &stamp,const size_t *prevNodes,const size_t startIdx,const size_t numVertices,const size_t curStamp);
+
+void CSRGraphCPP::initFromAdjMat(const double *adjMat,const size_t n) {
+    const double inf=numeric_limits<double>::infinity();
+    size_t i, j;
+
+    numVertices=n;
+    rowStart.resize(n+1);
+    colIdx.clear();
+    costs.clear();
+
+    rowStart[0]=0;
+    for(i=0;i<n;i++) {
+        for(j=0;j<n;j++) {
+            const double curCost=adjMat[i+j*n];
+
+            if(curCost!=inf) {
+                colIdx.push_back(j);
+                costs.push_back(curCost);
+            }
+        }
+        rowStart[i+1]=colIdx.size();
+    }
+}
+
+void CSRGraphCPP::initFromEdgeList(const size_t n,const size_t numEdges,const size_t *fromIdx,const size_t *toIdx,const double *edgeCosts) {
+    vector<size_t> nextPos(n);
+    size_t i;
+
+    numVertices=n;
+    rowStart.assign(n+1,0);
+    colIdx.resize(numEdges);
+    costs.resize(numEdges);
+
+    //A counting sort of the edges by the vertex that they leave.
+    for(i=0;i<numEdges;i++) {
+        rowStart[fromIdx[i]+1]++;
+    }
+    for(i=0;i<n;i++) {
+        rowStart[i+1]+=rowStart[i];
+        nextPos[i]=rowStart[i];
+    }
+    for(i=0;i<numEdges;i++) {
+        const size_t pos=nextPos[fromIdx[i]]++;
+
+        colIdx[pos]=toIdx[i];
+        costs[pos]=edgeCosts[i];
+    }
+}
+
+void DijkstraCSRCPP(double *dist,size_t *prevNodes,const CSRGraphCPP &graph,const size_t sourceIdx) {
+    const size_t numVertices=graph.numVertices;
+    BinaryHeapOfIndicesCPP nodeHeap(numVertices);
+    vector<bool> visitedNodes(numVertices,false);
+
+    fill(dist,dist+numVertices,numeric_limits<double>::infinity());
+    fill(prevNodes,prevNodes+numVertices,numVertices);
+
+    dist[sourceIdx]=0;
+    nodeHeap.insert(0,sourceIdx);
+    while(!nodeHeap.isEmpty()) {
+        //Get the least-cost vertex that has not been visited yet.
+        const size_t nodeIdxMin=nodeHeap.deleteTop();
+        const double dist2Min=dist[nodeIdxMin];
+        size_t curEdge;
+
+        visitedNodes[nodeIdxMin]=true;
+        for(curEdge=graph.rowStart[nodeIdxMin];curEdge<graph.rowStart[nodeIdxMin+1];curEdge++) {
+            const size_t destNode=graph.colIdx[curEdge];
+            const double alt=dist2Min+graph.costs[curEdge];
+
+            if(!visitedNodes[destNode]&&alt<dist[destNode]) {
+                dist[destNode]=alt;
+                prevNodes[destNode]=nodeIdxMin;
+                //This inserts the node if it is not in the heap.
+                nodeHeap.changeIndexedKey(alt,destNode);
+            }
+        }
+    }
+}
+
+bool shortestPathSPFACPP(double *dist,size_t *prevNodes,vector<size_t> &cycleNodes,const CSRGraphCPP &graph,const size_t sourceIdx) {
+    const size_t numVertices=graph.numVertices;
+    queue<size_t> nodeQueue;
+    vector<bool> inQueue(numVertices,false);
+    //The number of edges on the current path to each vertex.
+    vector<size_t> pathLength(numVertices,0);
+    vector<size_t> stamp(numVertices,0);
+    size_t curStamp=0;
+
+    cycleNodes.clear();
+    fill(dist,dist+numVertices,numeric_limits<double>::infinity());
+    fill(prevNodes,prevNodes+numVertices,numVertices);
+
+    dist[sourceIdx]=0;
+    nodeQueue.push(sourceIdx);
+    inQueue[sourceIdx]=true;
+    while(!nodeQueue.empty()) {
+        const size_t curNode=nodeQueue.front();
+        size_t curEdge;
+
+        nodeQueue.pop();
+        inQueue[curNode]=false;
+
+        for(curEdge=graph.rowStart[curNode];curEdge<graph.rowStart[curNode+1];curEdge++) {
+            const size_t destNode=graph.colIdx[curEdge];
+            const double alt=dist[curNode]+graph.costs[curEdge];
+
+            if(alt<dist[destNode]) {
+                dist[destNode]=alt;
+                prevNodes[destNode]=curNode;
+                pathLength[destNode]=pathLength[curNode]+1;
+
+                if(pathLength[destNode]%numVertices==0) {
+                    curStamp++;
+                    if(findPrevNodeCycle(cycleNodes,stamp,prevNodes,destNode,numVertices,curStamp)) {
+                        return false;
+                    }
+                }
+
+                if(!inQueue[destNode]) {
+                    nodeQueue.push(destNode);
+                    inQueue[destNode]=true;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+bool findPrevNodeCycle(vector<size_t> &cycleNodes,vector<size_t> &stamp,const size_t *prevNodes,const size_t startIdx,const size_t numVertices,const size_t curStamp) {
+/*FINDPREVNODECYCLE Follow the chain of previous vertices from startIdx.
+ *                  If it loops, put the vertices of the loop in
+ *                  cycleNodes in the order of the edges and return true.
+ *                  The vertices visited are marked in stamp with
+ *                  curStamp.
+ */
+    size_t curNode=startIdx;
+
+    while(curNode!=numVertices&&stamp[curNode]!=curStamp) {
+        stamp[curNode]=curStamp;
+        curNode=prevNodes[curNode];
+    }
+
+    if(curNode==numVertices) {
+        return false;
+    }
+
+    //curNode is on the cycle. Following the previous vertices traverses
+    //the cycle backwards, so the order is reversed at the end.
+    {
+        const size_t cycleStart=curNode;
+
+        do {
+            cycleNodes.push_back(curNode);
+            curNode=prevNodes[curNode];
+        } while(curNode!=cycleStart);
+    }
+    reverse(cycleNodes.begin(),cycleNodes.end());
+
+    return true;
+}
+
+size_t stronglyConnectedCSRCPP(size_t *setStart,size_t *setIdx,const CSRGraphCPP &graph) {
+    const size_t numVertices=graph.numVertices;
+    //The stacks of the algorithm. The stack of the depth-first search
+    //holds each vertex being explored along with the position of the next
+    //edge of the vertex to explore.
+    vector<size_t> unfinished, roots, dfsStackNode, dfsStackEdge;
+    vector<bool> inUnfinished(numVertices,false);
+    vector<bool> reached(numVertices,false);
+    vector<size_t> dfsNum(numVertices,0);
+    size_t count1=0, totalInSetIdxList=0, numSets=0;
+    size_t v0;
+
+    unfinished.reserve(numVertices);
+    roots.reserve(numVertices);
+
+    for(v0=0;v0<numVertices;v0++) {
+        if(reached[v0]) {
+            continue;
+        }
+
+        //Start a depth-first search at v0.
+        count1++;
+        dfsNum[v0]=count1;
+        reached[v0]=true;
+        unfinished.push_back(v0);
+        inUnfinished[v0]=true;
+        roots.push_back(v0);
+        dfsStackNode.push_back(v0);
+        dfsStackEdge.push_back(graph.rowStart[v0]);
+
+        while(!dfsStackNode.empty()) {
+            const size_t v=dfsStackNode.back();
+            const size_t curEdge=dfsStackEdge.back();
+
+            if(curEdge<graph.rowStart[v+1]) {
+                const size_t w=graph.colIdx[curEdge];
+
+                dfsStackEdge.back()++;
+                if(!reached[w]) {
+                    count1++;
+                    dfsNum[w]=count1;
+                    reached[w]=true;
+                    unfinished.push_back(w);
+                    inUnfinished[w]=true;
+                    roots.push_back(w);
+                    dfsStackNode.push_back(w);
+                    dfsStackEdge.push_back(graph.rowStart[w]);
+                } else if(inUnfinished[w]) {
+                    //Merge the components.
+                    while(dfsNum[roots.back()]>dfsNum[w]) {
+                        roots.pop_back();
+                    }
+                }
+                continue;
+            }
+
+            //All of the edges of v have been explored.
+            if(v==roots.back()) {
+                //The root is listed first, followed by the other vertices
+                //of the subgraph in the order that they are popped.
+                setStart[numSets]=totalInSetIdxList;
+                numSets++;
+                setIdx[totalInSetIdxList]=v;
+                totalInSetIdxList++;
+
+                while(true) {
+                    const size_t w=unfinished.back();
+
+                    unfinished.pop_back();
+                    inUnfinished[w]=false;
+                    if(w==v) {
+                        break;
+                    }
+                    setIdx[totalInSetIdxList]=w;
+                    totalInSetIdxList++;
+                }
+                roots.pop_back();
+            }
+            dfsStackNode.pop_back();
+            dfsStackEdge.pop_back();
+        }
+    }
+
+    return numSets;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,152 @@
+/**CSRGRAPHMATLAB Functions for mex files that convert graphs and paths
+ *              between Matlab and the CSRGraphCPP class so that all of the
+ *              mex files using the class accept and return them in the
+ *              same manner.
+ *
+ *The function CSRGraphFromMatlab sets up graph from an adjacency matrix
+ *adjMat, where adjMat(i,j) is the cost of the edge from vertex i to vertex
+ *j, as in the Matlab functions DijkstraAlg and BellmanFordAlg. adjMat can
+ *be a full matrix, where Inf means that there is no edge, or a Matlab
+ *sparse matrix, where only the elements that are stored are edges. Since
+ *Matlab does not store zeros in sparse matrices, edges with zero cost can
+ *only be given in a full matrix. Stored elements that are Inf are not
+ *taken to be edges either.
+ *
+ *The function getVertexIdxFromMatlab reads a vertex index, starting from
+ *1, and returns it starting from 0.
+ *
+ *The function pathFromPrevNodes returns a Matlab column vector of the
+ *vertices, starting from 1, on the path from sourceIdx to destIdx given
+ *the previous vertices found by DijkstraCSRCPP or shortestPathSPFACPP.
+ *The function prevNodesToMatlab copies numEl previous vertices of a graph
+ *with numVertices vertices into a Matlab array, adding 1 to each, so that
+ *vertices that have no previous vertex are 0, as in DijkstraAlg.
+ *
+ *An error is raised using mexErrMsgTxt if an input is invalid.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef CSRGRAPHMATLAB
+#define CSRGRAPHMATLAB
+//For reverse
+#include <algorithm>
+//For infinity
+#include <limits>
+#include <vector>
+#include "graphFuncs.hpp"
+#include "MexValidation.h"
+#include "mex.h"
+
+void CSRGraphFromMatlab(CSRGraphCPP &graph,const mxArray *adjMat) {
+    const double inf=std::numeric_limits<double>::infinity();
+    size_t n;
+
+    if(mxIsComplex(adjMat)||mxGetClassID(adjMat)!=mxDOUBLE_CLASS||mxGetNumberOfDimensions(adjMat)!=2) {
+        mexErrMsgTxt("The adjacency matrix must be a real matrix of doubles.");
+    }
+
+    n=mxGetM(adjMat);
+    if(n==0) {
+        mexErrMsgTxt("The adjacency matrix cannot be empty.");
+    }
+
+    if(mxGetN(adjMat)!=n) {
+        mexErrMsgTxt("The adjacency matrix must be square.");
+    }
+
+    if(mxIsSparse(adjMat)) {
+        const mwIndex *Jc=mxGetJc(adjMat);
+        const mwIndex *Ir=mxGetIr(adjMat);
+        const double *vals=mxGetPr(adjMat);
+        std::vector<size_t> fromIdx, toIdx;
+        std::vector<double> edgeCosts;
+        size_t j, curEl;
+
+        fromIdx.reserve(Jc[n]);
+        toIdx.reserve(Jc[n]);
+        edgeCosts.reserve(Jc[n]);
+
+        //The elements are stored by columns, so the edges leaving each
+        //vertex end up ordered by the vertex that they go to.
+        for(j=0;j<n;j++) {
+            for(curEl=Jc[j];curEl<Jc[j+1];curEl++) {
+                if(vals[curEl]!=inf) {
+                    fromIdx.push_back(Ir[curEl]);
+                    toIdx.push_back(j);
+                    edgeCosts.push_back(vals[curEl]);
+                }
+            }
+        }
+
+        if(edgeCosts.empty()) {
+            graph.initFromEdgeList(n,0,NULL,NULL,NULL);
+        } else {
+            graph.initFromEdgeList(n,edgeCosts.size(),&fromIdx[0],&toIdx[0],&edgeCosts[0]);
+        }
+    } else {
+        graph.initFromAdjMat(mxGetPr(adjMat),n);
+    }
+}
+
+size_t getVertexIdxFromMatlab(const mxArray *val,const size_t numVertices) {
+    const size_t idx=getSizeTFromMatlab(val);
+
+    if(idx<1||idx>numVertices) {
+        mexErrMsgTxt("A vertex index is out of range.");
+    }
+
+    return idx-1;
+}
+
+mxArray *pathFromPrevNodes(const size_t *prevNodes,const size_t sourceIdx,const size_t destIdx) {
+    std::vector<size_t> path;
+    mxArray *pathMATLAB;
+    double *pathData;
+    size_t curNode=destIdx;
+    size_t i;
+
+    path.push_back(curNode);
+    while(curNode!=sourceIdx) {
+        curNode=prevNodes[curNode];
+        path.push_back(curNode);
+    }
+    std::reverse(path.begin(),path.end());
+
+    pathMATLAB=mxCreateDoubleMatrix(path.size(),1,mxREAL);
+    pathData=mxGetPr(pathMATLAB);
+    for(i=0;i<path.size();i++) {
+        pathData[i]=(double)(path[i]+1);
+    }
+
+    return pathMATLAB;
+}
+
+void prevNodesToMatlab(double *prevNodesMATLAB,const size_t *prevNodes,const size_t numEl,const size_t numVertices) {
+    size_t i;
+
+    for(i=0;i<numEl;i++) {
+        prevNodesMATLAB[i]=prevNodes[i]==numVertices?0:(double)(prevNodes[i]+1);
+    }
+}
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,292 @@
+/**EUCLIDEANMSTCPP A C++ implementation of an algorithm to find the
+ *             minimum spanning tree of a set of points under the
+ *             Euclidean distance without forming the matrix of all
+ *             pairwise distances.
+ *
+ *The Matlab function minSpanningTreeFromPoints takes a full matrix of
+ *pairwise distances, so the memory and the computation grow
+ *quadratically with the number of points. Here, Boruvka's algorithm, as
+ *described in
+ *R. L. Graham and P. Hell, "On the history of the minimum spanning tree
+ *problem," Annals of the History of Computing, vol. 7, no. 1, pp. 43-57,
+ *Jan. 1985.
+ *is used. In each round, the shortest edge leaving every component of the
+ *forest built so far is found and all such edges are added, so at most
+ *log2(N) rounds are needed. The shortest edge leaving a component is found
+ *by searching a kd-tree (kdTreeCPP) for the nearest neighbor of every
+ *point of the component that is in a different component. A subtree of
+ *the kd-tree is skipped if its bounding box is farther away than the best
+ *point found so far or if all of its points are in the same component as
+ *the query point; the latter is what keeps the searches fast in later
+ *rounds, when the components are large. If the code is compiled with
+ *OpenMP support, then the searches for the points are run in parallel.
+ *
+ *To keep ties in the distances from creating cycles, edges are compared
+ *by their length, then by the lower and then the higher index of the
+ *points that they connect. The tree is returned with every point pointing
+ *to its parent, with the last point as the root, as in
+ *minSpanningTreeFromPoints.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For min, max and swap
+#include <algorithm>
+//For sqrt
+#include <cmath>
+//For infinity
+#include <limits>
+#include <vector>
+#include "graphFuncs.hpp"
+#include "kdTreeCPP.hpp"
+
+using namespace std;
+
+//Prototypes for the helper functions.
+size_t findSetRoot(vector<size_t> &setParent,size_t idx);
+bool edgeIsLess(const double dist1,const size_t a1,const size_t b1,const double dist2,const size_t a2,const size_t b2);
+void nearestOtherCompRecur(const kdTreeCPP &tree,const size_t curNode,const double *point,const size_t queryComp,const vector<size_t> &pointComp,const vector<size_t> &nodeComp,double &bestDist2,size_t &bestIdx);
+
+void EuclideanMSTCPP(size_t *parentIdx,double *edgeLengths,const double *points,const size_t numDim,const size_t N) {
+    if(N<2) {
+        return;
+    }
+
+    kdTreeCPP tree(numDim,N);
+    //The disjoint sets of the components and the component of every point
+    //and of every node of the tree. The component of a node is N if its
+    //subtree holds points of more than one component.
+    vector<size_t> setParent(N), pointComp(N), nodeComp(N);
+    vector<size_t> nnIdx(N), compBestPoint(N);
+    vector<double> nnDist2(N);
+    vector<size_t> edgeFrom, edgeTo;
+    vector<double> edgeDist2;
+    size_t numComps=N;
+    size_t i;
+
+    tree.buildTreeFromBatch(points);
+    for(i=0;i<N;i++) {
+        setParent[i]=i;
+    }
+
+    edgeFrom.reserve(N-1);
+    edgeTo.reserve(N-1);
+    edgeDist2.reserve(N-1);
+    while(numComps>1) {
+        for(i=0;i<N;i++) {
+            pointComp[i]=findSetRoot(setParent,i);
+        }
+
+        //The children of a node always have higher indices than the node,
+        //so the nodes can be processed from the last to the first.
+        for(i=N;i-->0;) {
+            size_t curComp=pointComp[tree.DATAIDX[i]];
+
+            if(tree.LOSON[i]!=-1&&nodeComp[(size_t)tree.LOSON[i]]!=curComp) {
+                curComp=N;
+            }
+            if(tree.HISON[i]!=-1&&nodeComp[(size_t)tree.HISON[i]]!=curComp) {
+                curComp=N;
+            }
+            nodeComp[i]=curComp;
+        }
+
+        //Find the nearest point in a different component for every point.
+        {
+            ptrdiff_t curPoint;
+
+            #pragma omp parallel for schedule(dynamic,64)
+            for(curPoint=0;curPoint<(ptrdiff_t)N;curPoint++) {
+                double bestDist2=numeric_limits<double>::infinity();
+                size_t bestIdx=N;
+
+                nearestOtherCompRecur(tree,0,points+numDim*curPoint,pointComp[curPoint],pointComp,nodeComp,bestDist2,bestIdx);
+                nnIdx[curPoint]=bestIdx;
+                nnDist2[curPoint]=bestDist2;
+            }
+        }
+
+        //The shortest edge leaving each component.
+        fill(compBestPoint.begin(),compBestPoint.end(),N);
+        for(i=0;i<N;i++) {
+            const size_t curComp=pointComp[i];
+            const size_t prevBest=compBestPoint[curComp];
+
+            if(prevBest==N||edgeIsLess(nnDist2[i],i,nnIdx[i],nnDist2[prevBest],prevBest,nnIdx[prevBest])) {
+                compBestPoint[curComp]=i;
+            }
+        }
+
+        //Add the edges. Two components can choose the same edge, so the
+        //components are checked again before merging.
+        for(i=0;i<N;i++) {
+            const size_t a=compBestPoint[i];
+            size_t rootA, rootB;
+
+            if(a==N) {
+                continue;
+            }
+
+            rootA=findSetRoot(setParent,a);
+            rootB=findSetRoot(setParent,nnIdx[a]);
+            if(rootA!=rootB) {
+                setParent[rootA]=rootB;
+                edgeFrom.push_back(a);
+                edgeTo.push_back(nnIdx[a]);
+                edgeDist2.push_back(nnDist2[a]);
+                numComps--;
+            }
+        }
+    }
+
+    //Root the tree at the last point using a breadth-first search.
+    {
+        CSRGraphCPP treeGraph;
+        const size_t numEdges=edgeFrom.size();
+        vector<size_t> fromIdx(2*numEdges), toIdx(2*numEdges);
+        vector<double> lengths(2*numEdges);
+        vector<size_t> visitOrder;
+        vector<bool> visited(N,false);
+        size_t curVisit;
+
+        for(i=0;i<numEdges;i++) {
+            const double curLength=sqrt(edgeDist2[i]);
+
+            fromIdx[2*i]=edgeFrom[i];
+            toIdx[2*i]=edgeTo[i];
+            fromIdx[2*i+1]=edgeTo[i];
+            toIdx[2*i+1]=edgeFrom[i];
+            lengths[2*i]=curLength;
+            lengths[2*i+1]=curLength;
+        }
+        treeGraph.initFromEdgeList(N,2*numEdges,&fromIdx[0],&toIdx[0],&lengths[0]);
+
+        visitOrder.reserve(N);
+        visitOrder.push_back(N-1);
+        visited[N-1]=true;
+        for(curVisit=0;curVisit<visitOrder.size();curVisit++) {
+            const size_t curNode=visitOrder[curVisit];
+            size_t curEdge;
+
+            for(curEdge=treeGraph.rowStart[curNode];curEdge<treeGraph.rowStart[curNode+1];curEdge++) {
+                const size_t child=treeGraph.colIdx[curEdge];
+
+                if(!visited[child]) {
+                    visited[child]=true;
+                    parentIdx[child]=curNode;
+                    edgeLengths[child]=treeGraph.costs[curEdge];
+                    visitOrder.push_back(child);
+                }
+            }
+        }
+    }
+}
+
+size_t findSetRoot(vector<size_t> &setParent,size_t idx) {
+/*FINDSETROOT Find the representative of the disjoint set containing idx
+ *            with path halving.
+ */
+    while(setParent[idx]!=idx) {
+        setParent[idx]=setParent[setParent[idx]];
+        idx=setParent[idx];
+    }
+
+    return idx;
+}
+
+bool edgeIsLess(const double dist1,const size_t a1,const size_t b1,const double dist2,const size_t a2,const size_t b2) {
+/*EDGEISLESS Compare the edge (a1,b1) of squared length dist1 to the edge
+ *           (a2,b2) of squared length dist2 using the length, then the
+ *           lower and then the higher index of the points.
+ */
+    if(dist1!=dist2) {
+        return dist1<dist2;
+    }
+
+    if(min(a1,b1)!=min(a2,b2)) {
+        return min(a1,b1)<min(a2,b2);
+    }
+
+    return max(a1,b1)<max(a2,b2);
+}
+
+void nearestOtherCompRecur(const kdTreeCPP &tree,const size_t curNode,const double *point,const size_t queryComp,const vector<size_t> &pointComp,const vector<size_t> &nodeComp,double &bestDist2,size_t &bestIdx) {
+/*NEARESTOTHERCOMPRECUR Search the subtree of the kd-tree at curNode for
+ *            the point closest to point that is not in component
+ *            queryComp. Ties are broken in favor of the lower index.
+ */
+    const size_t k=tree.k;
+    const double *BMin=tree.BMin+k*curNode;
+    const double *BMax=tree.BMax+k*curNode;
+    const size_t curIdx=tree.DATAIDX[curNode];
+    const double *curPoint=tree.data+k*curIdx;
+    const size_t disc=tree.DISC[curNode];
+    double boxDist2=0;
+    ptrdiff_t firstChild, secondChild;
+    size_t i;
+
+    if(nodeComp[curNode]==queryComp) {
+        return;
+    }
+
+    for(i=0;i<k;i++) {
+        double diff=0;
+
+        if(point[i]<BMin[i]) {
+            diff=BMin[i]-point[i];
+        } else if(point[i]>BMax[i]) {
+            diff=point[i]-BMax[i];
+        }
+        boxDist2+=diff*diff;
+    }
+    if(boxDist2>bestDist2) {
+        return;
+    }
+
+    if(pointComp[curIdx]!=queryComp) {
+        double curDist2=0;
+
+        for(i=0;i<k;i++) {
+            const double diff=point[i]-curPoint[i];
+            curDist2+=diff*diff;
+        }
+
+        if(curDist2<bestDist2||(curDist2==bestDist2&&curIdx<bestIdx)) {
+            bestDist2=curDist2;
+            bestIdx=curIdx;
+        }
+    }
+
+    //Visit the child on the same side of the split as the point first.
+    firstChild=tree.LOSON[curNode];
+    secondChild=tree.HISON[curNode];
+    if(point[disc]>=curPoint[disc]) {
+        swap(firstChild,secondChild);
+    }
+
+    if(firstChild!=-1) {
+        nearestOtherCompRecur(tree,(size_t)firstChild,point,queryComp,pointComp,nodeComp,bestDist2,bestIdx);
+    }
+    if(secondChild!=-1) {
+        nearestOtherCompRecur(tree,(size_t)secondChild,point,queryComp,pointComp,nodeComp,bestDist2,bestIdx);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
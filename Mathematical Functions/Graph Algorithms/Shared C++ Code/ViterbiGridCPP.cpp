@@ -0,0 +1,375 @@
+/**VITERBIGRIDCPP A C++ implementation of the Viterbi algorithm for
+ *              problems where the states at each step form a regular grid
+ *              and the transitions between states are the same
+ *              everywhere in the grid, as in dynamic programming
+ *              track-before-detect, where the states are the cells of a
+ *              sensor image (possibly with velocity dimensions) and a
+ *              target can move by a limited number of cells between
+ *              frames.
+ *
+ *The cost of a path through the frames is the sum of the costs of the
+ *states it visits (nodeCosts), which are typically negative
+ *log-likelihood ratios, and the costs of the transitions that it uses.
+ *Rather than giving a full numStatesXnumStates matrix of transition costs
+ *as in the Matlab function ViterbiAlg, the allowed transitions are given
+ *by a stencil: transition o goes from the state at grid position p to the
+ *state at p+offsets(:,o) with cost transCosts(o). Transitions leaving the
+ *grid are not allowed. The number of operations per frame is thus
+ *proportional to numStates*numOffsets rather than numStates^2.
+ *
+ *The states are stored with the first dimension of the grid varying
+ *fastest, as in Matlab. Each frame is processed line by line along the
+ *first dimension. For each offset, the valid range of destination states
+ *of a line comes from a single contiguous range of source states, so the
+ *inner loop is a simple min-plus operation over contiguous memory that
+ *the compiler can vectorize. If the code is compiled with OpenMP support,
+ *then the lines are processed in parallel. After each frame, the minimum
+ *cumulative cost is subtracted from all of the cumulative costs to keep
+ *them from growing large, as in ViterbiAlg; the subtracted values are
+ *added back at the end.
+ *
+ *The backpointers that are needed to recover the paths are stored as the
+ *index of the offset used to reach each state, which is a single byte if
+ *there are at most 255 offsets. Even so, for 10^5 or more states over many
+ *frames, storing all of the backpointers can take too much memory. Thus,
+ *the frames can be split into segments of segLength frames. Only the
+ *cumulative costs at the start of each segment are saved during the
+ *forward pass (checkpointing). When tracing the paths back, the
+ *backpointers of each segment are recomputed from its checkpoint. This
+ *costs about one additional forward pass and reduces the memory used to
+ *numStates*(8*numFrames/segLength+segLength*b) bytes, where b is the size
+ *of a backpointer, which is minimized by a segLength of about
+ *sqrt(8*numFrames/b). The recomputed backpointers are identical to those
+ *of the forward pass. The backpointers of the last segment are kept from
+ *the forward pass, so if segLength>=numFrames-1, no recomputation is done.
+ *
+ *When multiple paths have the same cost, the one using the lowest
+ *numbered offset at the latest frame is chosen. The node costs must not
+ *be -Inf or NaN, but they can be Inf to rule out states.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For fill, copy, min, max and swap
+#include <algorithm>
+//For infinity
+#include <limits>
+#include <vector>
+#include "graphFuncs.hpp"
+
+using namespace std;
+
+/*The ViterbiGridInfo class holds the description of the grid and the
+ *transitions and performs the recursion of the Viterbi algorithm for one
+ *frame.
+ */
+class ViterbiGridInfo {
+public:
+    const double *nodeCosts;
+    const size_t *gridDims;
+    size_t numDims;
+    size_t numStates;
+    //The length of the first dimension of the grid and the number of lines
+    //along the first dimension.
+    size_t lineLength;
+    size_t numLines;
+    const ptrdiff_t *offsets;
+    const double *transCosts;
+    size_t numOffsets;
+    //The change in the linear index of a state for each offset.
+    vector<ptrdiff_t> delta;
+
+    ViterbiGridInfo(const double *nodeCostsIn,const size_t *gridDimsIn,const size_t numDimsIn,const ptrdiff_t *offsetsIn,const double *transCostsIn,const size_t numOffsetsIn) : nodeCosts(nodeCostsIn), gridDims(gridDimsIn), numDims(numDimsIn), offsets(offsetsIn), transCosts(transCostsIn), numOffsets(numOffsetsIn), delta(numOffsetsIn,0) {
+        size_t curDim, curOffset, stride=1;
+
+        lineLength=gridDims[0];
+        numStates=1;
+        for(curDim=0;curDim<numDims;curDim++) {
+            numStates*=gridDims[curDim];
+        }
+        numLines=numStates/lineLength;
+
+        for(curDim=0;curDim<numDims;curDim++) {
+            for(curOffset=0;curOffset<numOffsets;curOffset++) {
+                delta[curOffset]+=offsets[curOffset*numDims+curDim]*(ptrdiff_t)stride;
+            }
+            stride*=gridDims[curDim];
+        }
+    }
+
+    template<typename T>
+    double step(double *cur,T *backPtr,const double *prev,const size_t frame) const;
+    double initialize(double *cur) const;
+};
+
+template<typename T>
+static void ViterbiGridRun(size_t *paths,double *pathCosts,double *finalCosts,const ViterbiGridInfo &info,const size_t numFrames,const size_t *endStates,const size_t numEnd,const size_t segLength);
+
+void ViterbiGridCPP(size_t *paths,double *pathCosts,double *finalCosts,const double *nodeCosts,const size_t numFrames,const size_t *gridDims,const size_t numDims,const ptrdiff_t *offsets,const double *transCosts,const size_t numOffsets,const size_t *endStates,const size_t numEnd,const size_t segLength) {
+/*VITERBIGRIDCPP Find the minimum cost paths through the grid of states.
+ *               The inputs and outputs are described in graphFuncs.hpp.
+ *               A path ending in a state that cannot be reached has an
+ *               infinite cost and all of the entries of the path are set
+ *               to numStates.
+ */
+    const ViterbiGridInfo info(nodeCosts,gridDims,numDims,offsets,transCosts,numOffsets);
+
+    //The smallest type that can hold the offset indices and an invalid
+    //value is used for the backpointers.
+    if(numOffsets<=0xFF) {
+        ViterbiGridRun<unsigned char>(paths,pathCosts,finalCosts,info,numFrames,endStates,numEnd,segLength);
+    } else if(numOffsets<=0xFFFF) {
+        ViterbiGridRun<unsigned short>(paths,pathCosts,finalCosts,info,numFrames,endStates,numEnd,segLength);
+    } else {
+        ViterbiGridRun<size_t>(paths,pathCosts,finalCosts,info,numFrames,endStates,numEnd,segLength);
+    }
+}
+
+double ViterbiGridInfo::initialize(double *cur) const {
+/*INITIALIZE Set the cumulative costs of the first frame and normalize
+ *           them, returning the value that was subtracted.
+ */
+    const double inf=numeric_limits<double>::infinity();
+    double minVal=inf;
+    size_t i;
+
+    copy(nodeCosts,nodeCosts+numStates,cur);
+    for(i=0;i<numStates;i++) {
+        if(cur[i]<minVal) {
+            minVal=cur[i];
+        }
+    }
+
+    if(minVal==inf) {
+        return 0;
+    }
+
+    for(i=0;i<numStates;i++) {
+        cur[i]-=minVal;
+    }
+    return minVal;
+}
+
+template<typename T>
+double ViterbiGridInfo::step(double *cur,T *backPtr,const double *prev,const size_t frame) const {
+/*STEP Compute the cumulative costs cur of the states in the given frame
+ *     from the cumulative costs prev of the previous frame, saving the
+ *     index of the best offset of each state in backPtr if it is not NULL.
+ *     The minimum cost is subtracted from the costs and returned.
+ */
+    const double inf=numeric_limits<double>::infinity();
+    const double *nodeCur=nodeCosts+numStates*frame;
+    double minVal=inf;
+
+    #pragma omp parallel
+    {
+        vector<size_t> coords(numDims,0);
+        double minLocal=inf;
+        ptrdiff_t curLine;
+
+        #pragma omp for schedule(static)
+        for(curLine=0;curLine<(ptrdiff_t)numLines;curLine++) {
+            const size_t base=(size_t)curLine*lineLength;
+            double *curVals=cur+base;
+            T *curBack=(backPtr==NULL)?NULL:backPtr+base;
+            size_t rem=(size_t)curLine;
+            size_t curDim, curOffset;
+            ptrdiff_t i;
+
+            //The position of the line in the other dimensions.
+            for(curDim=1;curDim<numDims;curDim++) {
+                coords[curDim]=rem%gridDims[curDim];
+                rem/=gridDims[curDim];
+            }
+
+            fill(curVals,curVals+lineLength,inf);
+            if(curBack!=NULL) {
+                fill(curBack,curBack+lineLength,(T)numOffsets);
+            }
+
+            for(curOffset=0;curOffset<numOffsets;curOffset++) {
+                const ptrdiff_t *off=offsets+curOffset*numDims;
+                const double c=transCosts[curOffset];
+                const ptrdiff_t srcBase=(ptrdiff_t)base-delta[curOffset];
+                ptrdiff_t lo, hi;
+
+                //Skip the offset if the source line is outside of the grid.
+                for(curDim=1;curDim<numDims;curDim++) {
+                    const ptrdiff_t srcCoord=(ptrdiff_t)coords[curDim]-off[curDim];
+
+                    if(srcCoord<0||srcCoord>=(ptrdiff_t)gridDims[curDim]) {
+                        break;
+                    }
+                }
+                if(curDim<numDims) {
+                    continue;
+                }
+
+                //The range of destinations on the line whose sources are
+                //on the grid.
+                lo=max((ptrdiff_t)0,off[0]);
+                hi=min((ptrdiff_t)lineLength,(ptrdiff_t)lineLength+off[0]);
+
+                if(curBack==NULL) {
+                    for(i=lo;i<hi;i++) {
+                        const double val=prev[srcBase+i]+c;
+
+                        curVals[i]=val<curVals[i]?val:curVals[i];
+                    }
+                } else {
+                    for(i=lo;i<hi;i++) {
+                        const double val=prev[srcBase+i]+c;
+
+                        if(val<curVals[i]) {
+                            curVals[i]=val;
+                            curBack[i]=(T)curOffset;
+                        }
+                    }
+                }
+            }
+
+            for(i=0;i<(ptrdiff_t)lineLength;i++) {
+                curVals[i]+=nodeCur[base+i];
+                if(curVals[i]<minLocal) {
+                    minLocal=curVals[i];
+                }
+            }
+        }
+
+        #pragma omp critical
+        {
+            if(minLocal<minVal) {
+                minVal=minLocal;
+            }
+        }
+    }
+
+    if(minVal==inf) {
+        return 0;
+    }
+
+    {
+        ptrdiff_t i;
+
+        #pragma omp parallel for
+        for(i=0;i<(ptrdiff_t)numStates;i++) {
+            cur[i]-=minVal;
+        }
+    }
+    return minVal;
+}
+
+template<typename T>
+static void ViterbiGridRun(size_t *paths,double *pathCosts,double *finalCosts,const ViterbiGridInfo &info,const size_t numFrames,const size_t *endStates,const size_t numEnd,const size_t segLength) {
+/*VITERBIGRIDRUN Run the forward pass with checkpoints and then trace the
+ *               paths back one segment at a time, recomputing the
+ *               backpointers of each segment. Segment j holds the
+ *               backpointers of frames 1+j*S through min((j+1)*S,
+ *               numFrames-1) (indexed from 0) and checkpoint j holds the
+ *               cumulative costs of frame j*S.
+ */
+    const double inf=numeric_limits<double>::infinity();
+    const size_t numStates=info.numStates;
+    const size_t numTrans=numFrames-1;
+    const size_t S=(segLength==0||segLength>numTrans)?max(numTrans,(size_t)1):segLength;
+    const size_t numSeg=(numTrans+S-1)/S;
+    vector<double> buffer1(numStates), buffer2(numStates);
+    vector<double> checkpoints(numSeg>1?(numSeg-1)*numStates:0);
+    vector<T> backPtrs(numTrans>0?min(S,numTrans)*numStates:0);
+    vector<size_t> curState(numEnd);
+    double *cur=&buffer1[0];
+    double *prev=&buffer2[0];
+    double costOffset;
+    size_t k, curEnd;
+    ptrdiff_t curSeg;
+
+    //The forward pass.
+    costOffset=info.initialize(prev);
+    for(k=1;k<numFrames;k++) {
+        const size_t seg=(k-1)/S;
+        T *backCur=NULL;
+
+        if(seg+1<numSeg) {
+            if((k-1)%S==0) {
+                copy(prev,prev+numStates,checkpoints.begin()+seg*numStates);
+            }
+        } else {
+            backCur=&backPtrs[0]+(k-1-seg*S)*numStates;
+        }
+
+        costOffset+=info.step(cur,backCur,prev,k);
+        swap(cur,prev);
+    }
+
+    //prev now holds the normalized cumulative costs of the last frame.
+    if(finalCosts!=NULL) {
+        for(k=0;k<numStates;k++) {
+            finalCosts[k]=prev[k]+costOffset;
+        }
+    }
+
+    if(endStates==NULL) {
+        size_t bestState=0;
+
+        for(k=1;k<numStates;k++) {
+            if(prev[k]<prev[bestState]) {
+                bestState=k;
+            }
+        }
+        curState[0]=bestState;
+    } else {
+        copy(endStates,endStates+numEnd,curState.begin());
+    }
+
+    for(curEnd=0;curEnd<numEnd;curEnd++) {
+        pathCosts[curEnd]=prev[curState[curEnd]]+costOffset;
+        if(prev[curState[curEnd]]==inf) {
+            curState[curEnd]=numStates;
+        }
+        paths[curEnd*numFrames+numFrames-1]=curState[curEnd];
+    }
+
+    //Trace the paths back one segment at a time.
+    for(curSeg=(ptrdiff_t)numSeg-1;curSeg>=0;curSeg--) {
+        const size_t firstFrame=1+(size_t)curSeg*S;
+        const size_t lastFrame=min(((size_t)curSeg+1)*S,numTrans);
+
+        if((size_t)curSeg+1<numSeg) {
+            copy(checkpoints.begin()+(size_t)curSeg*numStates,checkpoints.begin()+((size_t)curSeg+1)*numStates,prev);
+            for(k=firstFrame;k<=lastFrame;k++) {
+                info.step(cur,&backPtrs[0]+(k-firstFrame)*numStates,prev,k);
+                swap(cur,prev);
+            }
+        }
+
+        for(k=lastFrame;k>=firstFrame;k--) {
+            const T *backCur=&backPtrs[0]+(k-firstFrame)*numStates;
+
+            for(curEnd=0;curEnd<numEnd;curEnd++) {
+                if(curState[curEnd]<numStates) {
+                    curState[curEnd]=(size_t)((ptrdiff_t)curState[curEnd]-info.delta[backCur[curState[curEnd]]]);
+                }
+                paths[curEnd*numFrames+k-1]=curState[curEnd];
+            }
+        }
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
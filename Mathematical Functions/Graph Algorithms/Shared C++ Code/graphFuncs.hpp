@@ -0,0 +1,144 @@
+/**GRAPHFUNCS A header file for C++ implementations of graph and dynamic
+ *            programming algorithms. See the files implementing each
+ *            function for more details on their usage.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef GRAPHFUNCSCPP
+#define GRAPHFUNCSCPP
+#include <stddef.h>
+#include <vector>
+
+/**The CSRGraphCPP class holds a directed graph with weighted edges in
+ * compressed sparse row (CSR) form. The edges leaving vertex v go to the
+ * vertices colIdx[rowStart[v]],...,colIdx[rowStart[v+1]-1] with the costs
+ * in the same elements of costs. The vertices are indexed from zero.
+ **/
+class CSRGraphCPP {
+public:
+    size_t numVertices;
+    std::vector<size_t> rowStart;
+    std::vector<size_t> colIdx;
+    std::vector<double> costs;
+
+    CSRGraphCPP() : numVertices(0) {}
+    void initFromAdjMat(const double *adjMat,const size_t n);
+    /*INITFROMADJMAT Set up the graph from an nXn adjacency matrix stored
+     *       by columns, where adjMat(i,j) is the cost of the edge from
+     *       vertex i to vertex j and a cost of Inf means that there is no
+     *       edge.
+     */
+    void initFromEdgeList(const size_t n,const size_t numEdges,const size_t *fromIdx,const size_t *toIdx,const double *edgeCosts);
+    /*INITFROMEDGELIST Set up the graph with n vertices from a list of
+     *       numEdges edges going from fromIdx[e] to toIdx[e] with cost
+     *       edgeCosts[e]. The edges leaving each vertex keep the order in
+     *       which they are listed.
+     */
+};
+
+void DijkstraCSRCPP(double *dist,
+                    size_t *prevNodes,
+                    const CSRGraphCPP &graph,
+                    const size_t sourceIdx);
+/*DIJKSTRACSRCPP Find the shortest paths from vertex sourceIdx to all of
+ *               the vertices of a graph with nonnegative edge costs using
+ *               Dijkstra's algorithm with an indexed binary heap. The
+ *               numVerticesX1 arrays dist and prevNodes receive the
+ *               distances and the previous vertex on each path, where
+ *               prevNodes[v]=graph.numVertices if v cannot be reached or
+ *               v=sourceIdx. See CSRGraphCPP.cpp for details.
+ */
+
+bool shortestPathSPFACPP(double *dist,
+                         size_t *prevNodes,
+                         std::vector<size_t> &cycleNodes,
+                         const CSRGraphCPP &graph,
+                         const size_t sourceIdx);
+/*SHORTESTPATHSPFACPP Find the shortest paths from vertex sourceIdx to all
+ *               of the vertices of a graph whose edge costs can be
+ *               negative using the queue-based Bellman-Ford algorithm
+ *               (SPFA). The outputs are the same as in DijkstraCSRCPP.
+ *               The return value is false if a negative cycle is reachable
+ *               from the source, in which case its vertices are put in
+ *               cycleNodes in the order that they are traversed and dist
+ *               and prevNodes are not meaningful. See CSRGraphCPP.cpp for
+ *               details.
+ */
+
+size_t stronglyConnectedCSRCPP(size_t *setStart,
+                               size_t *setIdx,
+                               const CSRGraphCPP &graph);
+/*STRONGLYCONNECTEDCSRCPP Find the strongly connected subgraphs of a graph.
+ *               The numVerticesX1 array setIdx receives the vertices of
+ *               each subgraph, one subgraph after another, and setStart,
+ *               which must also have room for numVertices elements,
+ *               receives the index in setIdx of the first vertex of each
+ *               subgraph. The return value is the number of subgraphs.
+ *               The results are the same as those of the Matlab function
+ *               findStronglyConnectedSubgraphs. See CSRGraphCPP.cpp for
+ *               details.
+ */
+
+void EuclideanMSTCPP(size_t *parentIdx,
+                     double *edgeLengths,
+                     const double *points,
+                     const size_t numDim,
+                     const size_t N);
+/*EUCLIDEANMSTCPP Find the minimum spanning tree of the N points
+ *               (stored numDimXN) under the Euclidean distance. The tree
+ *               is rooted at the last point, so the (N-1)X1 array
+ *               parentIdx receives the parent of each of the other points
+ *               and edgeLengths the lengths of the corresponding edges, as
+ *               in the Matlab function minSpanningTreeFromPoints. See
+ *               EuclideanMSTCPP.cpp for details.
+ */
+
+void ViterbiGridCPP(size_t *paths,
+                    double *pathCosts,
+                    double *finalCosts,
+                    const double *nodeCosts,
+                    const size_t numFrames,
+                    const size_t *gridDims,
+                    const size_t numDims,
+                    const ptrdiff_t *offsets,
+                    const double *transCosts,
+                    const size_t numOffsets,
+                    const size_t *endStates,
+                    const size_t numEnd,
+                    const size_t segLength);
+/*VITERBIGRIDCPP Run the Viterbi algorithm over numFrames frames where the
+ *               states form a grid of size gridDims(1)X...XgridDims(numDims)
+ *               and the possible transitions are given by the numOffsets
+ *               offsets (stored numDimsXnumOffsets) in the grid with the
+ *               costs transCosts. nodeCosts is numStatesXnumFrames. The
+ *               minimum cost paths ending in the numEnd states endStates
+ *               are put in the numFramesXnumEnd array paths and their
+ *               costs in pathCosts. If endStates is NULL, then numEnd must
+ *               be 1 and the best path overall is found. The final
+ *               cumulative costs of all states are put in finalCosts,
+ *               which can be NULL. segLength is the number of frames of
+ *               backpointers kept in memory at once; 0 means all frames.
+ *               See ViterbiGridCPP.cpp for details.
+ */
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,789 @@
+/**SPARSESIMPLEXCPP A C++ implementation of the revised simplex algorithm
+ *          for linear programming problems whose constraint matrices are
+ *          large and sparse, such as the relaxations of assignment
+ *          problems.
+ *
+ *The Matlab function linProgRevisedSimplex explicitly forms and updates
+ *the dense inverse of the basis matrix, so every iteration costs
+ *O(m^2) operations and the memory required is O(m^2), even if every
+ *column of the constraint matrix has only two or three nonzero elements.
+ *Here, the basis matrix is kept as a sparse LU decomposition followed by
+ *a sequence of product-form (eta) updates, as described in Chapter 8 of
+ *[1]. The decomposition is the left-looking algorithm of Gilbert and
+ *Peierls [2] with partial pivoting, where the columns of the basis are
+ *processed in the order of increasing numbers of nonzero elements to
+ *limit fill-in. The nonzero pattern of each column of the factors is found
+ *by a depth-first search through the graph of the previous columns of L.
+ *After refactorFreq pivots, the basis is decomposed anew and the values
+ *of the basic variables are recomputed to remove accumulated errors.
+ *
+ *The entering variable is chosen using Dantzig's rule (the most negative
+ *reduced cost). The reduced costs are computed in parallel if OpenMP is
+ *available. The leaving variable is chosen using the two-pass ratio test
+ *of Harris, described in Chapter 9.3 of [1], which prefers large pivot
+ *elements. After many consecutive degenerate pivots, Bland's rule is
+ *used until a nondegenerate pivot occurs, which prevents cycling.
+ *
+ *Without a warm start, an initial basis is made from columns that have
+ *only a single positive nonzero element, such as slack variables, and
+ *artificial variables are added for the remaining constraints. These are
+ *removed in phase 1 by minimizing their sum. Artificial variables that
+ *are still basic at zero afterwards are pivoted out if possible; if not,
+ *their constraints are redundant and they remain in the basis, though
+ *they are never allowed to become nonzero again. With a warm start, the
+ *given basis is used directly if it is nonsingular and primal feasible,
+ *which is the case if only the costs have changed since it was found.
+ *
+ *REFERENCES:
+ *[1] R. J. Vanderbei, Linear Programming: Foundations and Extensions,
+ *    3rd ed. New York: Springer, 2008.
+ *[2] J. R. Gilbert and T. Peierls, "Sparse partial pivoting in time
+ *    proportional to arithmetic operations," SIAM Journal on Scientific
+ *    and Statistical Computing, vol. 9, no. 5, pp. 862-874, Sep. 1988.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For fill, copy, min and max
+#include <algorithm>
+//For fabs
+#include <cmath>
+//For infinity
+#include <limits>
+#include "sparseSimplexCPP.hpp"
+
+using namespace std;
+
+//The number of pivots after which the basis is decomposed again.
+static const size_t refactorFreq=100;
+//The number of consecutive degenerate pivots after which Bland's rule is
+//used.
+static const size_t maxDegenerate=50;
+//The pivot element in the decomposition must be at least this times the
+//largest magnitude in the column or the basis is considered singular.
+static const double LUPivTol=1e-11;
+
+SparseSimplexCPP::SparseSimplexCPP(const size_t mDes,const size_t nDes,const size_t *colStartDes,const size_t *rowIdxDes,const double *valsDes,const double *bDes,const double *cDes) {
+    const size_t nnz=colStartDes[nDes];
+
+    m=mDes;
+    n=nDes;
+    colStart.assign(colStartDes,colStartDes+n+1);
+    rowIdx.assign(rowIdxDes,rowIdxDes+nnz);
+    vals.assign(valsDes,valsDes+nnz);
+    b.assign(bDes,bDes+m);
+    c.assign(cDes,cDes+n);
+
+    artSign.resize(m);
+    basisIdx.resize(m);
+    basisPos.resize(n+m);
+    xB.resize(m);
+    prow.resize(m);
+    pinv.resize(m);
+    stepPos.resize(m);
+    UDiag.resize(m);
+    work.assign(m,0.0);
+    work2.assign(m,0.0);
+    marked.assign(m,false);
+}
+
+void SparseSimplexCPP::scatterColumn(double *dense,const size_t j) const {
+/*SCATTERCOLUMN Add column j of the constraint matrix with the artificial
+ *              variables appended to the dense mX1 vector dense.
+ */
+    if(j<n) {
+        size_t p;
+
+        for(p=colStart[j];p<colStart[j+1];p++) {
+            dense[rowIdx[p]]+=vals[p];
+        }
+    } else {
+        dense[j-n]+=artSign[j-n];
+    }
+}
+
+double SparseSimplexCPP::columnDot(const double *y,const size_t j) const {
+/*COLUMNDOT The inner product of the dense vector y with column j of the
+ *          constraint matrix with the artificial variables appended.
+ */
+    if(j<n) {
+        double sum=0;
+        size_t p;
+
+        for(p=colStart[j];p<colStart[j+1];p++) {
+            sum+=y[rowIdx[p]]*vals[p];
+        }
+        return sum;
+    } else {
+        return y[j-n]*artSign[j-n];
+    }
+}
+
+size_t SparseSimplexCPP::reach(const size_t j) {
+/*REACH Find the rows that can be nonzero when the columns of L computed so
+ *      far are applied to column j of the constraint matrix. The rows are
+ *      put in reachList in the reverse of a topological order and are
+ *      marked. The number of rows is returned.
+ */
+    size_t p, numEl;
+
+    reachList.clear();
+    if(j<n) {
+        numEl=colStart[j+1]-colStart[j];
+    } else {
+        numEl=1;
+    }
+
+    for(p=0;p<numEl;p++) {
+        const size_t startRow=j<n?rowIdx[colStart[j]+p]:j-n;
+
+        if(marked[startRow]) {
+            continue;
+        }
+
+        //A depth-first search with an explicit stack. The next edge to
+        //visit from each row on the stack is in reachEdge. Rows that have
+        //not been pivoted have no edges.
+        marked[startRow]=true;
+        reachStack.push_back(startRow);
+        reachEdge.push_back(pinv[startRow]>=0?LStart[pinv[startRow]]:0);
+        while(!reachStack.empty()) {
+            const size_t curRow=reachStack.back();
+            const ptrdiff_t curStep=pinv[curRow];
+
+            if(curStep>=0&&reachEdge.back()<LStart[curStep+1]) {
+                const size_t nextRow=LRow[reachEdge.back()];
+
+                reachEdge.back()++;
+                if(!marked[nextRow]) {
+                    marked[nextRow]=true;
+                    reachStack.push_back(nextRow);
+                    reachEdge.push_back(pinv[nextRow]>=0?LStart[pinv[nextRow]]:0);
+                }
+            } else {
+                reachList.push_back(curRow);
+                reachStack.pop_back();
+                reachEdge.pop_back();
+            }
+        }
+    }
+
+    return reachList.size();
+}
+
+bool SparseSimplexCPP::factorize() {
+/*FACTORIZE Compute the LU decomposition of the current basis and clear
+ *          the eta file. False is returned if the basis is singular.
+ */
+    vector<size_t> order(m);
+    vector<size_t> countPos(m+2,0);
+    size_t i, k;
+
+    //Order the positions of the basis by the number of nonzero elements
+    //in their columns using a counting sort.
+    for(i=0;i<m;i++) {
+        const size_t j=basisIdx[i];
+        const size_t numEl=j<n?min(colStart[j+1]-colStart[j],m):1;
+
+        countPos[numEl+1]++;
+    }
+    for(i=1;i<m+2;i++) {
+        countPos[i]+=countPos[i-1];
+    }
+    for(i=0;i<m;i++) {
+        const size_t j=basisIdx[i];
+        const size_t numEl=j<n?min(colStart[j+1]-colStart[j],m):1;
+
+        order[countPos[numEl]++]=i;
+    }
+
+    fill(pinv.begin(),pinv.end(),-1);
+    LStart.assign(1,0);
+    LRow.clear();
+    LVal.clear();
+    UStart.assign(1,0);
+    UStep.clear();
+    UVal.clear();
+    etaPos.clear();
+    etaStart.assign(1,0);
+    etaIdx.clear();
+    etaPivot.clear();
+    etaVal.clear();
+
+    for(k=0;k<m;k++) {
+        const size_t j=basisIdx[order[k]];
+        const size_t numReach=reach(j);
+        double colMax=0, pivMax=0;
+        ptrdiff_t pivRow=-1;
+        size_t p;
+
+        scatterColumn(&work[0],j);
+        for(p=0;p<numReach;p++) {
+            colMax=max(colMax,fabs(work[reachList[p]]));
+        }
+
+        //Apply the previous columns of L in topological order. The values
+        //in the pivoted rows form column k of U.
+        for(p=numReach;p-->0;) {
+            const size_t curRow=reachList[p];
+            const ptrdiff_t s=pinv[curRow];
+            const double xCur=work[curRow];
+            size_t q;
+
+            if(s<0||xCur==0) {
+                continue;
+            }
+
+            UStep.push_back((size_t)s);
+            UVal.push_back(xCur);
+            for(q=LStart[s];q<LStart[s+1];q++) {
+                work[LRow[q]]-=LVal[q]*xCur;
+            }
+        }
+
+        //Partial pivoting among the rows that have not been pivoted.
+        for(p=0;p<numReach;p++) {
+            const size_t curRow=reachList[p];
+
+            if(pinv[curRow]<0&&fabs(work[curRow])>pivMax) {
+                pivMax=fabs(work[curRow]);
+                pivRow=(ptrdiff_t)curRow;
+            }
+        }
+
+        if(pivRow<0||pivMax<=LUPivTol*colMax) {
+            for(p=0;p<numReach;p++) {
+                work[reachList[p]]=0;
+                marked[reachList[p]]=false;
+            }
+            return false;
+        }
+
+        UDiag[k]=work[pivRow];
+        pinv[pivRow]=(ptrdiff_t)k;
+        prow[k]=(size_t)pivRow;
+        stepPos[k]=order[k];
+
+        for(p=0;p<numReach;p++) {
+            const size_t curRow=reachList[p];
+
+            if(pinv[curRow]<0&&work[curRow]!=0) {
+                LRow.push_back(curRow);
+                LVal.push_back(work[curRow]/UDiag[k]);
+            }
+            work[curRow]=0;
+            marked[curRow]=false;
+        }
+
+        LStart.push_back(LRow.size());
+        UStart.push_back(UStep.size());
+    }
+
+    return true;
+}
+
+void SparseSimplexCPP::ftran(double *z) {
+/*FTRAN Solve B*x=z, where B is the current basis matrix. On input, z is
+ *      indexed by the rows of the constraint matrix and on output, by the
+ *      positions in the basis.
+ */
+    size_t s, k, e, p;
+
+    for(s=0;s<m;s++) {
+        const double v=z[prow[s]];
+
+        if(v!=0) {
+            for(p=LStart[s];p<LStart[s+1];p++) {
+                z[LRow[p]]-=LVal[p]*v;
+            }
+        }
+    }
+
+    for(s=0;s<m;s++) {
+        work2[s]=z[prow[s]];
+    }
+
+    for(k=m;k-->0;) {
+        const double v=work2[k]/UDiag[k];
+
+        work2[k]=v;
+        if(v!=0) {
+            for(p=UStart[k];p<UStart[k+1];p++) {
+                work2[UStep[p]]-=UVal[p]*v;
+            }
+        }
+    }
+
+    for(k=0;k<m;k++) {
+        z[stepPos[k]]=work2[k];
+    }
+
+    for(e=0;e<etaPos.size();e++) {
+        const size_t r=etaPos[e];
+        const double v=z[r]/etaPivot[e];
+
+        z[r]=v;
+        if(v!=0) {
+            for(p=etaStart[e];p<etaStart[e+1];p++) {
+                z[etaIdx[p]]-=etaVal[p]*v;
+            }
+        }
+    }
+}
+
+void SparseSimplexCPP::btran(double *y) {
+/*BTRAN Solve B'*x=y, where B is the current basis matrix. On input, y is
+ *      indexed by the positions in the basis and on output, by the rows
+ *      of the constraint matrix.
+ */
+    size_t s, k, e, p;
+
+    for(e=etaPos.size();e-->0;) {
+        const size_t r=etaPos[e];
+        double sum=y[r];
+
+        for(p=etaStart[e];p<etaStart[e+1];p++) {
+            sum-=etaVal[p]*y[etaIdx[p]];
+        }
+        y[r]=sum/etaPivot[e];
+    }
+
+    for(k=0;k<m;k++) {
+        work2[k]=y[stepPos[k]];
+    }
+
+    for(k=0;k<m;k++) {
+        double sum=work2[k];
+
+        for(p=UStart[k];p<UStart[k+1];p++) {
+            sum-=UVal[p]*work2[UStep[p]];
+        }
+        work2[k]=sum/UDiag[k];
+    }
+
+    //The rows in column s of L are all pivoted in later steps, so their
+    //values are final when they are used.
+    for(s=m;s-->0;) {
+        double sum=work2[s];
+
+        for(p=LStart[s];p<LStart[s+1];p++) {
+            sum-=LVal[p]*y[LRow[p]];
+        }
+        y[prow[s]]=sum;
+    }
+}
+
+void SparseSimplexCPP::computeXB() {
+    copy(b.begin(),b.end(),xB.begin());
+    ftran(&xB[0]);
+}
+
+bool SparseSimplexCPP::pivot(const size_t q,const size_t r,const double *alpha) {
+/*PIVOT Replace the variable in position r of the basis with variable q,
+ *      where alpha is the column of q transformed by ftran. The values of
+ *      the basic variables must already have been updated. False is
+ *      returned if the basis became singular when it was decomposed again.
+ */
+    size_t i;
+
+    etaPos.push_back(r);
+    etaPivot.push_back(alpha[r]);
+    for(i=0;i<m;i++) {
+        if(i!=r&&alpha[i]!=0) {
+            etaIdx.push_back(i);
+            etaVal.push_back(alpha[i]);
+        }
+    }
+    etaStart.push_back(etaIdx.size());
+
+    basisPos[basisIdx[r]]=-1;
+    basisIdx[r]=q;
+    basisPos[q]=(ptrdiff_t)r;
+
+    if(etaPos.size()>=refactorFreq) {
+        if(!factorize()) {
+            return false;
+        }
+
+        computeXB();
+        //Round-off errors can make basic variables at zero slightly
+        //negative.
+        for(i=0;i<m;i++) {
+            xB[i]=max(xB[i],0.0);
+        }
+    }
+
+    return true;
+}
+
+int SparseSimplexCPP::runSimplex(const bool phase1,const size_t maxIter,const double epsilon,size_t &numIter) {
+/*RUNSIMPLEX Perform simplex iterations from the current feasible basis.
+ *           In phase 1, the sum of the artificial variables is minimized;
+ *           otherwise c'*x is minimized. The return values are the exit
+ *           codes of the solve function.
+ */
+    vector<double> y(m), alpha(m);
+    size_t numDegenerate=0;
+    bool useBland=false;
+
+    while(true) {
+        ptrdiff_t q=-1, r=-1;
+        double theta;
+        size_t i;
+
+        if(numIter>=maxIter) {
+            return 2;
+        }
+
+        //The simplex multipliers.
+        for(i=0;i<m;i++) {
+            const size_t j=basisIdx[i];
+
+            if(phase1) {
+                y[i]=j>=n?1.0:0.0;
+            } else {
+                y[i]=j>=n?0.0:c[j];
+            }
+        }
+        btran(&y[0]);
+
+        //Pricing. Only the original variables can enter the basis.
+        {
+            double bestCost=-epsilon;
+            ptrdiff_t j;
+
+            #pragma omp parallel
+            {
+                double threadCost=-epsilon;
+                ptrdiff_t threadIdx=-1;
+
+                #pragma omp for schedule(static)
+                for(j=0;j<(ptrdiff_t)n;j++) {
+                    double redCost;
+
+                    if(basisPos[j]>=0) {
+                        continue;
+                    }
+
+                    redCost=(phase1?0.0:c[j])-columnDot(&y[0],(size_t)j);
+                    if(useBland) {
+                        if(redCost<-epsilon&&threadIdx<0) {
+                            threadIdx=j;
+                            threadCost=redCost;
+                        }
+                    } else if(redCost<threadCost) {
+                        threadIdx=j;
+                        threadCost=redCost;
+                    }
+                }
+
+                #pragma omp critical(sparseSimplexPricing)
+                {
+                    if(threadIdx>=0) {
+                        if(useBland) {
+                            if(q<0||threadIdx<q) {
+                                q=threadIdx;
+                            }
+                        } else if(threadCost<bestCost||(threadCost==bestCost&&q>=0&&threadIdx<q)) {
+                            q=threadIdx;
+                            bestCost=threadCost;
+                        }
+                    }
+                }
+            }
+        }
+
+        if(q<0) {
+            return 0;
+        }
+
+        fill(alpha.begin(),alpha.end(),0.0);
+        scatterColumn(&alpha[0],(size_t)q);
+        ftran(&alpha[0]);
+
+        //The ratio test. In phase 2, artificial variables for redundant
+        //constraints that are still in the basis must stay at zero, so
+        //they leave the basis at a zero step whichever the sign of alpha.
+        if(useBland) {
+            double minRatio=numeric_limits<double>::infinity();
+
+            for(i=0;i<m;i++) {
+                const bool isArt=!phase1&&basisIdx[i]>=n;
+                double ratio;
+
+                if(isArt&&fabs(alpha[i])>epsilon) {
+                    ratio=0;
+                } else if(alpha[i]>epsilon) {
+                    ratio=max(xB[i],0.0)/alpha[i];
+                } else {
+                    continue;
+                }
+
+                if(ratio<minRatio||(ratio==minRatio&&basisIdx[i]<basisIdx[r])) {
+                    minRatio=ratio;
+                    r=(ptrdiff_t)i;
+                }
+            }
+        } else {
+            double bound=numeric_limits<double>::infinity();
+            double maxAlpha=0;
+
+            for(i=0;i<m;i++) {
+                if(!phase1&&basisIdx[i]>=n&&fabs(alpha[i])>epsilon) {
+                    bound=0;
+                } else if(alpha[i]>epsilon) {
+                    bound=min(bound,(max(xB[i],0.0)+epsilon)/alpha[i]);
+                }
+            }
+
+            for(i=0;i<m;i++) {
+                const double absAlpha=fabs(alpha[i]);
+
+                if(!phase1&&basisIdx[i]>=n&&absAlpha>epsilon) {
+                    if(absAlpha>maxAlpha) {
+                        maxAlpha=absAlpha;
+                        r=(ptrdiff_t)i;
+                    }
+                } else if(alpha[i]>epsilon&&max(xB[i],0.0)/alpha[i]<=bound&&alpha[i]>maxAlpha) {
+                    maxAlpha=alpha[i];
+                    r=(ptrdiff_t)i;
+                }
+            }
+        }
+
+        if(r<0) {
+            return 1;
+        }
+
+        if(!phase1&&basisIdx[r]>=n) {
+            theta=0;
+        } else {
+            theta=max(xB[r],0.0)/alpha[r];
+        }
+
+        if(theta!=0) {
+            for(i=0;i<m;i++) {
+                xB[i]=max(xB[i]-theta*alpha[i],0.0);
+            }
+        }
+        xB[r]=theta;
+
+        if(theta<=epsilon) {
+            numDegenerate++;
+            if(numDegenerate>maxDegenerate) {
+                useBland=true;
+            }
+        } else {
+            numDegenerate=0;
+            useBland=false;
+        }
+
+        numIter++;
+        if(!pivot((size_t)q,(size_t)r,&alpha[0])) {
+            return 3;
+        }
+    }
+}
+
+void SparseSimplexCPP::coldStartBasis() {
+/*COLDSTARTBASIS Make an initial basis using columns with a single positive
+ *               element in rows where b is nonnegative and artificial
+ *               variables in the remaining rows.
+ */
+    vector<bool> covered(m,false);
+    size_t i, j;
+
+    fill(basisPos.begin(),basisPos.end(),-1);
+    for(j=0;j<n;j++) {
+        if(colStart[j+1]-colStart[j]==1) {
+            const size_t row=rowIdx[colStart[j]];
+
+            if(!covered[row]&&vals[colStart[j]]>0&&b[row]>=0) {
+                covered[row]=true;
+                basisIdx[row]=j;
+                basisPos[j]=(ptrdiff_t)row;
+            }
+        }
+    }
+
+    for(i=0;i<m;i++) {
+        artSign[i]=b[i]>=0?1.0:-1.0;
+        if(!covered[i]) {
+            basisIdx[i]=n+i;
+            basisPos[n+i]=(ptrdiff_t)i;
+        }
+    }
+}
+
+bool SparseSimplexCPP::driveOutArtificial(const size_t r,const double epsilon) {
+/*DRIVEOUTARTIFICIAL Replace the artificial variable in position r of the
+ *                   basis, which is zero, with an original variable using
+ *                   a degenerate pivot. If no variable has a nonzero
+ *                   element in row r of the tableau, then the constraint
+ *                   is redundant and the basis is not changed. False is
+ *                   returned if the basis became singular.
+ */
+    vector<double> rho(m,0.0);
+    double bestVal=epsilon;
+    ptrdiff_t q=-1;
+    size_t j;
+
+    //Row r of the inverse of the basis.
+    rho[r]=1;
+    btran(&rho[0]);
+
+    for(j=0;j<n;j++) {
+        if(basisPos[j]<0) {
+            const double val=fabs(columnDot(&rho[0],j));
+
+            if(val>bestVal) {
+                bestVal=val;
+                q=(ptrdiff_t)j;
+            }
+        }
+    }
+
+    if(q<0) {
+        return true;
+    }
+
+    fill(rho.begin(),rho.end(),0.0);
+    scatterColumn(&rho[0],(size_t)q);
+    ftran(&rho[0]);
+    xB[r]=0;
+    return pivot((size_t)q,r,&rho[0]);
+}
+
+int SparseSimplexCPP::solve(double *x,double *optCost,size_t *basis,const bool warmStart,const size_t maxIter,const double epsilon,size_t *numIter) {
+    double bMax=0;
+    bool haveBasis=false;
+    int exitCode;
+    size_t i, j;
+
+    *numIter=0;
+
+    if(m==0) {
+        //Without constraints, the problem is bounded only if no cost is
+        //negative, in which case x=0 is optimal.
+        for(j=0;j<n;j++) {
+            if(c[j]<-epsilon) {
+                return 1;
+            }
+        }
+        fill(x,x+n,0.0);
+        *optCost=0;
+        return 0;
+    }
+
+    for(i=0;i<m;i++) {
+        artSign[i]=b[i]>=0?1.0:-1.0;
+        bMax=max(bMax,fabs(b[i]));
+    }
+    bMax=max(bMax,1.0);
+
+    if(warmStart) {
+        bool isValid=true;
+
+        fill(basisPos.begin(),basisPos.end(),-1);
+        for(i=0;i<m;i++) {
+            if(basis[i]>=n+m||basisPos[basis[i]]>=0) {
+                isValid=false;
+                break;
+            }
+            basisIdx[i]=basis[i];
+            basisPos[basis[i]]=(ptrdiff_t)i;
+        }
+
+        if(isValid&&factorize()) {
+            computeXB();
+
+            haveBasis=true;
+            for(i=0;i<m;i++) {
+                if(xB[i]<-epsilon*bMax||(basisIdx[i]>=n&&fabs(xB[i])>epsilon*bMax)) {
+                    haveBasis=false;
+                    break;
+                }
+                xB[i]=max(xB[i],0.0);
+            }
+        }
+    }
+
+    if(!haveBasis) {
+        bool hasArtificial=false;
+
+        coldStartBasis();
+        if(!factorize()) {
+            return 5;
+        }
+        computeXB();
+
+        for(i=0;i<m;i++) {
+            xB[i]=max(xB[i],0.0);
+            if(basisIdx[i]>=n) {
+                hasArtificial=true;
+            }
+        }
+
+        if(hasArtificial) {
+            double infeasibility=0;
+
+            exitCode=runSimplex(true,maxIter,epsilon,*numIter);
+            if(exitCode!=0) {
+                return 5;
+            }
+
+            for(i=0;i<m;i++) {
+                if(basisIdx[i]>=n) {
+                    infeasibility+=xB[i];
+                }
+            }
+
+            if(infeasibility>epsilon*bMax) {
+                return 4;
+            }
+
+            for(i=0;i<m;i++) {
+                if(basisIdx[i]>=n&&!driveOutArtificial(i,epsilon)) {
+                    return 3;
+                }
+            }
+        }
+    }
+
+    exitCode=runSimplex(false,maxIter,epsilon,*numIter);
+    if(exitCode!=0&&exitCode!=2) {
+        return exitCode;
+    }
+
+    fill(x,x+n,0.0);
+    *optCost=0;
+    for(i=0;i<m;i++) {
+        j=basisIdx[i];
+        basis[i]=j;
+        if(j<n) {
+            x[j]=xB[i];
+            *optCost+=c[j]*xB[i];
+        }
+    }
+
+    return exitCode;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,119 @@
+/**SPARSESIMPLEXCPP A header file for a C++ implementation of the revised
+ *          simplex algorithm for linear programming problems with sparse
+ *          constraint matrices. See the file sparseSimplexCPP.cpp for more
+ *          details.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef SPARSESIMPLEXCPP
+#define SPARSESIMPLEXCPP
+#include <stddef.h>
+#include <vector>
+
+/**The SparseSimplexCPP class solves the linear programming problem
+ * minimize c'*x given A*x=b and x>=0, where the mXn matrix A is given in
+ * compressed sparse column form: the row indices and the values of the
+ * nonzero elements in column j are in rowIdx and vals at the positions
+ * colStart[j],...,colStart[j+1]-1. The problem is copied when the class is
+ * constructed.
+ **/
+class SparseSimplexCPP {
+public:
+    SparseSimplexCPP(const size_t mDes,const size_t nDes,const size_t *colStartDes,const size_t *rowIdxDes,const double *valsDes,const double *bDes,const double *cDes);
+    int solve(double *x,double *optCost,size_t *basis,const bool warmStart,const size_t maxIter,const double epsilon,size_t *numIter);
+    /*SOLVE Solve the problem, putting the solution in the nX1 vector x and
+     *      its cost in optCost. The mX1 vector basis receives the indices
+     *      of the basic variables, where an index n+r is the artificial
+     *      variable of constraint r, which remains in the basis if
+     *      constraint r is redundant. If warmStart is true, basis must hold
+     *      such a basis on input, which is used as the starting point if it
+     *      is nonsingular and feasible. epsilon is the tolerance used for
+     *      the reduced costs and the pivot elements. The number of
+     *      iterations performed is put in numIter. The exit codes are the
+     *      same as those of the Matlab function linProgRevisedSimplex:
+     *      0 Successful termination.
+     *      1 The cost is unbounded.
+     *      2 The maximum number of iterations was reached.
+     *      3 The basis matrix became numerically singular.
+     *      4 The problem is not feasible.
+     *      5 The search for an initial feasible basis failed.
+     *      x, optCost and basis are set for exit codes 0 and 2.
+     */
+private:
+    size_t m;
+    size_t n;
+    std::vector<size_t> colStart;
+    std::vector<size_t> rowIdx;
+    std::vector<double> vals;
+    std::vector<double> b;
+    std::vector<double> c;
+    //The sign of the coefficient of the artificial variable of each
+    //constraint, chosen so that the artificial variables start out
+    //nonnegative.
+    std::vector<double> artSign;
+
+    //The variable in each position of the basis, the position of each
+    //variable in the basis or -1 and the values of the basic variables.
+    std::vector<size_t> basisIdx;
+    std::vector<ptrdiff_t> basisPos;
+    std::vector<double> xB;
+
+    //The LU decomposition of the basis matrix. Step k of the
+    //decomposition eliminates basis position stepPos[k] using row
+    //prow[k]. L is stored by columns with unit diagonals omitted and U
+    //by columns with the diagonal separate.
+    std::vector<size_t> prow;
+    std::vector<ptrdiff_t> pinv;
+    std::vector<size_t> stepPos;
+    std::vector<size_t> LStart, LRow;
+    std::vector<double> LVal;
+    std::vector<size_t> UStart, UStep;
+    std::vector<double> UVal, UDiag;
+
+    //The eta file of the product form updates since the last
+    //decomposition.
+    std::vector<size_t> etaPos, etaStart, etaIdx;
+    std::vector<double> etaPivot, etaVal;
+
+    //Scratch space.
+    std::vector<double> work, work2;
+    std::vector<size_t> reachStack, reachEdge, reachList;
+    std::vector<bool> marked;
+
+    void scatterColumn(double *dense,const size_t j) const;
+    double columnDot(const double *y,const size_t j) const;
+    bool factorize();
+    size_t reach(const size_t j);
+    void ftran(double *z);
+    void btran(double *y);
+    void computeXB();
+    bool pivot(const size_t q,const size_t r,const double *alpha);
+    int runSimplex(const bool phase1,const size_t maxIter,const double epsilon,size_t &numIter);
+    void coldStartBasis();
+    bool driveOutArtificial(const size_t r,const double epsilon);
+    //Copying is not allowed.
+    SparseSimplexCPP(const SparseSimplexCPP &);
+    SparseSimplexCPP &operator=(const SparseSimplexCPP &);
+};
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
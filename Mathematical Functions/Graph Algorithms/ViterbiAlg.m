@@ -55,6 +55,12 @@ function [minCostPath,minCost]=ViterbiAlg(costMats)
 % [minCostPath,minCost]=ViterbiAlg(costMats)
 %whereby the minimum cost path is [1;3;4;2;1;1] and the minimum cost is 3.
 %
+%When the states form a regular grid and the allowed transitions are the
+%same everywhere in the grid, such as in dynamic programming
+%track-before-detect, the compiled function ViterbiGrid is much faster and
+%does not require the costMats hypermatrix, which can be too large to store
+%when there are many states.
+%
 %October 2014 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
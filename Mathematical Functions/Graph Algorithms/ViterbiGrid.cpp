@@ -0,0 +1,258 @@
+/**VITERBIGRID Use the Viterbi algorithm to find minimum cost paths through
+ *             a sequence of frames whose states form a regular grid with
+ *             the same set of allowed transitions at every point in the
+ *             grid, as in dynamic programming track-before-detect (TBD).
+ *             This is much faster and uses much less memory than
+ *             ViterbiAlg when the number of states is large, since the
+ *             transitions are given by a stencil of offsets rather than
+ *             a full matrix of transition costs.
+ *
+ *INPUTS: nodeCosts A numStatesXnumFrames matrix of the costs of the
+ *              states in each frame. For TBD, these are typically the
+ *              negative log-likelihood ratios of the cells of the sensor
+ *              images. Values can be Inf to rule out states, but not -Inf
+ *              or NaN.
+ *     gridDims A numDimsX1 vector giving the size of the grid of states,
+ *              with prod(gridDims)=numStates. The states are numbered as
+ *              Matlab numbers the elements of an array of size gridDims,
+ *              with the first dimension varying fastest. For TBD of a
+ *              target moving in an image, the grid could be
+ *              [numRows;numCols] or include velocity dimensions. If
+ *              omitted or an empty matrix is passed, the states are taken
+ *              to be a one-dimensional grid.
+ *      offsets A numDimsXnumOffsets matrix of integer offsets in the grid.
+ *              Transition o goes from the state at grid position p in one
+ *              frame to the state at p+offsets(:,o) in the next frame.
+ *              Transitions that leave the grid are not allowed.
+ *   transCosts A numOffsetsX1 vector of the costs of the transitions, or a
+ *              scalar if all transitions have the same cost.
+ *    endStates An optional vector of the numEnd indices of the states in
+ *              the last frame at which the paths should end. If omitted or
+ *              an empty matrix is passed, the single minimum cost path is
+ *              found. Passing many end states, such as all states whose
+ *              final cost is below a detection threshold, finds many
+ *              paths with a single pass.
+ *    segLength The number of frames of backpointers to keep in memory at
+ *              once. If this is less than numFrames-1, the backpointers
+ *              are recomputed in segments from saved cumulative costs
+ *              when tracing back the paths, which takes about twice as
+ *              long but uses much less memory when there are many frames.
+ *              If omitted or an empty matrix is passed, the default of 0
+ *              is used, which means that all backpointers are kept.
+ *
+ *OUTPUTS: paths A numFramesXnumEnd matrix of the indices of the states in
+ *               the minimum cost paths ending at each of the end states.
+ *               When multiple paths have the same cost, one is chosen
+ *               arbitrarily. If an end state cannot be reached, the path
+ *               is all NaN.
+ *     pathCosts A numEndX1 vector of the costs of the paths. The cost of a
+ *               path is the sum of the node costs of the states visited
+ *               and the transition costs of the transitions used.
+ *    finalCosts A numStatesX1 vector of the costs of the minimum cost
+ *               paths ending in each of the states in the last frame.
+ *
+ *For example, a target moving by at most one cell in each direction per
+ *frame in an image of size numRowsXnumCols with intensities I (numRowsX
+ *numColsXnumFrames) and a Gaussian likelihood ratio in each cell could be
+ *detected using
+ * [dx,dy]=ndgrid(-1:1,-1:1);
+ * offsets=[dx(:)';dy(:)'];
+ * nodeCosts=-reshape(I*A/sigma^2-A^2/(2*sigma^2),[],numFrames);
+ * [paths,pathCosts]=ViterbiGrid(nodeCosts,[numRows;numCols],offsets,0);
+ * [row,col]=ind2sub([numRows,numCols],paths);
+ *where A is the target amplitude and sigma the noise standard deviation.
+ *The target is declared present if pathCosts is below a threshold.
+ *
+ *The algorithm is implemented in ViterbiGridCPP.cpp, where the
+ *checkpointing is described in more detail. If the code is compiled with
+ *OpenMP support, the states in each frame are processed in parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[paths,pathCosts,finalCosts]=ViterbiGrid(nodeCosts,gridDims,offsets,transCosts,endStates,segLength);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For infinity
+#include <limits>
+#include "MexValidation.h"
+#include "graphFuncs.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    const double inf=numeric_limits<double>::infinity();
+    size_t numStates, numFrames, numDims, numOffsets, numEnd, segLength=0;
+    size_t i, prodDims;
+    size_t *gridDims, *endStates=NULL, *paths;
+    ptrdiff_t *offsets;
+    const double *nodeCosts, *offsetsMATLAB;
+    double *transCosts, *pathsOut;
+    mxArray *pathsMATLAB, *pathCostsMATLAB, *finalCostsMATLAB;
+
+    if(nrhs<4) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>6) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>3) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    checkRealDoubleArray(prhs[0]);
+    numStates=mxGetM(prhs[0]);
+    numFrames=mxGetN(prhs[0]);
+    if(numStates==0||numFrames==0) {
+        mexErrMsgTxt("nodeCosts cannot be empty.");
+    }
+    nodeCosts=(double*)mxGetData(prhs[0]);
+    for(i=0;i<numStates*numFrames;i++) {
+        if(nodeCosts[i]!=nodeCosts[i]||nodeCosts[i]==-inf) {
+            mexErrMsgTxt("nodeCosts cannot contain NaN or -Inf values.");
+        }
+    }
+
+    if(!mxIsEmpty(prhs[1])) {
+        gridDims=copySizeTArrayFromMatlab(prhs[1],&numDims);
+    } else {
+        numDims=1;
+        gridDims=(size_t*)mxMalloc(sizeof(size_t));
+        gridDims[0]=numStates;
+    }
+    prodDims=1;
+    for(i=0;i<numDims;i++) {
+        prodDims*=gridDims[i];
+    }
+    if(prodDims!=numStates) {
+        mxFree(gridDims);
+        mexErrMsgTxt("The product of the grid dimensions must equal the number of states.");
+    }
+
+    checkRealDoubleArray(prhs[2]);
+    if(mxGetM(prhs[2])!=numDims||mxGetN(prhs[2])==0) {
+        mxFree(gridDims);
+        mexErrMsgTxt("The offsets have the wrong dimensionality.");
+    }
+    numOffsets=mxGetN(prhs[2]);
+    offsetsMATLAB=(double*)mxGetData(prhs[2]);
+
+    checkRealDoubleArray(prhs[3]);
+    if(mxGetNumberOfElements(prhs[3])!=numOffsets&&mxGetNumberOfElements(prhs[3])!=1) {
+        mxFree(gridDims);
+        mexErrMsgTxt("transCosts has the wrong dimensionality.");
+    }
+
+    if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+        endStates=copySizeTArrayFromMatlab(prhs[4],&numEnd);
+        for(i=0;i<numEnd;i++) {
+            if(endStates[i]<1||endStates[i]>numStates) {
+                mxFree(endStates);
+                mxFree(gridDims);
+                mexErrMsgTxt("The end states must be valid state indices.");
+            }
+            //Convert to C indexation.
+            endStates[i]--;
+        }
+    } else {
+        numEnd=1;
+    }
+
+    if(nrhs>5&&!mxIsEmpty(prhs[5])) {
+        segLength=getSizeTFromMatlab(prhs[5]);
+    }
+
+    offsets=new ptrdiff_t[numDims*numOffsets];
+    for(i=0;i<numDims*numOffsets;i++) {
+        offsets[i]=(ptrdiff_t)offsetsMATLAB[i];
+        if((double)offsets[i]!=offsetsMATLAB[i]) {
+            delete[] offsets;
+            if(endStates!=NULL) {
+                mxFree(endStates);
+            }
+            mxFree(gridDims);
+            mexErrMsgTxt("The offsets must be integers.");
+        }
+    }
+
+    transCosts=new double[numOffsets];
+    for(i=0;i<numOffsets;i++) {
+        transCosts[i]=mxGetNumberOfElements(prhs[3])==1?getDoubleFromMatlab(prhs[3]):((double*)mxGetData(prhs[3]))[i];
+        if(transCosts[i]!=transCosts[i]||transCosts[i]==-inf) {
+            delete[] transCosts;
+            delete[] offsets;
+            if(endStates!=NULL) {
+                mxFree(endStates);
+            }
+            mxFree(gridDims);
+            mexErrMsgTxt("transCosts cannot contain NaN or -Inf values.");
+        }
+    }
+
+    paths=new size_t[numFrames*numEnd];
+    pathCostsMATLAB=mxCreateDoubleMatrix(numEnd,1,mxREAL);
+    finalCostsMATLAB=mxCreateDoubleMatrix(numStates,1,mxREAL);
+
+    ViterbiGridCPP(paths,(double*)mxGetData(pathCostsMATLAB),(double*)mxGetData(finalCostsMATLAB),nodeCosts,numFrames,gridDims,numDims,offsets,transCosts,numOffsets,endStates,numEnd,segLength);
+
+    pathsMATLAB=mxCreateDoubleMatrix(numFrames,numEnd,mxREAL);
+    pathsOut=(double*)mxGetData(pathsMATLAB);
+    for(i=0;i<numFrames*numEnd;i++) {
+        //Convert to Matlab's indexation.
+        if(paths[i]<numStates) {
+            pathsOut[i]=(double)(paths[i]+1);
+        } else {
+            pathsOut[i]=mxGetNaN();
+        }
+    }
+
+    delete[] paths;
+    delete[] transCosts;
+    delete[] offsets;
+    if(endStates!=NULL) {
+        mxFree(endStates);
+    }
+    mxFree(gridDims);
+
+    plhs[0]=pathsMATLAB;
+    switch(nlhs) {
+        case 3:
+            plhs[2]=finalCostsMATLAB;
+        case 2:
+            plhs[1]=pathCostsMATLAB;
+        default:
+            break;
+    }
+
+    if(nlhs<3) {
+        mxDestroyArray(finalCostsMATLAB);
+    }
+    if(nlhs<2) {
+        mxDestroyArray(pathCostsMATLAB);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -50,6 +50,10 @@ function [distMat,pathMatrix]=findAllPairsShortestPath(adjMat)
 %The algorithm can find all nodes that are in cycles, but it will not find
 %all cycles, because a single node can be in multiple cycles.
 %
+%For large sparse graphs, the shortest paths from many sources can be
+%found in parallel with the compiled function DijkstraAlgSparse by passing
+%a vector of source vertices.
+%
 %REFERENCES:
 %
 %[1] C. H. Papadimitriou and K. Steiglitz, Combinatorial Optimization:
@@ -31,6 +31,9 @@ function [setStartList,setLengths,setIdxList,subgraphList]=findStronglyConnected
 %complexity would be O(numVertices+numEdges) if the graph were sparse.
 %however, since adjacency matrix is scanned for edges, rather
 %than edges being given in a separate list, the complexity is higher. 
+%The compiled function findStronglyConnectedSubgraphsSparse implements the
+%same algorithm over only the edges present, including for Matlab sparse
+%adjacency matrices, and achieves that complexity.
 %
 %Many authors refer to the algorithm of [2], which is essentially the same
 %as that of [1], except the pseudocode in the paper contains some errors
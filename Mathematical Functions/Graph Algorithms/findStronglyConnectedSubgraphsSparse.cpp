@@ -0,0 +1,113 @@
+/**FINDSTRONGLYCONNECTEDSUBGRAPHSSPARSE Given an adjacency matrix of a
+ *               large sparse directed graph, identify all of the strongly
+ *               connected subgraphs. This is a compiled alternative to
+ *               findStronglyConnectedSubgraphs that only visits the edges
+ *               that are present in the graph.
+ *
+ *INPUTS: adjMat An adjacency matrix of a graph. This can be a full matrix,
+ *               where vertex i is connected to vertex j if adjMat(i,j) is
+ *               not Inf, as in findStronglyConnectedSubgraphs, or a Matlab
+ *               sparse matrix, where vertex i is connected to vertex j if
+ *               adjMat(i,j) is stored and not Inf. A logical sparse
+ *               matrix, such as is produced by adjMat~=0, is not accepted;
+ *               it should be converted using double.
+ *
+ *OUTPUTS: setStartList A numSubgraphsX1 list of the starting index of the
+ *               vertices for each of the strongly connected subgraphs in
+ *               setIdxList.
+ *    setLengths A numSubgraphsX1 list of the number of vertices in each
+ *               subgraph.
+ *    setIdxList A list of indices of the vertices in a subgraph. The
+ *               vertices in the ith subgraph are given by
+ *               setIdxList(setStartList(i):(setStartList(i)+setLengths(i)-1))
+ *
+ *The outputs are the same as the first three outputs of
+ *findStronglyConnectedSubgraphs. The adjacency matrix of the ith subgraph,
+ *which is the fourth output of that function, can be obtained as
+ *adjMat(idx,idx), where idx holds the vertices of the subgraph. The same
+ *algorithm is used, but the graph is converted to compressed sparse row
+ *form and the depth-first search uses an explicit stack rather than
+ *recursion, as described in CSRGraphCPP.cpp, so the complexity is
+ *O(numVertices+numEdges) and graphs with millions of vertices can be
+ *handled.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[setStartList,setLengths,setIdxList]=findStronglyConnectedSubgraphsSparse(adjMat);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include <vector>
+#include "graphFuncs.hpp"
+#include "CSRGraphMatlab.h"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    CSRGraphCPP graph;
+    size_t numVertices, numSets, i;
+    vector<size_t> setStart, setIdx;
+    double *setStartList, *setLengths, *setIdxList;
+
+    if(nrhs!=1) {
+        mexErrMsgTxt("Wrong number of inputs.");
+    }
+
+    if(nlhs>3) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    CSRGraphFromMatlab(graph,prhs[0]);
+    numVertices=graph.numVertices;
+
+    setStart.resize(numVertices);
+    setIdx.resize(numVertices);
+    numSets=stronglyConnectedCSRCPP(&setStart[0],&setIdx[0],graph);
+
+    plhs[0]=mxCreateDoubleMatrix(numSets,1,mxREAL);
+    setStartList=mxGetPr(plhs[0]);
+    for(i=0;i<numSets;i++) {
+        setStartList[i]=(double)(setStart[i]+1);
+    }
+
+    if(nlhs>1) {
+        plhs[1]=mxCreateDoubleMatrix(numSets,1,mxREAL);
+        setLengths=mxGetPr(plhs[1]);
+        for(i=0;i<numSets;i++) {
+            const size_t setEnd=i+1<numSets?setStart[i+1]:numVertices;
+
+            setLengths[i]=(double)(setEnd-setStart[i]);
+        }
+
+        if(nlhs>2) {
+            plhs[2]=mxCreateDoubleMatrix(numVertices,1,mxREAL);
+            setIdxList=mxGetPr(plhs[2]);
+            for(i=0;i<numVertices;i++) {
+                setIdxList[i]=(double)(setIdx[i]+1);
+            }
+        }
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
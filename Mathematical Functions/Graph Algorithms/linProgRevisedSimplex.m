@@ -83,6 +83,11 @@ function [optCost,xOpt,exitFlag]=linProgRevisedSimplex(A,b,ALeq,bLeq,c,maximize,
 %potentially lead to redundant basis vectors being added. If this occurs,
 %then the algorithm reports as failing.
 %
+%For large, sparse problems, the compiled function
+%linProgRevisedSimplexSparse solves the same problem using a sparse
+%decomposition of the basis matrix and can be warm started from the basis
+%of a previous solution.
+%
 %As an example, consider the 2D assignment problem. Given a rectangular
 %cost matrix with more columns than rows, the goal is to choose one element
 %per row, and at most one element per column so as to minimize the sum of
@@ -0,0 +1,403 @@
+/**LINPROGREVISEDSIMPLEXSPARSE Use the revised simplex algorithm to solve
+ *                   a linear programming problem with large, sparse
+ *                   equality and/or inequality constraints. This solves
+ *                   the same problem as linProgRevisedSimplex:
+ *                   minimize (maximize) c'*x
+ *                   given     A*x=b
+ *                         ALeq*x<=bLeq
+ *                              x>=0
+ *                   but keeps the basis matrix in sparse form, so that
+ *                   problems with tens of thousands of variables, such as
+ *                   the relaxations of multidimensional assignment
+ *                   problems, can be solved. A basis from a previous call
+ *                   can be passed to warm start the algorithm.
+ *
+ *INPUTS: A An mXn matrix of equality constraints. This can be a full
+ *          matrix or a Matlab sparse matrix. If there are no equality
+ *          constraints, then use an empty matrix.
+ *        b A mX1 matrix of the right-hand side of the equality
+ *          constraints, or an empty matrix if there are no equality
+ *          constraints.
+ *     ALeq An mLeqXn matrix of the inequality constraints, which can be a
+ *          full matrix or a Matlab sparse matrix. If there are no
+ *          inequality constraints, then use an empty matrix.
+ *     bLeq A mLeqX1 matrix of the right-hand side of the inequality
+ *          constraints, or an empty matrix if there are no inequality
+ *          constraints.
+ *        c The nX1 cost vector. As in linProgRevisedSimplex, elements
+ *          that are Inf (-Inf when maximizing) force the corresponding
+ *          elements of x to be zero.
+ * maximize A boolean variable specifying whether the problem is to maximize
+ *          or minimize the cost function. The default if omitted or an
+ *          empty matrix is passed is false.
+ *  maxIter An optional parameter specifying the maximum number of
+ *          iterations to use. The default if omitted or an empty matrix
+ *          is passed is 5000 or ten times the number of constraints plus
+ *          variables, whichever is larger.
+ *  epsilon An optional parameter specifying a tolerance for declaring
+ *          values zero. The default if omitted or an empty matrix is
+ *          passed is 1e-9.
+ * basisInit An optional basis from a previous call to this function with
+ *          the same constraints, in the format of the basis output. If
+ *          the basis is nonsingular and feasible, which is the case if
+ *          only c has changed, then the algorithm starts from it rather
+ *          than from scratch, which is usually much faster. Otherwise, it
+ *          is ignored. If omitted or an empty matrix is passed, no warm
+ *          start is performed.
+ *
+ *OUTPUTS: optCost The optimal cost when the algorithm successfully
+ *                 terminates or when it terminates after having reached the
+ *                 maximum number of iterations. This is the
+ *                 minimum/maximum value of c'*x. If the cost is unbounded,
+ *                 then -Inf/Inf is returned. Otherwise, if the algorithm
+ *                 did not terminate successfully, then an empty matrix is
+ *                 returned.
+ *            xOpt The optimal vector x associated with the optimal cost.
+ *                 If the algorithm did not terminate successfully, then an
+ *                 empty matrix is returned.
+ *        exitFlag A flag indicating the status upon termination. The
+ *                 values are the same as in linProgRevisedSimplex:
+ *                 0 Successful termination.
+ *                 1 The cost is unbounded.
+ *                 2 Maximum number of iterations reached.
+ *                 3 Finite precision problems caused the basis matrix to
+ *                   become singular.
+ *                 4 The problem is not feasible.
+ *                 5 The subroutine to find the initial feasible basis
+ *                   failed.
+ *           basis A (m+mLeq)X1 vector of the indices of the basic
+ *                 variables when the algorithm terminates, which can be
+ *                 passed as basisInit in a subsequent call. Indices 1 to n
+ *                 are elements of x and n+1 to n+mLeq are the slack
+ *                 variables of the inequality constraints. An index
+ *                 n+mLeq+r is an artificial variable that is kept at zero
+ *                 because constraint r of [A;ALeq] is redundant. If the
+ *                 algorithm did not terminate successfully, then an empty
+ *                 matrix is returned.
+ *
+ *The implementation is described in sparseSimplexCPP.cpp. Rather than
+ *maintaining the dense inverse of the basis matrix as in
+ *linProgRevisedSimplex, a sparse LU decomposition of the basis matrix with
+ *product form updates is used. Redundant equality constraints are allowed
+ *and are not removed beforehand. Due to differences in the pivoting rules,
+ *a different optimal x can be found than with linProgRevisedSimplex if
+ *the solution is not unique, though the optimal cost is the same. If the
+ *code is compiled with OpenMP support, then the reduced costs are computed
+ *in parallel.
+ *
+ *As an example, the 2D assignment problem in the comments to
+ *linProgRevisedSimplex can be solved using
+ * [optCost,xOpt,exitFlag,basis]=linProgRevisedSimplexSparse(sparse(A),b,sparse(ALeq),bLeq,c)
+ *and if the costs then change slightly, the new problem can be solved
+ *starting from the previous solution using
+ * c1=c+0.1*rand(20,1);
+ * [optCost,xOpt]=linProgRevisedSimplexSparse(sparse(A),b,sparse(ALeq),bLeq,c1,[],[],[],basis)
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[optCost,xOpt,exitFlag,basis]=linProgRevisedSimplexSparse(A,b,ALeq,bLeq,c,maximize,maxIter,epsilon,basisInit);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For max
+#include <algorithm>
+//For infinity
+#include <limits>
+#include <vector>
+#include "MexValidation.h"
+#include "sparseSimplexCPP.hpp"
+#include "mex.h"
+
+using namespace std;
+
+//Prototypes for the helper functions.
+size_t checkConstraintMatrix(const mxArray *M,const mxArray *bMat,const size_t numVars);
+void appendMatlabColumn(vector<size_t> &rowIdx,vector<double> &vals,const mxArray *M,const size_t col,const size_t rowOffset);
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    const double inf=numeric_limits<double>::infinity();
+    size_t numVars, mEq, mLeq, m, n, maxIter, numIter, i, j;
+    bool maximize=false;
+    bool warmStart=false;
+    double epsilon=1e-9;
+    double optCost;
+    const double *cOrig;
+    vector<size_t> colStart, rowIdx, colVar, varCol, basis;
+    vector<double> vals, b, c, x;
+    int exitCode;
+
+    if(nrhs<5) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>9) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>4) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    checkRealDoubleArray(prhs[4]);
+    if(mxIsSparse(prhs[4])) {
+        mexErrMsgTxt("c cannot be a sparse matrix.");
+    }
+    numVars=mxGetNumberOfElements(prhs[4]);
+    cOrig=mxGetPr(prhs[4]);
+
+    mEq=checkConstraintMatrix(prhs[0],prhs[1],numVars);
+    mLeq=checkConstraintMatrix(prhs[2],prhs[3],numVars);
+    m=mEq+mLeq;
+
+    if(nrhs>5&&!mxIsEmpty(prhs[5])) {
+        maximize=getBoolFromMatlab(prhs[5]);
+    }
+
+    if(nrhs>6&&!mxIsEmpty(prhs[6])) {
+        maxIter=getSizeTFromMatlab(prhs[6]);
+    } else {
+        maxIter=max((size_t)5000,10*(m+numVars));
+    }
+
+    if(nrhs>7&&!mxIsEmpty(prhs[7])) {
+        epsilon=getDoubleFromMatlab(prhs[7]);
+    }
+
+    //Variables with infinite costs are removed from the problem. The
+    //columns that remain are followed by the slack variables of the
+    //inequality constraints. varCol holds the column of each original
+    //variable or numVars if it was removed.
+    varCol.resize(numVars);
+    for(j=0;j<numVars;j++) {
+        const double cCur=maximize?-cOrig[j]:cOrig[j];
+
+        if(cCur==-inf) {
+            plhs[0]=mxCreateDoubleScalar(maximize?inf:-inf);
+            if(nlhs>1) {
+                plhs[1]=mxCreateDoubleMatrix(0,0,mxREAL);
+            }
+            if(nlhs>2) {
+                plhs[2]=mxCreateDoubleScalar(1.0);
+            }
+            if(nlhs>3) {
+                plhs[3]=mxCreateDoubleMatrix(0,0,mxREAL);
+            }
+            return;
+        }
+
+        if(cCur==inf) {
+            varCol[j]=numVars;
+        } else {
+            varCol[j]=colVar.size();
+            colVar.push_back(j);
+            c.push_back(cCur);
+        }
+    }
+
+    n=colVar.size()+mLeq;
+    colStart.reserve(n+1);
+    colStart.push_back(0);
+    for(j=0;j<colVar.size();j++) {
+        if(mEq>0) {
+            appendMatlabColumn(rowIdx,vals,prhs[0],colVar[j],0);
+        }
+        if(mLeq>0) {
+            appendMatlabColumn(rowIdx,vals,prhs[2],colVar[j],mEq);
+        }
+        colStart.push_back(rowIdx.size());
+    }
+    for(i=0;i<mLeq;i++) {
+        rowIdx.push_back(mEq+i);
+        vals.push_back(1.0);
+        colStart.push_back(rowIdx.size());
+        c.push_back(0.0);
+    }
+
+    b.resize(m);
+    if(mEq>0) {
+        copy(mxGetPr(prhs[1]),mxGetPr(prhs[1])+mEq,b.begin());
+    }
+    if(mLeq>0) {
+        copy(mxGetPr(prhs[3]),mxGetPr(prhs[3])+mLeq,b.begin()+mEq);
+    }
+
+    //Convert the initial basis to the indices of the columns of the
+    //reduced problem. Bases involving removed variables cannot be used.
+    basis.resize(m);
+    if(nrhs>8&&!mxIsEmpty(prhs[8])) {
+        size_t *basisInit, numBasis;
+
+        basisInit=copySizeTArrayFromMatlab(prhs[8],&numBasis);
+        if(numBasis!=m) {
+            mxFree(basisInit);
+            mexErrMsgTxt("basisInit has the wrong dimensionality.");
+        }
+
+        warmStart=true;
+        for(i=0;i<m;i++) {
+            const size_t idx=basisInit[i];
+
+            if(idx<1||idx>numVars+mLeq+m) {
+                mxFree(basisInit);
+                mexErrMsgTxt("basisInit contains invalid indices.");
+            }
+
+            if(idx<=numVars) {
+                if(varCol[idx-1]==numVars) {
+                    warmStart=false;
+                }
+                basis[i]=varCol[idx-1];
+            } else {
+                //Slack and artificial variables.
+                basis[i]=colVar.size()+idx-1-numVars;
+            }
+        }
+        mxFree(basisInit);
+    }
+
+    x.resize(n);
+    {
+        //Empty vectors are not dereferenced when m or n is zero.
+        SparseSimplexCPP LP(m,n,&colStart[0],rowIdx.empty()?NULL:&rowIdx[0],vals.empty()?NULL:&vals[0],b.empty()?NULL:&b[0],c.empty()?NULL:&c[0]);
+
+        exitCode=LP.solve(x.empty()?NULL:&x[0],&optCost,basis.empty()?NULL:&basis[0],warmStart,maxIter,epsilon,&numIter);
+    }
+
+    if(exitCode==0||exitCode==2) {
+        mxArray *xMATLAB=mxCreateDoubleMatrix(numVars,1,mxREAL);
+        double *xOut=mxGetPr(xMATLAB);
+
+        for(j=0;j<colVar.size();j++) {
+            xOut[colVar[j]]=x[j];
+        }
+
+        plhs[0]=mxCreateDoubleScalar(maximize?-optCost:optCost);
+        if(nlhs>1) {
+            plhs[1]=xMATLAB;
+        } else {
+            mxDestroyArray(xMATLAB);
+        }
+
+        if(nlhs>3) {
+            double *basisOut;
+
+            plhs[3]=mxCreateDoubleMatrix(m,1,mxREAL);
+            basisOut=mxGetPr(plhs[3]);
+            for(i=0;i<m;i++) {
+                const size_t idx=basis[i];
+
+                if(idx<colVar.size()) {
+                    basisOut[i]=(double)(colVar[idx]+1);
+                } else {
+                    basisOut[i]=(double)(idx-colVar.size()+numVars+1);
+                }
+            }
+        }
+    } else {
+        if(exitCode==1) {
+            plhs[0]=mxCreateDoubleScalar(maximize?inf:-inf);
+        } else {
+            plhs[0]=mxCreateDoubleMatrix(0,0,mxREAL);
+        }
+
+        if(nlhs>1) {
+            plhs[1]=mxCreateDoubleMatrix(0,0,mxREAL);
+        }
+        if(nlhs>3) {
+            plhs[3]=mxCreateDoubleMatrix(0,0,mxREAL);
+        }
+    }
+
+    if(nlhs>2) {
+        plhs[2]=mxCreateDoubleScalar((double)exitCode);
+    }
+}
+
+size_t checkConstraintMatrix(const mxArray *M,const mxArray *bMat,const size_t numVars) {
+/*CHECKCONSTRAINTMATRIX Check that the constraint matrix M, which can be
+ *                      full or sparse, and the vector bMat have
+ *                      consistent dimensions, returning the number of
+ *                      constraints, which is zero if M is empty.
+ */
+    size_t numRows;
+
+    if(mxIsEmpty(M)) {
+        if(!mxIsEmpty(bMat)) {
+            mexErrMsgTxt("The right-hand side of the constraints is given without the constraint matrix.");
+        }
+        return 0;
+    }
+
+    checkRealDoubleArray(M);
+    numRows=mxGetM(M);
+    if(mxGetN(M)!=numVars) {
+        mexErrMsgTxt("The number of columns in the constraint matrices must equal the length of c.");
+    }
+
+    if(mxIsEmpty(bMat)) {
+        mexErrMsgTxt("The right-hand side of the constraints is missing.");
+    }
+    checkRealDoubleArray(bMat);
+    if(mxIsSparse(bMat)) {
+        mexErrMsgTxt("The right-hand side of the constraints cannot be a sparse matrix.");
+    }
+    if(mxGetNumberOfElements(bMat)!=numRows) {
+        mexErrMsgTxt("The right-hand side of the constraints has the wrong dimensionality.");
+    }
+
+    return numRows;
+}
+
+void appendMatlabColumn(vector<size_t> &rowIdx,vector<double> &vals,const mxArray *M,const size_t col,const size_t rowOffset) {
+/*APPENDMATLABCOLUMN Append the row indices, plus rowOffset, and the values
+ *                   of the nonzero elements in column col of the full or
+ *                   sparse Matlab matrix M to rowIdx and vals.
+ */
+    const double *MVals=mxGetPr(M);
+
+    if(mxIsSparse(M)) {
+        const mwIndex *Jc=mxGetJc(M);
+        const mwIndex *Ir=mxGetIr(M);
+        size_t curEl;
+
+        for(curEl=Jc[col];curEl<Jc[col+1];curEl++) {
+            if(MVals[curEl]!=0) {
+                rowIdx.push_back(Ir[curEl]+rowOffset);
+                vals.push_back(MVals[curEl]);
+            }
+        }
+    } else {
+        const size_t numRows=mxGetM(M);
+        size_t i;
+
+        MVals+=numRows*col;
+        for(i=0;i<numRows;i++) {
+            if(MVals[i]!=0) {
+                rowIdx.push_back(i+rowOffset);
+                vals.push_back(MVals[i]);
+            }
+        }
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,102 @@
+/**MINSPANNINGTREEEUCLID Given a set of points, find the minimum spanning
+ *             tree between the points under the Euclidean distance. This
+ *             is a set of lines connecting all of the points such that the
+ *             sum of the lengths of the lines is minimized. Unlike
+ *             minSpanningTreeFromPoints, the matrix of all pairwise
+ *             distances is never formed, so large sets of points can be
+ *             handled.
+ *
+ *INPUTS: points A numDimXN matrix of N points.
+ *
+ *OUTPUTS: treeEdgeIdx A (N-1)X1 set of indices such that the ith edge of
+ *                     the minimum spanning tree is (i, treeEdgeIdx(i)),
+ *                     where i refers to the ith point and treeEdgeIdx(i)
+ *                     provides the index of the point to which the edge
+ *                     connects, as in minSpanningTreeFromPoints. The tree
+ *                     is rooted at the last point.
+ *         edgeLengths The (N-1)X1 lengths of the edges in treeEdgeIdx.
+ *
+ *Boruvka's algorithm is used, where the shortest edge leaving each
+ *component of the forest found so far is obtained by nearest neighbor
+ *searches in a kd-tree, as described in EuclideanMSTCPP.cpp. The
+ *complexity is typically O(N*log(N)^2) in low dimensions, rather than the
+ *O(N^2) of minSpanningTreeFromPoints. If the code is compiled with OpenMP
+ *support, then the searches are run in parallel. If several spanning trees
+ *have the same length, the one found can differ from that of
+ *minSpanningTreeFromPoints.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[treeEdgeIdx,edgeLengths]=minSpanningTreeEuclid(points);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include <vector>
+#include "MexValidation.h"
+#include "graphFuncs.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t numDim, N, i;
+    vector<size_t> parentIdx;
+    vector<double> edgeLengths;
+    double *treeEdgeIdx;
+
+    if(nrhs!=1) {
+        mexErrMsgTxt("Wrong number of inputs.");
+    }
+
+    if(nlhs>2) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    checkRealDoubleArray(prhs[0]);
+    numDim=mxGetM(prhs[0]);
+    N=mxGetN(prhs[0]);
+
+    if(N<2) {
+        plhs[0]=mxCreateDoubleMatrix(0,1,mxREAL);
+        if(nlhs>1) {
+            plhs[1]=mxCreateDoubleMatrix(0,1,mxREAL);
+        }
+        return;
+    }
+
+    parentIdx.resize(N);
+    edgeLengths.resize(N);
+    EuclideanMSTCPP(&parentIdx[0],&edgeLengths[0],mxGetPr(prhs[0]),numDim,N);
+
+    plhs[0]=mxCreateDoubleMatrix(N-1,1,mxREAL);
+    treeEdgeIdx=mxGetPr(plhs[0]);
+    for(i=0;i<N-1;i++) {
+        treeEdgeIdx[i]=(double)(parentIdx[i]+1);
+    }
+
+    if(nlhs>1) {
+        plhs[1]=doubleMat2Matlab(&edgeLengths[0],N-1,1);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -23,7 +23,9 @@ function treeEdgeIdx=minSpanningTreeFromPoints(distMat)
 %described in Chapter 23.2 of
 %T. H. Cormen, C. E. Leiserson, R. L. Rivest, and C. Stein, Introduction to
 %Algorithms, 2nd ed. Cambridge, MA: The MIT Press, 2001.
-%is more efficient.
+%is more efficient. For points in Euclidean space, the compiled function
+%minSpanningTreeEuclid finds the tree from the points themselves using a
+%kd-tree without forming the matrix of all pairwise distances.
 %
 %December 2014 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
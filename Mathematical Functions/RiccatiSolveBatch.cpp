@@ -0,0 +1,253 @@
+/**RICCATISOLVEBATCH Solve many discrete-time or continuous-time algebraic
+ *                   Riccati equations using a compiled doubling
+ *                   algorithm. This is a compiled alternative to calling
+ *                   RiccatiSolveD or RiccatiSolveC in a loop, for example
+ *                   when finding the steady-state covariances of many
+ *                   linear Kalman filters.
+ *
+ *INPUTS: isDiscrete A boolean value. If true, the discrete-time equation
+ *                solved by RiccatiSolveD is solved. Otherwise, the
+ *                continuous-time equation solved by RiccatiSolveC is
+ *                solved.
+ *              A Either a single nXn matrix, or an nXnXnumProb
+ *                hypermatrix holding a different matrix for each problem.
+ *              B Either a single nXm matrix or an nXmXnumProb hypermatrix.
+ *              Q Either a single nXn matrix or an nXnXnumProb hypermatrix.
+ *                The matrices must be symmetric with non-negative
+ *                eigenvalues.
+ *              R Either a single mXm matrix or an mXmXnumProb hypermatrix.
+ *                The matrices must be symmetric and invertible. If omitted
+ *                or an empty matrix is passed, eye(m) is used.
+ *              S Either a single nXm matrix or an nXmXnumProb hypermatrix.
+ *                If omitted or an empty matrix is passed, zeros(n,m) is
+ *                used.
+ *              E Either a single nXn matrix or an nXnXnumProb hypermatrix.
+ *                The matrices must be invertible. If omitted or an empty
+ *                matrix is passed, eye(n) is used.
+ *        maxIter The maximum number of doubling iterations to perform. If
+ *                omitted or an empty matrix is passed, the default of 100
+ *                is used. Since the convergence is quadratic, far fewer
+ *                iterations are usually needed.
+ *            tol The relative tolerance for convergence. The iteration
+ *                stops when the largest change in any element of X is
+ *                less than or equal to tol times the largest element of
+ *                X. If omitted or an empty matrix is passed, the default
+ *                of 1e-13 is used.
+ *
+ *The number of problems numProb is the largest number of matrices in the
+ *third dimension of any of the inputs. All inputs having more than one
+ *matrix must have numProb matrices.
+ *
+ *OUTPUTS: X The nXnXnumProb solutions of the Riccati equations. If a
+ *           problem could not be solved, its solution is filled with NaNs.
+ *  exitCode A numProbX1 vector of codes indicating how the solution of
+ *           each problem terminated. Possible values are
+ *           0 The algorithm converged.
+ *           1 A singular matrix was encountered. This happens if R or E
+ *             is singular or if the problem has no stabilizing solution.
+ *           2 The maximum number of iterations elapsed without
+ *             convergence. The last iterate is returned in X.
+ *   numIter A numProbX1 vector of the number of iterations performed for
+ *           each problem.
+ *
+ *The functions RiccatiSolveD and RiccatiSolveC use the generalized
+ *eigenvalue approach of Arnold and Laub, which requires the QZ
+ *decomposition. Here, the structure-preserving doubling algorithm is used
+ *instead, with the Cayley transform being used to convert the continuous-
+ *time problem into a discrete-time one. It only requires matrix
+ *multiplications and inversions and converges quadratically. See the
+ *comments in the file RiccatiSolveCPP.cpp for details and references.
+ *Unlike RiccatiSolveD and RiccatiSolveC, R must be invertible. If the code
+ *is compiled with OpenMP support, then the loop over the problems is run
+ *in parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[X,exitCode,numIter]=RiccatiSolveBatch(isDiscrete,A,B,Q,R,S,E,maxIter,tol);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For fill_n
+#include <algorithm>
+#include "MexValidation.h"
+#include "matrixFuncs.hpp"
+#include "mex.h"
+
+using namespace std;
+
+size_t getNumMats(const mxArray *mat,const size_t numRow,const size_t numCol);
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    bool isDiscrete;
+    size_t n, m, numProb, maxIter=100;
+    size_t numA, numB, numQ, numR=1, numS=1, numE=1;
+    double tol=1e-13;
+    const double *A, *B, *Q, *R=NULL, *S=NULL, *E=NULL;
+    mxArray *XMATLAB, *exitCodeMATLAB, *numIterMATLAB;
+    double *X, *exitCode, *numIterOut;
+    mwSize dims[3];
+    const double NaNVal=mxGetNaN();
+
+    if(nrhs<4) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>9) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>3) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    isDiscrete=getBoolFromMatlab(prhs[0]);
+
+    checkRealDoubleHypermatrix(prhs[1]);
+    checkRealDoubleHypermatrix(prhs[2]);
+    checkRealDoubleHypermatrix(prhs[3]);
+    n=mxGetM(prhs[1]);
+    m=mxGetDimensions(prhs[2])[1];
+    if(n==0||m==0) {
+        mexErrMsgTxt("A and B cannot be empty.");
+    }
+
+    numA=getNumMats(prhs[1],n,n);
+    numB=getNumMats(prhs[2],n,m);
+    numQ=getNumMats(prhs[3],n,n);
+    A=(double*)mxGetData(prhs[1]);
+    B=(double*)mxGetData(prhs[2]);
+    Q=(double*)mxGetData(prhs[3]);
+
+    if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+        checkRealDoubleHypermatrix(prhs[4]);
+        numR=getNumMats(prhs[4],m,m);
+        R=(double*)mxGetData(prhs[4]);
+    }
+
+    if(nrhs>5&&!mxIsEmpty(prhs[5])) {
+        checkRealDoubleHypermatrix(prhs[5]);
+        numS=getNumMats(prhs[5],n,m);
+        S=(double*)mxGetData(prhs[5]);
+    }
+
+    if(nrhs>6&&!mxIsEmpty(prhs[6])) {
+        checkRealDoubleHypermatrix(prhs[6]);
+        numE=getNumMats(prhs[6],n,n);
+        E=(double*)mxGetData(prhs[6]);
+    }
+
+    if(nrhs>7&&!mxIsEmpty(prhs[7])) {
+        maxIter=getSizeTFromMatlab(prhs[7]);
+    }
+
+    if(nrhs>8&&!mxIsEmpty(prhs[8])) {
+        tol=getDoubleFromMatlab(prhs[8]);
+    }
+
+    numProb=max(max(max(numA,numB),max(numQ,numR)),max(numS,numE));
+    if((numA!=1&&numA!=numProb)||(numB!=1&&numB!=numProb)||(numQ!=1&&numQ!=numProb)||(numR!=1&&numR!=numProb)||(numS!=1&&numS!=numProb)||(numE!=1&&numE!=numProb)) {
+        mexErrMsgTxt("The hypermatrix inputs have inconsistent numbers of matrices.");
+    }
+
+    dims[0]=n;
+    dims[1]=n;
+    dims[2]=numProb;
+    XMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+    X=(double*)mxGetData(XMATLAB);
+    exitCodeMATLAB=mxCreateDoubleMatrix(numProb,1,mxREAL);
+    exitCode=(double*)mxGetData(exitCodeMATLAB);
+    numIterMATLAB=mxCreateDoubleMatrix(numProb,1,mxREAL);
+    numIterOut=(double*)mxGetData(numIterMATLAB);
+
+    //The problems are independent, so they are solved in parallel if
+    //OpenMP is available. Each thread has its own scratch space.
+    #pragma omp parallel
+    {
+        double *scratch=new double[8*n*n+2*m*m+3*n*m];
+        size_t *pivot=new size_t[max(n,m)];
+        ptrdiff_t curProb;
+
+        #pragma omp for schedule(dynamic)
+        for(curProb=0;curProb<(ptrdiff_t)numProb;curProb++) {
+            double *XCur=X+curProb*n*n;
+            const double *ACur=A+(numA==1?0:curProb*n*n);
+            const double *BCur=B+(numB==1?0:curProb*n*m);
+            const double *QCur=Q+(numQ==1?0:curProb*n*n);
+            const double *RCur=R==NULL?NULL:R+(numR==1?0:curProb*m*m);
+            const double *SCur=S==NULL?NULL:S+(numS==1?0:curProb*n*m);
+            const double *ECur=E==NULL?NULL:E+(numE==1?0:curProb*n*n);
+            size_t numIter;
+            int curExitCode;
+
+            if(isDiscrete) {
+                curExitCode=RiccatiSolveDCPP(XCur,&numIter,scratch,pivot,ACur,BCur,QCur,RCur,SCur,ECur,n,m,maxIter,tol);
+            } else {
+                curExitCode=RiccatiSolveCCPP(XCur,&numIter,scratch,pivot,ACur,BCur,QCur,RCur,SCur,ECur,n,m,maxIter,tol);
+            }
+
+            if(curExitCode==1) {
+                fill_n(XCur,n*n,NaNVal);
+            }
+
+            exitCode[curProb]=curExitCode;
+            numIterOut[curProb]=(double)numIter;
+        }
+
+        delete[] pivot;
+        delete[] scratch;
+    }
+
+    plhs[0]=XMATLAB;
+    switch(nlhs) {
+        case 3:
+            plhs[2]=numIterMATLAB;
+        case 2:
+            plhs[1]=exitCodeMATLAB;
+        default:
+            break;
+    }
+
+    if(nlhs<3) {
+        mxDestroyArray(numIterMATLAB);
+    }
+    if(nlhs<2) {
+        mxDestroyArray(exitCodeMATLAB);
+    }
+}
+
+size_t getNumMats(const mxArray *mat,const size_t numRow,const size_t numCol) {
+/*GETNUMMATS Verify that a matrix is either numRowXnumCol or
+ *           numRowXnumColXnumMats and return numMats, which is 1 for a
+ *           single matrix.
+ */
+    const mwSize numDims=mxGetNumberOfDimensions(mat);
+    const mwSize *dims=mxGetDimensions(mat);
+
+    if(dims[0]!=numRow||dims[1]!=numCol||numDims>3) {
+        mexErrMsgTxt("A matrix input has the wrong dimensionality.");
+    }
+
+    return numDims==2?1:dims[2];
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
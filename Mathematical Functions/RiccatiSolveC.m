@@ -31,6 +31,10 @@ function X=RiccatiSolveC(A,B,Q,R,S,E)
 %Y. Bar-Shalom, X. R. Li, and T. Kirubarajan, Estimation with Applications
 %to Tracking and Navigation. New York: John Wiley and Sons, Inc, 2001.
 %
+%When many Riccati equations have to be solved, the compiled function
+%RiccatiSolveBatch can be used instead. It solves the problems in parallel
+%using a doubling algorithm, but requires R to be invertible.
+%
 %October 2013 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
@@ -0,0 +1,256 @@
+/**ODEFUNCS A header file for C++ implementations of adaptive methods for
+ *          integrating ordinary differential equations and for the
+ *          interface that dynamic models must implement to be integrated.
+ *          See the file ODEIntegratorCPP.cpp for more details on the
+ *          algorithms.
+ *
+ *The integrators here are compiled counterparts of the Matlab functions
+ *RKAdaptiveOverRange, RKNAdaptiveOverRange and
+ *RosenbrockAdaptiveOverRange, except that rather than calling a Matlab
+ *function handle for the derivatives, they call a C++ class derived from
+ *ODEDynamicsCPP. Since no Matlab functions are called, integrations of
+ *different trajectories can be run in parallel, as long as each thread
+ *uses its own ODEScratchCPP instance.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef ODEFUNCSCPP
+#define ODEFUNCSCPP
+#include <stddef.h>
+
+//Only pointers to ClusterSetCPP are used here, so the header does not have
+//to be included by files that do not use the orbit model.
+template<typename T>
+class ClusterSetCPP;
+
+/**The ODEDynamicsCPP class is the interface for the function f(x,t) in
+ * the differential equation dx/dt=f(x,t). Derived classes must implement
+ * f. For use with the Runge-Kutta-Nystroem integrator, the state must have
+ * the form x=[p;dpdt] and the second derivative of p must not depend on
+ * dpdt, in which case the class should override hasSpecialSecondOrderForm
+ * and secondDeriv. The Jacobian is used by the Rosenbrock integrators. The
+ * default implementation uses finite differences. All of the functions
+ * must be safe to call from multiple threads at once.
+ **/
+class ODEDynamicsCPP {
+public:
+    size_t xDim;
+
+    ODEDynamicsCPP(const size_t xDimDes) : xDim(xDimDes) {}
+    //dxdt=f(x,t).
+    virtual void f(double *dxdt,const double *x,const double t) const=0;
+    virtual bool hasSpecialSecondOrderForm() const;
+    //d2pdt2=g(p,t) where p is the first xDim/2 elements of the state.
+    virtual void secondDeriv(double *d2pdt2,const double *p,const double t) const;
+    //J=df/dx, which is xDimXxDim, and dfdt=df/dt at the point (x,t).
+    //scratch must have space for 3*xDim doubles.
+    virtual void jacobian(double *J,double *dfdt,const double *x,const double t,double *scratch) const;
+    virtual ~ODEDynamicsCPP() {}
+};
+
+/**The LinearDynamicsCPP class implements the linear time-invariant
+ * model dx/dt=A*x, where A is stored by column. The matrix A is not
+ * copied.
+ **/
+class LinearDynamicsCPP : public ODEDynamicsCPP {
+public:
+    const double *A;
+
+    LinearDynamicsCPP(const size_t xDimDes,const double *ADes) : ODEDynamicsCPP(xDimDes), A(ADes) {}
+    void f(double *dxdt,const double *x,const double t) const;
+    void jacobian(double *J,double *dfdt,const double *x,const double t,double *scratch) const;
+};
+
+/**The OrbitDynamicsCPP class implements the motion of an object orbiting
+ * the Earth in an Earth-centered inertial coordinate system where the
+ * Earth rotates about the z axis. The state is x=[r;v], where r is the
+ * 3X1 position and v is the 3X1 velocity. If C and S are NULL, then the
+ * gravitational acceleration is the two-body acceleration -GM*r/norm(r)^3.
+ * Otherwise, C and S hold fully normalized spherical harmonic gravity
+ * coefficients as in the Matlab function spherHarmonicEval with reference
+ * radius a and the acceleration is the gradient of the potential computed
+ * by spherHarmonicEvalCPP in the rotating frame, which is at angle
+ * theta0+omega*t about the z axis with respect to the inertial frame.
+ * Atmospheric drag, which is omitted if rho0=0, is
+ * -(1/(2*BC))*rho*norm(vRel)*vRel, where BC is the ballistic coefficient
+ * (mass divided by the drag coefficient times the area), vRel is the
+ * velocity with respect to an atmosphere that rotates with the Earth and
+ * the density is rho=rho0*exp(-(norm(r)-r0)/H). The pointers to the
+ * coefficients are not copied. The Jacobian is analytic for point-mass
+ * gravity and uses finite differences with spherical harmonic gravity.
+ **/
+class OrbitDynamicsCPP : public ODEDynamicsCPP {
+public:
+    double GM;
+    const ClusterSetCPP<double> *C;
+    const ClusterSetCPP<double> *S;
+    double a;
+    double omega;
+    double theta0;
+    double BC;
+    double rho0;
+    double r0;
+    double H;
+
+    OrbitDynamicsCPP() : ODEDynamicsCPP(6), GM(0), C(NULL), S(NULL), a(0), omega(0), theta0(0), BC(1), rho0(0), r0(0), H(1) {}
+    void f(double *dxdt,const double *x,const double t) const;
+    bool hasSpecialSecondOrderForm() const;
+    void secondDeriv(double *d2pdt2,const double *p,const double t) const;
+    void jacobian(double *J,double *dfdt,const double *x,const double t,double *scratch) const;
+private:
+    void gravAccel(double *acc,const double *r,const double t) const;
+};
+
+//The integration methods.
+enum ODEMethodCPP {
+    //The Bogacki-Shampine Runge-Kutta 3(2) pair.
+    ODE_RK32=0,
+    //The Dormand-Prince Runge-Kutta 5(4) pair.
+    ODE_RK54=1,
+    //The RKN5(4)5F Runge-Kutta-Nystroem pair for the special second order
+    //problem.
+    ODE_RKN54=2,
+    //The Rosenbrock 2(3) formula used in Matlab's ode23s.
+    ODE_ROSENBROCK23=3,
+    //The Rosenbrock 3(4) formula of Shampine.
+    ODE_ROSENBROCK34=4
+};
+
+/**The ODEIntParamCPP class holds the parameters of the adaptive
+ * integrators. The meanings of RelTol, AbsTol and maxSteps are the same as
+ * in the Matlab function RKAdaptiveOverRange. If initStepSize<=0, an
+ * initial step size is chosen automatically.
+ **/
+class ODEIntParamCPP {
+public:
+    ODEMethodCPP method;
+    double RelTol;
+    double AbsTol;
+    double initStepSize;
+    size_t maxSteps;
+
+    ODEIntParamCPP() : method(ODE_RK54), RelTol(1e-3), AbsTol(1e-6), initStepSize(0), maxSteps(1024) {}
+};
+
+/* The ODEScratchCPP class holds the scratch space for the integrators so
+ * that integrating many trajectories does not require repeated memory
+ * allocation.
+ */
+class ODEScratchCPP {
+public:
+    char *buffer;
+    size_t xDim;
+    //Up to 7 stage derivatives of length xDim.
+    double *K;
+    //Vectors of length xDim.
+    double *xCur;
+    double *xNew;
+    double *xErr;
+    double *xTemp;
+    double *dxdtCur;
+    double *dxdtNew;
+    double *dfdt;
+    //Space for 3*xDim doubles for the Jacobian routine.
+    double *jacobScratch;
+    //Matrices of size xDimXxDim.
+    double *J;
+    double *W;
+    size_t *pivot;
+
+    ODEScratchCPP(){
+        buffer=NULL;
+    }
+
+    ODEScratchCPP(const size_t xDimDes){
+        buffer=NULL;
+        this->init(xDimDes);
+    }
+
+    void init(const size_t xDimDes){
+        char *basePtr;
+        const size_t numDoubles=17*xDimDes+2*xDimDes*xDimDes;
+
+        if(buffer!=NULL) {
+            delete[] buffer;
+        }
+
+        xDim=xDimDes;
+        buffer=new char[numDoubles*sizeof(double)+xDim*sizeof(size_t)];
+        basePtr=buffer;
+        K=(double*)basePtr;
+        basePtr+=sizeof(double)*7*xDim;
+        xCur=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim;
+        xNew=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim;
+        xErr=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim;
+        xTemp=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim;
+        dxdtCur=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim;
+        dxdtNew=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim;
+        dfdt=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim;
+        jacobScratch=(double*)basePtr;
+        basePtr+=sizeof(double)*3*xDim;
+        J=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim*xDim;
+        W=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim*xDim;
+        pivot=(size_t*)basePtr;
+    }
+
+    ~ODEScratchCPP(){
+        if(buffer!=NULL) {
+            delete[] buffer;
+        }
+    }
+private:
+    //Copying is not allowed, because the buffer would be freed twice.
+    ODEScratchCPP(const ODEScratchCPP &);
+    ODEScratchCPP &operator=(const ODEScratchCPP &);
+};
+
+int ODEAdaptiveAtTimesCPP(double *xOut,
+                          size_t *numSteps,
+                          const ODEDynamicsCPP &dyn,
+                          const double *xStart,
+                          const double tStart,
+                          const double *tOut,
+                          const size_t numOut,
+                          const ODEIntParamCPP &param,
+                          ODEScratchCPP &workMem);
+/*ODEADAPTIVEATTIMESCPP Integrate dx/dt=f(x,t) from (xStart,tStart)
+ *              with an adaptive step size and place the state at each of
+ *              the numOut times in tOut into the columns of xOut using the
+ *              dense output of the method. The times in tOut must be
+ *              sorted in the direction of integration. The return value is
+ *              an exit code with the same meaning as in the Matlab
+ *              function RKAdaptiveOverRange, or 4 if ODE_RKN54 is used
+ *              with a model that does not have the special second order
+ *              form. The number of steps taken is put in numSteps.
+ */
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,748 @@
+/*ODEINTEGRATORCPP C++ implementations of adaptive explicit Runge-Kutta,
+ *                 Runge-Kutta-Nystroem and Rosenbrock integrators with
+ *                 dense output. These are compiled counterparts of the
+ *                 Matlab functions RKAdaptiveOverRange,
+ *                 RKNAdaptiveOverRange and RosenbrockAdaptiveOverRange
+ *                 that call C++ dynamic models derived from
+ *                 ODEDynamicsCPP rather than Matlab function handles.
+ *
+ *The step size control is the same as in the Matlab function
+ *performOneAdaptiveRKStep, which is described in RKAdaptiveOverRange,
+ *except that when no initial step size is given, the initial step size is
+ *chosen using the algorithm of [1] rather than dividing the integration
+ *region by the maximum number of steps. Rather than saving every step, the
+ *states at arbitrary output times are obtained from the dense output of
+ *the method over the step that contains each time. The methods available
+ *are:
+ *ODE_RK32 The Bogacki-Shampine 3(2) pair of [2], which is FSAL, with its
+ *         third-order continuous extension.
+ *ODE_RK54 The Dormand-Prince 5(4) pair of [3], which is FSAL, with the
+ *         fourth-order continuous extension of [4].
+ *ODE_RKN54 The RKN5(4)5F Runge-Kutta-Nystroem pair that is
+ *         solutionChoice=1 for order 5 in the Matlab function
+ *         RungeKNystroemSStep. This is for the special second-order
+ *         problem, where the state is [p;dpdt] and d2pdt2 does not depend
+ *         on dpdt. It only evaluates the second derivative of p. Dense
+ *         output is obtained by quintic Hermite interpolation of p using
+ *         its first and second derivatives at both ends of the step.
+ *ODE_ROSENBROCK23 The Rosenbrock 2(3) formula of [5], which is the same as
+ *         order 2 in the Matlab function RosenbrockStep. Dense output is
+ *         by cubic Hermite interpolation.
+ *ODE_ROSENBROCK34 The Rosenbrock 3(4) formula of [6], which is the same
+ *         as order 3 in the Matlab function RosenbrockStep. Dense output
+ *         is by cubic Hermite interpolation.
+ *The Rosenbrock methods are for stiff problems and use the Jacobian of the
+ *dynamic model, which is evaluated once per step.
+ *
+ *The exit codes are the same as in RKAdaptiveOverRange with the addition
+ *of code 4, which indicates that the RKN method was chosen with a dynamic
+ *model that does not have the special second order form.
+ *
+ *REFERENCES:
+ *[1] E. Hairer, S. P. Norsett, and G. Wanner, Solving Ordinary
+ *    Differential Equations I: Nonstiff Problems, 2nd ed. Berlin:
+ *    Springer-Verlag, 1993, Chapter II.4.
+ *[2] P. Bogacki and L. F. Shampine, "A 3(2) pair of Runge-Kutta
+ *    formulas," Applied Mathematics Letters, vol. 2, no. 4, pp. 321-325,
+ *    1989.
+ *[3] J. R. Dormand and P. J. Prince, "A family of embedded Runge-Kutta
+ *    formulae," Journal of Computational and Applied Mathematics, vol. 6,
+ *    no. 1, pp. 19-26, Mar. 1980.
+ *[4] L. F. Shampine, "Some practical Runge-Kutta formulas," Mathematics of
+ *    Computation, vol. 46, no. 173, pp. 135-150, Jan. 1986.
+ *[5] L. F. Shampine and M. W. Reichelt, "The Matlab ODE suite," Journal on
+ *    Scientific Computing, vol. 18, no. 1, pp. 1-22, Jan. 1997.
+ *[6] L. F. Shampine, "Implementation of Rosenbrock methods," ACM
+ *    Transactions on Mathematical Software, vol. 8, no. 2, pp. 93-113,
+ *    Jun. 1982.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+**/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy, fill_n, min and max
+#include <algorithm>
+//For fabs, sqrt and pow
+#include <math.h>
+//For DBL_EPSILON and DBL_MIN
+#include <float.h>
+#include "ODEFuncs.hpp"
+#include "matrixFuncs.hpp"
+
+using namespace std;
+
+//The Bogacki-Shampine 3(2) pair. The error coefficients are the
+//differences between the main and subsidiary weights including the FSAL
+//stage.
+static const double RK32C[3]={0.0,1.0/2.0,3.0/4.0};
+static const double RK32A[3][3]={{0,0,0},
+                                 {1.0/2.0,0,0},
+                                 {0,3.0/4.0,0}};
+static const double RK32B[3]={2.0/9.0,1.0/3.0,4.0/9.0};
+static const double RK32E[4]={5.0/72.0,-1.0/12.0,-1.0/9.0,1.0/8.0};
+//The coefficients of the continuous extension. The interpolated value at
+//fraction theta of the step is x+h*sum_i K_i*sum_j RK32P[i][j]*theta^(j+1).
+static const double RK32P[4][3]={{1.0,-4.0/3.0,5.0/9.0},
+                                 {0,1.0,-2.0/3.0},
+                                 {0,4.0/3.0,-8.0/9.0},
+                                 {0,-1.0,1.0}};
+
+//The Dormand-Prince 5(4) pair.
+static const double RK54C[6]={0.0,1.0/5.0,3.0/10.0,4.0/5.0,8.0/9.0,1.0};
+static const double RK54A[6][5]={{0,0,0,0,0},
+                                 {1.0/5.0,0,0,0,0},
+                                 {3.0/40.0,9.0/40.0,0,0,0},
+                                 {44.0/45.0,-56.0/15.0,32.0/9.0,0,0},
+                                 {19372.0/6561.0,-25360.0/2187.0,64448.0/6561.0,-212.0/729.0,0},
+                                 {9017.0/3168.0,-355.0/33.0,46732.0/5247.0,49.0/176.0,-5103.0/18656.0}};
+static const double RK54B[6]={35.0/384.0,0,500.0/1113.0,125.0/192.0,-2187.0/6784.0,11.0/84.0};
+static const double RK54E[7]={-71.0/57600.0,0,71.0/16695.0,-71.0/1920.0,17253.0/339200.0,-22.0/525.0,1.0/40.0};
+static const double RK54P[7][4]={{1.0,-8048581381.0/2820520608.0,8663915743.0/2820520608.0,-12715105075.0/11282082432.0},
+                                 {0,0,0,0},
+                                 {0,131558114200.0/32700410799.0,-68118460800.0/10900136933.0,87487479700.0/32700410799.0},
+                                 {0,-1754552775.0/470086768.0,14199869525.0/1410260304.0,-10690763975.0/1880347072.0},
+                                 {0,127303824393.0/49829197408.0,-318862633887.0/49829197408.0,701980252875.0/199316789632.0},
+                                 {0,-282668133.0/205662961.0,2019193451.0/616988883.0,-1453857185.0/822651844.0},
+                                 {0,40617522.0/29380423.0,-110615467.0/29380423.0,69997945.0/29380423.0}};
+
+//The RKN5(4)5F pair. bHat and bPHat are the main weights for the position
+//and the velocity and b and bP are the subsidiary weights.
+static const double RKN54C[6]={0.0,1.0/8.0,1.0/4.0,1.0/2.0,3.0/4.0,1.0};
+static const double RKN54A[6][5]={{0,0,0,0,0},
+                                  {1.0/128.0,0,0,0,0},
+                                  {1.0/96.0,1.0/48.0,0,0,0},
+                                  {1.0/24.0,0,1.0/12.0,0,0},
+                                  {9.0/128.0,0,9.0/64.0,9.0/128.0,0},
+                                  {7.0/90.0,0,4.0/15.0,1.0/15.0,4.0/45.0}};
+static const double RKN54BHat[6]={7.0/90.0,0,4.0/15.0,1.0/15.0,4.0/45.0,0};
+static const double RKN54BPHat[6]={7.0/90.0,0,16.0/45.0,2.0/15.0,16.0/45.0,7.0/90.0};
+static const double RKN54B[6]={1.0/6.0,0,0,1.0/3.0,0,0};
+static const double RKN54BP[6]={0,0,2.0/3.0,-1.0/3.0,2.0/3.0,0};
+
+static size_t methodOrder(const ODEMethodCPP method);
+static bool methodIsFSAL(const ODEMethodCPP method);
+static bool tryStep(bool *isSingular,const ODEDynamicsCPP &dyn,const double t,const double deltaT,const ODEMethodCPP method,ODEScratchCPP &workMem);
+static void denseOutput(double *xInterp,const ODEDynamicsCPP &dyn,const double theta,const double deltaT,const ODEMethodCPP method,ODEScratchCPP &workMem);
+static double initialStepSize(const ODEDynamicsCPP &dyn,const double t,const double tDiffMag,const ODEIntParamCPP &param,ODEScratchCPP &workMem);
+static bool isFiniteVal(const double val);
+
+bool ODEDynamicsCPP::hasSpecialSecondOrderForm() const {
+    return false;
+}
+
+void ODEDynamicsCPP::secondDeriv(double *d2pdt2,const double *p,const double t) const {
+/*SECONDDERIV The default implementation, which is only valid if
+ *            hasSpecialSecondOrderForm is true, evaluates f with the
+ *            velocity components set to zero. This is only called by the
+ *            integrators when hasSpecialSecondOrderForm returns true;
+ *            derived classes should override it with a more efficient
+ *            version.
+ */
+    const size_t halfDim=xDim/2;
+    double *x=new double[2*xDim];
+    double *dxdt=x+xDim;
+
+    copy(p,p+halfDim,x);
+    fill_n(x+halfDim,halfDim,0.0);
+    f(dxdt,x,t);
+    copy(dxdt+halfDim,dxdt+xDim,d2pdt2);
+    delete[] x;
+}
+
+void ODEDynamicsCPP::jacobian(double *J,double *dfdt,const double *x,const double t,double *scratch) const {
+/*JACOBIAN The default implementation uses forward differences.
+ */
+    const double sqrtEps=sqrt(DBL_EPSILON);
+    double *xPert=scratch;
+    double *f0=scratch+xDim;
+    double *f1=scratch+2*xDim;
+    double delta;
+    size_t i, j;
+
+    f(f0,x,t);
+    copy(x,x+xDim,xPert);
+    for(j=0;j<xDim;j++) {
+        delta=sqrtEps*max(fabs(x[j]),1.0);
+        xPert[j]=x[j]+delta;
+        //Get the actual difference, which can differ from delta due to
+        //finite precision effects.
+        delta=xPert[j]-x[j];
+        f(f1,xPert,t);
+        for(i=0;i<xDim;i++) {
+            J[i+j*xDim]=(f1[i]-f0[i])/delta;
+        }
+        xPert[j]=x[j];
+    }
+
+    delta=sqrtEps*max(fabs(t),1.0);
+    delta=(t+delta)-t;
+    f(f1,x,t+delta);
+    for(i=0;i<xDim;i++) {
+        dfdt[i]=(f1[i]-f0[i])/delta;
+    }
+}
+
+void LinearDynamicsCPP::f(double *dxdt,const double *x,const double t) const {
+    matVecMultCPP(dxdt,A,x,xDim,xDim);
+}
+
+void LinearDynamicsCPP::jacobian(double *J,double *dfdt,const double *x,const double t,double *scratch) const {
+    copy(A,A+xDim*xDim,J);
+    fill_n(dfdt,xDim,0.0);
+}
+
+int ODEAdaptiveAtTimesCPP(double *xOut,size_t *numSteps,const ODEDynamicsCPP &dyn,const double *xStart,const double tStart,const double *tOut,const size_t numOut,const ODEIntParamCPP &param,ODEScratchCPP &workMem) {
+    const size_t xDim=dyn.xDim;
+    const ODEMethodCPP method=param.method;
+    const double order=(double)methodOrder(method);
+    const bool isFSAL=methodIsFSAL(method);
+    const double RelTol=param.RelTol;
+    const double AbsTol=param.AbsTol;
+    double *xCur=workMem.xCur;
+    double tCur=tStart;
+    double tEnd, tDiff, deltaTSign, deltaTMaxMag, deltaTMag;
+    size_t curOut=0, i;
+
+    *numSteps=0;
+
+    if(method==ODE_RKN54&&(!dyn.hasSpecialSecondOrderForm()||xDim%2!=0)) {
+        return 4;
+    }
+
+    copy(xStart,xStart+xDim,xCur);
+
+    //Outputs requested at the starting time.
+    while(curOut<numOut&&tOut[curOut]==tStart) {
+        copy(xCur,xCur+xDim,xOut+curOut*xDim);
+        curOut++;
+    }
+
+    if(curOut==numOut) {
+        return 0;
+    }
+
+    tEnd=tOut[numOut-1];
+    tDiff=tEnd-tStart;
+    deltaTSign=tDiff>0?1:-1;
+    //The maximum step size is arbitrarily set to 1/5 the total distance,
+    //as in RKAdaptiveOverRange.
+    deltaTMaxMag=fabs(tDiff)/5;
+
+    dyn.f(workMem.dxdtCur,xCur,tCur);
+
+    if(param.initStepSize>0) {
+        deltaTMag=param.initStepSize;
+    } else {
+        deltaTMag=initialStepSize(dyn,tCur,fabs(tDiff),param,workMem);
+    }
+    deltaTMag=min(deltaTMag,deltaTMaxMag);
+
+    while(*numSteps<param.maxSteps) {
+        //The absolute value of the minimum allowable step size, so that
+        //the step makes something of a difference compared to the
+        //numerical precision.
+        double deltaTMinMag=max(16*DBL_EPSILON*fabs(tCur),DBL_MIN);
+        double deltaT, tNew, theError=0;
+        bool failedReducingStepSize=false;
+        bool moveOnToNextStep=false;
+
+        //If we would overstep the end, then end at tEnd.
+        if(deltaTSign*(tCur+deltaTSign*deltaTMag)>=deltaTSign*tEnd) {
+            deltaTMag=fabs(tEnd-tCur);
+            //Allow the last step to be very small.
+            deltaTMinMag=min(deltaTMinMag,deltaTMag);
+        }
+
+        //The Jacobian is only needed by the Rosenbrock methods and is
+        //evaluated once per step.
+        if(method==ODE_ROSENBROCK23||method==ODE_ROSENBROCK34) {
+            dyn.jacobian(workMem.J,workMem.dfdt,xCur,tCur,workMem.jacobScratch);
+        }
+
+        while(moveOnToNextStep==false) {
+            bool isSingular=false;
+
+            deltaT=deltaTSign*deltaTMag;
+            if(!tryStep(&isSingular,dyn,tCur,deltaT,method,workMem)) {
+                return 3;
+            }
+
+            if(isSingular) {
+                //The Rosenbrock matrix was singular; halve the step.
+                theError=2*RelTol;
+            } else {
+                //The local error estimate as a combination of the relative
+                //and absolute error.
+                theError=0;
+                for(i=0;i<xDim;i++) {
+                    const double normFactor=max(max(fabs(workMem.xNew[i]),fabs(xCur[i])),AbsTol/RelTol);
+
+                    theError=max(theError,fabs(workMem.xErr[i])/normFactor);
+                }
+            }
+
+            if(theError>RelTol) {
+                if(deltaTMag<deltaTMinMag) {
+                    return 1;
+                }
+
+                if(failedReducingStepSize==false&&!isSingular) {
+                    failedReducingStepSize=true;
+                    //The Fehlberg step reduction.
+                    deltaTMag=max(deltaTMinMag,deltaTMag*max(0.1,0.8*pow(RelTol/theError,1.0/order)));
+                } else {
+                    deltaTMag=deltaTMag/2;
+                }
+            } else {
+                moveOnToNextStep=true;
+            }
+        }
+
+        (*numSteps)++;
+        if(fabs(tEnd-(tCur+deltaT))<=deltaTMinMag) {
+            tNew=tEnd;
+        } else {
+            tNew=tCur+deltaT;
+        }
+
+        if(!isFSAL) {
+            dyn.f(workMem.dxdtNew,workMem.xNew,tNew);
+        }
+
+        //Interpolate to all of the output times that are in the step.
+        while(curOut<numOut&&deltaTSign*(tOut[curOut]-tNew)<=0) {
+            if(tOut[curOut]==tNew) {
+                copy(workMem.xNew,workMem.xNew+xDim,xOut+curOut*xDim);
+            } else {
+                denseOutput(xOut+curOut*xDim,dyn,(tOut[curOut]-tCur)/deltaT,deltaT,method,workMem);
+            }
+            curOut++;
+        }
+
+        copy(workMem.xNew,workMem.xNew+xDim,xCur);
+        copy(workMem.dxdtNew,workMem.dxdtNew+xDim,workMem.dxdtCur);
+        tCur=tNew;
+
+        if(curOut==numOut) {
+            return 0;
+        }
+
+        //Increase the step size, limiting the increase to a factor of 4.
+        if(theError>0) {
+            deltaTMag=min(deltaTMaxMag,deltaTMag*min(4.0,0.8*pow(RelTol/theError,1.0/order)));
+        } else {
+            deltaTMag=min(deltaTMaxMag,4*deltaTMag);
+        }
+        deltaTMag=max(deltaTMag,deltaTMinMag);
+    }
+
+    //The maximum number of steps was reached.
+    return 2;
+}
+
+static size_t methodOrder(const ODEMethodCPP method) {
+//METHODORDER The smaller of the two orders of the embedded pair, which is
+//            used for adapting the step size.
+    switch(method) {
+        case ODE_RK32:
+            return 2;
+        case ODE_RK54:
+            return 4;
+        case ODE_RKN54:
+            return 4;
+        case ODE_ROSENBROCK23:
+            return 2;
+        default://ODE_ROSENBROCK34
+            return 3;
+    }
+}
+
+static bool methodIsFSAL(const ODEMethodCPP method) {
+//METHODISFSAL True if the derivative at the end of the step is computed
+//             as part of the step.
+    return method!=ODE_ROSENBROCK34;
+}
+
+static bool tryStep(bool *isSingular,const ODEDynamicsCPP &dyn,const double t,const double deltaT,const ODEMethodCPP method,ODEScratchCPP &workMem) {
+/*TRYSTEP Perform one step of the chosen method from workMem.xCur, putting
+ *        the main solution into workMem.xNew and the difference between
+ *        the main and subsidiary solutions into workMem.xErr. For FSAL
+ *        methods, the derivative at the new point is put in
+ *        workMem.dxdtNew. The return value is false if a non-finite value
+ *        was encountered. isSingular is set to true if the matrix in a
+ *        Rosenbrock method is singular.
+ */
+    const size_t xDim=dyn.xDim;
+    const double *xCur=workMem.xCur;
+    double *xNew=workMem.xNew;
+    double *xErr=workMem.xErr;
+    double *xTemp=workMem.xTemp;
+    double *K=workMem.K;
+    size_t i, j, curStage;
+
+    switch(method) {
+        case ODE_RK32:
+        case ODE_RK54:
+        {
+            const size_t numStages=method==ODE_RK32?3:6;
+            const double *C=method==ODE_RK32?RK32C:RK54C;
+            const double *B=method==ODE_RK32?RK32B:RK54B;
+            const double *E=method==ODE_RK32?RK32E:RK54E;
+
+            copy(workMem.dxdtCur,workMem.dxdtCur+xDim,K);
+            for(curStage=1;curStage<numStages;curStage++) {
+                for(i=0;i<xDim;i++) {
+                    double sum=0;
+
+                    for(j=0;j<curStage;j++) {
+                        const double a=method==ODE_RK32?RK32A[curStage][j]:RK54A[curStage][j];
+
+                        sum+=a*K[i+j*xDim];
+                    }
+                    xTemp[i]=xCur[i]+deltaT*sum;
+                }
+                dyn.f(K+curStage*xDim,xTemp,t+C[curStage]*deltaT);
+            }
+
+            for(i=0;i<xDim;i++) {
+                double sum=0;
+
+                for(j=0;j<numStages;j++) {
+                    sum+=B[j]*K[i+j*xDim];
+                }
+                xNew[i]=xCur[i]+deltaT*sum;
+            }
+            //The FSAL stage.
+            dyn.f(K+numStages*xDim,xNew,t+deltaT);
+            copy(K+numStages*xDim,K+(numStages+1)*xDim,workMem.dxdtNew);
+
+            for(i=0;i<xDim;i++) {
+                double sum=0;
+
+                for(j=0;j<=numStages;j++) {
+                    sum+=E[j]*K[i+j*xDim];
+                }
+                xErr[i]=deltaT*sum;
+            }
+            break;
+        }
+        case ODE_RKN54:
+        {
+            const size_t halfDim=xDim/2;
+            const double *p=xCur;
+            const double *v=xCur+halfDim;
+            const double deltaT2=deltaT*deltaT;
+            //The stages only hold the second derivatives.
+            double *G=K;
+
+            copy(workMem.dxdtCur+halfDim,workMem.dxdtCur+xDim,G);
+            for(curStage=1;curStage<6;curStage++) {
+                for(i=0;i<halfDim;i++) {
+                    double sum=0;
+
+                    for(j=0;j<curStage;j++) {
+                        sum+=RKN54A[curStage][j]*G[i+j*halfDim];
+                    }
+                    xTemp[i]=p[i]+RKN54C[curStage]*deltaT*v[i]+deltaT2*sum;
+                }
+                dyn.secondDeriv(G+curStage*halfDim,xTemp,t+RKN54C[curStage]*deltaT);
+            }
+
+            for(i=0;i<halfDim;i++) {
+                double sumP=0, sumV=0, errP=0, errV=0;
+
+                for(j=0;j<6;j++) {
+                    const double g=G[i+j*halfDim];
+
+                    sumP+=RKN54BHat[j]*g;
+                    sumV+=RKN54BPHat[j]*g;
+                    errP+=(RKN54BHat[j]-RKN54B[j])*g;
+                    errV+=(RKN54BPHat[j]-RKN54BP[j])*g;
+                }
+                xNew[i]=p[i]+deltaT*v[i]+deltaT2*sumP;
+                xNew[i+halfDim]=v[i]+deltaT*sumV;
+                xErr[i]=deltaT2*errP;
+                xErr[i+halfDim]=deltaT*errV;
+            }
+
+            //The last stage is evaluated at the new position, because the
+            //method is FSAL.
+            copy(xNew+halfDim,xNew+xDim,workMem.dxdtNew);
+            copy(G+5*halfDim,G+6*halfDim,workMem.dxdtNew+halfDim);
+            break;
+        }
+        case ODE_ROSENBROCK23:
+        case ODE_ROSENBROCK34:
+        {
+            const double *J=workMem.J;
+            const double *dfdt=workMem.dfdt;
+            const double *F0=workMem.dxdtCur;
+            double *W=workMem.W;
+            double *k1=K;
+            double *k2=K+xDim;
+            double *k3=K+2*xDim;
+            double *k4=K+3*xDim;
+            double *F1=K+4*xDim;
+            double *F2=K+5*xDim;
+            const double d=method==ODE_ROSENBROCK23?1.0/(2.0+sqrt(2.0)):0.5;
+
+            //W=I-deltaT*d*J
+            for(i=0;i<xDim*xDim;i++) {
+                W[i]=-deltaT*d*J[i];
+            }
+            for(i=0;i<xDim;i++) {
+                W[i+i*xDim]+=1;
+            }
+            if(!LUDecompCPP(W,workMem.pivot,xDim)) {
+                *isSingular=true;
+                return true;
+            }
+
+            if(method==ODE_ROSENBROCK23) {
+                const double e32=6.0+sqrt(2.0);
+
+                for(i=0;i<xDim;i++) {
+                    k1[i]=F0[i]+deltaT*d*dfdt[i];
+                }
+                LUSolveCPP(k1,W,workMem.pivot,xDim,1);
+                for(i=0;i<xDim;i++) {
+                    xTemp[i]=xCur[i]+0.5*deltaT*k1[i];
+                }
+                dyn.f(F1,xTemp,t+0.5*deltaT);
+                for(i=0;i<xDim;i++) {
+                    k2[i]=F1[i]-k1[i];
+                }
+                LUSolveCPP(k2,W,workMem.pivot,xDim,1);
+                for(i=0;i<xDim;i++) {
+                    k2[i]+=k1[i];
+                    xNew[i]=xCur[i]+deltaT*k2[i];
+                }
+                dyn.f(F2,xNew,t+deltaT);
+                for(i=0;i<xDim;i++) {
+                    k3[i]=F2[i]-e32*(k2[i]-F1[i])-2*(k1[i]-F0[i])+deltaT*d*dfdt[i];
+                }
+                LUSolveCPP(k3,W,workMem.pivot,xDim,1);
+                for(i=0;i<xDim;i++) {
+                    xErr[i]=(deltaT/6)*(k1[i]-2*k2[i]+k3[i]);
+                }
+                copy(F2,F2+xDim,workMem.dxdtNew);
+            } else {
+                for(i=0;i<xDim;i++) {
+                    k1[i]=F0[i]+deltaT*0.5*dfdt[i];
+                }
+                LUSolveCPP(k1,W,workMem.pivot,xDim,1);
+                for(i=0;i<xDim;i++) {
+                    xTemp[i]=xCur[i]+deltaT*k1[i];
+                }
+                dyn.f(F1,xTemp,t+deltaT);
+                for(i=0;i<xDim;i++) {
+                    k2[i]=F1[i]-1.5*deltaT*dfdt[i]-4*k1[i];
+                }
+                LUSolveCPP(k2,W,workMem.pivot,xDim,1);
+                for(i=0;i<xDim;i++) {
+                    xTemp[i]=xCur[i]+(24.0/25.0)*deltaT*k1[i]+(3.0/25.0)*deltaT*k2[i];
+                }
+                dyn.f(F2,xTemp,t+(3.0/5.0)*deltaT);
+                for(i=0;i<xDim;i++) {
+                    k3[i]=F2[i]+(121.0/50.0)*deltaT*dfdt[i]+(186.0/25.0)*k1[i]+(6.0/5.0)*k2[i];
+                }
+                LUSolveCPP(k3,W,workMem.pivot,xDim,1);
+                for(i=0;i<xDim;i++) {
+                    k4[i]=F2[i]+(29.0/250.0)*deltaT*dfdt[i]-(56.0/125.0)*k1[i]-(27.0/125.0)*k2[i]-(1.0/5.0)*k3[i];
+                }
+                LUSolveCPP(k4,W,workMem.pivot,xDim,1);
+                for(i=0;i<xDim;i++) {
+                    const double xMain=xCur[i]+deltaT*((97.0/108.0)*k1[i]+(11.0/72.0)*k2[i]+(25.0/216.0)*k3[i]);
+                    const double xSubsid=xCur[i]+deltaT*((19.0/18.0)*k1[i]+(1.0/4.0)*k2[i]+(25.0/216.0)*k3[i]+(125.0/216.0)*k4[i]);
+
+                    xNew[i]=xMain;
+                    xErr[i]=xMain-xSubsid;
+                }
+            }
+            break;
+        }
+    }
+
+    for(i=0;i<xDim;i++) {
+        if(!isFiniteVal(xNew[i])||!isFiniteVal(xErr[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void denseOutput(double *xInterp,const ODEDynamicsCPP &dyn,const double theta,const double deltaT,const ODEMethodCPP method,ODEScratchCPP &workMem) {
+/*DENSEOUTPUT Interpolate the state at the fraction theta (from 0 to 1)
+ *            of the step that was just taken. This must be called before
+ *            the values in workMem are moved for the next step.
+ */
+    const size_t xDim=dyn.xDim;
+    const double *xCur=workMem.xCur;
+    const double *xNew=workMem.xNew;
+    const double *K=workMem.K;
+    size_t i, j;
+
+    switch(method) {
+        case ODE_RK32:
+        case ODE_RK54:
+        {
+            const size_t numK=method==ODE_RK32?4:7;
+            const size_t numP=method==ODE_RK32?3:4;
+            double Q[7];
+
+            for(j=0;j<numK;j++) {
+                double thetaPow=theta;
+                size_t k;
+
+                Q[j]=0;
+                for(k=0;k<numP;k++) {
+                    const double P=method==ODE_RK32?RK32P[j][k]:RK54P[j][k];
+
+                    Q[j]+=P*thetaPow;
+                    thetaPow*=theta;
+                }
+            }
+
+            for(i=0;i<xDim;i++) {
+                double sum=0;
+
+                for(j=0;j<numK;j++) {
+                    sum+=K[i+j*xDim]*Q[j];
+                }
+                xInterp[i]=xCur[i]+deltaT*sum;
+            }
+            break;
+        }
+        case ODE_RKN54:
+        {
+            //Quintic Hermite interpolation of the position using the
+            //position, velocity and acceleration at both ends of the step.
+            //The velocity is the derivative of the interpolating
+            //polynomial.
+            const size_t halfDim=xDim/2;
+            const double t2=theta*theta;
+            const double t3=t2*theta;
+            const double t4=t3*theta;
+            const double t5=t4*theta;
+            const double h2=deltaT*deltaT;
+            const double H0=1-10*t3+15*t4-6*t5;
+            const double H1=theta-6*t3+8*t4-3*t5;
+            const double H2=0.5*t2-1.5*t3+1.5*t4-0.5*t5;
+            const double H3=0.5*t3-t4+0.5*t5;
+            const double H4=-4*t3+7*t4-3*t5;
+            const double H5=10*t3-15*t4+6*t5;
+            const double dH0=-30*t2+60*t3-30*t4;
+            const double dH1=1-18*t2+32*t3-15*t4;
+            const double dH2=theta-4.5*t2+6*t3-2.5*t4;
+            const double dH3=1.5*t2-4*t3+2.5*t4;
+            const double dH4=-12*t2+28*t3-15*t4;
+            const double dH5=30*t2-60*t3+30*t4;
+            const double *a0=workMem.dxdtCur+halfDim;
+            const double *a1=workMem.dxdtNew+halfDim;
+
+            for(i=0;i<halfDim;i++) {
+                const double p0=xCur[i];
+                const double p1=xNew[i];
+                const double v0=xCur[i+halfDim];
+                const double v1=xNew[i+halfDim];
+
+                xInterp[i]=H0*p0+H1*deltaT*v0+H2*h2*a0[i]+H3*h2*a1[i]+H4*deltaT*v1+H5*p1;
+                xInterp[i+halfDim]=(dH0*p0+dH5*p1)/deltaT+dH1*v0+dH4*v1+deltaT*(dH2*a0[i]+dH3*a1[i]);
+            }
+            break;
+        }
+        default:
+        {
+            //Cubic Hermite interpolation for the Rosenbrock methods.
+            const double t2=theta*theta;
+            const double t3=t2*theta;
+            const double H0=2*t3-3*t2+1;
+            const double H1=t3-2*t2+theta;
+            const double H2=-2*t3+3*t2;
+            const double H3=t3-t2;
+
+            for(i=0;i<xDim;i++) {
+                xInterp[i]=H0*xCur[i]+H1*deltaT*workMem.dxdtCur[i]+H2*xNew[i]+H3*deltaT*workMem.dxdtNew[i];
+            }
+            break;
+        }
+    }
+}
+
+static double initialStepSize(const ODEDynamicsCPP &dyn,const double t,const double tDiffMag,const ODEIntParamCPP &param,ODEScratchCPP &workMem) {
+/*INITIALSTEPSIZE Choose the initial step size using the algorithm in
+ *                Chapter II.4 of Hairer, Norsett and Wanner with the
+ *                weights AbsTol+RelTol*abs(x).
+ */
+    const size_t xDim=dyn.xDim;
+    const double order=(double)methodOrder(param.method)+1;
+    const double *x=workMem.xCur;
+    const double *f0=workMem.dxdtCur;
+    double *x1=workMem.xTemp;
+    double *f1=workMem.xNew;
+    double d0=0, d1=0, d2=0, h0, h1;
+    size_t i;
+
+    for(i=0;i<xDim;i++) {
+        const double sc=param.AbsTol+param.RelTol*fabs(x[i]);
+
+        d0+=(x[i]/sc)*(x[i]/sc);
+        d1+=(f0[i]/sc)*(f0[i]/sc);
+    }
+    d0=sqrt(d0/xDim);
+    d1=sqrt(d1/xDim);
+
+    if(d0<1e-5||d1<1e-5) {
+        h0=1e-6;
+    } else {
+        h0=0.01*d0/d1;
+    }
+    h0=min(h0,tDiffMag);
+
+    //The direction does not matter much for the estimate, so a forward
+    //step is used.
+    for(i=0;i<xDim;i++) {
+        x1[i]=x[i]+h0*f0[i];
+    }
+    dyn.f(f1,x1,t+h0);
+    for(i=0;i<xDim;i++) {
+        const double sc=param.AbsTol+param.RelTol*fabs(x[i]);
+        const double diff=(f1[i]-f0[i])/sc;
+
+        d2+=diff*diff;
+    }
+    d2=sqrt(d2/xDim)/h0;
+
+    if(max(d1,d2)<=1e-15) {
+        h1=max(1e-6,h0*1e-3);
+    } else {
+        h1=pow(0.01/max(d1,d2),1.0/order);
+    }
+
+    return min(100*h0,h1);
+}
+
+static bool isFiniteVal(const double val) {
+//ISFINITEVAL This is false for NaN and infinite values. It is used
+//            instead of isfinite, which is not available with all
+//            compilers.
+    return (val-val)==0;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
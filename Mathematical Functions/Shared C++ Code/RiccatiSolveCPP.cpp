@@ -0,0 +1,322 @@
+/*RICCATISOLVECPP C++ implementations of solvers for the discrete-time and
+ *                continuous-time algebraic Riccati equations using the
+ *                structure-preserving doubling algorithm (SDA). These
+ *                solve the same equations as the Matlab functions
+ *                RiccatiSolveD and RiccatiSolveC, which are, respectively,
+ *E'*X*E=A'*X*A-(A'*X*B+S)*inv(B'*X*B+R)*(A'*X*B+S)'+Q
+ *A'*X*E+E'*X*A-(E'*X*B+S)*inv(R)*(B'*X*E+S')+Q=0
+ *for the nonnegative definite solution X. Here, E and R must be
+ *invertible.
+ *
+ *The Matlab functions use the generalized eigenvalue approach of [1],
+ *which requires the QZ algorithm. Here, the problems are first reduced to
+ *the standard forms
+ *X=A'*X*inv(eye(n)+G*X)*A+H (discrete time)
+ *A'*X+X*A-X*G*X+H=0 (continuous time)
+ *by substituting A*inv(E) for A, inv(E)'*Q*inv(E) for Q and inv(E)'*S for
+ *S, and then removing the cross term S by substituting A-B*inv(R)*S' for A
+ *and Q-S*inv(R)*S' for Q, with G=B*inv(R)*B' and H=Q. The discrete-time
+ *standard form is solved by the doubling iteration of [2]
+ *A_{k+1}=A_k*inv(I+G_k*H_k)*A_k
+ *G_{k+1}=G_k+A_k*inv(I+G_k*H_k)*G_k*A_k'
+ *H_{k+1}=H_k+A_k'*H_k*inv(I+G_k*H_k)*A_k
+ *starting from A_0=A, G_0=G, H_0=H, where H_k converges quadratically to
+ *X. The continuous-time equation is turned into a discrete-time one using
+ *the Cayley transform of [3] with the parameter gamma=norm(A,'fro')+1,
+ *which guarantees that A-gamma*I is invertible, and is then solved with
+ *the same iteration. Only multiplications and inversions of nXn matrices
+ *are needed. The iteration converges to the stabilizing solution under
+ *the usual stabilizability and detectability conditions.
+ *
+ *REFERENCES:
+ *[1] W. F. Arnold III and A. J. Laub, "Generalized eigenproblem algorithms
+ *    and software for algebraic Riccati equations," Proceedings of the
+ *    IEEE, vol. 72, no. 12, pp. 1746-1754, Dec. 1984.
+ *[2] E. K.-W. Chu, H.-Y. Fan, and W.-W. Lin, "A structure-preserving
+ *    doubling algorithm for continuous-time algebraic Riccati equations,"
+ *    Linear Algebra and its Applications, vol. 396, pp. 55-80, Feb. 2005.
+ *[3] E. K.-W. Chu, H.-Y. Fan, W.-W. Lin, and C.-S. Wang, "Structure-
+ *    preserving algorithms for periodic discrete-time algebraic Riccati
+ *    equations," International Journal of Control, vol. 77, no. 8, pp.
+ *    767-788, 2004.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+**/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For sqrt and fabs
+#include <cmath>
+//For copy and max
+#include <algorithm>
+#include "matrixFuncs.hpp"
+
+using namespace std;
+
+static bool reduceRiccatiCPP(double *Ak,double *Gk,double *Hk,double *scratch,size_t *pivot,const double *A,const double *B,const double *Q,const double *R,const double *S,const double *E,const size_t n,const size_t m);
+static int doublingIterCPP(double *X,size_t *numIter,double *Ak,double *Gk,double *Hk,double *scratch,size_t *pivot,const size_t n,const size_t maxIter,const double tol);
+
+int RiccatiSolveDCPP(double *X,size_t *numIter,double *scratch,size_t *pivot,const double *A,const double *B,const double *Q,const double *R,const double *S,const double *E,const size_t n,const size_t m,const size_t maxIter,const double tol) {
+/*RICCATISOLVEDCPP Solve the discrete-time algebraic Riccati equation. A,
+ *             Q and E are nXn, B and S are nXm and R is mXm. S and E can
+ *             be NULL, in which case they are taken to be zero and the
+ *             identity matrix. R can be NULL, in which case it is the
+ *             identity matrix. scratch must have space for
+ *             8*n*n+2*m*m+3*n*m doubles and pivot for max(n,m) size_t
+ *             values. The iteration stops when the largest change in X
+ *             relative to the largest element of X is at most tol or
+ *             after maxIter iterations. The return value is 0 on success,
+ *             1 if a matrix that must be inverted is singular and 2 if
+ *             the maximum number of iterations was reached.
+ */
+    double *Ak=scratch;
+    double *Gk=Ak+n*n;
+    double *Hk=Gk+n*n;
+    double *workMem=Hk+n*n;
+
+    *numIter=0;
+    if(!reduceRiccatiCPP(Ak,Gk,Hk,workMem,pivot,A,B,Q,R,S,E,n,m)) {
+        return 1;
+    }
+
+    return doublingIterCPP(X,numIter,Ak,Gk,Hk,workMem,pivot,n,maxIter,tol);
+}
+
+int RiccatiSolveCCPP(double *X,size_t *numIter,double *scratch,size_t *pivot,const double *A,const double *B,const double *Q,const double *R,const double *S,const double *E,const size_t n,const size_t m,const size_t maxIter,const double tol) {
+/*RICCATISOLVECCPP Solve the continuous-time algebraic Riccati equation.
+ *             The inputs, the scratch space and the return values are the
+ *             same as in RiccatiSolveDCPP.
+ */
+    double *Ak=scratch;
+    double *Gk=Ak+n*n;
+    double *Hk=Gk+n*n;
+    double *M1=Hk+n*n;
+    double *M2=M1+n*n;
+    double *M3=M2+n*n;
+    double *M4=M3+n*n;
+    double *LUScratch=M4+n*n;
+    double gamma, twoGamma;
+    size_t i, j;
+
+    *numIter=0;
+    if(!reduceRiccatiCPP(Ak,Gk,Hk,M1,pivot,A,B,Q,R,S,E,n,m)) {
+        return 1;
+    }
+
+    //The Cayley transform. The Frobenius norm bounds the spectral radius,
+    //so A-gamma*I is invertible.
+    gamma=0;
+    for(i=0;i<n*n;i++) {
+        gamma+=Ak[i]*Ak[i];
+    }
+    gamma=sqrt(gamma)+1;
+    twoGamma=2*gamma;
+
+    //M1=A-gamma*I and M2=inv(M1).
+    copy(Ak,Ak+n*n,M1);
+    for(i=0;i<n;i++) {
+        M1[i+i*n]-=gamma;
+    }
+    if(!matInvCPP(M2,LUScratch,pivot,M1,n)) {
+        return 1;
+    }
+
+    //M4=W=M1'+H*M2*G.
+    matMultCPP(M3,Hk,M2,n,n,n);
+    matMultCPP(M4,M3,Gk,n,n,n);
+    for(j=0;j<n;j++) {
+        for(i=0;i<n;i++) {
+            M4[i+j*n]+=M1[j+i*n];
+        }
+    }
+
+    //X=V=M1+G*M2'*H. X is used as scratch space here.
+    matMultABTransCPP(M3,Gk,M2,n,n,n);
+    matMultCPP(X,M3,Hk,n,n,n);
+    for(i=0;i<n*n;i++) {
+        X[i]+=M1[i];
+    }
+
+    //A_0=I+2*gamma*inv(V)
+    if(!matInvCPP(M3,LUScratch,pivot,X,n)) {
+        return 1;
+    }
+    for(i=0;i<n*n;i++) {
+        Ak[i]=twoGamma*M3[i];
+    }
+    for(i=0;i<n;i++) {
+        Ak[i+i*n]+=1;
+    }
+
+    //M3=inv(W).
+    if(!matInvCPP(M3,LUScratch,pivot,M4,n)) {
+        return 1;
+    }
+
+    //G_0=2*gamma*M2*G*inv(W)
+    matMultCPP(X,M2,Gk,n,n,n);
+    matMultCPP(M1,X,M3,n,n,n);
+    //H_0=2*gamma*inv(W)*H*M2
+    matMultCPP(X,M3,Hk,n,n,n);
+    matMultCPP(M4,X,M2,n,n,n);
+    for(i=0;i<n*n;i++) {
+        Gk[i]=twoGamma*M1[i];
+        Hk[i]=twoGamma*M4[i];
+    }
+    symmetrizeCPP(Gk,n);
+    symmetrizeCPP(Hk,n);
+
+    return doublingIterCPP(X,numIter,Ak,Gk,Hk,M1,pivot,n,maxIter,tol);
+}
+
+static bool reduceRiccatiCPP(double *Ak,double *Gk,double *Hk,double *scratch,size_t *pivot,const double *A,const double *B,const double *Q,const double *R,const double *S,const double *E,const size_t n,const size_t m) {
+/*REDUCERICCATICPP Put the nXn matrices of the standard form of the
+ *             Riccati equation into Ak, Gk and Hk. scratch must have space
+ *             for 5*n*n+2*m*m+3*n*m doubles. The return value is false if
+ *             E or R is singular.
+ */
+    double *M1=scratch;
+    double *EInv=M1+n*n;
+    double *LUScratch=EInv+n*n;
+    double *RInv=scratch+5*n*n;
+    double *LUScratchM=RInv+m*m;
+    double *BRInv=LUScratchM+m*m;
+    double *STilde=BRInv+n*m;
+    double *NM=STilde+n*m;
+    size_t i;
+
+    if(E!=NULL) {
+        if(!matInvCPP(EInv,LUScratch,pivot,E,n)) {
+            return false;
+        }
+        matMultCPP(Ak,A,EInv,n,n,n);
+        matMultCPP(M1,Q,EInv,n,n,n);
+        matMultATransBCPP(Hk,EInv,M1,n,n,n);
+        if(S!=NULL) {
+            matMultATransBCPP(STilde,EInv,S,n,n,m);
+        }
+    } else {
+        copy(A,A+n*n,Ak);
+        copy(Q,Q+n*n,Hk);
+        if(S!=NULL) {
+            copy(S,S+n*m,STilde);
+        }
+    }
+
+    if(R!=NULL) {
+        if(!matInvCPP(RInv,LUScratchM,pivot,R,m)) {
+            return false;
+        }
+        symmetrizeCPP(RInv,m);
+    } else {
+        fill_n(RInv,m*m,0.0);
+        for(i=0;i<m;i++) {
+            RInv[i+i*m]=1;
+        }
+    }
+
+    //G=B*inv(R)*B'
+    matMultCPP(BRInv,B,RInv,n,m,m);
+    matMultABTransCPP(Gk,BRInv,B,n,m,n);
+    symmetrizeCPP(Gk,n);
+
+    if(S!=NULL) {
+        //A=A-B*inv(R)*S'
+        matMultABTransCPP(M1,BRInv,STilde,n,m,n);
+        for(i=0;i<n*n;i++) {
+            Ak[i]-=M1[i];
+        }
+
+        //H=Q-S*inv(R)*S'
+        matMultCPP(NM,STilde,RInv,n,m,m);
+        matMultABTransCPP(M1,NM,STilde,n,m,n);
+        for(i=0;i<n*n;i++) {
+            Hk[i]-=M1[i];
+        }
+    }
+    symmetrizeCPP(Hk,n);
+
+    return true;
+}
+
+static int doublingIterCPP(double *X,size_t *numIter,double *Ak,double *Gk,double *Hk,double *scratch,size_t *pivot,const size_t n,const size_t maxIter,const double tol) {
+/*DOUBLINGITERCPP Run the structure-preserving doubling iteration on the
+ *             standard form of the discrete-time Riccati equation given
+ *             by Ak, Gk and Hk, which are modified. scratch must have
+ *             space for 5*n*n doubles.
+ */
+    double *M1=scratch;
+    double *M2=M1+n*n;
+    double *M3=M2+n*n;
+    double *M4=M3+n*n;
+    double *LUScratch=M4+n*n;
+    size_t curIter, i;
+
+    for(curIter=0;curIter<maxIter;curIter++) {
+        double maxDiff=0, maxVal=0;
+
+        //M2=inv(I+G_k*H_k)
+        matMultCPP(M1,Gk,Hk,n,n,n);
+        for(i=0;i<n;i++) {
+            M1[i+i*n]+=1;
+        }
+        if(!matInvCPP(M2,LUScratch,pivot,M1,n)) {
+            *numIter=curIter;
+            return 1;
+        }
+
+        //M3=A_k*inv(I+G_k*H_k) and M1=A_{k+1}.
+        matMultCPP(M3,Ak,M2,n,n,n);
+        matMultCPP(M1,M3,Ak,n,n,n);
+
+        //G_{k+1}=G_k+M3*G_k*A_k'
+        matMultCPP(M4,M3,Gk,n,n,n);
+        matMultABTransCPP(LUScratch,M4,Ak,n,n,n);
+        for(i=0;i<n*n;i++) {
+            Gk[i]+=LUScratch[i];
+        }
+        symmetrizeCPP(Gk,n);
+
+        //H_{k+1}=H_k+A_k'*H_k*inv(I+G_k*H_k)*A_k
+        matMultCPP(M4,Hk,M2,n,n,n);
+        matMultCPP(M3,M4,Ak,n,n,n);
+        matMultATransBCPP(LUScratch,Ak,M3,n,n,n);
+        for(i=0;i<n*n;i++) {
+            Hk[i]+=LUScratch[i];
+            maxDiff=max(maxDiff,fabs(LUScratch[i]));
+            maxVal=max(maxVal,fabs(Hk[i]));
+        }
+        symmetrizeCPP(Hk,n);
+
+        copy(M1,M1+n*n,Ak);
+
+        //A NaN difference fails this test and the iteration continues
+        //until maxIter is reached.
+        if(maxDiff<=tol*maxVal) {
+            copy(Hk,Hk+n*n,X);
+            *numIter=curIter+1;
+            return 0;
+        }
+    }
+
+    copy(Hk,Hk+n*n,X);
+    *numIter=maxIter;
+    return 2;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,66 @@
+/**MATRIXFUNCS A header file for C++ implementations of basic dense linear
+ *            algebra routines that are shared by the C++ filtering,
+ *            estimation and optimization code in the library. All
+ *            matrices are stored by column, as in Matlab, so that data
+ *            passed from Matlab can be used without reordering. None of
+ *            the functions allocate memory; any scratch space that is
+ *            needed must be provided by the caller, which makes the
+ *            functions safe to call from multiple threads at once. See the
+ *            file matrixFuncsCPP.cpp for more details on each function.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef MATRIXFUNCSCPP
+#define MATRIXFUNCSCPP
+#include <stddef.h>
+
+//C=A*B where A is mXn and B is nXp.
+void matMultCPP(double *C,const double *A,const double *B,const size_t m,const size_t n,const size_t p);
+//C=A*B' where A is mXn and B is pXn.
+void matMultABTransCPP(double *C,const double *A,const double *B,const size_t m,const size_t n,const size_t p);
+//C=A'*B where A is nXm and B is nXp.
+void matMultATransBCPP(double *C,const double *A,const double *B,const size_t m,const size_t n,const size_t p);
+//y=A*x where A is mXn.
+void matVecMultCPP(double *y,const double *A,const double *x,const size_t m,const size_t n);
+//y=A'*x where A is nXm.
+void matTransVecMultCPP(double *y,const double *A,const double *x,const size_t m,const size_t n);
+
+//Force an nXn matrix to be symmetric by averaging it with its transpose.
+void symmetrizeCPP(double *A,const size_t n);
+
+//Lower-triangular Cholesky decomposition and solution routines.
+bool cholLowerCPP(double *L,const double *A,const size_t n);
+void cholSolveCPP(double *X,const double *L,const size_t n,const size_t numRHS);
+void forwardSubstCPP(double *X,const double *L,const size_t n,const size_t numRHS);
+bool invSymPosDefCPP(double *AInv,double *scratch,const double *A,const size_t n);
+
+//LU decomposition with partial pivoting and solution routines.
+bool LUDecompCPP(double *LU,size_t *pivot,const size_t n);
+void LUSolveCPP(double *X,const double *LU,const size_t *pivot,const size_t n,const size_t numRHS);
+bool matInvCPP(double *AInv,double *scratch,size_t *pivot,const double *A,const size_t n);
+
+//Solvers for the discrete-time and continuous-time algebraic Riccati
+//equations. These are implemented in RiccatiSolveCPP.cpp.
+int RiccatiSolveDCPP(double *X,size_t *numIter,double *scratch,size_t *pivot,const double *A,const double *B,const double *Q,const double *R,const double *S,const double *E,const size_t n,const size_t m,const size_t maxIter,const double tol);
+int RiccatiSolveCCPP(double *X,size_t *numIter,double *scratch,size_t *pivot,const double *A,const double *B,const double *Q,const double *R,const double *S,const double *E,const size_t n,const size_t m,const size_t maxIter,const double tol);
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,348 @@
+/*MATRIXFUNCSCPP C++ implementations of basic dense linear algebra
+ *               routines. All matrices are stored by column, as in Matlab.
+ *               The routines are written for the small matrices that arise
+ *               in target tracking (state dimensionalities of at most a few
+ *               tens), where the overhead of calling a full BLAS/ LAPACK
+ *               library is large compared to the actual work. None of the
+ *               routines allocate memory.
+ *
+ *The Cholesky decomposition is the standard column-oriented
+ *Cholesky-Banachiewicz algorithm and the LU decomposition uses partial
+ *pivoting; both are described in Chapters 3 and 4 of
+ *G. H. Golub and C. F. van Loan, Matrix Computations, 4th ed. Baltimore:
+ *Johns Hopkins University Press, 2013.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+**/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For sqrt and fabs
+#include <cmath>
+//For fill_n and swap
+#include <algorithm>
+#include "matrixFuncs.hpp"
+
+using namespace std;
+
+void matMultCPP(double *C,const double *A,const double *B,const size_t m,const size_t n,const size_t p) {
+//MATMULTCPP C=A*B where A is mXn and B is nXp. C cannot be the same as A
+//           or B.
+    size_t i,j,k;
+
+    fill_n(C,m*p,0.0);
+    for(j=0;j<p;j++) {
+        for(k=0;k<n;k++) {
+            const double BVal=B[k+j*n];
+
+            if(BVal==0) {
+                continue;
+            }
+
+            for(i=0;i<m;i++) {
+                C[i+j*m]+=A[i+k*m]*BVal;
+            }
+        }
+    }
+}
+
+void matMultABTransCPP(double *C,const double *A,const double *B,const size_t m,const size_t n,const size_t p) {
+//MATMULTABTRANSCPP C=A*B' where A is mXn and B is pXn. C cannot be the
+//                  same as A or B.
+    size_t i,j,k;
+
+    fill_n(C,m*p,0.0);
+    for(k=0;k<n;k++) {
+        for(j=0;j<p;j++) {
+            const double BVal=B[j+k*p];
+
+            if(BVal==0) {
+                continue;
+            }
+
+            for(i=0;i<m;i++) {
+                C[i+j*m]+=A[i+k*m]*BVal;
+            }
+        }
+    }
+}
+
+void matMultATransBCPP(double *C,const double *A,const double *B,const size_t m,const size_t n,const size_t p) {
+//MATMULTATRANSBCPP C=A'*B where A is nXm and B is nXp. C cannot be the
+//                  same as A or B.
+    size_t i,j,k;
+
+    for(j=0;j<p;j++) {
+        for(i=0;i<m;i++) {
+            double sum=0;
+
+            for(k=0;k<n;k++) {
+                sum+=A[k+i*n]*B[k+j*n];
+            }
+            C[i+j*m]=sum;
+        }
+    }
+}
+
+void matVecMultCPP(double *y,const double *A,const double *x,const size_t m,const size_t n) {
+//MATVECMULTCPP y=A*x where A is mXn. y cannot be the same as x.
+    matMultCPP(y,A,x,m,n,1);
+}
+
+void matTransVecMultCPP(double *y,const double *A,const double *x,const size_t m,const size_t n) {
+//MATTRANSVECMULTCPP y=A'*x where A is nXm. y cannot be the same as x.
+    matMultATransBCPP(y,A,x,m,n,1);
+}
+
+void symmetrizeCPP(double *A,const size_t n) {
+//SYMMETRIZECPP Replace the nXn matrix A with (A+A')/2. This is used to
+//              keep covariance matrices from drifting away from symmetry
+//              due to finite precision errors.
+    size_t i,j;
+
+    for(j=0;j<n;j++) {
+        for(i=j+1;i<n;i++) {
+            const double val=0.5*(A[i+j*n]+A[j+i*n]);
+
+            A[i+j*n]=val;
+            A[j+i*n]=val;
+        }
+    }
+}
+
+bool cholLowerCPP(double *L,const double *A,const size_t n) {
+/*CHOLLOWERCPP Compute the lower-triangular Cholesky decomposition L of the
+ *             symmetric positive definite nXn matrix A such that A=L*L'.
+ *             Only the lower-triangular part of A is used. The upper
+ *             triangular part of L is set to zero. L can be the same as A.
+ *             The return value is false if A is not positive definite (in
+ *             which case the contents of L are invalid) and true
+ *             otherwise.
+ */
+    size_t i,j,k;
+
+    for(j=0;j<n;j++) {
+        double diagVal=A[j+j*n];
+
+        for(k=0;k<j;k++) {
+            diagVal-=L[j+k*n]*L[j+k*n];
+        }
+
+        if(!(diagVal>0)) {
+            return false;
+        }
+        diagVal=sqrt(diagVal);
+        L[j+j*n]=diagVal;
+
+        for(i=j+1;i<n;i++) {
+            double val=A[i+j*n];
+
+            for(k=0;k<j;k++) {
+                val-=L[i+k*n]*L[j+k*n];
+            }
+            L[i+j*n]=val/diagVal;
+        }
+    }
+
+    //Zero the upper triangular part.
+    for(j=1;j<n;j++) {
+        fill_n(L+j*n,j,0.0);
+    }
+
+    return true;
+}
+
+void forwardSubstCPP(double *X,const double *L,const size_t n,const size_t numRHS) {
+/*FORWARDSUBSTCPP Given the lower-triangular nXn matrix L and the
+ *                nXnumRHS matrix B in X, replace X with L\B.
+ */
+    size_t i,k,curCol;
+
+    for(curCol=0;curCol<numRHS;curCol++) {
+        double *x=X+curCol*n;
+
+        for(i=0;i<n;i++) {
+            double val=x[i];
+
+            for(k=0;k<i;k++) {
+                val-=L[i+k*n]*x[k];
+            }
+            x[i]=val/L[i+i*n];
+        }
+    }
+}
+
+void cholSolveCPP(double *X,const double *L,const size_t n,const size_t numRHS) {
+/*CHOLSOLVECPP Given the lower-triangular Cholesky decomposition L of an
+ *             nXn matrix A (A=L*L') and the nXnumRHS matrix B in X,
+ *             replace X with A\B.
+ */
+    size_t i,k,curCol;
+
+    forwardSubstCPP(X,L,n,numRHS);
+
+    //Back substitution with L'.
+    for(curCol=0;curCol<numRHS;curCol++) {
+        double *x=X+curCol*n;
+
+        for(i=n;i-->0;) {
+            double val=x[i];
+
+            for(k=i+1;k<n;k++) {
+                val-=L[k+i*n]*x[k];
+            }
+            x[i]=val/L[i+i*n];
+        }
+    }
+}
+
+bool invSymPosDefCPP(double *AInv,double *scratch,const double *A,const size_t n) {
+/*INVSYMPOSDEFCPP Invert the symmetric positive definite nXn matrix A
+ *                using a Cholesky decomposition. scratch must have space
+ *                for n*n doubles. AInv cannot be the same as A. The return
+ *                value is false if A is not positive definite.
+ */
+    size_t i;
+
+    if(!cholLowerCPP(scratch,A,n)) {
+        return false;
+    }
+
+    fill_n(AInv,n*n,0.0);
+    for(i=0;i<n;i++) {
+        AInv[i+i*n]=1;
+    }
+
+    cholSolveCPP(AInv,scratch,n,n);
+    symmetrizeCPP(AInv,n);
+    return true;
+}
+
+bool LUDecompCPP(double *LU,size_t *pivot,const size_t n) {
+/*LUDECOMPCPP Perform an in-place LU decomposition of the nXn matrix in LU
+ *            with partial pivoting. On return, the strictly lower
+ *            triangular part of LU holds the unit lower-triangular factor
+ *            and the upper-triangular part holds the upper-triangular
+ *            factor. pivot is a length-n array that holds the row
+ *            interchanges. The return value is false if the matrix is
+ *            singular.
+ */
+    size_t i,j,k;
+
+    for(k=0;k<n;k++) {
+        size_t maxRow=k;
+        double maxVal=fabs(LU[k+k*n]);
+
+        for(i=k+1;i<n;i++) {
+            const double curVal=fabs(LU[i+k*n]);
+            if(curVal>maxVal) {
+                maxVal=curVal;
+                maxRow=i;
+            }
+        }
+
+        pivot[k]=maxRow;
+        if(maxVal==0) {
+            return false;
+        }
+
+        if(maxRow!=k) {
+            for(j=0;j<n;j++) {
+                swap(LU[k+j*n],LU[maxRow+j*n]);
+            }
+        }
+
+        for(i=k+1;i<n;i++) {
+            LU[i+k*n]/=LU[k+k*n];
+        }
+
+        for(j=k+1;j<n;j++) {
+            const double ukj=LU[k+j*n];
+
+            if(ukj==0) {
+                continue;
+            }
+
+            for(i=k+1;i<n;i++) {
+                LU[i+j*n]-=LU[i+k*n]*ukj;
+            }
+        }
+    }
+
+    return true;
+}
+
+void LUSolveCPP(double *X,const double *LU,const size_t *pivot,const size_t n,const size_t numRHS) {
+/*LUSOLVECPP Given the in-place LU decomposition and pivots from
+ *           LUDecompCPP of an nXn matrix A and the nXnumRHS matrix B in X,
+ *           replace X with A\B.
+ */
+    size_t i,k,curCol;
+
+    for(curCol=0;curCol<numRHS;curCol++) {
+        double *x=X+curCol*n;
+
+        for(k=0;k<n;k++) {
+            if(pivot[k]!=k) {
+                swap(x[k],x[pivot[k]]);
+            }
+        }
+
+        //Forward substitution with the unit lower-triangular factor.
+        for(i=0;i<n;i++) {
+            double val=x[i];
+            for(k=0;k<i;k++) {
+                val-=LU[i+k*n]*x[k];
+            }
+            x[i]=val;
+        }
+
+        //Back substitution with the upper-triangular factor.
+        for(i=n;i-->0;) {
+            double val=x[i];
+            for(k=i+1;k<n;k++) {
+                val-=LU[i+k*n]*x[k];
+            }
+            x[i]=val/LU[i+i*n];
+        }
+    }
+}
+
+bool matInvCPP(double *AInv,double *scratch,size_t *pivot,const double *A,const size_t n) {
+/*MATINVCPP Invert the general nXn matrix A using an LU decomposition.
+ *          scratch must have space for n*n doubles and pivot for n
+ *          size_t values. AInv cannot be the same as A. The return value
+ *          is false if A is singular.
+ */
+    size_t i;
+
+    copy(A,A+n*n,scratch);
+    if(!LUDecompCPP(scratch,pivot,n)) {
+        return false;
+    }
+
+    fill_n(AInv,n*n,0.0);
+    for(i=0;i<n;i++) {
+        AInv[i+i*n]=1;
+    }
+
+    LUSolveCPP(AInv,scratch,pivot,n,n);
+    return true;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,174 @@
+/*ORBITDYNAMICSCPP C++ implementations of the member functions of the
+ *                 OrbitDynamicsCPP class, which provides the derivatives
+ *                 of the state of an object orbiting the Earth for use
+ *                 with the integrators in ODEIntegratorCPP.cpp. See
+ *                 ODEFuncs.hpp for a description of the model.
+ *
+ *The rotation of the Earth is modeled as a constant rotation rate about
+ *the z axis, which ignores precession, nutation and polar motion. This
+ *suffices for short propagation intervals. For precise propagation, the
+ *Matlab functions for the full rotation between the ITRS and the GCRS
+ *should be used.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+**/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For sqrt, sin, cos, exp, atan2 and asin
+#include <math.h>
+#include "ODEFuncs.hpp"
+#include "mathFuncs.hpp"
+
+void OrbitDynamicsCPP::f(double *dxdt,const double *x,const double t) const {
+    const double *r=x;
+    const double *v=x+3;
+
+    gravAccel(dxdt+3,r,t);
+
+    dxdt[0]=v[0];
+    dxdt[1]=v[1];
+    dxdt[2]=v[2];
+
+    if(rho0!=0) {
+        //The velocity with respect to the rotating atmosphere,
+        //v-cross([0;0;omega],r).
+        const double vRel[3]={v[0]+omega*r[1],v[1]-omega*r[0],v[2]};
+        const double vRelMag=sqrt(vRel[0]*vRel[0]+vRel[1]*vRel[1]+vRel[2]*vRel[2]);
+        const double rMag=sqrt(r[0]*r[0]+r[1]*r[1]+r[2]*r[2]);
+        const double rho=rho0*exp(-(rMag-r0)/H);
+        const double scale=-rho*vRelMag/(2*BC);
+
+        dxdt[3]+=scale*vRel[0];
+        dxdt[4]+=scale*vRel[1];
+        dxdt[5]+=scale*vRel[2];
+    }
+}
+
+bool OrbitDynamicsCPP::hasSpecialSecondOrderForm() const {
+    //The drag depends on the velocity.
+    return rho0==0;
+}
+
+void OrbitDynamicsCPP::secondDeriv(double *d2pdt2,const double *p,const double t) const {
+    gravAccel(d2pdt2,p,t);
+}
+
+void OrbitDynamicsCPP::jacobian(double *J,double *dfdt,const double *x,const double t,double *scratch) const {
+    const double *r=x;
+    const double *v=x+3;
+    double rMag2, rMag, scale;
+    size_t i, j;
+
+    if(C!=NULL) {
+        ODEDynamicsCPP::jacobian(J,dfdt,x,t,scratch);
+        return;
+    }
+
+    //Without spherical harmonic terms, the model does not depend on time.
+    for(i=0;i<36;i++) {
+        J[i]=0;
+    }
+    for(i=0;i<6;i++) {
+        dfdt[i]=0;
+    }
+
+    //The derivatives of the position with respect to the velocity.
+    J[0+3*6]=1;
+    J[1+4*6]=1;
+    J[2+5*6]=1;
+
+    //The derivative of the point-mass gravity -GM*r/norm(r)^3 with
+    //respect to r is -GM*(I/norm(r)^3-3*r*r'/norm(r)^5).
+    rMag2=r[0]*r[0]+r[1]*r[1]+r[2]*r[2];
+    rMag=sqrt(rMag2);
+    scale=GM/(rMag2*rMag);
+    for(j=0;j<3;j++) {
+        for(i=0;i<3;i++) {
+            J[3+i+j*6]=3*scale*r[i]*r[j]/rMag2;
+        }
+        J[3+j+j*6]-=scale;
+    }
+
+    if(rho0!=0) {
+        const double vRel[3]={v[0]+omega*r[1],v[1]-omega*r[0],v[2]};
+        const double vRelMag=sqrt(vRel[0]*vRel[0]+vRel[1]*vRel[1]+vRel[2]*vRel[2]);
+        const double rho=rho0*exp(-(rMag-r0)/H);
+        const double k=1/(2*BC);
+        double M[9];
+
+        //M is the derivative of the drag -k*rho*norm(vRel)*vRel with
+        //respect to vRel, which is also its derivative with respect to v.
+        for(j=0;j<3;j++) {
+            for(i=0;i<3;i++) {
+                M[i+3*j]=vRelMag>0?-k*rho*vRel[i]*vRel[j]/vRelMag:0;
+            }
+            M[j+3*j]-=k*rho*vRelMag;
+        }
+
+        for(j=0;j<3;j++) {
+            for(i=0;i<3;i++) {
+                J[3+i+(3+j)*6]+=M[i+3*j];
+                //The density depends on norm(r).
+                J[3+i+j*6]+=k*rho*vRelMag*vRel[i]*r[j]/(H*rMag);
+            }
+        }
+
+        //vRel depends on r through omega*[r(2);-r(1);0].
+        for(i=0;i<3;i++) {
+            J[3+i+0*6]-=omega*M[i+3*1];
+            J[3+i+1*6]+=omega*M[i+3*0];
+        }
+    }
+}
+
+void OrbitDynamicsCPP::gravAccel(double *acc,const double *r,const double t) const {
+    if(C==NULL) {
+        const double rMag2=r[0]*r[0]+r[1]*r[1]+r[2]*r[2];
+        const double scale=-GM/(rMag2*sqrt(rMag2));
+
+        acc[0]=scale*r[0];
+        acc[1]=scale*r[1];
+        acc[2]=scale*r[2];
+    } else {
+        const double theta=theta0+omega*t;
+        const double cosTheta=cos(theta);
+        const double sinTheta=sin(theta);
+        double rRot[3], pointSpher[3], accRot[3], V;
+
+        //Rotate into the Earth-fixed frame.
+        rRot[0]=cosTheta*r[0]+sinTheta*r[1];
+        rRot[1]=-sinTheta*r[0]+cosTheta*r[1];
+        rRot[2]=r[2];
+
+        //Spherical coordinates with systemType=0 for spherHarmonicEvalCPP.
+        pointSpher[0]=sqrt(rRot[0]*rRot[0]+rRot[1]*rRot[1]+rRot[2]*rRot[2]);
+        pointSpher[1]=atan2(rRot[1],rRot[0]);
+        pointSpher[2]=asin(rRot[2]/pointSpher[0]);
+
+        //The scale factor is the default in spherHarmonicEval.
+        spherHarmonicEvalCPP(&V,accRot,*C,*S,pointSpher,1,a,GM,1e-280);
+
+        //Rotate the acceleration back into the inertial frame.
+        acc[0]=cosTheta*accRot[0]-sinTheta*accRot[1];
+        acc[1]=sinTheta*accRot[0]+cosTheta*accRot[1];
+        acc[2]=accRot[2];
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -53,6 +53,10 @@ function [mu, P]=calcMixtureMoments(xi,w,PHyp,muHyp,diffTransFun)
 %Y. Bar-Shalom, X. R. Li, and T. Kirubarajan, Estimation with Applications
 %to Tracking and Navigation. New York: John Wiley and Sons, Inc, 2001.
 %
+%The compiled function calcMixtureMomentsBatch computes the moments of many
+%Gaussian mixtures at once, such as when collapsing the mixtures of all
+%tracks after a scan. It normalizes the weights of each mixture.
+%
 %March 2015 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
@@ -0,0 +1,212 @@
+/**CALCMIXTUREMOMENTSBATCH Compute the mean and the covariance matrix of
+ *                     each of a set of Gaussian mixtures, which collapses
+ *                     each mixture into a single Gaussian. This is the
+ *                     operation that is performed for every track after
+ *                     each scan in probabilistic data association filters
+ *                     and in the interacting multiple model filter.
+ *
+ *INPUTS: w A NTotalX1 vector of the weights of the components of all of
+ *          the mixtures, one mixture after another. The weights must be
+ *          nonnegative.
+ *       mu An xDimXNTotal matrix of the means of the components.
+ *        P An xDimXxDimXNTotal hypermatrix of the covariance matrices of
+ *          the components. If an empty matrix is passed, the components
+ *          are taken to be points, so that the moments are those of a
+ *          set of weighted points, as in calcMixtureMoments without its
+ *          third input.
+ *  numComp A numMixX1 vector holding the number of components in each
+ *          mixture. The first numComp(1) components belong to the first
+ *          mixture, the next numComp(2) to the second, etc. The sum of
+ *          the elements must be NTotal. If omitted or an empty matrix is
+ *          passed, all components are taken to be in one mixture.
+ *    muHyp An optional xDimXnumMix matrix. If provided, the output P for
+ *          each mixture is the mean squared error matrix about the
+ *          corresponding column of muHyp rather than the covariance
+ *          matrix, as in calcMixtureMoments. If omitted or an empty matrix
+ *          is passed, the covariance matrices are computed.
+ *
+ *OUTPUTS: mu The xDimXnumMix means of the mixtures.
+ *          P The xDimXxDimXnumMix covariance (or mean squared error)
+ *            matrices of the mixtures.
+ *       wSum A numMixX1 vector of the sum of the weights of the components
+ *            of each mixture, which is the weight of the merged component
+ *            in mergeGaussianComp.
+ *
+ *The weights of each mixture are normalized by their sum, as in
+ *mergeGaussianComp. If the sum is zero or not finite, all components of
+ *the mixture are given the same weight. The moments of a mixture with no
+ *components are NaN. All of the sums are computed with compensated
+ *summation and the covariance matrices are computed in the quadratic form
+ *used in mergeGaussianComp, so that they remain positive semidefinite. See
+ *the comments in mixtureMomentsCPP.cpp for details.
+ *
+ *If the code is compiled with OpenMP support, then the loop over the
+ *mixtures is run in parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[mu,P,wSum]=calcMixtureMomentsBatch(w,mu,P,numComp,muHyp);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For fill_n
+#include <algorithm>
+#include "MexValidation.h"
+#include "clusterFuncs.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t xDim, NTotal, numMix, i;
+    size_t *numComp, *offsets;
+    const double *w, *mu, *P=NULL, *muHyp=NULL;
+    double *muMerged, *PMerged, *wSum;
+    mxArray *muMATLAB, *PMATLAB, *wSumMATLAB;
+
+    if(nrhs<2) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>5) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>3) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    checkRealDoubleArray(prhs[0]);
+    checkRealDoubleArray(prhs[1]);
+    NTotal=mxGetNumberOfElements(prhs[0]);
+    xDim=mxGetM(prhs[1]);
+    if(mxGetN(prhs[1])!=NTotal) {
+        mexErrMsgTxt("The dimensions of mu are inconsistent with w.");
+    }
+    w=(double*)mxGetData(prhs[0]);
+    mu=(double*)mxGetData(prhs[1]);
+
+    if(nrhs>2&&!mxIsEmpty(prhs[2])) {
+        const mwSize numDims=mxGetNumberOfDimensions(prhs[2]);
+        const mwSize *PDims=mxGetDimensions(prhs[2]);
+
+        checkRealDoubleHypermatrix(prhs[2]);
+        if(numDims>3||PDims[0]!=xDim||PDims[1]!=xDim||(numDims==3?PDims[2]:1)!=NTotal) {
+            mexErrMsgTxt("The dimensions of P are inconsistent with mu.");
+        }
+        P=(double*)mxGetData(prhs[2]);
+    }
+
+    if(nrhs>3&&!mxIsEmpty(prhs[3])) {
+        size_t sumComp=0;
+
+        numComp=copySizeTArrayFromMatlab(prhs[3],&numMix);
+        for(i=0;i<numMix;i++) {
+            sumComp+=numComp[i];
+        }
+
+        if(sumComp!=NTotal) {
+            mxFree(numComp);
+            mexErrMsgTxt("The number of components in the mixtures does not sum to the length of w.");
+        }
+    } else {
+        numMix=1;
+        numComp=(size_t*)mxMalloc(sizeof(size_t));
+        numComp[0]=NTotal;
+    }
+
+    if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+        checkRealDoubleArray(prhs[4]);
+        if(mxGetM(prhs[4])!=xDim||mxGetN(prhs[4])!=numMix) {
+            mxFree(numComp);
+            mexErrMsgTxt("The dimensions of muHyp are inconsistent with mu.");
+        }
+        muHyp=(double*)mxGetData(prhs[4]);
+    }
+
+    offsets=new size_t[numMix];
+    offsets[0]=0;
+    for(i=1;i<numMix;i++) {
+        offsets[i]=offsets[i-1]+numComp[i-1];
+    }
+
+    muMATLAB=mxCreateDoubleMatrix(xDim,numMix,mxREAL);
+    muMerged=(double*)mxGetData(muMATLAB);
+    {
+        mwSize dims[3];
+
+        dims[0]=xDim;
+        dims[1]=xDim;
+        dims[2]=numMix;
+        PMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+        PMerged=(double*)mxGetData(PMATLAB);
+    }
+    wSumMATLAB=mxCreateDoubleMatrix(numMix,1,mxREAL);
+    wSum=(double*)mxGetData(wSumMATLAB);
+
+    {
+        const double NaNVal=mxGetNaN();
+
+        #pragma omp parallel
+        {
+            double *scratch=new double[xDim*(xDim+2)];
+            ptrdiff_t curMix;
+
+            #pragma omp for schedule(dynamic)
+            for(curMix=0;curMix<(ptrdiff_t)numMix;curMix++) {
+                const size_t offset=offsets[curMix];
+                double *muCur=muMerged+xDim*curMix;
+                double *PCur=PMerged+xDim*xDim*curMix;
+
+                if(numComp[curMix]==0) {
+                    fill_n(muCur,xDim,NaNVal);
+                    fill_n(PCur,xDim*xDim,NaNVal);
+                    wSum[curMix]=0;
+                    continue;
+                }
+
+                wSum[curMix]=mixtureMomentsCPP(muCur,PCur,w+offset,mu+xDim*offset,P==NULL?NULL:P+xDim*xDim*offset,muHyp==NULL?NULL:muHyp+xDim*curMix,xDim,numComp[curMix],scratch);
+            }
+
+            delete[] scratch;
+        }
+    }
+
+    delete[] offsets;
+    mxFree(numComp);
+
+    plhs[0]=muMATLAB;
+    if(nlhs>1) {
+        plhs[1]=PMATLAB;
+    } else {
+        mxDestroyArray(PMATLAB);
+    }
+
+    if(nlhs>2) {
+        plhs[2]=wSumMATLAB;
+    } else {
+        mxDestroyArray(wSumMATLAB);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -189,6 +189,7 @@ double fMin(double a,double b) {
 #endif
 
 void checkRealDoubleArray(const mxArray * const val);
+void checkRealDoubleHypermatrix(const mxArray * const val);
 void verifySizeReal(const size_t M, const size_t N, const mxArray * const val);
 mxArray *convert2DReal2DoubleMat(const mxArray * const val);
 mxArray *convert2DReal2SignedIntMat(const mxArray * const val);
@@ -233,6 +234,22 @@ void checkRealDoubleArray(const mxArray * const val){
     }
 }
 
+void checkRealDoubleHypermatrix(const mxArray * const val){
+//This is the same as checkRealDoubleArray except that arrays with more
+//than two dimensions, such as stacks of matrices, are allowed.
+    if(mxIsComplex(val)==true) {
+        mexErrMsgTxt("A parameter that should be real matrix of doubles has complex components.");
+    }
+    
+    if(mxIsEmpty(val)) {
+        mexErrMsgTxt("A parameter that should be real matrix of doubles is empty.");
+    }
+
+    if(mxGetClassID(val)!=mxDOUBLE_CLASS) {
+        mexErrMsgTxt("A parameter that should be a real double is of a different data type.");
+    }
+}
+
 void verifySizeReal(const size_t M, const size_t N, const mxArray * const val) {
     if(mxIsComplex(val)==true) {
         mexErrMsgTxt("A parameter that should be real matrix has complex components.");
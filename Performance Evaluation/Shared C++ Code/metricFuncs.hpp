@@ -0,0 +1,92 @@
+/**METRICFUNCS A header file for C++ implementations of performance
+ *             metrics for target tracking algorithms. The functions for
+ *             the metrics that require an optimal assignment between
+ *             sets of targets use the 2D assignment algorithm in
+ *             ShortestPathCPP.cpp with scratch space provided by the
+ *             caller, so that many metrics can be evaluated without
+ *             repeated memory allocation. When evaluating metrics in
+ *             parallel, each thread must use its own scratch space. See
+ *             the file metricFuncsCPP.cpp for more details.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef METRICFUNCSCPP
+#define METRICFUNCSCPP
+#include <stddef.h>
+#include "ShortestPathCPP.hpp"
+
+void calcOSPAGOSPACPP(double *OSPA,
+                      double *GOSPA,
+                      double *GOSPAComp,
+                      const double *xEst,
+                      const size_t numEst,
+                      const double *xTrue,
+                      const size_t numTrue,
+                      const size_t xDim,
+                      const double c,
+                      const double p,
+                      double *CScratch,
+                      ScratchSpace &workMem,
+                      MurtyHyp *problemSol);
+/*CALCOSPAGOSPACPP Compute the optimal subpattern assignment (OSPA)
+ *              metric and the generalized OSPA (GOSPA) metric with
+ *              alpha=2 between the xDimXnumEst estimates xEst and the
+ *              xDimXnumTrue true states xTrue using the cutoff distance c
+ *              and the order p. The localization, missed target and false
+ *              target parts of the GOSPA metric (before taking the pth
+ *              root) are put in GOSPAComp. CScratch must have space for
+ *              numEst*numTrue doubles and workMem and problemSol must have
+ *              been initialized for at least max(numEst,numTrue) rows and
+ *              min(numEst,numTrue) columns.
+ */
+
+double calcMOSPACPP(const double *xEst,
+                    const double *x,
+                    const double *w,
+                    const size_t xDim,
+                    const size_t numTar,
+                    const size_t numHyp,
+                    double *CScratch,
+                    ScratchSpace &workMem,
+                    MurtyHyp *problemSol);
+/*CALCMOSPACPP Compute the mean OSPA error of the xDimXnumTar estimate
+ *             xEst given the xDimXnumTarXnumHyp target hypotheses x, which
+ *             have probabilities w, as in the Matlab function
+ *             calcMOSPAError. CScratch must have space for numTar*numTar
+ *             doubles and workMem and problemSol must have been
+ *             initialized for at least numTar rows and columns.
+ */
+
+double calcNEESTermCPP(const double *xTrue,
+                       const double *xEst,
+                       const double *P,
+                       const size_t xDim,
+                       double *scratch);
+/*CALCNEESTERMCPP Compute (xTrue-xEst)'*inv(P)*(xTrue-xEst)/xDim, which
+ *              is the contribution of one estimate to the normalized
+ *              estimation error squared (NEES) in the Matlab function
+ *              calcNEES. scratch must have space for xDim*(xDim+1)
+ *              doubles. NaN is returned if P is not positive definite.
+ */
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
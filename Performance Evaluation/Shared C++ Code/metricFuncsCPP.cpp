@@ -0,0 +1,175 @@
+/**METRICFUNCSCPP C++ implementations of performance metrics for target
+ *                tracking algorithms. See the comments in metricFuncs.hpp
+ *                for the inputs to each function.
+ *
+ *The OSPA metric with cutoff c and order p between sets X and Y with
+ *|X|=m<=|Y|=n is
+ *d(X,Y)=((1/n)*(min_pi sum_{i=1}^m min(d(x_i,y_pi(i)),c)^p+c^p*(n-m)))^(1/p)
+ *where the minimization is over assignments of the elements of X to
+ *distinct elements of Y and d is the Euclidean distance. It is defined in
+ *D. Schuhmacher, B.-T. Vo, and B.-N. Vo, "A consistent metric for
+ *performance evaluation of multi-object filters," IEEE Transactions on
+ *Signal Processing, vol. 56, no. 8, pp. 3447-3457, Aug. 2008.
+ *The GOSPA metric with alpha=2 is
+ *d(X,Y)=(min_gamma sum_{(i,j) in gamma} d(x_i,y_j)^p+(c^p/2)*(|X|+|Y|-2*|gamma|))^(1/p)
+ *where the minimization is over partial assignments gamma that only pair
+ *elements whose distance is less than c. It is defined in
+ *A. S. Rahmathullah, A. F. Garcia-Fernandez, and L. Svensson,
+ *"Generalized optimal sub-pattern assignment metric," in Proceedings of
+ *the 20th International Conference on Information Fusion, Xi'an, China,
+ *Jul. 2017.
+ *Pairing two elements that are at least c apart costs c^p, which is the
+ *same as leaving both unassigned in the GOSPA metric. Thus, both metrics
+ *are obtained from the same optimal assignment with the cost matrix
+ *min(d(x_i,y_j),c)^p, so only one assignment problem has to be solved for
+ *both. The pairs in the optimal assignment at a distance of at least c
+ *count as a missed and a false target in the GOSPA metric.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For pow and sqrt
+#include <cmath>
+#include <limits>
+#include "metricFuncs.hpp"
+#include "matrixFuncs.hpp"
+
+using namespace std;
+
+static double distEuclid(const double *a,const double *b,const size_t numDim);
+
+void calcOSPAGOSPACPP(double *OSPA,double *GOSPA,double *GOSPAComp,const double *xEst,const size_t numEst,const double *xTrue,const size_t numTrue,const size_t xDim,const double c,const double p,double *CScratch,ScratchSpace &workMem,MurtyHyp *problemSol) {
+    const double cp=pow(c,p);
+    //The larger set is put in the rows of the cost matrix, as assign2D
+    //requires numRow>=numCol.
+    const bool estInRows=numEst>=numTrue;
+    const size_t numRow=estInRows?numEst:numTrue;
+    const size_t numCol=estInRows?numTrue:numEst;
+    const double *xRow=estInRows?xEst:xTrue;
+    const double *xCol=estInRows?xTrue:xEst;
+    double locCost=0, OSPASum=0;
+    size_t numGoodPairs=0;
+    size_t curRow, curCol;
+
+    if(numRow==0) {
+        *OSPA=0;
+        *GOSPA=0;
+        GOSPAComp[0]=0;
+        GOSPAComp[1]=0;
+        GOSPAComp[2]=0;
+        return;
+    }
+
+    if(numCol>0) {
+        for(curCol=0;curCol<numCol;curCol++) {
+            for(curRow=0;curRow<numRow;curRow++) {
+                const double d=distEuclid(xRow+curRow*xDim,xCol+curCol*xDim,xDim);
+
+                CScratch[curRow+curCol*numRow]=d<c?pow(d,p):cp;
+            }
+        }
+
+        assign2D(numRow,numCol,false,CScratch,workMem,problemSol);
+
+        for(curRow=0;curRow<numRow;curRow++) {
+            const ptrdiff_t col=problemSol->col4row[curRow];
+
+            if(col>=0) {
+                const double cost=CScratch[curRow+(size_t)col*numRow];
+
+                OSPASum+=cost;
+                if(cost<cp) {
+                    locCost+=cost;
+                    numGoodPairs++;
+                }
+            }
+        }
+    }
+
+    *OSPA=pow((OSPASum+cp*(double)(numRow-numCol))/(double)numRow,1.0/p);
+
+    GOSPAComp[0]=locCost;
+    GOSPAComp[1]=0.5*cp*(double)(numTrue-numGoodPairs);
+    GOSPAComp[2]=0.5*cp*(double)(numEst-numGoodPairs);
+    *GOSPA=pow(GOSPAComp[0]+GOSPAComp[1]+GOSPAComp[2],1.0/p);
+}
+
+double calcMOSPACPP(const double *xEst,const double *x,const double *w,const size_t xDim,const size_t numTar,const size_t numHyp,double *CScratch,ScratchSpace &workMem,MurtyHyp *problemSol) {
+    double val=0;
+    size_t curHyp, curRow, curCol;
+
+    if(numTar==0) {
+        return 0;
+    }
+
+    for(curHyp=0;curHyp<numHyp;curHyp++) {
+        const double *xCur=x+curHyp*xDim*numTar;
+
+        //Minimizing the sum of the squared distances is the same as
+        //maximizing the sum of the inner products used in calcMOSPAError.
+        for(curCol=0;curCol<numTar;curCol++) {
+            for(curRow=0;curRow<numTar;curRow++) {
+                const double d=distEuclid(xEst+curRow*xDim,xCur+curCol*xDim,xDim);
+
+                CScratch[curRow+curCol*numTar]=d*d;
+            }
+        }
+
+        assign2D(numTar,numTar,false,CScratch,workMem,problemSol);
+        val+=w[curHyp]*problemSol->gain;
+    }
+
+    return sqrt(val/(double)numTar);
+}
+
+double calcNEESTermCPP(const double *xTrue,const double *xEst,const double *P,const size_t xDim,double *scratch) {
+    double *L=scratch;
+    double *diff=scratch+xDim*xDim;
+    double val=0;
+    size_t i;
+
+    if(!cholLowerCPP(L,P,xDim)) {
+        return numeric_limits<double>::quiet_NaN();
+    }
+
+    for(i=0;i<xDim;i++) {
+        diff[i]=xTrue[i]-xEst[i];
+    }
+    forwardSubstCPP(diff,L,xDim,1);
+
+    for(i=0;i<xDim;i++) {
+        val+=diff[i]*diff[i];
+    }
+
+    return val/(double)xDim;
+}
+
+static double distEuclid(const double *a,const double *b,const size_t numDim) {
+    double dist=0;
+    size_t i;
+
+    for(i=0;i<numDim;i++) {
+        const double diff=a[i]-b[i];
+        dist+=diff*diff;
+    }
+    return sqrt(dist);
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -31,6 +31,10 @@ function val=calcMOSPAError(xEst,x,w)
 %targets," in Proceedings of SPIE: Signal Processing, Sensor Fusion, and
 %Target Recognition XXII, vol. 8745, Baltimore, MD, Apr. 2013.
 %
+%To evaluate the MOSPA error of many estimates, such as at all times in
+%all Monte Carlo runs of a simulation, the compiled function
+%calcMOSPAErrorBatch is much faster than calling this function in a loop.
+%
 %October 2013 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
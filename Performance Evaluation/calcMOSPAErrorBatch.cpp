@@ -0,0 +1,142 @@
+/**CALCMOSPAERRORBATCH Compute the mean optimal subpattern assignment
+ *                (MOSPA) error of many estimates of sets of targets, such
+ *                as the estimates at all times in all Monte Carlo runs of a
+ *                simulation. This is the same as calling calcMOSPAError on
+ *                each estimate.
+ *
+ *INPUTS: xEst An xDimXnumTarXnumCases hypermatrix of numCases estimates of
+ *             numTar targets. The cases can be any combination of times and
+ *             Monte Carlo runs.
+ *           x An xDimXnumTarXnumHypXnumCases hypermatrix of the numHyp
+ *             target hypotheses for each case, as in calcMOSPAError. If the
+ *             hypotheses are the same for all cases, then this can be
+ *             xDimXnumTarXnumHyp.
+ *           w A numHypXnumCases matrix of the probabilities of the
+ *             hypotheses for each case. If the probabilities are the same
+ *             for all cases, then this can be a numHypX1 vector.
+ *
+ *OUTPUTS: val A numCasesX1 vector of the MOSPA errors. If the cases are the
+ *             numTimes*numRuns combinations of times and runs in order with
+ *             the time index changing fastest, then
+ *             reshape(val,numTimes,numRuns) gives the error at each time in
+ *             each run.
+ *
+ *As in calcMOSPAError, p=2 and the squared Euclidean distance are used.
+ *The optimal assignment for each hypothesis is found using the function
+ *assign2D in ShortestPathCPP.cpp. If the code is compiled with OpenMP
+ *support, then the loop over the cases is run in parallel. Each thread
+ *reuses the same scratch space for all of its assignment problems.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *val=calcMOSPAErrorBatch(xEst,x,w);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "MexValidation.h"
+#include "metricFuncs.hpp"
+#include "mex.h"
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t xDim, numTar, numCases, numHyp;
+    bool xSharedOverCases, wSharedOverCases;
+    const double *xEst, *x, *w;
+    double *val;
+    mxArray *valMATLAB;
+
+    if(nrhs!=3) {
+        mexErrMsgTxt("Incorrect number of inputs.");
+    }
+
+    if(nlhs>1) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    checkRealDoubleHypermatrix(prhs[0]);
+    checkRealDoubleHypermatrix(prhs[1]);
+    checkRealDoubleArray(prhs[2]);
+
+    {
+        const mwSize numDims=mxGetNumberOfDimensions(prhs[0]);
+        const mwSize *dims=mxGetDimensions(prhs[0]);
+
+        if(numDims>3) {
+            mexErrMsgTxt("xEst has too many dimensions.");
+        }
+
+        xDim=dims[0];
+        numTar=dims[1];
+        numCases=numDims>2?dims[2]:1;
+    }
+
+    {
+        const mwSize numDims=mxGetNumberOfDimensions(prhs[1]);
+        const mwSize *dims=mxGetDimensions(prhs[1]);
+        size_t numXCases;
+
+        if(numDims>4) {
+            mexErrMsgTxt("x has too many dimensions.");
+        }
+
+        numHyp=numDims>2?dims[2]:1;
+        numXCases=numDims>3?dims[3]:1;
+        if(dims[0]!=xDim||dims[1]!=numTar||(numXCases!=numCases&&numXCases!=1)) {
+            mexErrMsgTxt("The dimensions of x are inconsistent with xEst.");
+        }
+        xSharedOverCases=numXCases==1;
+    }
+
+    if(mxGetM(prhs[2])!=numHyp||(mxGetN(prhs[2])!=numCases&&mxGetN(prhs[2])!=1)) {
+        mexErrMsgTxt("The dimensions of w are inconsistent with x.");
+    }
+    wSharedOverCases=mxGetN(prhs[2])==1;
+
+    xEst=(double*)mxGetData(prhs[0]);
+    x=(double*)mxGetData(prhs[1]);
+    w=(double*)mxGetData(prhs[2]);
+
+    valMATLAB=mxCreateDoubleMatrix(numCases,1,mxREAL);
+    val=(double*)mxGetData(valMATLAB);
+
+    #pragma omp parallel
+    {
+        ScratchSpace workMem(numTar,numTar);
+        MurtyHyp problemSol(numTar,numTar);
+        double *CScratch=new double[numTar*numTar];
+        ptrdiff_t curCase;
+
+        #pragma omp for schedule(dynamic)
+        for(curCase=0;curCase<(ptrdiff_t)numCases;curCase++) {
+            const double *xCur=xSharedOverCases?x:x+xDim*numTar*numHyp*curCase;
+            const double *wCur=wSharedOverCases?w:w+numHyp*curCase;
+
+            val[curCase]=calcMOSPACPP(xEst+xDim*numTar*curCase,xCur,wCur,xDim,numTar,numHyp,CScratch,workMem,&problemSol);
+        }
+
+        delete[] CScratch;
+    }
+
+    plhs[0]=valMATLAB;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
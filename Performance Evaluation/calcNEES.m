@@ -20,6 +20,10 @@ function NEES=calcNEES(xTrue,xEst,PEst)
 %"Basic Tracking Using Nonlinear 3D monostatic and Bistatic Measurements by
 %David F. Crouse.
 %
+%To compute the NEES at each time over many Monte Carlo runs, the compiled
+%function calcNEESBatch can be used. The compiled function calcOSPABatch
+%computes the OSPA and GOSPA metrics over many Monte Carlo runs.
+%
 %October 2013 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
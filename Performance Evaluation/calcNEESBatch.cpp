@@ -0,0 +1,163 @@
+/**CALCNEESBATCH Compute the normalized estimation error squared (NEES) at
+ *               each time over many Monte Carlo runs. At each time, this
+ *               is the same as calling calcNEES with the estimates from
+ *               all of the runs at that time.
+ *
+ *INPUTS: xTrue An xDimXnumTimesXnumRuns hypermatrix of the true target
+ *              states at each time in each run. If the truth is the same
+ *              in all runs, then this can be an xDimXnumTimes matrix.
+ *         xEst An xDimXnumTimesXnumRuns hypermatrix of the estimates.
+ *         PEst An xDimXxDimXnumTimesXnumRuns hypermatrix of the covariance
+ *              matrices associated with the estimates.
+ *
+ *OUTPUTS: NEES A numTimesX1 vector of the NEES at each time, normalized
+ *              such that the mean for a consistent estimator is one.
+ *      NEESAll A numTimesXnumRuns matrix of the normalized NEES of each
+ *              estimate, so that NEES=mean(NEESAll,2). This can be used to
+ *              find runs where the estimator diverged.
+ *
+ *The NEES is discussed in the comments to calcNEES. If a covariance matrix
+ *is not positive definite, then the corresponding element of NEESAll and
+ *the NEES at that time are NaN. If the code is compiled with OpenMP
+ *support, then the loop over the runs is run in parallel. The results do
+ *not depend on the number of threads, as the sum over the runs is taken
+ *afterwards in order.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[NEES,NEESAll]=calcNEESBatch(xTrue,xEst,PEst);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "MexValidation.h"
+#include "metricFuncs.hpp"
+#include "mex.h"
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t xDim, numTimes, numRuns;
+    bool trueSharedOverRuns;
+    const double *xTrue, *xEst, *PEst;
+    double *NEES, *NEESAll;
+    mxArray *NEESMATLAB, *NEESAllMATLAB;
+
+    if(nrhs!=3) {
+        mexErrMsgTxt("Incorrect number of inputs.");
+    }
+
+    if(nlhs>2) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    checkRealDoubleHypermatrix(prhs[0]);
+    checkRealDoubleHypermatrix(prhs[1]);
+    checkRealDoubleHypermatrix(prhs[2]);
+
+    {
+        const mwSize numDims=mxGetNumberOfDimensions(prhs[1]);
+        const mwSize *dims=mxGetDimensions(prhs[1]);
+
+        if(numDims>3) {
+            mexErrMsgTxt("xEst has too many dimensions.");
+        }
+
+        xDim=dims[0];
+        numTimes=dims[1];
+        numRuns=numDims>2?dims[2]:1;
+    }
+
+    {
+        const mwSize numDims=mxGetNumberOfDimensions(prhs[0]);
+        const mwSize *dims=mxGetDimensions(prhs[0]);
+        const size_t numTrueRuns=numDims>2?dims[2]:1;
+
+        if(numDims>3||dims[0]!=xDim||dims[1]!=numTimes||(numTrueRuns!=numRuns&&numTrueRuns!=1)) {
+            mexErrMsgTxt("The dimensions of xTrue are inconsistent with xEst.");
+        }
+        trueSharedOverRuns=numTrueRuns==1;
+    }
+
+    {
+        const mwSize numDims=mxGetNumberOfDimensions(prhs[2]);
+        const mwSize *dims=mxGetDimensions(prhs[2]);
+
+        if(numDims>4||dims[0]!=xDim||dims[1]!=xDim||(numDims>2?dims[2]:1)!=numTimes||(numDims>3?dims[3]:1)!=numRuns) {
+            mexErrMsgTxt("The dimensions of PEst are inconsistent with xEst.");
+        }
+    }
+
+    xTrue=(double*)mxGetData(prhs[0]);
+    xEst=(double*)mxGetData(prhs[1]);
+    PEst=(double*)mxGetData(prhs[2]);
+
+    NEESMATLAB=mxCreateDoubleMatrix(numTimes,1,mxREAL);
+    NEES=(double*)mxGetData(NEESMATLAB);
+    NEESAllMATLAB=mxCreateDoubleMatrix(numTimes,numRuns,mxREAL);
+    NEESAll=(double*)mxGetData(NEESAllMATLAB);
+
+    #pragma omp parallel
+    {
+        double *scratch=new double[xDim*(xDim+1)];
+        ptrdiff_t curRun;
+
+        #pragma omp for schedule(dynamic)
+        for(curRun=0;curRun<(ptrdiff_t)numRuns;curRun++) {
+            const double *xTrueRun=trueSharedOverRuns?xTrue:xTrue+xDim*numTimes*curRun;
+            size_t curTime;
+
+            for(curTime=0;curTime<numTimes;curTime++) {
+                const size_t idx=curTime+numTimes*curRun;
+
+                NEESAll[idx]=calcNEESTermCPP(xTrueRun+xDim*curTime,xEst+xDim*idx,PEst+xDim*xDim*idx,xDim,scratch);
+            }
+        }
+
+        delete[] scratch;
+    }
+
+    {
+        size_t curTime, curRun;
+
+        for(curTime=0;curTime<numTimes;curTime++) {
+            NEES[curTime]=0;
+        }
+
+        for(curRun=0;curRun<numRuns;curRun++) {
+            for(curTime=0;curTime<numTimes;curTime++) {
+                NEES[curTime]+=NEESAll[curTime+numTimes*curRun];
+            }
+        }
+
+        for(curTime=0;curTime<numTimes;curTime++) {
+            NEES[curTime]/=(double)numRuns;
+        }
+    }
+
+    plhs[0]=NEESMATLAB;
+    if(nlhs>1) {
+        plhs[1]=NEESAllMATLAB;
+    } else {
+        mxDestroyArray(NEESAllMATLAB);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
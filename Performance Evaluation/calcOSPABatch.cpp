@@ -0,0 +1,261 @@
+/**CALCOSPABATCH Compute the optimal subpattern assignment (OSPA) metric
+ *               and the generalized OSPA (GOSPA) metric between sets of
+ *               estimated and true target states at many times in many
+ *               Monte Carlo runs.
+ *
+ *INPUTS: xEst An xDimXmaxEstXnumTimesXnumRuns hypermatrix of target state
+ *             estimates. xEst(:,1:numEst(k,n),k,n) holds the estimates at
+ *             time k in run n and the remaining columns are ignored. In
+ *             general, only position components should be used.
+ *      numEst A numTimesXnumRuns matrix of the number of estimates at each
+ *             time in each run. If omitted or an empty matrix is passed,
+ *             then all maxEst columns are used everywhere.
+ *       xTrue An xDimXmaxTrueXnumTimesXnumRuns hypermatrix of true target
+ *             states, with the same layout as xEst. If the truth is the
+ *             same in all runs, then this can be xDimXmaxTrueXnumTimes.
+ *     numTrue A numTimesXnumRuns matrix (or a numTimesX1 vector if the
+ *             truth is the same in all runs) of the number of true
+ *             targets at each time. If omitted or an empty matrix is
+ *             passed, then all maxTrue columns are used everywhere.
+ *           c The positive cutoff distance.
+ *           p The order of the metric, p>=1. If omitted or an empty matrix
+ *             is passed, the default of 2 is used.
+ *
+ *OUTPUTS: OSPA A numTimesXnumRuns matrix of the OSPA metric at each time in
+ *              each run. This is zero if there are neither estimates nor
+ *              true targets.
+ *        GOSPA A numTimesXnumRuns matrix of the GOSPA metric with alpha=2.
+ *    GOSPAComp A 3XnumTimesXnumRuns hypermatrix of the parts of the GOSPA
+ *              metric raised to the pth power, so that
+ *              GOSPA(k,n)=sum(GOSPAComp(:,k,n))^(1/p). The rows are the
+ *              localization error of the assigned targets, the cost of
+ *              the missed targets and the cost of the false targets. The
+ *              number of missed targets is 2*GOSPAComp(2,k,n)/c^p and the
+ *              number of false targets is 2*GOSPAComp(3,k,n)/c^p.
+ *
+ *The OSPA metric is from [1] and the GOSPA metric is from [2]. Both are
+ *computed from a single optimal assignment with the cost matrix
+ *min(d,c)^p, where d is the Euclidean distance between an estimate and a
+ *true target, which is found using the function assign2D in
+ *ShortestPathCPP.cpp. See the comments in metricFuncsCPP.cpp for details.
+ *Averages over the runs can be taken in Matlab. For example, the mean
+ *OSPA over the runs at each time is mean(OSPA,2).
+ *
+ *If the code is compiled with OpenMP support, then the loop over the runs
+ *is run in parallel. Each thread reuses the same scratch space for all of
+ *its assignment problems.
+ *
+ *REFERENCES:
+ *[1] D. Schuhmacher, B.-T. Vo, and B.-N. Vo, "A consistent metric for
+ *    performance evaluation of multi-object filters," IEEE Transactions on
+ *    Signal Processing, vol. 56, no. 8, pp. 3447-3457, Aug. 2008.
+ *[2] A. S. Rahmathullah, A. F. Garcia-Fernandez, and L. Svensson,
+ *    "Generalized optimal sub-pattern assignment metric," in Proceedings
+ *    of the 20th International Conference on Information Fusion, Xi'an,
+ *    China, Jul. 2017.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[OSPA,GOSPA,GOSPAComp]=calcOSPABatch(xEst,numEst,xTrue,numTrue,c,p);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#include "MexValidation.h"
+#include "metricFuncs.hpp"
+#include "mex.h"
+
+static void getSetArrayDims(size_t *dims,const mxArray *x);
+static size_t *getSetCounts(const mxArray *numMATLAB,const size_t numTimes,const size_t numRuns,const size_t maxNum);
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t estDims[4], trueDims[4];
+    size_t xDim, maxEst, maxTrue, numTimes, numRuns, maxNum;
+    size_t *numEst, *numTrue;
+    bool trueSharedOverRuns;
+    double c, p=2;
+    const double *xEst, *xTrue;
+    double *OSPA, *GOSPA, *GOSPAComp;
+    mxArray *OSPAMATLAB, *GOSPAMATLAB, *GOSPACompMATLAB;
+
+    if(nrhs<5) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>6) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>3) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    getSetArrayDims(estDims,prhs[0]);
+    getSetArrayDims(trueDims,prhs[2]);
+    xDim=estDims[0];
+    maxEst=estDims[1];
+    numTimes=estDims[2];
+    numRuns=estDims[3];
+    maxTrue=trueDims[1];
+
+    if(trueDims[0]!=xDim||trueDims[2]!=numTimes||(trueDims[3]!=numRuns&&trueDims[3]!=1)) {
+        mexErrMsgTxt("The dimensions of xTrue are inconsistent with xEst.");
+    }
+    trueSharedOverRuns=trueDims[3]==1&&numRuns!=1;
+
+    c=getDoubleFromMatlab(prhs[4]);
+    if(!(c>0)) {
+        mexErrMsgTxt("c must be positive.");
+    }
+
+    if(nrhs>5&&!mxIsEmpty(prhs[5])) {
+        p=getDoubleFromMatlab(prhs[5]);
+        if(!(p>=1)||(p-p)!=0) {
+            mexErrMsgTxt("p must be finite and >=1.");
+        }
+    }
+
+    numEst=getSetCounts(prhs[1],numTimes,numRuns,maxEst);
+    numTrue=getSetCounts(prhs[3],numTimes,trueSharedOverRuns?1:numRuns,maxTrue);
+
+    xEst=(double*)mxGetData(prhs[0]);
+    xTrue=(double*)mxGetData(prhs[2]);
+
+    OSPAMATLAB=mxCreateDoubleMatrix(numTimes,numRuns,mxREAL);
+    OSPA=(double*)mxGetData(OSPAMATLAB);
+    GOSPAMATLAB=mxCreateDoubleMatrix(numTimes,numRuns,mxREAL);
+    GOSPA=(double*)mxGetData(GOSPAMATLAB);
+    {
+        mwSize dims[3];
+        dims[0]=3;
+        dims[1]=numTimes;
+        dims[2]=numRuns;
+        GOSPACompMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+        GOSPAComp=(double*)mxGetData(GOSPACompMATLAB);
+    }
+
+    maxNum=maxEst>maxTrue?maxEst:maxTrue;
+
+    //The runs are independent, so they are evaluated in parallel if OpenMP
+    //is available. Each thread allocates its scratch space once.
+    #pragma omp parallel
+    {
+        ScratchSpace workMem(maxNum,maxNum);
+        MurtyHyp problemSol(maxNum,maxNum);
+        double *CScratch=new double[maxNum*maxNum];
+        ptrdiff_t curRun;
+
+        #pragma omp for schedule(dynamic)
+        for(curRun=0;curRun<(ptrdiff_t)numRuns;curRun++) {
+            const size_t trueRun=trueSharedOverRuns?0:curRun;
+            size_t curTime;
+
+            for(curTime=0;curTime<numTimes;curTime++) {
+                const size_t idx=curTime+numTimes*curRun;
+                const size_t trueIdx=curTime+numTimes*trueRun;
+
+                calcOSPAGOSPACPP(OSPA+idx,GOSPA+idx,GOSPAComp+3*idx,xEst+xDim*maxEst*idx,numEst[idx],xTrue+xDim*maxTrue*trueIdx,numTrue[trueIdx],xDim,c,p,CScratch,workMem,&problemSol);
+            }
+        }
+
+        delete[] CScratch;
+    }
+
+    mxFree(numEst);
+    mxFree(numTrue);
+
+    plhs[0]=OSPAMATLAB;
+    if(nlhs>1) {
+        plhs[1]=GOSPAMATLAB;
+    } else {
+        mxDestroyArray(GOSPAMATLAB);
+    }
+
+    if(nlhs>2) {
+        plhs[2]=GOSPACompMATLAB;
+    } else {
+        mxDestroyArray(GOSPACompMATLAB);
+    }
+}
+
+static void getSetArrayDims(size_t *dims,const mxArray *x) {
+//Get the xDim, maxNum, numTimes and numRuns dimensions of an array of
+//sets of target states. The array may be empty if there are no targets.
+    const mwSize numDims=mxGetNumberOfDimensions(x);
+    const mwSize *xDims=mxGetDimensions(x);
+    size_t i;
+
+    if(mxIsComplex(x)||mxGetClassID(x)!=mxDOUBLE_CLASS) {
+        mexErrMsgTxt("The target states must be real doubles.");
+    }
+
+    if(numDims>4) {
+        mexErrMsgTxt("The target states have too many dimensions.");
+    }
+
+    for(i=0;i<4;i++) {
+        dims[i]=i<numDims?xDims[i]:1;
+    }
+
+    if(dims[0]==0) {
+        mexErrMsgTxt("The target state dimensionality cannot be zero.");
+    }
+}
+
+static size_t *getSetCounts(const mxArray *numMATLAB,const size_t numTimes,const size_t numRuns,const size_t maxNum) {
+//Get a numTimesXnumRuns array of the number of targets in each set. If
+//numMATLAB is empty, all sets have maxNum targets.
+    const size_t numSets=numTimes*numRuns;
+    size_t *num=(size_t*)mxMalloc(sizeof(size_t)*numSets);
+    size_t i;
+
+    if(mxIsEmpty(numMATLAB)) {
+        for(i=0;i<numSets;i++) {
+            num[i]=maxNum;
+        }
+        return num;
+    }
+
+    checkRealDoubleArray(numMATLAB);
+    if(mxGetNumberOfElements(numMATLAB)!=numSets) {
+        mxFree(num);
+        mexErrMsgTxt("The dimensions of a matrix of target counts are inconsistent with the target states.");
+    }
+
+    {
+        const double *numDouble=(double*)mxGetData(numMATLAB);
+
+        for(i=0;i<numSets;i++) {
+            const double curNum=numDouble[i];
+
+            if(!(curNum>=0&&curNum<=(double)maxNum)||curNum!=(double)(size_t)curNum) {
+                mxFree(num);
+                mexErrMsgTxt("The target counts must be integers from 0 to the number of columns of target states.");
+            }
+            num[i]=(size_t)curNum;
+        }
+    }
+
+    return num;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
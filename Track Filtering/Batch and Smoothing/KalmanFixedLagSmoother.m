@@ -0,0 +1,274 @@
+classdef KalmanFixedLagSmoother < handle
+%%KALMANFIXEDLAGSMOOTHER A fixed-lag linear Kalman smoother that processes
+%       the measurements of a batch of tracks as they arrive and produces
+%       smoothed estimates a fixed number of steps in the past. Unlike the
+%       function KalmanSmoother, which requires the entire history of
+%       measurements at once, the memory used by this class does not grow
+%       with the length of the tracks; only the last lag+1 filtered and
+%       predicted states and covariance matrices of each track are kept.
+%       This class requires that the C++ function
+%       KalmanFixedLagSmootherCPPInt be compiled using CompileCLibraries.
+%
+%The tracks in the batch are all updated and predicted at the same time.
+%The state transition, process noise, measurement and measurement
+%covariance matrices can either be shared by all tracks or given
+%separately for each track. Missing measurements for a particular track
+%are indicated by NaN values in the columns of z for that track.
+%
+%After the measurement at discrete time k has been processed, the smoothed
+%estimate at time k-lag is returned. The estimate is the same as that
+%obtained by running the function KalmanSmoother with useFP=false on all
+%measurements from time 1 through k and taking the result at time k-lag.
+%The Rauch-Tung-Striebel smoother of Chapter 8.6 of
+%Y. Bar-Shalom, X. R. Li, and T. Kirubarajan, Estimation with Applications
+%to Tracking and Navigation. New York: John Wiley and Sons, Inc, 2001.
+%is run over the window of stored steps with the smoothing gains computed
+%once during the prediction steps, so the computational complexity per
+%measurement is linear in the lag. If the C++ code was compiled with
+%OpenMP support, the tracks are processed in parallel. Measurements that
+%arrive out of sequence can be processed with the OOSMUpdate method as long
+%as they are no more than lag steps old.
+%
+%An example of use for a set of tracks with a common linear dynamic model
+%is
+% theSmoother=KalmanFixedLagSmoother(xInit,PInit,lag);
+% for k=1:N
+%     [xSmooth,PSmooth,kSmooth]=theSmoother.update(z(:,:,k),H,R);
+%     if(~isempty(kSmooth))
+%         %Do something with the smoothed estimates at time kSmooth.
+%     end
+%     theSmoother.predict(F,Q);
+% end
+% %Get the smoothed estimates of the final lag steps.
+% [xSmoothEnd,PSmoothEnd,kSmoothEnd]=theSmoother.flush();
+%
+%October 2026 agent, Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+properties(Access=private)
+    CPPData%The pointer to the C++ class instance.
+end
+
+methods
+    function newSmoother=KalmanFixedLagSmoother(xInit,PInit,lag)
+    %%KALMANFIXEDLAGSMOOTHER Create a new fixed-lag smoother for a batch
+    %                        of tracks.
+    %
+    %INPUTS: xInit The xDimXnumTracks set of predicted states of the
+    %              tracks at the time of the first measurement.
+    %        PInit The xDimXxDimXnumTracks set of covariance matrices
+    %              associated with xInit. If all tracks have the same
+    %              initial covariance matrix, a single xDimXxDim matrix can
+    %              be passed.
+    %          lag The non-negative integer number of steps of delay of the
+    %              smoothed estimates. A lag of zero just provides the
+    %              filtered estimates.
+    %
+    %OUTPUTS: newSmoother The new KalmanFixedLagSmoother object.
+
+        if(~exist('KalmanFixedLagSmootherCPPInt','file'))
+            error('The C++ function KalmanFixedLagSmootherCPPInt must be compiled to use this class.')
+        end
+
+        if(lag<0||fix(lag)~=lag)
+           error('The lag must be a non-negative integer.')
+        end
+
+        newSmoother.CPPData=KalmanFixedLagSmootherCPPInt('FixedLagSmootherCPP',xInit,PInit,lag);
+    end
+
+    function [xSmooth,PSmooth,kSmooth,updateFailed]=update(theSmoother,z,H,R)
+    %%UPDATE Perform a measurement update on all of the tracks. If enough
+    %        measurements have been processed, a smoothed estimate of
+    %        the state of each track lag steps in the past is returned.
+    %
+    %INPUTS: theSmoother The implicitly passed KalmanFixedLagSmoother
+    %                  object.
+    %                z The zDimXnumTracks set of measurements. A column
+    %                  containing any NaN values indicates that no
+    %                  measurement is available for that track at this
+    %                  step.
+    %                H The zDimXxDimXnumTracks set of measurement matrices,
+    %                  or a single zDimXxDim matrix if it is shared by all
+    %                  tracks.
+    %                R The zDimXzDimXnumTracks set of measurement
+    %                  covariance matrices, or a single zDimXzDim matrix if
+    %                  it is shared by all tracks.
+    %
+    %OUTPUTS: xSmooth The xDimXnumTracks smoothed states at the discrete
+    %                 time kSmooth. This is an empty matrix if fewer than
+    %                 lag+1 measurements have been processed or if the
+    %                 estimate of that time was already returned by flush.
+    %         PSmooth The xDimXxDimXnumTracks smoothed covariance matrices
+    %                 or an empty matrix. If this output is not requested,
+    %                 the smoothed covariance matrices are not computed,
+    %                 which is significantly faster.
+    %         kSmooth The discrete time (starting from 1) of the smoothed
+    %                 estimates or an empty matrix if no smoothed estimate
+    %                 was produced.
+    %    updateFailed A numTracksX1 boolean vector indicating tracks where
+    %                 the innovation covariance matrix was not positive
+    %                 definite, in which case no update was performed.
+
+        switch(nargout)
+            case {0,1}
+                xSmooth=KalmanFixedLagSmootherCPPInt('update',theSmoother.CPPData,z,H,R);
+            case 2
+                [xSmooth,PSmooth]=KalmanFixedLagSmootherCPPInt('update',theSmoother.CPPData,z,H,R);
+            case 3
+                [xSmooth,PSmooth,kSmooth]=KalmanFixedLagSmootherCPPInt('update',theSmoother.CPPData,z,H,R);
+            otherwise
+                [xSmooth,PSmooth,kSmooth,updateFailed]=KalmanFixedLagSmootherCPPInt('update',theSmoother.CPPData,z,H,R);
+        end
+    end
+
+    function updateFailed=OOSMUpdate(theSmoother,z,H,R,numStepsBack,F1,Q1,F2)
+    %%OOSMUPDATE Update the current estimates of all of the tracks with an
+    %            out-of-sequence measurement (OOSM), which is a
+    %            measurement from a time tau before the most recent
+    %            update. This must be called after update and before
+    %            predict. The computational cost is linear in numStepsBack
+    %            and is much less than that of reprocessing the stored
+    %            steps. The result is the same as if the measurement had
+    %            been processed in sequence, but only the current estimates
+    %            include the OOSM; the smoothed estimates of earlier steps
+    %            only include it through the current estimates.
+    %
+    %INPUTS: theSmoother The implicitly passed KalmanFixedLagSmoother
+    %                  object.
+    %           z, H, R The OOSMs, measurement matrices and measurement
+    %                  covariance matrices of the tracks, as in the update
+    %                  method. A column of z containing NaN values
+    %                  indicates that the track has no OOSM.
+    %     numStepsBack The positive integer number of updates that have
+    %                  been performed after tau. That is, tau lies between
+    %                  the times of the updates numStepsBack and
+    %                  numStepsBack-1 steps ago, where 0 steps ago is the
+    %                  most recent update. This cannot be more than the lag
+    %                  or the number of updates minus 1.
+    %           F1, Q1 The state transition and process noise covariance
+    %                  matrices from the time of the update numStepsBack
+    %                  steps ago to tau. These are xDimXxDimXnumTracks or
+    %                  xDimXxDim if they are shared by all tracks.
+    %               F2 The state transition matrix from tau to the time of
+    %                  the update numStepsBack-1 steps ago. The matrices
+    %                  passed to predict for that step should be F=F2*F1
+    %                  and Q=F2*Q1*F2'+Q2, where Q2 is the process noise
+    %                  covariance matrix from tau to the time of the update.
+    %
+    %OUTPUTS: updateFailed A numTracksX1 boolean vector indicating tracks
+    %                     where the innovation covariance matrix was not
+    %                     positive definite, in which case the track is not
+    %                     updated.
+    %
+    %The algorithm runs the Rauch-Tung-Striebel smoothing recursion back
+    %over the stored steps, keeping track of the cross covariance with the
+    %current state, to find the joint distribution of the current state and
+    %the state at tau and then updates the current state with the OOSM. For
+    %numStepsBack=1, this is algorithm A1 of
+    %Y. Bar-Shalom, "Update with out-of-sequence measurements in tracking:
+    %Exact solution," IEEE Transactions on Aerospace and Electronic
+    %Systems, vol. 38, no. 3, pp. 769-778, Jul. 2002.
+
+        updateFailed=KalmanFixedLagSmootherCPPInt('OOSMUpdate',theSmoother.CPPData,z,H,R,numStepsBack,F1,Q1,F2);
+    end
+
+    function predFailed=predict(theSmoother,F,Q,u)
+    %%PREDICT Predict all of the tracks forward to the time of the next
+    %         measurement.
+    %
+    %INPUTS: theSmoother The implicitly passed KalmanFixedLagSmoother
+    %                  object.
+    %                F The xDimXxDimXnumTracks set of state transition
+    %                  matrices, or a single xDimXxDim matrix if it is
+    %                  shared by all tracks.
+    %                Q The xDimXxDimXnumTracks set of process noise
+    %                  covariance matrices, or a single xDimXxDim matrix if
+    %                  it is shared by all tracks.
+    %                u An optional xDimXnumTracks matrix of control inputs.
+    %                  If omitted or an empty matrix is passed, no control
+    %                  input is used.
+    %
+    %OUTPUTS: predFailed A numTracksX1 boolean vector indicating tracks
+    %                   where the predicted covariance matrix was singular
+    %                   so that the smoothing gain could not be computed.
+    %                   In that instance, the smoothed estimate at the
+    %                   step before the prediction is just the filtered
+    %                   estimate.
+
+        if(nargin<4)
+            u=[];
+        end
+
+        predFailed=KalmanFixedLagSmootherCPPInt('predict',theSmoother.CPPData,F,Q,u);
+    end
+
+    function [xSmooth,PSmooth,kSmooth]=flush(theSmoother)
+    %%FLUSH Get the smoothed estimates of all of the steps for which
+    %       smoothed estimates have not yet been returned. This is
+    %       typically called after the final measurement of the tracks
+    %       has been processed. Subsequent calls to update continue from
+    %       where the smoother left off, but the next lag calls return no
+    %       smoothed estimates, since the steps that they would smooth
+    %       were returned here.
+    %
+    %INPUT: theSmoother The implicitly passed KalmanFixedLagSmoother
+    %                   object.
+    %
+    %OUTPUTS: xSmooth The xDimXnumTracksXnumOut set of smoothed states for
+    %                 the numOut steps, oldest first.
+    %         PSmooth The xDimXxDimXnumTracksXnumOut set of smoothed
+    %                 covariance matrices.
+    %         kSmooth The numOutX1 vector of the discrete times (starting
+    %                 from 1) of the smoothed estimates.
+
+        switch(nargout)
+            case {0,1}
+                xSmooth=KalmanFixedLagSmootherCPPInt('flush',theSmoother.CPPData);
+            case 2
+                [xSmooth,PSmooth]=KalmanFixedLagSmootherCPPInt('flush',theSmoother.CPPData);
+            otherwise
+                [xSmooth,PSmooth,kSmooth]=KalmanFixedLagSmootherCPPInt('flush',theSmoother.CPPData);
+        end
+    end
+
+    function [xDim,numTracks,lag,numUpdates]=getDims(theSmoother)
+    %%GETDIMS Get the state dimensionality, the number of tracks, the lag
+    %         and the number of measurement updates that have been
+    %         performed.
+
+        [xDim,numTracks,lag,numUpdates]=KalmanFixedLagSmootherCPPInt('getDims',theSmoother.CPPData);
+        xDim=double(xDim);
+        numTracks=double(numTracks);
+        lag=double(lag);
+        numUpdates=double(numUpdates);
+    end
+
+    function delete(theSmoother)
+    %%DELETE The destructor method. This frees the memory of the C++ class
+    %        and prevents a memory leak.
+
+        if(~isempty(theSmoother.CPPData))
+            KalmanFixedLagSmootherCPPInt('~FixedLagSmootherCPP',theSmoother.CPPData);
+        end
+    end
+end
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
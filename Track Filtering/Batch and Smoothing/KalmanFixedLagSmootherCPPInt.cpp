@@ -0,0 +1,348 @@
+/**KALMANFIXEDLAGSMOOTHERCPPINT An interface between the Matlab
+ *              KalmanFixedLagSmoother class and the C++
+ *              FixedLagSmootherCPP class. This function is meant to be
+ *              called by the KalmanFixedLagSmoother class in Matlab; not
+ *              directly by the user. Input validation beyond checking
+ *              the dimensions of the matrices is left to the Matlab class.
+ *
+ *The function is called as
+ *CPPData=KalmanFixedLagSmootherCPPInt('FixedLagSmootherCPP',xInit,PInit,lag);
+ *or
+ *[xSmooth,PSmooth,kSmooth,updateFailed]=KalmanFixedLagSmootherCPPInt('update',CPPData,z,H,R);
+ *or
+ *updateFailed=KalmanFixedLagSmootherCPPInt('OOSMUpdate',CPPData,z,H,R,numStepsBack,F1,Q1,F2);
+ *or
+ *predFailed=KalmanFixedLagSmootherCPPInt('predict',CPPData,F,Q,u);
+ *or
+ *[xSmooth,PSmooth,kSmooth]=KalmanFixedLagSmootherCPPInt('flush',CPPData);
+ *or
+ *[xDim,numTracks,lag,numUpdates]=KalmanFixedLagSmootherCPPInt('getDims',CPPData);
+ *or
+ *KalmanFixedLagSmootherCPPInt('~FixedLagSmootherCPP',CPPData);
+ *
+ *See the KalmanFixedLagSmoother class for a description of the inputs and
+ *outputs.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For strcmp
+#include <cstring>
+#include "MexValidation.h"
+#include "filterFuncs.hpp"
+#include "mex.h"
+
+//Prototypes for the helper functions.
+bool checkMatStack(const mxArray *mat,const size_t numRow,const size_t numCol,const size_t numTracks);
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    char cmd[64];
+    FixedLagSmootherCPP *theSmoother;
+
+    if(nrhs<2) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>9) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    //Get the command string that is passed.
+    mxGetString(prhs[0], cmd, sizeof(cmd));
+
+    if(!strcmp("FixedLagSmootherCPP", cmd)){
+        size_t xDim, numTracks, lag;
+        bool PInitIsShared;
+
+        if(nrhs!=4) {
+            mexErrMsgTxt("Incorrect number of inputs.");
+        }
+
+        checkRealDoubleArray(prhs[1]);
+        checkRealDoubleHypermatrix(prhs[2]);
+        xDim=mxGetM(prhs[1]);
+        numTracks=mxGetN(prhs[1]);
+        lag=getSizeTFromMatlab(prhs[3]);
+
+        if(xDim==0||numTracks==0) {
+            mexErrMsgTxt("xInit cannot be empty.");
+        }
+
+        PInitIsShared=checkMatStack(prhs[2],xDim,xDim,numTracks);
+
+        theSmoother=new FixedLagSmootherCPP(xDim,numTracks,lag,(double*)mxGetData(prhs[1]),(double*)mxGetData(prhs[2]),PInitIsShared);
+
+        //Lock this mex file so that it can not be cleared until the object
+        //has been deleted (This avoids a memory leak).
+        mexLock();
+        //Return the pointer to the smoother
+        plhs[0]=ptr2Matlab<FixedLagSmootherCPP*>(theSmoother);
+    } else if(!strcmp("update",cmd)) {
+        size_t xDim, numTracks, zDim;
+        bool HIsShared, RIsShared, hasOutput;
+        mxArray *xSmoothMATLAB, *PSmoothMATLAB, *updateFailedMATLAB;
+        double *PSmooth=NULL;
+        bool *updateFailed;
+
+        if(nrhs!=5) {
+            mexErrMsgTxt("Incorrect number of inputs.");
+        }
+
+        theSmoother=Matlab2Ptr<FixedLagSmootherCPP*>(prhs[1]);
+        xDim=theSmoother->xDim;
+        numTracks=theSmoother->numTracks;
+
+        checkRealDoubleArray(prhs[2]);
+        checkRealDoubleHypermatrix(prhs[3]);
+        checkRealDoubleHypermatrix(prhs[4]);
+        zDim=mxGetM(prhs[2]);
+        if(zDim==0||mxGetN(prhs[2])!=numTracks) {
+            mexErrMsgTxt("z has the wrong dimensionality.");
+        }
+        HIsShared=checkMatStack(prhs[3],zDim,xDim,numTracks);
+        RIsShared=checkMatStack(prhs[4],zDim,zDim,numTracks);
+
+        if(theSmoother->predPending==false) {
+            mexErrMsgTxt("A prediction must be performed before the next update.");
+        }
+
+        //If a smoothed estimate will be produced.
+        hasOutput=theSmoother->nextUpdateHasOutput();
+        if(hasOutput) {
+            mwSize dims[3];
+            dims[0]=xDim;
+            dims[1]=xDim;
+            dims[2]=numTracks;
+
+            xSmoothMATLAB=mxCreateDoubleMatrix(xDim,numTracks,mxREAL);
+            if(nlhs>1) {
+                PSmoothMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+                PSmooth=(double*)mxGetData(PSmoothMATLAB);
+            } else {
+                PSmoothMATLAB=NULL;
+            }
+        } else {
+            xSmoothMATLAB=mxCreateDoubleMatrix(0,0,mxREAL);
+            PSmoothMATLAB=mxCreateDoubleMatrix(0,0,mxREAL);
+        }
+
+        updateFailed=new bool[numTracks];
+        theSmoother->update((double*)mxGetData(xSmoothMATLAB),PSmooth,updateFailed,(double*)mxGetData(prhs[2]),zDim,(double*)mxGetData(prhs[3]),HIsShared,(double*)mxGetData(prhs[4]),RIsShared);
+        updateFailedMATLAB=boolMat2Matlab(updateFailed,numTracks,1);
+        delete[] updateFailed;
+
+        plhs[0]=xSmoothMATLAB;
+        if(nlhs>1) {
+            plhs[1]=PSmoothMATLAB;
+            if(nlhs>2) {
+                //The index of the smoothed step in Matlab (starting from
+                //1), if a smoothed estimate was produced.
+                if(hasOutput) {
+                    plhs[2]=mxCreateDoubleScalar((double)(theSmoother->numUpdates-theSmoother->lag));
+                } else {
+                    plhs[2]=mxCreateDoubleMatrix(0,0,mxREAL);
+                }
+
+                if(nlhs>3) {
+                    plhs[3]=updateFailedMATLAB;
+                } else {
+                    mxDestroyArray(updateFailedMATLAB);
+                }
+            } else {
+                mxDestroyArray(updateFailedMATLAB);
+            }
+        } else {
+            if(PSmoothMATLAB!=NULL) {
+                mxDestroyArray(PSmoothMATLAB);
+            }
+            mxDestroyArray(updateFailedMATLAB);
+        }
+    } else if(!strcmp("OOSMUpdate",cmd)) {
+        size_t xDim, numTracks, zDim, numStepsBack;
+        bool HIsShared, RIsShared, F1IsShared, Q1IsShared, F2IsShared;
+        bool *updateFailed;
+
+        if(nrhs!=9) {
+            mexErrMsgTxt("Incorrect number of inputs.");
+        }
+
+        theSmoother=Matlab2Ptr<FixedLagSmootherCPP*>(prhs[1]);
+        xDim=theSmoother->xDim;
+        numTracks=theSmoother->numTracks;
+
+        checkRealDoubleArray(prhs[2]);
+        checkRealDoubleHypermatrix(prhs[3]);
+        checkRealDoubleHypermatrix(prhs[4]);
+        zDim=mxGetM(prhs[2]);
+        if(zDim==0||mxGetN(prhs[2])!=numTracks) {
+            mexErrMsgTxt("z has the wrong dimensionality.");
+        }
+        HIsShared=checkMatStack(prhs[3],zDim,xDim,numTracks);
+        RIsShared=checkMatStack(prhs[4],zDim,zDim,numTracks);
+        numStepsBack=getSizeTFromMatlab(prhs[5]);
+        checkRealDoubleHypermatrix(prhs[6]);
+        checkRealDoubleHypermatrix(prhs[7]);
+        checkRealDoubleHypermatrix(prhs[8]);
+        F1IsShared=checkMatStack(prhs[6],xDim,xDim,numTracks);
+        Q1IsShared=checkMatStack(prhs[7],xDim,xDim,numTracks);
+        F2IsShared=checkMatStack(prhs[8],xDim,xDim,numTracks);
+
+        if(theSmoother->predPending==true) {
+            mexErrMsgTxt("An out-of-sequence measurement can only be processed after an update and before the next prediction.");
+        }
+
+        if(numStepsBack==0||numStepsBack>theSmoother->lag||numStepsBack>=theSmoother->numUpdates) {
+            mexErrMsgTxt("The out-of-sequence measurement is older than the stored steps.");
+        }
+
+        updateFailed=new bool[numTracks];
+        theSmoother->OOSMUpdate(updateFailed,(double*)mxGetData(prhs[2]),zDim,(double*)mxGetData(prhs[3]),HIsShared,(double*)mxGetData(prhs[4]),RIsShared,numStepsBack,(double*)mxGetData(prhs[6]),F1IsShared,(double*)mxGetData(prhs[7]),Q1IsShared,(double*)mxGetData(prhs[8]),F2IsShared);
+
+        if(nlhs>0) {
+            plhs[0]=boolMat2Matlab(updateFailed,numTracks,1);
+        }
+        delete[] updateFailed;
+    } else if(!strcmp("predict",cmd)) {
+        size_t xDim, numTracks;
+        bool FIsShared, QIsShared;
+        double *u=NULL;
+        bool *predFailed;
+
+        if(nrhs<4) {
+            mexErrMsgTxt("Not enough inputs.");
+        }
+
+        theSmoother=Matlab2Ptr<FixedLagSmootherCPP*>(prhs[1]);
+        xDim=theSmoother->xDim;
+        numTracks=theSmoother->numTracks;
+
+        checkRealDoubleHypermatrix(prhs[2]);
+        checkRealDoubleHypermatrix(prhs[3]);
+        FIsShared=checkMatStack(prhs[2],xDim,xDim,numTracks);
+        QIsShared=checkMatStack(prhs[3],xDim,xDim,numTracks);
+
+        if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+            checkRealDoubleArray(prhs[4]);
+            if(mxGetM(prhs[4])!=xDim||mxGetN(prhs[4])!=numTracks) {
+                mexErrMsgTxt("u has the wrong dimensionality.");
+            }
+            u=(double*)mxGetData(prhs[4]);
+        }
+
+        if(theSmoother->predPending==true) {
+            mexErrMsgTxt("An update must be performed before the next prediction.");
+        }
+
+        predFailed=new bool[numTracks];
+        theSmoother->predict(predFailed,(double*)mxGetData(prhs[2]),FIsShared,(double*)mxGetData(prhs[3]),QIsShared,u);
+
+        if(nlhs>0) {
+            plhs[0]=boolMat2Matlab(predFailed,numTracks,1);
+        }
+        delete[] predFailed;
+    } else if(!strcmp("flush",cmd)) {
+        size_t xDim, numTracks, numOut, firstStep, i;
+        mxArray *xSmoothMATLAB, *PSmoothMATLAB=NULL;
+        double *PSmooth=NULL;
+        mwSize dims[4];
+
+        theSmoother=Matlab2Ptr<FixedLagSmootherCPP*>(prhs[1]);
+        xDim=theSmoother->xDim;
+        numTracks=theSmoother->numTracks;
+        numOut=theSmoother->numUnsmoothed();
+        //The Matlab index of the first smoothed step.
+        firstStep=theSmoother->numSmoothed+1;
+
+        dims[0]=xDim;
+        dims[1]=numTracks;
+        dims[2]=numOut;
+        xSmoothMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+        if(nlhs>1) {
+            dims[0]=xDim;
+            dims[1]=xDim;
+            dims[2]=numTracks;
+            dims[3]=numOut;
+            PSmoothMATLAB=mxCreateNumericArray(4,dims,mxDOUBLE_CLASS,mxREAL);
+            PSmooth=(double*)mxGetData(PSmoothMATLAB);
+        }
+
+        theSmoother->flush((double*)mxGetData(xSmoothMATLAB),PSmooth);
+
+        plhs[0]=xSmoothMATLAB;
+        if(nlhs>1) {
+            plhs[1]=PSmoothMATLAB;
+            if(nlhs>2) {
+                double *kSmooth;
+
+                plhs[2]=mxCreateDoubleMatrix(numOut,1,mxREAL);
+                kSmooth=(double*)mxGetData(plhs[2]);
+                for(i=0;i<numOut;i++) {
+                    kSmooth[i]=(double)(firstStep+i);
+                }
+            }
+        }
+    } else if(!strcmp("getDims",cmd)) {
+        theSmoother=Matlab2Ptr<FixedLagSmootherCPP*>(prhs[1]);
+
+        switch(nlhs) {
+            case 4:
+                plhs[3]=unsignedSizeMat2Matlab(&(theSmoother->numUpdates),1,1);
+            case 3:
+                plhs[2]=unsignedSizeMat2Matlab(&(theSmoother->lag),1,1);
+            case 2:
+                plhs[1]=unsignedSizeMat2Matlab(&(theSmoother->numTracks),1,1);
+            default:
+                plhs[0]=unsignedSizeMat2Matlab(&(theSmoother->xDim),1,1);
+        }
+    } else if(!strcmp("~FixedLagSmootherCPP", cmd)){
+        theSmoother=Matlab2Ptr<FixedLagSmootherCPP*>(prhs[1]);
+
+        delete theSmoother;
+        //Unlock the mex file allowing it to be cleared.
+        mexUnlock();
+    } else {
+        mexErrMsgTxt("Invalid string passed to KalmanFixedLagSmootherCPPInt.");
+    }
+}
+
+bool checkMatStack(const mxArray *mat,const size_t numRow,const size_t numCol,const size_t numTracks) {
+/*CHECKMATSTACK Verify that a matrix is either numRowXnumCol or
+ *              numRowXnumColXnumTracks. The return value is true if a
+ *              single matrix that is shared by all tracks was passed.
+ */
+    const mwSize numDims=mxGetNumberOfDimensions(mat);
+    const mwSize *dims=mxGetDimensions(mat);
+
+    if(dims[0]!=numRow||dims[1]!=numCol||numDims>3) {
+        mexErrMsgTxt("A matrix input has the wrong dimensionality.");
+    }
+
+    if(numDims==2||dims[2]==1) {
+        return true;
+    }
+
+    if(dims[2]!=numTracks) {
+        mexErrMsgTxt("A stack of matrices must have one matrix per track.");
+    }
+
+    return false;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
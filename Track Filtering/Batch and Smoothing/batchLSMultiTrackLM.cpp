@@ -0,0 +1,332 @@
+/**BATCHLSMULTITRACKLM Given batches of measurements of multiple targets,
+ *                     perform batch least squares refinement of the states
+ *                     of each target at every step of the batch under a
+ *                     nonlinear measurement model and a linear dynamic
+ *                     model with process noise. Nonlinear least squares
+ *                     optimization is performed using the Levenberg-
+ *                     Marquardt algorithm with an analytic Jacobian and
+ *                     the block-tridiagonal structure of the problem is
+ *                     exploited so that the complexity of each iteration
+ *                     is linear in the number of steps in the batch.
+ *
+ *INPUTS: xInit The xDimXNXnumTracks initial estimates of the states of the
+ *              targets at each of the N steps of the batch. For a single
+ *              track, this is just an xDimXN matrix.
+ *            z The zDimXNXnumTracks measurements of the targets. A
+ *              measurement containing NaN values is treated as missing.
+ *     measType An integer specifying the measurement model. Possible
+ *              values are
+ *              0 A linear measurement model, z=H*x. measParam is the
+ *                zDimXxDim matrix H.
+ *              1 A 2D polar measurement [range;azimuth] of the position
+ *                x(1:2) of the target, with the azimuth measured
+ *                counterclockwise from the x-axis. measParam is the 2X1
+ *                location of the sensor. zDim=2.
+ *              2 A 3D spherical measurement [range;azimuth;elevation] of
+ *                the position x(1:3) of the target with the angles defined
+ *                as in Cart2Sphere with systemType=0. measParam is the 3X1
+ *                location of the sensor. zDim=3.
+ *              3 The same as 2, except the angles are defined as in
+ *                Cart2Sphere with systemType=1.
+ *    measParam The parameter of the measurement model, as described
+ *              above. For the nonlinear models, an empty matrix can be
+ *              passed if the sensor is at the origin.
+ *            F The xDimXxDimX(N-1) state transition matrices. The state at
+ *              discrete-time k+1 is modeled as F(:,:,k) times the state at
+ *              time k plus zero-mean Gaussian process noise with
+ *              covariance matrix Q(:,:,k). If all of the state transition
+ *              matrices are the same, a single xDimXxDim matrix can be
+ *              passed.
+ *            R The zDimXzDimXN measurement covariance matrices, or a single
+ *              zDimXzDim matrix if they are all the same.
+ *            Q The xDimXxDimX(N-1) positive definite process noise
+ *              covariance matrices, or a single xDimXxDim matrix if they
+ *              are all the same.
+ * TolG, TolX, maxIter, maxTries Optional parameters of the Levenberg-
+ *              Marquardt algorithm that are described in the comments to
+ *              the function LSEstLMarquardt. If omitted or empty matrices
+ *              are passed, the defaults are respectively 1e-6, 1e-9,
+ *              100+10*xDim*N, and 100.
+ *
+ *OUTPUTS: xEst The xDimXNXnumTracks refined state estimates.
+ *         PEst The xDimXxDimXNXnumTracks covariance matrices of the
+ *              estimates. These are the diagonal blocks of the inverse of
+ *              the Fisher information matrix J'*J at the solution. If the
+ *              optimization failed or the information matrix is singular,
+ *              the matrices for the track are filled with NaNs.
+ *     exitCode A numTracksX1 vector of the exit codes of the Levenberg-
+ *              Marquardt algorithm for each track. The values are
+ *              described in the comments to the function LSEstLMarquardt.
+ *      numIter A numTracksX1 vector of the number of iterations performed
+ *              for each track.
+ *
+ *This function solves the same optimization problem as
+ *batchLSNonlinMeasLinDynLM with process noise, namely the ML estimation
+ *problem of
+ *A. B. Poore, B. J. Slocumb, B. J. Suchomel, F. H. Obermeyer, S. M.
+ *Herman, and S. M. Gadaleta, "Batch maximum likelihood (ML) and maximum a
+ *posteriori (MAP) estimation with process noise for tracking
+ *applications," in Proceedings of SPIE: Signal and Data Processing of
+ *Small Targets, vol. 5204, San Diego, CA, 3 Aug. 2003, pp. 188-199.
+ *However, batchLSNonlinMeasLinDynLM forms dense Jacobian matrices over the
+ *entire batch, so the cost of each iteration grows cubically with the
+ *number of steps. Here, the state at each step only interacts with the
+ *states at adjacent steps through the dynamic model, so the normal
+ *equations are block-tridiagonal and are solved by block elimination, as
+ *described in the file batchLSLMCPP.cpp. The tracks are independent. If
+ *the code is compiled with OpenMP support, then the loop over the tracks
+ *is run in parallel. For nonlinear continuous-time dynamic models, see
+ *batchLSMultiTrackNonlinDynLM.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[xEst,PEst,exitCode,numIter]=batchLSMultiTrackLM(xInit,z,measType,measParam,F,R,Q,TolG,TolX,maxIter,maxTries);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy and fill_n
+#include <algorithm>
+#include "MexValidation.h"
+#include "filterFuncs.hpp"
+#include "mex.h"
+
+using namespace std;
+
+//Prototypes for the helper functions.
+bool checkMatSeq(const mxArray *mat,const size_t numRow,const size_t numCol,const size_t numMats);
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t xDim, zDim, numSteps, numTracks, maxIter, maxTries;
+    double TolG=1e-6;
+    double TolX=1e-9;
+    int measType;
+    const double *xInit, *z, *measParam;
+    const double zeroLoc[3]={0,0,0};
+    bool FIsShared=true, RIsShared, QIsShared=true;
+    bool modelIsValid;
+    BatchLSModelCPP model;
+    mxArray *xEstMATLAB, *PEstMATLAB=NULL, *exitCodeMATLAB, *numIterMATLAB;
+    double *xEst, *PEst=NULL, *exitCode, *numIterOut;
+    mwSize numDims;
+    const mwSize *dims;
+    const double NaNVal=mxGetNaN();
+
+    if(nrhs<7) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>11) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>4) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    checkRealDoubleHypermatrix(prhs[0]);
+    checkRealDoubleHypermatrix(prhs[1]);
+    numDims=mxGetNumberOfDimensions(prhs[0]);
+    dims=mxGetDimensions(prhs[0]);
+    if(numDims>3) {
+        mexErrMsgTxt("xInit has the wrong dimensionality.");
+    }
+    xDim=dims[0];
+    numSteps=dims[1];
+    numTracks=numDims==3?dims[2]:1;
+
+    if(xDim==0||numSteps==0||numTracks==0) {
+        mexErrMsgTxt("xInit cannot be empty.");
+    }
+
+    numDims=mxGetNumberOfDimensions(prhs[1]);
+    dims=mxGetDimensions(prhs[1]);
+    zDim=dims[0];
+    if(numDims>3||dims[1]!=numSteps||(numDims==3?dims[2]:1)!=numTracks) {
+        mexErrMsgTxt("The dimensions of z are inconsistent with those of xInit.");
+    }
+
+    measType=getIntFromMatlab(prhs[2]);
+    switch(measType) {
+        case 0:
+            checkRealDoubleArray(prhs[3]);
+            if(mxGetM(prhs[3])!=zDim||mxGetN(prhs[3])!=xDim) {
+                mexErrMsgTxt("The measurement matrix has the wrong dimensionality.");
+            }
+            measParam=(double*)mxGetData(prhs[3]);
+            break;
+        case 1:
+        case 2:
+        case 3:
+        {
+            const size_t posDim=measType==1?2:3;
+
+            if(zDim!=posDim||xDim<posDim) {
+                mexErrMsgTxt("The dimensions of the state or the measurements are inconsistent with the measurement type.");
+            }
+
+            if(mxIsEmpty(prhs[3])) {
+                measParam=zeroLoc;
+            } else {
+                checkRealDoubleArray(prhs[3]);
+                if(mxGetNumberOfElements(prhs[3])!=posDim) {
+                    mexErrMsgTxt("The sensor location has the wrong dimensionality.");
+                }
+                measParam=(double*)mxGetData(prhs[3]);
+            }
+            break;
+        }
+        default:
+            mexErrMsgTxt("Unknown measurement type specified.");
+            return;
+    }
+
+    if(numSteps>1) {
+        checkRealDoubleHypermatrix(prhs[4]);
+        checkRealDoubleHypermatrix(prhs[6]);
+        FIsShared=checkMatSeq(prhs[4],xDim,xDim,numSteps-1);
+        QIsShared=checkMatSeq(prhs[6],xDim,xDim,numSteps-1);
+    }
+    checkRealDoubleHypermatrix(prhs[5]);
+    RIsShared=checkMatSeq(prhs[5],zDim,zDim,numSteps);
+
+    if(nrhs>7&&!mxIsEmpty(prhs[7])) {
+        TolG=getDoubleFromMatlab(prhs[7]);
+    }
+
+    if(nrhs>8&&!mxIsEmpty(prhs[8])) {
+        TolX=getDoubleFromMatlab(prhs[8]);
+    }
+
+    if(nrhs>9&&!mxIsEmpty(prhs[9])) {
+        maxIter=getSizeTFromMatlab(prhs[9]);
+    } else {
+        maxIter=100+10*xDim*numSteps;
+    }
+
+    if(nrhs>10&&!mxIsEmpty(prhs[10])) {
+        maxTries=getSizeTFromMatlab(prhs[10]);
+    } else {
+        maxTries=100;
+    }
+
+    if(numSteps>1) {
+        modelIsValid=model.init(xDim,zDim,numSteps,measType,measParam,(double*)mxGetData(prhs[4]),FIsShared,(double*)mxGetData(prhs[5]),RIsShared,(double*)mxGetData(prhs[6]),QIsShared);
+    } else {
+        modelIsValid=model.init(xDim,zDim,numSteps,measType,measParam,NULL,true,(double*)mxGetData(prhs[5]),RIsShared,NULL,true);
+    }
+
+    if(!modelIsValid) {
+        mexErrMsgTxt("R and Q must be positive definite.");
+    }
+
+    xInit=(double*)mxGetData(prhs[0]);
+    z=(double*)mxGetData(prhs[1]);
+
+    xEstMATLAB=mxCreateNumericArray(mxGetNumberOfDimensions(prhs[0]),mxGetDimensions(prhs[0]),mxDOUBLE_CLASS,mxREAL);
+    xEst=(double*)mxGetData(xEstMATLAB);
+    copy(xInit,xInit+xDim*numSteps*numTracks,xEst);
+
+    if(nlhs>1) {
+        mwSize PDims[4];
+        PDims[0]=xDim;
+        PDims[1]=xDim;
+        PDims[2]=numSteps;
+        PDims[3]=numTracks;
+
+        PEstMATLAB=mxCreateNumericArray(4,PDims,mxDOUBLE_CLASS,mxREAL);
+        PEst=(double*)mxGetData(PEstMATLAB);
+    }
+
+    exitCodeMATLAB=mxCreateDoubleMatrix(numTracks,1,mxREAL);
+    exitCode=(double*)mxGetData(exitCodeMATLAB);
+    numIterMATLAB=mxCreateDoubleMatrix(numTracks,1,mxREAL);
+    numIterOut=(double*)mxGetData(numIterMATLAB);
+
+    //The tracks are independent, so they are processed in parallel if
+    //OpenMP is available. Each thread has its own scratch space.
+    #pragma omp parallel
+    {
+        BatchLSScratch workMem(model);
+        ptrdiff_t curTrack;
+
+        #pragma omp for schedule(dynamic)
+        for(curTrack=0;curTrack<(ptrdiff_t)numTracks;curTrack++) {
+            double *xCur=xEst+curTrack*xDim*numSteps;
+            double *PCur=PEst==NULL?NULL:PEst+curTrack*xDim*xDim*numSteps;
+            size_t numIter;
+            int curExitCode;
+
+            curExitCode=batchLSLMCPP(xCur,PCur,&numIter,z+curTrack*zDim*numSteps,NULL,model,TolG,TolX,maxIter,maxTries,workMem);
+            if(curExitCode<0&&PCur!=NULL) {
+                fill_n(PCur,xDim*xDim*numSteps,NaNVal);
+            }
+
+            exitCode[curTrack]=curExitCode;
+            numIterOut[curTrack]=(double)numIter;
+        }
+    }
+
+    plhs[0]=xEstMATLAB;
+    switch(nlhs) {
+        case 4:
+            plhs[3]=numIterMATLAB;
+        case 3:
+            plhs[2]=exitCodeMATLAB;
+        case 2:
+            plhs[1]=PEstMATLAB;
+        default:
+            break;
+    }
+
+    if(nlhs<4) {
+        mxDestroyArray(numIterMATLAB);
+    }
+    if(nlhs<3) {
+        mxDestroyArray(exitCodeMATLAB);
+    }
+}
+
+bool checkMatSeq(const mxArray *mat,const size_t numRow,const size_t numCol,const size_t numMats) {
+/*CHECKMATSEQ Verify that a matrix is either numRowXnumCol or
+ *            numRowXnumColXnumMats. The return value is true if a single
+ *            matrix that is shared by all steps was passed.
+ */
+    const mwSize numDims=mxGetNumberOfDimensions(mat);
+    const mwSize *dims=mxGetDimensions(mat);
+
+    if(dims[0]!=numRow||dims[1]!=numCol||numDims>3) {
+        mexErrMsgTxt("A matrix input has the wrong dimensionality.");
+    }
+
+    if(numDims==2||dims[2]==1) {
+        return true;
+    }
+
+    if(dims[2]!=numMats) {
+        mexErrMsgTxt("A hypermatrix input has the wrong number of matrices.");
+    }
+
+    return false;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,476 @@
+/**BATCHLSMULTITRACKNONLINDYNLM Given batches of measurements of multiple
+ *                     targets, perform batch least squares refinement of
+ *                     the states of each target at every step of the batch
+ *                     under a nonlinear measurement model and a nonlinear
+ *                     continuous-time dynamic model with process noise.
+ *                     This is the same as batchLSMultiTrackLM, except the
+ *                     dynamic model is relinearized about the current
+ *                     estimates at each iteration of the Levenberg-
+ *                     Marquardt algorithm, so the complexity of each
+ *                     iteration is still linear in the number of steps in
+ *                     the batch.
+ *
+ *INPUTS: xInit The xDimXNXnumTracks initial estimates of the states of the
+ *              targets at each of the N steps of the batch. For a single
+ *              track, this is just an xDimXN matrix.
+ *            z The zDimXNXnumTracks measurements of the targets. A
+ *              measurement containing NaN values is treated as missing.
+ *            t The times of the N steps. This is either a length N vector,
+ *              if all tracks are observed at the same times, or an
+ *              NXnumTracks matrix. The times of each track must be
+ *              strictly increasing.
+ *     measType An integer specifying the measurement model. The possible
+ *              values are the same as in batchLSMultiTrackLM.
+ *    measParam The parameter of the measurement model, as described in
+ *              batchLSMultiTrackLM.
+ *      dynType An integer specifying the drift function a(x,t) of the
+ *              continuous-time dynamic model dx/dt=a(x,t)+D*w(t), where w
+ *              is white noise. Possible values are
+ *              0 to 6 The models of the same values in CDEKFPredBatch,
+ *                which are the linear model dx/dt=A*x, aPoly,
+ *                aGaussMarkov, aCoordTurn2D and aPolarCoordTurn2D.
+ *              7 The Earth orbit model of dynType=1 in
+ *                ODEAdaptiveBatchAtTimes with point-mass gravity. dynParam
+ *                is the same vector [GM;a;omega;theta0;BC;rho0;r0;H]. As
+ *                spherical harmonic gravity coefficients are not
+ *                supported, a and theta0 have no effect. xDim must be 6.
+ *     dynParam The parameters of the drift function, as described above.
+ *            D The xDimXnoiseDim diffusion matrix, which is the same for
+ *              all tracks. The process noise covariance matrices that
+ *              result between the steps must be positive definite, which
+ *              is the case, for example, with the diffusion matrices of
+ *              DPoly and DCoordTurn2D.
+ *            R The zDimXzDimXN measurement covariance matrices, or a single
+ *              zDimXzDim matrix if they are all the same.
+ * TolG, TolX, maxIter, maxTries Optional parameters of the Levenberg-
+ *              Marquardt algorithm that are described in the comments to
+ *              the function LSEstLMarquardt. If omitted or empty matrices
+ *              are passed, the defaults are respectively 1e-6, 1e-9,
+ *              100+10*xDim*N, and 100.
+ * method, RelTol, AbsTol, maxSteps, initStepSize Optional parameters of the
+ *              integration that have the same meaning as in the function
+ *              ODEAdaptiveBatchAtTimes. The Runge-Kutta-Nystroem method
+ *              cannot be used. If omitted or empty matrices are passed, the
+ *              defaults are the same as in ODEAdaptiveBatchAtTimes except
+ *              that RelTol=1e-8 and AbsTol=1e-10. The tighter tolerances
+ *              are used, because the gradient of the cost function
+ *              depends on the integrated state transition matrices and
+ *              the convergence criteria TolG and TolX cannot be met if it
+ *              is too inaccurate.
+ *
+ *OUTPUTS: xEst The xDimXNXnumTracks refined state estimates.
+ *         PEst The xDimXxDimXNXnumTracks covariance matrices of the
+ *              estimates. These are the diagonal blocks of the inverse of
+ *              the Fisher information matrix J'*J at the solution. If the
+ *              optimization failed or the information matrix is singular,
+ *              the matrices for the track are filled with NaNs.
+ *     exitCode A numTracksX1 vector of the exit codes of the Levenberg-
+ *              Marquardt algorithm for each track. The values are
+ *              described in the comments to the function LSEstLMarquardt.
+ *              A value of -2 is also returned if the integration of the
+ *              dynamic model failed or a process noise covariance matrix
+ *              was not positive definite.
+ *      numIter A numTracksX1 vector of the number of iterations performed
+ *              for each track.
+ *
+ *This function solves the ML estimation problem with process noise of
+ *A. B. Poore, B. J. Slocumb, B. J. Suchomel, F. H. Obermeyer, S. M.
+ *Herman, and S. M. Gadaleta, "Batch maximum likelihood (ML) and maximum a
+ *posteriori (MAP) estimation with process noise for tracking
+ *applications," in Proceedings of SPIE: Signal and Data Processing of
+ *Small Targets, vol. 5204, San Diego, CA, 3 Aug. 2003, pp. 188-199.
+ *with a nonlinear dynamic model, as batchLSNonlinMeasNonlinDynLM does,
+ *but without forming dense Jacobian matrices over the entire batch. The
+ *state predicted from each step to the next is found by integrating the
+ *drift function, and the state transition matrix and the process noise
+ *covariance matrix of each step are found by integrating the variational
+ *and covariance equations along the trajectory, as described in
+ *discretizeDynCPP.cpp and batchLSLMCPP.cpp. This makes it suitable for
+ *problems such as orbit determination from long batches of measurements.
+ *The tracks are independent. If the code is compiled with OpenMP support,
+ *then the loop over the tracks is run in parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[xEst,PEst,exitCode,numIter]=batchLSMultiTrackNonlinDynLM(xInit,z,t,measType,measParam,dynType,dynParam,D,R,TolG,TolX,maxIter,maxTries,method,RelTol,AbsTol,maxSteps,initStepSize);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy and fill_n
+#include <algorithm>
+//For numeric_limits
+#include <limits>
+#include "MexValidation.h"
+#include "filterFuncs.hpp"
+#include "dynModelFuncs.hpp"
+#include "matrixFuncs.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t xDim, zDim, numSteps, numTracks, noiseDim, numParam, maxIter, maxTries;
+    size_t curTrack, curStep;
+    double TolG=1e-6;
+    double TolX=1e-9;
+    int measType, dynType, method;
+    const double *xInit, *z, *t, *measParam, *dynParam;
+    const double zeroLoc[3]={0,0,0};
+    bool tIsShared, RIsShared;
+    double *DDT;
+    ODEIntParamCPP param;
+    ODEDynamicsCPP *drift=NULL;
+    OrbitDynamicsCPP orbitDyn;
+    BatchLSModelCPP model;
+    mxArray *xEstMATLAB, *PEstMATLAB=NULL, *exitCodeMATLAB, *numIterMATLAB;
+    double *xEst, *PEst=NULL, *exitCode, *numIterOut;
+    mwSize numDims;
+    const mwSize *dims;
+    const double NaNVal=mxGetNaN();
+    const double InfVal=numeric_limits<double>::infinity();
+
+    if(nrhs<9) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>18) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>4) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    checkRealDoubleHypermatrix(prhs[0]);
+    checkRealDoubleHypermatrix(prhs[1]);
+    numDims=mxGetNumberOfDimensions(prhs[0]);
+    dims=mxGetDimensions(prhs[0]);
+    if(numDims>3) {
+        mexErrMsgTxt("xInit has the wrong dimensionality.");
+    }
+    xDim=dims[0];
+    numSteps=dims[1];
+    numTracks=numDims==3?dims[2]:1;
+
+    if(xDim==0||numSteps==0||numTracks==0) {
+        mexErrMsgTxt("xInit cannot be empty.");
+    }
+
+    numDims=mxGetNumberOfDimensions(prhs[1]);
+    dims=mxGetDimensions(prhs[1]);
+    zDim=dims[0];
+    if(numDims>3||dims[1]!=numSteps||(numDims==3?dims[2]:1)!=numTracks) {
+        mexErrMsgTxt("The dimensions of z are inconsistent with those of xInit.");
+    }
+
+    checkRealDoubleArray(prhs[2]);
+    tIsShared=mxGetNumberOfElements(prhs[2])==numSteps;
+    if(!tIsShared&&(mxGetM(prhs[2])!=numSteps||mxGetN(prhs[2])!=numTracks)) {
+        mexErrMsgTxt("t has the wrong dimensionality.");
+    }
+    t=(double*)mxGetData(prhs[2]);
+    for(curTrack=0;curTrack<(tIsShared?1:numTracks);curTrack++) {
+        const double *tCur=t+curTrack*numSteps;
+
+        for(curStep=1;curStep<numSteps;curStep++) {
+            if(!(tCur[curStep]>tCur[curStep-1])) {
+                mexErrMsgTxt("The times must be strictly increasing.");
+            }
+        }
+    }
+
+    measType=getIntFromMatlab(prhs[3]);
+    switch(measType) {
+        case 0:
+            checkRealDoubleArray(prhs[4]);
+            if(mxGetM(prhs[4])!=zDim||mxGetN(prhs[4])!=xDim) {
+                mexErrMsgTxt("The measurement matrix has the wrong dimensionality.");
+            }
+            measParam=(double*)mxGetData(prhs[4]);
+            break;
+        case 1:
+        case 2:
+        case 3:
+        {
+            const size_t posDim=measType==1?2:3;
+
+            if(zDim!=posDim||xDim<posDim) {
+                mexErrMsgTxt("The dimensions of the state or the measurements are inconsistent with the measurement type.");
+            }
+
+            if(mxIsEmpty(prhs[4])) {
+                measParam=zeroLoc;
+            } else {
+                checkRealDoubleArray(prhs[4]);
+                if(mxGetNumberOfElements(prhs[4])!=posDim) {
+                    mexErrMsgTxt("The sensor location has the wrong dimensionality.");
+                }
+                measParam=(double*)mxGetData(prhs[4]);
+            }
+            break;
+        }
+        default:
+            mexErrMsgTxt("Unknown measurement type specified.");
+            return;
+    }
+
+    checkRealDoubleArray(prhs[7]);
+    if(mxGetM(prhs[7])!=xDim) {
+        mexErrMsgTxt("D has the wrong dimensionality.");
+    }
+    noiseDim=mxGetN(prhs[7]);
+
+    checkRealDoubleHypermatrix(prhs[8]);
+    numDims=mxGetNumberOfDimensions(prhs[8]);
+    dims=mxGetDimensions(prhs[8]);
+    if(dims[0]!=zDim||dims[1]!=zDim||numDims>3) {
+        mexErrMsgTxt("R has the wrong dimensionality.");
+    }
+    RIsShared=numDims==2||dims[2]==1;
+    if(!RIsShared&&dims[2]!=numSteps) {
+        mexErrMsgTxt("R has the wrong number of matrices.");
+    }
+
+    if(nrhs>9&&!mxIsEmpty(prhs[9])) {
+        TolG=getDoubleFromMatlab(prhs[9]);
+    }
+
+    if(nrhs>10&&!mxIsEmpty(prhs[10])) {
+        TolX=getDoubleFromMatlab(prhs[10]);
+    }
+
+    if(nrhs>11&&!mxIsEmpty(prhs[11])) {
+        maxIter=getSizeTFromMatlab(prhs[11]);
+    } else {
+        maxIter=100+10*xDim*numSteps;
+    }
+
+    if(nrhs>12&&!mxIsEmpty(prhs[12])) {
+        maxTries=getSizeTFromMatlab(prhs[12]);
+    } else {
+        maxTries=100;
+    }
+
+    if(nrhs>13&&!mxIsEmpty(prhs[13])) {
+        method=getIntFromMatlab(prhs[13]);
+        if(method<0||method>4||method==ODE_RKN54) {
+            mexErrMsgTxt("Invalid integration method specified.");
+        }
+        param.method=(ODEMethodCPP)method;
+    }
+
+    param.RelTol=1e-8;
+    if(nrhs>14&&!mxIsEmpty(prhs[14])) {
+        param.RelTol=getDoubleFromMatlab(prhs[14]);
+    }
+
+    param.AbsTol=1e-10;
+    if(nrhs>15&&!mxIsEmpty(prhs[15])) {
+        param.AbsTol=getDoubleFromMatlab(prhs[15]);
+    }
+
+    if(!(param.RelTol>0)||!(param.AbsTol>0)) {
+        mexErrMsgTxt("RelTol and AbsTol must be positive.");
+    }
+
+    if(nrhs>16&&!mxIsEmpty(prhs[16])) {
+        param.maxSteps=getSizeTFromMatlab(prhs[16]);
+    }
+
+    if(nrhs>17&&!mxIsEmpty(prhs[17])) {
+        param.initStepSize=getDoubleFromMatlab(prhs[17]);
+    }
+
+    //Get the drift function.
+    dynType=getIntFromMatlab(prhs[5]);
+    numParam=mxGetNumberOfElements(prhs[6]);
+    if(numParam>0) {
+        checkRealDoubleArray(prhs[6]);
+    }
+    dynParam=(double*)mxGetData(prhs[6]);
+    switch(dynType) {
+        case 0:
+            if(mxGetM(prhs[6])!=xDim||mxGetN(prhs[6])!=xDim) {
+                mexErrMsgTxt("The matrix A has the wrong dimensionality.");
+            }
+            drift=new LinearDynamicsCPP(xDim,dynParam);
+            break;
+        case 1:
+        {
+            const size_t numDim=numParam>0?(size_t)dynParam[0]:3;
+
+            if(numDim==0||xDim%numDim!=0) {
+                mexErrMsgTxt("The dimensionality of the state must be an integer multiple of numDim.");
+            }
+            drift=new GaussMarkovDynamicsCPP(xDim,numDim,InfVal);
+            break;
+        }
+        case 2:
+        {
+            const double tau=numParam>0?dynParam[0]:20;
+            const size_t order=numParam>1?(size_t)dynParam[1]:2;
+
+            if(xDim%(order+1)!=0) {
+                mexErrMsgTxt("The dimensionality of the state must be an integer multiple of order+1.");
+            }
+            drift=new GaussMarkovDynamicsCPP(xDim,xDim/(order+1),tau);
+            break;
+        }
+        case 3:
+        case 4:
+        case 5:
+        case 6:
+        {
+            const double tauTurn=numParam>0?dynParam[0]:InfVal;
+            const double tauLinAccel=numParam>1?dynParam[1]:InfVal;
+            const bool isTransAccel=dynType==4||dynType==6;
+
+            if(xDim!=5&&xDim!=6) {
+                mexErrMsgTxt("The dimensionality of the state must be 5 or 6.");
+            }
+
+            if(dynType<5) {
+                drift=new CoordTurn2DDynamicsCPP(xDim,isTransAccel,tauTurn,tauLinAccel);
+            } else {
+                drift=new PolarCoordTurn2DDynamicsCPP(xDim,isTransAccel,tauTurn,tauLinAccel);
+            }
+            break;
+        }
+        case 7:
+            if(xDim!=6) {
+                mexErrMsgTxt("The orbit model requires a 6D state.");
+            }
+
+            if(numParam<1||numParam>8) {
+                mexErrMsgTxt("dynParam has the wrong dimensionality.");
+            }
+            switch(numParam) {
+                case 8:
+                    orbitDyn.H=dynParam[7];
+                case 7:
+                    orbitDyn.r0=dynParam[6];
+                case 6:
+                    orbitDyn.rho0=dynParam[5];
+                case 5:
+                    orbitDyn.BC=dynParam[4];
+                case 4:
+                    orbitDyn.theta0=dynParam[3];
+                case 3:
+                    orbitDyn.omega=dynParam[2];
+                case 2:
+                    orbitDyn.a=dynParam[1];
+                default:
+                    orbitDyn.GM=dynParam[0];
+            }
+            break;
+        default:
+            mexErrMsgTxt("Unknown dynamic model specified.");
+            return;
+    }
+
+    //D*D' is the same for all tracks.
+    DDT=new double[xDim*xDim];
+    matMultABTransCPP(DDT,(double*)mxGetData(prhs[7]),(double*)mxGetData(prhs[7]),xDim,noiseDim,xDim);
+
+    //Each thread gets its own copy of the discretized dynamics from the
+    //BatchLSScratch instance.
+    ContTimeBatchLSDynamicsCPP contDyn(drift==NULL?&orbitDyn:drift,DDT,param);
+    if(!model.initNonlinDyn(xDim,zDim,numSteps,measType,measParam,&contDyn,(double*)mxGetData(prhs[8]),RIsShared)) {
+        delete drift;
+        delete[] DDT;
+        mexErrMsgTxt("R must be positive definite.");
+    }
+
+    xInit=(double*)mxGetData(prhs[0]);
+    z=(double*)mxGetData(prhs[1]);
+
+    xEstMATLAB=mxCreateNumericArray(mxGetNumberOfDimensions(prhs[0]),mxGetDimensions(prhs[0]),mxDOUBLE_CLASS,mxREAL);
+    xEst=(double*)mxGetData(xEstMATLAB);
+    copy(xInit,xInit+xDim*numSteps*numTracks,xEst);
+
+    if(nlhs>1) {
+        mwSize PDims[4];
+        PDims[0]=xDim;
+        PDims[1]=xDim;
+        PDims[2]=numSteps;
+        PDims[3]=numTracks;
+
+        PEstMATLAB=mxCreateNumericArray(4,PDims,mxDOUBLE_CLASS,mxREAL);
+        PEst=(double*)mxGetData(PEstMATLAB);
+    }
+
+    exitCodeMATLAB=mxCreateDoubleMatrix(numTracks,1,mxREAL);
+    exitCode=(double*)mxGetData(exitCodeMATLAB);
+    numIterMATLAB=mxCreateDoubleMatrix(numTracks,1,mxREAL);
+    numIterOut=(double*)mxGetData(numIterMATLAB);
+
+    //The tracks are independent, so they are processed in parallel if
+    //OpenMP is available. Each thread has its own scratch space, which
+    //includes its own clone of the dynamic model.
+    #pragma omp parallel
+    {
+        BatchLSScratch workMem(model);
+        ptrdiff_t curTrackPar;
+
+        #pragma omp for schedule(dynamic)
+        for(curTrackPar=0;curTrackPar<(ptrdiff_t)numTracks;curTrackPar++) {
+            double *xCur=xEst+curTrackPar*xDim*numSteps;
+            double *PCur=PEst==NULL?NULL:PEst+curTrackPar*xDim*xDim*numSteps;
+            const double *tCur=tIsShared?t:t+curTrackPar*numSteps;
+            size_t numIter;
+            int curExitCode;
+
+            curExitCode=batchLSLMCPP(xCur,PCur,&numIter,z+curTrackPar*zDim*numSteps,tCur,model,TolG,TolX,maxIter,maxTries,workMem);
+            if(curExitCode<0&&PCur!=NULL) {
+                fill_n(PCur,xDim*xDim*numSteps,NaNVal);
+            }
+
+            exitCode[curTrackPar]=curExitCode;
+            numIterOut[curTrackPar]=(double)numIter;
+        }
+    }
+
+    delete drift;
+    delete[] DDT;
+
+    plhs[0]=xEstMATLAB;
+    switch(nlhs) {
+        case 4:
+            plhs[3]=numIterMATLAB;
+        case 3:
+            plhs[2]=exitCodeMATLAB;
+        case 2:
+            plhs[1]=PEstMATLAB;
+        default:
+            break;
+    }
+
+    if(nlhs<4) {
+        mxDestroyArray(numIterMATLAB);
+    }
+    if(nlhs<3) {
+        mxDestroyArray(exitCodeMATLAB);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -90,6 +90,12 @@ function [xEst,PEst,xBatchEst,exitCode]=batchLSNonlinMeasLinDynLM(xInit,z,h,F,R,
 %returned. If process noise is omitted, then the estimation problem is only
 %over the state at time kD.
 %
+%With process noise, the Jacobian formed here is dense over the entire
+%batch, so the cost of each iteration grows cubically with the number of
+%steps. The compiled function batchLSMultiTrackLM solves the same problem
+%for common measurement models by exploiting the block-tridiagonal
+%structure of the normal equations and can process many tracks at once.
+%
 %October 2013 David F. Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
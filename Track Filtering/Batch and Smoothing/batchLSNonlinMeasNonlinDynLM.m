@@ -69,6 +69,13 @@ function [xEst,PEst,exitCode]=batchLSNonlinMeasNonlinDynLM(xInit,z,h,R,kD,HJacob
 %function is linearized about the estimated state and the linear covariance
 %estimation algorithm of batchLSLinMeasLinDyn is used.
 %
+%Process noise is not modeled here, since the dynamic model is part of the
+%measurement function. For common continuous-time dynamic models, such as
+%coordinated turn and orbital models, the compiled function
+%batchLSMultiTrackNonlinDynLM estimates the states at all of the steps
+%with process noise, with a cost per iteration that is linear in the
+%number of steps.
+%
 %Febraury 2015 David Karnick, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
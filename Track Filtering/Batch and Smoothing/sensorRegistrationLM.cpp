@@ -0,0 +1,317 @@
+/**SENSORREGISTRATIONLM Jointly estimate the additive measurement biases
+ *                  of multiple sensors and the states of multiple
+ *                  stationary targets that the sensors observe, which is
+ *                  the sensor registration problem. Nonlinear least
+ *                  squares optimization is performed using the Levenberg-
+ *                  Marquardt algorithm with an analytic sparse Jacobian
+ *                  and the target states are eliminated with the Schur
+ *                  complement so that the cost of each iteration is linear
+ *                  in the number of targets.
+ *
+ *INPUTS: z The zDimXnumMeas measurements.
+ * sensorIdx A numMeasX1 vector of the indices (starting from 1) of the
+ *          sensors that produced each measurement.
+ * targetIdx A numMeasX1 vector of the indices (starting from 1) of the
+ *          targets that originated each measurement.
+ *    xInit The xDimXnumTargets initial estimates of the target states.
+ * biasInit The zDimXnumSensors initial estimates of the biases of the
+ *          sensors. If omitted or an empty matrix is passed, the biases
+ *          start at zero and the number of sensors is taken to be the
+ *          largest value in sensorIdx. The measurement of target t by
+ *          sensor s is modeled as h(x(:,t))+bias(:,s) plus zero-mean
+ *          Gaussian noise.
+ * measType An integer specifying the measurement model h. Possible values
+ *          are
+ *          0 A linear measurement model, h(x)=H*x. measParam is the
+ *            zDimXxDim matrix H, which is shared by all of the sensors.
+ *          1 A 2D polar measurement [range;azimuth] of the position x(1:2)
+ *            of the target, with the azimuth measured counterclockwise
+ *            from the x-axis. measParam is the 2XnumSensors set of
+ *            locations of the sensors. zDim=2.
+ *          2 A 3D spherical measurement [range;azimuth;elevation] of the
+ *            position x(1:3) of the target with the angles defined as in
+ *            Cart2Sphere with systemType=0. measParam is the 3XnumSensors
+ *            set of locations of the sensors. zDim=3.
+ *          3 The same as 2, except the angles are defined as in
+ *            Cart2Sphere with systemType=1.
+ * measParam The parameter of the measurement model, as described above.
+ *          For the nonlinear models, an empty matrix can be passed if all
+ *          of the sensors are at the origin.
+ *        R The zDimXzDimXnumMeas measurement covariance matrices, or a
+ *          single zDimXzDim matrix if they are all the same.
+ *  biasCov An optional zDimXzDim covariance matrix of a zero-mean Gaussian
+ *          prior on the bias of each sensor. A prior is often needed to
+ *          make the problem observable, since a common offset of all of the
+ *          biases can otherwise be traded against the target states. If
+ *          omitted or an empty matrix is passed, no prior is used.
+ * TolG, TolX, maxIter, maxTries Optional parameters of the Levenberg-
+ *          Marquardt algorithm that are described in the comments to the
+ *          function LSEstLMarquardt. If omitted or empty matrices are
+ *          passed, the defaults are respectively 1e-6, 1e-9,
+ *          100+10*numParams, and 100, where
+ *          numParams=zDim*numSensors+xDim*numTargets.
+ *
+ *OUTPUTS: xEst The xDimXnumTargets refined target state estimates.
+ *      biasEst The zDimXnumSensors refined bias estimates.
+ *     exitCode The exit code of the Levenberg-Marquardt algorithm, as
+ *              described in the comments to the function LSEstLMarquardt.
+ *      numIter The number of iterations performed.
+ *
+ *LSEstLMarquardt forms the dense Jacobian matrix of all of the parameters
+ *and solves the dense normal equations, so its cost grows cubically with
+ *the number of targets. Here, every measurement only involves one sensor
+ *and one target, so the Jacobian is stored in compressed sparse row form
+ *and the normal equations are solved by eliminating the target states as
+ *independent blocks, leaving a dense system in the biases, as described in
+ *sparseLMCPP.cpp. If the code is compiled with OpenMP support, then the
+ *residuals and the Jacobian are evaluated in parallel over the
+ *measurements and the target blocks are eliminated in parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[xEst,biasEst,exitCode,numIter]=sensorRegistrationLM(z,sensorIdx,targetIdx,xInit,biasInit,measType,measParam,R,biasCov,TolG,TolX,maxIter,maxTries);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy and fill
+#include <algorithm>
+#include <vector>
+#include "MexValidation.h"
+#include "sparseLMCPP.hpp"
+#include "sensorRegistrationCPP.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t xDim, zDim, numMeas, numSensors, numTargets, numIdx, i;
+    size_t numParams, maxIter, maxTries, numIter;
+    size_t *sensorIdx, *targetIdx;
+    double TolG=1e-6;
+    double TolX=1e-9;
+    int measType, exitCode;
+    const double *z, *measParam, *biasCov=NULL;
+    vector<double> zeroLocs, params;
+    bool RIsShared;
+    mxArray *xEstMATLAB, *biasEstMATLAB;
+
+    if(nrhs<8) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>13) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>4) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    checkRealDoubleArray(prhs[0]);
+    checkRealDoubleArray(prhs[3]);
+    zDim=mxGetM(prhs[0]);
+    numMeas=mxGetN(prhs[0]);
+    xDim=mxGetM(prhs[3]);
+    numTargets=mxGetN(prhs[3]);
+    if(zDim==0||numMeas==0) {
+        mexErrMsgTxt("z cannot be empty.");
+    }
+    if(xDim==0||numTargets==0) {
+        mexErrMsgTxt("xInit cannot be empty.");
+    }
+
+    sensorIdx=copySizeTArrayFromMatlab(prhs[1],&numIdx);
+    if(numIdx!=numMeas) {
+        mxFree(sensorIdx);
+        mexErrMsgTxt("The length of sensorIdx is inconsistent with z.");
+    }
+    targetIdx=copySizeTArrayFromMatlab(prhs[2],&numIdx);
+    if(numIdx!=numMeas) {
+        mxFree(targetIdx);
+        mxFree(sensorIdx);
+        mexErrMsgTxt("The length of targetIdx is inconsistent with z.");
+    }
+
+    //Convert the indices to start from zero.
+    numSensors=0;
+    for(i=0;i<numMeas;i++) {
+        if(sensorIdx[i]==0||targetIdx[i]==0||targetIdx[i]>numTargets) {
+            mxFree(targetIdx);
+            mxFree(sensorIdx);
+            mexErrMsgTxt("A sensor or target index is out of range.");
+        }
+        numSensors=max(numSensors,sensorIdx[i]);
+        sensorIdx[i]--;
+        targetIdx[i]--;
+    }
+
+    if(!mxIsEmpty(prhs[4])) {
+        checkRealDoubleArray(prhs[4]);
+        if(mxGetM(prhs[4])!=zDim||mxGetN(prhs[4])<numSensors) {
+            mxFree(targetIdx);
+            mxFree(sensorIdx);
+            mexErrMsgTxt("The dimensions of biasInit are inconsistent with z and sensorIdx.");
+        }
+        numSensors=mxGetN(prhs[4]);
+    }
+
+    measType=getIntFromMatlab(prhs[5]);
+    switch(measType) {
+        case 0:
+            checkRealDoubleArray(prhs[6]);
+            if(mxGetM(prhs[6])!=zDim||mxGetN(prhs[6])!=xDim) {
+                mxFree(targetIdx);
+                mxFree(sensorIdx);
+                mexErrMsgTxt("The measurement matrix has the wrong dimensionality.");
+            }
+            measParam=(double*)mxGetData(prhs[6]);
+            break;
+        case 1:
+        case 2:
+        case 3:
+        {
+            const size_t posDim=measType==1?2:3;
+
+            if(zDim!=posDim||xDim<posDim) {
+                mxFree(targetIdx);
+                mxFree(sensorIdx);
+                mexErrMsgTxt("The dimensions of the state or the measurements are inconsistent with the measurement type.");
+            }
+
+            if(mxIsEmpty(prhs[6])) {
+                zeroLocs.assign(posDim*numSensors,0.0);
+                measParam=&zeroLocs[0];
+            } else {
+                checkRealDoubleArray(prhs[6]);
+                if(mxGetM(prhs[6])!=posDim||mxGetN(prhs[6])!=numSensors) {
+                    mxFree(targetIdx);
+                    mxFree(sensorIdx);
+                    mexErrMsgTxt("The sensor locations have the wrong dimensionality.");
+                }
+                measParam=(double*)mxGetData(prhs[6]);
+            }
+            break;
+        }
+        default:
+            mxFree(targetIdx);
+            mxFree(sensorIdx);
+            mexErrMsgTxt("Unknown measurement type specified.");
+            return;
+    }
+
+    checkRealDoubleHypermatrix(prhs[7]);
+    {
+        const mwSize numDims=mxGetNumberOfDimensions(prhs[7]);
+        const mwSize *dims=mxGetDimensions(prhs[7]);
+
+        if(dims[0]!=zDim||dims[1]!=zDim||numDims>3||(numDims==3&&dims[2]!=numMeas&&dims[2]!=1)) {
+            mxFree(targetIdx);
+            mxFree(sensorIdx);
+            mexErrMsgTxt("R has the wrong dimensionality.");
+        }
+        RIsShared=numDims==2||dims[2]==1;
+    }
+
+    if(nrhs>8&&!mxIsEmpty(prhs[8])) {
+        checkRealDoubleArray(prhs[8]);
+        if(mxGetM(prhs[8])!=zDim||mxGetN(prhs[8])!=zDim) {
+            mxFree(targetIdx);
+            mxFree(sensorIdx);
+            mexErrMsgTxt("biasCov has the wrong dimensionality.");
+        }
+        biasCov=(double*)mxGetData(prhs[8]);
+    }
+
+    numParams=zDim*numSensors+xDim*numTargets;
+
+    if(nrhs>9&&!mxIsEmpty(prhs[9])) {
+        TolG=getDoubleFromMatlab(prhs[9]);
+    }
+
+    if(nrhs>10&&!mxIsEmpty(prhs[10])) {
+        TolX=getDoubleFromMatlab(prhs[10]);
+    }
+
+    if(nrhs>11&&!mxIsEmpty(prhs[11])) {
+        maxIter=getSizeTFromMatlab(prhs[11]);
+    } else {
+        maxIter=100+10*numParams;
+    }
+
+    if(nrhs>12&&!mxIsEmpty(prhs[12])) {
+        maxTries=getSizeTFromMatlab(prhs[12]);
+    } else {
+        maxTries=100;
+    }
+
+    z=(double*)mxGetData(prhs[0]);
+
+    //The parameters are the biases followed by the target states.
+    params.resize(numParams);
+    if(!mxIsEmpty(prhs[4])) {
+        const double *biasInit=(double*)mxGetData(prhs[4]);
+        copy(biasInit,biasInit+zDim*numSensors,params.begin());
+    } else {
+        fill(params.begin(),params.begin()+zDim*numSensors,0.0);
+    }
+    {
+        const double *xInit=(double*)mxGetData(prhs[3]);
+        copy(xInit,xInit+xDim*numTargets,params.begin()+zDim*numSensors);
+    }
+
+    {
+        SensorRegistrationProblemCPP problem(z,sensorIdx,targetIdx,numMeas,numSensors,numTargets,xDim,zDim,measType,measParam,(double*)mxGetData(prhs[7]),RIsShared,biasCov);
+
+        if(!problem.isValid) {
+            mxFree(targetIdx);
+            mxFree(sensorIdx);
+            mexErrMsgTxt("R and biasCov must be positive definite.");
+        }
+
+        SparseLMSolverCPP solver(problem,zDim*numSensors,xDim);
+        exitCode=solver.solve(&params[0],&numIter,TolG,TolX,maxIter,maxTries);
+    }
+
+    mxFree(targetIdx);
+    mxFree(sensorIdx);
+
+    xEstMATLAB=mxCreateDoubleMatrix(xDim,numTargets,mxREAL);
+    copy(params.begin()+zDim*numSensors,params.end(),(double*)mxGetData(xEstMATLAB));
+    plhs[0]=xEstMATLAB;
+
+    if(nlhs>1) {
+        biasEstMATLAB=mxCreateDoubleMatrix(zDim,numSensors,mxREAL);
+        copy(params.begin(),params.begin()+zDim*numSensors,(double*)mxGetData(biasEstMATLAB));
+        plhs[1]=biasEstMATLAB;
+
+        if(nlhs>2) {
+            plhs[2]=intMat2MatlabDoubles(&exitCode,1,1);
+
+            if(nlhs>3) {
+                plhs[3]=mxCreateDoubleScalar((double)numIter);
+            }
+        }
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,526 @@
+/**PCRLBBATCH Compute the Fisher information matrix (FIM), whose inverse is
+ *            the posterior Cramer-Rao lower bound (PCRLB), over a sequence
+ *            of steps for many candidate placements of a set of sensors.
+ *            The dynamic model is linear with additive Gaussian process
+ *            noise and the sensors have nonlinear measurement models with
+ *            additive Gaussian noise, a detection probability PD and no
+ *            clutter. The expected values of the measurement information
+ *            are taken over cubature points or over sampled target
+ *            trajectories. This is meant for use inside of the objective
+ *            function of an optimizer of the sensor locations.
+ *
+ *INPUTS: J0 The xDimXxDim FIM at the first step before the measurements at
+ *           that step are added. If omitted or an empty matrix is passed,
+ *           a matrix of zeros is used, meaning that there is no prior
+ *           information.
+ *     xTraj If PTraj is not empty, this is the xDimXnumSteps mean of the
+ *           distribution of the true target state at each step. If PTraj
+ *           is empty, this is an xDimXnumStepsXnumSamples hypermatrix of
+ *           sampled target trajectories over which the expected values
+ *           are taken.
+ *     PTraj The xDimXxDimXnumSteps covariance matrices of the Gaussian
+ *           distribution of the true target state at each step. The
+ *           expected values are then taken with the cubature points xi.
+ *           If a covariance matrix is all zeros, then the target state at
+ *           that step is deterministic. If an empty matrix is passed, the
+ *           sampled trajectories in xTraj are used.
+ *         F The xDimXxDim state transition matrix, or an
+ *           xDimXxDimX(numSteps-1) hypermatrix of different matrices for
+ *           each step. The state at step k+1 is F(:,:,k) times the state at
+ *           step k plus zero-mean Gaussian process noise with covariance
+ *           matrix Q(:,:,k).
+ *         Q The xDimXxDim positive definite process noise covariance
+ *           matrix, or an xDimXxDimX(numSteps-1) hypermatrix of different
+ *           matrices for each step.
+ *  measType An integer specifying the measurement model of all of the
+ *           sensors. The possible values are the same as in
+ *           batchLSMultiTrackLM:
+ *           0 A linear measurement model, z=H*x.
+ *           1 A 2D polar measurement [range;azimuth] of the position
+ *             x(1:2) of the target.
+ *           2 A 3D spherical measurement [range;azimuth;elevation] of the
+ *             position x(1:3) of the target with the angles defined as in
+ *             Cart2Sphere with systemType=0.
+ *           3 The same as 2, except the angles are defined as in
+ *             Cart2Sphere with systemType=1.
+ * measParam For measType=1, 2 or 3, this is a posDimXnumSensorsXnumPlace
+ *           hypermatrix of the locations of the numSensors sensors in each
+ *           of the numPlace candidate placements, where posDim=2 for
+ *           measType=1 and 3 otherwise. For measType=0, this is a
+ *           zDimXxDimXnumSensorsXnumPlace hypermatrix of the measurement
+ *           matrices.
+ *         R The zDimXzDim positive definite measurement covariance matrix,
+ *           or a zDimXzDimXnumSensors hypermatrix of different matrices
+ *           for each sensor.
+ *        PD The detection probability of the sensors. This is either a
+ *           scalar or a numSensorsXnumSteps matrix. If omitted or an empty
+ *           matrix is passed, PD=1 is used.
+ *        xi The xDimXnumCubPoints cubature points for taking the expected
+ *           values when PTraj is not empty, such as those from
+ *           fifthOrderCubPoints. This is not used if PTraj is empty.
+ *         w If PTraj is not empty, these are the numCubPointsX1 cubature
+ *           weights that go with xi. If PTraj is empty, these are optional
+ *           numSamplesX1 weights of the sampled trajectories; if omitted
+ *           or an empty matrix is passed, all trajectories get the same
+ *           weight.
+ *
+ *OUTPUTS: J The xDimXxDimXnumPlace FIMs after the measurements at the last
+ *           step for each of the sensor placements.
+ *      JAll The xDimXxDimXnumStepsXnumPlace FIMs after the measurements at
+ *           each step.
+ *  traceCRLB The numStepsXnumPlace traces of the inverses of the FIMs
+ *           after the measurements at each step. This is NaN at steps
+ *           where the FIM is singular. A common objective for sensor
+ *           placement is to minimize some function of these values.
+ *
+ *At each step k, the FIM is
+ *J_k=JPred_k+sum_s PD(s,k)*E{H_s(x_k)'*inv(R_s)*H_s(x_k)}
+ *where JPred_1=J0, H_s is the Jacobian of the measurement model of sensor
+ *s and JPred_k for k>1 is the prediction of J_{k-1} as in the function
+ *PCRLBPredAdd. The measurement information is the same as that added by
+ *calling PCRLBUpdateAddNoClutter once for each sensor. See the comments in
+ *PCRLBCPP.cpp for references.
+ *
+ *If the code is compiled with OpenMP support, then the expected
+ *measurement information at all of the steps for all of the placements is
+ *computed in parallel, followed by the recursions for each placement in
+ *parallel. The results do not depend on the number of threads.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[J,JAll,traceCRLB]=PCRLBBatch(J0,xTraj,PTraj,F,Q,measType,measParam,R,PD,xi,w);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy and fill_n
+#include <algorithm>
+#include "MexValidation.h"
+#include "matrixFuncs.hpp"
+#include "filterFuncs.hpp"
+#include "mex.h"
+
+using namespace std;
+
+static size_t getNumMats(const mxArray *A,const size_t numRow,const size_t numCol);
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t xDim, zDim, numSteps, numPoints, numDyn, numR, numSensors, numPlace, paramDim;
+    size_t i, curStep;
+    int measType;
+    bool sampledTraj, PDIsScalar;
+    const double *J0, *xTraj, *F, *Q, *measParam, *R, *PD, *w=NULL;
+    double *points, *pointWeights, *QInv, *D11, *D12, *RInv, *JMeas;
+    double *JFinal, *JAll=NULL, *traceCRLB=NULL;
+    mxArray *JMATLAB, *JAllMATLAB=NULL, *traceCRLBMATLAB=NULL;
+    double PDDefault=1;
+    bool failed=false;
+
+    if(nrhs<8) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>11) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>3) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    checkRealDoubleHypermatrix(prhs[1]);
+    {
+        const mwSize numDims=mxGetNumberOfDimensions(prhs[1]);
+        const mwSize *dims=mxGetDimensions(prhs[1]);
+
+        if(numDims>3) {
+            mexErrMsgTxt("xTraj has too many dimensions.");
+        }
+
+        xDim=dims[0];
+        numSteps=dims[1];
+        sampledTraj=mxIsEmpty(prhs[2]);
+        if(sampledTraj) {
+            numPoints=numDims>2?dims[2]:1;
+        } else if(numDims>2&&dims[2]!=1) {
+            mexErrMsgTxt("xTraj must be a matrix when PTraj is given.");
+        }
+    }
+    xTraj=(double*)mxGetData(prhs[1]);
+
+    if(!mxIsEmpty(prhs[0])) {
+        checkRealDoubleArray(prhs[0]);
+        if(mxGetM(prhs[0])!=xDim||mxGetN(prhs[0])!=xDim) {
+            mexErrMsgTxt("J0 has the wrong dimensionality.");
+        }
+        J0=(double*)mxGetData(prhs[0]);
+    } else {
+        J0=NULL;
+    }
+
+    checkRealDoubleHypermatrix(prhs[3]);
+    checkRealDoubleHypermatrix(prhs[4]);
+    numDyn=getNumMats(prhs[3],xDim,xDim);
+    if(numDyn==0||numDyn!=getNumMats(prhs[4],xDim,xDim)||(numDyn!=1&&numDyn!=numSteps-1)) {
+        mexErrMsgTxt("F and Q must be a single matrix or one matrix per step.");
+    }
+    F=(double*)mxGetData(prhs[3]);
+    Q=(double*)mxGetData(prhs[4]);
+
+    measType=getIntFromMatlab(prhs[5]);
+    checkRealDoubleHypermatrix(prhs[6]);
+    checkRealDoubleHypermatrix(prhs[7]);
+    zDim=mxGetM(prhs[7]);
+    {
+        const mwSize numDims=mxGetNumberOfDimensions(prhs[6]);
+        const mwSize *dims=mxGetDimensions(prhs[6]);
+
+        switch(measType) {
+            case 0:
+                if(numDims>4||dims[0]!=zDim||dims[1]!=xDim) {
+                    mexErrMsgTxt("The measurement matrices have the wrong dimensionality.");
+                }
+                paramDim=zDim*xDim;
+                numSensors=numDims>2?dims[2]:1;
+                numPlace=numDims>3?dims[3]:1;
+                break;
+            case 1:
+            case 2:
+            case 3:
+                paramDim=measType==1?2:3;
+                if(numDims>3||dims[0]!=paramDim) {
+                    mexErrMsgTxt("The sensor locations have the wrong dimensionality.");
+                }
+
+                if(zDim!=paramDim||xDim<paramDim) {
+                    mexErrMsgTxt("The dimensions of the state or R are inconsistent with the measurement type.");
+                }
+                numSensors=dims[1];
+                numPlace=numDims>2?dims[2]:1;
+                break;
+            default:
+                mexErrMsgTxt("Unknown measurement type specified.");
+                return;
+        }
+    }
+    measParam=(double*)mxGetData(prhs[6]);
+
+    numR=getNumMats(prhs[7],zDim,zDim);
+    if(numR!=1&&numR!=numSensors) {
+        mexErrMsgTxt("R must be a single matrix or one matrix per sensor.");
+    }
+    R=(double*)mxGetData(prhs[7]);
+
+    if(nrhs>8&&!mxIsEmpty(prhs[8])) {
+        checkRealDoubleArray(prhs[8]);
+        PDIsScalar=mxGetNumberOfElements(prhs[8])==1;
+        if(!PDIsScalar&&(mxGetM(prhs[8])!=numSensors||mxGetN(prhs[8])!=numSteps)) {
+            mexErrMsgTxt("PD has the wrong dimensionality.");
+        }
+        PD=(double*)mxGetData(prhs[8]);
+    } else {
+        PDIsScalar=true;
+        PD=&PDDefault;
+    }
+
+    if(sampledTraj) {
+        if(nrhs>10&&!mxIsEmpty(prhs[10])) {
+            checkRealDoubleArray(prhs[10]);
+            if(mxGetNumberOfElements(prhs[10])!=numPoints) {
+                mexErrMsgTxt("The number of weights does not equal the number of sampled trajectories.");
+            }
+            w=(double*)mxGetData(prhs[10]);
+        }
+    } else {
+        const mwSize numDims=mxGetNumberOfDimensions(prhs[2]);
+        const mwSize *dims=mxGetDimensions(prhs[2]);
+
+        checkRealDoubleHypermatrix(prhs[2]);
+        if(numDims>3||dims[0]!=xDim||dims[1]!=xDim||(numDims>2?dims[2]:1)!=numSteps) {
+            mexErrMsgTxt("The dimensions of PTraj are inconsistent with xTraj.");
+        }
+
+        if(nrhs<11) {
+            mexErrMsgTxt("Cubature points and weights are needed when PTraj is given.");
+        }
+        checkRealDoubleArray(prhs[9]);
+        checkRealDoubleArray(prhs[10]);
+        if(mxGetM(prhs[9])!=xDim) {
+            mexErrMsgTxt("The cubature points have the wrong dimensionality.");
+        }
+        numPoints=mxGetN(prhs[9]);
+        if(mxGetNumberOfElements(prhs[10])!=numPoints) {
+            mexErrMsgTxt("The number of cubature weights does not equal the number of cubature points.");
+        }
+        w=(double*)mxGetData(prhs[10]);
+    }
+
+    //The points at which the measurement Jacobians are evaluated at each
+    //step are the same for all placements, so they are found once.
+    points=new double[xDim*numPoints*numSteps];
+    pointWeights=new double[numPoints];
+    if(sampledTraj) {
+        for(i=0;i<numPoints;i++) {
+            pointWeights[i]=w==NULL?1.0/(double)numPoints:w[i];
+            for(curStep=0;curStep<numSteps;curStep++) {
+                copy(xTraj+xDim*(curStep+numSteps*i),xTraj+xDim*(curStep+numSteps*i+1),points+xDim*(i+numPoints*curStep));
+            }
+        }
+    } else {
+        const double *xi=(double*)mxGetData(prhs[9]);
+        const double *PTraj=(double*)mxGetData(prhs[2]);
+        double *S=new double[xDim*xDim];
+
+        copy(w,w+numPoints,pointWeights);
+        for(curStep=0;curStep<numSteps;curStep++) {
+            const double *PCur=PTraj+xDim*xDim*curStep;
+            const double *xCur=xTraj+xDim*curStep;
+            double *pointsCur=points+xDim*numPoints*curStep;
+
+            if(!cholLowerCPP(S,PCur,xDim)) {
+                //A zero covariance matrix means that the state is known.
+                for(i=0;i<xDim*xDim;i++) {
+                    if(PCur[i]!=0) {
+                        break;
+                    }
+                }
+
+                if(i!=xDim*xDim) {
+                    delete[] S;
+                    delete[] pointWeights;
+                    delete[] points;
+                    mexErrMsgTxt("A matrix in PTraj is not positive definite.");
+                }
+                fill_n(S,xDim*xDim,0.0);
+            }
+
+            matMultCPP(pointsCur,S,xi,xDim,xDim,numPoints);
+            for(i=0;i<numPoints;i++) {
+                size_t k;
+
+                for(k=0;k<xDim;k++) {
+                    pointsCur[k+i*xDim]+=xCur[k];
+                }
+            }
+        }
+        delete[] S;
+    }
+
+    //The inverses of the noise covariance matrices and the terms of the
+    //prediction that only depend on the dynamic model are shared by all of
+    //the placements.
+    QInv=new double[3*xDim*xDim*numDyn];
+    D11=QInv+xDim*xDim*numDyn;
+    D12=D11+xDim*xDim*numDyn;
+    RInv=new double[zDim*zDim*numR];
+    {
+        double *scratch=new double[xDim*xDim+zDim*zDim];
+
+        for(i=0;i<numDyn;i++) {
+            const size_t xx=xDim*xDim;
+            double *QInvCur=QInv+xx*i;
+            double *D11Cur=D11+xx*i;
+            double *D12Cur=D12+xx*i;
+            const double *FCur=F+xx*i;
+            size_t k;
+
+            if(!invSymPosDefCPP(QInvCur,scratch,Q+xx*i,xDim)) {
+                failed=true;
+                break;
+            }
+
+            //D12=-F'*QInv and D11=F'*QInv*F.
+            matMultATransBCPP(D12Cur,FCur,QInvCur,xDim,xDim,xDim);
+            matMultCPP(D11Cur,D12Cur,FCur,xDim,xDim,xDim);
+            symmetrizeCPP(D11Cur,xDim);
+            for(k=0;k<xx;k++) {
+                D12Cur[k]=-D12Cur[k];
+            }
+        }
+
+        for(i=0;i<numR&&!failed;i++) {
+            if(!invSymPosDefCPP(RInv+zDim*zDim*i,scratch,R+zDim*zDim*i,zDim)) {
+                failed=true;
+            }
+        }
+
+        delete[] scratch;
+    }
+
+    if(failed) {
+        delete[] RInv;
+        delete[] QInv;
+        delete[] pointWeights;
+        delete[] points;
+        mexErrMsgTxt("Q and R must be positive definite.");
+    }
+
+    //The expected measurement information at each step for each
+    //placement.
+    JMeas=new double[xDim*xDim*numSteps*numPlace];
+    {
+        const ptrdiff_t numCases=(ptrdiff_t)(numSteps*numPlace);
+
+        #pragma omp parallel
+        {
+            double *scratch=new double[zDim*(2*xDim+1)];
+            ptrdiff_t curCase;
+
+            #pragma omp for schedule(dynamic)
+            for(curCase=0;curCase<numCases;curCase++) {
+                const size_t stepIdx=(size_t)curCase%numSteps;
+                const size_t placeIdx=(size_t)curCase/numSteps;
+                double *JCur=JMeas+xDim*xDim*curCase;
+                size_t curSensor;
+
+                fill_n(JCur,xDim*xDim,0.0);
+                for(curSensor=0;curSensor<numSensors;curSensor++) {
+                    const double PDCur=PDIsScalar?PD[0]:PD[curSensor+numSensors*stepIdx];
+                    const double *RInvCur=numR==1?RInv:RInv+zDim*zDim*curSensor;
+
+                    FIMMeasInfoAddCPP(JCur,points+xDim*numPoints*stepIdx,pointWeights,numPoints,xDim,zDim,measType,measParam+paramDim*(curSensor+numSensors*placeIdx),RInvCur,PDCur,scratch);
+                }
+            }
+
+            delete[] scratch;
+        }
+    }
+
+    delete[] pointWeights;
+    delete[] points;
+
+    {
+        mwSize dims[4];
+
+        dims[0]=xDim;
+        dims[1]=xDim;
+        dims[2]=numPlace;
+        JMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+        JFinal=(double*)mxGetData(JMATLAB);
+
+        if(nlhs>1) {
+            dims[2]=numSteps;
+            dims[3]=numPlace;
+            JAllMATLAB=mxCreateNumericArray(4,dims,mxDOUBLE_CLASS,mxREAL);
+            JAll=(double*)mxGetData(JAllMATLAB);
+        }
+
+        if(nlhs>2) {
+            traceCRLBMATLAB=mxCreateDoubleMatrix(numSteps,numPlace,mxREAL);
+            traceCRLB=(double*)mxGetData(traceCRLBMATLAB);
+        }
+    }
+
+    //Run the recursion for each placement.
+    {
+        const double NaNVal=mxGetNaN();
+
+        #pragma omp parallel
+        {
+            const size_t xx=xDim*xDim;
+            double *JCur=new double[5*xx];
+            double *JPred=JCur+xx;
+            double *JInv=JPred+xx;
+            double *scratch=JInv+xx;
+            size_t *pivot=new size_t[xDim];
+            ptrdiff_t curPlace;
+
+            #pragma omp for schedule(dynamic)
+            for(curPlace=0;curPlace<(ptrdiff_t)numPlace;curPlace++) {
+                size_t curStep, k;
+
+                if(J0==NULL) {
+                    fill_n(JCur,xx,0.0);
+                } else {
+                    copy(J0,J0+xx,JCur);
+                }
+
+                for(curStep=0;curStep<numSteps;curStep++) {
+                    const double *JMeasCur=JMeas+xx*(curStep+numSteps*curPlace);
+
+                    if(curStep>0) {
+                        const size_t dynIdx=numDyn==1?0:curStep-1;
+
+                        if(PCRLBPredLinCPP(JPred,JCur,QInv+xx*dynIdx,D11+xx*dynIdx,D12+xx*dynIdx,xDim,scratch,pivot)) {
+                            copy(JPred,JPred+xx,JCur);
+                        } else {
+                            fill_n(JCur,xx,NaNVal);
+                        }
+                    }
+
+                    for(k=0;k<xx;k++) {
+                        JCur[k]+=JMeasCur[k];
+                    }
+
+                    if(JAll!=NULL) {
+                        copy(JCur,JCur+xx,JAll+xx*(curStep+numSteps*curPlace));
+                    }
+
+                    if(traceCRLB!=NULL) {
+                        double traceVal=NaNVal;
+
+                        if(invSymPosDefCPP(JInv,scratch,JCur,xDim)) {
+                            traceVal=0;
+                            for(k=0;k<xDim;k++) {
+                                traceVal+=JInv[k+k*xDim];
+                            }
+                        }
+                        traceCRLB[curStep+numSteps*curPlace]=traceVal;
+                    }
+                }
+
+                copy(JCur,JCur+xx,JFinal+xx*curPlace);
+            }
+
+            delete[] pivot;
+            delete[] JCur;
+        }
+    }
+
+    delete[] JMeas;
+    delete[] RInv;
+    delete[] QInv;
+
+    plhs[0]=JMATLAB;
+    if(nlhs>1) {
+        plhs[1]=JAllMATLAB;
+    }
+
+    if(nlhs>2) {
+        plhs[2]=traceCRLBMATLAB;
+    }
+}
+
+static size_t getNumMats(const mxArray *A,const size_t numRow,const size_t numCol) {
+//Get the number of numRowXnumColXnum matrices in a hypermatrix, or 0 if
+//the dimensions are wrong.
+    const mwSize numDims=mxGetNumberOfDimensions(A);
+    const mwSize *dims=mxGetDimensions(A);
+
+    if(numDims>3||dims[0]!=numRow||dims[1]!=numCol) {
+        return 0;
+    }
+
+    return numDims>2?dims[2]:1;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
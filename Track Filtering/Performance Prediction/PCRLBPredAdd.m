@@ -43,9 +43,15 @@ function JPred=PCRLBPredAdd(JPrior,xPrior,PPrior,Q,param5,xi,w)
 %Carlo runs. The prior distribution parameters in such an instance can be
 %calculated using the function DiscPriorPModel.
 %
+%The compiled function PCRLBBatch evaluates this recursion with a fixed F
+%together with the measurement updates of PCRLBUpdateAddNoClutter over
+%many steps and many candidate sensor placements.
+%
 %October 2013 David F.Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
+    xDim=size(xPrior,1);
+
     if(isa(param5,'function_handle'))
         if(isequal(zeros(xDim,xDim),PPrior))
             F=param5(xPrior);
@@ -59,6 +59,10 @@ function JPost=PCRLBUpdateAddNoClutter(JPred,xCur,PCur,R,PD,param6,xi,w)
 %then this function can be called multiple times to sequentially update the
 %Fisher information matrix.
 %
+%The compiled function PCRLBBatch evaluates this recursion together with
+%that of PCRLBPredAdd for a linear dynamic model over many steps and many
+%candidate sensor placements, taking the expected values in parallel.
+%
 %October 2013 David F.Crouse, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
@@ -86,7 +90,7 @@ function JPost=PCRLBUpdateAddNoClutter(JPred,xCur,PCur,R,PD,param6,xi,w)
         JPost=JPred;
         for curP=1:numPoints
             H=HJacob(xPoints(:,curP));
-            JPost=JPost+w(curP)*(H'*RInv*H);
+            JPost=JPost+PD*w(curP)*(H'*RInv*H);
         end
     end
 end
@@ -0,0 +1,144 @@
+/*CDEKFPREDCPP A C++ implementation of the prediction step of the
+ *             continuous-discrete extended Kalman filter. This is the same
+ *             as the Matlab function CDEKFPred, except that the drift
+ *             function and its Jacobian are given by a compiled dynamic
+ *             model, the diffusion term D*D' is constant and the covariance
+ *             matrix is propagated in packed form.
+ *
+ *As in CDEKFPred, the state and the covariance matrix are integrated
+ *together using the mean-covariance Runge-Kutta approach of [1]. The
+ *differential equations are
+ *dx/dt=a(x,t)
+ *dP/dt=A(x,t)*P+P*A(x,t)'+D*D'
+ *where A(x,t) is the Jacobian of the drift function a(x,t). Since dP/dt is
+ *symmetric, only the upper triangle of P is part of the integrated state,
+ *which nearly halves the number of covariance elements that the integrator
+ *has to process in each stage and that enter the error estimate. The
+ *upper triangle is packed by column, so element (i,j) with i<=j is at
+ *i+j*(j+1)/2, as in the packed storage of LAPACK. The predicted covariance
+ *matrix is symmetric by construction. Unlike CDEKFPred, the predicted
+ *covariance matrix is not projected onto the set of positive semidefinite
+ *matrices using cholSemiDef.
+ *
+ *REFERENCES:
+ *[1] P. Frogerais, J. Bellanger, and L. Senhadji, "Various ways to compute
+ *    the continuous-discrete extended Kalman filter," IEEE Transactions on
+ *    Automatic Control, vol. 57, no. 4, pp. 1000-1004, Apr. 2012.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+**/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy
+#include <algorithm>
+#include "filterFuncs.hpp"
+#include "matrixFuncs.hpp"
+
+using namespace std;
+
+CDEKFDynamicsCPP::CDEKFDynamicsCPP(const ODEDynamicsCPP *driftDes,const double *DDTDes) : ODEDynamicsCPP(driftDes->xDim+driftDes->xDim*(driftDes->xDim+1)/2) {
+    const size_t n=driftDes->xDim;
+    char *basePtr;
+
+    stateDim=n;
+    drift=driftDes;
+    DDT=DDTDes;
+
+    buffer=new char[sizeof(double)*(3*n*n+4*n+2*xDim)];
+    basePtr=buffer;
+    J=(double*)basePtr;
+    basePtr+=sizeof(double)*n*n;
+    PFull=(double*)basePtr;
+    basePtr+=sizeof(double)*n*n;
+    JP=(double*)basePtr;
+    basePtr+=sizeof(double)*n*n;
+    dfdt=(double*)basePtr;
+    basePtr+=sizeof(double)*n;
+    jacobScratch=(double*)basePtr;
+    basePtr+=sizeof(double)*3*n;
+    xAugStart=(double*)basePtr;
+    basePtr+=sizeof(double)*xDim;
+    xAugEnd=(double*)basePtr;
+}
+
+CDEKFDynamicsCPP::~CDEKFDynamicsCPP() {
+    delete[] buffer;
+}
+
+void CDEKFDynamicsCPP::f(double *dxdt,const double *x,const double t) const {
+    const size_t n=stateDim;
+    const double *PPacked=x+n;
+    double *dPPacked=dxdt+n;
+    size_t i, j;
+
+    drift->f(dxdt,x,t);
+    drift->jacobian(J,dfdt,x,t,jacobScratch);
+
+    //Unpack P.
+    for(j=0;j<n;j++) {
+        const double *PCol=PPacked+j*(j+1)/2;
+
+        for(i=0;i<=j;i++) {
+            PFull[i+j*n]=PCol[i];
+            PFull[j+i*n]=PCol[i];
+        }
+    }
+
+    //dP/dt=J*P+(J*P)'+D*D', of which only the upper triangle is computed.
+    matMultCPP(JP,J,PFull,n,n,n);
+    for(j=0;j<n;j++) {
+        double *dPCol=dPPacked+j*(j+1)/2;
+
+        for(i=0;i<=j;i++) {
+            dPCol[i]=JP[i+j*n]+JP[j+i*n]+DDT[i+j*n];
+        }
+    }
+}
+
+int CDEKFDynamicsCPP::predict(double *xPred,double *PPred,size_t *numSteps,const double *xPrev,const double *PPrev,const double tPrev,const double tPred,const ODEIntParamCPP &param,ODEScratchCPP &workMem) {
+    const size_t n=stateDim;
+    size_t i, j;
+    int exitCode;
+
+    copy(xPrev,xPrev+n,xAugStart);
+    //Pack the upper triangle of PPrev, symmetrizing it.
+    for(j=0;j<n;j++) {
+        double *PCol=xAugStart+n+j*(j+1)/2;
+
+        for(i=0;i<=j;i++) {
+            PCol[i]=(PPrev[i+j*n]+PPrev[j+i*n])/2;
+        }
+    }
+
+    exitCode=ODEAdaptiveAtTimesCPP(xAugEnd,numSteps,*this,xAugStart,tPrev,&tPred,1,param,workMem);
+
+    copy(xAugEnd,xAugEnd+n,xPred);
+    for(j=0;j<n;j++) {
+        const double *PCol=xAugEnd+n+j*(j+1)/2;
+
+        for(i=0;i<=j;i++) {
+            PPred[i+j*n]=PCol[i];
+            PPred[j+i*n]=PCol[i];
+        }
+    }
+
+    return exitCode;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
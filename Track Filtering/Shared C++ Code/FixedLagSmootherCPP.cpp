@@ -0,0 +1,634 @@
+/*FIXEDLAGSMOOTHERCPP A C++ implementation of a fixed-lag linear Kalman
+ *                    smoother that processes measurements as they arrive
+ *                    for a batch of synchronously updated tracks. After
+ *                    the measurement at discrete time k has been
+ *                    processed, a smoothed estimate of the state at time
+ *                    k-lag that uses all measurements up through time k is
+ *                    produced.
+ *
+ *For each track, a ring buffer of the last lag+1 updated and predicted
+ *states and covariance matrices is kept along with the smoothing gains
+ *C(j)=PUpd(j)*F(j)'/PPred(j+1), which are computed once during the
+ *prediction step. Every time a measurement update is performed, the
+ *Rauch-Tung-Striebel backward recursion of Chapter 8.6 of
+ *Y. Bar-Shalom, X. R. Li, and T. Kirubarajan, Estimation with Applications
+ *to Tracking and Navigation. New York: John Wiley and Sons, Inc, 2001.
+ *is run over the window of stored steps to get the estimate lag steps in
+ *the past. This gives the same result as the function KalmanSmoother with
+ *useFP=false run on all measurements up through time k, while the memory
+ *use is fixed and the computational complexity per measurement is linear
+ *in the lag.
+ *
+ *Missing measurements can be indicated by a NaN in the measurement of a
+ *track, in which case the update step for that track just copies the
+ *predicted state. This makes it possible to process asynchronous
+ *detections of many tracks in synchronized batches.
+ *
+ *Out-of-sequence measurements (OOSMs), which arrive after measurements of
+ *later times have been processed, can be used to update the current
+ *estimates with the OOSMUpdate function without reprocessing any of the
+ *stored steps, as long as the measurement is no more than lag steps old.
+ *See the comments to that function for details.
+ *
+ *If the code is compiled with OpenMP support, then the loops over the
+ *tracks are run in parallel.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+**/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy and fill_n
+#include <algorithm>
+#include "matrixFuncs.hpp"
+#include "filterFuncs.hpp"
+
+using namespace std;
+
+FixedLagSmootherCPP::FixedLagSmootherCPP(const size_t xDimDes,const size_t numTracksDes,const size_t lagDes,const double *xInit,const double *PInit,const bool PInitIsShared) {
+/*The constructor allocates the ring buffers and sets the predicted state
+ *for the first measurement of each track. xInit is xDimXnumTracks. PInit
+ *is xDimXxDim if PInitIsShared is true and xDimXxDimXnumTracks otherwise.
+ */
+    const size_t xDim2=xDimDes*xDimDes;
+    size_t numStates, numMats, curTrack;
+    char *basePtr;
+
+    xDim=xDimDes;
+    numTracks=numTracksDes;
+    lag=lagDes;
+    numSlots=lag+1;
+    numUpdates=0;
+    numSmoothed=0;
+    predPending=true;
+
+    numStates=numTracks*numSlots*xDim;
+    numMats=numTracks*numSlots*xDim2;
+
+    /*To minimize the number of calls to memory allocation and deallocation
+     * routines, a big chunk of memory is allocated at once and pointers
+     * to parts of it for the different variables are saved.*/
+    buffer=new char[(2*numStates+3*numMats)*sizeof(double)];
+    basePtr=buffer;
+    xUpd=(double*)basePtr;
+    basePtr+=sizeof(double)*numStates;
+    xPred=(double*)basePtr;
+    basePtr+=sizeof(double)*numStates;
+    PUpd=(double*)basePtr;
+    basePtr+=sizeof(double)*numMats;
+    PPred=(double*)basePtr;
+    basePtr+=sizeof(double)*numMats;
+    C=(double*)basePtr;
+
+    for(curTrack=0;curTrack<numTracks;curTrack++) {
+        const size_t offset=curTrack*numSlots;
+        const double *PCur;
+
+        if(PInitIsShared) {
+            PCur=PInit;
+        } else {
+            PCur=PInit+xDim2*curTrack;
+        }
+
+        copy(xInit+xDim*curTrack,xInit+xDim*(curTrack+1),xPred+offset*xDim);
+        copy(PCur,PCur+xDim2,PPred+offset*xDim2);
+    }
+}
+
+size_t FixedLagSmootherCPP::slotIdx(const size_t step) const {
+//SLOTIDX The index in the ring buffer of the given discrete step.
+    return step%numSlots;
+}
+
+size_t FixedLagSmootherCPP::numUnsmoothed() const {
+//NUMUNSMOOTHED The number of updated steps for which a smoothed estimate
+//              has not yet been produced.
+    return numUpdates-numSmoothed;
+}
+
+bool FixedLagSmootherCPP::nextUpdateHasOutput() const {
+//NEXTUPDATEHASOUTPUT Whether the next update produces a smoothed
+//                    estimate, which is the case if the step lag steps
+//                    before it has not already been produced by flush.
+    return numUpdates+1>numSmoothed+lag;
+}
+
+bool FixedLagSmootherCPP::update(double *xSmooth,double *PSmooth,bool *updateFailed,const double *z,const size_t zDim,const double *H,const bool HIsShared,const double *R,const bool RIsShared) {
+/*UPDATE Perform a measurement update for all of the tracks. z is
+ *       zDimXnumTracks and H and R are either single matrices that are
+ *       used for all tracks or stacks of numTracks matrices depending on
+ *       HIsShared and RIsShared. If a smoothed estimate becomes available
+ *       as a result of the update (nextUpdateHasOutput() is true before
+ *       the update), then the xDimXnumTracks smoothed states are put in
+ *       xSmooth and the xDimXxDimXnumTracks smoothed covariance matrices
+ *       in PSmooth. After a call to flush, no estimates are produced for
+ *       the next lag updates, because the steps that they would smooth
+ *       have already been output.
+ *       PSmooth can be NULL if the smoothed covariance matrices are not
+ *       needed, which saves a significant amount of computation.
+ *       updateFailed is a length numTracks array that is set to true for
+ *       tracks where the innovation covariance matrix was not positive
+ *       definite, in which case the state is not updated. The return value
+ *       is false if an update was not expected (the previous operation was
+ *       an update, not a prediction).
+ */
+    const size_t xDim2=xDim*xDim;
+    const size_t curSlot=slotIdx(numUpdates);
+    const bool haveOutput=nextUpdateHasOutput();
+
+    if(predPending==false) {
+        return false;
+    }
+
+    #pragma omp parallel
+    {
+        KalmanScratch workMem(xDim,zDim);
+        ptrdiff_t curTrack;
+
+        #pragma omp for
+        for(curTrack=0;curTrack<(ptrdiff_t)numTracks;curTrack++) {
+            const size_t offset=(size_t)curTrack*numSlots+curSlot;
+            const double *zCur=z+zDim*(size_t)curTrack;
+            const double *HCur=HIsShared?H:H+zDim*xDim*(size_t)curTrack;
+            const double *RCur=RIsShared?R:R+zDim*zDim*(size_t)curTrack;
+            double *xUpdCur=xUpd+offset*xDim;
+            double *PUpdCur=PUpd+offset*xDim2;
+            const double *xPredCur=xPred+offset*xDim;
+            const double *PPredCur=PPred+offset*xDim2;
+            bool isMissing=false;
+            size_t i;
+
+            for(i=0;i<zDim;i++) {
+                if(zCur[i]!=zCur[i]) {
+                    isMissing=true;
+                    break;
+                }
+            }
+
+            updateFailed[curTrack]=false;
+            if(isMissing||!KalmanUpdateCPP(xUpdCur,PUpdCur,NULL,NULL,xPredCur,PPredCur,zCur,RCur,HCur,workMem)) {
+                updateFailed[curTrack]=!isMissing;
+                copy(xPredCur,xPredCur+xDim,xUpdCur);
+                copy(PPredCur,PPredCur+xDim2,PUpdCur);
+            }
+        }
+    }
+
+    numUpdates++;
+    predPending=false;
+
+    if(haveOutput) {
+        #pragma omp parallel
+        {
+            KalmanScratch workMem(xDim,0);
+            ptrdiff_t curTrack;
+
+            #pragma omp for
+            for(curTrack=0;curTrack<(ptrdiff_t)numTracks;curTrack++) {
+                double *PSmoothCur=NULL;
+
+                if(PSmooth!=NULL) {
+                    PSmoothCur=PSmooth+xDim2*(size_t)curTrack;
+                }
+
+                smoothTrack(xSmooth+xDim*(size_t)curTrack,PSmoothCur,(size_t)curTrack,numSlots,1,workMem);
+            }
+        }
+        numSmoothed=numUpdates-lag;
+    }
+
+    return true;
+}
+
+bool FixedLagSmootherCPP::OOSMUpdate(bool *updateFailed,const double *z,const size_t zDim,const double *H,const bool HIsShared,const double *R,const bool RIsShared,const size_t numStepsBack,const double *F1,const bool F1IsShared,const double *Q1,const bool Q1IsShared,const double *F2,const bool F2IsShared) {
+/*OOSMUPDATE Update the current estimates of all of the tracks with an
+ *           out-of-sequence measurement (OOSM), which is a measurement
+ *           from a time tau before that of the most recent update. tau
+ *           lies between the times of the updates that were numStepsBack
+ *           and numStepsBack-1 steps ago, so numStepsBack=1 means that
+ *           the OOSM is between the last two updates. F1 and Q1 are the
+ *           state transition and process noise covariance matrices from
+ *           the earlier of those updates to tau and F2 is the state
+ *           transition matrix from tau to the later of those updates.
+ *           F1, Q1 and F2 and z, H and R are either single matrices that
+ *           are used for all tracks or stacks of numTracks matrices,
+ *           depending on the corresponding IsShared inputs. A NaN in the
+ *           measurement of a track means that the track is not updated.
+ *           updateFailed is set as in the update function. The return
+ *           value is false if the previous operation was not an update or
+ *           if numStepsBack is zero or more steps back than are stored
+ *           (more than lag or the number of updates minus 1).
+ *
+ *           The state of each track at time tau given all of the
+ *           measurements before the OOSM is found by running the
+ *           Rauch-Tung-Striebel recursion back from the current step over
+ *           the stored steps and then retrodicting from the step after
+ *           tau to tau. Its cross covariance with the current state is
+ *           carried along in the recursion, which makes it possible to
+ *           update the current state directly with the OOSM. For
+ *           numStepsBack=1, this is the same as the exact algorithm A1
+ *           of Y. Bar-Shalom, "Update with out-of-sequence measurements
+ *           in tracking: Exact solution," IEEE Transactions on Aerospace
+ *           and Electronic Systems, vol. 38, no. 3, pp. 769-778, Jul.
+ *           2002. It is also exact for larger numStepsBack, since the
+ *           filtered states at all of the intervening steps are
+ *           available. The computational complexity is linear in
+ *           numStepsBack and no updates are repeated. Only the current
+ *           state of each track is changed; the states stored for the
+ *           earlier steps, which are used for smoothing, do not include
+ *           the OOSM.
+ */
+    const size_t xDim2=xDim*xDim;
+    const size_t curStep=numUpdates-1;
+    size_t prevStep;
+
+    if(predPending==true||numStepsBack==0||numStepsBack>lag||numStepsBack>curStep) {
+        return false;
+    }
+    //The step of the last update before tau.
+    prevStep=curStep-numStepsBack;
+
+    #pragma omp parallel
+    {
+        KalmanScratch workMem(xDim,zDim);
+        double *scratch=new double[4*xDim2];
+        double *Ps=scratch;
+        double *A=scratch+xDim2;
+        double *PTau=scratch+2*xDim2;
+        double *G=scratch+3*xDim2;
+        double *xs=workMem.xTemp;
+        double *xTau=workMem.xTemp2;
+        double *temp=workMem.xxTemp1;
+        double *temp2=workMem.xxTemp2;
+        double *HB=workMem.xzTemp1;
+        double *S=workMem.zzTemp1;
+        double *SChol=workMem.zzTemp2;
+        double *innov=workMem.zTemp;
+        ptrdiff_t curTrack;
+
+        #pragma omp for
+        for(curTrack=0;curTrack<(ptrdiff_t)numTracks;curTrack++) {
+            const size_t trackOffset=(size_t)curTrack*numSlots;
+            const size_t curOffset=trackOffset+slotIdx(curStep);
+            const size_t prevOffset=trackOffset+slotIdx(prevStep);
+            const size_t nextOffset=trackOffset+slotIdx(prevStep+1);
+            const double *zCur=z+zDim*(size_t)curTrack;
+            const double *HCur=HIsShared?H:H+zDim*xDim*(size_t)curTrack;
+            const double *RCur=RIsShared?R:R+zDim*zDim*(size_t)curTrack;
+            const double *F1Cur=F1IsShared?F1:F1+xDim2*(size_t)curTrack;
+            const double *Q1Cur=Q1IsShared?Q1:Q1+xDim2*(size_t)curTrack;
+            const double *F2Cur=F2IsShared?F2:F2+xDim2*(size_t)curTrack;
+            const double *xPredNext=xPred+nextOffset*xDim;
+            const double *PPredNext=PPred+nextOffset*xDim2;
+            double *xCur=xUpd+curOffset*xDim;
+            double *PCur=PUpd+curOffset*xDim2;
+            size_t step,i,j;
+
+            updateFailed[curTrack]=false;
+            for(i=0;i<zDim;i++) {
+                if(zCur[i]!=zCur[i]) {
+                    break;
+                }
+            }
+            if(i<zDim) {
+                continue;
+            }
+
+            /*Run the smoothing recursion back to the step after tau. xs
+             *and Ps are the smoothed state and covariance matrix and A is
+             *the cross covariance of the state with the current state.*/
+            copy(xCur,xCur+xDim,xs);
+            copy(PCur,PCur+xDim2,Ps);
+            copy(PCur,PCur+xDim2,A);
+            for(step=curStep-1;step>prevStep;step--) {
+                const size_t offset=trackOffset+slotIdx(step);
+                const size_t offsetNext=trackOffset+slotIdx(step+1);
+                const double *CCur=C+offset*xDim2;
+                const double *xUpdCur=xUpd+offset*xDim;
+                const double *PUpdCur=PUpd+offset*xDim2;
+                const double *xPredStep=xPred+offsetNext*xDim;
+                const double *PPredStep=PPred+offsetNext*xDim2;
+
+                //xs=xUpd+C*(xs-xPred)
+                for(i=0;i<xDim;i++) {
+                    temp[i]=xs[i]-xPredStep[i];
+                }
+                matVecMultCPP(xs,CCur,temp,xDim,xDim);
+                for(i=0;i<xDim;i++) {
+                    xs[i]+=xUpdCur[i];
+                }
+
+                //Ps=PUpd+C*(Ps-PPred)*C'
+                for(i=0;i<xDim2;i++) {
+                    temp2[i]=Ps[i]-PPredStep[i];
+                }
+                matMultCPP(temp,CCur,temp2,xDim,xDim,xDim);
+                matMultABTransCPP(Ps,temp,CCur,xDim,xDim,xDim);
+                for(i=0;i<xDim2;i++) {
+                    Ps[i]+=PUpdCur[i];
+                }
+                symmetrizeCPP(Ps,xDim);
+
+                //A=C*A
+                matMultCPP(temp,CCur,A,xDim,xDim,xDim);
+                copy(temp,temp+xDim2,A);
+            }
+
+            /*Retrodict to tau. The prediction from the last update before
+             *tau to tau is smoothed using the smoothed estimate at the step
+             *after tau with the gain G=PTau*F2'/PPredNext, which is found
+             *by solving PPredNext*G'=F2*PTau.*/
+            DiscKalPredCPP(xTau,PTau,xUpd+prevOffset*xDim,PUpd+prevOffset*xDim2,F1Cur,Q1Cur,NULL,workMem);
+            matMultCPP(temp,F2Cur,PTau,xDim,xDim,xDim);
+            if(cholLowerCPP(temp2,PPredNext,xDim)) {
+                cholSolveCPP(temp,temp2,xDim,xDim);
+            } else {
+                copy(PPredNext,PPredNext+xDim2,temp2);
+                if(LUDecompCPP(temp2,workMem.pivot,xDim)) {
+                    LUSolveCPP(temp,temp2,workMem.pivot,xDim,xDim);
+                } else {
+                    updateFailed[curTrack]=true;
+                    continue;
+                }
+            }
+            for(i=0;i<xDim;i++) {
+                for(j=0;j<xDim;j++) {
+                    G[i+j*xDim]=temp[j+i*xDim];
+                }
+            }
+
+            //xTau=xTau+G*(xs-xPredNext)
+            for(i=0;i<xDim;i++) {
+                xs[i]-=xPredNext[i];
+            }
+            matVecMultCPP(temp,G,xs,xDim,xDim);
+            for(i=0;i<xDim;i++) {
+                xTau[i]+=temp[i];
+            }
+
+            //PTau=PTau+G*(Ps-PPredNext)*G'
+            for(i=0;i<xDim2;i++) {
+                Ps[i]-=PPredNext[i];
+            }
+            matMultCPP(temp,G,Ps,xDim,xDim,xDim);
+            matMultABTransCPP(temp2,temp,G,xDim,xDim,xDim);
+            for(i=0;i<xDim2;i++) {
+                PTau[i]+=temp2[i];
+            }
+            symmetrizeCPP(PTau,xDim);
+
+            /*The cross covariance of the state at tau with the current
+             *state is G*A, so the cross covariance of the current state
+             *with the OOSM is (H*G*A)'. HB=H*G*A is zDimXxDim.*/
+            matMultCPP(temp,G,A,xDim,xDim,xDim);
+            matMultCPP(HB,HCur,temp,zDim,xDim,xDim);
+
+            //The innovation and its covariance matrix S=H*PTau*H'+R.
+            matVecMultCPP(innov,HCur,xTau,zDim,xDim);
+            for(i=0;i<zDim;i++) {
+                innov[i]=zCur[i]-innov[i];
+            }
+            matMultCPP(workMem.xzTemp2,HCur,PTau,zDim,xDim,xDim);
+            matMultABTransCPP(S,workMem.xzTemp2,HCur,zDim,xDim,zDim);
+            for(i=0;i<zDim*zDim;i++) {
+                S[i]+=RCur[i];
+            }
+            symmetrizeCPP(S,zDim);
+
+            if(!cholLowerCPP(SChol,S,zDim)) {
+                updateFailed[curTrack]=true;
+                continue;
+            }
+
+            /*With S=L*L', x=x+HB'*inv(S)*innov and P=P-M'*M, where
+             *M=inv(L)*HB.*/
+            cholSolveCPP(innov,SChol,zDim,1);
+            matTransVecMultCPP(temp,HB,innov,xDim,zDim);
+            for(i=0;i<xDim;i++) {
+                xCur[i]+=temp[i];
+            }
+
+            forwardSubstCPP(HB,SChol,zDim,xDim);
+            matMultATransBCPP(temp,HB,HB,xDim,zDim,xDim);
+            for(i=0;i<xDim2;i++) {
+                PCur[i]-=temp[i];
+            }
+            symmetrizeCPP(PCur,xDim);
+        }
+
+        delete[] scratch;
+    }
+
+    return true;
+}
+
+bool FixedLagSmootherCPP::predict(bool *predFailed,const double *F,const bool FIsShared,const double *Q,const bool QIsShared,const double *u) {
+/*PREDICT Predict all of the tracks forward to the time of the next
+ *        measurement. F and Q are either single matrices that are used for
+ *        all tracks or stacks of numTracks matrices depending on FIsShared
+ *        and QIsShared. u is either NULL (no control input) or an
+ *        xDimXnumTracks matrix of control inputs. The smoothing gain for
+ *        the step being predicted from is computed here. predFailed is a
+ *        length numTracks array that is set to true for tracks where the
+ *        predicted covariance matrix is singular, in which case a
+ *        pseudo-smoothing gain of zero is used (the smoothed estimate at
+ *        that step is just the filtered estimate). The return value is
+ *        false if a prediction was not expected.
+ */
+    const size_t xDim2=xDim*xDim;
+    size_t prevSlot, nextSlot;
+
+    if(predPending==true) {
+        return false;
+    }
+
+    prevSlot=slotIdx(numUpdates-1);
+    nextSlot=slotIdx(numUpdates);
+
+    #pragma omp parallel
+    {
+        KalmanScratch workMem(xDim,0);
+        ptrdiff_t curTrack;
+
+        #pragma omp for
+        for(curTrack=0;curTrack<(ptrdiff_t)numTracks;curTrack++) {
+            const size_t prevOffset=(size_t)curTrack*numSlots+prevSlot;
+            const size_t nextOffset=(size_t)curTrack*numSlots+nextSlot;
+            const double *FCur=FIsShared?F:F+xDim2*(size_t)curTrack;
+            const double *QCur=QIsShared?Q:Q+xDim2*(size_t)curTrack;
+            const double *uCur=(u==NULL)?NULL:u+xDim*(size_t)curTrack;
+            const double *PUpdCur=PUpd+prevOffset*xDim2;
+            double *PPredCur=PPred+nextOffset*xDim2;
+            double *CCur=C+prevOffset*xDim2;
+            double *CTrans=workMem.xxTemp1;
+            size_t i,j;
+
+            DiscKalPredCPP(xPred+nextOffset*xDim,PPredCur,xUpd+prevOffset*xDim,PUpdCur,FCur,QCur,uCur,workMem);
+
+            //C=PUpd*F'/PPred is found by solving PPred*C'=F*PUpd using the
+            //symmetry of PUpd and PPred.
+            matMultCPP(CTrans,FCur,PUpdCur,xDim,xDim,xDim);
+            predFailed[curTrack]=false;
+            if(cholLowerCPP(workMem.xxTemp2,PPredCur,xDim)) {
+                cholSolveCPP(CTrans,workMem.xxTemp2,xDim,xDim);
+            } else {
+                //If PPred is only semidefinite, try a general solver.
+                copy(PPredCur,PPredCur+xDim2,workMem.xxTemp2);
+                if(LUDecompCPP(workMem.xxTemp2,workMem.pivot,xDim)) {
+                    LUSolveCPP(CTrans,workMem.xxTemp2,workMem.pivot,xDim,xDim);
+                } else {
+                    predFailed[curTrack]=true;
+                    fill_n(CTrans,xDim2,0.0);
+                }
+            }
+
+            for(i=0;i<xDim;i++) {
+                for(j=0;j<xDim;j++) {
+                    CCur[i+j*xDim]=CTrans[j+i*xDim];
+                }
+            }
+        }
+    }
+
+    predPending=true;
+    return true;
+}
+
+size_t FixedLagSmootherCPP::flush(double *xSmooth,double *PSmooth) {
+/*FLUSH Get smoothed estimates for all of the steps that have been updated
+ *      but for which smoothed estimates have not yet been produced, such
+ *      as at the end of the tracks. The return value is the number of
+ *      steps, numOut. xSmooth must have space for xDim*numTracks*numOut
+ *      values and is ordered xDimXnumTracksXnumOut with the oldest step
+ *      first. PSmooth is ordered similarly and can be NULL. numOut is
+ *      equal to the value returned by numUnsmoothed() before the call.
+ *      Updates can continue afterwards, but the next lag of them produce
+ *      no smoothed estimates, so that no step is output twice.
+ */
+    const size_t numOut=numUnsmoothed();
+
+    if(numOut==0) {
+        return 0;
+    }
+
+    #pragma omp parallel
+    {
+        KalmanScratch workMem(xDim,0);
+        ptrdiff_t curTrack;
+
+        #pragma omp for
+        for(curTrack=0;curTrack<(ptrdiff_t)numTracks;curTrack++) {
+            double *PSmoothCur=NULL;
+
+            if(PSmooth!=NULL) {
+                PSmoothCur=PSmooth+xDim*xDim*(size_t)curTrack;
+            }
+
+            smoothTrack(xSmooth+xDim*(size_t)curTrack,PSmoothCur,(size_t)curTrack,numOut,numOut,workMem);
+        }
+    }
+
+    numSmoothed=numUpdates;
+    return numOut;
+}
+
+void FixedLagSmootherCPP::smoothTrack(double *xSmooth,double *PSmooth,const size_t curTrack,const size_t numSteps,const size_t numOut,KalmanScratch &workMem) const {
+/*SMOOTHTRACK Run the backward recursion for a single track over the last
+ *            numSteps updated steps and save the smoothed estimates of the
+ *            numOut oldest of those steps. The outputs are spaced by
+ *            xDim*numTracks (xDim*xDim*numTracks for the covariance
+ *            matrices) so that the results for all tracks are interleaved.
+ *            PSmooth can be NULL.
+ */
+    const size_t xDim2=xDim*xDim;
+    const size_t newestStep=numUpdates-1;
+    const size_t oldestStep=numUpdates-numSteps;
+    const size_t trackOffset=curTrack*numSlots;
+    double *xs=workMem.xTemp;
+    double *diff=workMem.xTemp2;
+    double *Ps=workMem.xxTemp1;
+    double *temp=workMem.xxTemp2;
+    double *PDiff=workMem.xxTemp3;
+    size_t curStep,i;
+
+    {
+        const size_t offset=trackOffset+slotIdx(newestStep);
+
+        copy(xUpd+offset*xDim,xUpd+(offset+1)*xDim,xs);
+        if(PSmooth!=NULL) {
+            copy(PUpd+offset*xDim2,PUpd+(offset+1)*xDim2,Ps);
+        }
+    }
+
+    curStep=newestStep;
+    while(1) {
+        //Save the result if this is one of the desired outputs.
+        if(curStep-oldestStep<numOut) {
+            const size_t outIdx=curStep-oldestStep;
+
+            copy(xs,xs+xDim,xSmooth+outIdx*xDim*numTracks);
+            if(PSmooth!=NULL) {
+                copy(Ps,Ps+xDim2,PSmooth+outIdx*xDim2*numTracks);
+            }
+        }
+
+        if(curStep==oldestStep) {
+            break;
+        }
+        curStep--;
+
+        {
+            const size_t offset=trackOffset+slotIdx(curStep);
+            const size_t nextOffset=trackOffset+slotIdx(curStep+1);
+            const double *CCur=C+offset*xDim2;
+            const double *xPredNext=xPred+nextOffset*xDim;
+            const double *xUpdCur=xUpd+offset*xDim;
+
+            //xs=xUpd+C*(xs-xPredNext)
+            for(i=0;i<xDim;i++) {
+                diff[i]=xs[i]-xPredNext[i];
+            }
+            matVecMultCPP(xs,CCur,diff,xDim,xDim);
+            for(i=0;i<xDim;i++) {
+                xs[i]+=xUpdCur[i];
+            }
+
+            if(PSmooth!=NULL) {
+                const double *PPredNext=PPred+nextOffset*xDim2;
+                const double *PUpdCur=PUpd+offset*xDim2;
+
+                //Ps=PUpd+C*(Ps-PPredNext)*C'
+                for(i=0;i<xDim2;i++) {
+                    PDiff[i]=Ps[i]-PPredNext[i];
+                }
+                matMultCPP(temp,CCur,PDiff,xDim,xDim,xDim);
+                matMultABTransCPP(Ps,temp,CCur,xDim,xDim,xDim);
+                for(i=0;i<xDim2;i++) {
+                    Ps[i]+=PUpdCur[i];
+                }
+                symmetrizeCPP(Ps,xDim);
+            }
+        }
+    }
+}
+
+FixedLagSmootherCPP::~FixedLagSmootherCPP() {
+    delete[] buffer;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,139 @@
+/*KALMANFUNCSCPP C++ implementations of the prediction and measurement
+ *               update steps of the standard linear Kalman filter. These
+ *               are the same as the Matlab functions DiscKalPred and
+ *               KalmanUpdate, but they do not allocate memory, so that
+ *               they can be called efficiently in loops over many tracks.
+ *
+ *The algorithms are derived in Chapter 5 of
+ *Y. Bar-Shalom, X. R. Li, and T. Kirubarajan, Estimation with Applications
+ *to Tracking and Navigation. New York: John Wiley and Sons, Inc, 2001.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+**/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy
+#include <algorithm>
+#include "matrixFuncs.hpp"
+#include "filterFuncs.hpp"
+
+using namespace std;
+
+bool KalmanUpdateCPP(double *xUpdate,double *PUpdate,double *innov,double *Pzz,const double *xPred,const double *PPred,const double *z,const double *R,const double *H,KalmanScratch &workMem) {
+    const size_t xDim=workMem.xDim;
+    const size_t zDim=workMem.zDim;
+    double *PHT=workMem.xzTemp1;
+    double *W=workMem.xzTemp2;
+    double *S=workMem.zzTemp1;
+    double *SChol=workMem.zzTemp2;
+    double *nu=workMem.zTemp;
+    double *IMinusWH=workMem.xxTemp1;
+    double *temp=workMem.xxTemp2;
+    size_t i,j;
+
+    //The innovation nu=z-H*xPred.
+    matVecMultCPP(nu,H,xPred,zDim,xDim);
+    for(i=0;i<zDim;i++) {
+        nu[i]=z[i]-nu[i];
+    }
+
+    //The innovation covariance S=R+H*PPred*H'.
+    matMultABTransCPP(PHT,PPred,H,xDim,xDim,zDim);
+    matMultCPP(S,H,PHT,zDim,xDim,zDim);
+    for(i=0;i<zDim*zDim;i++) {
+        S[i]+=R[i];
+    }
+    symmetrizeCPP(S,zDim);
+
+    if(!cholLowerCPP(SChol,S,zDim)) {
+        return false;
+    }
+
+    //The gain W=PPred*H'/S is found by solving S*W'=H*PPred.
+    for(i=0;i<xDim;i++) {
+        for(j=0;j<zDim;j++) {
+            W[j+i*zDim]=PHT[i+j*xDim];
+        }
+    }
+    cholSolveCPP(W,SChol,zDim,xDim);
+    //W currently holds W'; transpose it into PHT, which is no longer
+    //needed.
+    for(i=0;i<xDim;i++) {
+        for(j=0;j<zDim;j++) {
+            PHT[i+j*xDim]=W[j+i*zDim];
+        }
+    }
+    W=PHT;
+
+    //The state update xUpdate=xPred+W*nu.
+    matVecMultCPP(xUpdate,W,nu,xDim,zDim);
+    for(i=0;i<xDim;i++) {
+        xUpdate[i]+=xPred[i];
+    }
+
+    //The Joseph-form covariance update
+    //PUpdate=(I-W*H)*PPred*(I-W*H)'+W*R*W'.
+    matMultCPP(IMinusWH,W,H,xDim,zDim,xDim);
+    for(i=0;i<xDim*xDim;i++) {
+        IMinusWH[i]=-IMinusWH[i];
+    }
+    for(i=0;i<xDim;i++) {
+        IMinusWH[i+i*xDim]+=1;
+    }
+    matMultCPP(temp,IMinusWH,PPred,xDim,xDim,xDim);
+    matMultABTransCPP(PUpdate,temp,IMinusWH,xDim,xDim,xDim);
+
+    matMultCPP(workMem.xzTemp2,W,R,xDim,zDim,zDim);
+    matMultABTransCPP(temp,workMem.xzTemp2,W,xDim,zDim,xDim);
+    for(i=0;i<xDim*xDim;i++) {
+        PUpdate[i]+=temp[i];
+    }
+    symmetrizeCPP(PUpdate,xDim);
+
+    if(innov!=NULL) {
+        copy(nu,nu+zDim,innov);
+    }
+    if(Pzz!=NULL) {
+        copy(S,S+zDim*zDim,Pzz);
+    }
+
+    return true;
+}
+
+void DiscKalPredCPP(double *xPred,double *PPred,const double *xPrev,const double *PPrev,const double *F,const double *Q,const double *u,KalmanScratch &workMem) {
+    const size_t xDim=workMem.xDim;
+    double *temp=workMem.xxTemp3;
+    size_t i;
+
+    matVecMultCPP(xPred,F,xPrev,xDim,xDim);
+    if(u!=NULL) {
+        for(i=0;i<xDim;i++) {
+            xPred[i]+=u[i];
+        }
+    }
+
+    matMultCPP(temp,F,PPrev,xDim,xDim,xDim);
+    matMultABTransCPP(PPred,temp,F,xDim,xDim,xDim);
+    for(i=0;i<xDim*xDim;i++) {
+        PPred[i]+=Q[i];
+    }
+    symmetrizeCPP(PPred,xDim);
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,112 @@
+/*PCRLBCPP C++ functions for the recursions of the Fisher information
+ *         matrix (FIM), whose inverse is the posterior Cramer-Rao lower
+ *         bound (PCRLB), for tracking with additive Gaussian process and
+ *         measurement noise and no clutter.
+ *
+ *The recursion of the FIM with a linear dynamic model is from
+ *P. Tichavsky, C. H. Muravchik, and A. Nehorai, "Posterior Cramer-Rao
+ *bounds for discrete-time nonlinear filtering," IEEE Transactions on
+ *Signal Processing, vol. 46, no. 5, pp. 1386-1396, May 1998.
+ *and the measurement update with a detection probability PD but no
+ *clutter, where the information reduction factor is PD, is from
+ *P. Stinco, M. S. Greco, F. Gini, and A. Farina, "Posterior Cramer-Rao
+ *lower bounds for passive bistatic radar tracking with uncertain target
+ *measurements," Signal Processing, vol. 93, no. 12, pp. 3528-3540,
+ *Dec. 2013.
+ *These are the same recursions as in the Matlab functions PCRLBPredAdd and
+ *PCRLBUpdateAddNoClutter, except that the measurement Jacobians are
+ *computed in C++ by measModelCPP rather than by calling a Matlab function
+ *handle, so that many bounds can be evaluated in parallel.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+**/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy
+#include <algorithm>
+#include "matrixFuncs.hpp"
+#include "filterFuncs.hpp"
+
+using namespace std;
+
+bool PCRLBPredLinCPP(double *JPred,const double *JPrior,const double *QInv,const double *D11,const double *D12,const size_t xDim,double *scratch,size_t *pivot) {
+/*PCRLBPREDLINCPP Compute JPred=QInv-D12'*inv(JPrior+D11)*D12.
+ */
+    const size_t xx=xDim*xDim;
+    double *A=scratch;
+    double *X=scratch+xx;
+    size_t i;
+
+    for(i=0;i<xx;i++) {
+        A[i]=JPrior[i]+D11[i];
+    }
+
+    if(!LUDecompCPP(A,pivot,xDim)) {
+        return false;
+    }
+
+    copy(D12,D12+xx,X);
+    LUSolveCPP(X,A,pivot,xDim,xDim);
+
+    matMultATransBCPP(JPred,D12,X,xDim,xDim,xDim);
+    for(i=0;i<xx;i++) {
+        JPred[i]=QInv[i]-JPred[i];
+    }
+    symmetrizeCPP(JPred,xDim);
+
+    return true;
+}
+
+void FIMMeasInfoAddCPP(double *J,const double *points,const double *w,const size_t numPoints,const size_t xDim,const size_t zDim,const int measType,const double *measParam,const double *RInv,const double PD,double *scratch) {
+/*FIMMEASINFOADDCPP Compute J=J+PD*sum_i w(i)*H_i'*RInv*H_i, where H_i is
+ *              the measurement Jacobian at the ith point.
+ */
+    double *H=scratch;
+    double *RInvH=scratch+zDim*xDim;
+    double *zPred=scratch+2*zDim*xDim;
+    size_t curPoint, i, j, k;
+
+    for(curPoint=0;curPoint<numPoints;curPoint++) {
+        const double wCur=PD*w[curPoint];
+
+        measModelCPP(zPred,H,points+curPoint*xDim,xDim,zDim,measType,measParam);
+        matMultCPP(RInvH,RInv,H,zDim,zDim,xDim);
+
+        //Only the upper triangle of H'*RInv*H is computed; it is
+        //symmetric.
+        for(j=0;j<xDim;j++) {
+            for(i=0;i<=j;i++) {
+                double sum=0;
+
+                for(k=0;k<zDim;k++) {
+                    sum+=H[k+i*zDim]*RInvH[k+j*zDim];
+                }
+                J[i+j*xDim]+=wCur*sum;
+            }
+        }
+    }
+
+    for(j=0;j<xDim;j++) {
+        for(i=0;i<j;i++) {
+            J[j+i*xDim]=J[i+j*xDim];
+        }
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,226 @@
+/*TRACKTABLECPP A C++ implementation of a table that holds the states,
+ *              covariance matrices, scores and IDs of a set of tracks that
+ *              changes over time, as in a tracker that runs for a long
+ *              time with tracks being started and terminated every scan.
+ *
+ *All of the memory for the table is allocated once when the table is
+ *created, with room for a fixed number of tracks (the capacity). The
+ *values of the tracks are stored as a structure of arrays: all states are
+ *in one xDimXcapacity array, all covariance matrices in one
+ *xDimXxDimXcapacity array and so on. The tracks that are in the table
+ *always occupy the first numTracks slots of the arrays. When a track is
+ *removed, the track in the last slot is moved into the slot that was
+ *freed. Thus, the order of the tracks in the arrays changes as tracks are
+ *removed. The filtering and association routines run directly on the
+ *arrays without any gathering of the tracks.
+ *
+ *Since the slot of a track changes, tracks are referred to by an ID that
+ *is assigned when the track is added. Each ID maps to one of capacity
+ *indices as index=mod(ID-1,capacity) and for each index, the ID that
+ *currently has it and the slot of that track are stored, so a track is
+ *found in constant time. The free indices are kept on a stack. When an
+ *index is reused, the new ID is the previous ID with that index plus
+ *capacity, so IDs are never reused and looking up the ID of a track that
+ *has been removed does not find another track.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+**/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy and swap
+#include <algorithm>
+#include "filterFuncs.hpp"
+
+using namespace std;
+
+TrackTableCPP::TrackTableCPP(const size_t xDimDes,const size_t capacityDes) {
+/*The constructor allocates the memory for a table holding up to
+ *capacityDes tracks with xDimDes-dimensional states. The table is
+ *initially empty.
+ */
+    const size_t numStates=xDimDes*capacityDes;
+    const size_t numMats=xDimDes*xDimDes*capacityDes;
+    size_t i;
+    char *basePtr;
+
+    xDim=xDimDes;
+    capacity=capacityDes;
+    numTracks=0;
+
+    /*To minimize the number of calls to memory allocation and deallocation
+     * routines, a big chunk of memory is allocated at once and pointers
+     * to parts of it for the different variables are saved.*/
+    buffer=new char[(2*numStates+2*numMats+capacity)*sizeof(double)+4*capacity*sizeof(size_t)];
+    basePtr=buffer;
+    x=(double*)basePtr;
+    basePtr+=sizeof(double)*numStates;
+    xWork=(double*)basePtr;
+    basePtr+=sizeof(double)*numStates;
+    P=(double*)basePtr;
+    basePtr+=sizeof(double)*numMats;
+    PWork=(double*)basePtr;
+    basePtr+=sizeof(double)*numMats;
+    score=(double*)basePtr;
+    basePtr+=sizeof(double)*capacity;
+    ID=(size_t*)basePtr;
+    basePtr+=sizeof(size_t)*capacity;
+    idx2ID=(size_t*)basePtr;
+    basePtr+=sizeof(size_t)*capacity;
+    idx2Slot=(size_t*)basePtr;
+    basePtr+=sizeof(size_t)*capacity;
+    freeIdx=(size_t*)basePtr;
+
+    //The indices are put on the stack so that the lowest is used first.
+    numFree=capacity;
+    for(i=0;i<capacity;i++) {
+        idx2ID[i]=0;
+        idx2Slot[i]=capacity;
+        freeIdx[i]=capacity-1-i;
+    }
+}
+
+bool TrackTableCPP::addTrack(size_t *newID,const double *xNew,const double *PNew,const double scoreNew) {
+/*ADDTRACK Add a track with the xDimX1 state xNew, the xDimXxDim
+ *         covariance matrix PNew and the score scoreNew to the end of the
+ *         table. The ID of the track is put in newID. The return value is
+ *         false if the table is full, in which case nothing is added.
+ */
+    const size_t xDim2=xDim*xDim;
+    const size_t slot=numTracks;
+    size_t idx;
+
+    if(numFree==0) {
+        return false;
+    }
+
+    numFree--;
+    idx=freeIdx[numFree];
+    if(idx2ID[idx]==0) {
+        idx2ID[idx]=idx+1;
+    } else {
+        idx2ID[idx]+=capacity;
+    }
+    idx2Slot[idx]=slot;
+
+    copy(xNew,xNew+xDim,x+xDim*slot);
+    copy(PNew,PNew+xDim2,P+xDim2*slot);
+    score[slot]=scoreNew;
+    ID[slot]=idx2ID[idx];
+    numTracks++;
+
+    *newID=idx2ID[idx];
+    return true;
+}
+
+ptrdiff_t TrackTableCPP::findSlot(const size_t trackID) const {
+/*FINDSLOT Get the slot of the track with the given ID or -1 if no track
+ *         with that ID is in the table.
+ */
+    size_t idx;
+
+    if(trackID==0) {
+        return -1;
+    }
+
+    idx=(trackID-1)%capacity;
+    if(idx2ID[idx]!=trackID||idx2Slot[idx]>=capacity) {
+        return -1;
+    }
+
+    return (ptrdiff_t)idx2Slot[idx];
+}
+
+bool TrackTableCPP::removeTrack(const size_t trackID) {
+/*REMOVETRACK Remove the track with the given ID from the table, moving
+ *            the track in the last slot into its place. The return value
+ *            is false if no track with that ID is in the table.
+ */
+    const size_t xDim2=xDim*xDim;
+    const ptrdiff_t slot=findSlot(trackID);
+    size_t idx, last;
+
+    if(slot<0) {
+        return false;
+    }
+
+    idx=(trackID-1)%capacity;
+    idx2Slot[idx]=capacity;
+    freeIdx[numFree]=idx;
+    numFree++;
+
+    numTracks--;
+    last=numTracks;
+    if((size_t)slot!=last) {
+        copy(x+xDim*last,x+xDim*(last+1),x+xDim*slot);
+        copy(P+xDim2*last,P+xDim2*(last+1),P+xDim2*slot);
+        score[slot]=score[last];
+        ID[slot]=ID[last];
+        idx2Slot[(ID[slot]-1)%capacity]=(size_t)slot;
+    }
+
+    return true;
+}
+
+void TrackTableCPP::predict(const double *F,const bool FIsShared,const double *Q,const bool QIsShared,const double *u) {
+/*PREDICT Predict all of the tracks in the table forward using a linear
+ *        dynamic model. F and Q are either single matrices that are used
+ *        for all tracks or stacks of matrices, one per slot, depending on
+ *        FIsShared and QIsShared. u is either NULL (no control input) or
+ *        has one xDimX1 control input per slot. If the code is compiled
+ *        with OpenMP support, the tracks are predicted in parallel.
+ */
+    const size_t xDim2=xDim*xDim;
+
+    #pragma omp parallel
+    {
+        KalmanScratch workMem(xDim,0);
+        ptrdiff_t curSlot;
+
+        #pragma omp for
+        for(curSlot=0;curSlot<(ptrdiff_t)numTracks;curSlot++) {
+            const double *FCur=FIsShared?F:F+xDim2*(size_t)curSlot;
+            const double *QCur=QIsShared?Q:Q+xDim2*(size_t)curSlot;
+            const double *uCur=NULL;
+
+            if(u!=NULL) {
+                uCur=u+xDim*(size_t)curSlot;
+            }
+
+            DiscKalPredCPP(xWork+xDim*(size_t)curSlot,PWork+xDim2*(size_t)curSlot,x+xDim*(size_t)curSlot,P+xDim2*(size_t)curSlot,FCur,QCur,uCur,workMem);
+        }
+    }
+
+    swapWork();
+}
+
+void TrackTableCPP::swapWork() {
+/*SWAPWORK Make the values in xWork and PWork the states and covariance
+ *         matrices of the tracks. This is called after a routine that
+ *         cannot work in place has put the new states of the tracks in
+ *         xWork and PWork. The old values are left in xWork and PWork.
+ */
+    swap(x,xWork);
+    swap(P,PWork);
+}
+
+TrackTableCPP::~TrackTableCPP() {
+    delete[] buffer;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,757 @@
+/*BATCHLSLMCPP C++ functions for refining batch estimates of the states of
+ *             a target at every step of a batch of measurements under a
+ *             nonlinear measurement model and a linear or nonlinear
+ *             dynamic model with process noise using the Levenberg-
+ *             Marquardt algorithm.
+ *
+ *The batch estimation problem is the maximum likelihood problem with
+ *process noise of
+ *A. B. Poore, B. J. Slocumb, B. J. Suchomel, F. H. Obermeyer, S. M.
+ *Herman, and S. M. Gadaleta, "Batch maximum likelihood (ML) and maximum a
+ *posteriori (MAP) estimation with process noise for tracking
+ *applications," in Proceedings of SPIE: Signal and Data Processing of
+ *Small Targets, vol. 5204, San Diego, CA, 3 Aug. 2003, pp. 188-199.
+ *which is also solved by the Matlab function batchLSNonlinMeasLinDynLM.
+ *The cost function is
+ *sum_k (z_k-h(x_k))'*inv(R_k)*(z_k-h(x_k))
+ *+sum_k (x_{k+1}-F_k*x_k)'*inv(Q_k)*(x_{k+1}-F_k*x_k)
+ *where the states at all of the steps are estimated. The Levenberg-
+ *Marquardt iterations are the same as in the Matlab function
+ *LSEstLMarquardt, which implements Algorithm 3.16 of
+ *K. Madsen, H. B. Nielsen, and O. Tingleff, "Methods for non-linear
+ *least squares problems," Informatics and Mathematical Modelling,
+ *Technical University of Denmark, Tech. Rep., Apr. 2004.
+ *However, the Jacobian of the measurement model is computed analytically
+ *and the structure of the problem is exploited: the state at each step
+ *only interacts with the states at the adjacent steps, so the
+ *approximate Hessian J'*J is block-tridiagonal. The damped normal
+ *equations are solved by block Gaussian elimination with a Cholesky
+ *decomposition of the xDimXxDim Schur complement at each step. Thus, the
+ *computational complexity of an iteration is O(numSteps*xDim^3) rather
+ *than the O((numSteps*xDim)^3) of a dense solution. The covariance
+ *matrices of the estimates at each step, which are the diagonal blocks of
+ *the inverse of J'*J at the solution, are found with a backward recursion
+ *that is the same as in the Rauch-Tung-Striebel smoother.
+ *
+ *The dynamic model can also be nonlinear, given by a class derived from
+ *BatchLSDynamicsCPP, in which case F_k*x_k is replaced by the prediction
+ *f_k(x_k) of the state from the time of step k to that of step k+1 and
+ *Q_k can depend on x_k. Whenever the normal equations are formed, the
+ *model is relinearized about the current estimates: F_k becomes the
+ *Jacobian of f_k at x_k and Q_k is evaluated at x_k. For a continuous-time
+ *model, these are the state transition matrix and the accumulated process
+ *noise covariance matrix of the trajectory starting at x_k. The normal
+ *equations keep the same block-tridiagonal structure, so the cost of an
+ *iteration is still linear in the number of steps. The trial points of
+ *the Levenberg-Marquardt algorithm are evaluated with only the
+ *predictions f_k(x_k), keeping the Q_k of the last linearization, as is
+ *usual in Gauss-Newton methods where the dependence of the weighting on
+ *the state is neglected.
+ *
+ *The measurement models that are supported (measType) are those of the
+ *function measModelCPP in measModelCPP.cpp.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+**/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy and fill_n
+#include <algorithm>
+//For sqrt and fabs
+#include <math.h>
+//For DBL_EPSILON
+#include <float.h>
+//For quiet_NaN
+#include <limits>
+#include "matrixFuncs.hpp"
+#include "filterFuncs.hpp"
+
+using namespace std;
+
+static bool isFiniteVal(const double val);
+static double evalCost(const double *x,const double *z,const double *t,const BatchLSModelCPP &model,BatchLSScratch &workMem,const bool formNormalEq);
+static bool linearizeDyn(const double *x,const double *t,const BatchLSModelCPP &model,BatchLSScratch &workMem);
+static const double *getF(const size_t curStep,const BatchLSModelCPP &model,const BatchLSScratch &workMem);
+static const double *getQInv(const size_t curStep,const BatchLSModelCPP &model,const BatchLSScratch &workMem);
+static const double *getFTQInv(const size_t curStep,const BatchLSModelCPP &model,const BatchLSScratch &workMem);
+static const double *getFTQInvF(const size_t curStep,const BatchLSModelCPP &model,const BatchLSScratch &workMem);
+static bool solveForStep(double *h,const double mu,const BatchLSModelCPP &model,BatchLSScratch &workMem);
+static bool findCovariances(double *P,const BatchLSModelCPP &model,BatchLSScratch &workMem);
+
+BatchLSModelCPP::BatchLSModelCPP() {
+    buffer=NULL;
+    dyn=NULL;
+}
+
+bool BatchLSModelCPP::init(const size_t xDimDes,const size_t zDimDes,const size_t numStepsDes,const int measTypeDes,const double *measParamDes,const double *FIn,const bool FIsShared,const double *R,const bool RIsSharedDes,const double *Q,const bool QIsShared) {
+    const size_t xx=xDimDes*xDimDes;
+    size_t numDyn, curStep;
+    double *scratch;
+    bool retVal=true;
+
+    dyn=NULL;
+    dynIsShared=FIsShared&&QIsShared;
+    if(numStepsDes<2) {
+        numDyn=0;
+    } else {
+        numDyn=dynIsShared?1:numStepsDes-1;
+    }
+
+    if(!initMeas(xDimDes,zDimDes,numStepsDes,measTypeDes,measParamDes,R,RIsSharedDes,numDyn)) {
+        return false;
+    }
+
+    scratch=new double[xx];
+    for(curStep=0;curStep<numDyn;curStep++) {
+        const double *FCur=FIsShared?FIn:FIn+curStep*xx;
+        const double *QCur=QIsShared?Q:Q+curStep*xx;
+        double *QInvCur=QInvBuffer+curStep*xx;
+        double *FTQInvCur=FTQInvBuffer+curStep*xx;
+
+        if(!invSymPosDefCPP(QInvCur,scratch,QCur,xDim)) {
+            retVal=false;
+            break;
+        }
+
+        copy(FCur,FCur+xx,FBuffer+curStep*xx);
+        matMultATransBCPP(FTQInvCur,FCur,QInvCur,xDim,xDim,xDim);
+        matMultCPP(FTQInvFBuffer+curStep*xx,FTQInvCur,FCur,xDim,xDim,xDim);
+        symmetrizeCPP(FTQInvFBuffer+curStep*xx,xDim);
+    }
+
+    delete[] scratch;
+    return retVal;
+}
+
+bool BatchLSModelCPP::initNonlinDyn(const size_t xDimDes,const size_t zDimDes,const size_t numStepsDes,const int measTypeDes,const double *measParamDes,const BatchLSDynamicsCPP *dynDes,const double *R,const bool RIsSharedDes) {
+/*INITNONLINDYN Initialize the model with a nonlinear dynamic model, which
+ *              is linearized separately for each track.
+ */
+    dyn=dynDes;
+    dynIsShared=false;
+
+    return initMeas(xDimDes,zDimDes,numStepsDes,measTypeDes,measParamDes,R,RIsSharedDes,0);
+}
+
+bool BatchLSModelCPP::initMeas(const size_t xDimDes,const size_t zDimDes,const size_t numStepsDes,const int measTypeDes,const double *measParamDes,const double *R,const bool RIsSharedDes,const size_t numDyn) {
+/*INITMEAS Set the dimensions and the measurement model and allocate space
+ *         for numDyn linear dynamic models.
+ */
+    const size_t xx=xDimDes*xDimDes;
+    size_t numR, i, curStep;
+    char *basePtr;
+    double *scratch;
+    bool retVal=true;
+
+    if(buffer!=NULL) {
+        delete[] buffer;
+        buffer=NULL;
+    }
+
+    xDim=xDimDes;
+    zDim=zDimDes;
+    numSteps=numStepsDes;
+    measType=measTypeDes;
+    measParam=measParamDes;
+    RIsShared=RIsSharedDes;
+
+    numR=RIsShared?1:numSteps;
+
+    buffer=new char[(numR*zDim*zDim+4*numDyn*xx)*sizeof(double)];
+    basePtr=buffer;
+    RInvCholBuffer=(double*)basePtr;
+    basePtr+=sizeof(double)*numR*zDim*zDim;
+    QInvBuffer=(double*)basePtr;
+    basePtr+=sizeof(double)*numDyn*xx;
+    FTQInvBuffer=(double*)basePtr;
+    basePtr+=sizeof(double)*numDyn*xx;
+    FTQInvFBuffer=(double*)basePtr;
+    basePtr+=sizeof(double)*numDyn*xx;
+    FBuffer=(double*)basePtr;
+
+    scratch=new double[zDim*zDim];
+
+    //The measurement residuals are whitened by multiplying them by the
+    //inverse of the lower-triangular Cholesky decomposition of R.
+    for(curStep=0;curStep<numR;curStep++) {
+        double *RInvCur=RInvCholBuffer+curStep*zDim*zDim;
+
+        if(!cholLowerCPP(scratch,R+curStep*zDim*zDim,zDim)) {
+            retVal=false;
+            break;
+        }
+
+        fill_n(RInvCur,zDim*zDim,0.0);
+        for(i=0;i<zDim;i++) {
+            RInvCur[i+i*zDim]=1;
+        }
+        forwardSubstCPP(RInvCur,scratch,zDim,zDim);
+    }
+
+    delete[] scratch;
+    return retVal;
+}
+
+void BatchLSModelCPP::measFunc(double *zPred,double *H,const double *x) const {
+/*MEASFUNC Evaluate the measurement function h(x) and its zDimXxDim
+ *         Jacobian matrix H.
+ */
+    measModelCPP(zPred,H,x,xDim,zDim,measType,measParam);
+}
+
+void BatchLSModelCPP::wrapResidual(double *r) const {
+/*WRAPRESIDUAL Wrap the azimuthal component of a measurement residual to
+ *             the range [-pi,pi) for the nonlinear measurement models.
+ */
+    wrapMeasResidualCPP(r,measType);
+}
+
+const double *BatchLSModelCPP::RInvChol(const size_t curStep) const {
+    return RIsShared?RInvCholBuffer:RInvCholBuffer+curStep*zDim*zDim;
+}
+
+const double *BatchLSModelCPP::QInv(const size_t curStep) const {
+    return dynIsShared?QInvBuffer:QInvBuffer+curStep*xDim*xDim;
+}
+
+const double *BatchLSModelCPP::FTQInv(const size_t curStep) const {
+    return dynIsShared?FTQInvBuffer:FTQInvBuffer+curStep*xDim*xDim;
+}
+
+const double *BatchLSModelCPP::FTQInvF(const size_t curStep) const {
+    return dynIsShared?FTQInvFBuffer:FTQInvFBuffer+curStep*xDim*xDim;
+}
+
+const double *BatchLSModelCPP::F(const size_t curStep) const {
+    return dynIsShared?FBuffer:FBuffer+curStep*xDim*xDim;
+}
+
+BatchLSModelCPP::~BatchLSModelCPP() {
+    if(buffer!=NULL) {
+        delete[] buffer;
+    }
+}
+
+int batchLSLMCPP(double *x,double *P,size_t *numIter,const double *z,const double *t,const BatchLSModelCPP &model,const double TolG,const double TolX,const size_t maxIter,const size_t maxTries,BatchLSScratch &workMem) {
+/*BATCHLSLMCPP Refine the batch state estimates in x using the
+ *             Levenberg-Marquardt algorithm. The inputs are
+ *             x     The xDimXnumSteps initial estimates of the states at
+ *                   each step. This is replaced by the refined estimates.
+ *             P     Space for xDimXxDimXnumSteps covariance matrices, or
+ *                   NULL if the covariance matrices are not desired.
+ *           numIter The number of iterations performed is put here.
+ *             z     The zDimXnumSteps measurements. Measurements containing
+ *                   NaN values are treated as missing.
+ *             t     The numSteps times of the steps for a nonlinear dynamic
+ *                   model. This can be NULL for a linear model.
+ *       model, TolG, TolX, maxIter, maxTries The models and the
+ *                   parameters of the algorithm, as in the Matlab function
+ *                   LSEstLMarquardt.
+ *         workMem   The scratch space initialized with the model.
+ *The return value is an exit code with the same meaning as in the Matlab
+ *function LSEstLMarquardt. With a nonlinear dynamic model, -2 is also
+ *returned if the dynamic model cannot be evaluated or a process noise
+ *covariance matrix is not positive definite.
+ */
+    const size_t totalDim=model.xDim*model.numSteps;
+    const size_t xx=model.xDim*model.xDim;
+    //Default value of tau as suggested on page 25 of Madsen et al. for a
+    //mediocre initial estimate.
+    const double tau=1e-3;
+    double *g=workMem.g;
+    double *h=workMem.h;
+    double *xNew=workMem.xNew;
+    double cost, mu, nu, maxDiag, maxG;
+    size_t i, curStep, curIter;
+    int exitCode=0;
+
+    *numIter=0;
+    cost=evalCost(x,z,t,model,workMem,true);
+    if(!isFiniteVal(cost)) {
+        return -2;
+    }
+
+    maxDiag=0;
+    for(curStep=0;curStep<model.numSteps;curStep++) {
+        const double *DCur=workMem.D+curStep*xx;
+
+        for(i=0;i<model.xDim;i++) {
+            maxDiag=max(maxDiag,DCur[i+i*model.xDim]);
+        }
+    }
+    mu=tau*maxDiag;
+    nu=2;
+
+    maxG=0;
+    for(i=0;i<totalDim;i++) {
+        maxG=max(maxG,fabs(g[i]));
+    }
+
+    if(maxG<=TolG) {
+        exitCode=1;
+    }
+
+    for(curIter=0;curIter<maxIter&&exitCode==0;curIter++) {
+        double normH, normX, costNew, deltaF, deltaL;
+        size_t curTry;
+        bool foundMu=false;
+
+        *numIter=curIter+1;
+
+        //Solve (A+mu*I)*h=-g, increasing mu if the damped matrix is not
+        //positive definite.
+        for(curTry=0;curTry<maxTries;curTry++) {
+            if(mu>0&&solveForStep(h,mu,model,workMem)) {
+                foundMu=true;
+                break;
+            }
+            mu=max(10*mu,DBL_EPSILON*maxDiag);
+            if(mu==0) {
+                mu=DBL_EPSILON;
+            }
+        }
+
+        if(!foundMu) {
+            return -1;
+        }
+
+        normH=0;
+        normX=0;
+        for(i=0;i<totalDim;i++) {
+            normH+=h[i]*h[i];
+            normX+=x[i]*x[i];
+        }
+        normH=sqrt(normH);
+        normX=sqrt(normX);
+
+        if(normH<=TolX*(normX+TolX)) {
+            exitCode=2;
+            break;
+        }
+
+        for(i=0;i<totalDim;i++) {
+            xNew[i]=x[i]+h[i];
+        }
+
+        costNew=evalCost(xNew,z,t,model,workMem,false);
+        if(!isFiniteVal(costNew)) {
+            return -2;
+        }
+
+        //The costs here are f'*f rather than (1/2)*f'*f.
+        deltaF=(cost-costNew)/2;
+        deltaL=0;
+        for(i=0;i<totalDim;i++) {
+            deltaL+=h[i]*(mu*h[i]-g[i]);
+        }
+        deltaL/=2;
+
+        if(deltaF>0&&deltaL>0) {
+            const double rho=deltaF/deltaL;
+            const double temp=2*rho-1;
+
+            copy(xNew,xNew+totalDim,x);
+            cost=evalCost(x,z,t,model,workMem,true);
+            if(!isFiniteVal(cost)) {
+                return -2;
+            }
+
+            maxG=0;
+            maxDiag=0;
+            for(i=0;i<totalDim;i++) {
+                maxG=max(maxG,fabs(g[i]));
+            }
+            for(curStep=0;curStep<model.numSteps;curStep++) {
+                const double *DCur=workMem.D+curStep*xx;
+
+                for(i=0;i<model.xDim;i++) {
+                    maxDiag=max(maxDiag,DCur[i+i*model.xDim]);
+                }
+            }
+
+            if(maxG<=TolG) {
+                exitCode=1;
+                break;
+            }
+
+            //The 1/9 is an arbitrary factor to shrink the mu parameter.
+            mu=mu*max(1.0/9.0,1-temp*temp*temp);
+            nu=2;
+        } else {
+            mu=mu*nu;
+            nu=2*nu;
+        }
+
+        if(!isFiniteVal(mu)||!isFiniteVal(nu)) {
+            return -2;
+        }
+    }
+
+    //The normal equations in workMem are those at the current value of x.
+    if(P!=NULL&&!findCovariances(P,model,workMem)) {
+        fill_n(P,xx*model.numSteps,numeric_limits<double>::quiet_NaN());
+    }
+
+    return exitCode;
+}
+
+static double evalCost(const double *x,const double *z,const double *t,const BatchLSModelCPP &model,BatchLSScratch &workMem,const bool formNormalEq) {
+/*EVALCOST Compute the cost function f'*f at the batch of states x. If
+ *         formNormalEq is true, then the diagonal blocks of the normal
+ *         equations J'*J and the gradient J'*f are also computed and
+ *         placed in workMem.D and workMem.g. The off-diagonal blocks only
+ *         depend on the dynamic model and are taken from the model when
+ *         needed. A nonlinear dynamic model is relinearized about x if
+ *         formNormalEq is true. NaN is returned if that fails.
+ */
+    const size_t xDim=model.xDim;
+    const size_t zDim=model.zDim;
+    const size_t xx=xDim*xDim;
+    double *zPred=workMem.zTemp1;
+    double *fw=workMem.zTemp2;
+    double *H=workMem.zxTemp1;
+    double *Hw=workMem.zxTemp2;
+    double *e=workMem.xTemp;
+    double cost=0;
+    size_t i, j, curStep;
+
+    if(formNormalEq) {
+        fill_n(workMem.D,model.numSteps*xx,0.0);
+        fill_n(workMem.g,model.numSteps*xDim,0.0);
+    }
+
+    //The measurement terms.
+    for(curStep=0;curStep<model.numSteps;curStep++) {
+        const double *xCur=x+curStep*xDim;
+        const double *zCur=z+curStep*zDim;
+        const double *RInvChol=model.RInvChol(curStep);
+        bool isMissing=false;
+
+        for(i=0;i<zDim;i++) {
+            if(zCur[i]!=zCur[i]) {
+                isMissing=true;
+                break;
+            }
+        }
+        if(isMissing) {
+            continue;
+        }
+
+        model.measFunc(zPred,H,xCur);
+        for(i=0;i<zDim;i++) {
+            zPred[i]=zPred[i]-zCur[i];
+        }
+        model.wrapResidual(zPred);
+
+        //Whiten the residual.
+        matVecMultCPP(fw,RInvChol,zPred,zDim,zDim);
+        for(i=0;i<zDim;i++) {
+            cost+=fw[i]*fw[i];
+        }
+
+        if(formNormalEq) {
+            double *DCur=workMem.D+curStep*xx;
+            double *gCur=workMem.g+curStep*xDim;
+
+            matMultCPP(Hw,RInvChol,H,zDim,zDim,xDim);
+            matMultATransBCPP(workMem.xxTemp,Hw,Hw,xDim,zDim,xDim);
+            for(i=0;i<xx;i++) {
+                DCur[i]+=workMem.xxTemp[i];
+            }
+            matTransVecMultCPP(e,Hw,fw,xDim,zDim);
+            for(i=0;i<xDim;i++) {
+                gCur[i]+=e[i];
+            }
+        }
+    }
+
+    //The dynamic model terms. A nonlinear model is linearized, or the
+    //states are just predicted to the next steps for trial points.
+    if(model.dyn!=NULL) {
+        if(formNormalEq) {
+            if(!linearizeDyn(x,t,model,workMem)) {
+                return numeric_limits<double>::quiet_NaN();
+            }
+        } else {
+            for(curStep=0;curStep+1<model.numSteps;curStep++) {
+                if(workMem.dyn->predict(workMem.xPred+curStep*xDim,x+curStep*xDim,t[curStep],t[curStep+1])!=0) {
+                    return numeric_limits<double>::quiet_NaN();
+                }
+            }
+        }
+    }
+
+    for(curStep=0;curStep+1<model.numSteps;curStep++) {
+        const double *xNext=x+(curStep+1)*xDim;
+        const double *QInv=getQInv(curStep,model,workMem);
+        double *QInvE=workMem.xTemp2;
+
+        //e=x_{k+1}-F_k*x_k or x_{k+1}-f_k(x_k)
+        if(model.dyn==NULL) {
+            matVecMultCPP(e,model.F(curStep),x+curStep*xDim,xDim,xDim);
+        } else {
+            copy(workMem.xPred+curStep*xDim,workMem.xPred+(curStep+1)*xDim,e);
+        }
+        for(i=0;i<xDim;i++) {
+            e[i]=xNext[i]-e[i];
+        }
+        matVecMultCPP(QInvE,QInv,e,xDim,xDim);
+        for(i=0;i<xDim;i++) {
+            cost+=e[i]*QInvE[i];
+        }
+
+        if(formNormalEq) {
+            const double *FTQInvF=getFTQInvF(curStep,model,workMem);
+            double *DCur=workMem.D+curStep*xx;
+            double *DNext=workMem.D+(curStep+1)*xx;
+            double *gCur=workMem.g+curStep*xDim;
+            double *gNext=workMem.g+(curStep+1)*xDim;
+
+            for(i=0;i<xx;i++) {
+                DCur[i]+=FTQInvF[i];
+                DNext[i]+=QInv[i];
+            }
+
+            //The gradient terms are -F'*inv(Q)*e and inv(Q)*e.
+            matTransVecMultCPP(e,getF(curStep,model,workMem),QInvE,xDim,xDim);
+            for(j=0;j<xDim;j++) {
+                gCur[j]-=e[j];
+                gNext[j]+=QInvE[j];
+            }
+        }
+    }
+
+    return cost;
+}
+
+static bool solveForStep(double *h,const double mu,const BatchLSModelCPP &model,BatchLSScratch &workMem) {
+/*SOLVEFORSTEP Solve (A+mu*I)*h=-g where A is the block-tridiagonal matrix
+ *             J'*J using block Gaussian elimination. The diagonal blocks
+ *             of A are in workMem.D and the off-diagonal blocks are
+ *             A_{k,k+1}=-F_k'*inv(Q_k). The return value is false if the
+ *             damped matrix is not numerically positive definite.
+ */
+    const size_t xDim=model.xDim;
+    const size_t xx=xDim*xDim;
+    const size_t numSteps=model.numSteps;
+    double *S=workMem.xxTemp;
+    double *w=workMem.w;
+    double maxLDiag=0, minLDiag=0;
+    size_t i, curStep;
+
+    //Forward elimination. The Schur complements are
+    //S_1=D_1+mu*I and
+    //S_{k+1}=D_{k+1}+mu*I-A_{k+1,k}*inv(S_k)*A_{k,k+1}.
+    //T_k=inv(S_k)*F_k'*inv(Q_k) and w_k=inv(S_k)*y_k, where y_k is the
+    //eliminated right-hand side.
+    for(curStep=0;curStep<numSteps;curStep++) {
+        const double *DCur=workMem.D+curStep*xx;
+        double *LCur=workMem.L+curStep*xx;
+        double *wCur=w+curStep*xDim;
+        const double *gCur=workMem.g+curStep*xDim;
+
+        copy(DCur,DCur+xx,S);
+        for(i=0;i<xDim;i++) {
+            S[i+i*xDim]+=mu;
+            wCur[i]=-gCur[i];
+        }
+
+        if(curStep>0) {
+            const double *FTQInvPrev=getFTQInv(curStep-1,model,workMem);
+            const double *TPrev=workMem.T+(curStep-1)*xx;
+            const double *wPrev=w+(curStep-1)*xDim;
+            size_t j, k;
+
+            //S-=FTQInv'*TPrev and wCur+=FTQInv'*wPrev
+            for(j=0;j<xDim;j++) {
+                for(i=0;i<xDim;i++) {
+                    double sum=0;
+
+                    for(k=0;k<xDim;k++) {
+                        sum+=FTQInvPrev[k+i*xDim]*TPrev[k+j*xDim];
+                    }
+                    S[i+j*xDim]-=sum;
+                }
+            }
+            for(i=0;i<xDim;i++) {
+                double sum=0;
+
+                for(k=0;k<xDim;k++) {
+                    sum+=FTQInvPrev[k+i*xDim]*wPrev[k];
+                }
+                wCur[i]+=sum;
+            }
+        }
+        symmetrizeCPP(S,xDim);
+
+        if(!cholLowerCPP(LCur,S,xDim)) {
+            return false;
+        }
+        for(i=0;i<xDim;i++) {
+            const double diagVal=LCur[i+i*xDim];
+
+            if(curStep==0&&i==0) {
+                maxLDiag=diagVal;
+                minLDiag=diagVal;
+            } else {
+                maxLDiag=max(maxLDiag,diagVal);
+                minLDiag=min(minLDiag,diagVal);
+            }
+        }
+
+        cholSolveCPP(wCur,LCur,xDim,1);
+        if(curStep+1<numSteps) {
+            const double *FTQInvCur=getFTQInv(curStep,model,workMem);
+            double *TCur=workMem.T+curStep*xx;
+
+            copy(FTQInvCur,FTQInvCur+xx,TCur);
+            cholSolveCPP(TCur,LCur,xDim,xDim);
+        }
+    }
+
+    //Reject nearly singular systems in the same manner as the rcond test
+    //in LSEstLMarquardt.
+    if(!(minLDiag*minLDiag>DBL_EPSILON*maxLDiag*maxLDiag)) {
+        return false;
+    }
+
+    //Back substitution: h_N=w_N and h_k=w_k+T_k*h_{k+1}.
+    copy(w+(numSteps-1)*xDim,w+numSteps*xDim,h+(numSteps-1)*xDim);
+    for(curStep=numSteps-1;curStep-->0;) {
+        double *hCur=h+curStep*xDim;
+
+        matVecMultCPP(hCur,workMem.T+curStep*xx,h+(curStep+1)*xDim,xDim,xDim);
+        for(i=0;i<xDim;i++) {
+            hCur[i]+=w[i+curStep*xDim];
+            if(!isFiniteVal(hCur[i])) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+static bool findCovariances(double *P,const BatchLSModelCPP &model,BatchLSScratch &workMem) {
+/*FINDCOVARIANCES Compute the diagonal blocks of the inverse of the
+ *                block-tridiagonal matrix J'*J in workMem, which are the
+ *                covariance matrices of the estimates at each step. With
+ *                S_k and T_k as in solveForStep with mu=0, the blocks are
+ *                P_N=inv(S_N) and P_k=inv(S_k)+T_k*P_{k+1}*T_k'. The
+ *                return value is false if J'*J is singular.
+ */
+    const size_t xDim=model.xDim;
+    const size_t xx=xDim*xDim;
+    const size_t numSteps=model.numSteps;
+    double *temp=workMem.xxTemp;
+    size_t i, curStep;
+
+    //The gradient is not needed anymore, so it can be overwritten by the
+    //step found with no damping.
+    if(!solveForStep(workMem.h,0,model,workMem)) {
+        return false;
+    }
+
+    for(curStep=numSteps;curStep-->0;) {
+        double *PCur=P+curStep*xx;
+
+        fill_n(PCur,xx,0.0);
+        for(i=0;i<xDim;i++) {
+            PCur[i+i*xDim]=1;
+        }
+        cholSolveCPP(PCur,workMem.L+curStep*xx,xDim,xDim);
+
+        if(curStep+1<numSteps) {
+            const double *TCur=workMem.T+curStep*xx;
+
+            matMultCPP(temp,TCur,P+(curStep+1)*xx,xDim,xDim,xDim);
+            matMultABTransCPP(workMem.D+curStep*xx,temp,TCur,xDim,xDim,xDim);
+            for(i=0;i<xx;i++) {
+                PCur[i]+=workMem.D[i+curStep*xx];
+            }
+        }
+        symmetrizeCPP(PCur,xDim);
+    }
+
+    return true;
+}
+
+static bool linearizeDyn(const double *x,const double *t,const BatchLSModelCPP &model,BatchLSScratch &workMem) {
+/*LINEARIZEDYN Linearize the nonlinear dynamic model about the batch of
+ *             states x, putting the predicted states and the quantities
+ *             derived from the state transition and process noise
+ *             covariance matrices of each step into workMem. The return
+ *             value is false if the dynamic model could not be evaluated
+ *             or a process noise covariance matrix is not positive
+ *             definite.
+ */
+    const size_t xDim=model.xDim;
+    const size_t xx=xDim*xDim;
+    double *Q=workMem.QTemp;
+    double *scratch=workMem.QTemp+xx;
+    size_t curStep;
+
+    for(curStep=0;curStep+1<model.numSteps;curStep++) {
+        double *FCur=workMem.FDyn+curStep*xx;
+        double *QInvCur=workMem.QInvDyn+curStep*xx;
+        double *FTQInvCur=workMem.FTQInvDyn+curStep*xx;
+        double *FTQInvFCur=workMem.FTQInvFDyn+curStep*xx;
+
+        if(workMem.dyn->linearize(workMem.xPred+curStep*xDim,FCur,Q,x+curStep*xDim,t[curStep],t[curStep+1])!=0) {
+            return false;
+        }
+
+        if(!invSymPosDefCPP(QInvCur,scratch,Q,xDim)) {
+            return false;
+        }
+
+        matMultATransBCPP(FTQInvCur,FCur,QInvCur,xDim,xDim,xDim);
+        matMultCPP(FTQInvFCur,FTQInvCur,FCur,xDim,xDim,xDim);
+        symmetrizeCPP(FTQInvFCur,xDim);
+    }
+
+    return true;
+}
+
+static const double *getF(const size_t curStep,const BatchLSModelCPP &model,const BatchLSScratch &workMem) {
+//GETF The state transition matrix of the dynamic model of the given step,
+//     which is either from a linear model or from the last linearization.
+    return model.dyn==NULL?model.F(curStep):workMem.FDyn+curStep*model.xDim*model.xDim;
+}
+
+static const double *getQInv(const size_t curStep,const BatchLSModelCPP &model,const BatchLSScratch &workMem) {
+    return model.dyn==NULL?model.QInv(curStep):workMem.QInvDyn+curStep*model.xDim*model.xDim;
+}
+
+static const double *getFTQInv(const size_t curStep,const BatchLSModelCPP &model,const BatchLSScratch &workMem) {
+    return model.dyn==NULL?model.FTQInv(curStep):workMem.FTQInvDyn+curStep*model.xDim*model.xDim;
+}
+
+static const double *getFTQInvF(const size_t curStep,const BatchLSModelCPP &model,const BatchLSScratch &workMem) {
+    return model.dyn==NULL?model.FTQInvF(curStep):workMem.FTQInvFDyn+curStep*model.xDim*model.xDim;
+}
+
+static bool isFiniteVal(const double val) {
+//ISFINITEVAL This is false for NaN and infinite values. It is used
+//            instead of isfinite, which is not available with all
+//            compilers.
+    return (val-val)==0;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
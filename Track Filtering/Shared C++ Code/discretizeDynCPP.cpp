@@ -0,0 +1,159 @@
+/*DISCRETIZEDYNCPP A C++ implementation of the linearization of a
+ *                 continuous-time dynamic model over an interval, which
+ *                 gives the discrete-time state transition matrix and the
+ *                 process noise covariance matrix about a trajectory.
+ *
+ *The dynamic model is the stochastic differential equation
+ *dx/dt=a(x,t)+D*w(t)
+ *where w is white noise with unit power spectral density and D is
+ *constant. Linearizing about the trajectory x(t) that starts at x(t0)=x0,
+ *the state at time t1 is x(t1)+F*dx0 plus noise with covariance matrix Q,
+ *where dx0 is a deviation of the initial state. F and Q are found by
+ *integrating
+ *dx/dt=a(x,t)
+ *dF/dt=A(x,t)*F
+ *dQ/dt=A(x,t)*Q+Q*A(x,t)'+D*D'
+ *together from F=I and Q=0, where A(x,t) is the Jacobian of the drift
+ *function a(x,t). The equation for F is the variational equation of the
+ *trajectory and the equation for Q is the same as the covariance equation
+ *of the continuous-discrete extended Kalman filter in CDEKFPredCPP.cpp.
+ *As there, only the upper triangle of Q is integrated, packed by column.
+ *
+ *The ContTimeBatchLSDynamicsCPP class wraps this linearization for use by
+ *the batch least squares routine batchLSLMCPP.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+**/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy and fill_n
+#include <algorithm>
+#include "filterFuncs.hpp"
+#include "matrixFuncs.hpp"
+
+using namespace std;
+
+DiscretizedDynamicsCPP::DiscretizedDynamicsCPP(const ODEDynamicsCPP *driftDes,const double *DDTDes) : ODEDynamicsCPP(driftDes->xDim+driftDes->xDim*driftDes->xDim+driftDes->xDim*(driftDes->xDim+1)/2) {
+    const size_t n=driftDes->xDim;
+    char *basePtr;
+
+    stateDim=n;
+    drift=driftDes;
+    DDT=DDTDes;
+
+    buffer=new char[sizeof(double)*(3*n*n+4*n+2*xDim)];
+    basePtr=buffer;
+    J=(double*)basePtr;
+    basePtr+=sizeof(double)*n*n;
+    QFull=(double*)basePtr;
+    basePtr+=sizeof(double)*n*n;
+    JQ=(double*)basePtr;
+    basePtr+=sizeof(double)*n*n;
+    dfdt=(double*)basePtr;
+    basePtr+=sizeof(double)*n;
+    jacobScratch=(double*)basePtr;
+    basePtr+=sizeof(double)*3*n;
+    xAugStart=(double*)basePtr;
+    basePtr+=sizeof(double)*xDim;
+    xAugEnd=(double*)basePtr;
+}
+
+DiscretizedDynamicsCPP::~DiscretizedDynamicsCPP() {
+    delete[] buffer;
+}
+
+void DiscretizedDynamicsCPP::f(double *dxdt,const double *x,const double t) const {
+    const size_t n=stateDim;
+    const double *F=x+n;
+    const double *QPacked=x+n+n*n;
+    double *dQPacked=dxdt+n+n*n;
+    size_t i, j;
+
+    drift->f(dxdt,x,t);
+    drift->jacobian(J,dfdt,x,t,jacobScratch);
+
+    //dF/dt=J*F
+    matMultCPP(dxdt+n,J,F,n,n,n);
+
+    //Unpack Q.
+    for(j=0;j<n;j++) {
+        const double *QCol=QPacked+j*(j+1)/2;
+
+        for(i=0;i<=j;i++) {
+            QFull[i+j*n]=QCol[i];
+            QFull[j+i*n]=QCol[i];
+        }
+    }
+
+    //dQ/dt=J*Q+(J*Q)'+D*D', of which only the upper triangle is computed.
+    matMultCPP(JQ,J,QFull,n,n,n);
+    for(j=0;j<n;j++) {
+        double *dQCol=dQPacked+j*(j+1)/2;
+
+        for(i=0;i<=j;i++) {
+            dQCol[i]=JQ[i+j*n]+JQ[j+i*n]+DDT[i+j*n];
+        }
+    }
+}
+
+int DiscretizedDynamicsCPP::discretize(double *xEnd,double *F,double *Q,const double *xStart,const double tStart,const double tEnd,const ODEIntParamCPP &param,ODEScratchCPP &workMem) {
+    const size_t n=stateDim;
+    size_t i, j, numSteps;
+    int exitCode;
+
+    //The initial conditions are F=I and Q=0.
+    copy(xStart,xStart+n,xAugStart);
+    fill_n(xAugStart+n,xDim-n,0.0);
+    for(i=0;i<n;i++) {
+        xAugStart[n+i+i*n]=1;
+    }
+
+    exitCode=ODEAdaptiveAtTimesCPP(xAugEnd,&numSteps,*this,xAugStart,tStart,&tEnd,1,param,workMem);
+
+    copy(xAugEnd,xAugEnd+n,xEnd);
+    copy(xAugEnd+n,xAugEnd+n+n*n,F);
+    for(j=0;j<n;j++) {
+        const double *QCol=xAugEnd+n+n*n+j*(j+1)/2;
+
+        for(i=0;i<=j;i++) {
+            Q[i+j*n]=QCol[i];
+            Q[j+i*n]=QCol[i];
+        }
+    }
+
+    return exitCode;
+}
+
+ContTimeBatchLSDynamicsCPP::ContTimeBatchLSDynamicsCPP(const ODEDynamicsCPP *driftDes,const double *DDTDes,const ODEIntParamCPP &paramDes) : BatchLSDynamicsCPP(driftDes->xDim), drift(driftDes), DDT(DDTDes), param(paramDes), discDyn(driftDes,DDTDes), discMem(discDyn.xDim), stateMem(driftDes->xDim) {}
+
+int ContTimeBatchLSDynamicsCPP::predict(double *xPred,const double *x,const double tStart,const double tEnd) {
+    size_t numSteps;
+
+    return ODEAdaptiveAtTimesCPP(xPred,&numSteps,*drift,x,tStart,&tEnd,1,param,stateMem);
+}
+
+int ContTimeBatchLSDynamicsCPP::linearize(double *xPred,double *F,double *Q,const double *x,const double tStart,const double tEnd) {
+    return discDyn.discretize(xPred,F,Q,x,tStart,tEnd,param,discMem);
+}
+
+BatchLSDynamicsCPP *ContTimeBatchLSDynamicsCPP::clone() const {
+    return new ContTimeBatchLSDynamicsCPP(drift,DDT,param);
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,700 @@
+/**FILTERFUNCS A header file for C++ implementations of the linear Kalman
+ *             filter prediction and update steps, classes that use them
+ *             to filter and smooth batches of tracks, a table for storing
+ *             a changing set of tracks, batch least squares estimation
+ *             of the states of tracks and the continuous-discrete
+ *             extended Kalman filter prediction. See the files
+ *             implementing each function for more details on their
+ *             usage.
+ *
+ *All matrices are stored by column, as in Matlab. The functions here do
+ *not allocate memory; the scratch space they need is held in an instance
+ *of the KalmanScratch class so that repeated calls, such as when
+ *processing many tracks in a loop, do not repeatedly allocate and free
+ *memory. When processing tracks in parallel, each thread must use its own
+ *KalmanScratch instance.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef FILTERFUNCSCPP
+#define FILTERFUNCSCPP
+#include <stddef.h>
+#include "ODEFuncs.hpp"
+
+/* The KalmanScratch class holds the scratch space for the Kalman filter
+ * prediction, update and smoothing routines so as to reduce the number of
+ * memory allocation and deallocation operations that are necessary when
+ * the routines are called repeatedly.
+ */
+class KalmanScratch {
+public:
+    char *buffer;
+    size_t xDim;
+    size_t zDim;
+    //Vectors of length xDim
+    double *xTemp;
+    double *xTemp2;
+    //Matrices of size xDimXxDim
+    double *xxTemp1;
+    double *xxTemp2;
+    double *xxTemp3;
+    //Matrices of size xDimXzDim
+    double *xzTemp1;
+    double *xzTemp2;
+    //Matrices of size zDimXzDim
+    double *zzTemp1;
+    double *zzTemp2;
+    //Vector of length zDim
+    double *zTemp;
+    //Pivot indices of length xDim
+    size_t *pivot;
+
+    KalmanScratch(){
+        buffer=NULL;
+    }
+
+    KalmanScratch(const size_t xDimDes,const size_t zDimDes){
+        buffer=NULL;
+        this->init(xDimDes,zDimDes);
+    }
+
+    void init(const size_t xDimDes,const size_t zDimDes){
+        char *basePtr;
+        const size_t numDoubles=2*xDimDes+3*xDimDes*xDimDes+2*xDimDes*zDimDes+2*zDimDes*zDimDes+zDimDes;
+
+        if(buffer!=NULL) {
+            delete[] buffer;
+        }
+
+        xDim=xDimDes;
+        zDim=zDimDes;
+    /*To minimize the number of calls to memory allocation and deallocation
+     * routines, a big chunk of memory is allocated at once and pointers
+     * to parts of it for the different variables are saved.*/
+        buffer=new char[numDoubles*sizeof(double)+xDim*sizeof(size_t)];
+        basePtr=buffer;
+        xTemp=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim;
+        xTemp2=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim;
+        xxTemp1=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim*xDim;
+        xxTemp2=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim*xDim;
+        xxTemp3=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim*xDim;
+        xzTemp1=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim*zDim;
+        xzTemp2=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim*zDim;
+        zzTemp1=(double*)basePtr;
+        basePtr+=sizeof(double)*zDim*zDim;
+        zzTemp2=(double*)basePtr;
+        basePtr+=sizeof(double)*zDim*zDim;
+        zTemp=(double*)basePtr;
+        basePtr+=sizeof(double)*zDim;
+        pivot=(size_t*)basePtr;
+    }
+
+    ~KalmanScratch(){
+        if(buffer!=NULL) {
+            delete[] buffer;
+        }
+    }
+private:
+    //Copying is not allowed, because the buffer would be freed twice.
+    KalmanScratch(const KalmanScratch &);
+    KalmanScratch &operator=(const KalmanScratch &);
+};
+
+bool KalmanUpdateCPP(double *xUpdate,
+                     double *PUpdate,
+                     double *innov,
+                     double *Pzz,
+                     const double *xPred,
+                     const double *PPred,
+                     const double *z,
+                     const double *R,
+                     const double *H,
+                     KalmanScratch &workMem);
+/*KALMANUPDATECPP Perform the measurement update step of the standard
+ *                linear Kalman filter using the Joseph-form covariance
+ *                update. This is the same as the Matlab function
+ *                KalmanUpdate. The dimensionalities are taken from
+ *                workMem. innov and Pzz can be NULL if they are not
+ *                desired. The return value is false if the innovation
+ *                covariance matrix is not positive definite.
+ */
+
+void DiscKalPredCPP(double *xPred,
+                    double *PPred,
+                    const double *xPrev,
+                    const double *PPrev,
+                    const double *F,
+                    const double *Q,
+                    const double *u,
+                    KalmanScratch &workMem);
+/*DISCKALPREDCPP Perform the discrete-time prediction step of the standard
+ *               linear Kalman filter. This is the same as the Matlab
+ *               function DiscKalPred. u can be NULL if there is no control
+ *               input.
+ */
+
+/**The FixedLagSmootherCPP class runs a linear Kalman filter on a batch of
+ * synchronously updated tracks and provides smoothed estimates a fixed
+ * number of steps in the past. Only the last lag+1 filtered and predicted
+ * states and covariance matrices of each track are retained, so the
+ * memory used does not grow with the length of the tracks. The stored
+ * steps are also used to update the current estimates with
+ * out-of-sequence measurements. See the file FixedLagSmootherCPP.cpp for
+ * more details.
+ **/
+class FixedLagSmootherCPP {
+public:
+    size_t xDim;
+    size_t numTracks;
+    size_t lag;
+    //The number of measurement updates that have been performed.
+    size_t numUpdates;
+    //The number of steps for which smoothed estimates have been produced.
+    size_t numSmoothed;
+    //True if the most recent operation was a prediction (or if the
+    //smoother was just created), so that an update is the next operation.
+    bool predPending;
+
+    FixedLagSmootherCPP(const size_t xDimDes,const size_t numTracksDes,const size_t lagDes,const double *xInit,const double *PInit,const bool PInitIsShared);
+    bool update(double *xSmooth,double *PSmooth,bool *updateFailed,const double *z,const size_t zDim,const double *H,const bool HIsShared,const double *R,const bool RIsShared);
+    bool OOSMUpdate(bool *updateFailed,const double *z,const size_t zDim,const double *H,const bool HIsShared,const double *R,const bool RIsShared,const size_t numStepsBack,const double *F1,const bool F1IsShared,const double *Q1,const bool Q1IsShared,const double *F2,const bool F2IsShared);
+    bool predict(bool *predFailed,const double *F,const bool FIsShared,const double *Q,const bool QIsShared,const double *u);
+    size_t flush(double *xSmooth,double *PSmooth);
+    size_t numUnsmoothed() const;
+    bool nextUpdateHasOutput() const;
+    ~FixedLagSmootherCPP();
+private:
+    //The number of slots in the ring buffer; lag+1.
+    size_t numSlots;
+    //Buffers for the ring buffers of all of the tracks. The values for
+    //slot s of track t begin at offset (t*numSlots+s)*xDim for the states
+    //and (t*numSlots+s)*xDim*xDim for the matrices.
+    double *xUpd;
+    double *PUpd;
+    double *xPred;
+    double *PPred;
+    //The smoothing gain taking each step to the next step.
+    double *C;
+    char *buffer;
+
+    size_t slotIdx(const size_t step) const;
+    void smoothTrack(double *xSmooth,double *PSmooth,const size_t curTrack,const size_t numSteps,const size_t numOut,KalmanScratch &workMem) const;
+    //Copying is not allowed.
+    FixedLagSmootherCPP(const FixedLagSmootherCPP &);
+    FixedLagSmootherCPP &operator=(const FixedLagSmootherCPP &);
+};
+
+/**The TrackTableCPP class is a fixed-capacity store of the states,
+ * covariance matrices, scores and IDs of a set of tracks that are added
+ * and removed over time. The values of the active tracks are kept packed
+ * at the start of the arrays x, P, score and ID so that the filtering and
+ * association routines can be run directly on them and so that all
+ * tracks can be read out with one contiguous copy per array. Track IDs
+ * are looked up in constant time. See the file TrackTableCPP.cpp for more
+ * details.
+ **/
+class TrackTableCPP {
+public:
+    size_t xDim;
+    size_t capacity;
+    //The number of tracks in the table. These occupy slots 0 through
+    //numTracks-1 of the arrays below.
+    size_t numTracks;
+    //The xDimXcapacity states, xDimXxDimXcapacity covariance matrices and
+    //the scores and IDs of the tracks in each slot.
+    double *x;
+    double *P;
+    double *score;
+    size_t *ID;
+    //Arrays of the same size as x and P into which routines that cannot
+    //work in place write their results before swapWork is called.
+    double *xWork;
+    double *PWork;
+
+    TrackTableCPP(const size_t xDimDes,const size_t capacityDes);
+    bool addTrack(size_t *newID,const double *xNew,const double *PNew,const double scoreNew);
+    bool removeTrack(const size_t trackID);
+    ptrdiff_t findSlot(const size_t trackID) const;
+    void predict(const double *F,const bool FIsShared,const double *Q,const bool QIsShared,const double *u);
+    void swapWork();
+    ~TrackTableCPP();
+private:
+    //For each of the capacity indices that IDs map to, the ID that
+    //currently has that index (0 if the index is free) and the slot
+    //holding the track with that ID.
+    size_t *idx2ID;
+    size_t *idx2Slot;
+    //A stack of the indices that are not in use.
+    size_t *freeIdx;
+    size_t numFree;
+    char *buffer;
+
+    //Copying is not allowed.
+    TrackTableCPP(const TrackTableCPP &);
+    TrackTableCPP &operator=(const TrackTableCPP &);
+};
+
+void measModelCPP(double *zPred,
+                  double *H,
+                  const double *x,
+                  const size_t xDim,
+                  const size_t zDim,
+                  const int measType,
+                  const double *measParam);
+/*MEASMODELCPP Evaluate the measurement function h(x) of the model given
+ *             by measType and measParam at the state x, putting the zDimX1
+ *             predicted measurement in zPred and the zDimXxDim Jacobian
+ *             matrix in H. The possible models are described in
+ *             measModelCPP.cpp.
+ */
+
+void wrapMeasResidualCPP(double *r,const int measType);
+/*WRAPMEASRESIDUALCPP Wrap the azimuthal component of the difference r
+ *              between two measurements to the range [-pi,pi) for the
+ *              nonlinear measurement models in measModelCPP.cpp.
+ */
+
+/**The BatchLSDynamicsCPP class is the interface of a nonlinear dynamic
+ * model for batchLSLMCPP. The state at step k+1, at time t_{k+1}, is
+ * modeled as a prediction f_k(x_k) of the state x_k at time t_k plus
+ * zero-mean Gaussian process noise with covariance matrix Q_k, which can
+ * depend on x_k. predict evaluates f_k. linearize also finds the Jacobian
+ * F_k of f_k and Q_k at x_k. Both return zero on success and a nonzero
+ * value if the model cannot be evaluated. Derived classes may modify
+ * scratch space held by the instance, so each thread uses its own
+ * instance, which is obtained with clone.
+ **/
+class BatchLSDynamicsCPP {
+public:
+    size_t xDim;
+
+    BatchLSDynamicsCPP(const size_t xDimDes) : xDim(xDimDes) {}
+    virtual int predict(double *xPred,const double *x,const double tStart,const double tEnd)=0;
+    virtual int linearize(double *xPred,double *F,double *Q,const double *x,const double tStart,const double tEnd)=0;
+    virtual BatchLSDynamicsCPP *clone() const=0;
+    virtual ~BatchLSDynamicsCPP() {}
+};
+
+/**The BatchLSModelCPP class holds the measurement and dynamic models used
+ * for batch least squares estimation with process noise by batchLSLMCPP.
+ * The dynamic model is either a linear model or a nonlinear model that is
+ * linearized about the current estimates. The quantities derived from the
+ * measurement and process noise covariance matrices that are needed to
+ * form the normal equations are computed once when the model is
+ * initialized and are then shared by all of the tracks that are being
+ * estimated. With a nonlinear dynamic model, the quantities for the
+ * dynamic model are instead computed for each track in the BatchLSScratch
+ * instance. See the file batchLSLMCPP.cpp for more details.
+ **/
+class BatchLSModelCPP {
+public:
+    size_t xDim;
+    size_t zDim;
+    size_t numSteps;
+    //The type of the measurement model. The possible values are described
+    //in measModelCPP.cpp.
+    int measType;
+    //For the linear model, this is the zDimXxDim measurement matrix; for
+    //the other models, it is the location of the sensor.
+    const double *measParam;
+    //The nonlinear dynamic model, which is NULL for a linear model. It is
+    //not copied.
+    const BatchLSDynamicsCPP *dyn;
+
+    BatchLSModelCPP();
+    bool init(const size_t xDimDes,const size_t zDimDes,const size_t numStepsDes,const int measTypeDes,const double *measParamDes,const double *F,const bool FIsShared,const double *R,const bool RIsShared,const double *Q,const bool QIsShared);
+    bool initNonlinDyn(const size_t xDimDes,const size_t zDimDes,const size_t numStepsDes,const int measTypeDes,const double *measParamDes,const BatchLSDynamicsCPP *dynDes,const double *R,const bool RIsShared);
+    void measFunc(double *zPred,double *H,const double *x) const;
+    void wrapResidual(double *r) const;
+    const double *RInvChol(const size_t curStep) const;
+    const double *QInv(const size_t curStep) const;
+    const double *FTQInv(const size_t curStep) const;
+    const double *FTQInvF(const size_t curStep) const;
+    const double *F(const size_t curStep) const;
+    ~BatchLSModelCPP();
+private:
+    bool RIsShared;
+    bool dynIsShared;
+    double *RInvCholBuffer;
+    double *QInvBuffer;
+    double *FTQInvBuffer;
+    double *FTQInvFBuffer;
+    double *FBuffer;
+    char *buffer;
+
+    bool initMeas(const size_t xDimDes,const size_t zDimDes,const size_t numStepsDes,const int measTypeDes,const double *measParamDes,const double *R,const bool RIsSharedDes,const size_t numDyn);
+    //Copying is not allowed.
+    BatchLSModelCPP(const BatchLSModelCPP &);
+    BatchLSModelCPP &operator=(const BatchLSModelCPP &);
+};
+
+/* The BatchLSScratch class holds the scratch space for the batch least
+ * squares routine batchLSLMCPP, including the blocks of the
+ * block-tridiagonal normal equations and, for a nonlinear dynamic model,
+ * the linearized dynamic model of the track. When processing tracks in
+ * parallel, each thread must use its own BatchLSScratch instance.
+ */
+class BatchLSScratch {
+public:
+    char *buffer;
+    size_t xDim;
+    size_t zDim;
+    size_t numSteps;
+    //numSteps diagonal blocks of the normal equations, each xDimXxDim.
+    double *D;
+    //numSteps lower-triangular Cholesky factors of the Schur complements of
+    //the damped normal equations.
+    double *L;
+    //numSteps-1 xDimXxDim matrices for the block elimination.
+    double *T;
+    //Vectors of length xDim*numSteps.
+    double *g;
+    double *h;
+    double *w;
+    double *xNew;
+    //Temporary vectors and matrices.
+    double *xTemp;
+    double *xTemp2;
+    double *xxTemp;
+    double *zTemp1;
+    double *zTemp2;
+    double *zxTemp1;
+    double *zxTemp2;
+    //For a nonlinear dynamic model, the numSteps-1 linearized dynamic
+    //models of the steps, which are the state transition matrices F, the
+    //quantities inv(Q), F'*inv(Q) and F'*inv(Q)*F and the states predicted
+    //from each step to the next, and space for 2*xDim*xDim doubles for
+    //finding them. These are NULL for a linear model.
+    double *FDyn;
+    double *QInvDyn;
+    double *FTQInvDyn;
+    double *FTQInvFDyn;
+    double *xPred;
+    double *QTemp;
+    //This thread's instance of the nonlinear dynamic model.
+    BatchLSDynamicsCPP *dyn;
+
+    BatchLSScratch(){
+        buffer=NULL;
+        dyn=NULL;
+    }
+
+    BatchLSScratch(const BatchLSModelCPP &model){
+        buffer=NULL;
+        dyn=NULL;
+        this->init(model);
+    }
+
+    void init(const BatchLSModelCPP &model){
+        char *basePtr;
+        const size_t xx=model.xDim*model.xDim;
+        const size_t numT=model.numSteps>0?model.numSteps-1:0;
+        const size_t numDyn=model.dyn==NULL?0:numT;
+        const size_t numDoubles=2*model.numSteps*xx+numT*xx+4*model.numSteps*model.xDim+2*model.xDim+xx+2*model.zDim+2*model.zDim*model.xDim+numDyn*(4*xx+model.xDim)+(model.dyn==NULL?0:2*xx);
+
+        this->freeMem();
+
+        xDim=model.xDim;
+        zDim=model.zDim;
+        numSteps=model.numSteps;
+
+        buffer=new char[numDoubles*sizeof(double)];
+        basePtr=buffer;
+        D=(double*)basePtr;
+        basePtr+=sizeof(double)*numSteps*xx;
+        L=(double*)basePtr;
+        basePtr+=sizeof(double)*numSteps*xx;
+        T=(double*)basePtr;
+        basePtr+=sizeof(double)*numT*xx;
+        g=(double*)basePtr;
+        basePtr+=sizeof(double)*numSteps*xDim;
+        h=(double*)basePtr;
+        basePtr+=sizeof(double)*numSteps*xDim;
+        w=(double*)basePtr;
+        basePtr+=sizeof(double)*numSteps*xDim;
+        xNew=(double*)basePtr;
+        basePtr+=sizeof(double)*numSteps*xDim;
+        xTemp=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim;
+        xTemp2=(double*)basePtr;
+        basePtr+=sizeof(double)*xDim;
+        xxTemp=(double*)basePtr;
+        basePtr+=sizeof(double)*xx;
+        zTemp1=(double*)basePtr;
+        basePtr+=sizeof(double)*zDim;
+        zTemp2=(double*)basePtr;
+        basePtr+=sizeof(double)*zDim;
+        zxTemp1=(double*)basePtr;
+        basePtr+=sizeof(double)*zDim*xDim;
+        zxTemp2=(double*)basePtr;
+        basePtr+=sizeof(double)*zDim*xDim;
+
+        if(model.dyn==NULL) {
+            FDyn=NULL;
+            QInvDyn=NULL;
+            FTQInvDyn=NULL;
+            FTQInvFDyn=NULL;
+            xPred=NULL;
+            QTemp=NULL;
+        } else {
+            FDyn=(double*)basePtr;
+            basePtr+=sizeof(double)*numDyn*xx;
+            QInvDyn=(double*)basePtr;
+            basePtr+=sizeof(double)*numDyn*xx;
+            FTQInvDyn=(double*)basePtr;
+            basePtr+=sizeof(double)*numDyn*xx;
+            FTQInvFDyn=(double*)basePtr;
+            basePtr+=sizeof(double)*numDyn*xx;
+            xPred=(double*)basePtr;
+            basePtr+=sizeof(double)*numDyn*xDim;
+            QTemp=(double*)basePtr;
+
+            dyn=model.dyn->clone();
+        }
+    }
+
+    ~BatchLSScratch(){
+        this->freeMem();
+    }
+private:
+    void freeMem(){
+        if(buffer!=NULL) {
+            delete[] buffer;
+            buffer=NULL;
+        }
+        if(dyn!=NULL) {
+            delete dyn;
+            dyn=NULL;
+        }
+    }
+
+    //Copying is not allowed, because the buffer would be freed twice.
+    BatchLSScratch(const BatchLSScratch &);
+    BatchLSScratch &operator=(const BatchLSScratch &);
+};
+
+int batchLSLMCPP(double *x,
+                 double *P,
+                 size_t *numIter,
+                 const double *z,
+                 const double *t,
+                 const BatchLSModelCPP &model,
+                 const double TolG,
+                 const double TolX,
+                 const size_t maxIter,
+                 const size_t maxTries,
+                 BatchLSScratch &workMem);
+/*BATCHLSLMCPP Refine the xDimXnumSteps batch of state estimates in x of a
+ *             single track using the Levenberg-Marquardt algorithm under
+ *             the models in model. t holds the numSteps times of the
+ *             steps, which are only used with a nonlinear dynamic model;
+ *             otherwise, t can be NULL. P can be NULL if the covariance
+ *             matrices are not desired. The return value is an exit code
+ *             with the same meaning as in the Matlab function
+ *             LSEstLMarquardt.
+ */
+
+/**The CDEKFDynamicsCPP class provides the joint differential equation of
+ * the state and the covariance matrix of the continuous-discrete extended
+ * Kalman filter prediction for a drift function with an analytic Jacobian
+ * and a constant diffusion term D*D'. Since the covariance matrix is
+ * symmetric, only its upper triangle is integrated, packed by column, so
+ * the integrated state has length xDim+xDim*(xDim+1)/2. The instance holds
+ * scratch space that is modified when f is called, so when processing
+ * tracks in parallel, each thread must use its own instance. The drift
+ * model and DDT are not copied. See the file CDEKFPredCPP.cpp for more
+ * details.
+ **/
+class CDEKFDynamicsCPP : public ODEDynamicsCPP {
+public:
+    //The dimensionality of the target state (not of the integrated
+    //state).
+    size_t stateDim;
+    const ODEDynamicsCPP *drift;
+    //The stateDimXstateDim matrix D*D'.
+    const double *DDT;
+
+    CDEKFDynamicsCPP(const ODEDynamicsCPP *driftDes,const double *DDTDes);
+    void f(double *dxdt,const double *x,const double t) const;
+    int predict(double *xPred,
+                double *PPred,
+                size_t *numSteps,
+                const double *xPrev,
+                const double *PPrev,
+                const double tPrev,
+                const double tPred,
+                const ODEIntParamCPP &param,
+                ODEScratchCPP &workMem);
+    /*PREDICT Predict the state xPrev and covariance matrix PPrev from time
+     *        tPrev to time tPred. workMem must have been initialized with
+     *        the dimensionality xDim of this class, not stateDim. The
+     *        return value is the exit code of ODEAdaptiveAtTimesCPP. If it
+     *        is nonzero, the values in xPred and PPred are not valid.
+     */
+    ~CDEKFDynamicsCPP();
+private:
+    char *buffer;
+    double *J;
+    double *dfdt;
+    double *jacobScratch;
+    double *PFull;
+    double *JP;
+    double *xAugStart;
+    double *xAugEnd;
+
+    //Copying is not allowed, because the buffer would be freed twice.
+    CDEKFDynamicsCPP(const CDEKFDynamicsCPP &);
+    CDEKFDynamicsCPP &operator=(const CDEKFDynamicsCPP &);
+};
+
+/**The DiscretizedDynamicsCPP class provides the differential equations
+ * for linearizing the continuous-time dynamic model dx/dt=a(x,t)+D*w(t),
+ * where w is white noise, over an interval. Starting from a state x0, the
+ * state x, the state transition matrix F=dx/dx0 and the covariance matrix
+ * Q of the accumulated process noise are integrated together. Only the
+ * upper triangle of Q is integrated, packed by column, so the integrated
+ * state has length xDim+xDim^2+xDim*(xDim+1)/2. The instance holds scratch
+ * space that is modified when f is called, so when processing tracks in
+ * parallel, each thread must use its own instance. The drift model and DDT
+ * are not copied. See the file discretizeDynCPP.cpp for more details.
+ **/
+class DiscretizedDynamicsCPP : public ODEDynamicsCPP {
+public:
+    //The dimensionality of the target state (not of the integrated
+    //state).
+    size_t stateDim;
+    const ODEDynamicsCPP *drift;
+    //The stateDimXstateDim matrix D*D'.
+    const double *DDT;
+
+    DiscretizedDynamicsCPP(const ODEDynamicsCPP *driftDes,const double *DDTDes);
+    void f(double *dxdt,const double *x,const double t) const;
+    int discretize(double *xEnd,
+                   double *F,
+                   double *Q,
+                   const double *xStart,
+                   const double tStart,
+                   const double tEnd,
+                   const ODEIntParamCPP &param,
+                   ODEScratchCPP &workMem);
+    /*DISCRETIZE Integrate the state xStart from time tStart to time tEnd,
+     *           putting the result in xEnd, the stateDimXstateDim state
+     *           transition matrix over the interval in F and the
+     *           covariance matrix of the process noise accumulated over
+     *           the interval in Q. workMem must have been initialized with
+     *           the dimensionality xDim of this class, not stateDim. The
+     *           return value is the exit code of ODEAdaptiveAtTimesCPP. If
+     *           it is nonzero, the values in xEnd, F and Q are not valid.
+     */
+    ~DiscretizedDynamicsCPP();
+private:
+    char *buffer;
+    double *J;
+    double *dfdt;
+    double *jacobScratch;
+    double *QFull;
+    double *JQ;
+    double *xAugStart;
+    double *xAugEnd;
+
+    //Copying is not allowed, because the buffer would be freed twice.
+    DiscretizedDynamicsCPP(const DiscretizedDynamicsCPP &);
+    DiscretizedDynamicsCPP &operator=(const DiscretizedDynamicsCPP &);
+};
+
+/**The ContTimeBatchLSDynamicsCPP class adapts the continuous-time dynamic
+ * model dx/dt=a(x,t)+D*w(t) to the BatchLSDynamicsCPP interface so that it
+ * can be used by batchLSLMCPP. Predictions integrate the drift function
+ * and linearizations use DiscretizedDynamicsCPP, both with the
+ * integration parameters given on construction. The drift model and DDT
+ * are not copied.
+ **/
+class ContTimeBatchLSDynamicsCPP : public BatchLSDynamicsCPP {
+public:
+    const ODEDynamicsCPP *drift;
+    //The xDimXxDim matrix D*D'.
+    const double *DDT;
+    ODEIntParamCPP param;
+
+    ContTimeBatchLSDynamicsCPP(const ODEDynamicsCPP *driftDes,const double *DDTDes,const ODEIntParamCPP &paramDes);
+    int predict(double *xPred,const double *x,const double tStart,const double tEnd);
+    int linearize(double *xPred,double *F,double *Q,const double *x,const double tStart,const double tEnd);
+    BatchLSDynamicsCPP *clone() const;
+private:
+    DiscretizedDynamicsCPP discDyn;
+    //Integrator scratch space for the augmented and the plain state.
+    ODEScratchCPP discMem;
+    ODEScratchCPP stateMem;
+
+    //Copying is not allowed; use clone.
+    ContTimeBatchLSDynamicsCPP(const ContTimeBatchLSDynamicsCPP &);
+    ContTimeBatchLSDynamicsCPP &operator=(const ContTimeBatchLSDynamicsCPP &);
+};
+
+bool PCRLBPredLinCPP(double *JPred,
+                     const double *JPrior,
+                     const double *QInv,
+                     const double *D11,
+                     const double *D12,
+                     const size_t xDim,
+                     double *scratch,
+                     size_t *pivot);
+/*PCRLBPREDLINCPP Predict the Fisher information matrix JPrior forward
+ *              over a step with the linear dynamic model x_{k+1}=F*x_k+v,
+ *              where v has covariance matrix Q, as in the Matlab function
+ *              PCRLBPredAdd with a fixed F. QInv=inv(Q), D11=F'*QInv*F and
+ *              D12=-F'*QInv are passed so that they can be shared by many
+ *              predictions. scratch must have space for 2*xDim*xDim
+ *              doubles and pivot for xDim elements. The return value is
+ *              false if JPrior+D11 is singular.
+ */
+
+void FIMMeasInfoAddCPP(double *J,
+                       const double *points,
+                       const double *w,
+                       const size_t numPoints,
+                       const size_t xDim,
+                       const size_t zDim,
+                       const int measType,
+                       const double *measParam,
+                       const double *RInv,
+                       const double PD,
+                       double *scratch);
+/*FIMMEASINFOADDCPP Add the expected information of a measurement to the
+ *              xDimXxDim Fisher information matrix J, as in the Matlab
+ *              function PCRLBUpdateAddNoClutter. The expected value of
+ *              PD*H'*RInv*H, where H is the Jacobian matrix of the
+ *              measurement model given by measType and measParam (see
+ *              measModelCPP.cpp), is taken over the xDimXnumPoints points
+ *              with weights w. scratch must have space for
+ *              zDim*(2*xDim+1) doubles.
+ */
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,105 @@
+/*MEASMODELCPP C++ implementations of the measurement models that are
+ *             shared by the compiled estimation and performance prediction
+ *             routines, which evaluate a measurement function and its
+ *             Jacobian matrix at a given state.
+ *
+ *The measurement models that are supported (measType) are
+ *0 A linear measurement model h(x)=H*x, where H is the zDimXxDim matrix
+ *  given in measParam.
+ *1 A 2D polar measurement [range;azimuth] of the position components
+ *  x(1:2) of the state, where the azimuth is measured counterclockwise
+ *  from the x-axis. measParam is the 2X1 location of the sensor.
+ *2 A 3D spherical measurement [range;azimuth;elevation] of the position
+ *  components x(1:3) of the state using systemType=0 in the function
+ *  Cart2Sphere. measParam is the 3X1 location of the sensor.
+ *3 The same as 2, except systemType=1 in the function Cart2Sphere.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+**/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For copy and fill_n
+#include <algorithm>
+//For sqrt, atan2 and floor
+#include <math.h>
+#include "matrixFuncs.hpp"
+#include "CoordFuncs.hpp"
+#include "filterFuncs.hpp"
+
+using namespace std;
+
+void measModelCPP(double *zPred,double *H,const double *x,const size_t xDim,const size_t zDim,const int measType,const double *measParam) {
+    size_t i;
+
+    if(measType==0) {
+        matVecMultCPP(zPred,measParam,x,zDim,xDim);
+        copy(measParam,measParam+zDim*xDim,H);
+        return;
+    }
+
+    fill_n(H,zDim*xDim,0.0);
+    if(measType==1) {
+        const double dx=x[0]-measParam[0];
+        const double dy=x[1]-measParam[1];
+        const double r2=dx*dx+dy*dy;
+        const double r=sqrt(r2);
+
+        zPred[0]=r;
+        zPred[1]=atan2(dy,dx);
+
+        H[0]=dx/r;
+        H[1]=-dy/r2;
+        H[2]=dy/r;
+        H[3]=dx/r2;
+    } else {
+        double delta[3], spherPoint[3], J[9];
+
+        for(i=0;i<3;i++) {
+            delta[i]=x[i]-measParam[i];
+        }
+
+        spherPoint[0]=sqrt(delta[0]*delta[0]+delta[1]*delta[1]+delta[2]*delta[2]);
+        if(measType==2) {
+            spherPoint[1]=atan2(delta[1],delta[0]);
+            spherPoint[2]=atan2(delta[2],sqrt(delta[0]*delta[0]+delta[1]*delta[1]));
+            calcSpherJacobCPP(J,spherPoint,0);
+        } else {
+            spherPoint[1]=atan2(delta[0],delta[2]);
+            spherPoint[2]=atan2(delta[1],sqrt(delta[2]*delta[2]+delta[0]*delta[0]));
+            calcSpherJacobCPP(J,spherPoint,1);
+        }
+
+        copy(spherPoint,spherPoint+3,zPred);
+        for(i=0;i<3;i++) {
+            H[0+i*3]=J[0+i*3];
+            H[1+i*3]=J[1+i*3];
+            H[2+i*3]=J[2+i*3];
+        }
+    }
+}
+
+void wrapMeasResidualCPP(double *r,const int measType) {
+    const double twoPi=2*3.14159265358979323846;
+
+    if(measType!=0) {
+        r[1]=r[1]-twoPi*floor((r[1]+twoPi/2)/twoPi);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
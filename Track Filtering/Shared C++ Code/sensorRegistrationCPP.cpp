@@ -0,0 +1,187 @@
+/**SENSORREGISTRATIONCPP The C++ implementation of the nonlinear least
+ *              squares problem of sensor registration, where additive
+ *              measurement biases of multiple sensors are estimated
+ *              jointly with the locations of multiple stationary targets
+ *              that the sensors observe.
+ *
+ *The cost function is
+ *sum_k (z_k-h(x_{t_k})-b_{s_k})'*inv(R_k)*(z_k-h(x_{t_k})-b_{s_k})
+ *+sum_s b_s'*inv(biasCov)*b_s
+ *where the second sum is only present if a prior on the biases is given.
+ *Without a prior, the biases and the target locations are only jointly
+ *observable if the geometry of the sensors permits it. Each measurement
+ *only involves the biases of one sensor and the state of one target, so
+ *the Jacobian matrix is very sparse and the target states form the
+ *independent blocks of SparseLMSolverCPP, with the biases as the reduced
+ *parameters. The residuals and the Jacobian are whitened by the lower-
+ *triangular Cholesky decompositions of the covariance matrices. The
+ *measurements are independent, so they are evaluated in parallel if
+ *OpenMP is available.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For fill
+#include <algorithm>
+#include "matrixFuncs.hpp"
+#include "filterFuncs.hpp"
+#include "sensorRegistrationCPP.hpp"
+
+using namespace std;
+
+SensorRegistrationProblemCPP::SensorRegistrationProblemCPP(const double *zDes,const size_t *sensorIdxDes,const size_t *targetIdxDes,const size_t numMeasDes,const size_t numSensorsDes,const size_t numTargetsDes,const size_t xDimDes,const size_t zDimDes,const int measTypeDes,const double *measParamDes,const double *R,const bool RIsSharedDes,const double *biasCov) : isValid(true), z(zDes), sensorIdx(sensorIdxDes), targetIdx(targetIdxDes), numMeas(numMeasDes), numSensors(numSensorsDes), numTargets(numTargetsDes), xDim(xDimDes), zDim(zDimDes), measType(measTypeDes), measParam(measParamDes), RIsShared(RIsSharedDes) {
+    const size_t zz=zDim*zDim;
+    const size_t numR=RIsShared?1:numMeas;
+    const size_t numReduced=zDim*numSensors;
+    size_t k, i, j;
+
+    RChol.resize(numR*zz);
+    for(k=0;k<numR;k++) {
+        if(!cholLowerCPP(&RChol[k*zz],R+k*zz,zDim)) {
+            isValid=false;
+        }
+    }
+
+    if(biasCov!=NULL) {
+        biasCovChol.resize(zz);
+        if(!cholLowerCPP(&biasCovChol[0],biasCov,zDim)) {
+            isValid=false;
+        }
+    }
+
+    numParams=numReduced+xDim*numTargets;
+    numResid=zDim*numMeas+(biasCov!=NULL?zDim*numSensors:0);
+
+    //Every row of a measurement involves the zDim biases of the sensor
+    //followed by the xDim components of the target state. Every row of
+    //the prior involves the biases of one sensor.
+    rowStart.resize(numResid+1);
+    colIdx.clear();
+    colIdx.reserve(zDim*numMeas*(zDim+xDim)+(numResid-zDim*numMeas)*zDim);
+    rowStart[0]=0;
+    for(k=0;k<numMeas;k++) {
+        for(i=0;i<zDim;i++) {
+            for(j=0;j<zDim;j++) {
+                colIdx.push_back(sensorIdx[k]*zDim+j);
+            }
+            for(j=0;j<xDim;j++) {
+                colIdx.push_back(numReduced+targetIdx[k]*xDim+j);
+            }
+            rowStart[k*zDim+i+1]=colIdx.size();
+        }
+    }
+    if(biasCov!=NULL) {
+        for(k=0;k<numSensors;k++) {
+            for(i=0;i<zDim;i++) {
+                for(j=0;j<zDim;j++) {
+                    colIdx.push_back(k*zDim+j);
+                }
+                rowStart[zDim*numMeas+k*zDim+i+1]=colIdx.size();
+            }
+        }
+    }
+}
+
+bool SensorRegistrationProblemCPP::evaluate(double *f,double *JVals,const double *x) const {
+    const size_t zz=zDim*zDim;
+    const size_t numReduced=zDim*numSensors;
+    const size_t rowLen=zDim+xDim;
+
+    #pragma omp parallel
+    {
+        vector<double> zPred(zDim), H(zDim*xDim), LInv(zz);
+        ptrdiff_t k;
+
+        #pragma omp for schedule(static)
+        for(k=0;k<(ptrdiff_t)numMeas;k++) {
+            const size_t s=sensorIdx[k];
+            const double *xCur=x+numReduced+targetIdx[k]*xDim;
+            const double *bCur=x+s*zDim;
+            const double *zCur=z+k*zDim;
+            const double *LCur=&RChol[RIsShared?0:k*zz];
+            const double *curParam=measType==0?measParam:measParam+s*zDim;
+            double *fCur=f+k*zDim;
+            size_t i, j;
+
+            measModelCPP(&zPred[0],&H[0],xCur,xDim,zDim,measType,curParam);
+            for(i=0;i<zDim;i++) {
+                fCur[i]=zPred[i]+bCur[i]-zCur[i];
+            }
+            wrapMeasResidualCPP(fCur,measType);
+            forwardSubstCPP(fCur,LCur,zDim,1);
+
+            if(JVals!=NULL) {
+                double *JCur=JVals+k*zDim*rowLen;
+
+                //The whitened Jacobian is inv(L)*[I,H].
+                fill(LInv.begin(),LInv.end(),0.0);
+                for(i=0;i<zDim;i++) {
+                    LInv[i+i*zDim]=1;
+                }
+                forwardSubstCPP(&LInv[0],LCur,zDim,zDim);
+                forwardSubstCPP(&H[0],LCur,zDim,xDim);
+
+                for(i=0;i<zDim;i++) {
+                    for(j=0;j<zDim;j++) {
+                        JCur[i*rowLen+j]=LInv[i+j*zDim];
+                    }
+                    for(j=0;j<xDim;j++) {
+                        JCur[i*rowLen+zDim+j]=H[i+j*zDim];
+                    }
+                }
+            }
+        }
+    }
+
+    if(!biasCovChol.empty()) {
+        const double *LCur=&biasCovChol[0];
+        double *fPrior=f+zDim*numMeas;
+        size_t s, i, j;
+
+        for(s=0;s<numSensors;s++) {
+            double *fCur=fPrior+s*zDim;
+
+            copy(x+s*zDim,x+(s+1)*zDim,fCur);
+            forwardSubstCPP(fCur,LCur,zDim,1);
+        }
+
+        if(JVals!=NULL) {
+            double *JPrior=JVals+zDim*numMeas*rowLen;
+            vector<double> LInv(zz,0.0);
+
+            for(i=0;i<zDim;i++) {
+                LInv[i+i*zDim]=1;
+            }
+            forwardSubstCPP(&LInv[0],LCur,zDim,zDim);
+
+            for(s=0;s<numSensors;s++) {
+                for(i=0;i<zDim;i++) {
+                    for(j=0;j<zDim;j++) {
+                        JPrior[(s*zDim+i)*zDim+j]=LInv[i+j*zDim];
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,75 @@
+/**SENSORREGISTRATIONCPP A header file for the C++ implementation of the
+ *              nonlinear least squares problem of jointly estimating the
+ *              measurement biases of multiple sensors and the locations of
+ *              multiple stationary targets. See the file
+ *              sensorRegistrationCPP.cpp for details.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ **/
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+#ifndef SENSORREGISTRATIONCPP
+#define SENSORREGISTRATIONCPP
+#include <stddef.h>
+#include <vector>
+#include "sparseLMCPP.hpp"
+
+/**The SensorRegistrationProblemCPP class is the least squares problem of
+ * sensor registration for use with SparseLMSolverCPP. The parameters are
+ * ordered as [b;x], where b holds the zDimX1 additive measurement biases of
+ * the numSensors sensors and x holds the xDimX1 states of the numTargets
+ * targets. Measurement k, z(:,k), is of target targetIdx[k] by sensor
+ * sensorIdx[k] (both indexed from zero) and is modeled as
+ * h(x_t)+b_s+noise, where h is given by measType as in measModelCPP.cpp.
+ * For the linear model, measParam is the zDimXxDim measurement matrix
+ * shared by all sensors; for the other models, it holds the zDimX1
+ * locations of the sensors. R holds the measurement covariance matrices,
+ * either one per measurement or a single shared matrix. If biasCov is not
+ * NULL, a zero-mean Gaussian prior with covariance matrix biasCov is put on
+ * the biases of every sensor. The inputs are not copied. isValid is false
+ * if a covariance matrix is not positive definite.
+ **/
+class SensorRegistrationProblemCPP : public SparseLSProblemCPP {
+public:
+    bool isValid;
+
+    SensorRegistrationProblemCPP(const double *zDes,const size_t *sensorIdxDes,const size_t *targetIdxDes,const size_t numMeasDes,const size_t numSensorsDes,const size_t numTargetsDes,const size_t xDimDes,const size_t zDimDes,const int measTypeDes,const double *measParamDes,const double *R,const bool RIsSharedDes,const double *biasCov);
+    bool evaluate(double *f,double *JVals,const double *x) const;
+private:
+    const double *z;
+    const size_t *sensorIdx;
+    const size_t *targetIdx;
+    size_t numMeas;
+    size_t numSensors;
+    size_t numTargets;
+    size_t xDim;
+    size_t zDim;
+    int measType;
+    const double *measParam;
+    bool RIsShared;
+    //The lower-triangular Cholesky decompositions of the measurement
+    //covariance matrices and of biasCov, which is empty if there is no
+    //prior on the biases.
+    std::vector<double> RChol;
+    std::vector<double> biasCovChol;
+};
+
+#endif
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -59,6 +59,12 @@ function [xPred,PPred,exitCode]=CDEKFPred(xPrev,PPrev,a,D,AJacob,tPrev,tPred,RKO
 %the continuous-discrete extended Kalman filter," IEEE Transactions on
 %Automatic Control, vol. 59, no. 1, pp. 273-279, Jan. 2014.
 %
+%When many tracks are to be predicted using one of the drift functions in
+%the Continuous Time dynamic models folder with a constant diffusion
+%matrix, the compiled function CDEKFPredBatch can be used instead. It uses
+%the analytic Jacobians of the models, only integrates the upper triangle
+%of the covariance matrix and processes the tracks in parallel.
+%
 %March 2015 David Karnick, Naval Research Laboratory, Washington D.C.
 %(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
 
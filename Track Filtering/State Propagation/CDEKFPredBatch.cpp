@@ -0,0 +1,328 @@
+/**CDEKFPREDBATCH Predict forward a batch of Gaussian state estimates
+ *               through time when the evolution of the states is described
+ *               by a continuous-time stochastic differential equation,
+ *               using the continuous-discrete extended Kalman filter. This
+ *               is a compiled version of CDEKFPred for drift functions
+ *               from the Continuous Time dynamic models folder with a
+ *               constant diffusion matrix. The analytic Jacobians of the
+ *               drift functions are used.
+ *
+ *INPUTS: xPrev The xDimXnumTracks state estimates at time tPrev.
+ *        PPrev The xDimXxDimXnumTracks state covariance matrices at time
+ *              tPrev. If all tracks have the same covariance matrix, a
+ *              single xDimXxDim matrix can be passed.
+ *      dynType An integer specifying the drift function. Possible values
+ *              are
+ *              0 A linear model, a(x,t)=A*x, where dynParam is the
+ *                xDimXxDim matrix A.
+ *              1 The linear motion model of aPoly. dynParam is numDim, the
+ *                number of dimensions of motion. If an empty matrix is
+ *                passed, then numDim=3.
+ *              2 The Gauss-Markov model of aGaussMarkov. dynParam is
+ *                [tau;order]. If omitted, the defaults of tau=20 and
+ *                order=2 are used.
+ *              3 The model of aCoordTurn2D with turnType='TurnRate'.
+ *                dynParam is [tauTurn;tauLinAccel]. Omitted values are
+ *                infinite. xDim must be 5 or 6.
+ *              4 The model of aCoordTurn2D with turnType='TransAccel'.
+ *                dynParam is as in 3.
+ *              5 The model of aPolarCoordTurn2D with turnType='TurnRate'.
+ *                dynParam is as in 3.
+ *              6 The model of aPolarCoordTurn2D with turnType='TransAccel'.
+ *                dynParam is as in 3.
+ *     dynParam The parameters of the drift function, as described above.
+ *            D The xDimXnoiseDim diffusion matrix, which is the same for
+ *              all tracks, such as that obtained from DPoly or
+ *              DCoordTurn2D.
+ *        tPrev The time of the estimates in xPrev and PPrev. This is a
+ *              scalar or a numTracksX1 vector.
+ *        tPred The time to which the estimates should be predicted. This
+ *              is a scalar or a numTracksX1 vector.
+ * method, RelTol, AbsTol, maxSteps, initStepSize Optional parameters of the
+ *              integration that have the same meaning as in the function
+ *              ODEAdaptiveBatchAtTimes. The integrated state consists of
+ *              the state and the upper triangle of the covariance matrix.
+ *              The Runge-Kutta-Nystroem method cannot be used. If omitted
+ *              or empty matrices are passed, the defaults are the same as
+ *              in ODEAdaptiveBatchAtTimes.
+ *
+ *OUTPUTS: xPred The xDimXnumTracks predicted state estimates.
+ *         PPred The xDimXxDimXnumTracks predicted covariance matrices.
+ *      exitCode A numTracksX1 vector of exit codes of the integration,
+ *               which are zero on success and have the same meaning as in
+ *               RKAdaptiveOverRange otherwise. If the integration failed
+ *               for a track, its predicted state and covariance matrix are
+ *               filled with NaNs.
+ *      numSteps A numTracksX1 vector of the number of steps taken.
+ *
+ *The algorithm is described in the file CDEKFPredCPP.cpp. Rather than
+ *integrating the full covariance matrix, as CDEKFPred does, only the upper
+ *triangle of the covariance matrix is integrated. If the code is compiled
+ *with OpenMP support, then the loop over the tracks is run in parallel.
+ *
+ *The algorithm can be compiled for use in Matlab using the
+ *CompileCLibraries function.
+ *
+ *The algorithm is run in Matlab using the command format
+ *[xPred,PPred,exitCode,numSteps]=CDEKFPredBatch(xPrev,PPrev,dynType,dynParam,D,tPrev,tPred,method,RelTol,AbsTol,maxSteps,initStepSize);
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For fill_n
+#include <algorithm>
+//For numeric_limits
+#include <limits>
+#include "MexValidation.h"
+#include "filterFuncs.hpp"
+#include "dynModelFuncs.hpp"
+#include "matrixFuncs.hpp"
+#include "mex.h"
+
+using namespace std;
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    size_t xDim, numTracks, noiseDim, numParam;
+    const double *xPrev, *PPrev, *tPrev, *tPred, *dynParam;
+    bool PIsShared, tPrevIsShared, tPredIsShared;
+    int dynType, method;
+    double *DDT;
+    ODEIntParamCPP param;
+    ODEDynamicsCPP *drift=NULL;
+    mxArray *xPredMATLAB, *PPredMATLAB, *exitCodeMATLAB, *numStepsMATLAB;
+    double *xPred, *PPred, *exitCode, *numStepsOut;
+    mwSize dims[3];
+    const double NaNVal=mxGetNaN();
+    const double InfVal=numeric_limits<double>::infinity();
+
+    if(nrhs<7) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>12) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    if(nlhs>4) {
+        mexErrMsgTxt("Too many outputs.");
+    }
+
+    checkRealDoubleArray(prhs[0]);
+    xDim=mxGetM(prhs[0]);
+    numTracks=mxGetN(prhs[0]);
+    if(xDim==0||numTracks==0) {
+        mexErrMsgTxt("xPrev cannot be empty.");
+    }
+
+    checkRealDoubleHypermatrix(prhs[1]);
+    {
+        const mwSize numDims=mxGetNumberOfDimensions(prhs[1]);
+        const mwSize *PDims=mxGetDimensions(prhs[1]);
+
+        if(numDims>3||PDims[0]!=xDim||PDims[1]!=xDim) {
+            mexErrMsgTxt("PPrev has the wrong dimensionality.");
+        }
+
+        PIsShared=numDims==2||PDims[2]==1;
+        if(!PIsShared&&PDims[2]!=numTracks) {
+            mexErrMsgTxt("PPrev has the wrong number of matrices.");
+        }
+    }
+
+    checkRealDoubleArray(prhs[4]);
+    if(mxGetM(prhs[4])!=xDim) {
+        mexErrMsgTxt("D has the wrong dimensionality.");
+    }
+    noiseDim=mxGetN(prhs[4]);
+
+    checkRealDoubleArray(prhs[5]);
+    checkRealDoubleArray(prhs[6]);
+    tPrevIsShared=mxGetNumberOfElements(prhs[5])==1;
+    tPredIsShared=mxGetNumberOfElements(prhs[6])==1;
+    if((!tPrevIsShared&&mxGetNumberOfElements(prhs[5])!=numTracks)||(!tPredIsShared&&mxGetNumberOfElements(prhs[6])!=numTracks)) {
+        mexErrMsgTxt("tPrev or tPred has the wrong dimensionality.");
+    }
+
+    if(nrhs>7&&!mxIsEmpty(prhs[7])) {
+        method=getIntFromMatlab(prhs[7]);
+        if(method<0||method>4||method==ODE_RKN54) {
+            mexErrMsgTxt("Invalid integration method specified.");
+        }
+        param.method=(ODEMethodCPP)method;
+    }
+
+    if(nrhs>8&&!mxIsEmpty(prhs[8])) {
+        param.RelTol=getDoubleFromMatlab(prhs[8]);
+    }
+
+    if(nrhs>9&&!mxIsEmpty(prhs[9])) {
+        param.AbsTol=getDoubleFromMatlab(prhs[9]);
+    }
+
+    if(!(param.RelTol>0)||!(param.AbsTol>0)) {
+        mexErrMsgTxt("RelTol and AbsTol must be positive.");
+    }
+
+    if(nrhs>10&&!mxIsEmpty(prhs[10])) {
+        param.maxSteps=getSizeTFromMatlab(prhs[10]);
+    }
+
+    if(nrhs>11&&!mxIsEmpty(prhs[11])) {
+        param.initStepSize=getDoubleFromMatlab(prhs[11]);
+    }
+
+    //Get the drift function.
+    dynType=getIntFromMatlab(prhs[2]);
+    numParam=mxGetNumberOfElements(prhs[3]);
+    if(numParam>0) {
+        checkRealDoubleArray(prhs[3]);
+    }
+    dynParam=(double*)mxGetData(prhs[3]);
+    switch(dynType) {
+        case 0:
+            if(mxGetM(prhs[3])!=xDim||mxGetN(prhs[3])!=xDim) {
+                mexErrMsgTxt("The matrix A has the wrong dimensionality.");
+            }
+            drift=new LinearDynamicsCPP(xDim,dynParam);
+            break;
+        case 1:
+        {
+            const size_t numDim=numParam>0?(size_t)dynParam[0]:3;
+
+            if(numDim==0||xDim%numDim!=0) {
+                mexErrMsgTxt("The dimensionality of the state must be an integer multiple of numDim.");
+            }
+            drift=new GaussMarkovDynamicsCPP(xDim,numDim,InfVal);
+            break;
+        }
+        case 2:
+        {
+            const double tau=numParam>0?dynParam[0]:20;
+            const size_t order=numParam>1?(size_t)dynParam[1]:2;
+
+            if(xDim%(order+1)!=0) {
+                mexErrMsgTxt("The dimensionality of the state must be an integer multiple of order+1.");
+            }
+            drift=new GaussMarkovDynamicsCPP(xDim,xDim/(order+1),tau);
+            break;
+        }
+        case 3:
+        case 4:
+        case 5:
+        case 6:
+        {
+            const double tauTurn=numParam>0?dynParam[0]:InfVal;
+            const double tauLinAccel=numParam>1?dynParam[1]:InfVal;
+            const bool isTransAccel=dynType==4||dynType==6;
+
+            if(xDim!=5&&xDim!=6) {
+                mexErrMsgTxt("The dimensionality of the state must be 5 or 6.");
+            }
+
+            if(dynType<5) {
+                drift=new CoordTurn2DDynamicsCPP(xDim,isTransAccel,tauTurn,tauLinAccel);
+            } else {
+                drift=new PolarCoordTurn2DDynamicsCPP(xDim,isTransAccel,tauTurn,tauLinAccel);
+            }
+            break;
+        }
+        default:
+            mexErrMsgTxt("Unknown dynamic model specified.");
+            return;
+    }
+
+    xPrev=(double*)mxGetData(prhs[0]);
+    PPrev=(double*)mxGetData(prhs[1]);
+    tPrev=(double*)mxGetData(prhs[5]);
+    tPred=(double*)mxGetData(prhs[6]);
+
+    //D*D' is the same for all tracks.
+    DDT=new double[xDim*xDim];
+    matMultABTransCPP(DDT,(double*)mxGetData(prhs[4]),(double*)mxGetData(prhs[4]),xDim,noiseDim,xDim);
+
+    xPredMATLAB=mxCreateDoubleMatrix(xDim,numTracks,mxREAL);
+    xPred=(double*)mxGetData(xPredMATLAB);
+    dims[0]=xDim;
+    dims[1]=xDim;
+    dims[2]=numTracks;
+    PPredMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+    PPred=(double*)mxGetData(PPredMATLAB);
+    exitCodeMATLAB=mxCreateDoubleMatrix(numTracks,1,mxREAL);
+    exitCode=(double*)mxGetData(exitCodeMATLAB);
+    numStepsMATLAB=mxCreateDoubleMatrix(numTracks,1,mxREAL);
+    numStepsOut=(double*)mxGetData(numStepsMATLAB);
+
+    //The tracks are independent, so they are processed in parallel if
+    //OpenMP is available. Each thread has its own scratch space and its
+    //own instance of the joint state and covariance dynamics.
+    #pragma omp parallel
+    {
+        CDEKFDynamicsCPP dyn(drift,DDT);
+        ODEScratchCPP workMem(dyn.xDim);
+        ptrdiff_t curTrackPar;
+
+        #pragma omp for schedule(dynamic)
+        for(curTrackPar=0;curTrackPar<(ptrdiff_t)numTracks;curTrackPar++) {
+            double *xPredCur=xPred+curTrackPar*xDim;
+            double *PPredCur=PPred+curTrackPar*xDim*xDim;
+            const double *PPrevCur=PIsShared?PPrev:PPrev+curTrackPar*xDim*xDim;
+            const double tPrevCur=tPrevIsShared?tPrev[0]:tPrev[curTrackPar];
+            const double tPredCur=tPredIsShared?tPred[0]:tPred[curTrackPar];
+            size_t numSteps;
+            int curExitCode;
+
+            curExitCode=dyn.predict(xPredCur,PPredCur,&numSteps,xPrev+curTrackPar*xDim,PPrevCur,tPrevCur,tPredCur,param,workMem);
+            if(curExitCode!=0) {
+                fill_n(xPredCur,xDim,NaNVal);
+                fill_n(PPredCur,xDim*xDim,NaNVal);
+            }
+
+            exitCode[curTrackPar]=curExitCode;
+            numStepsOut[curTrackPar]=(double)numSteps;
+        }
+    }
+
+    delete drift;
+    delete[] DDT;
+
+    plhs[0]=xPredMATLAB;
+    switch(nlhs) {
+        case 4:
+            plhs[3]=numStepsMATLAB;
+        case 3:
+            plhs[2]=exitCodeMATLAB;
+        case 2:
+            plhs[1]=PPredMATLAB;
+        default:
+            break;
+    }
+
+    if(nlhs<4) {
+        mxDestroyArray(numStepsMATLAB);
+    }
+    if(nlhs<3) {
+        mxDestroyArray(exitCodeMATLAB);
+    }
+    if(nlhs<2) {
+        mxDestroyArray(PPredMATLAB);
+    }
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/
@@ -0,0 +1,281 @@
+classdef TrackTable < handle
+%%TRACKTABLE A table holding the states, covariance matrices and scores of
+%       a set of tracks that changes over time, for example in a tracker
+%       that runs for a long time and starts and terminates tracks every
+%       scan. All of the memory for the table is allocated when it is
+%       created, so adding and removing tracks does not allocate memory.
+%       The prediction and the single-scan measurement update are run on
+%       the tracks in the table in C++ without copying them into Matlab.
+%       This class requires that the C++ function TrackTableCPPInt be
+%       compiled using CompileCLibraries.
+%
+%Each track that is added is given a unique positive integer ID by which it
+%can be accessed in constant time. IDs are not reused. The states of all
+%of the tracks are stored in a single xDimXcapacity array (and similarly
+%for the covariance matrices and scores), with the tracks in the table
+%occupying the first numTracks columns. When a track is removed, the last
+%track is moved into its place, so the order of the tracks changes. The
+%functions getAllTracks, predict and singleScanUpdate all use the current
+%order of the tracks, which is given by the IDs output of getAllTracks.
+%
+%An example of use with a linear dynamic model and linear measurements,
+%where new tracks are started from the unassigned measurements, is
+% theTable=TrackTable(xDim,1000);
+% for k=1:N
+%     theTable.predict(F,Q);
+%     tar2Meas=theTable.singleScanUpdate(z{k},R,0,H,PD,lambda,gateThresh,2);
+%     %Remove the tracks whose score is too low.
+%     [~,~,score,IDs]=theTable.getAllTracks();
+%     theTable.removeTracks(IDs(score<delThresh));
+%     %Start tracks from the unassigned measurements.
+%     zNew=z{k}(:,setdiff(1:size(z{k},2),tar2Meas));
+%     theTable.addTracks(xInitFun(zNew),PInit);
+% end
+%
+%October 2026 agent, Naval Research Laboratory, Washington D.C.
+%(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.
+
+properties(Access=private)
+    CPPData%The pointer to the C++ class instance.
+end
+
+methods
+    function newTable=TrackTable(xDim,capacity)
+    %%TRACKTABLE Create a new, empty track table.
+    %
+    %INPUTS: xDim The dimensionality of the states of the tracks.
+    %    capacity The maximum number of tracks that can be in the table at
+    %             once.
+    %
+    %OUTPUTS: newTable The new TrackTable object.
+
+        if(~exist('TrackTableCPPInt','file'))
+            error('The C++ function TrackTableCPPInt must be compiled to use this class.')
+        end
+
+        if(xDim<1||fix(xDim)~=xDim||capacity<1||fix(capacity)~=capacity)
+           error('The state dimensionality and the capacity must be positive integers.')
+        end
+
+        newTable.CPPData=TrackTableCPPInt('TrackTableCPP',xDim,capacity);
+    end
+
+    function IDs=addTracks(theTable,x,P,score)
+    %%ADDTRACKS Add tracks to the table.
+    %
+    %INPUTS: theTable The implicitly passed TrackTable object.
+    %               x The xDimXnumAdd set of states of the new tracks.
+    %               P The xDimXxDimXnumAdd set of covariance matrices of
+    %                 the new tracks, or a single xDimXxDim matrix if it is
+    %                 the same for all of them.
+    %           score An optional numAddX1 vector of the initial scores of
+    %                 the tracks. If omitted or an empty matrix is passed,
+    %                 the scores are zero.
+    %
+    %OUTPUTS: IDs The numAddX1 IDs of the new tracks. An error is raised if
+    %             there is not enough room in the table for all of the
+    %             tracks, in which case none are added.
+
+        if(isempty(x))
+            IDs=zeros(0,1);
+            return
+        end
+
+        if(nargin<4)
+            score=[];
+        end
+
+        IDs=TrackTableCPPInt('add',theTable.CPPData,x,P,score);
+    end
+
+    function wasRemoved=removeTracks(theTable,IDs)
+    %%REMOVETRACKS Remove the tracks with the given IDs from the table.
+    %
+    %INPUTS: theTable The implicitly passed TrackTable object.
+    %             IDs A vector of the IDs of the tracks to remove.
+    %
+    %OUTPUTS: wasRemoved A boolean vector indicating which of the IDs were
+    %                    in the table and have been removed.
+
+        wasRemoved=TrackTableCPPInt('remove',theTable.CPPData,IDs);
+    end
+
+    function [x,P,score]=getTracks(theTable,IDs)
+    %%GETTRACKS Get the states, covariance matrices and scores of the
+    %           tracks with the given IDs. An error is raised if an ID is
+    %           not in the table.
+    %
+    %INPUTS: theTable The implicitly passed TrackTable object.
+    %             IDs A vector of numIDs track IDs.
+    %
+    %OUTPUTS: x The xDimXnumIDs states of the tracks.
+    %         P The xDimXxDimXnumIDs covariance matrices of the tracks.
+    %     score The numIDsX1 scores of the tracks.
+
+        [x,P,score]=TrackTableCPPInt('get',theTable.CPPData,IDs);
+    end
+
+    function setTracks(theTable,IDs,x,P,score)
+    %%SETTRACKS Change the states, covariance matrices and scores of the
+    %           tracks with the given IDs, for example after they have been
+    %           updated by a filter in Matlab. An error is raised if an ID
+    %           is not in the table.
+    %
+    %INPUTS: theTable The implicitly passed TrackTable object.
+    %             IDs A vector of numIDs track IDs.
+    %               x The xDimXnumIDs new states of the tracks or an empty
+    %                 matrix if the states should not be changed.
+    %               P The xDimXxDimXnumIDs new covariance matrices of the
+    %                 tracks, a single xDimXxDim matrix to use for all of
+    %                 them, or an empty matrix if the covariance matrices
+    %                 should not be changed. This is optional.
+    %           score The numIDsX1 new scores of the tracks or an empty
+    %                 matrix if the scores should not be changed. This is
+    %                 optional.
+    %
+    %OUTPUTS: None. The tracks in the table are modified.
+
+        if(nargin<4)
+            P=[];
+        end
+
+        if(nargin<5)
+            score=[];
+        end
+
+        TrackTableCPPInt('set',theTable.CPPData,IDs,x,P,score);
+    end
+
+    function [x,P,score,IDs]=getAllTracks(theTable)
+    %%GETALLTRACKS Get all of the tracks in the table in their current
+    %              order.
+    %
+    %INPUT: theTable The implicitly passed TrackTable object.
+    %
+    %OUTPUTS: x The xDimXnumTracks states of the tracks.
+    %         P The xDimXxDimXnumTracks covariance matrices of the tracks.
+    %     score The numTracksX1 scores of the tracks.
+    %       IDs The numTracksX1 IDs of the tracks.
+    %
+    %The tracks are stored contiguously, so each output is obtained with a
+    %single copy. If only the states are needed, it is faster to request
+    %only the first output.
+
+        switch(nargout)
+            case {0,1}
+                x=TrackTableCPPInt('getAll',theTable.CPPData);
+            case 2
+                [x,P]=TrackTableCPPInt('getAll',theTable.CPPData);
+            case 3
+                [x,P,score]=TrackTableCPPInt('getAll',theTable.CPPData);
+            otherwise
+                [x,P,score,IDs]=TrackTableCPPInt('getAll',theTable.CPPData);
+        end
+    end
+
+    function predict(theTable,F,Q,u)
+    %%PREDICT Predict all of the tracks in the table forward using a
+    %         linear dynamic model, as in the function DiscKalPred.
+    %
+    %INPUTS: theTable The implicitly passed TrackTable object.
+    %               F The xDimXxDimXnumTracks set of state transition
+    %                 matrices, or a single xDimXxDim matrix if it is shared
+    %                 by all tracks.
+    %               Q The xDimXxDimXnumTracks set of process noise
+    %                 covariance matrices, or a single xDimXxDim matrix if
+    %                 it is shared by all tracks.
+    %               u An optional xDimXnumTracks matrix of control inputs.
+    %                 If omitted or an empty matrix is passed, no control
+    %                 input is used.
+    %
+    %OUTPUTS: None. The tracks in the table are predicted. Stacks of
+    %         matrices and control inputs are in the order given by
+    %         getAllTracks.
+
+        if(nargin<4)
+            u=[];
+        end
+
+        TrackTableCPPInt('predict',theTable.CPPData,F,Q,u);
+    end
+
+    function [tar2Meas,logLikes,clustIdx]=singleScanUpdate(theTable,z,R,measType,measParam,PD,lambda,gateThresh,algSel)
+    %%SINGLESCANUPDATE Update all of the tracks in the table with a scan of
+    %           measurements using a single-scan data association
+    %           algorithm, as in the function singleScanUpdateBatch. The
+    %           log-likelihood ratio of the update of each track is added
+    %           to its score.
+    %
+    %INPUTS: theTable The implicitly passed TrackTable object.
+    %               z The zDimXnumMeas set of measurements. This can be
+    %                 empty.
+    %               R The zDimXzDim measurement covariance matrix.
+    %  measType, measParam The measurement model, as in
+    %                 singleScanUpdateBatch. For measType=0, measParam is
+    %                 the zDimXxDim measurement matrix.
+    %              PD The detection probability, either a scalar or one
+    %                 value per track, in the order given by getAllTracks.
+    %          lambda The clutter density.
+    % gateThresh, algSel The gating threshold and the algorithm to use, as
+    %                 in singleScanUpdateBatch. These are optional.
+    %
+    %OUTPUTS: tar2Meas A numTracksX1 vector of the index of the measurement
+    %                 assigned to each track (or having the highest
+    %                 association probability) or 0 if a missed detection
+    %                 was chosen. The tracks are in the order given by
+    %                 getAllTracks.
+    %        logLikes The numTracksX1 log-likelihood ratios of the updates.
+    %        clustIdx The numTracksX1 indices of the clusters of the tracks.
+
+        if(nargin<8)
+            gateThresh=[];
+        end
+
+        if(nargin<9)
+            algSel=[];
+        end
+
+        switch(nargout)
+            case {0,1}
+                tar2Meas=TrackTableCPPInt('singleScanUpdate',theTable.CPPData,z,R,measType,measParam,PD,lambda,gateThresh,algSel);
+            case 2
+                [tar2Meas,logLikes]=TrackTableCPPInt('singleScanUpdate',theTable.CPPData,z,R,measType,measParam,PD,lambda,gateThresh,algSel);
+            otherwise
+                [tar2Meas,logLikes,clustIdx]=TrackTableCPPInt('singleScanUpdate',theTable.CPPData,z,R,measType,measParam,PD,lambda,gateThresh,algSel);
+        end
+    end
+
+    function [xDim,capacity,numTracks]=getDims(theTable)
+
+        [xDim,capacity,numTracks]=TrackTableCPPInt('getDims',theTable.CPPData);
+        xDim=double(xDim);
+        capacity=double(capacity);
+        numTracks=double(numTracks);
+    end
+
+    function delete(theTable)
+
+        if(~isempty(theTable.CPPData))
+            TrackTableCPPInt('~TrackTableCPP',theTable.CPPData);
+        end
+    end
+end
+end
+
+%LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.
@@ -0,0 +1,539 @@
+/**TRACKTABLECPPINT An interface between the Matlab TrackTable class and
+ *              the C++ TrackTableCPP class. This function is meant to be
+ *              called by the TrackTable class in Matlab; not directly by
+ *              the user. Input validation beyond checking the dimensions
+ *              of the matrices is left to the Matlab class.
+ *
+ *The function is called as
+ *CPPData=TrackTableCPPInt('TrackTableCPP',xDim,capacity);
+ *or
+ *IDs=TrackTableCPPInt('add',CPPData,x,P,score);
+ *or
+ *wasRemoved=TrackTableCPPInt('remove',CPPData,IDs);
+ *or
+ *[x,P,score]=TrackTableCPPInt('get',CPPData,IDs);
+ *or
+ *TrackTableCPPInt('set',CPPData,IDs,x,P,score);
+ *or
+ *[x,P,score,IDs]=TrackTableCPPInt('getAll',CPPData);
+ *or
+ *TrackTableCPPInt('predict',CPPData,F,Q,u);
+ *or
+ *[tar2Meas,logLikes,clustIdx]=TrackTableCPPInt('singleScanUpdate',CPPData,z,R,measType,measParam,PD,lambda,gateThresh,algSel);
+ *or
+ *[xDim,capacity,numTracks]=TrackTableCPPInt('getDims',CPPData);
+ *or
+ *TrackTableCPPInt('~TrackTableCPP',CPPData);
+ *
+ *See the TrackTable class for a description of the inputs and outputs.
+ *
+ *October 2026 agent, Naval Research Laboratory, Washington D.C.
+ */
+/*(UNCLASSIFIED) DISTRIBUTION STATEMENT A. Approved for public release.*/
+
+//For strcmp
+#include <cstring>
+//For copy
+#include <algorithm>
+#include "MexValidation.h"
+#include "filterFuncs.hpp"
+#include "singleScanUpdateCPP.hpp"
+#include "mex.h"
+
+using namespace std;
+
+//Prototypes for the helper functions.
+bool checkMatStack(const mxArray *mat,const size_t numRow,const size_t numCol,const size_t numTracks);
+size_t *getSlots(const TrackTableCPP *theTable,const mxArray *IDsMATLAB,size_t *numIDs);
+
+void mexFunction(const int nlhs, mxArray *plhs[], const int nrhs, const mxArray *prhs[]) {
+    char cmd[64];
+    TrackTableCPP *theTable;
+
+    if(nrhs<2) {
+        mexErrMsgTxt("Not enough inputs.");
+    }
+
+    if(nrhs>10) {
+        mexErrMsgTxt("Too many inputs.");
+    }
+
+    //Get the command string that is passed.
+    mxGetString(prhs[0], cmd, sizeof(cmd));
+
+    if(!strcmp("TrackTableCPP", cmd)){
+        size_t xDim, capacity;
+
+        if(nrhs!=3) {
+            mexErrMsgTxt("Incorrect number of inputs.");
+        }
+
+        xDim=getSizeTFromMatlab(prhs[1]);
+        capacity=getSizeTFromMatlab(prhs[2]);
+        if(xDim==0||capacity==0) {
+            mexErrMsgTxt("The state dimensionality and the capacity must be positive.");
+        }
+
+        theTable=new TrackTableCPP(xDim,capacity);
+
+        //Lock this mex file so that it can not be cleared until the object
+        //has been deleted (This avoids a memory leak).
+        mexLock();
+        //Return the pointer to the table
+        plhs[0]=ptr2Matlab<TrackTableCPP*>(theTable);
+    } else if(!strcmp("add",cmd)) {
+        size_t xDim, xDim2, numAdd, i;
+        bool PIsShared;
+        const double *x, *P, *score=NULL;
+        double *IDs;
+
+        if(nrhs<4) {
+            mexErrMsgTxt("Not enough inputs.");
+        }
+
+        theTable=Matlab2Ptr<TrackTableCPP*>(prhs[1]);
+        xDim=theTable->xDim;
+        xDim2=xDim*xDim;
+
+        checkRealDoubleArray(prhs[2]);
+        checkRealDoubleHypermatrix(prhs[3]);
+        numAdd=mxGetN(prhs[2]);
+        if(mxGetM(prhs[2])!=xDim&&numAdd!=0) {
+            mexErrMsgTxt("x has the wrong dimensionality.");
+        }
+        x=(double*)mxGetData(prhs[2]);
+        P=(double*)mxGetData(prhs[3]);
+        PIsShared=checkMatStack(prhs[3],xDim,xDim,numAdd);
+
+        if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+            checkRealDoubleArray(prhs[4]);
+            if(mxGetNumberOfElements(prhs[4])!=numAdd) {
+                mexErrMsgTxt("score has the wrong dimensionality.");
+            }
+            score=(double*)mxGetData(prhs[4]);
+        }
+
+        if(numAdd>theTable->capacity-theTable->numTracks) {
+            mexErrMsgTxt("There is not enough room in the track table.");
+        }
+
+        plhs[0]=mxCreateDoubleMatrix(numAdd,1,mxREAL);
+        IDs=(double*)mxGetData(plhs[0]);
+        for(i=0;i<numAdd;i++) {
+            const double *PCur=PIsShared?P:P+xDim2*i;
+            size_t newID;
+
+            theTable->addTrack(&newID,x+xDim*i,PCur,score==NULL?0:score[i]);
+            IDs[i]=(double)newID;
+        }
+    } else if(!strcmp("remove",cmd)) {
+        size_t *IDs, numIDs, i;
+        bool *wasRemoved;
+
+        if(nrhs!=3) {
+            mexErrMsgTxt("Incorrect number of inputs.");
+        }
+
+        theTable=Matlab2Ptr<TrackTableCPP*>(prhs[1]);
+        IDs=copySizeTArrayFromMatlab(prhs[2],&numIDs);
+
+        wasRemoved=new bool[numIDs];
+        for(i=0;i<numIDs;i++) {
+            wasRemoved[i]=theTable->removeTrack(IDs[i]);
+        }
+        mxFree(IDs);
+
+        if(nlhs>0) {
+            plhs[0]=boolMat2Matlab(wasRemoved,numIDs,1);
+        }
+        delete[] wasRemoved;
+    } else if(!strcmp("get",cmd)) {
+        size_t xDim, xDim2, numIDs, *slots, i;
+        double *x, *P, *score;
+        mxArray *xMATLAB, *PMATLAB, *scoreMATLAB;
+        mwSize dims[3];
+
+        if(nrhs!=3) {
+            mexErrMsgTxt("Incorrect number of inputs.");
+        }
+
+        theTable=Matlab2Ptr<TrackTableCPP*>(prhs[1]);
+        xDim=theTable->xDim;
+        xDim2=xDim*xDim;
+        slots=getSlots(theTable,prhs[2],&numIDs);
+
+        xMATLAB=mxCreateDoubleMatrix(xDim,numIDs,mxREAL);
+        x=(double*)mxGetData(xMATLAB);
+        dims[0]=xDim;
+        dims[1]=xDim;
+        dims[2]=numIDs;
+        PMATLAB=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+        P=(double*)mxGetData(PMATLAB);
+        scoreMATLAB=mxCreateDoubleMatrix(numIDs,1,mxREAL);
+        score=(double*)mxGetData(scoreMATLAB);
+
+        for(i=0;i<numIDs;i++) {
+            const size_t slot=slots[i];
+
+            copy(theTable->x+xDim*slot,theTable->x+xDim*(slot+1),x+xDim*i);
+            copy(theTable->P+xDim2*slot,theTable->P+xDim2*(slot+1),P+xDim2*i);
+            score[i]=theTable->score[slot];
+        }
+        mxFree(slots);
+
+        plhs[0]=xMATLAB;
+        switch(nlhs) {
+            case 3:
+                plhs[2]=scoreMATLAB;
+            case 2:
+                plhs[1]=PMATLAB;
+            default:
+                break;
+        }
+
+        if(nlhs<3) {
+            mxDestroyArray(scoreMATLAB);
+        }
+        if(nlhs<2) {
+            mxDestroyArray(PMATLAB);
+        }
+    } else if(!strcmp("set",cmd)) {
+        size_t xDim, xDim2, numIDs, *slots, i;
+        bool PIsShared=false;
+        const double *x=NULL, *P=NULL, *score=NULL;
+
+        if(nrhs<4) {
+            mexErrMsgTxt("Not enough inputs.");
+        }
+
+        theTable=Matlab2Ptr<TrackTableCPP*>(prhs[1]);
+        xDim=theTable->xDim;
+        xDim2=xDim*xDim;
+        slots=getSlots(theTable,prhs[2],&numIDs);
+
+        //Empty matrices are passed for the values that are not to be
+        //changed.
+        if(!mxIsEmpty(prhs[3])) {
+            checkRealDoubleArray(prhs[3]);
+            if(mxGetM(prhs[3])!=xDim||mxGetN(prhs[3])!=numIDs) {
+                mxFree(slots);
+                mexErrMsgTxt("x has the wrong dimensionality.");
+            }
+            x=(double*)mxGetData(prhs[3]);
+        }
+
+        if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+            checkRealDoubleHypermatrix(prhs[4]);
+            PIsShared=checkMatStack(prhs[4],xDim,xDim,numIDs);
+            P=(double*)mxGetData(prhs[4]);
+        }
+
+        if(nrhs>5&&!mxIsEmpty(prhs[5])) {
+            checkRealDoubleArray(prhs[5]);
+            if(mxGetNumberOfElements(prhs[5])!=numIDs) {
+                mxFree(slots);
+                mexErrMsgTxt("score has the wrong dimensionality.");
+            }
+            score=(double*)mxGetData(prhs[5]);
+        }
+
+        for(i=0;i<numIDs;i++) {
+            const size_t slot=slots[i];
+
+            if(x!=NULL) {
+                copy(x+xDim*i,x+xDim*(i+1),theTable->x+xDim*slot);
+            }
+
+            if(P!=NULL) {
+                const double *PCur=PIsShared?P:P+xDim2*i;
+
+                copy(PCur,PCur+xDim2,theTable->P+xDim2*slot);
+            }
+
+            if(score!=NULL) {
+                theTable->score[slot]=score[i];
+            }
+        }
+        mxFree(slots);
+    } else if(!strcmp("getAll",cmd)) {
+        size_t xDim, numTracks, i;
+        double *IDs;
+        mwSize dims[3];
+
+        theTable=Matlab2Ptr<TrackTableCPP*>(prhs[1]);
+        xDim=theTable->xDim;
+        numTracks=theTable->numTracks;
+
+        //The tracks are packed at the start of the arrays, so each value
+        //is obtained with a single copy.
+        plhs[0]=doubleMat2Matlab(theTable->x,xDim,numTracks);
+        if(nlhs>1) {
+            dims[0]=xDim;
+            dims[1]=xDim;
+            dims[2]=numTracks;
+            plhs[1]=mxCreateNumericArray(3,dims,mxDOUBLE_CLASS,mxREAL);
+            copy(theTable->P,theTable->P+xDim*xDim*numTracks,(double*)mxGetData(plhs[1]));
+        }
+
+        if(nlhs>2) {
+            plhs[2]=doubleMat2Matlab(theTable->score,numTracks,1);
+        }
+
+        if(nlhs>3) {
+            plhs[3]=mxCreateDoubleMatrix(numTracks,1,mxREAL);
+            IDs=(double*)mxGetData(plhs[3]);
+            for(i=0;i<numTracks;i++) {
+                IDs[i]=(double)theTable->ID[i];
+            }
+        }
+    } else if(!strcmp("predict",cmd)) {
+        size_t xDim, numTracks;
+        bool FIsShared, QIsShared;
+        double *u=NULL;
+
+        if(nrhs<4) {
+            mexErrMsgTxt("Not enough inputs.");
+        }
+
+        theTable=Matlab2Ptr<TrackTableCPP*>(prhs[1]);
+        xDim=theTable->xDim;
+        numTracks=theTable->numTracks;
+
+        checkRealDoubleHypermatrix(prhs[2]);
+        checkRealDoubleHypermatrix(prhs[3]);
+        FIsShared=checkMatStack(prhs[2],xDim,xDim,numTracks);
+        QIsShared=checkMatStack(prhs[3],xDim,xDim,numTracks);
+
+        if(nrhs>4&&!mxIsEmpty(prhs[4])) {
+            checkRealDoubleArray(prhs[4]);
+            if(mxGetM(prhs[4])!=xDim||mxGetN(prhs[4])!=numTracks) {
+                mexErrMsgTxt("u has the wrong dimensionality.");
+            }
+            u=(double*)mxGetData(prhs[4]);
+        }
+
+        theTable->predict((double*)mxGetData(prhs[2]),FIsShared,(double*)mxGetData(prhs[3]),QIsShared,u);
+    } else if(!strcmp("singleScanUpdate",cmd)) {
+        size_t xDim, zDim, numTracks, numMeas, numClust, i;
+        bool PDIsScalar;
+        const double *z, *PD;
+        double *logLikes, *tar2MeasOut, *clustIdxOut;
+        ptrdiff_t *tar2Meas;
+        size_t *clustIdx;
+        mxArray *tar2MeasMATLAB, *logLikesMATLAB, *clustIdxMATLAB;
+        SingleScanParamCPP param;
+
+        if(nrhs<8) {
+            mexErrMsgTxt("Not enough inputs.");
+        }
+
+        theTable=Matlab2Ptr<TrackTableCPP*>(prhs[1]);
+        xDim=theTable->xDim;
+        numTracks=theTable->numTracks;
+
+        checkRealDoubleArray(prhs[3]);
+        zDim=mxGetM(prhs[3]);
+        if(mxGetN(prhs[3])!=zDim) {
+            mexErrMsgTxt("R must be a square matrix.");
+        }
+        param.R=(double*)mxGetData(prhs[3]);
+
+        if(!mxIsEmpty(prhs[2])) {
+            checkRealDoubleArray(prhs[2]);
+            if(mxGetM(prhs[2])!=zDim) {
+                mexErrMsgTxt("The dimensions of z are inconsistent with R.");
+            }
+            numMeas=mxGetN(prhs[2]);
+            z=(double*)mxGetData(prhs[2]);
+        } else {
+            numMeas=0;
+            z=NULL;
+        }
+
+        param.measType=getIntFromMatlab(prhs[4]);
+        checkRealDoubleArray(prhs[5]);
+        switch(param.measType) {
+            case 0:
+                if(mxGetM(prhs[5])!=zDim||mxGetN(prhs[5])!=xDim) {
+                    mexErrMsgTxt("The measurement matrix has the wrong dimensionality.");
+                }
+                break;
+            case 1:
+            case 2:
+            case 3:
+            {
+                const size_t posDim=param.measType==1?2:3;
+
+                if(mxGetNumberOfElements(prhs[5])!=posDim) {
+                    mexErrMsgTxt("The sensor location has the wrong dimensionality.");
+                }
+
+                if(zDim!=posDim||xDim<posDim) {
+                    mexErrMsgTxt("The dimensions of the state or R are inconsistent with the measurement type.");
+                }
+                break;
+            }
+            default:
+                mexErrMsgTxt("Unknown measurement type specified.");
+        }
+        param.measParam=(double*)mxGetData(prhs[5]);
+
+        checkRealDoubleArray(prhs[6]);
+        PDIsScalar=mxGetNumberOfElements(prhs[6])==1;
+        if(!PDIsScalar&&mxGetNumberOfElements(prhs[6])!=numTracks) {
+            mexErrMsgTxt("PD has the wrong dimensionality.");
+        }
+        PD=(double*)mxGetData(prhs[6]);
+        for(i=0;i<mxGetNumberOfElements(prhs[6]);i++) {
+            if(!(PD[i]>0&&PD[i]<1)) {
+                mexErrMsgTxt("PD must be between 0 and 1 exclusive.");
+            }
+        }
+
+        param.lambda=getDoubleFromMatlab(prhs[7]);
+        if(!(param.lambda>0)) {
+            mexErrMsgTxt("lambda must be positive.");
+        }
+
+        if(nrhs>8&&!mxIsEmpty(prhs[8])) {
+            param.gateThresh=getDoubleFromMatlab(prhs[8]);
+        }
+
+        if(nrhs>9&&!mxIsEmpty(prhs[9])) {
+            param.algSel=getIntFromMatlab(prhs[9]);
+            if(param.algSel<0||param.algSel>4) {
+                mexErrMsgTxt("Unsupported algorithm selected.");
+            }
+        }
+
+        logLikesMATLAB=mxCreateDoubleMatrix(numTracks,1,mxREAL);
+        logLikes=(double*)mxGetData(logLikesMATLAB);
+        tar2Meas=new ptrdiff_t[numTracks];
+        clustIdx=new size_t[numTracks];
+
+        //The update is run directly on the tracks in the table with the
+        //results going into the work arrays, which then become the states
+        //and covariance matrices of the tracks.
+        if(numTracks>0) {
+            if(!singleScanUpdateCPP(theTable->xWork,theTable->PWork,logLikes,tar2Meas,clustIdx,&numClust,theTable->x,theTable->P,PD,PDIsScalar,z,xDim,zDim,numTracks,numMeas,param)) {
+                delete[] clustIdx;
+                delete[] tar2Meas;
+                mxDestroyArray(logLikesMATLAB);
+                mexErrMsgTxt("An innovation covariance matrix is not positive definite.");
+            }
+            theTable->swapWork();
+        }
+
+        tar2MeasMATLAB=mxCreateDoubleMatrix(numTracks,1,mxREAL);
+        tar2MeasOut=(double*)mxGetData(tar2MeasMATLAB);
+        clustIdxMATLAB=mxCreateDoubleMatrix(numTracks,1,mxREAL);
+        clustIdxOut=(double*)mxGetData(clustIdxMATLAB);
+        for(i=0;i<numTracks;i++) {
+            theTable->score[i]+=logLikes[i];
+            //Convert to Matlab's indexation.
+            tar2MeasOut[i]=(double)(tar2Meas[i]+1);
+            clustIdxOut[i]=(double)(clustIdx[i]+1);
+        }
+        delete[] clustIdx;
+        delete[] tar2Meas;
+
+        plhs[0]=tar2MeasMATLAB;
+        switch(nlhs) {
+            case 3:
+                plhs[2]=clustIdxMATLAB;
+            case 2:
+                plhs[1]=logLikesMATLAB;
+            default:
+                break;
+        }
+
+        if(nlhs<3) {
+            mxDestroyArray(clustIdxMATLAB);
+        }
+        if(nlhs<2) {
+            mxDestroyArray(logLikesMATLAB);
+        }
+    } else if(!strcmp("getDims",cmd)) {
+        theTable=Matlab2Ptr<TrackTableCPP*>(prhs[1]);
+
+        switch(nlhs) {
+            case 3:
+                plhs[2]=unsignedSizeMat2Matlab(&(theTable->numTracks),1,1);
+            case 2:
+                plhs[1]=unsignedSizeMat2Matlab(&(theTable->capacity),1,1);
+            default:
+                plhs[0]=unsignedSizeMat2Matlab(&(theTable->xDim),1,1);
+        }
+    } else if(!strcmp("~TrackTableCPP", cmd)){
+        theTable=Matlab2Ptr<TrackTableCPP*>(prhs[1]);
+
+        delete theTable;
+        //Unlock the mex file allowing it to be cleared.
+        mexUnlock();
+    } else {
+        mexErrMsgTxt("Invalid string passed to TrackTableCPPInt.");
+    }
+}
+
+bool checkMatStack(const mxArray *mat,const size_t numRow,const size_t numCol,const size_t numTracks) {
+/*CHECKMATSTACK Verify that a matrix is either numRowXnumCol or
+ *              numRowXnumColXnumTracks. The return value is true if a
+ *              single matrix that is shared by all tracks was passed.
+ */
+    const mwSize numDims=mxGetNumberOfDimensions(mat);
+    const mwSize *dims=mxGetDimensions(mat);
+
+    if(dims[0]!=numRow||dims[1]!=numCol||numDims>3) {
+        mexErrMsgTxt("A matrix input has the wrong dimensionality.");
+    }
+
+    if(numDims==2||dims[2]==1) {
+        return true;
+    }
+
+    if(dims[2]!=numTracks) {
+        mexErrMsgTxt("A stack of matrices must have one matrix per track.");
+    }
+
+    return false;
+}
+
+size_t *getSlots(const TrackTableCPP *theTable,const mxArray *IDsMATLAB,size_t *numIDs) {
+/*GETSLOTS Get the slots of the tracks with the IDs in the Matlab array
+ *         IDsMATLAB, putting the number of IDs in numIDs. An error is
+ *         raised if any of the IDs is not in the table. The returned
+ *         array must be freed with mxFree.
+ */
+    size_t *slots=copySizeTArrayFromMatlab(IDsMATLAB,numIDs);
+    size_t i;
+
+    for(i=0;i<*numIDs;i++) {
+        const ptrdiff_t slot=theTable->findSlot(slots[i]);
+
+        if(slot<0) {
+            mxFree(slots);
+            mexErrMsgTxt("A track ID is not in the track table.");
+        }
+        slots[i]=(size_t)slot;
+    }
+
+    return slots;
+}
+
+/*LICENSE:
+%
+%The source code is in the public domain and not licensed or under
+%copyright. The information and software may be used freely by the public.
+%As required by 17 U.S.C. 403, third parties producing copyrighted works
+%consisting predominantly of the material produced by U.S. government
+%agencies must provide notice with such work(s) identifying the U.S.
+%Government material incorporated and stating that such material is not
+%subject to copyright protection.
+%
+%Derived works shall not identify themselves in a manner that implies an
+%endorsement by or an affiliation with the Naval Research Laboratory.
+%
+%RECIPIENT BEARS ALL RISK RELATING TO QUALITY AND PERFORMANCE OF THE
+%SOFTWARE AND ANY RELATED MATERIALS, AND AGREES TO INDEMNIFY THE NAVAL
+%RESEARCH LABORATORY FOR ALL THIRD-PARTY CLAIMS RESULTING FROM THE ACTIONS
+%OF RECIPIENT IN THE USE OF THE SOFTWARE.*/